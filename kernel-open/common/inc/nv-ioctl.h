@@ -148,4 +148,32 @@ typedef struct nv_ioctl_wait_open_complete
     NvU32 adapterStatus;
 } nv_ioctl_wait_open_complete_t;
 
+/*
+ * Per-GPU stats snapshot for telemetry pollers. Covers the data from
+ * /proc/driver/nvidia/gpus/.../information that is available without a call
+ * into RM, in one fixed-layout struct, so frequent queries avoid the procfs
+ * text formatting path. Strings that are constant for the life of the driver
+ * load (model name, VBIOS, firmware version) remain procfs-only.
+ */
+#define NV_GPU_STATS_VERSION 1
+
+typedef struct nv_ioctl_gpu_stats
+{
+    NvU32         version;           /* out: NV_GPU_STATS_VERSION */
+    NvU32         gpu_id;
+    nv_pci_info_t pci_info;
+    NvU16         subsystem_vendor;
+    NvU16         subsystem_id;
+    NvU32         interrupt_line;
+    NvU32         minor_number;
+    NvU32         flags;             /* out: NV_FLAG_* device flags */
+    NvU8          uuid_valid;
+    NvU8          uuid[16];
+    NvU8          reserved[7];
+    NvU64         dma_mask         NV_ALIGN_BYTES(8);
+    NvU64         bar_addresses[3] NV_ALIGN_BYTES(8);
+    NvU64         bar_sizes[3]     NV_ALIGN_BYTES(8);
+    NvU32         status;
+} nv_ioctl_gpu_stats_t;
+
 #endif
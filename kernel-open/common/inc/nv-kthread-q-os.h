@@ -29,6 +29,7 @@
 #include <linux/sched.h>            // task_struct
 #include <linux/numa.h>             // NUMA_NO_NODE
 #include <linux/semaphore.h>
+#include <linux/wait.h>             // wait_queue_head_t
 
 #include "conftest.h"
 
@@ -52,6 +53,53 @@ struct nv_kthread_q_item
     void *function_args;
 };
 
+// Upper limit on the number of worker kthreads in one nv_kthread_q_multi
+// instance. Requests for more workers than this are silently clamped.
+#define NV_KTHREAD_Q_MAX_WORKERS 8
+
+struct nv_kthread_q_multi_worker
+{
+    // Local item list for this worker. nv_kthread_q_multi_schedule_q_item
+    // feeds these lists round-robin, and an idle worker steals from its
+    // siblings' lists.
+    struct list_head q_list_head;
+    spinlock_t q_lock;
+
+    // Set while the worker is claiming and running an item. Raised before
+    // the item is taken off a list, and cleared only after serviced_count
+    // has been advanced, so a flusher can tell whether this worker might
+    // still be mid-item.
+    atomic_t busy;
+
+    // Total number of q_items this worker has finished running. This only
+    // ever advances, so a flusher can wait for "current item done" by
+    // watching for any change.
+    atomic_long_t serviced_count;
+
+    struct task_struct *q_kthread;
+    struct nv_kthread_q_multi *q_multi;
+};
+
+struct nv_kthread_q_multi
+{
+    struct nv_kthread_q_multi_worker workers[NV_KTHREAD_Q_MAX_WORKERS];
+    unsigned int num_workers;
+
+    // Round-robin cursor for spreading newly scheduled q_items across the
+    // worker lists.
+    atomic_t next_worker;
+
+    // This is a counting semaphore, shared by all workers. It gets
+    // incremented and decremented exactly once for each item that is added
+    // to any of the per-worker lists.
+    struct semaphore q_sem;
+    atomic_t main_loop_should_exit;
+
+    // Workers wake this up after each item completes. Flushers wait here
+    // for workers that are mid-item.
+    wait_queue_head_t serviced_wq;
+};
+
 
 #ifndef NUMA_NO_NODE
 #define NUMA_NO_NODE (-1)
@@ -25,8 +25,10 @@
 #define __NV_KTHREAD_QUEUE_H__
 
 struct nv_kthread_q;
+struct nv_kthread_q_multi;
 struct nv_kthread_q_item;
 typedef struct nv_kthread_q nv_kthread_q_t;
+typedef struct nv_kthread_q_multi nv_kthread_q_multi_t;
 typedef struct nv_kthread_q_item nv_kthread_q_item_t;
 
 typedef void (*nv_q_func_t)(void *args);
@@ -199,6 +201,92 @@ void nv_kthread_q_item_init(nv_kthread_q_item_t *q_item,
 int nv_kthread_q_schedule_q_item(nv_kthread_q_t *q,
                                  nv_kthread_q_item_t *q_item);
 
+////////////////////////////////////////////////////////////////////////////////
+// nv_kthread_q_multi:
+//
+// This is a multi-worker variant of nv_kthread_q, for queues whose items are
+// ordering-insensitive and whose arrival rate can exceed what one kthread can
+// service. An nv_kthread_q_multi is serviced by several kthreads. Each worker
+// has its own local item list; newly scheduled items are spread round-robin
+// across those lists, and an idle worker steals items from its siblings'
+// lists, so a burst of items does not wait behind one busy worker.
+//
+// Items scheduled to an nv_kthread_q_multi may run on any of its workers, in
+// any order relative to each other. This is not a new restriction: the
+// single-kthread API above already declines to guarantee either serialization
+// or concurrency of items within one queue, so any q_item that is legal in an
+// nv_kthread_q is legal here. Items that require FIFO ordering belong in a
+// plain nv_kthread_q instead.
+//
+// The q_item type, nv_kthread_q_item_init(), and the flush and stop semantics
+// (including the double flush for self-rescheduling items) are the same as
+// for the single-kthread queues above.
+////////////////////////////////////////////////////////////////////////////////
+
+//
+// The multi-queue must not be used before calling this routine.
+//
+// The caller allocates an nv_kthread_q_multi_t item. This routine initializes
+// the queue and starts up num_workers kernel threads to service it. The
+// worker count must be at least one, and is silently clamped to
+// NV_KTHREAD_Q_MAX_WORKERS. Each worker's thread name is the qname arg with
+// a "/<worker index>" suffix.
+//
+// As with nv_kthread_q_init_on_node(), this returns a Linux kernel (negative)
+// errno on failure, and zero on success, the worker kthread stacks are
+// preferably (but not guaranteed to be) allocated on the specified NUMA node,
+// and it is safe to call nv_kthread_q_multi_stop() on a queue that this
+// routine failed for.
+//
+int nv_kthread_q_multi_init_on_node(nv_kthread_q_multi_t *q_multi,
+                                    const char *qname,
+                                    unsigned int num_workers,
+                                    int preferred_node);
+
+//
+// This routine is the same as nv_kthread_q_multi_init_on_node() with the
+// exception that the worker stacks will be allocated on the NUMA node of the
+// caller.
+//
+int nv_kthread_q_multi_init(nv_kthread_q_multi_t *q_multi,
+                            const char *qname,
+                            unsigned int num_workers);
+
+//
+// This is the multi-queue counterpart of nv_kthread_q_stop(): it flushes the
+// queue and safely stops all of the worker kthreads, before returning. The
+// same rules apply: call it exactly once per initialization, do not add items
+// after calling it, and calling it on a zero-initialized or failed-init queue
+// is a no-op.
+//
+void nv_kthread_q_multi_stop(nv_kthread_q_multi_t *q_multi);
+
+//
+// This provides the same guarantee as nv_kthread_q_flush(): all items that
+// were in the queue before nv_kthread_q_multi_flush was called, and all items
+// scheduled by those items, will get run before this function returns, even
+// if they were stolen by (and are running on) another worker. The queue is
+// flushed twice, for the same self-rescheduling-callback reason that is
+// described above for nv_kthread_q_flush().
+//
+// You may NOT call nv_kthread_q_multi_flush() after having called
+// nv_kthread_q_multi_stop.
+//
+void nv_kthread_q_multi_flush(nv_kthread_q_multi_t *q_multi);
+
+//
+// Schedules a q_item onto one of the multi-queue's worker lists. The same
+// q_item rules as for nv_kthread_q_schedule_q_item apply: the caller owns the
+// q_item's lifetime, it may be freed from within its own callback, this
+// routine may be called from any context including top-half ISRs, and an
+// item that is already pending will not be scheduled again.
+//
+// Returns true (non-zero) if the item was actually scheduled, and false if
+// the item was already pending or the queue is shutting down.
+//
+int nv_kthread_q_multi_schedule_q_item(nv_kthread_q_multi_t *q_multi,
+                                       nv_kthread_q_item_t *q_item);
+
 // Built-in test. Returns -1 if any subtest failed, or 0 upon success.
 int nv_kthread_q_run_self_test(void);
 
@@ -160,6 +160,7 @@
 #include <linux/timer.h>
 #include <linux/file.h>             /* fget(), fput()                   */
 #include <linux/rbtree.h>
+#include <linux/interval_tree.h>    /* interval_tree_insert(), etc      */
 #include <linux/cpu.h>              /* CPU hotplug support              */
 
 #include <linux/pm_runtime.h>       /* pm_runtime_*                     */
@@ -620,6 +621,20 @@ static NvBool nv_numa_node_has_memory(int node_id)
         free_pages(ptr, order);                      \
     }
 
+/*
+ * The array-filling bulk page allocator fills any NULL slots in the given
+ * array with order-0 pages and returns the total number of populated slots.
+ * It was added in v5.13 as alloc_pages_bulk_array() and renamed to
+ * alloc_pages_bulk() in v6.13.
+ */
+#if defined(NV_ALLOC_PAGES_BULK_PRESENT)
+#define NV_ALLOC_PAGES_BULK(gfp_mask, count, pages) \
+    alloc_pages_bulk(gfp_mask, count, pages)
+#elif defined(NV_ALLOC_PAGES_BULK_ARRAY_PRESENT)
+#define NV_ALLOC_PAGES_BULK(gfp_mask, count, pages) \
+    alloc_pages_bulk_array(gfp_mask, count, pages)
+#endif
+
 static inline pgprot_t nv_sme_clr(pgprot_t prot)
 {
 #if defined(__sme_clr)
@@ -1406,8 +1421,23 @@ typedef enum
 /* Linux version of the opaque type used for os_queue_work_item() */
 struct os_work_queue {
     nv_kthread_q_t nvk;
+
+    /*
+     * Multi-worker queue for work items that do not rely on FIFO execution
+     * relative to other items on this queue. Each item takes the RM locks
+     * it asked for when it runs, so independent items (display updates,
+     * perf events) can execute concurrently instead of queueing behind
+     * each other on the single nvk thread.
+     */
+    nv_kthread_q_multi_t nvk_multi;
 };
 
+/*
+ * Worker count for the per-GPU multi-worker work queue: enough to overlap
+ * a few independent deferred items without spawning a thread herd per GPU.
+ */
+#define NV_QUEUE_MULTI_NUM_WORKERS 4
+
 /* Linux version of the opaque type used for os_wait_*() */
 struct os_wait_queue {
     struct completion q;
@@ -1545,6 +1575,9 @@ typedef struct nv_linux_state_s {
 
     struct msix_entry *msix_entries;
 
+    /* Per-vector interrupt names, so userspace can target single vectors */
+    char *msix_irq_names;
+
     NvU64 numa_memblock_size;
 
     struct {
@@ -1632,10 +1665,18 @@ extern nv_linux_state_t *nv_linux_devices;
  * 3. UNLOCK_NV_LINUX_DEVICES()
  * 4. Release nvl->ldata_lock after any read/write access to the
  *    nvl element is complete
+ *
+ * Stateless paths that only traverse the list without adding or removing
+ * elements (device lookups, NV_ESC_CARD_INFO, GPU enumeration) may take the
+ * lock in shared mode with LOCK_NV_LINUX_DEVICES_READ() so unrelated clients
+ * do not serialize on each other; list mutation (probe/remove) and any path
+ * relying on exclusivity must use the write-mode macros above.
  */
-extern struct semaphore nv_linux_devices_lock;
-#define LOCK_NV_LINUX_DEVICES()     down(&nv_linux_devices_lock)
-#define UNLOCK_NV_LINUX_DEVICES()   up(&nv_linux_devices_lock)
+extern struct rw_semaphore nv_linux_devices_lock;
+#define LOCK_NV_LINUX_DEVICES()          down_write(&nv_linux_devices_lock)
+#define UNLOCK_NV_LINUX_DEVICES()        up_write(&nv_linux_devices_lock)
+#define LOCK_NV_LINUX_DEVICES_READ()     down_read(&nv_linux_devices_lock)
+#define UNLOCK_NV_LINUX_DEVICES_READ()   up_read(&nv_linux_devices_lock)
 
 /*
  * Lock to synchronize system power management transitions,
@@ -1661,6 +1702,20 @@ typedef struct nvidia_event
     nv_event_t event;
 } nvidia_event_t;
 
+/*
+ * An additional RM-validated mapping allowance registered on a file
+ * descriptor whose single mmap_context slot is already occupied. Entries
+ * are indexed in an interval tree keyed by
+ * [mmap_start, mmap_start + mmap_size - 1] so that mmap-time lookup is
+ * O(log n) in the number of outstanding allowances, and are identified
+ * by userspace through the mmap file offset.
+ */
+typedef struct nv_mmap_context_entry
+{
+    struct interval_tree_node node;
+    nv_alloc_mapping_context_t context;
+} nv_mmap_context_entry_t;
+
 typedef struct
 {
     nv_file_private_t nvfp;
@@ -1676,6 +1731,8 @@ typedef struct
     NvU32 *attached_gpus;
     size_t num_attached_gpus;
     nv_alloc_mapping_context_t mmap_context;
+    struct rb_root_cached mmap_context_tree;
+    nv_spinlock_t mmap_context_lock;
     struct address_space mapping;
 
     nv_kthread_q_item_t open_q_item;
@@ -1789,6 +1846,7 @@ extern NvU32 NVreg_EnableUserNUMAManagement;
 extern NvU32 NVreg_RegisterPCIDriver;
 extern NvU32 NVreg_EnableResizableBar;
 extern NvU32 NVreg_EnableNonblockingOpen;
+extern NvU32 NVreg_EnableAsyncPciProbe;
 
 extern NvU32 num_probed_nv_devices;
 extern NvU32 num_nv_devices;
@@ -29,6 +29,8 @@
 void nv_memdbg_init(void);
 void nv_memdbg_add(void *addr, NvU64 size, const char *file, int line);
 void nv_memdbg_remove(void *addr, NvU64 size, const char *file, int line);
+void nv_memdbg_count_alloc(NvU64 size, const char *file, int line);
+void nv_memdbg_count_free(NvU64 size);
 void nv_memdbg_exit(void);
 
 #if defined(NV_MEM_LOGGER)
@@ -41,8 +43,16 @@ void nv_memdbg_exit(void);
 
 #else
 
-#define NV_MEMDBG_ADD(ptr, size)
-#define NV_MEMDBG_REMOVE(ptr, size)
+/*
+ * Without NV_MEM_LOGGER, keep only the per-allocation-site counters: a few
+ * atomic operations per allocation, with no locks and no per-allocation
+ * bookkeeping, cheap enough to stay enabled in production builds.
+ */
+#define NV_MEMDBG_ADD(ptr, size) \
+    nv_memdbg_count_alloc(size, __FILE__, __LINE__)
+
+#define NV_MEMDBG_REMOVE(ptr, size) \
+    nv_memdbg_count_free(size)
 
 #endif /* NV_MEM_LOGGER */
 
@@ -51,14 +51,24 @@ NvS32   NV_API_CALL nv_request_msix_irq (nv_linux_state_t *);
 #define NV_PCI_MSIX_FLAGS         2
 #define NV_PCI_MSIX_FLAGS_QSIZE   0x7FF
 
+#define NV_MSIX_IRQ_NAME_SIZE     32
+
 static inline void nv_free_msix_irq(nv_linux_state_t *nvl)
 {
     int i;
 
     for (i = 0; i < nvl->num_intr; i++)
     {
+        irq_set_affinity_hint(nvl->msix_entries[i].vector, NULL);
         free_irq(nvl->msix_entries[i].vector, (void *)nvl);
     }
+
+    if (nvl->msix_irq_names != NULL)
+    {
+        NV_KFREE(nvl->msix_irq_names,
+                 NV_MSIX_IRQ_NAME_SIZE * nvl->num_intr);
+        nvl->msix_irq_names = NULL;
+    }
 }
 
 static inline int nv_get_max_irq(struct pci_dev *pci_dev)
@@ -50,6 +50,7 @@ typedef struct proc_ops nv_proc_ops_t;
 #define NV_PROC_OPS_READ    proc_read
 #define NV_PROC_OPS_WRITE   proc_write
 #define NV_PROC_OPS_LSEEK   proc_lseek
+#define NV_PROC_OPS_MMAP    proc_mmap
 #define NV_PROC_OPS_RELEASE proc_release
 #else
 typedef struct file_operations nv_proc_ops_t;
@@ -60,6 +61,7 @@ typedef struct file_operations nv_proc_ops_t;
 #define NV_PROC_OPS_READ    read
 #define NV_PROC_OPS_WRITE   write
 #define NV_PROC_OPS_LSEEK   llseek
+#define NV_PROC_OPS_MMAP    mmap
 #define NV_PROC_OPS_RELEASE release
 #endif
 
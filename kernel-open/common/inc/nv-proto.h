@@ -44,9 +44,20 @@ int         nvidia_mmap_helper          (nv_state_t *, nv_linux_file_private_t *
 int         nv_encode_caching           (pgprot_t *, NvU32, NvU32);
 void        nv_revoke_gpu_mappings_locked(nv_state_t *);
 
+const nv_alloc_mapping_context_t *nv_mmap_context_lookup(nv_linux_file_private_t *, NvU64);
+void        nv_mmap_context_tree_purge  (nv_linux_file_private_t *);
+
 NvUPtr      nv_vm_map_pages             (struct page **, NvU32, NvBool, NvBool);
 void        nv_vm_unmap_pages           (NvUPtr, NvU32);
 
+void        nv_vm_page_array_cache_init (void);
+void        nv_vm_page_array_cache_purge(void);
+struct page **nv_vm_get_page_array      (NvU32);
+void        nv_vm_put_page_array        (struct page **, NvU32);
+
+void        nv_dma_map_cache_init       (void);
+void        nv_dma_map_cache_purge      (void);
+
 NV_STATUS   nv_alloc_contig_pages       (nv_state_t *, nv_alloc_t *);
 void        nv_free_contig_pages        (nv_alloc_t *);
 NV_STATUS   nv_alloc_system_pages       (nv_state_t *, nv_alloc_t *);
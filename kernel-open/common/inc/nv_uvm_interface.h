@@ -1787,4 +1787,171 @@ NV_STATUS nvUvmInterfaceCslLogEncryption(UvmCslContext *uvmCslContext,
                                          UvmCslOperation operation,
                                          NvU32 bufferSize);
 
+/*******************************************************************************
+    Batched interface operations
+
+    UVM startup and teardown issue long sequences of the interface calls above,
+    each of which allocates and frees its own RM call stack. The batched
+    interface below lets the caller describe a sequence of operations in an
+    array and have them executed back to back on one stack, either
+    synchronously or asynchronously on a worker thread for operations whose
+    results the caller does not need inline.
+
+    The descriptor union mirrors the parameters of the corresponding
+    synchronous call; see that call's documentation for the meaning of each
+    field and the possible error codes. Operations are executed in array
+    order, and execution stops at the first operation that fails.
+*/
+
+typedef enum
+{
+    UvmGpuInterfaceOpTypeGetPmaObject = 1,
+    UvmGpuInterfaceOpTypeChannelAllocate,
+    UvmGpuInterfaceOpTypeGetExternalAllocPtes,
+    UvmGpuInterfaceOpTypeAddressSpaceCreate,
+    UvmGpuInterfaceOpTypeDupAddressSpace,
+} UvmGpuInterfaceOpType;
+
+typedef struct UvmGpuInterfaceOp_tag
+{
+    UvmGpuInterfaceOpType type;
+
+    // Result of this operation. Only valid for operations that were executed,
+    // i.e. those before and including the first failing operation.
+    NV_STATUS status;
+
+    union
+    {
+        // Mirrors nvUvmInterfaceGetPmaObject()
+        struct
+        {
+            uvmGpuDeviceHandle device;
+            void **pPma;
+            const UvmPmaStatistics **pPmaPubStats;
+        } getPmaObject;
+
+        // Mirrors nvUvmInterfaceChannelAllocate()
+        struct
+        {
+            uvmGpuTsgHandle tsg;
+            const UvmGpuChannelAllocParams *allocParams;
+            uvmGpuChannelHandle *channel;
+            UvmGpuChannelInfo *channelInfo;
+        } channelAllocate;
+
+        // Mirrors nvUvmInterfaceGetExternalAllocPtes()
+        struct
+        {
+            uvmGpuAddressSpaceHandle vaSpace;
+            NvHandle hMemory;
+            NvU64 offset;
+            NvU64 size;
+            UvmGpuExternalMappingInfo *gpuExternalMappingInfo;
+        } getExternalAllocPtes;
+
+        // Mirrors nvUvmInterfaceAddressSpaceCreate()
+        struct
+        {
+            uvmGpuDeviceHandle device;
+            unsigned long long vaBase;
+            unsigned long long vaSize;
+            NvBool enableAts;
+            uvmGpuAddressSpaceHandle *vaSpace;
+            UvmGpuAddressSpaceInfo *vaSpaceInfo;
+        } addressSpaceCreate;
+
+        // Mirrors nvUvmInterfaceDupAddressSpace()
+        struct
+        {
+            uvmGpuDeviceHandle device;
+            NvHandle hUserClient;
+            NvHandle hUserVASpace;
+            uvmGpuAddressSpaceHandle *vaSpace;
+            UvmGpuAddressSpaceInfo *vaSpaceInfo;
+        } dupAddressSpace;
+    } params;
+} UvmGpuInterfaceOp;
+
+/*******************************************************************************
+    nvUvmInterfaceOpsExecute
+
+    Executes an array of interface operations in order, on a single RM call
+    stack. Execution stops at the first operation that fails; the remaining
+    operations are not executed and their status fields are not written.
+
+    Arguments:
+        ops[IN/OUT]          - Array of operation descriptors. The status
+                               field of each executed operation is written.
+        opCount[IN]          - Number of entries in ops.
+        completedCount[OUT]  - Optional (may be NULL). Number of operations
+                               that completed successfully.
+
+    Error codes:
+        NV_ERR_INVALID_ARGUMENT - ops is NULL, opCount is zero, or an
+                                  operation has an unknown type.
+        NV_ERR_NO_MEMORY        - Internal memory allocation failed.
+        Otherwise, the status of the first failing operation.
+*/
+NV_STATUS nvUvmInterfaceOpsExecute(UvmGpuInterfaceOp *ops,
+                                   NvU32 opCount,
+                                   NvU32 *completedCount);
+
+// Invoked when an asynchronously executed operation batch has finished,
+// in the context of a worker thread.
+typedef void (*uvmGpuInterfaceOpsCallback)(void *callbackData);
+
+typedef struct UvmGpuInterfaceOpsAsync_tag
+{
+    // The fields below are written by nvUvmInterfaceOpsExecuteAsync() and,
+    // once the callback has been invoked, hold the same results that a
+    // synchronous nvUvmInterfaceOpsExecute() call would have returned.
+    UvmGpuInterfaceOp *ops;
+    NvU32 opCount;
+    NvU32 completedCount;
+    NV_STATUS status;
+
+    uvmGpuInterfaceOpsCallback callback;
+    void *callbackData;
+
+    // For internal use by the implementation.
+    nv_kthread_q_item_t qItem;
+} UvmGpuInterfaceOpsAsync;
+
+/*******************************************************************************
+    nvUvmInterfaceOpsExecuteAsync
+
+    Schedules an array of interface operations for execution on a worker
+    thread, and returns without waiting. The execution itself behaves like
+    nvUvmInterfaceOpsExecute(). When the batch has finished, callback is
+    invoked with callbackData, in the worker thread's context; the callback
+    may inspect asyncOps for the results.
+
+    The caller owns the lifetime of both asyncOps and ops, and must keep them
+    alive until the callback has been invoked. It is OK to free either from
+    within the callback. Batches scheduled by separate calls may execute
+    concurrently with their callers but not with each other; they run, and
+    their callbacks are invoked, in scheduling order.
+
+    This function may not be called after the RM module has begun unloading,
+    and all callbacks must have been received before the caller unregisters
+    from RM.
+
+    Arguments:
+        asyncOps[IN/OUT]  - Async batch descriptor to fill in and schedule.
+        ops[IN/OUT]       - Array of operation descriptors; see
+                            nvUvmInterfaceOpsExecute().
+        opCount[IN]       - Number of entries in ops.
+        callback[IN]      - Completion callback, must not be NULL.
+        callbackData[IN]  - Opaque argument passed to the callback.
+
+    Error codes:
+        NV_ERR_INVALID_ARGUMENT - ops or callback is NULL, or opCount is zero.
+        NV_ERR_INVALID_STATE    - The worker thread is shutting down.
+*/
+NV_STATUS nvUvmInterfaceOpsExecuteAsync(UvmGpuInterfaceOpsAsync *asyncOps,
+                                        UvmGpuInterfaceOp *ops,
+                                        NvU32 opCount,
+                                        uvmGpuInterfaceOpsCallback callback,
+                                        void *callbackData);
+
 #endif // _NV_UVM_INTERFACE_H_
@@ -1903,6 +1903,90 @@ compile_test() {
             compile_check_conftest "$CODE" "NV_VMF_INSERT_PFN_PROT_PRESENT" "" "functions"
         ;;
 
+        vmf_insert_pfn_pmd)
+            #
+            # Determine if vmf_insert_pfn_pmd() is present with the
+            # (struct vm_fault *, pfn_t, bool) signature.
+            #
+            # vmf_insert_pfn_pmd() was reworked to take a struct vm_fault
+            # pointer by commit fce86ff5802b ("mm/huge_memory: fix
+            # vmf_insert_pfn_{pmd, pud}() crash, handle unaligned addresses")
+            # in v5.2. The function is only declared when the kernel supports
+            # transparent huge pages.
+            #
+            CODE="
+            #include <linux/mm.h>
+            #include <linux/huge_mm.h>
+            #include <linux/pfn_t.h>
+            vm_fault_t conftest_vmf_insert_pfn_pmd(struct vm_fault *vmf,
+                                                   pfn_t pfn, bool write) {
+                return vmf_insert_pfn_pmd(vmf, pfn, write);
+            }"
+
+            compile_check_conftest "$CODE" "NV_VMF_INSERT_PFN_PMD_PRESENT" "" "types"
+        ;;
+
+        vmf_insert_pfn_pud)
+            #
+            # Determine if vmf_insert_pfn_pud() is present with the
+            # (struct vm_fault *, pfn_t, bool) signature.
+            #
+            # Like vmf_insert_pfn_pmd(), the current signature was set by
+            # commit fce86ff5802b ("mm/huge_memory: fix
+            # vmf_insert_pfn_{pmd, pud}() crash, handle unaligned addresses")
+            # in v5.2. The function is only declared when the architecture
+            # supports PUD-level transparent huge pages.
+            #
+            CODE="
+            #include <linux/mm.h>
+            #include <linux/huge_mm.h>
+            #include <linux/pfn_t.h>
+            vm_fault_t conftest_vmf_insert_pfn_pud(struct vm_fault *vmf,
+                                                   pfn_t pfn, bool write) {
+                return vmf_insert_pfn_pud(vmf, pfn, write);
+            }"
+
+            compile_check_conftest "$CODE" "NV_VMF_INSERT_PFN_PUD_PRESENT" "" "types"
+        ;;
+
+        vm_ops_huge_fault_removed_pe_size_arg)
+            #
+            # Determine if the 'struct vm_operations_struct' huge_fault()
+            # callback takes an unsigned int page order argument rather than
+            # an 'enum page_entry_size'.
+            #
+            # The enum page_entry_size argument was replaced with an
+            # unsigned int page order by commit 1d024e7a8dab ("mm: remove
+            # enum page_entry_size") in v6.8.
+            #
+            CODE="
+            #include <linux/mm.h>
+            vm_fault_t conftest_huge_fault(struct vm_fault *vmf,
+                                           unsigned int order);
+            struct vm_operations_struct conftest_ops = {
+                .huge_fault = conftest_huge_fault,
+            };"
+
+            compile_check_conftest "$CODE" "NV_VM_OPS_HUGE_FAULT_REMOVED_PE_SIZE_ARG" "" "types"
+        ;;
+
+        thp_get_unmapped_area)
+            #
+            # Determine if the function thp_get_unmapped_area() is
+            # present.
+            #
+            # Added by commit 74d2fad1334d ("thp, dax: add thp_get_unmapped_area
+            # for pmd mappings") in v4.8.
+            #
+            CODE="
+            #include <linux/huge_mm.h>
+            void conftest_thp_get_unmapped_area(void) {
+                thp_get_unmapped_area();
+            }"
+
+            compile_check_conftest "$CODE" "NV_THP_GET_UNMAPPED_AREA_PRESENT" "" "functions"
+        ;;
+
         drm_atomic_available)
             #
             # Determine if the DRM atomic modesetting subsystem is usable
@@ -3244,6 +3328,23 @@ compile_test() {
             compile_check_conftest "$CODE" "NV_PCI_DRIVER_HAS_DRIVER_MANAGED_DMA" "" "types"
         ;;
 
+        device_driver_probe_type)
+            #
+            # Determine if "struct device_driver" has a .probe_type member.
+            #
+            # Added by commit 765230b5f084 ("driver-core: add asynchronous
+            # probing support for drivers") in v4.2
+            #
+            CODE="
+            #include <linux/device.h>
+            void conftest_device_driver_probe_type(void) {
+                struct device_driver drv;
+                drv.probe_type = PROBE_PREFER_ASYNCHRONOUS;
+            }"
+
+            compile_check_conftest "$CODE" "NV_DEVICE_DRIVER_HAS_PROBE_TYPE" "" "types"
+        ;;
+
         radix_tree_empty)
             #
             # Determine if the function radix_tree_empty() is present.
@@ -4099,6 +4200,28 @@ compile_test() {
             fi
         ;;
 
+        dma_buf_ops_attach_has_device_arg)
+            #
+            # Determine if dma_buf_ops.attach takes (buf, dev, attachment),
+            # or just (buf, attachment) args.
+            #
+            # The device arg was removed by commit a19741e5e5a9 ("dma_buf:
+            # remove device parameter from attach callback v2") in v4.19
+            # (2018-05-28)
+            #
+            CODE="
+            #include <linux/dma-buf.h>
+            void conftest_dma_buf_ops_attach_has_device_arg(void) {
+                struct dma_buf_ops ops;
+                struct dma_buf *buf;
+                struct device *dev;
+                struct dma_buf_attachment *attachment;
+                (void)ops.attach(buf, dev, attachment);
+            }"
+
+            compile_check_conftest "$CODE" "NV_DMA_BUF_OPS_ATTACH_HAS_DEVICE_ARG" "" "types"
+        ;;
+
         drm_connector_funcs_have_mode_in_name)
             #
             # Determine if _mode_ is present in connector function names.  We
@@ -6184,6 +6307,42 @@ compile_test() {
             compile_check_conftest "$CODE" "NV_GET_TASK_IOPRIO_PRESENT" "" "functions"
         ;;
 
+        alloc_pages_bulk_array)
+            #
+            # Determine if the alloc_pages_bulk_array() function is present.
+            #
+            # Added by commit 0f87d9d30f21 ("mm/page_alloc: add an array-based
+            # interface to the bulk page allocator") in v5.13. Renamed to
+            # alloc_pages_bulk() by commit c8b979530f27 ("mm: alloc_pages_bulk:
+            # rename API") in v6.13.
+            #
+            CODE="
+            #include <linux/gfp.h>
+            unsigned long conftest_alloc_pages_bulk_array(void) {
+                return alloc_pages_bulk_array(GFP_KERNEL, 0, NULL);
+            }"
+
+            compile_check_conftest "$CODE" "NV_ALLOC_PAGES_BULK_ARRAY_PRESENT" "" "functions"
+        ;;
+
+        alloc_pages_bulk)
+            #
+            # Determine if the array-filling alloc_pages_bulk() function is
+            # present.
+            #
+            # alloc_pages_bulk_array() was renamed to alloc_pages_bulk() by
+            # commit c8b979530f27 ("mm: alloc_pages_bulk: rename API") in
+            # v6.13, when the list-based variant was removed.
+            #
+            CODE="
+            #include <linux/gfp.h>
+            unsigned long conftest_alloc_pages_bulk(void) {
+                return alloc_pages_bulk(GFP_KERNEL, 0, NULL);
+            }"
+
+            compile_check_conftest "$CODE" "NV_ALLOC_PAGES_BULK_PRESENT" "" "functions"
+        ;;
+
         num_registered_fb)
             #
             # Determine if 'num_registered_fb' variable is present.
@@ -434,6 +434,8 @@ static int nv_drm_load(struct drm_device *dev, unsigned long flags)
 
     struct NvKmsKapiAllocateDeviceParams allocateDeviceParams;
     struct NvKmsKapiDeviceResourcesInfo resInfo;
+    char commit_worker_name[18+8+1]; /* strlen(nvidia-drm/commit-) + 8 for %08x
+                                      * + NUL */
 #endif
 #if defined(NV_DRM_FORMAT_MODIFIERS_PRESENT)
     NvU64 kind;
@@ -567,6 +569,24 @@ static int nv_drm_load(struct drm_device *dev, unsigned long flags)
 
     init_waitqueue_head(&nv_dev->flip_event_wq);
 
+    /* Initialize the cache of recently destroyed framebuffer surfaces */
+
+    spin_lock_init(&nv_dev->surface_cache_lock);
+    INIT_LIST_HEAD(&nv_dev->surface_cache);
+    nv_dev->surface_cache_count = 0;
+
+    /* Create the worker thread used to defer non-blocking atomic commits */
+
+    atomic_set(&nv_dev->pending_commit_tasks, 0);
+
+    sprintf(commit_worker_name, "nvidia-drm/commit-%08x",
+            nv_dev->gpu_info.gpu_id);
+    if (!nv_drm_workthread_init(&nv_dev->commit_worker, commit_worker_name)) {
+        NV_DRM_DEV_LOG_ERR(nv_dev, "Failed to create atomic commit worker");
+        mutex_unlock(&nv_dev->lock);
+        return -ENODEV;
+    }
+
     mutex_unlock(&nv_dev->lock);
 
 #endif /* NV_DRM_ATOMIC_MODESET_AVAILABLE */
@@ -591,6 +611,13 @@ static void __nv_drm_unload(struct drm_device *dev)
     }
 
     cancel_delayed_work_sync(&nv_dev->hotplug_event_work);
+
+    /*
+     * Flush and stop the commit worker before tearing down the NVKMS device;
+     * any deferred commit still queued is pushed to NVKMS during shutdown.
+     */
+    nv_drm_workthread_shutdown(&nv_dev->commit_worker);
+
     mutex_lock(&nv_dev->lock);
 
     WARN_ON(nv_dev->subOwnershipGranted);
@@ -607,6 +634,12 @@ static void __nv_drm_unload(struct drm_device *dev)
 
     drm_mode_config_cleanup(dev);
 
+    /*
+     * Surfaces parked by the framebuffers destroyed above must be released
+     * before the NVKMS device goes away.
+     */
+    nv_drm_framebuffer_surface_cache_purge(nv_dev);
+
     if (!nvKms->declareEventInterest(nv_dev->pDevice, 0x0)) {
         NV_DRM_DEV_LOG_ERR(nv_dev, "Failed to stop event listening");
     }
@@ -1735,6 +1768,10 @@ void nv_drm_register_drm_device(const nv_gpu_info_t *gpu_info)
     mutex_init(&nv_dev->lock);
 #endif
 
+    nv_drm_pin_cache_init(nv_dev);
+
+    nv_drm_gem_dma_buf_import_cache_init(nv_dev);
+
     /* Allocate DRM device */
 
     dev = drm_dev_alloc(&nv_drm_driver, device);
@@ -1806,6 +1843,8 @@ failed_grab_ownership:
 
 failed_drm_register:
 
+    nv_drm_pin_cache_purge(nv_dev);
+
     nv_drm_dev_free(dev);
 
 failed_drm_alloc:
@@ -1877,6 +1916,13 @@ void nv_drm_remove_devices(void)
         }
 #endif
         drm_dev_unregister(dev);
+
+        /*
+         * All GEM objects are gone once the device is unregistered; release
+         * any pinned user page arrays still parked in the pin cache.
+         */
+        nv_drm_pin_cache_purge(dev_list);
+
         nv_drm_dev_free(dev);
 
         nv_drm_free(dev_list);
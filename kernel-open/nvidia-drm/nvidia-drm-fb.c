@@ -34,6 +34,152 @@
 
 #include <drm/drm_crtc_helper.h>
 
+#define NV_DRM_SURFACE_CACHE_MAX_ENTRIES 8
+
+/*
+ * Compositors commonly cycle through a handful of identical framebuffer
+ * configurations, re-creating framebuffers over the same memory every frame.
+ * Rather than unregistering the NVKMS surface as soon as a framebuffer is
+ * destroyed, park it in a small per-device LRU keyed by the full surface
+ * creation parameters (memory objects, offsets, pitches, size, format and
+ * layout), and revive it when a framebuffer with identical parameters is
+ * created again, skipping the NVKMS surface registration round trip.
+ *
+ * A parked entry keeps references to the framebuffer's GEM objects; this
+ * pins the memory, but also guarantees the NvKmsKapiMemory pointers in the
+ * cached parameters stay valid, so pointer equality in the memcmp() below
+ * cannot produce a false match against re-allocated memory.
+ */
+struct nv_drm_surface_cache_entry {
+    struct list_head entry;
+
+    struct NvKmsKapiCreateSurfaceParams params;
+    struct NvKmsKapiSurface *pSurface;
+
+    struct nv_drm_gem_object *nv_gem[NVKMS_MAX_PLANES_PER_SURFACE];
+};
+
+static void __nv_drm_surface_cache_entry_free(
+    struct nv_drm_device *nv_dev,
+    struct nv_drm_surface_cache_entry *entry)
+{
+    uint32_t i;
+
+    nvKms->destroySurface(nv_dev->pDevice, entry->pSurface);
+
+    for (i = 0; i < ARRAY_SIZE(entry->nv_gem); i++) {
+        if (entry->nv_gem[i] != NULL) {
+            nv_drm_gem_object_unreference_unlocked(entry->nv_gem[i]);
+        }
+    }
+
+    nv_drm_free(entry);
+}
+
+/*
+ * Look up a parked surface created with parameters identical to 'params'.
+ * On a hit, the cache's GEM references are dropped and the surface is
+ * returned with the caller's framebuffer expected to hold its own
+ * references.
+ */
+static struct NvKmsKapiSurface *__nv_drm_surface_cache_acquire(
+    struct nv_drm_device *nv_dev,
+    const struct NvKmsKapiCreateSurfaceParams *params)
+{
+    struct nv_drm_surface_cache_entry *entry, *found = NULL;
+    struct NvKmsKapiSurface *pSurface;
+    uint32_t i;
+
+    spin_lock(&nv_dev->surface_cache_lock);
+    list_for_each_entry(entry, &nv_dev->surface_cache, entry) {
+        if (memcmp(&entry->params, params, sizeof(*params)) == 0) {
+            found = entry;
+            list_del(&found->entry);
+            nv_dev->surface_cache_count--;
+            break;
+        }
+    }
+    spin_unlock(&nv_dev->surface_cache_lock);
+
+    if (found == NULL) {
+        return NULL;
+    }
+
+    pSurface = found->pSurface;
+
+    for (i = 0; i < ARRAY_SIZE(found->nv_gem); i++) {
+        if (found->nv_gem[i] != NULL) {
+            nv_drm_gem_object_unreference_unlocked(found->nv_gem[i]);
+        }
+    }
+
+    nv_drm_free(found);
+
+    return pSurface;
+}
+
+/*
+ * Park a destroyed framebuffer's surface in the cache, taking over the
+ * framebuffer's GEM references. Returns false if no entry could be
+ * allocated, in which case the caller must destroy the surface and drop the
+ * references itself.
+ */
+static bool __nv_drm_surface_cache_park(struct nv_drm_device *nv_dev,
+                                        struct nv_drm_framebuffer *nv_fb)
+{
+    struct nv_drm_surface_cache_entry *entry = nv_drm_calloc(1, sizeof(*entry));
+    struct nv_drm_surface_cache_entry *evicted = NULL;
+    uint32_t i;
+
+    if (entry == NULL) {
+        return false;
+    }
+
+    entry->params = nv_fb->surface_params;
+    entry->pSurface = nv_fb->pSurface;
+
+    for (i = 0; i < ARRAY_SIZE(entry->nv_gem); i++) {
+        entry->nv_gem[i] = nv_fb->nv_gem[i];
+    }
+
+    spin_lock(&nv_dev->surface_cache_lock);
+    list_add(&entry->entry, &nv_dev->surface_cache);
+    if (++nv_dev->surface_cache_count > NV_DRM_SURFACE_CACHE_MAX_ENTRIES) {
+        evicted = list_last_entry(&nv_dev->surface_cache,
+                                  struct nv_drm_surface_cache_entry, entry);
+        list_del(&evicted->entry);
+        nv_dev->surface_cache_count--;
+    }
+    spin_unlock(&nv_dev->surface_cache_lock);
+
+    if (evicted != NULL) {
+        __nv_drm_surface_cache_entry_free(nv_dev, evicted);
+    }
+
+    return true;
+}
+
+void nv_drm_framebuffer_surface_cache_purge(struct nv_drm_device *nv_dev)
+{
+    struct list_head purge_list;
+
+    INIT_LIST_HEAD(&purge_list);
+
+    spin_lock(&nv_dev->surface_cache_lock);
+    list_splice_init(&nv_dev->surface_cache, &purge_list);
+    nv_dev->surface_cache_count = 0;
+    spin_unlock(&nv_dev->surface_cache_lock);
+
+    while (!list_empty(&purge_list)) {
+        struct nv_drm_surface_cache_entry *entry =
+            list_first_entry(&purge_list,
+                             struct nv_drm_surface_cache_entry, entry);
+
+        list_del(&entry->entry);
+        __nv_drm_surface_cache_entry_free(nv_dev, entry);
+    }
+}
+
 static void __nv_drm_framebuffer_free(struct nv_drm_framebuffer *nv_fb)
 {
     uint32_t i;
@@ -58,6 +204,17 @@ static void nv_drm_framebuffer_destroy(struct drm_framebuffer *fb)
 
     drm_framebuffer_cleanup(fb);
 
+    /*
+     * Park the NvKmsKapiSurface in the surface cache for reuse by an
+     * identical framebuffer; on success the cache takes over the gem
+     * references, so only the framebuffer object itself is freed here.
+     */
+
+    if (__nv_drm_surface_cache_park(nv_dev, nv_fb)) {
+        nv_drm_free(nv_fb);
+        return;
+    }
+
     /* Free NvKmsKapiSurface associated with this framebuffer object */
 
     nvKms->destroySurface(nv_dev->pDevice, nv_fb->pSurface);
@@ -150,14 +307,6 @@ static int nv_drm_framebuffer_init(struct drm_device *dev,
 
     for (i = 0; i < ARRAY_SIZE(nv_fb->nv_gem); i++) {
         if (nv_fb->nv_gem[i] != NULL) {
-            if (!nvKms->isMemoryValidForDisplay(nv_dev->pDevice,
-                                                nv_fb->nv_gem[i]->pMemory)) {
-                NV_DRM_DEV_LOG_INFO(
-                        nv_dev,
-                        "Framebuffer memory not appropriate for scanout");
-                goto fail;
-            }
-
             params.planes[i].memory = nv_fb->nv_gem[i]->pMemory;
             params.planes[i].offset = nv_fb->base.offsets[i];
             params.planes[i].pitch = nv_fb->base.pitches[i];
@@ -188,14 +337,38 @@ static int nv_drm_framebuffer_init(struct drm_device *dev,
         params.explicit_layout = false;
     }
 
-    /* Create NvKmsKapiSurface */
+    /*
+     * Reuse a cached NvKmsKapiSurface if an identical framebuffer was
+     * recently destroyed; the memory validation and surface registration
+     * below were already performed when the cached surface was created.
+     */
+
+    nv_fb->pSurface = __nv_drm_surface_cache_acquire(nv_dev, &params);
 
-    nv_fb->pSurface = nvKms->createSurface(nv_dev->pDevice, &params);
     if (nv_fb->pSurface == NULL) {
-        NV_DRM_DEV_DEBUG_DRIVER(nv_dev, "Failed to create NvKmsKapiSurface");
-        goto fail;
+        for (i = 0; i < ARRAY_SIZE(nv_fb->nv_gem); i++) {
+            if (nv_fb->nv_gem[i] != NULL &&
+                !nvKms->isMemoryValidForDisplay(nv_dev->pDevice,
+                                                nv_fb->nv_gem[i]->pMemory)) {
+                NV_DRM_DEV_LOG_INFO(
+                        nv_dev,
+                        "Framebuffer memory not appropriate for scanout");
+                goto fail;
+            }
+        }
+
+        /* Create NvKmsKapiSurface */
+
+        nv_fb->pSurface = nvKms->createSurface(nv_dev->pDevice, &params);
+        if (nv_fb->pSurface == NULL) {
+            NV_DRM_DEV_DEBUG_DRIVER(nv_dev,
+                                    "Failed to create NvKmsKapiSurface");
+            goto fail;
+        }
     }
 
+    nv_fb->surface_params = params;
+
     return 0;
 
 fail:
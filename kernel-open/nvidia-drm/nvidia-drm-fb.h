@@ -41,6 +41,13 @@
 struct nv_drm_framebuffer {
     struct NvKmsKapiSurface *pSurface;
 
+    /*
+     * Parameters the NVKMS surface was created with, kept so the surface can
+     * be parked in the device's surface cache when this framebuffer is
+     * destroyed.
+     */
+    struct NvKmsKapiCreateSurfaceParams surface_params;
+
     struct nv_drm_gem_object*
         nv_gem[NVKMS_MAX_PLANES_PER_SURFACE];
 
@@ -61,6 +68,10 @@ struct drm_framebuffer *nv_drm_internal_framebuffer_create(
     struct drm_file *file,
     struct drm_mode_fb_cmd2 *cmd);
 
+struct nv_drm_device;
+
+void nv_drm_framebuffer_surface_cache_purge(struct nv_drm_device *nv_dev);
+
 #endif /* NV_DRM_ATOMIC_MODESET_AVAILABLE */
 
 #endif /* __NVIDIA_DRM_FB_H__ */
@@ -38,6 +38,8 @@
 
 #include "nvidia-dma-fence-helper.h"
 
+#include <linux/rbtree.h>
+
 #define NV_DRM_SEMAPHORE_SURFACE_FENCE_MAX_TIMEOUT_MS 5000
 
 struct nv_drm_fence_context;
@@ -596,8 +598,14 @@ struct nv_drm_semsurf_fence {
     spinlock_t lock;
 
     /*
-     * When unsignaled, node in the associated fence context's pending fence
-     * list. The list holds a reference to the fence
+     * When unsignaled, node in the associated fence context's timeline-ordered
+     * tree of pending fences. The tree holds a reference to the fence.
+     */
+    struct rb_node pending_rb;
+
+    /*
+     * Used to batch this fence onto a local completion list once it has been
+     * removed from the pending fence tree.
      */
     struct list_head pending_node;
 
@@ -655,8 +663,14 @@ struct nv_drm_semsurf_fence_ctx {
     /* Protects access to everything below */
     spinlock_t lock;
 
-    /* List of pending fences which are not yet signaled */
-    struct list_head pending_fences;
+    /*
+     * Timeline-ordered tree of pending fences which are not yet signaled,
+     * with the lowest wait value cached as the leftmost node. Keeping the
+     * fences sorted by wait value makes insertion O(log n) regardless of the
+     * order fences are created in, and allows batch completion of all fences
+     * up to the current semaphore value under a single lock acquisition.
+     */
+    struct rb_root_cached pending_fences;
 
     /* List of pending fence wait operations */
     struct list_head pending_waits;
@@ -741,19 +755,19 @@ __nv_drm_semsurf_force_complete_pending(struct nv_drm_semsurf_fence_ctx *ctx)
 {
     unsigned long flags;
 
+    struct rb_node *node;
+
     /*
-     * No locks are needed for the pending_fences list. This code runs after all
-     * other possible references to the fence context have been removed. The
-     * fences have their own individual locks to protect themselves.
+     * No locks are needed for the pending_fences tree. This code runs after
+     * all other possible references to the fence context have been removed.
+     * The fences have their own individual locks to protect themselves.
      */
-    while (!list_empty(&ctx->pending_fences)) {
-        struct nv_drm_semsurf_fence *nv_fence = list_first_entry(
-            &ctx->pending_fences,
-            typeof(*nv_fence),
-            pending_node);
+    while ((node = rb_first_cached(&ctx->pending_fences)) != NULL) {
+        struct nv_drm_semsurf_fence *nv_fence =
+            rb_entry(node, typeof(*nv_fence), pending_rb);
         nv_dma_fence_t *fence = &nv_fence->base;
 
-        list_del(&nv_fence->pending_node);
+        rb_erase_cached(node, &ctx->pending_fences);
 
         nv_dma_fence_set_error(fence, -ETIMEDOUT);
         nv_dma_fence_signal(fence);
@@ -816,6 +830,7 @@ __nv_drm_semsurf_ctx_process_completed(struct nv_drm_semsurf_fence_ctx *ctx,
     struct list_head finished;
     struct list_head timed_out;
     struct nv_drm_semsurf_fence *nv_fence;
+    struct rb_node *node;
     nv_dma_fence_t *fence;
     NvU64 currentSeqno = __nv_drm_get_semsurf_ctx_seqno(ctx);
     NvU64 fenceSeqno = 0;
@@ -828,18 +843,18 @@ __nv_drm_semsurf_ctx_process_completed(struct nv_drm_semsurf_fence_ctx *ctx,
 
     spin_lock_irqsave(&ctx->lock, flags);
 
-    while (!list_empty(&ctx->pending_fences)) {
-        nv_fence = list_first_entry(&ctx->pending_fences,
-                                    typeof(*nv_fence),
-                                    pending_node);
+    while ((node = rb_first_cached(&ctx->pending_fences)) != NULL) {
+        nv_fence = rb_entry(node, typeof(*nv_fence), pending_rb);
 
         fenceSeqno = __nv_drm_get_semsurf_fence_seqno(nv_fence);
         fenceTimeout = nv_fence->timeout;
 
         if (fenceSeqno <= currentSeqno) {
-            list_move_tail(&nv_fence->pending_node, &finished);
+            rb_erase_cached(node, &ctx->pending_fences);
+            list_add_tail(&nv_fence->pending_node, &finished);
         } else if (fenceTimeout <= now) {
-            list_move_tail(&nv_fence->pending_node, &timed_out);
+            rb_erase_cached(node, &ctx->pending_fences);
+            list_add_tail(&nv_fence->pending_node, &timed_out);
         } else {
             break;
         }
@@ -853,7 +868,7 @@ __nv_drm_semsurf_ctx_process_completed(struct nv_drm_semsurf_fence_ctx *ctx,
      * timeout.
      */
     if (newWaitValueOut && newTimeoutOut) {
-        if (list_empty(&ctx->pending_fences)) {
+        if (RB_EMPTY_ROOT(&ctx->pending_fences.rb_root)) {
             /* No pending fences, so no waiter is needed. */
             ctx->current_wait_value = fenceSeqno = 0;
             fenceTimeout = 0;
@@ -1275,7 +1290,7 @@ __nv_drm_semsurf_fence_ctx_new(
     };
 
     spin_lock_init(&ctx->lock);
-    INIT_LIST_HEAD(&ctx->pending_fences);
+    ctx->pending_fences = RB_ROOT_CACHED;
     INIT_LIST_HEAD(&ctx->pending_waits);
 
     sprintf(worker_name, "nvidia-drm/timeline-%llx",
@@ -1373,7 +1388,7 @@ static const nv_dma_fence_ops_t nv_drm_semsurf_fence_ops = {
 
 /*
  * Completes fence initialization, places a new reference to the fence in the
- * context's pending fence list, and updates/registers any RM callbacks and
+ * context's pending fence tree, and updates/registers any RM callbacks and
  * timeout timers if necessary.
  *
  * Can NOT be called from in an atomic context/interrupt handler.
@@ -1383,14 +1398,30 @@ __nv_drm_semsurf_ctx_add_pending(struct nv_drm_semsurf_fence_ctx *ctx,
                                  struct nv_drm_semsurf_fence *nv_fence,
                                  NvU64 timeoutMS)
 {
-    struct list_head *pending;
+    struct rb_node **where = &ctx->pending_fences.rb_root.rb_node;
+    struct rb_node *parent = NULL;
+    bool leftmost = true;
     unsigned long flags;
 
+    /*
+     * Fastpath for fences created behind the timeline: if the semaphore has
+     * already reached the fence's wait value, signal it immediately rather
+     * than routing it through the pending fence tree and an RM callback
+     * registration. The semaphore value only moves forward, so this lock-free
+     * check can not produce a false positive, and a value that advances just
+     * after the check is caught by the normal callback path below.
+     */
+    if (__nv_drm_get_semsurf_fence_seqno(nv_fence) <=
+        __nv_drm_get_semsurf_ctx_seqno(ctx)) {
+        nv_dma_fence_signal(&nv_fence->base);
+        return;
+    }
+
     if (timeoutMS > NV_DRM_SEMAPHORE_SURFACE_FENCE_MAX_TIMEOUT_MS) {
         timeoutMS = NV_DRM_SEMAPHORE_SURFACE_FENCE_MAX_TIMEOUT_MS;
     }
 
-    /* Add a reference to the fence for the list */
+    /* Add a reference to the fence for the tree */
     nv_dma_fence_get(&nv_fence->base);
     INIT_LIST_HEAD(&nv_fence->pending_node);
 
@@ -1398,24 +1429,25 @@ __nv_drm_semsurf_ctx_add_pending(struct nv_drm_semsurf_fence_ctx *ctx,
 
     spin_lock_irqsave(&ctx->lock, flags);
 
-    list_for_each(pending, &ctx->pending_fences) {
+    while (*where) {
         struct nv_drm_semsurf_fence *pending_fence =
-            list_entry(pending, typeof(*pending_fence), pending_node);
-        if (__nv_drm_get_semsurf_fence_seqno(pending_fence) >
-            __nv_drm_get_semsurf_fence_seqno(nv_fence)) {
-            /* Inserts 'nv_fence->pending_node' before 'pending' */
-            list_add_tail(&nv_fence->pending_node, pending);
-            break;
+            rb_entry(*where, typeof(*pending_fence), pending_rb);
+
+        parent = *where;
+
+        if (__nv_drm_get_semsurf_fence_seqno(nv_fence) <
+            __nv_drm_get_semsurf_fence_seqno(pending_fence)) {
+            where = &parent->rb_left;
+        } else {
+            /* Keeps fences with equal wait values in insertion order */
+            where = &parent->rb_right;
+            leftmost = false;
         }
     }
 
-    if (list_empty(&nv_fence->pending_node)) {
-        /*
-         * Inserts 'fence->pending_node' at the end of 'ctx->pending_fences',
-         * or as the head if the list is empty
-         */
-        list_add_tail(&nv_fence->pending_node, &ctx->pending_fences);
-    }
+    rb_link_node(&nv_fence->pending_rb, parent, where);
+    rb_insert_color_cached(&nv_fence->pending_rb, &ctx->pending_fences,
+                           leftmost);
 
     /* Fence is live starting... now! */
     spin_unlock_irqrestore(&ctx->lock, flags);
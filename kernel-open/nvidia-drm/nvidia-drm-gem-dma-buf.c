@@ -41,12 +41,56 @@
 
 #include "linux/dma-buf.h"
 
+void nv_drm_gem_dma_buf_import_cache_init(struct nv_drm_device *nv_dev)
+{
+    spin_lock_init(&nv_dev->dma_buf_import_lock);
+    INIT_LIST_HEAD(&nv_dev->dma_buf_imports);
+}
+
+/*
+ * Look up a live GEM object previously imported from this dma-buf. A hit
+ * returns a new reference to the existing object, so repeated imports of
+ * the same dma-buf, e.g. by each client of a multi-process compositing
+ * pipeline, share one attachment, sg table and NVKMS memory handle.
+ *
+ * The object is removed from the import list in its free callback, which
+ * runs after its reference count has dropped to zero; an object caught in
+ * between is skipped by kref_get_unless_zero() here.
+ */
+struct drm_gem_object*
+nv_drm_gem_dma_buf_import_cache_lookup(struct drm_device *dev,
+                                       struct dma_buf *dma_buf)
+{
+    struct nv_drm_device *nv_dev = to_nv_device(dev);
+    struct nv_drm_gem_dma_buf *nv_dma_buf;
+    struct drm_gem_object *gem = NULL;
+
+    spin_lock(&nv_dev->dma_buf_import_lock);
+
+    list_for_each_entry(nv_dma_buf, &nv_dev->dma_buf_imports,
+                        import_cache_entry) {
+        if (nv_dma_buf->dma_buf == dma_buf &&
+            kref_get_unless_zero(&nv_dma_buf->base.base.refcount)) {
+            gem = &nv_dma_buf->base.base;
+            break;
+        }
+    }
+
+    spin_unlock(&nv_dev->dma_buf_import_lock);
+
+    return gem;
+}
+
 static inline
 void __nv_drm_gem_dma_buf_free(struct nv_drm_gem_object *nv_gem)
 {
     struct nv_drm_device *nv_dev = nv_gem->nv_dev;
     struct nv_drm_gem_dma_buf *nv_dma_buf = to_nv_dma_buf(nv_gem);
 
+    spin_lock(&nv_dev->dma_buf_import_lock);
+    list_del(&nv_dma_buf->import_cache_entry);
+    spin_unlock(&nv_dev->dma_buf_import_lock);
+
 #if defined(NV_DRM_ATOMIC_MODESET_AVAILABLE)
     if (nv_dma_buf->base.pMemory) {
         /* Free NvKmsKapiMemory handle associated with this gem object */
@@ -170,6 +214,12 @@ nv_drm_gem_prime_import_sg_table(struct drm_device *dev,
 
     nv_dma_buf->sgt = sgt;
 
+    nv_dma_buf->dma_buf = dma_buf;
+
+    spin_lock(&nv_dev->dma_buf_import_lock);
+    list_add(&nv_dma_buf->import_cache_entry, &nv_dev->dma_buf_imports);
+    spin_unlock(&nv_dev->dma_buf_import_lock);
+
     return &nv_dma_buf->base.base;
 }
 
@@ -32,6 +32,13 @@
 struct nv_drm_gem_dma_buf {
     struct nv_drm_gem_object base;
     struct sg_table *sgt;
+
+    /*
+     * Imported dma-buf this object was created from, and its entry in
+     * nv_drm_device::dma_buf_imports for the lifetime of the object.
+     */
+    struct dma_buf *dma_buf;
+    struct list_head import_cache_entry;
 };
 
 extern const struct nv_drm_gem_object_funcs __nv_gem_dma_buf_ops;
@@ -63,6 +70,14 @@ struct nv_drm_gem_dma_buf *nv_drm_gem_object_dma_buf_lookup(
     return to_nv_dma_buf(nv_gem);
 }
 
+struct nv_drm_device;
+
+void nv_drm_gem_dma_buf_import_cache_init(struct nv_drm_device *nv_dev);
+
+struct drm_gem_object*
+nv_drm_gem_dma_buf_import_cache_lookup(struct drm_device *dev,
+                                       struct dma_buf *dma_buf);
+
 struct drm_gem_object*
 nv_drm_gem_prime_import_sg_table(struct drm_device *dev,
                                  struct dma_buf_attachment *attach,
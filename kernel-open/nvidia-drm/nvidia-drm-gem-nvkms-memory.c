@@ -71,11 +71,79 @@ static void __nv_drm_gem_nvkms_memory_free(struct nv_drm_gem_object *nv_gem)
     nv_drm_free(nv_nvkms_memory);
 }
 
+#if defined(NV_LINUX)
+/*
+ * Populate the whole mapping at mmap() time instead of filling it one PTE
+ * per fault. Compositors map large scanout buffers right after a mode
+ * switch and then touch every page, so faulting the range in lazily just
+ * trades one page-table walk for a storm of page faults. Population is
+ * best-effort: any PTE not established here is still filled by
+ * __nv_drm_gem_nvkms_handle_vma_fault() on first access.
+ */
+static void __nv_drm_gem_nvkms_prefault(
+    struct nv_drm_gem_nvkms_memory *nv_nvkms_memory,
+    struct vm_area_struct *vma)
+{
+    unsigned long page_offset = vma->vm_pgoff -
+        drm_vma_node_start(&nv_nvkms_memory->base.base.vma_node);
+    unsigned long num_pages = vma_pages(vma);
+    unsigned long i;
+
+    if (nv_nvkms_memory->pages_count == 0) {
+        unsigned long pfn;
+
+        if (!nv_nvkms_memory->physically_mapped) {
+            return;
+        }
+
+        /*
+         * Video memory backs the mapping with one contiguous physical
+         * range, so a single remap builds every PTE in one walk.
+         */
+        pfn = (unsigned long)(uintptr_t)nv_nvkms_memory->pPhysicalAddress;
+        pfn = (pfn >> PAGE_SHIFT) + page_offset;
+
+        io_remap_pfn_range(vma, vma->vm_start, pfn,
+                           num_pages << PAGE_SHIFT, vma->vm_page_prot);
+        return;
+    }
+
+    if ((page_offset + num_pages) > nv_nvkms_memory->pages_count) {
+        return;
+    }
+
+    for (i = 0; i < num_pages; i++) {
+        unsigned long address = vma->vm_start + (i << PAGE_SHIFT);
+        unsigned long pfn = page_to_pfn(nv_nvkms_memory->pages[page_offset + i]);
+
+#if defined(NV_VMF_INSERT_PFN_PRESENT)
+        if (vmf_insert_pfn(vma, address, pfn) != VM_FAULT_NOPAGE) {
+            break;
+        }
+#else
+        int ret = vm_insert_pfn(vma, address, pfn);
+
+        if ((ret != 0) && (ret != -EBUSY)) {
+            break;
+        }
+#endif
+    }
+}
+#endif /* defined(NV_LINUX) */
+
 static int __nv_drm_gem_nvkms_mmap(struct nv_drm_gem_object *nv_gem,
                                    struct vm_area_struct *vma)
 {
-    return drm_gem_mmap_obj(&nv_gem->base,
+    int ret = drm_gem_mmap_obj(&nv_gem->base,
                 drm_vma_node_size(&nv_gem->base.vma_node) << PAGE_SHIFT, vma);
+
+#if defined(NV_LINUX)
+    if (ret == 0) {
+        __nv_drm_gem_nvkms_prefault(to_nv_nvkms_memory(nv_gem), vma);
+    }
+#endif
+
+    return ret;
 }
 
 static vm_fault_t __nv_drm_gem_nvkms_handle_vma_fault(
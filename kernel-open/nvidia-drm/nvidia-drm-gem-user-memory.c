@@ -40,11 +40,261 @@
 #include <vm/vm_pageout.h>
 #endif
 
+#if defined(NV_MMU_INTERVAL_NOTIFIER)
+
+#include <linux/mmu_notifier.h>
+
+#define NV_DRM_PIN_CACHE_MAX_ENTRIES 8
+
+/*
+ * Media pipelines import the same user buffers repeatedly, paying for a full
+ * get_user_pages walk on every import. Rather than unpinning the pages as
+ * soon as a user-memory GEM object is freed, park the pinned page array in a
+ * small per-device cache keyed by (mm, address, size) and let the next
+ * import of the same range adopt it. An MMU interval notifier registered
+ * over the user range at pin time invalidates an entry when the user mapping
+ * changes, so a cached array can never be served for a range that no longer
+ * maps those pages.
+ */
+struct nv_drm_pin_cache_entry {
+    /* Node in nv_drm_device::pin_cache or nv_drm_device::pin_cache_reap */
+    struct list_head entry;
+
+    struct mmu_interval_notifier notifier;
+
+    struct nv_drm_device *nv_dev;
+    struct mm_struct *mm;
+    unsigned long address;
+    unsigned long pages_count;
+    struct page **pages;
+
+    /* On nv_drm_device::pin_cache, available for adoption by an import */
+    bool parked;
+
+    /* The user mapping has changed since the pages were pinned */
+    bool invalidated;
+};
+
+static bool __nv_drm_pin_cache_notifier_invalidate(
+    struct mmu_interval_notifier *mni,
+    const struct mmu_notifier_range *range,
+    unsigned long cur_seq)
+{
+    struct nv_drm_pin_cache_entry *entry =
+        container_of(mni, struct nv_drm_pin_cache_entry, notifier);
+    struct nv_drm_device *nv_dev = entry->nv_dev;
+    unsigned long flags;
+
+    mmu_interval_set_seq(mni, cur_seq);
+
+    spin_lock_irqsave(&nv_dev->pin_cache_lock, flags);
+    entry->invalidated = true;
+    if (entry->parked) {
+        /*
+         * The pages can not be unpinned here: this callback may run in a
+         * non-blocking context, and removing our own notifier from it would
+         * deadlock. Move the entry to the reap list; it is unpinned on the
+         * next import or at device teardown.
+         */
+        entry->parked = false;
+        list_move(&entry->entry, &nv_dev->pin_cache_reap);
+        nv_dev->pin_cache_count--;
+    }
+    spin_unlock_irqrestore(&nv_dev->pin_cache_lock, flags);
+
+    return true;
+}
+
+static const struct mmu_interval_notifier_ops __nv_drm_pin_cache_notifier_ops = {
+    .invalidate = __nv_drm_pin_cache_notifier_invalidate,
+};
+
+/*
+ * Unregister the entry's notifier, unpin its pages and free it. Must not be
+ * called with pin_cache_lock held, and the entry must not be reachable from
+ * the cache or reap lists.
+ */
+static void __nv_drm_pin_cache_entry_free(struct nv_drm_pin_cache_entry *entry)
+{
+    mmu_interval_notifier_remove(&entry->notifier);
+    nv_drm_unlock_user_pages(entry->pages_count, entry->pages);
+    nv_drm_free(entry);
+}
+
+/* Free all entries the notifier callback moved to the reap list */
+static void __nv_drm_pin_cache_reap(struct nv_drm_device *nv_dev)
+{
+    struct list_head reap_list;
+    unsigned long flags;
+
+    INIT_LIST_HEAD(&reap_list);
+
+    spin_lock_irqsave(&nv_dev->pin_cache_lock, flags);
+    list_splice_init(&nv_dev->pin_cache_reap, &reap_list);
+    spin_unlock_irqrestore(&nv_dev->pin_cache_lock, flags);
+
+    while (!list_empty(&reap_list)) {
+        struct nv_drm_pin_cache_entry *entry =
+            list_first_entry(&reap_list, typeof(*entry), entry);
+
+        list_del(&entry->entry);
+        __nv_drm_pin_cache_entry_free(entry);
+    }
+}
+
+/*
+ * Adopt a parked entry holding pages pinned for exactly
+ * (current->mm, address, pages_count), if one exists.
+ */
+static struct nv_drm_pin_cache_entry *__nv_drm_pin_cache_acquire(
+    struct nv_drm_device *nv_dev,
+    unsigned long address,
+    unsigned long pages_count)
+{
+    struct nv_drm_pin_cache_entry *entry, *found = NULL;
+    unsigned long flags;
+
+    spin_lock_irqsave(&nv_dev->pin_cache_lock, flags);
+    list_for_each_entry(entry, &nv_dev->pin_cache, entry) {
+        if ((entry->mm == current->mm) &&
+            (entry->address == address) &&
+            (entry->pages_count == pages_count) &&
+            !entry->invalidated) {
+            found = entry;
+            found->parked = false;
+            list_del(&found->entry);
+            nv_dev->pin_cache_count--;
+            break;
+        }
+    }
+    spin_unlock_irqrestore(&nv_dev->pin_cache_lock, flags);
+
+    return found;
+}
+
+static struct nv_drm_pin_cache_entry *__nv_drm_pin_cache_entry_create(
+    struct nv_drm_device *nv_dev,
+    unsigned long address,
+    unsigned long pages_count,
+    struct page **pages)
+{
+    struct nv_drm_pin_cache_entry *entry = nv_drm_calloc(1, sizeof(*entry));
+
+    if (entry == NULL) {
+        return NULL;
+    }
+
+    entry->nv_dev = nv_dev;
+    entry->mm = current->mm;
+    entry->address = address;
+    entry->pages_count = pages_count;
+    entry->pages = pages;
+
+    if (mmu_interval_notifier_insert(&entry->notifier, current->mm,
+                                     address, pages_count << PAGE_SHIFT,
+                                     &__nv_drm_pin_cache_notifier_ops) != 0) {
+        nv_drm_free(entry);
+        return NULL;
+    }
+
+    return entry;
+}
+
+/*
+ * Park an entry whose GEM object is being freed. Returns false if the entry
+ * has been invalidated, in which case the caller must free it.
+ */
+static bool __nv_drm_pin_cache_park(struct nv_drm_device *nv_dev,
+                                    struct nv_drm_pin_cache_entry *entry)
+{
+    struct nv_drm_pin_cache_entry *evicted = NULL;
+    unsigned long flags;
+
+    spin_lock_irqsave(&nv_dev->pin_cache_lock, flags);
+    if (entry->invalidated) {
+        spin_unlock_irqrestore(&nv_dev->pin_cache_lock, flags);
+        return false;
+    }
+
+    entry->parked = true;
+    list_add(&entry->entry, &nv_dev->pin_cache);
+
+    if (++nv_dev->pin_cache_count > NV_DRM_PIN_CACHE_MAX_ENTRIES) {
+        evicted = list_last_entry(&nv_dev->pin_cache, typeof(*evicted), entry);
+        evicted->parked = false;
+        list_del(&evicted->entry);
+        nv_dev->pin_cache_count--;
+    }
+    spin_unlock_irqrestore(&nv_dev->pin_cache_lock, flags);
+
+    if (evicted != NULL) {
+        __nv_drm_pin_cache_entry_free(evicted);
+    }
+
+    return true;
+}
+
+void nv_drm_pin_cache_init(struct nv_drm_device *nv_dev)
+{
+    spin_lock_init(&nv_dev->pin_cache_lock);
+    INIT_LIST_HEAD(&nv_dev->pin_cache);
+    INIT_LIST_HEAD(&nv_dev->pin_cache_reap);
+    nv_dev->pin_cache_count = 0;
+}
+
+void nv_drm_pin_cache_purge(struct nv_drm_device *nv_dev)
+{
+    struct list_head purge_list;
+    unsigned long flags;
+
+    INIT_LIST_HEAD(&purge_list);
+
+    spin_lock_irqsave(&nv_dev->pin_cache_lock, flags);
+    list_splice_init(&nv_dev->pin_cache, &purge_list);
+    list_splice_init(&nv_dev->pin_cache_reap, &purge_list);
+    nv_dev->pin_cache_count = 0;
+    spin_unlock_irqrestore(&nv_dev->pin_cache_lock, flags);
+
+    while (!list_empty(&purge_list)) {
+        struct nv_drm_pin_cache_entry *entry =
+            list_first_entry(&purge_list, typeof(*entry), entry);
+
+        entry->parked = false;
+        list_del(&entry->entry);
+        __nv_drm_pin_cache_entry_free(entry);
+    }
+}
+
+#else /* NV_MMU_INTERVAL_NOTIFIER */
+
+void nv_drm_pin_cache_init(struct nv_drm_device *nv_dev)
+{
+}
+
+void nv_drm_pin_cache_purge(struct nv_drm_device *nv_dev)
+{
+}
+
+#endif /* NV_MMU_INTERVAL_NOTIFIER */
+
 static inline
 void __nv_drm_gem_user_memory_free(struct nv_drm_gem_object *nv_gem)
 {
     struct nv_drm_gem_user_memory *nv_user_memory = to_nv_user_memory(nv_gem);
 
+#if defined(NV_MMU_INTERVAL_NOTIFIER)
+    if (nv_user_memory->pin_entry != NULL) {
+        struct nv_drm_pin_cache_entry *entry = nv_user_memory->pin_entry;
+
+        if (!__nv_drm_pin_cache_park(entry->nv_dev, entry)) {
+            __nv_drm_pin_cache_entry_free(entry);
+        }
+
+        nv_drm_free(nv_user_memory);
+        return;
+    }
+#endif
+
     nv_drm_unlock_user_pages(nv_user_memory->pages_count,
                              nv_user_memory->pages);
 
@@ -171,6 +421,9 @@ int nv_drm_gem_import_userspace_memory_ioctl(struct drm_device *dev,
     struct drm_nvidia_gem_import_userspace_memory_params *params = data;
     struct nv_drm_gem_user_memory *nv_user_memory;
 
+#if defined(NV_MMU_INTERVAL_NOTIFIER)
+    struct nv_drm_pin_cache_entry *pin_entry = NULL;
+#endif
     struct page **pages = NULL;
     unsigned long pages_count = 0;
 
@@ -187,14 +440,41 @@ int nv_drm_gem_import_userspace_memory_ioctl(struct drm_device *dev,
 
     pages_count = params->size / PAGE_SIZE;
 
-    ret = nv_drm_lock_user_pages(params->address, pages_count, &pages);
+#if defined(NV_MMU_INTERVAL_NOTIFIER)
+    /* Unpin any cached page arrays whose user mapping has changed */
+    __nv_drm_pin_cache_reap(nv_dev);
 
-    if (ret != 0) {
-        NV_DRM_DEV_LOG_ERR(
-            nv_dev,
-            "Failed to lock user pages for address 0x%" NvU64_fmtx ": %d",
-            params->address, ret);
-        return ret;
+    /*
+     * Adopt a cached page array if this exact range was imported and freed
+     * recently, skipping the get_user_pages walk.
+     */
+    pin_entry = __nv_drm_pin_cache_acquire(nv_dev, params->address,
+                                           pages_count);
+    if (pin_entry != NULL) {
+        pages = pin_entry->pages;
+    }
+
+    if (pin_entry == NULL)
+#endif
+    {
+        ret = nv_drm_lock_user_pages(params->address, pages_count, &pages);
+
+        if (ret != 0) {
+            NV_DRM_DEV_LOG_ERR(
+                nv_dev,
+                "Failed to lock user pages for address 0x%" NvU64_fmtx ": %d",
+                params->address, ret);
+            return ret;
+        }
+
+#if defined(NV_MMU_INTERVAL_NOTIFIER)
+        /*
+         * A NULL entry is not fatal; the pages simply can not be parked in
+         * the pin cache when this object is freed.
+         */
+        pin_entry = __nv_drm_pin_cache_entry_create(nv_dev, params->address,
+                                                    pages_count, pages);
+#endif
     }
 
     if ((nv_user_memory =
@@ -205,6 +485,9 @@ int nv_drm_gem_import_userspace_memory_ioctl(struct drm_device *dev,
 
     nv_user_memory->pages = pages;
     nv_user_memory->pages_count = pages_count;
+#if defined(NV_MMU_INTERVAL_NOTIFIER)
+    nv_user_memory->pin_entry = pin_entry;
+#endif
 
     nv_drm_gem_object_init(nv_dev,
                            &nv_user_memory->base,
@@ -217,7 +500,15 @@ int nv_drm_gem_import_userspace_memory_ioctl(struct drm_device *dev,
                                                    &params->handle);
 
 failed:
-    nv_drm_unlock_user_pages(pages_count, pages);
+#if defined(NV_MMU_INTERVAL_NOTIFIER)
+    if (pin_entry != NULL) {
+        /* Unregisters the notifier and unpins the pages */
+        __nv_drm_pin_cache_entry_free(pin_entry);
+    } else
+#endif
+    {
+        nv_drm_unlock_user_pages(pages_count, pages);
+    }
 
     return ret;
 }
@@ -29,10 +29,21 @@
 
 #include "nvidia-drm-gem.h"
 
+struct nv_drm_pin_cache_entry;
+
 struct nv_drm_gem_user_memory {
     struct nv_drm_gem_object base;
     struct page **pages;
     unsigned long pages_count;
+
+#if defined(NV_MMU_INTERVAL_NOTIFIER)
+    /*
+     * Pin cache entry owning the pinned pages, or NULL if the pages are
+     * owned by this object directly. Parked in the device's pin cache when
+     * this object is freed, unless its user mapping has been invalidated.
+     */
+    struct nv_drm_pin_cache_entry *pin_entry;
+#endif
 };
 
 extern const struct nv_drm_gem_object_funcs __nv_gem_user_memory_ops;
@@ -50,6 +61,12 @@ static inline struct nv_drm_gem_user_memory *to_nv_user_memory(
 int nv_drm_gem_import_userspace_memory_ioctl(struct drm_device *dev,
                                              void *data, struct drm_file *filep);
 
+struct nv_drm_device;
+
+void nv_drm_pin_cache_init(struct nv_drm_device *nv_dev);
+
+void nv_drm_pin_cache_purge(struct nv_drm_device *nv_dev);
+
 static inline
 struct nv_drm_gem_user_memory *nv_drm_gem_object_user_memory_lookup(
     struct drm_device *dev,
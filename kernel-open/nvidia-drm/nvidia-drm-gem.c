@@ -149,6 +149,7 @@ void nv_drm_gem_object_init(struct nv_drm_device *nv_dev,
 struct drm_gem_object *nv_drm_gem_prime_import(struct drm_device *dev,
                                                struct dma_buf *dma_buf)
 {
+    struct drm_gem_object *gem_cached;
 #if defined(NV_DMA_BUF_OWNER_PRESENT)
     struct drm_gem_object *gem_dst;
     struct nv_drm_gem_object *nv_gem_src;
@@ -172,6 +173,19 @@ struct drm_gem_object *nv_drm_gem_prime_import(struct drm_device *dev,
     }
 #endif /* NV_DMA_BUF_OWNER_PRESENT */
 
+    /*
+     * If this dma-buf has already been imported into this device, reuse
+     * the existing GEM object rather than attaching to the dma-buf again.
+     * This dedupes imports from different DRM file descriptors; imports
+     * repeated on the same file descriptor are already deduped by the
+     * fd-to-handle cache in DRM core.
+     */
+    gem_cached = nv_drm_gem_dma_buf_import_cache_lookup(dev, dma_buf);
+
+    if (gem_cached != NULL) {
+        return gem_cached;
+    }
+
     return drm_gem_prime_import(dev, dma_buf);
 }
 
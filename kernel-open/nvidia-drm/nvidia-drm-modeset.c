@@ -401,11 +401,165 @@ static void __nv_drm_handle_flip_event(struct nv_drm_crtc *nv_crtc)
     nv_drm_free(nv_flip);
 }
 
+/**
+ * __nv_drm_atomic_commit_tail - push a swapped-in atomic state to NVKMS
+ * @dev: DRM device
+ * @state: atomic state tracking atomic update
+ *
+ * Applies the committed configuration to NVKMS and delivers or defers the
+ * flip completion events for each affected crtc. Must be called after
+ * drm_atomic_helper_swap_state(), either directly from
+ * nv_drm_atomic_commit() or from the device's commit worker thread. The
+ * caller is responsible for ensuring no other commit affecting the same
+ * crtcs can run concurrently.
+ */
+static void __nv_drm_atomic_commit_tail(struct drm_device *dev,
+                                        struct drm_atomic_state *state)
+{
+    struct nv_drm_device *nv_dev = to_nv_device(dev);
+    struct drm_crtc *crtc = NULL;
+    struct drm_crtc_state *crtc_state = NULL;
+    int i;
+    int ret;
+
+    if ((ret = nv_drm_atomic_apply_modeset_config(
+                    dev,
+                    state, true /* commit */)) != 0) {
+        NV_DRM_DEV_LOG_ERR(
+            nv_dev,
+            "Failed to apply atomic modeset.  Error code: %d",
+            ret);
+
+        return;
+    }
+    nv_dev->drmMasterChangedSinceLastAtomicCommit = NV_FALSE;
+
+    nv_drm_for_each_crtc_in_state(state, crtc, crtc_state, i) {
+        struct nv_drm_crtc *nv_crtc = to_nv_crtc(crtc);
+        struct nv_drm_crtc_state *nv_new_crtc_state =
+            to_nv_crtc_state(crtc->state);
+
+        /*
+         * If nv_drm_atomic_apply_modeset_config() hasn't consumed the flip
+         * object, no event will be generated for this flip, and we need process
+         * it:
+         */
+
+        if (nv_new_crtc_state->nv_flip != NULL) {
+            /*
+             * First, defer processing of all pending flips for this crtc until
+             * last flip in the queue has been processed. This is to ensure a
+             * correct order in event delivery.
+             */
+            spin_lock(&nv_crtc->flip_list_lock);
+            if (!list_empty(&nv_crtc->flip_list)) {
+                struct nv_drm_flip *nv_last_flip =
+                    list_last_entry(&nv_crtc->flip_list,
+                                    struct nv_drm_flip, list_entry);
+
+                list_add(&nv_new_crtc_state->nv_flip->list_entry,
+                    &nv_last_flip->deferred_flip_list);
+
+                nv_new_crtc_state->nv_flip = NULL;
+            }
+            spin_unlock(&nv_crtc->flip_list_lock);
+        }
+
+        if (nv_new_crtc_state->nv_flip != NULL) {
+            /*
+             * Then, if no more pending flips for this crtc, deliver event for the
+             * current flip.
+             */
+            if (nv_new_crtc_state->nv_flip->event != NULL) {
+                spin_lock(&dev->event_lock);
+                drm_crtc_send_vblank_event(crtc,
+                                           nv_new_crtc_state->nv_flip->event);
+                spin_unlock(&dev->event_lock);
+            }
+
+            nv_drm_free(nv_new_crtc_state->nv_flip);
+            nv_new_crtc_state->nv_flip = NULL;
+        }
+    }
+}
+
+#if defined(NV_DRM_ATOMIC_STATE_REF_COUNTING_PRESENT)
+
+struct nv_drm_atomic_commit_task {
+    struct drm_device *dev;
+    struct drm_atomic_state *state;
+    nv_drm_work work;
+};
+
+static void __nv_drm_atomic_commit_work(void *data)
+{
+    struct nv_drm_atomic_commit_task *task = data;
+    struct drm_device *dev = task->dev;
+    struct nv_drm_device *nv_dev = to_nv_device(dev);
+
+    __nv_drm_atomic_commit_tail(dev, task->state);
+
+    drm_atomic_state_put(task->state);
+    nv_drm_free(task);
+
+    atomic_dec(&nv_dev->pending_commit_tasks);
+    wake_up_all(&nv_dev->flip_event_wq);
+}
+
+/**
+ * __nv_drm_atomic_defer_commit - hand a commit off to the commit worker
+ * @dev: DRM device
+ * @state: atomic state tracking atomic update
+ *
+ * Attempts to queue the NVKMS push of a swapped-in state on the device's
+ * commit worker thread, so a non-blocking commit does not stall the atomic
+ * ioctl behind a slow modeset. The worker takes its own reference on @state
+ * and is then responsible for delivering flip events and dropping that
+ * reference. Returns false if the hand-off could not be made, in which case
+ * the caller must commit synchronously.
+ */
+static bool __nv_drm_atomic_defer_commit(struct drm_device *dev,
+                                         struct drm_atomic_state *state)
+{
+    struct nv_drm_device *nv_dev = to_nv_device(dev);
+    struct nv_drm_atomic_commit_task *task =
+        nv_drm_calloc(1, sizeof(*task));
+
+    if (task == NULL) {
+        return false;
+    }
+
+    task->dev = dev;
+    task->state = state;
+    drm_atomic_state_get(state);
+
+    nv_drm_workthread_work_init(&task->work,
+                                __nv_drm_atomic_commit_work,
+                                task);
+
+    atomic_inc(&nv_dev->pending_commit_tasks);
+
+    if (!nv_drm_workthread_add_work(&nv_dev->commit_worker, &task->work)) {
+        /* The commit worker is shutting down; commit synchronously instead */
+        atomic_dec(&nv_dev->pending_commit_tasks);
+        drm_atomic_state_put(state);
+        nv_drm_free(task);
+        return false;
+    }
+
+    return true;
+}
+
+#endif /* NV_DRM_ATOMIC_STATE_REF_COUNTING_PRESENT */
+
 int nv_drm_atomic_commit(struct drm_device *dev,
                          struct drm_atomic_state *state,
                          bool nonblock)
 {
-    int ret = -EBUSY;
+#if defined(NV_DRM_ATOMIC_HELPER_SWAP_STATE_HAS_STALL_ARG) && \
+    defined(NV_DRM_ATOMIC_HELPER_SWAP_STATE_RETURN_INT)
+    int ret;
+#endif
 
     int i;
     struct drm_crtc *crtc = NULL;
@@ -423,6 +577,28 @@ int nv_drm_atomic_commit(struct drm_device *dev,
      * Our system already implements such a queue, but due to
      * bug 4054608, it is currently not used.
      */
+
+    /*
+     * A commit handed off to the commit worker counts as an outstanding
+     * update until it has been pushed to NVKMS: a non-blocking commit must
+     * not queue behind it, and a blocking commit must wait for it to reach
+     * the hardware before swapping in new state.
+     */
+    if (nonblock) {
+        if (atomic_read(&nv_dev->pending_commit_tasks) != 0) {
+            return -EBUSY;
+        }
+    } else {
+        if (wait_event_timeout(
+                nv_dev->flip_event_wq,
+                atomic_read(&nv_dev->pending_commit_tasks) == 0,
+                3 * HZ /* 3 second */) == 0) {
+            NV_DRM_DEV_LOG_ERR(
+                nv_dev,
+                "Deferred commit timeout");
+        }
+    }
+
     nv_drm_for_each_crtc_in_state(state, crtc, crtc_state, i) {
         struct nv_drm_crtc *nv_crtc = to_nv_crtc(crtc);
 
@@ -496,66 +672,30 @@ int nv_drm_atomic_commit(struct drm_device *dev,
      * calling drm_atomic_helper_swap_state().
      */
 
-    if ((ret = nv_drm_atomic_apply_modeset_config(
-                    dev,
-                    state, true /* commit */)) != 0) {
-        NV_DRM_DEV_LOG_ERR(
-            nv_dev,
-            "Failed to apply atomic modeset.  Error code: %d",
-            ret);
-
-        goto done;
-    }
-    nv_dev->drmMasterChangedSinceLastAtomicCommit = NV_FALSE;
-
-    nv_drm_for_each_crtc_in_state(state, crtc, crtc_state, i) {
-        struct nv_drm_crtc *nv_crtc = to_nv_crtc(crtc);
-        struct nv_drm_crtc_state *nv_new_crtc_state =
-            to_nv_crtc_state(crtc->state);
-
+    /*
+     * Devices supporting syncpts copy post-syncpt fds back to userspace
+     * during the commit, which requires the ioctl caller's address space;
+     * such commits can not be pushed from the commit worker thread.
+     */
+#if defined(NV_DRM_ATOMIC_STATE_REF_COUNTING_PRESENT)
+    if (nonblock && !nv_dev->supportsSyncpts &&
+        __nv_drm_atomic_defer_commit(dev, state)) {
         /*
-         * If nv_drm_atomic_apply_modeset_config() hasn't consumed the flip
-         * object, no event will be generated for this flip, and we need process
-         * it:
+         * The commit worker now owns pushing this state to NVKMS; it will
+         * deliver flip events and drop its state reference when done. The
+         * pending_commit_tasks gate above keeps any subsequent commit from
+         * swapping in new state until then.
          */
+        return 0;
+    }
+#endif
 
-        if (nv_new_crtc_state->nv_flip != NULL) {
-            /*
-             * First, defer processing of all pending flips for this crtc until
-             * last flip in the queue has been processed. This is to ensure a
-             * correct order in event delivery.
-             */
-            spin_lock(&nv_crtc->flip_list_lock);
-            if (!list_empty(&nv_crtc->flip_list)) {
-                struct nv_drm_flip *nv_last_flip =
-                    list_last_entry(&nv_crtc->flip_list,
-                                    struct nv_drm_flip, list_entry);
-
-                list_add(&nv_new_crtc_state->nv_flip->list_entry,
-                    &nv_last_flip->deferred_flip_list);
-
-                nv_new_crtc_state->nv_flip = NULL;
-            }
-            spin_unlock(&nv_crtc->flip_list_lock);
-        }
-
-        if (nv_new_crtc_state->nv_flip != NULL) {
-            /*
-             * Then, if no more pending flips for this crtc, deliver event for the
-             * current flip.
-             */
-            if (nv_new_crtc_state->nv_flip->event != NULL) {
-                spin_lock(&dev->event_lock);
-                drm_crtc_send_vblank_event(crtc,
-                                           nv_new_crtc_state->nv_flip->event);
-                spin_unlock(&dev->event_lock);
-            }
+    __nv_drm_atomic_commit_tail(dev, state);
 
-            nv_drm_free(nv_new_crtc_state->nv_flip);
-            nv_new_crtc_state->nv_flip = NULL;
-        }
+    if (!nonblock) {
+        nv_drm_for_each_crtc_in_state(state, crtc, crtc_state, i) {
+            struct nv_drm_crtc *nv_crtc = to_nv_crtc(crtc);
 
-        if (!nonblock) {
             /*
              * Here you aren't required to hold nv_drm_crtc::flip_list_lock
              * because:
@@ -591,8 +731,6 @@ int nv_drm_atomic_commit(struct drm_device *dev,
         }
     }
 
-done:
-
 #if defined(NV_DRM_ATOMIC_STATE_REF_COUNTING_PRESENT)
     /*
      * If ref counting is present, state will be freed when the caller
@@ -137,6 +137,34 @@ struct nv_drm_device {
      */
     wait_queue_head_t flip_event_wq;
 
+    /**
+     * @commit_worker:
+     *
+     * Worker thread used by nv_drm_atomic_commit() to push non-blocking
+     * commits to NVKMS outside of the DRM atomic ioctl.
+     */
+    nv_drm_workthread commit_worker;
+
+    /**
+     * @pending_commit_tasks:
+     *
+     * Number of commits handed to @commit_worker but not yet pushed to
+     * NVKMS. @flip_event_wq is signaled when this count drops to zero.
+     */
+    atomic_t pending_commit_tasks;
+
+    /**
+     * @surface_cache:
+     *
+     * Small LRU of NVKMS surfaces from recently destroyed framebuffers,
+     * kept so that repeated framebuffer creation with identical parameters
+     * can skip the NVKMS surface registration round trip. Protected by
+     * @surface_cache_lock.
+     */
+    spinlock_t surface_cache_lock;
+    struct list_head surface_cache;
+    NvU32 surface_cache_count;
+
 #endif
 
 #if defined(NV_DRM_FENCE_AVAILABLE)
@@ -144,6 +172,36 @@ struct nv_drm_device {
     NvU64 semsurf_max_submitted_offset;
 #endif
 
+#if defined(NV_MMU_INTERVAL_NOTIFIER)
+    /**
+     * @pin_cache:
+     *
+     * Cache of pinned user page arrays from recently freed user-memory GEM
+     * objects, keyed by (mm, address, size), so repeated imports of stable
+     * user buffers skip the page pinning cost. Entries whose user mapping
+     * changed are moved to @pin_cache_reap by the MMU interval notifier
+     * callback and unpinned on the next import or at device teardown. All
+     * three fields are protected by @pin_cache_lock.
+     */
+    spinlock_t pin_cache_lock;
+    struct list_head pin_cache;
+    struct list_head pin_cache_reap;
+    NvU32 pin_cache_count;
+#endif
+
+    /**
+     * @dma_buf_imports:
+     *
+     * List of live DMA-BUF GEM objects imported into this device, keyed by
+     * the imported &struct dma_buf. Repeated imports of the same dma-buf,
+     * typically the same buffer shared by multiple clients, reuse the
+     * existing GEM object instead of creating a new attachment, sg table
+     * and NVKMS memory handle per import. Protected by
+     * @dma_buf_import_lock.
+     */
+    spinlock_t dma_buf_import_lock;
+    struct list_head dma_buf_imports;
+
     NvBool hasVideoMemory;
 
     NvBool supportsSyncpts;
@@ -47,6 +47,10 @@
 // named kernel thread (kthread). You can then insert arbitrary functions
 // into the queue, and those functions will be run in the context of the
 // queue's kthread.
+//
+// The nv_kthread_q_multi variant, at the bottom of this file, relaxes (2):
+// a multi-queue is serviced by several kthreads, each with its own local
+// item list, and an idle worker steals items from its siblings' lists.
 
 #ifndef WARN
     // Only *really* old kernels (2.6.9) end up here. Just use a simple printk
@@ -170,7 +174,7 @@ void nv_kthread_q_stop(nv_kthread_q_t *q)
 // This function is never invoked when there is no NUMA preference (preferred
 // node is NUMA_NO_NODE).
 static struct task_struct *thread_create_on_node(int (*threadfn)(void *data),
-                                                 nv_kthread_q_t *q,
+                                                 void *data,
                                                  int preferred_node,
                                                  const char *q_name)
 {
@@ -182,7 +186,7 @@ static struct task_struct *thread_create_on_node(int (*threadfn)(void *data),
     for (i = 0;; i++) {
         struct page *stack;
 
-        thread[i] = kthread_create_on_node(threadfn, q, preferred_node, q_name);
+        thread[i] = kthread_create_on_node(threadfn, data, preferred_node, q_name);
 
         if (unlikely(IS_ERR(thread[i]))) {
 
@@ -332,3 +336,322 @@ void nv_kthread_q_flush(nv_kthread_q_t *q)
     _raw_q_flush(q);
     _raw_q_flush(q);
 }
+
+////////////////////////////////////////////////////////////////////////////////
+// Multi-worker queues
+//
+// An nv_kthread_q_multi is serviced by several kthreads. Each worker owns a
+// local item list that nv_kthread_q_multi_schedule_q_item feeds round-robin,
+// and all workers share one counting semaphore: one count per item pending in
+// any list. A worker that wakes up pops from its own list first, and steals
+// from a sibling's list if its own is empty. Because items are added to a
+// list before the semaphore is upped, a successful semaphore down implies
+// that at least one unclaimed item exists somewhere, though a racing sibling
+// can make a single scan of the lists come up empty.
+
+static nv_kthread_q_item_t *_multi_worker_pop(struct nv_kthread_q_multi_worker *worker)
+{
+    nv_kthread_q_item_t *q_item = NULL;
+    unsigned long flags;
+
+    spin_lock_irqsave(&worker->q_lock, flags);
+
+    if (!list_empty(&worker->q_list_head)) {
+        q_item = list_first_entry(&worker->q_list_head,
+                                  nv_kthread_q_item_t,
+                                  q_list_node);
+
+        list_del_init(&q_item->q_list_node);
+    }
+
+    spin_unlock_irqrestore(&worker->q_lock, flags);
+
+    return q_item;
+}
+
+static int _multi_main_loop(void *args)
+{
+    struct nv_kthread_q_multi_worker *worker = args;
+    struct nv_kthread_q_multi *q_multi = worker->q_multi;
+    nv_kthread_q_item_t *q_item = NULL;
+    unsigned int i;
+
+    while (1) {
+        // As in _main_loop, down_interruptible (instead of down) is called
+        // here, in order to avoid being classified as a potentially hung
+        // task, by the kernel watchdog.
+        while (down_interruptible(&q_multi->q_sem))
+            NVQ_WARN("Interrupted during semaphore wait\n");
+
+        if (atomic_read(&q_multi->main_loop_should_exit))
+            break;
+
+        // The busy flag must be raised before claiming an item. A flusher
+        // learns about the claim through the flush item behind it on the
+        // same list, and the list lock orders this store before that, so by
+        // the time the flusher looks, it sees this worker as busy and waits
+        // for serviced_count to advance.
+        atomic_set(&worker->busy, 1);
+
+        // Local items first, then steal from the siblings:
+        q_item = _multi_worker_pop(worker);
+
+        for (i = 0; (q_item == NULL) && (i < q_multi->num_workers); i++)
+            q_item = _multi_worker_pop(&q_multi->workers[i]);
+
+        if (unlikely(q_item == NULL)) {
+            // A sibling claimed "our" item after we were woken, and the
+            // item backing the sibling's wakeup was added after our scan
+            // passed its list. The item is still pending, so return the
+            // semaphore count and retry. This is a transient race, not
+            // a bug.
+            atomic_set(&worker->busy, 0);
+
+            // A flusher may have sampled busy as raised during the empty
+            // scan and gone to sleep; wake it so it re-evaluates, just as
+            // the completion path below does.
+            wake_up_all(&q_multi->serviced_wq);
+            up(&q_multi->q_sem);
+            continue;
+        }
+
+        // Run the item
+        q_item->function_to_run(q_item->function_args);
+
+        // serviced_count must advance before busy is cleared, so that a
+        // flusher that saw this worker as busy is guaranteed to observe one
+        // of the two.
+        atomic_long_inc(&worker->serviced_count);
+        atomic_set(&worker->busy, 0);
+        wake_up_all(&q_multi->serviced_wq);
+
+        // Make debugging a little simpler by clearing this between runs:
+        q_item = NULL;
+    }
+
+    while (!kthread_should_stop())
+        schedule();
+
+    return 0;
+}
+
+int nv_kthread_q_multi_init_on_node(nv_kthread_q_multi_t *q_multi,
+                                    const char *qname,
+                                    unsigned int num_workers,
+                                    int preferred_node)
+{
+    unsigned int i;
+
+    if (num_workers == 0)
+        return -EINVAL;
+
+    if (num_workers > NV_KTHREAD_Q_MAX_WORKERS)
+        num_workers = NV_KTHREAD_Q_MAX_WORKERS;
+
+    memset(q_multi, 0, sizeof(*q_multi));
+
+    sema_init(&q_multi->q_sem, 0);
+    init_waitqueue_head(&q_multi->serviced_wq);
+    q_multi->num_workers = num_workers;
+
+    for (i = 0; i < num_workers; i++) {
+        struct nv_kthread_q_multi_worker *worker = &q_multi->workers[i];
+
+        INIT_LIST_HEAD(&worker->q_list_head);
+        spin_lock_init(&worker->q_lock);
+        worker->q_multi = q_multi;
+    }
+
+    for (i = 0; i < num_workers; i++) {
+        struct nv_kthread_q_multi_worker *worker = &q_multi->workers[i];
+        struct task_struct *thread;
+        char worker_name[TASK_COMM_LEN];
+
+        snprintf(worker_name, sizeof(worker_name), "%s/%u", qname, i);
+
+        if (preferred_node == NV_KTHREAD_NO_NODE) {
+            thread = kthread_create(_multi_main_loop, worker, worker_name);
+        }
+        else {
+            thread = thread_create_on_node(_multi_main_loop, worker,
+                                           preferred_node, worker_name);
+        }
+
+        if (IS_ERR(thread)) {
+            int err = PTR_ERR(thread);
+            unsigned int j;
+
+            // Stop the workers that did start. None of them has been woken
+            // up yet, so their lists are guaranteed to be empty.
+            atomic_set(&q_multi->main_loop_should_exit, 1);
+
+            for (j = 0; j < i; j++)
+                up(&q_multi->q_sem);
+
+            for (j = 0; j < i; j++) {
+                kthread_stop(q_multi->workers[j].q_kthread);
+                q_multi->workers[j].q_kthread = NULL;
+            }
+
+            // Clear num_workers before returning so that
+            // nv_kthread_q_multi_stop() can be safely called on it making
+            // error handling easier.
+            q_multi->num_workers = 0;
+
+            return err;
+        }
+
+        worker->q_kthread = thread;
+    }
+
+    for (i = 0; i < num_workers; i++)
+        wake_up_process(q_multi->workers[i].q_kthread);
+
+    return 0;
+}
+
+int nv_kthread_q_multi_init(nv_kthread_q_multi_t *q_multi,
+                            const char *qname,
+                            unsigned int num_workers)
+{
+    return nv_kthread_q_multi_init_on_node(q_multi, qname, num_workers,
+                                           NV_KTHREAD_NO_NODE);
+}
+
+// Returns true (non-zero) if the item was actually scheduled, and false if
+// the item was already pending in a queue.
+static int _raw_q_multi_schedule(struct nv_kthread_q_multi *q_multi,
+                                 struct nv_kthread_q_multi_worker *worker,
+                                 nv_kthread_q_item_t *q_item)
+{
+    unsigned long flags;
+    int ret = 1;
+
+    spin_lock_irqsave(&worker->q_lock, flags);
+
+    if (likely(list_empty(&q_item->q_list_node)))
+        list_add_tail(&q_item->q_list_node, &worker->q_list_head);
+    else
+        ret = 0;
+
+    spin_unlock_irqrestore(&worker->q_lock, flags);
+
+    if (likely(ret))
+        up(&q_multi->q_sem);
+
+    return ret;
+}
+
+int nv_kthread_q_multi_schedule_q_item(nv_kthread_q_multi_t *q_multi,
+                                       nv_kthread_q_item_t *q_item)
+{
+    unsigned int i;
+
+    if (unlikely(atomic_read(&q_multi->main_loop_should_exit))) {
+        NVQ_WARN("Not allowed: nv_kthread_q_multi_schedule_q_item was "
+                   "called with a non-alive q_multi: 0x%p\n", q_multi);
+        return 0;
+    }
+
+    i = (unsigned int)atomic_inc_return(&q_multi->next_worker) %
+        q_multi->num_workers;
+
+    return _raw_q_multi_schedule(q_multi, &q_multi->workers[i], q_item);
+}
+
+static void _raw_q_multi_flush(struct nv_kthread_q_multi *q_multi)
+{
+    nv_kthread_q_item_t q_items[NV_KTHREAD_Q_MAX_WORKERS];
+    struct completion completions[NV_KTHREAD_Q_MAX_WORKERS];
+    unsigned int i;
+
+    // Phase 1: put a flush item at the tail of every worker's list. Items
+    // come off each list in FIFO order no matter which worker does the
+    // popping, so once all of the flush items have run, every item that was
+    // pending before this flush has been claimed by some worker.
+    for (i = 0; i < q_multi->num_workers; i++) {
+        init_completion(&completions[i]);
+
+        nv_kthread_q_item_init(&q_items[i], _q_flush_function,
+                               &completions[i]);
+
+        _raw_q_multi_schedule(q_multi, &q_multi->workers[i], &q_items[i]);
+    }
+
+    for (i = 0; i < q_multi->num_workers; i++)
+        wait_for_completion(&completions[i]);
+
+    // Phase 2: a claimed item may still be running, possibly on a worker
+    // other than the one whose list it was claimed from. Each worker runs
+    // its items serially, so it is enough to wait, for each worker that is
+    // mid-item, until that item finishes. Any item the worker picks up
+    // after that was claimed after phase 1, and so is not covered by this
+    // flush.
+    for (i = 0; i < q_multi->num_workers; i++) {
+        struct nv_kthread_q_multi_worker *worker = &q_multi->workers[i];
+        long serviced = atomic_long_read(&worker->serviced_count);
+
+        if (!atomic_read(&worker->busy))
+            continue;
+
+        // The busy flag may be raised again for items that postdate this
+        // flush, but serviced_count only ever advances, so this condition
+        // becomes (and stays) true as soon as the worker's current item
+        // completes.
+        wait_event(q_multi->serviced_wq,
+                   (atomic_long_read(&worker->serviced_count) != serviced) ||
+                   !atomic_read(&worker->busy));
+    }
+}
+
+void nv_kthread_q_multi_flush(nv_kthread_q_multi_t *q_multi)
+{
+    if (unlikely(atomic_read(&q_multi->main_loop_should_exit))) {
+        NVQ_WARN("Not allowed: nv_kthread_q_multi_flush was called after "
+                   "nv_kthread_q_multi_stop. q_multi: 0x%p\n", q_multi);
+        return;
+    }
+
+    // Same 2x flush as nv_kthread_q_flush, and for the same reason: the
+    // first flush waits for any callbacks that missed seeing the caller's
+    // "stop rescheduling" flag, and the second flush waits for callbacks
+    // that were already scheduled when the first flush finished.
+    _raw_q_multi_flush(q_multi);
+    _raw_q_multi_flush(q_multi);
+}
+
+void nv_kthread_q_multi_stop(nv_kthread_q_multi_t *q_multi)
+{
+    unsigned int i;
+
+    // check if the queue has been properly initialized
+    if (unlikely(q_multi->num_workers == 0) ||
+        unlikely(!q_multi->workers[0].q_kthread))
+        return;
+
+    nv_kthread_q_multi_flush(q_multi);
+
+    // If this assertion fires, then a caller likely either broke the API
+    // rules, by adding items after calling nv_kthread_q_multi_stop, or
+    // possibly messed up with inadequate flushing of self-rescheduling
+    // q_items.
+    for (i = 0; i < q_multi->num_workers; i++) {
+        if (unlikely(!list_empty(&q_multi->workers[i].q_list_head)))
+            NVQ_WARN("list not empty after flushing\n");
+    }
+
+    if (likely(!atomic_read(&q_multi->main_loop_should_exit))) {
+
+        atomic_set(&q_multi->main_loop_should_exit, 1);
+
+        // Wake up each worker once, so that every one of them can see that
+        // it needs to stop:
+        for (i = 0; i < q_multi->num_workers; i++)
+            up(&q_multi->q_sem);
+
+        for (i = 0; i < q_multi->num_workers; i++) {
+            kthread_stop(q_multi->workers[i].q_kthread);
+            q_multi->workers[i].q_kthread = NULL;
+        }
+    }
+}
@@ -581,6 +581,29 @@ void nvkms_call_rm(void *ops)
     __rm_ops.free_stack(stack);
 }
 
+void nvkms_call_rm_batch(void *ops, NvU32 opCount, size_t opStride)
+{
+    nvidia_modeset_stack_ptr stack = NULL;
+    NvU8 *op = ops;
+    NvU32 i;
+
+    if (__rm_ops.alloc_stack(&stack) != 0) {
+        return;
+    }
+
+    /*
+     * Submit the whole array of operations with a single altstack
+     * allocation, rather than paying for one per operation as repeated
+     * nvkms_call_rm() calls would.
+     */
+    for (i = 0; i < opCount; i++) {
+        __rm_ops.op(stack, op);
+        op += opStride;
+    }
+
+    __rm_ops.free_stack(stack);
+}
+
 /*************************************************************************
  * ref_ptr implementation.
  *************************************************************************/
@@ -1194,6 +1217,16 @@ int nvkms_ioctl_common
     int status;
     NvBool ret;
 
+    /*
+     * Some requests (currently event queue draining) can be handled
+     * without taking the nvkms_lock, so that event-heavy clients don't
+     * extend lock hold times seen by everyone else.
+     */
+    if (popen->data != NULL &&
+        nvKmsIoctlLockless(popen->data, cmd, address, size, &ret)) {
+        return ret ? 0 : -EPERM;
+    }
+
     status = down_interruptible(&nvkms_lock);
     if (status != 0) {
         return status;
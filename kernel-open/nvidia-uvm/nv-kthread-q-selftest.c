@@ -302,6 +302,143 @@ failed:
     return -1;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+// Multi-worker queue test
+
+typedef struct multi_worker_args
+{
+    nv_kthread_q_multi_t *test_q_multi;
+    atomic_t             *test_wide_accumulator;
+    atomic_t              per_thread_accumulator;
+} multi_worker_args_t;
+
+static void _multi_worker_callback(void *args)
+{
+    multi_worker_args_t *multi_worker_args = (multi_worker_args_t*)(args);
+    atomic_inc(multi_worker_args->test_wide_accumulator);
+    atomic_inc(&multi_worker_args->per_thread_accumulator);
+}
+
+//
+// Return values:
+// 0:        Success
+// -ENOMEM:  vmalloc failed
+// -EINVAL:  test failed due to mismatched accumulator counts
+//
+static int _multi_worker_q_kthread_function(void *args)
+{
+    int i, was_scheduled;
+    int result = 0;
+    int per_thread_count;
+    multi_worker_args_t *multi_worker_args = (multi_worker_args_t*)args;
+    nv_kthread_q_item_t *q_items;
+    size_t alloc_size = NUM_TEST_Q_ITEMS * sizeof(nv_kthread_q_item_t);
+
+    q_items = vmalloc(alloc_size);
+    if (!q_items) {
+        result = -ENOMEM;
+        goto done;
+    }
+
+    memset(q_items, 0, alloc_size);
+
+    for (i = 0; i < NUM_TEST_Q_ITEMS; ++i) {
+        nv_kthread_q_item_init(&q_items[i],
+                               _multi_worker_callback,
+                               multi_worker_args);
+
+        was_scheduled = nv_kthread_q_multi_schedule_q_item(
+                            multi_worker_args->test_q_multi,
+                            &q_items[i]);
+        result |= (!was_scheduled);
+    }
+
+    // The flush must cover items that were stolen by, and are still running
+    // on, other workers. The q_items live on this thread's stack (via
+    // vmalloc), so any use of an item after the flush returns would show up
+    // as corruption.
+    nv_kthread_q_multi_flush(multi_worker_args->test_q_multi);
+
+    per_thread_count = atomic_read(&multi_worker_args->per_thread_accumulator);
+    if (per_thread_count != NUM_TEST_Q_ITEMS) {
+        NVQ_TEST_PRINT("per_thread_count: Expected: %d, actual: %d\n",
+                       NUM_TEST_Q_ITEMS, per_thread_count);
+        result = -EINVAL;
+    }
+
+done:
+    if (q_items)
+        vfree(q_items);
+
+    while (!kthread_should_stop())
+        schedule();
+
+    return result;
+}
+
+static int _multi_worker_q_test(void)
+{
+    int i, j;
+    int result = 0;
+    struct task_struct *kthreads[NUM_TEST_KTHREADS];
+    multi_worker_args_t multi_worker_args[NUM_TEST_KTHREADS];
+    nv_kthread_q_multi_t local_q_multi;
+    atomic_t local_accumulator;
+
+    memset(multi_worker_args, 0, sizeof(multi_worker_args));
+    memset(kthreads, 0, sizeof(kthreads));
+    atomic_set(&local_accumulator, 0);
+
+    // Do a redundant stop to ensure stop is supported on zero initialized
+    // memory. No crash should occur
+    memset(&local_q_multi, 0, sizeof(local_q_multi));
+    nv_kthread_q_multi_stop(&local_q_multi);
+
+    // Zero workers must be rejected:
+    TEST_CHECK_RET(nv_kthread_q_multi_init(&local_q_multi, "mw_test_q", 0)
+                   != 0);
+
+    result = nv_kthread_q_multi_init(&local_q_multi, "mw_test_q",
+                                     NV_KTHREAD_Q_MAX_WORKERS);
+    TEST_CHECK_RET(result == 0);
+
+    for (i = 0; i < NUM_TEST_KTHREADS; ++i) {
+        multi_worker_args[i].test_q_multi          = &local_q_multi;
+        multi_worker_args[i].test_wide_accumulator = &local_accumulator;
+
+        kthreads[i] = kthread_run(_multi_worker_q_kthread_function,
+                                  &multi_worker_args[i],
+                                  "nvq_test_kthread");
+
+        if (IS_ERR(kthreads[i]))
+            goto failed;
+    }
+
+    // Stop all of the test kthreads, then stop the queue. Collect any
+    // non-zero (failure) return values from the kthreads, and use those
+    // later to report a test failure.
+    for (i = 0; i < NUM_TEST_KTHREADS; ++i) {
+        result |= kthread_stop(kthreads[i]);
+    }
+
+    nv_kthread_q_multi_stop(&local_q_multi);
+
+    TEST_CHECK_RET(atomic_read(&local_accumulator) ==
+                   NUM_Q_ITEMS_IN_MULTITHREAD_TEST);
+    return result;
+
+failed:
+    NVQ_TEST_PRINT("kthread_run[%d] failed: errno: %ld\n",
+                   i, PTR_ERR(kthreads[i]));
+
+    // Stop any threads that had successfully started:
+    for (j = 0; j < i; ++j)
+        kthread_stop(kthreads[j]);
+
+    nv_kthread_q_multi_stop(&local_q_multi);
+    return -1;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // Self-rescheduling test
 
@@ -557,6 +694,9 @@ int nv_kthread_q_run_self_test(void)
     result = _multithreaded_q_test();
     TEST_CHECK_RET(result == 0);
 
+    result = _multi_worker_q_test();
+    TEST_CHECK_RET(result == 0);
+
     result = _same_q_item_test();
     TEST_CHECK_RET(result == 0);
 
@@ -451,6 +451,34 @@ static NV_STATUS ats_compute_prefetch(uvm_gpu_va_space_t *gpu_va_space,
     return status;
 }
 
+// Decide whether a fault mask should be serviced with a single call covering
+// its bounding region instead of one call per contiguous run. Only worth it
+// when that would actually merge calls and most pages in the bounding region
+// faulted anyway. The gap pages get populated like prefetched pages, and
+// skip_mapped in service_ats_requests() makes already-mapped gap pages cheap
+// to skip.
+static bool ats_coalesce_fault_region(const uvm_page_mask_t *fault_mask, uvm_va_block_region_t *region_out)
+{
+    uvm_va_block_region_t region;
+    NvU32 fault_count;
+
+    if (uvm_page_mask_empty(fault_mask))
+        return false;
+
+    region = uvm_va_block_region_from_mask(NULL, fault_mask);
+    fault_count = uvm_page_mask_region_weight(fault_mask, region);
+
+    // A single contiguous run is one call already.
+    if (fault_count == uvm_va_block_region_num_pages(region))
+        return false;
+
+    if (2 * fault_count < uvm_va_block_region_num_pages(region))
+        return false;
+
+    *region_out = region;
+    return true;
+}
+
 NV_STATUS uvm_ats_service_faults(uvm_gpu_va_space_t *gpu_va_space,
                                  struct vm_area_struct *vma,
                                  NvU64 base,
@@ -503,7 +531,12 @@ NV_STATUS uvm_ats_service_faults(uvm_gpu_va_space_t *gpu_va_space,
 
     ats_compute_prefetch(gpu_va_space, vma, base, service_type, ats_context);
 
-    for_each_va_block_subregion_in_mask(subregion, write_fault_mask, region) {
+    // When the faulted pages are dense within their bounding region, service
+    // that whole region with one populate call instead of one call per
+    // contiguous run of faults. Only the pages which actually faulted are
+    // marked as serviced; the gap pages are merely populated, like prefetched
+    // pages.
+    if (ats_coalesce_fault_region(write_fault_mask, &subregion)) {
         NvU64 start = base + (subregion.first * PAGE_SIZE);
         size_t length = uvm_va_block_region_num_pages(subregion) * PAGE_SIZE;
         uvm_fault_access_type_t access_type = (vma->vm_flags & VM_WRITE) ?
@@ -518,50 +551,102 @@ NV_STATUS uvm_ats_service_faults(uvm_gpu_va_space_t *gpu_va_space,
             return status;
 
         if (vma->vm_flags & VM_WRITE) {
-            uvm_page_mask_region_fill(faults_serviced_mask, subregion);
+            uvm_page_mask_or(faults_serviced_mask, faults_serviced_mask, write_fault_mask);
             uvm_ats_smmu_invalidate_tlbs(gpu_va_space, start, length);
 
-            // The Linux kernel never invalidates TLB entries on mapping
-            // permission upgrade. This is a problem if the GPU has cached
-            // entries with the old permission. The GPU will re-fetch the entry
-            // if the PTE is invalid and page size is not 4K (this is the case
-            // on P9). However, if a page gets upgraded from R/O to R/W and GPU
-            // has the PTEs cached with R/O permissions we will enter an
-            // infinite loop because we just forward the fault to the Linux
-            // kernel and it will see that the permissions in the page table are
-            // correct. Therefore, we flush TLB entries on ATS write faults.
+            // See the comment on TLB flushing for write faults below.
             flush_tlb_va_region(gpu_va_space, start, length, client_type);
         }
         else {
-            uvm_page_mask_region_fill(reads_serviced_mask, subregion);
+            uvm_page_mask_or(reads_serviced_mask, reads_serviced_mask, write_fault_mask);
+        }
+    }
+    else {
+        for_each_va_block_subregion_in_mask(subregion, write_fault_mask, region) {
+            NvU64 start = base + (subregion.first * PAGE_SIZE);
+            size_t length = uvm_va_block_region_num_pages(subregion) * PAGE_SIZE;
+            uvm_fault_access_type_t access_type = (vma->vm_flags & VM_WRITE) ?
+                                                                              UVM_FAULT_ACCESS_TYPE_WRITE :
+                                                                              UVM_FAULT_ACCESS_TYPE_READ;
+
+            UVM_ASSERT(start >= vma->vm_start);
+            UVM_ASSERT((start + length) <= vma->vm_end);
+
+            status = service_ats_requests(gpu_va_space, vma, start, length, access_type, service_type, ats_context);
+            if (status != NV_OK)
+                return status;
+
+            if (vma->vm_flags & VM_WRITE) {
+                uvm_page_mask_region_fill(faults_serviced_mask, subregion);
+                uvm_ats_smmu_invalidate_tlbs(gpu_va_space, start, length);
+
+                // The Linux kernel never invalidates TLB entries on mapping
+                // permission upgrade. This is a problem if the GPU has cached
+                // entries with the old permission. The GPU will re-fetch the
+                // entry if the PTE is invalid and page size is not 4K (this is
+                // the case on P9). However, if a page gets upgraded from R/O
+                // to R/W and GPU has the PTEs cached with R/O permissions we
+                // will enter an infinite loop because we just forward the
+                // fault to the Linux kernel and it will see that the
+                // permissions in the page table are correct. Therefore, we
+                // flush TLB entries on ATS write faults.
+                flush_tlb_va_region(gpu_va_space, start, length, client_type);
+            }
+            else {
+                uvm_page_mask_region_fill(reads_serviced_mask, subregion);
+            }
         }
     }
 
     // Remove write faults from read_fault_mask
     uvm_page_mask_andnot(read_fault_mask, read_fault_mask, write_fault_mask);
 
-    for_each_va_block_subregion_in_mask(subregion, read_fault_mask, region) {
+    if (ats_coalesce_fault_region(read_fault_mask, &subregion)) {
         NvU64 start = base + (subregion.first * PAGE_SIZE);
         size_t length = uvm_va_block_region_num_pages(subregion) * PAGE_SIZE;
-        uvm_fault_access_type_t access_type = UVM_FAULT_ACCESS_TYPE_READ;
 
         UVM_ASSERT(start >= vma->vm_start);
         UVM_ASSERT((start + length) <= vma->vm_end);
 
-        status = service_ats_requests(gpu_va_space, vma, start, length, access_type, service_type, ats_context);
+        status = service_ats_requests(gpu_va_space,
+                                      vma,
+                                      start,
+                                      length,
+                                      UVM_FAULT_ACCESS_TYPE_READ,
+                                      service_type,
+                                      ats_context);
         if (status != NV_OK)
             return status;
 
-        uvm_page_mask_region_fill(faults_serviced_mask, subregion);
+        uvm_page_mask_or(faults_serviced_mask, faults_serviced_mask, read_fault_mask);
 
-        // Similarly to permission upgrade scenario, discussed above, GPU
-        // will not re-fetch the entry if the PTE is invalid and page size
-        // is 4K. To avoid infinite faulting loop, invalidate TLB for every
-        // new translation written explicitly like in the case of permission
-        // upgrade.
+        // See the comment on TLB flushing for read faults below.
         if (PAGE_SIZE == UVM_PAGE_SIZE_4K)
             flush_tlb_va_region(gpu_va_space, start, length, client_type);
+    }
+    else {
+        for_each_va_block_subregion_in_mask(subregion, read_fault_mask, region) {
+            NvU64 start = base + (subregion.first * PAGE_SIZE);
+            size_t length = uvm_va_block_region_num_pages(subregion) * PAGE_SIZE;
+            uvm_fault_access_type_t access_type = UVM_FAULT_ACCESS_TYPE_READ;
 
+            UVM_ASSERT(start >= vma->vm_start);
+            UVM_ASSERT((start + length) <= vma->vm_end);
+
+            status = service_ats_requests(gpu_va_space, vma, start, length, access_type, service_type, ats_context);
+            if (status != NV_OK)
+                return status;
+
+            uvm_page_mask_region_fill(faults_serviced_mask, subregion);
+
+            // Similarly to permission upgrade scenario, discussed above, GPU
+            // will not re-fetch the entry if the PTE is invalid and page size
+            // is 4K. To avoid infinite faulting loop, invalidate TLB for every
+            // new translation written explicitly like in the case of
+            // permission upgrade.
+            if (PAGE_SIZE == UVM_PAGE_SIZE_4K)
+                flush_tlb_va_region(gpu_va_space, start, length, client_type);
+        }
     }
 
     return status;
@@ -296,6 +296,24 @@ static bool try_claim_channel(uvm_channel_t *channel, NvU32 num_gpfifo_entries)
     return claimed;
 }
 
+// Racy estimate of whether the channel has any available GPFIFO entries. Used
+// as a lock-free pre-check to skip channels that appear full without
+// serializing on the pool lock. The claim itself re-checks availability under
+// the lock, so a stale result only costs a skipped channel or a failed claim.
+static bool channel_may_have_available_gpfifo_entries(uvm_channel_t *channel)
+{
+    NvU32 cpu_put = UVM_READ_ONCE(channel->cpu_put);
+    NvU32 gpu_get = UVM_READ_ONCE(channel->gpu_get);
+    NvU32 used = UVM_READ_ONCE(channel->current_gpfifo_count) + 1;
+
+    if (cpu_put >= gpu_get)
+        used += cpu_put - gpu_get;
+    else
+        used += cpu_put + channel->num_gpfifo_entries - gpu_get;
+
+    return used < channel->num_gpfifo_entries;
+}
+
 static void unlock_channel_for_push(uvm_channel_t *channel)
 {
     NvU32 index;
@@ -530,14 +548,28 @@ static NV_STATUS channel_reserve_in_pool(uvm_channel_pool_t *pool, uvm_channel_t
 {
     uvm_channel_t *channel;
     uvm_spin_loop_t spin;
+    NvU32 start;
+    NvU32 i;
 
     UVM_ASSERT(pool);
 
     if (g_uvm_global.conf_computing_enabled)
         return channel_reserve_and_lock_in_pool(pool, channel_out);
 
-    uvm_for_each_channel_in_pool(channel, pool) {
+    // There are too few channels per pool to give each CPU its own, so each
+    // CPU instead gets a preferred starting channel, and steals from the rest
+    // of the pool on wraparound. Combined with the lock-free full-channel
+    // pre-check this spreads concurrent reservations across the pool instead
+    // of convoying them all on the first available channel.
+    start = raw_smp_processor_id() % pool->num_channels;
+
+    for (i = 0; i < pool->num_channels; i++) {
+        channel = &pool->channels[(start + i) % pool->num_channels];
+
         // TODO: Bug 1764953: Prefer idle/less busy channels
+        if (!channel_may_have_available_gpfifo_entries(channel))
+            continue;
+
         if (try_claim_channel(channel, 1)) {
             *channel_out = channel;
             return NV_OK;
@@ -580,6 +612,47 @@ NV_STATUS uvm_channel_reserve_type(uvm_channel_manager_t *manager, uvm_channel_t
     return channel_reserve_in_pool(pool, channel_out);
 }
 
+NV_STATUS uvm_channel_reserve_type_stripe(uvm_channel_manager_t *manager,
+                                          uvm_channel_type_t type,
+                                          NvU32 stripe,
+                                          uvm_channel_t **channel_out)
+{
+    uvm_channel_pool_t *pool;
+    uvm_channel_pool_t *selected_pool = NULL;
+    unsigned num_ce_pools = 0;
+    unsigned selected_index;
+
+    UVM_ASSERT(type < UVM_CHANNEL_TYPE_COUNT);
+
+    // In Confidential Computing the pool assigned to each channel type is part
+    // of the encryption setup, so striping across pools is not attempted.
+    // Proxy pools (SR-IOV heavy) are likewise excluded; those types keep their
+    // default pool.
+    if (g_uvm_global.conf_computing_enabled ||
+        manager->pool_to_use.default_for_type[type]->pool_type != UVM_CHANNEL_POOL_TYPE_CE)
+        return uvm_channel_reserve_type(manager, type, channel_out);
+
+    uvm_for_each_pool_of_type(pool, manager, UVM_CHANNEL_POOL_TYPE_CE)
+        num_ce_pools++;
+
+    UVM_ASSERT(num_ce_pools > 0);
+
+    selected_index = stripe % num_ce_pools;
+
+    uvm_for_each_pool_of_type(pool, manager, UVM_CHANNEL_POOL_TYPE_CE) {
+        if (selected_index == 0) {
+            selected_pool = pool;
+            break;
+        }
+
+        selected_index--;
+    }
+
+    UVM_ASSERT(selected_pool != NULL);
+
+    return channel_reserve_in_pool(selected_pool, channel_out);
+}
+
 NV_STATUS uvm_channel_reserve_gpu_to_gpu(uvm_channel_manager_t *manager,
                                          uvm_gpu_t *dst_gpu,
                                          uvm_channel_t **channel_out)
@@ -658,6 +658,15 @@ NV_STATUS uvm_channel_reserve_type(uvm_channel_manager_t *manager,
                                    uvm_channel_type_t type,
                                    uvm_channel_t **channel_out);
 
+// Select and reserve a channel with the specified type for a push, spreading
+// consecutive stripe values across all CE channel pools. Falls back to
+// uvm_channel_reserve_type() when striping does not apply (Confidential
+// Computing, or the type is not served by a CE pool).
+NV_STATUS uvm_channel_reserve_type_stripe(uvm_channel_manager_t *manager,
+                                          uvm_channel_type_t type,
+                                          NvU32 stripe,
+                                          uvm_channel_t **channel_out);
+
 // Select and reserve a channel for a transfer from channel_manager->gpu to
 // dst_gpu.
 NV_STATUS uvm_channel_reserve_gpu_to_gpu(uvm_channel_manager_t *channel_manager,
@@ -25,6 +25,7 @@
 #define __UVM_FORWARD_DECL_H__
 
 typedef struct uvm_global_struct uvm_global_t;
+typedef struct uvm_procfs_counters_struct uvm_procfs_counters_t;
 
 typedef struct uvm_gpu_struct uvm_gpu_t;
 typedef struct uvm_parent_gpu_struct uvm_parent_gpu_t;
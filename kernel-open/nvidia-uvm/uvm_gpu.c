@@ -537,6 +537,12 @@ static void gpu_info_print_common(uvm_gpu_t *gpu, struct seq_file *s)
     if (gpu->parent->isr.replayable_faults.handling) {
         UVM_SEQ_OR_DBG_PRINT(s, "replayable_faults_bh                   %llu\n",
                              gpu->parent->isr.replayable_faults.stats.bottom_half_count);
+        UVM_SEQ_OR_DBG_PRINT(s, "replayable_faults_bh_coalesced         %llu\n",
+                             gpu->parent->isr.replayable_faults.stats.coalesced_pass_count);
+        UVM_SEQ_OR_DBG_PRINT(s, "replayable_faults_coalesce_poll_usec   %u\n",
+                             uvm_perf_fault_coalesce_poll_usec);
+        UVM_SEQ_OR_DBG_PRINT(s, "replayable_faults_coalesce_max_passes  %u\n",
+                             uvm_perf_fault_coalesce_max_passes);
         UVM_SEQ_OR_DBG_PRINT(s, "replayable_faults_bh/cpu\n");
         for_each_cpu(cpu, &gpu->parent->isr.replayable_faults.stats.cpus_used_mask) {
             UVM_SEQ_OR_DBG_PRINT(s, "    cpu%02u                              %llu\n",
@@ -679,16 +685,20 @@ static void gpu_access_counters_print_common(uvm_parent_gpu_t *parent_gpu, struc
 {
     NvU64 num_pages_in;
     NvU64 num_pages_out;
+    NvU64 num_pages_throttled;
 
     UVM_ASSERT(uvm_procfs_is_debug_enabled());
 
     num_pages_out = atomic64_read(&parent_gpu->access_counter_buffer_info.stats.num_pages_out);
     num_pages_in = atomic64_read(&parent_gpu->access_counter_buffer_info.stats.num_pages_in);
+    num_pages_throttled = atomic64_read(&parent_gpu->access_counter_buffer_info.migration_rate_limit.num_pages_throttled);
     UVM_SEQ_OR_DBG_PRINT(s, "migrations:\n");
     UVM_SEQ_OR_DBG_PRINT(s, "  num_pages_in         %llu (%llu MB)\n", num_pages_in,
                          (num_pages_in * (NvU64)PAGE_SIZE) / (1024u * 1024u));
     UVM_SEQ_OR_DBG_PRINT(s, "  num_pages_out        %llu (%llu MB)\n", num_pages_out,
                          (num_pages_out * (NvU64)PAGE_SIZE) / (1024u * 1024u));
+    UVM_SEQ_OR_DBG_PRINT(s, "  num_pages_throttled  %llu (%llu MB)\n", num_pages_throttled,
+                         (num_pages_throttled * (NvU64)PAGE_SIZE) / (1024u * 1024u));
 }
 
 void uvm_gpu_print(uvm_gpu_t *gpu)
@@ -809,6 +819,21 @@ static void deinit_parent_procfs_dir(uvm_parent_gpu_t *parent_gpu)
 
 static NV_STATUS init_parent_procfs_files(uvm_parent_gpu_t *parent_gpu)
 {
+    if (!uvm_procfs_is_enabled())
+        return NV_OK;
+
+    // The binary counters page is always created so production telemetry does
+    // not depend on debug procfs.
+    parent_gpu->counters = uvm_procfs_counters_alloc();
+    if (parent_gpu->counters == NULL)
+        return NV_ERR_NO_MEMORY;
+
+    parent_gpu->procfs.counters_file = uvm_procfs_counters_create_file("counters_bin",
+                                                                       parent_gpu->procfs.dir,
+                                                                       parent_gpu->counters);
+    if (parent_gpu->procfs.counters_file == NULL)
+        return NV_ERR_OPERATING_SYSTEM;
+
     // Fault and access counter files are debug only
     if (!uvm_procfs_is_debug_enabled())
         return NV_OK;
@@ -834,6 +859,9 @@ static void deinit_parent_procfs_files(uvm_parent_gpu_t *parent_gpu)
 {
     proc_remove(parent_gpu->procfs.access_counters_file);
     proc_remove(parent_gpu->procfs.fault_stats_file);
+    proc_remove(parent_gpu->procfs.counters_file);
+    uvm_procfs_counters_free(parent_gpu->counters);
+    parent_gpu->counters = NULL;
 }
 
 static NV_STATUS init_procfs_dirs(uvm_gpu_t *gpu)
@@ -1746,18 +1774,23 @@ static void update_stats_parent_gpu_fault_instance(uvm_parent_gpu_t *parent_gpu,
                                                    const uvm_fault_buffer_entry_t *fault_entry,
                                                    bool is_duplicate)
 {
+    uvm_procfs_counters_t *counters = parent_gpu->counters;
+
     if (!fault_entry->is_replayable) {
         switch (fault_entry->fault_access_type)
         {
             case UVM_FAULT_ACCESS_TYPE_READ:
                 ++parent_gpu->fault_buffer_info.non_replayable.stats.num_read_faults;
+                uvm_procfs_counter_inc(counters, non_replayable_read_faults);
                 break;
             case UVM_FAULT_ACCESS_TYPE_WRITE:
                 ++parent_gpu->fault_buffer_info.non_replayable.stats.num_write_faults;
+                uvm_procfs_counter_inc(counters, non_replayable_write_faults);
                 break;
             case UVM_FAULT_ACCESS_TYPE_ATOMIC_WEAK:
             case UVM_FAULT_ACCESS_TYPE_ATOMIC_STRONG:
                 ++parent_gpu->fault_buffer_info.non_replayable.stats.num_atomic_faults;
+                uvm_procfs_counter_inc(counters, non_replayable_atomic_faults);
                 break;
             default:
                 UVM_ASSERT_MSG(false, "Invalid access type for non-replayable faults\n");
@@ -1778,22 +1811,28 @@ static void update_stats_parent_gpu_fault_instance(uvm_parent_gpu_t *parent_gpu,
     {
         case UVM_FAULT_ACCESS_TYPE_PREFETCH:
             ++parent_gpu->fault_buffer_info.replayable.stats.num_prefetch_faults;
+            uvm_procfs_counter_inc(counters, replayable_prefetch_faults);
             break;
         case UVM_FAULT_ACCESS_TYPE_READ:
             ++parent_gpu->fault_buffer_info.replayable.stats.num_read_faults;
+            uvm_procfs_counter_inc(counters, replayable_read_faults);
             break;
         case UVM_FAULT_ACCESS_TYPE_WRITE:
             ++parent_gpu->fault_buffer_info.replayable.stats.num_write_faults;
+            uvm_procfs_counter_inc(counters, replayable_write_faults);
             break;
         case UVM_FAULT_ACCESS_TYPE_ATOMIC_WEAK:
         case UVM_FAULT_ACCESS_TYPE_ATOMIC_STRONG:
             ++parent_gpu->fault_buffer_info.replayable.stats.num_atomic_faults;
+            uvm_procfs_counter_inc(counters, replayable_atomic_faults);
             break;
         default:
             break;
     }
-    if (is_duplicate || fault_entry->filtered)
+    if (is_duplicate || fault_entry->filtered) {
         ++parent_gpu->fault_buffer_info.replayable.stats.num_duplicate_faults;
+        uvm_procfs_counter_inc(counters, replayable_duplicate_faults);
+    }
 
     ++parent_gpu->stats.num_replayable_faults;
 }
@@ -1864,8 +1903,13 @@ static void update_stats_migration_cb(uvm_perf_event_t event_id, uvm_perf_event_
             atomic64_add(pages, &gpu_dst->parent->fault_buffer_info.non_replayable.stats.num_pages_in);
         else if (is_access_counter)
             atomic64_add(pages, &gpu_dst->parent->access_counter_buffer_info.stats.num_pages_in);
+
+        uvm_procfs_counter_add(gpu_dst->parent->counters, migrated_bytes_in, event_data->migration.bytes);
+        if (event_data->migration.make_resident_context->cause == UVM_MAKE_RESIDENT_CAUSE_PREFETCH)
+            uvm_procfs_counter_add(gpu_dst->parent->counters, prefetched_bytes_in, event_data->migration.bytes);
     }
     if (gpu_src) {
+        uvm_procfs_counter_add(gpu_src->parent->counters, migrated_bytes_out, event_data->migration.bytes);
         atomic64_add(pages, &gpu_src->parent->stats.num_pages_out);
         if (is_replayable_fault)
             atomic64_add(pages, &gpu_src->parent->fault_buffer_info.replayable.stats.num_pages_out);
@@ -170,6 +170,19 @@ struct uvm_service_block_context_struct
         // servicing. We need one mask per processor because we may coalesce
         // faults that trigger migrations to different processors.
         uvm_page_mask_t new_residency;
+
+        // Pages that changed residency in the copy step for this processor.
+        // Only used when multiple residency destinations are serviced in the
+        // same batch: the copy steps for all destinations are issued before
+        // any of the finish steps, so the single copy result masks in
+        // make_resident are saved here across the copy steps. See
+        // uvm_va_block_service_locked().
+        uvm_page_mask_t did_migrate;
+
+        // Saved copy of make_resident.pages_migrated for this processor. As
+        // with did_migrate, only used when multiple residency destinations
+        // are serviced in the same batch.
+        uvm_page_mask_t migrated;
     } per_processor_masks[UVM_ID_MAX_PROCESSORS];
 
     // State used by the VA block routines called by the servicing routine
@@ -301,6 +314,15 @@ struct uvm_fault_service_batch_context_struct
 
     // Last fetched fault. Used for fault filtering.
     uvm_fault_buffer_entry_t *last_fault;
+
+    // True while the batch is being serviced by the parallel fault service
+    // workers. Updates of the shared counters and flags above must be done
+    // under lock, below, while this is set.
+    bool parallel;
+
+    // Lock protecting the shared counters and flags in this structure when
+    // the batch is serviced in parallel
+    uvm_spinlock_t lock;
 };
 
 struct uvm_ats_fault_invalidate_struct
@@ -309,6 +331,51 @@ struct uvm_ats_fault_invalidate_struct
     uvm_tlb_batch_t tlb_batch;
 };
 
+// A group of consecutive entries in the ordered fault cache which all fall
+// within the same VA block. Used to hand work to the parallel fault service
+// workers.
+typedef struct
+{
+    uvm_va_block_t *va_block;
+
+    NvU32 first_fault_index;
+} uvm_fault_service_block_group_t;
+
+// State for one parallel fault service worker thread. Workers are only active
+// while the bottom half dispatcher is blocked flushing their queues, see
+// service_fault_batch_parallel() in uvm_gpu_replayable_faults.c.
+typedef struct
+{
+    nv_kthread_q_t queue;
+
+    nv_kthread_q_item_t q_item;
+
+    uvm_gpu_t *gpu;
+
+    // Batch currently being serviced. Only valid while the worker has been
+    // scheduled by the dispatcher.
+    uvm_fault_service_batch_context_t *batch_context;
+
+    // VA block fault groups from the current batch assigned to this worker.
+    // The array is replayable.max_faults entries long, since in the worst
+    // case every fault in the buffer lands in a different VA block.
+    uvm_fault_service_block_group_t *groups;
+
+    NvU32 num_groups;
+
+    // Structure used to coalesce fault servicing in a VA block, private to
+    // this worker
+    uvm_service_block_context_t service_context;
+
+    // Tracker holding the work pushed by this worker for the current batch.
+    // Merged into the batch tracker by the dispatcher after all workers have
+    // been flushed.
+    uvm_tracker_t tracker;
+
+    // First error hit by this worker in the current batch
+    NV_STATUS status;
+} uvm_fault_service_worker_t;
+
 typedef struct
 {
     // Fault buffer information and structures provided by RM
@@ -369,6 +436,36 @@ typedef struct
             NvU64 num_replays_ack_all;
         } stats;
 
+        // Fault servicing latency statistics, exposed to user space via
+        // UVM_TEST_PERF_FAULT_LATENCY. Only updated from the fault servicing
+        // bottom half, and read/reset under the replayable faults ISR lock.
+        // The per-stage accumulators only cover the time spent in each stage
+        // at the top level of the service loop, so nested tracker waits within
+        // batch servicing are accounted to the servicing stage.
+        struct
+        {
+            NvU64 num_batches;
+
+            NvU64 num_faults;
+
+            // Total time spent fetching and preprocessing fault buffer entries
+            NvU64 fetch_ns;
+
+            // Total time spent servicing ordered fault batches
+            NvU64 service_ns;
+
+            // Total time spent issuing replays and flushing the fault buffer
+            NvU64 replay_ns;
+
+            // Total time spent waiting on the batch tracker before fault
+            // cancellation and after batch-flush replays
+            NvU64 tracker_wait_ns;
+
+            // Histogram of end-to-end batch servicing latency. See
+            // UVM_FAULT_BATCH_LATENCY_HISTOGRAM_BINS.
+            NvU64 batch_latency_hist[UVM_FAULT_BATCH_LATENCY_HISTOGRAM_BINS];
+        } latency_stats;
+
         // Number of uTLBs in the chip
         NvU32 utlb_count;
 
@@ -380,6 +477,17 @@ typedef struct
 
         // Information required to invalidate stale ATS PTEs from the GPU TLBs
         uvm_ats_fault_invalidate_t ats_invalidate;
+
+        // Parallel fault servicing. When num_workers is not zero, batches of
+        // independent VA block fault groups may be serviced concurrently on
+        // the worker threads below instead of inline on the bottom half. See
+        // uvm_perf_fault_parallel_workers in uvm_gpu_replayable_faults.c.
+        struct
+        {
+            NvU32 num_workers;
+
+            uvm_fault_service_worker_t *workers;
+        } parallel;
     } replayable;
 
     struct uvm_non_replayable_fault_buffer_info_struct
@@ -542,6 +650,24 @@ typedef struct
         atomic64_t num_pages_in;
     } stats;
 
+    // Token bucket limiting the rate of access-counter-driven migrations. See
+    // uvm_perf_access_counter_migration_rate_limit in
+    // uvm_gpu_access_counters.c.
+    //
+    // tokens and last_refill_time_ns are only accessed from the access counter
+    // servicing path, which is serialized per GPU by the access counters ISR
+    // lock, so they need no additional locking.
+    struct
+    {
+        NvU64 tokens;
+
+        NvU64 last_refill_time_ns;
+
+        // Number of accessed pages whose migration was skipped because the
+        // token bucket was empty
+        atomic64_t num_pages_throttled;
+    } migration_rate_limit;
+
     // Ignoring access counters means that notifications are left in the HW
     // buffer without being serviced.  Requests to ignore access counters
     // are counted since the suspend path inhibits access counter interrupts,
@@ -1087,8 +1213,15 @@ struct uvm_parent_gpu_struct
         struct proc_dir_entry *fault_stats_file;
 
         struct proc_dir_entry *access_counters_file;
+
+        struct proc_dir_entry *counters_file;
     } procfs;
 
+    // Binary telemetry counters page exposed through procfs.counters_file.
+    // Mirrors the fault and migration statistics below with plain stores so
+    // samplers can mmap them. NULL when procfs is disabled.
+    uvm_procfs_counters_t *counters;
+
     // Interrupt handling state and locks
     uvm_isr_info_t isr;
 
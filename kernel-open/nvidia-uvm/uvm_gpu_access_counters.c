@@ -84,6 +84,9 @@ static unsigned uvm_perf_access_counter_batch_count = UVM_PERF_ACCESS_COUNTER_BA
 // See module param documentation below
 static unsigned uvm_perf_access_counter_threshold = UVM_PERF_ACCESS_COUNTER_THRESHOLD_DEFAULT;
 
+// See module param documentation below
+static unsigned uvm_perf_access_counter_migration_rate_limit = 0;
+
 // Module parameters for the tunables
 module_param(uvm_perf_access_counter_mimc_migration_enable, int, S_IRUGO);
 MODULE_PARM_DESC(uvm_perf_access_counter_mimc_migration_enable,
@@ -98,6 +101,10 @@ module_param(uvm_perf_access_counter_threshold, uint, S_IRUGO);
 MODULE_PARM_DESC(uvm_perf_access_counter_threshold,
                  "Number of remote accesses on a region required to trigger a notification."
                  "Valid values: [1, 65535]");
+module_param(uvm_perf_access_counter_migration_rate_limit, uint, S_IRUGO);
+MODULE_PARM_DESC(uvm_perf_access_counter_migration_rate_limit,
+                 "Maximum number of pages per second that access counter notifications may"
+                 "migrate on each GPU. 0 (default) disables the limit");
 
 static void access_counter_buffer_flush_locked(uvm_parent_gpu_t *parent_gpu,
                                                uvm_gpu_buffer_flush_mode_t flush_mode);
@@ -156,6 +163,48 @@ static bool is_migration_enabled(uvm_access_counter_type_t type)
     return false;
 }
 
+// Token bucket limiting access-counter-driven migrations to
+// uvm_perf_access_counter_migration_rate_limit pages per second, with a burst
+// capacity of one second's worth of pages. Migrations the bucket cannot cover
+// are dropped rather than delayed: the notifications are still cleared, so if
+// the remote accesses persist the counters will reach the threshold and
+// notify again. This prevents notification storms from evicting pages that
+// the fault servicing path just brought in.
+//
+// Returns true if the caller may migrate num_pages pages. Called only from
+// the access counter servicing path, which is serialized per GPU by the
+// access counters ISR lock.
+static bool migration_rate_limit_try_claim(uvm_parent_gpu_t *parent_gpu, NvU32 num_pages)
+{
+    uvm_access_counter_buffer_info_t *access_counters = &parent_gpu->access_counter_buffer_info;
+    NvU64 rate = uvm_perf_access_counter_migration_rate_limit;
+    NvU64 now;
+    NvU64 new_tokens;
+
+    if (rate == 0)
+        return true;
+
+    now = NV_GETTIME();
+    new_tokens = ((now - access_counters->migration_rate_limit.last_refill_time_ns) * rate) / NSEC_PER_SEC;
+    if (new_tokens > 0) {
+        access_counters->migration_rate_limit.tokens = min(access_counters->migration_rate_limit.tokens + new_tokens,
+                                                           rate);
+
+        // Advance the refill time only by the time actually converted into
+        // tokens so that sub-token remainders are not lost across calls
+        access_counters->migration_rate_limit.last_refill_time_ns += (new_tokens * NSEC_PER_SEC) / rate;
+    }
+
+    if (access_counters->migration_rate_limit.tokens < num_pages) {
+        atomic64_add(num_pages, &access_counters->migration_rate_limit.num_pages_throttled);
+        return false;
+    }
+
+    access_counters->migration_rate_limit.tokens -= num_pages;
+
+    return true;
+}
+
 // Create the access counters tracking struct for the given VA space
 //
 // VA space lock needs to be held in write mode
@@ -394,6 +443,12 @@ NV_STATUS uvm_parent_gpu_init_access_counters(uvm_parent_gpu_t *parent_gpu)
     parent_gpu->access_counter_buffer_info.notifications_ignored_count = 0;
     parent_gpu->access_counter_buffer_info.reconfiguration_owner = NULL;
 
+    // Start with a full token bucket so the first notifications after boot are
+    // not throttled
+    access_counters->migration_rate_limit.tokens = uvm_perf_access_counter_migration_rate_limit;
+    access_counters->migration_rate_limit.last_refill_time_ns = NV_GETTIME();
+    atomic64_set(&access_counters->migration_rate_limit.num_pages_throttled, 0);
+
     uvm_tracker_init(&access_counters->clear_tracker);
 
     access_counters->max_notifications = parent_gpu->access_counter_buffer_info.rm_info.bufferSize /
@@ -1226,13 +1281,18 @@ static NV_STATUS service_phys_single_va_block(uvm_gpu_t *gpu,
 
         reverse_mappings_to_va_block_page_mask(va_block, reverse_mappings, num_reverse_mappings, accessed_pages);
 
-        status = UVM_VA_BLOCK_RETRY_LOCKED(va_block,
-                                           &va_block_retry,
-                                           service_va_block_locked(processor,
-                                                                   va_block,
-                                                                   &va_block_retry,
-                                                                   service_context,
-                                                                   accessed_pages));
+        // If the migration rate limit is exceeded, skip the migration but
+        // still clear the notification. The counters will notify again if the
+        // remote accesses persist.
+        if (migration_rate_limit_try_claim(gpu->parent, uvm_page_mask_weight(accessed_pages))) {
+            status = UVM_VA_BLOCK_RETRY_LOCKED(va_block,
+                                               &va_block_retry,
+                                               service_va_block_locked(processor,
+                                                                       va_block,
+                                                                       &va_block_retry,
+                                                                       service_context,
+                                                                       accessed_pages));
+        }
 
         uvm_mutex_unlock(&va_block->lock);
 
@@ -1343,28 +1403,48 @@ static NV_STATUS service_phys_notification_translation(uvm_gpu_t *gpu,
 
     // Get the reverse_map translations for all the regions set in the
     // sub_granularity field of the counter.
-    for_each_sub_granularity_region(region_start,
-                                    region_end,
-                                    sub_granularity,
-                                    config->sub_granularity_regions_per_translation) {
-        NvU64 local_address = address + region_start * config->sub_granularity_region_size;
-        NvU32 local_translation_size = (region_end - region_start) * config->sub_granularity_region_size;
-        uvm_reverse_map_t *local_reverse_mappings = batch_context->phys.translations + *num_reverse_mappings;
-
-        // Obtain the virtual addresses of the pages within the reported
-        // DMA range
-        if (resident_gpu) {
+    if (resident_gpu) {
+        for_each_sub_granularity_region(region_start,
+                                        region_end,
+                                        sub_granularity,
+                                        config->sub_granularity_regions_per_translation) {
+            NvU64 local_address = address + region_start * config->sub_granularity_region_size;
+            NvU32 local_translation_size = (region_end - region_start) * config->sub_granularity_region_size;
+            uvm_reverse_map_t *local_reverse_mappings = batch_context->phys.translations + *num_reverse_mappings;
+
+            // Obtain the virtual addresses of the pages within the reported
+            // physical range
             *num_reverse_mappings += uvm_pmm_gpu_phys_to_virt(&resident_gpu->pmm,
                                                               local_address,
                                                               local_translation_size,
                                                               local_reverse_mappings);
         }
-        else {
-            *num_reverse_mappings += uvm_pmm_sysmem_mappings_dma_to_virt(&gpu->pmm_reverse_sysmem_mappings,
-                                                                         local_address,
-                                                                         local_translation_size,
-                                                                         local_reverse_mappings,
-                                                                         local_translation_size / PAGE_SIZE);
+    }
+    else {
+        NvU64 range_addrs[UVM_SUB_GRANULARITY_REGIONS];
+        NvU64 range_sizes[UVM_SUB_GRANULARITY_REGIONS];
+        size_t num_ranges = 0;
+
+        // Batch the DMA ranges of all the regions set in the sub_granularity
+        // field so the sysmem reverse map is translated with a single call,
+        // which amortizes its lock acquisition across regions.
+        for_each_sub_granularity_region(region_start,
+                                        region_end,
+                                        sub_granularity,
+                                        config->sub_granularity_regions_per_translation) {
+            UVM_ASSERT(num_ranges < UVM_SUB_GRANULARITY_REGIONS);
+            range_addrs[num_ranges] = address + region_start * config->sub_granularity_region_size;
+            range_sizes[num_ranges] = (region_end - region_start) * config->sub_granularity_region_size;
+            ++num_ranges;
+        }
+
+        if (num_ranges > 0) {
+            *num_reverse_mappings = uvm_pmm_sysmem_mappings_multi_dma_to_virt(&gpu->pmm_reverse_sysmem_mappings,
+                                                                              range_addrs,
+                                                                              range_sizes,
+                                                                              num_ranges,
+                                                                              batch_context->phys.translations,
+                                                                              config->translation_size / PAGE_SIZE);
         }
     }
 
@@ -1641,7 +1721,11 @@ static NV_STATUS service_virt_notifications_in_block(uvm_gpu_va_space_t *gpu_va_
     // Atleast one notification should have been processed.
     UVM_ASSERT(index < *out_index);
 
-    status = service_notification_va_block_helper(mm, va_block, gpu->id, batch_context);
+    // If the migration rate limit is exceeded, skip the migration but still
+    // clear the notifications. The counters will notify again if the remote
+    // accesses persist.
+    if (migration_rate_limit_try_claim(gpu->parent, uvm_page_mask_weight(accessed_pages)))
+        status = service_notification_va_block_helper(mm, va_block, gpu->id, batch_context);
 
     uvm_mutex_unlock(&va_block->lock);
 
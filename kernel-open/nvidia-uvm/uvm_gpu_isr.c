@@ -51,6 +51,23 @@
 // re-evaluated by writing to GET. Non-replayable faults work the same way, but
 // they are currently owned by RM, so UVM doesn't have to do anything.
 
+// Number of microseconds the replayable fault bottom half keeps polling the
+// fault buffer for new faults before re-enabling the fault interrupt. While
+// faults keep arriving within this window, they are serviced by the same
+// bottom-half invocation with the interrupt still disabled, avoiding an
+// interrupt and a bottom-half schedule per fault batch under sustained fault
+// load. Interrupt-driven servicing resumes once the buffer stays idle for the
+// full window. A value of 0 disables the polling.
+#define UVM_PERF_FAULT_COALESCE_POLL_USEC_DEFAULT 50
+unsigned uvm_perf_fault_coalesce_poll_usec = UVM_PERF_FAULT_COALESCE_POLL_USEC_DEFAULT;
+module_param(uvm_perf_fault_coalesce_poll_usec, uint, S_IRUGO);
+
+// Cap on the number of coalesced servicing passes per bottom-half invocation,
+// so that a sustained fault storm cannot monopolize the bottom-half thread.
+#define UVM_PERF_FAULT_COALESCE_MAX_PASSES_DEFAULT 32
+unsigned uvm_perf_fault_coalesce_max_passes = UVM_PERF_FAULT_COALESCE_MAX_PASSES_DEFAULT;
+module_param(uvm_perf_fault_coalesce_max_passes, uint, S_IRUGO);
+
 // For use by the nv_kthread_q that is servicing the replayable fault bottom
 // half, only.
 static void replayable_faults_isr_bottom_half_entry(void *args);
@@ -515,6 +532,45 @@ static uvm_gpu_t *find_first_valid_gpu(uvm_parent_gpu_t *parent_gpu)
     return gpu;
 }
 
+// Keep servicing faults while they keep arriving within the polling window.
+// Called with the replayable fault service lock held and the fault interrupt
+// disabled, so new faults only show up in the buffer, not as interrupts, and
+// polling cannot race with another bottom half on the same GPU.
+static void replayable_faults_poll_and_service(uvm_parent_gpu_t *parent_gpu, uvm_gpu_t *gpu)
+{
+    uvm_spin_loop_t spin;
+    NvU32 passes = 0;
+
+    if (uvm_perf_fault_coalesce_poll_usec == 0)
+        return;
+
+    // In Confidential Computing new entries don't show up in the UVM-accessible
+    // buffer until GSP-RM copies them out, and the bottom half is manually
+    // retriggered on unlock instead (see
+    // replayable_faults_retrigger_bottom_half), so there is nothing useful to
+    // poll.
+    if (g_uvm_global.conf_computing_enabled)
+        return;
+
+    uvm_spin_loop_init(&spin);
+
+    while (passes < uvm_perf_fault_coalesce_max_passes &&
+           uvm_spin_loop_elapsed(&spin) < (NvU64)uvm_perf_fault_coalesce_poll_usec * 1000) {
+        if (!uvm_parent_gpu_replayable_faults_pending(parent_gpu)) {
+            UVM_SPIN_LOOP(&spin);
+            continue;
+        }
+
+        ++parent_gpu->isr.replayable_faults.stats.coalesced_pass_count;
+
+        uvm_gpu_service_replayable_faults(gpu);
+        ++passes;
+
+        // Restart the idle window after each servicing pass
+        uvm_spin_loop_init(&spin);
+    }
+}
+
 static void replayable_faults_isr_bottom_half(void *args)
 {
     uvm_parent_gpu_t *parent_gpu = (uvm_parent_gpu_t *)args;
@@ -547,6 +603,8 @@ static void replayable_faults_isr_bottom_half(void *args)
 
     uvm_gpu_service_replayable_faults(gpu);
 
+    replayable_faults_poll_and_service(parent_gpu, gpu);
+
     uvm_parent_gpu_replayable_faults_isr_unlock(parent_gpu);
 
 put_kref:
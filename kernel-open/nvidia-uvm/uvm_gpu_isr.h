@@ -29,6 +29,11 @@
 #include "uvm_lock.h"
 #include "uvm_forward_decl.h"
 
+// Tunables for adaptive interrupt coalescing in the replayable fault bottom
+// half. See their definitions in uvm_gpu_isr.c.
+extern unsigned uvm_perf_fault_coalesce_poll_usec;
+extern unsigned uvm_perf_fault_coalesce_max_passes;
+
 // ISR handling state for a specific interrupt type
 typedef struct
 {
@@ -84,6 +89,11 @@ typedef struct
         // An array (one per possible CPU), which holds the number of times the
         // bottom half has executed on that CPU.
         NvU64 *cpu_exec_count;
+
+        // Number of extra servicing passes coalesced into an earlier bottom
+        // half by polling the fault buffer instead of re-enabling interrupts.
+        // Only used by the replayable fault handler.
+        NvU64 coalesced_pass_count;
     } stats;
 
     // This is the number of times the function that disables this type of
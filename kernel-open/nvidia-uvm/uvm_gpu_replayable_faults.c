@@ -23,6 +23,7 @@
 
 #include "linux/sort.h"
 #include "nv_uvm_interface.h"
+#include "uvm_api.h"
 #include "uvm_common.h"
 #include "uvm_linux.h"
 #include "uvm_global.h"
@@ -115,6 +116,25 @@ module_param(uvm_perf_fault_max_throttle_per_service, uint, S_IRUGO);
 static unsigned uvm_perf_fault_coalesce = 1;
 module_param(uvm_perf_fault_coalesce, uint, S_IRUGO);
 
+#define UVM_PERF_FAULT_PARALLEL_WORKERS_DEFAULT 0
+#define UVM_PERF_FAULT_PARALLEL_WORKERS_MAX 16
+
+// Number of worker threads used to service independent VA block fault groups
+// within a batch in parallel. 0 (the default) disables parallel servicing and
+// all faults are serviced inline on the bottom half.
+static unsigned uvm_perf_fault_parallel_workers = UVM_PERF_FAULT_PARALLEL_WORKERS_DEFAULT;
+module_param(uvm_perf_fault_parallel_workers, uint, S_IRUGO);
+
+#define UVM_PERF_FAULT_PARALLEL_MIN_FAULTS_DEFAULT 32
+
+// Minimum number of coalesced faults in a batch required to use parallel
+// servicing. Smaller batches are serviced inline on the bottom half, which is
+// faster at low fault rates since it avoids the dispatch and flush overhead.
+static unsigned uvm_perf_fault_parallel_min_faults = UVM_PERF_FAULT_PARALLEL_MIN_FAULTS_DEFAULT;
+module_param(uvm_perf_fault_parallel_min_faults, uint, S_IRUGO);
+
+static void fault_service_worker_entry(void *args);
+
 // This function is used for both the initial fault buffer initialization and
 // the power management resume path.
 static void fault_buffer_reinit_replayable_faults(uvm_parent_gpu_t *parent_gpu)
@@ -135,6 +155,93 @@ static void fault_buffer_reinit_replayable_faults(uvm_parent_gpu_t *parent_gpu)
         parent_gpu->arch_hal->disable_prefetch_faults(parent_gpu);
 }
 
+static void fault_service_workers_deinit(uvm_parent_gpu_t *parent_gpu)
+{
+    uvm_replayable_fault_buffer_info_t *replayable_faults = &parent_gpu->fault_buffer_info.replayable;
+    NvU32 i;
+
+    if (!replayable_faults->parallel.workers)
+        return;
+
+    for (i = 0; i < replayable_faults->parallel.num_workers; ++i) {
+        uvm_fault_service_worker_t *worker = &replayable_faults->parallel.workers[i];
+
+        // The workers only run nested within bottom half executions and are
+        // flushed before the bottom half returns, so the queues are guaranteed
+        // to be idle by the time we get here.
+        nv_kthread_q_stop(&worker->queue);
+
+        if (worker->groups) {
+            uvm_tracker_deinit(&worker->tracker);
+            uvm_va_block_context_free(worker->service_context.block_context);
+        }
+
+        uvm_kvfree(worker->groups);
+    }
+
+    uvm_kvfree(replayable_faults->parallel.workers);
+    replayable_faults->parallel.workers = NULL;
+    replayable_faults->parallel.num_workers = 0;
+}
+
+// There is no error handling in this function. The caller is in charge of
+// calling fault_service_workers_deinit on failure.
+static NV_STATUS fault_service_workers_init(uvm_parent_gpu_t *parent_gpu)
+{
+    uvm_replayable_fault_buffer_info_t *replayable_faults = &parent_gpu->fault_buffer_info.replayable;
+    char kthread_name[TASK_COMM_LEN + 1];
+    NvU32 num_workers = min(uvm_perf_fault_parallel_workers, (unsigned)UVM_PERF_FAULT_PARALLEL_WORKERS_MAX);
+    NvU32 i;
+
+    if (num_workers != uvm_perf_fault_parallel_workers) {
+        pr_info("Invalid uvm_perf_fault_parallel_workers value on GPU %s: %u. Valid range [0:%u] Using %u instead\n",
+                uvm_parent_gpu_name(parent_gpu),
+                uvm_perf_fault_parallel_workers,
+                UVM_PERF_FAULT_PARALLEL_WORKERS_MAX,
+                num_workers);
+    }
+
+    if (num_workers == 0)
+        return NV_OK;
+
+    replayable_faults->parallel.workers = uvm_kvmalloc_zero(num_workers *
+                                                            sizeof(*replayable_faults->parallel.workers));
+    if (!replayable_faults->parallel.workers)
+        return NV_ERR_NO_MEMORY;
+
+    replayable_faults->parallel.num_workers = num_workers;
+
+    for (i = 0; i < num_workers; ++i) {
+        uvm_fault_service_worker_t *worker = &replayable_faults->parallel.workers[i];
+        int ret;
+
+        worker->groups = uvm_kvmalloc_zero(replayable_faults->max_faults * sizeof(*worker->groups));
+        if (!worker->groups)
+            return NV_ERR_NO_MEMORY;
+
+        // groups is used by fault_service_workers_deinit to signal that the
+        // tracker and block context were initialized.
+        uvm_tracker_init(&worker->tracker);
+
+        worker->service_context.block_context = uvm_va_block_context_alloc(NULL);
+        if (!worker->service_context.block_context) {
+            uvm_tracker_deinit(&worker->tracker);
+            uvm_kvfree(worker->groups);
+            worker->groups = NULL;
+            return NV_ERR_NO_MEMORY;
+        }
+
+        nv_kthread_q_item_init(&worker->q_item, fault_service_worker_entry, worker);
+
+        snprintf(kthread_name, sizeof(kthread_name), "UVM GPU%u FS%u", uvm_parent_id_value(parent_gpu->id), i);
+        ret = nv_kthread_q_init(&worker->queue, kthread_name);
+        if (ret != 0)
+            return errno_to_nv_status(ret);
+    }
+
+    return NV_OK;
+}
+
 // There is no error handling in this function. The caller is in charge of
 // calling fault_buffer_deinit_replayable_faults on failure.
 static NV_STATUS fault_buffer_init_replayable_faults(uvm_parent_gpu_t *parent_gpu)
@@ -185,6 +292,13 @@ static NV_STATUS fault_buffer_init_replayable_faults(uvm_parent_gpu_t *parent_gp
 
     batch_context->max_utlb_id = 0;
 
+    batch_context->parallel = false;
+    uvm_spin_lock_init(&batch_context->lock, UVM_LOCK_ORDER_LEAF);
+
+    status = fault_service_workers_init(parent_gpu);
+    if (status != NV_OK)
+        return status;
+
     status = uvm_rm_locked_call(nvUvmInterfaceOwnPageFaultIntr(parent_gpu->rm_device, NV_TRUE));
     if (status != NV_OK) {
         UVM_ERR_PRINT("Failed to take page fault ownership from RM: %s, GPU %s\n",
@@ -236,6 +350,8 @@ static void fault_buffer_deinit_replayable_faults(uvm_parent_gpu_t *parent_gpu)
             parent_gpu->arch_hal->enable_prefetch_faults(parent_gpu);
     }
 
+    fault_service_workers_deinit(parent_gpu);
+
     uvm_kvfree(batch_context->fault_cache);
     uvm_kvfree(batch_context->ordered_fault_cache);
     uvm_kvfree(batch_context->utlbs);
@@ -853,9 +969,9 @@ static NV_STATUS fetch_fault_buffer_entries(uvm_gpu_t *gpu,
     // Parse until get != put and have enough space to cache.
     while ((get != put) &&
            (fetch_mode == FAULT_FETCH_MODE_ALL || fault_index < gpu->parent->fault_buffer_info.max_batch_size)) {
-        bool is_same_instance_ptr = true;
-        uvm_fault_buffer_entry_t *current_entry = &fault_cache[fault_index];
-        uvm_fault_utlb_info_t *current_tlb;
+        NvU32 run_length;
+        NvU32 max_run;
+        NvU32 run_index;
 
         // We cannot just wait for the last entry (the one pointed by put) to
         // become valid, we have to do it individually since entries can be
@@ -866,73 +982,96 @@ static NV_STATUS fetch_fault_buffer_entries(uvm_gpu_t *gpu,
                 goto done;
         }
 
-        // Prevent later accesses being moved above the read of the valid bit
+        // Extend the run over the consecutive entries that are already valid.
+        // The run stops at the buffer wrap-around so that the batched parse
+        // below always sees a physically contiguous run of packets.
+        max_run = (put > get)? (put - get): (replayable_faults->max_faults - get);
+        if (fetch_mode != FAULT_FETCH_MODE_ALL)
+            max_run = min(max_run, gpu->parent->fault_buffer_info.max_batch_size - fault_index);
+
+        run_length = 1;
+        while (run_length < max_run &&
+               gpu->parent->fault_buffer_hal->entry_is_valid(gpu->parent, get + run_length))
+            ++run_length;
+
+        // Prevent later accesses being moved above the reads of the valid bits
         smp_mb__after_atomic();
 
-        // Got valid bit set. Let's cache.
-        status = gpu->parent->fault_buffer_hal->parse_replayable_entry(gpu->parent, get, current_entry);
+        // Got valid bits set. Decode the whole run in one HAL call and cache
+        // it.
+        status = gpu->parent->fault_buffer_hal->parse_replayable_entries(gpu->parent,
+                                                                         get,
+                                                                         run_length,
+                                                                         &fault_cache[fault_index]);
         if (status != NV_OK)
             goto done;
 
-        // The GPU aligns the fault addresses to 4k, but all of our tracking is
-        // done in PAGE_SIZE chunks which might be larger.
-        current_entry->fault_address = UVM_PAGE_ALIGN_DOWN(current_entry->fault_address);
+        for (run_index = 0; run_index < run_length; ++run_index) {
+            bool is_same_instance_ptr = true;
+            uvm_fault_buffer_entry_t *current_entry = &fault_cache[fault_index];
+            uvm_fault_utlb_info_t *current_tlb;
 
-        // Make sure that all fields in the entry are properly initialized
-        current_entry->is_fatal = (current_entry->fault_type >= UVM_FAULT_TYPE_FATAL);
+            // The GPU aligns the fault addresses to 4k, but all of our
+            // tracking is done in PAGE_SIZE chunks which might be larger.
+            current_entry->fault_address = UVM_PAGE_ALIGN_DOWN(current_entry->fault_address);
 
-        if (current_entry->is_fatal) {
-            // Record the fatal fault event later as we need the va_space locked
-            current_entry->fatal_reason = UvmEventFatalReasonInvalidFaultType;
-        }
-        else {
-            current_entry->fatal_reason = UvmEventFatalReasonInvalid;
-        }
+            // Make sure that all fields in the entry are properly initialized
+            current_entry->is_fatal = (current_entry->fault_type >= UVM_FAULT_TYPE_FATAL);
 
-        current_entry->va_space = NULL;
-        current_entry->filtered = false;
-        current_entry->replayable.cancel_va_mode = UVM_FAULT_CANCEL_VA_MODE_ALL;
+            if (current_entry->is_fatal) {
+                // Record the fatal fault event later as we need the va_space
+                // locked
+                current_entry->fatal_reason = UvmEventFatalReasonInvalidFaultType;
+            }
+            else {
+                current_entry->fatal_reason = UvmEventFatalReasonInvalid;
+            }
 
-        if (current_entry->fault_source.utlb_id > batch_context->max_utlb_id) {
-            UVM_ASSERT(current_entry->fault_source.utlb_id < replayable_faults->utlb_count);
-            batch_context->max_utlb_id = current_entry->fault_source.utlb_id;
-        }
+            current_entry->va_space = NULL;
+            current_entry->filtered = false;
+            current_entry->replayable.cancel_va_mode = UVM_FAULT_CANCEL_VA_MODE_ALL;
+
+            if (current_entry->fault_source.utlb_id > batch_context->max_utlb_id) {
+                UVM_ASSERT(current_entry->fault_source.utlb_id < replayable_faults->utlb_count);
+                batch_context->max_utlb_id = current_entry->fault_source.utlb_id;
+            }
 
-        current_tlb = &batch_context->utlbs[current_entry->fault_source.utlb_id];
+            current_tlb = &batch_context->utlbs[current_entry->fault_source.utlb_id];
 
-        if (fault_index > 0) {
-            UVM_ASSERT(batch_context->last_fault);
-            is_same_instance_ptr = cmp_fault_instance_ptr(current_entry, batch_context->last_fault) == 0;
+            if (fault_index > 0) {
+                UVM_ASSERT(batch_context->last_fault);
+                is_same_instance_ptr = cmp_fault_instance_ptr(current_entry, batch_context->last_fault) == 0;
 
-            // Coalesce duplicate faults when possible
-            if (may_filter && !current_entry->is_fatal) {
-                bool merged = fetch_fault_buffer_try_merge_entry(current_entry,
-                                                                 batch_context,
-                                                                 current_tlb,
-                                                                 is_same_instance_ptr);
-                if (merged)
-                    goto next_fault;
+                // Coalesce duplicate faults when possible
+                if (may_filter && !current_entry->is_fatal) {
+                    bool merged = fetch_fault_buffer_try_merge_entry(current_entry,
+                                                                     batch_context,
+                                                                     current_tlb,
+                                                                     is_same_instance_ptr);
+                    if (merged)
+                        goto next_fault;
+                }
             }
-        }
 
-        if (batch_context->is_single_instance_ptr && !is_same_instance_ptr)
-            batch_context->is_single_instance_ptr = false;
+            if (batch_context->is_single_instance_ptr && !is_same_instance_ptr)
+                batch_context->is_single_instance_ptr = false;
 
-        current_entry->num_instances = 1;
-        current_entry->access_type_mask = uvm_fault_access_type_mask_bit(current_entry->fault_access_type);
-        INIT_LIST_HEAD(&current_entry->merged_instances_list);
+            current_entry->num_instances = 1;
+            current_entry->access_type_mask = uvm_fault_access_type_mask_bit(current_entry->fault_access_type);
+            INIT_LIST_HEAD(&current_entry->merged_instances_list);
 
-        ++current_tlb->num_pending_faults;
-        current_tlb->last_fault = current_entry;
-        batch_context->last_fault = current_entry;
+            ++current_tlb->num_pending_faults;
+            current_tlb->last_fault = current_entry;
+            batch_context->last_fault = current_entry;
 
-        ++num_coalesced_faults;
+            ++num_coalesced_faults;
 
-    next_fault:
-        ++fault_index;
-        ++get;
-        if (get == replayable_faults->max_faults)
-            get = 0;
+        next_fault:
+            ++fault_index;
+            ++get;
+            if (get == replayable_faults->max_faults)
+                get = 0;
+        }
     }
 
 done:
@@ -1119,6 +1258,22 @@ static NV_STATUS preprocess_fault_batch(uvm_gpu_t *gpu, uvm_fault_service_batch_
     return NV_OK;
 }
 
+// Shared batch context counters and flags can be updated concurrently by the
+// parallel fault service workers. Take the batch context lock around those
+// updates while a parallel servicing pass is in flight; the serial path skips
+// the lock since the bottom half is the only writer.
+static void batch_context_stats_lock(uvm_fault_service_batch_context_t *batch_context)
+{
+    if (batch_context->parallel)
+        uvm_spin_lock(&batch_context->lock);
+}
+
+static void batch_context_stats_unlock(uvm_fault_service_batch_context_t *batch_context)
+{
+    if (batch_context->parallel)
+        uvm_spin_unlock(&batch_context->lock);
+}
+
 static bool check_fault_entry_duplicate(const uvm_fault_buffer_entry_t *current_entry,
                                         const uvm_fault_buffer_entry_t *previous_entry)
 {
@@ -1139,11 +1294,15 @@ static void update_batch_and_notify_fault(uvm_gpu_t *gpu,
                                           uvm_fault_buffer_entry_t *current_entry,
                                           bool is_duplicate)
 {
+    batch_context_stats_lock(batch_context);
+
     if (is_duplicate)
         batch_context->num_duplicate_faults += current_entry->num_instances;
     else
         batch_context->num_duplicate_faults += current_entry->num_instances - 1;
 
+    batch_context_stats_unlock(batch_context);
+
     uvm_perf_event_notify_gpu_fault(&current_entry->va_space->perf_events,
                                     va_block,
                                     gpu->id,
@@ -1166,14 +1325,19 @@ static void mark_fault_invalid_prefetch(uvm_fault_service_batch_context_t *batch
     // invalid_prefetch counter doesn't affect functionality (other than
     // disabling prefetching if the counter indicates lots of invalid prefetch
     // faults), this is ok.
+    batch_context_stats_lock(batch_context);
     batch_context->num_invalid_prefetch_faults += fault_entry->num_instances;
+    batch_context_stats_unlock(batch_context);
 }
 
 static void mark_fault_throttled(uvm_fault_service_batch_context_t *batch_context,
                                  uvm_fault_buffer_entry_t *fault_entry)
 {
     fault_entry->is_throttled = true;
+
+    batch_context_stats_lock(batch_context);
     batch_context->has_throttled_faults = true;
+    batch_context_stats_unlock(batch_context);
 }
 
 static void mark_fault_fatal(uvm_fault_service_batch_context_t *batch_context,
@@ -1187,12 +1351,16 @@ static void mark_fault_fatal(uvm_fault_service_batch_context_t *batch_context,
     fault_entry->fatal_reason = fatal_reason;
     fault_entry->replayable.cancel_va_mode = cancel_va_mode;
 
+    batch_context_stats_lock(batch_context);
+
     utlb->has_fatal_faults = true;
 
     if (!batch_context->fatal_va_space) {
         UVM_ASSERT(fault_entry->va_space);
         batch_context->fatal_va_space = fault_entry->va_space;
     }
+
+    batch_context_stats_unlock(batch_context);
 }
 
 static void fault_entry_duplicate_flags(uvm_fault_service_batch_context_t *batch_context,
@@ -1319,6 +1487,7 @@ static NV_STATUS service_fault_batch_block_locked(uvm_gpu_t *gpu,
                                                   uvm_fault_service_batch_context_t *batch_context,
                                                   NvU32 first_fault_index,
                                                   const bool hmm_migratable,
+                                                  uvm_service_block_context_t *block_context,
                                                   NvU32 *block_faults)
 {
     NV_STATUS status = NV_OK;
@@ -1327,9 +1496,7 @@ static NV_STATUS service_fault_batch_block_locked(uvm_gpu_t *gpu,
     uvm_page_index_t last_page_index;
     NvU32 page_fault_count = 0;
     uvm_range_group_range_iter_t iter;
-    uvm_replayable_fault_buffer_info_t *replayable_faults = &gpu->parent->fault_buffer_info.replayable;
     uvm_fault_buffer_entry_t **ordered_fault_cache = batch_context->ordered_fault_cache;
-    uvm_service_block_context_t *block_context = &replayable_faults->block_service_context;
     uvm_va_space_t *va_space = uvm_va_block_get_va_space(va_block);
     const uvm_va_policy_t *policy;
     NvU64 end;
@@ -1546,12 +1713,13 @@ static NV_STATUS service_fault_batch_block(uvm_gpu_t *gpu,
                                            uvm_fault_service_batch_context_t *batch_context,
                                            NvU32 first_fault_index,
                                            const bool hmm_migratable,
+                                           uvm_service_block_context_t *fault_block_context,
+                                           uvm_tracker_t *tracker,
                                            NvU32 *block_faults)
 {
     NV_STATUS status;
     uvm_va_block_retry_t va_block_retry;
     NV_STATUS tracker_status;
-    uvm_service_block_context_t *fault_block_context = &gpu->parent->fault_buffer_info.replayable.block_service_context;
 
     fault_block_context->operation = UVM_SERVICE_OPERATION_REPLAYABLE_FAULTS;
     fault_block_context->num_retries = 0;
@@ -1568,9 +1736,10 @@ static NV_STATUS service_fault_batch_block(uvm_gpu_t *gpu,
                                                                         batch_context,
                                                                         first_fault_index,
                                                                         hmm_migratable,
+                                                                        fault_block_context,
                                                                         block_faults));
 
-    tracker_status = uvm_tracker_add_tracker_safe(&batch_context->tracker, &va_block->tracker);
+    tracker_status = uvm_tracker_add_tracker_safe(tracker, &va_block->tracker);
 
     uvm_mutex_unlock(&va_block->lock);
 
@@ -1580,6 +1749,186 @@ static NV_STATUS service_fault_batch_block(uvm_gpu_t *gpu,
     return status == NV_OK? tracker_status: status;
 }
 
+static void fault_service_worker(void *args)
+{
+    uvm_fault_service_worker_t *worker = (uvm_fault_service_worker_t *)args;
+    struct mm_struct *mm = worker->service_context.block_context->mm;
+    uvm_va_space_t *va_space;
+    NvU32 i;
+
+    UVM_ASSERT(worker->num_groups > 0);
+
+    va_space = uvm_va_block_get_va_space(worker->groups[0].va_block);
+
+    // Record the lock ownership
+    // The dispatcher holds the VA space lock in read mode (and the mmap lock,
+    // if an mm is registered) across the whole parallel servicing pass, but
+    // lock tracking is per-thread. Record the ownership here the same way the
+    // bottom half does for isr.replayable_faults.service_lock, which is taken
+    // in the top half.
+    if (mm)
+        uvm_record_lock_mmap_lock_read(mm);
+
+    uvm_record_lock(&va_space->lock, UVM_LOCK_FLAGS_MODE_SHARED);
+
+    for (i = 0; i < worker->num_groups; ++i) {
+        NvU32 block_faults;
+        NV_STATUS status;
+
+        status = service_fault_batch_block(worker->gpu,
+                                           worker->groups[i].va_block,
+                                           worker->batch_context,
+                                           worker->groups[i].first_fault_index,
+                                           true,
+                                           &worker->service_context,
+                                           &worker->tracker,
+                                           &block_faults);
+
+        // The HMM retry codes cannot be seen here since parallel servicing is
+        // restricted to managed VA blocks
+        UVM_ASSERT(status != NV_WARN_MORE_PROCESSING_REQUIRED);
+        UVM_ASSERT(status != NV_WARN_MISMATCHED_TARGET);
+
+        if (status != NV_OK) {
+            worker->status = status;
+            break;
+        }
+    }
+
+    uvm_record_unlock(&va_space->lock, UVM_LOCK_FLAGS_MODE_SHARED);
+
+    if (mm)
+        uvm_record_unlock_mmap_lock_read(mm);
+}
+
+static void fault_service_worker_entry(void *args)
+{
+   UVM_ENTRY_VOID(fault_service_worker(args));
+}
+
+// Try to service the whole batch by distributing its VA block fault groups
+// across the parallel fault service workers. The workers only handle faults
+// on managed (non-HMM) VA blocks from a single VA space, which is the common
+// case for a fault storm from a single process.
+//
+// Returns NV_WARN_MORE_PROCESSING_REQUIRED if the batch does not qualify. In
+// that case no fault has been serviced and the caller must fall back to the
+// serial servicing path.
+static NV_STATUS service_fault_batch_parallel(uvm_gpu_t *gpu, uvm_fault_service_batch_context_t *batch_context)
+{
+    NV_STATUS status = NV_OK;
+    uvm_replayable_fault_buffer_info_t *replayable_faults = &gpu->parent->fault_buffer_info.replayable;
+    uvm_va_space_t *va_space = batch_context->ordered_fault_cache[0]->va_space;
+    struct mm_struct *mm;
+    NvU32 num_groups = 0;
+    NvU32 i = 0;
+    NvU32 w;
+
+    UVM_ASSERT(replayable_faults->parallel.num_workers > 0);
+    UVM_ASSERT(batch_context->num_coalesced_faults > 0);
+    UVM_ASSERT(va_space);
+
+    mm = uvm_va_space_mm_retain_lock(va_space);
+    uvm_va_space_down_read(va_space);
+
+    if (!uvm_gpu_va_space_get_by_parent_gpu(va_space, gpu->parent)) {
+        status = NV_WARN_MORE_PROCESSING_REQUIRED;
+        goto done;
+    }
+
+    for (w = 0; w < replayable_faults->parallel.num_workers; ++w) {
+        uvm_fault_service_worker_t *worker = &replayable_faults->parallel.workers[w];
+
+        worker->gpu = gpu;
+        worker->batch_context = batch_context;
+        worker->num_groups = 0;
+        worker->status = NV_OK;
+        uvm_va_block_context_init(worker->service_context.block_context, mm);
+    }
+
+    // Group the ordered fault cache by VA block, bailing out to the serial
+    // path on anything the workers cannot service: faults from a second VA
+    // space, already-fatal faults, and faults outside of managed VA ranges
+    // (ATS and HMM). VA block creation is idempotent, so bailing out midway
+    // leaves nothing to undo.
+    while (i < batch_context->num_coalesced_faults) {
+        uvm_fault_buffer_entry_t *current_entry = batch_context->ordered_fault_cache[i];
+        uvm_fault_service_worker_t *worker;
+        uvm_va_range_t *va_range;
+        uvm_va_block_t *va_block;
+
+        if (current_entry->va_space != va_space || current_entry->is_fatal) {
+            status = NV_WARN_MORE_PROCESSING_REQUIRED;
+            goto done;
+        }
+
+        va_range = uvm_va_space_iter_first(va_space, current_entry->fault_address, ~0ULL);
+        if (!va_range ||
+            current_entry->fault_address < va_range->node.start ||
+            uvm_va_block_find_create_in_range(va_space, va_range, current_entry->fault_address, &va_block) != NV_OK) {
+            status = NV_WARN_MORE_PROCESSING_REQUIRED;
+            goto done;
+        }
+
+        UVM_ASSERT(!uvm_va_block_is_hmm(va_block));
+
+        // Spread the groups round-robin across the workers
+        worker = &replayable_faults->parallel.workers[num_groups % replayable_faults->parallel.num_workers];
+        worker->groups[worker->num_groups].va_block = va_block;
+        worker->groups[worker->num_groups].first_fault_index = i;
+        ++worker->num_groups;
+        ++num_groups;
+
+        // Skip the remaining entries of the group: the fault addresses are
+        // sorted, so the group ends at the first entry past the VA block.
+        // This matches the servicing loop in
+        // service_fault_batch_block_locked().
+        while (++i < batch_context->num_coalesced_faults &&
+               batch_context->ordered_fault_cache[i]->va_space == va_space &&
+               batch_context->ordered_fault_cache[i]->fault_address <= va_block->end)
+            ;
+    }
+
+    // A single group gains nothing from the dispatch overhead
+    if (num_groups < 2) {
+        status = NV_WARN_MORE_PROCESSING_REQUIRED;
+        goto done;
+    }
+
+    batch_context->parallel = true;
+
+    for (w = 0; w < replayable_faults->parallel.num_workers; ++w) {
+        uvm_fault_service_worker_t *worker = &replayable_faults->parallel.workers[w];
+
+        if (worker->num_groups > 0)
+            nv_kthread_q_schedule_q_item(&worker->queue, &worker->q_item);
+    }
+
+    for (w = 0; w < replayable_faults->parallel.num_workers; ++w) {
+        uvm_fault_service_worker_t *worker = &replayable_faults->parallel.workers[w];
+        NV_STATUS tracker_status;
+
+        if (worker->num_groups == 0)
+            continue;
+
+        nv_kthread_q_flush(&worker->queue);
+
+        tracker_status = uvm_tracker_add_tracker_safe(&batch_context->tracker, &worker->tracker);
+        uvm_tracker_clear(&worker->tracker);
+
+        if (status == NV_OK)
+            status = worker->status == NV_OK? tracker_status: worker->status;
+    }
+
+    batch_context->parallel = false;
+
+done:
+    uvm_va_space_up_read(va_space);
+    uvm_va_space_mm_release_unlock(va_space, mm);
+
+    return status;
+}
+
 typedef enum
 {
     // Use this mode when calling from the normal fault servicing path
@@ -1867,13 +2216,19 @@ static NV_STATUS service_fault_batch_ats(uvm_gpu_va_space_t *gpu_va_space,
     return status;
 }
 
+// va_range_hint is a caller-owned lookup hint covering the whole batch, see
+// uvm_va_space_iter_first_hint. The ordered fault cache is sorted by address,
+// so consecutive dispatches usually hit the hint and skip the VA range tree
+// walk. The caller must reset the hint to NULL whenever the VA space lock is
+// dropped.
 static NV_STATUS service_fault_batch_dispatch(uvm_va_space_t *va_space,
                                               uvm_gpu_va_space_t *gpu_va_space,
                                               uvm_fault_service_batch_context_t *batch_context,
                                               NvU32 fault_index,
                                               NvU32 *block_faults,
                                               bool replay_per_va_block,
-                                              const bool hmm_migratable)
+                                              const bool hmm_migratable,
+                                              uvm_range_tree_node_t **va_range_hint)
 {
     NV_STATUS status;
     uvm_va_range_t *va_range = NULL;
@@ -1888,7 +2243,7 @@ static NV_STATUS service_fault_batch_dispatch(uvm_va_space_t *va_space,
 
     (*block_faults) = 0;
 
-    va_range_next = uvm_va_space_iter_first(va_space, fault_address, ~0ULL);
+    va_range_next = uvm_va_space_iter_first_hint(va_space, fault_address, ~0ULL, va_range_hint);
     if (va_range_next && (fault_address >= va_range_next->node.start)) {
         UVM_ASSERT(fault_address < va_range_next->node.end);
 
@@ -1904,7 +2259,14 @@ static NV_STATUS service_fault_batch_dispatch(uvm_va_space_t *va_space,
         status = NV_ERR_INVALID_ADDRESS;
 
     if (status == NV_OK) {
-        status = service_fault_batch_block(gpu, va_block, batch_context, fault_index, hmm_migratable, block_faults);
+        status = service_fault_batch_block(gpu,
+                                           va_block,
+                                           batch_context,
+                                           fault_index,
+                                           hmm_migratable,
+                                           &gpu->parent->fault_buffer_info.replayable.block_service_context,
+                                           &batch_context->tracker,
+                                           block_faults);
     }
     else if ((status == NV_ERR_INVALID_ADDRESS) && uvm_ats_can_service_faults(gpu_va_space, mm)) {
         NvU64 outer = ~0ULL;
@@ -1967,6 +2329,7 @@ static NV_STATUS service_fault_batch_for_cancel(uvm_gpu_t *gpu, uvm_fault_servic
 {
     NV_STATUS status = NV_OK;
     NvU32 i;
+    uvm_range_tree_node_t *va_range_hint = NULL;
     uvm_va_space_t *va_space = batch_context->fatal_va_space;
     uvm_gpu_va_space_t *gpu_va_space = NULL;
     struct mm_struct *mm;
@@ -2085,7 +2448,14 @@ static NV_STATUS service_fault_batch_for_cancel(uvm_gpu_t *gpu, uvm_fault_servic
             // Service all the faults that we can. We only really need to search
             // for fatal faults, but attempting to service all is the easiest
             // way to do that.
-            status = service_fault_batch_dispatch(va_space, gpu_va_space, batch_context, i, &block_faults, false, hmm_migratable);
+            status = service_fault_batch_dispatch(va_space,
+                                                  gpu_va_space,
+                                                  batch_context,
+                                                  i,
+                                                  &block_faults,
+                                                  false,
+                                                  hmm_migratable,
+                                                  &va_range_hint);
             if (status != NV_OK) {
                 // TODO: Bug 3900733: clean up locking in service_fault_batch().
                 // We need to drop lock and retry. That means flushing and
@@ -2162,12 +2532,27 @@ static NV_STATUS service_fault_batch(uvm_gpu_t *gpu,
     uvm_service_block_context_t *service_context =
         &gpu->parent->fault_buffer_info.replayable.block_service_context;
     uvm_va_block_context_t *va_block_context = service_context->block_context;
+    uvm_range_tree_node_t *va_range_hint = NULL;
     bool hmm_migratable = true;
 
     UVM_ASSERT(gpu->parent->replayable_faults_supported);
 
     ats_invalidate->tlb_batch_pending = false;
 
+    // Large batches of independent VA block fault groups can be serviced on
+    // the parallel fault service workers instead of inline. If the batch does
+    // not qualify, fall through to the serial path below.
+    if (service_mode == FAULT_SERVICE_MODE_REGULAR &&
+        !replay_per_va_block &&
+        gpu->parent->fault_buffer_info.replayable.parallel.num_workers > 0 &&
+        batch_context->num_coalesced_faults >= uvm_perf_fault_parallel_min_faults) {
+        status = service_fault_batch_parallel(gpu, batch_context);
+        if (status != NV_WARN_MORE_PROCESSING_REQUIRED)
+            return status;
+
+        status = NV_OK;
+    }
+
     for (i = 0; i < batch_context->num_coalesced_faults;) {
         NvU32 block_faults;
         uvm_fault_buffer_entry_t *current_entry = batch_context->ordered_fault_cache[i];
@@ -2201,6 +2586,10 @@ static NV_STATUS service_fault_batch(uvm_gpu_t *gpu,
 
             uvm_va_space_down_read(va_space);
             gpu_va_space = uvm_gpu_va_space_get_by_parent_gpu(va_space, gpu->parent);
+
+            // The VA range tree may have changed while the VA space lock was
+            // not held, so the lookup hint is no longer valid.
+            va_range_hint = NULL;
         }
 
         // Some faults could be already fatal if they cannot be handled by
@@ -2230,7 +2619,8 @@ static NV_STATUS service_fault_batch(uvm_gpu_t *gpu,
                                               i,
                                               &block_faults,
                                               replay_per_va_block,
-                                              hmm_migratable);
+                                              hmm_migratable,
+                                              &va_range_hint);
         // TODO: Bug 3900733: clean up locking in service_fault_batch().
         if (status == NV_WARN_MORE_PROCESSING_REQUIRED || status == NV_WARN_MISMATCHED_TARGET) {
             if (status == NV_WARN_MISMATCHED_TARGET)
@@ -2239,6 +2629,7 @@ static NV_STATUS service_fault_batch(uvm_gpu_t *gpu,
             uvm_va_space_mm_release_unlock(va_space, mm);
             mm = NULL;
             va_space = NULL;
+            va_range_hint = NULL;
             status = NV_OK;
             continue;
         }
@@ -2776,11 +3167,30 @@ static void enable_disable_prefetch_faults(uvm_parent_gpu_t *parent_gpu, uvm_fau
     }
 }
 
+// Record the end-to-end servicing latency of a completed fault batch in the
+// latency statistics exposed via UVM_TEST_PERF_FAULT_LATENCY
+static void fault_batch_record_latency_stats(uvm_replayable_fault_buffer_info_t *replayable_faults,
+                                             uvm_fault_service_batch_context_t *batch_context,
+                                             NvU64 batch_start_ns)
+{
+    NvU64 batch_ns = NV_GETTIME() - batch_start_ns;
+    NvU32 bin = 0;
+
+    if (batch_ns > 0)
+        bin = min((NvU32)ilog2(batch_ns), (NvU32)(UVM_FAULT_BATCH_LATENCY_HISTOGRAM_BINS - 1));
+
+    ++replayable_faults->latency_stats.batch_latency_hist[bin];
+    ++replayable_faults->latency_stats.num_batches;
+    replayable_faults->latency_stats.num_faults += batch_context->num_cached_faults;
+}
+
 void uvm_gpu_service_replayable_faults(uvm_gpu_t *gpu)
 {
     NvU32 num_replays = 0;
     NvU32 num_batches = 0;
     NvU32 num_throttled = 0;
+    NvU64 batch_start_ns;
+    NvU64 stage_start_ns;
     NV_STATUS status = NV_OK;
     uvm_replayable_fault_buffer_info_t *replayable_faults = &gpu->parent->fault_buffer_info.replayable;
     uvm_fault_service_batch_context_t *batch_context = &replayable_faults->batch_service_context;
@@ -2802,6 +3212,8 @@ void uvm_gpu_service_replayable_faults(uvm_gpu_t *gpu)
         batch_context->fatal_va_space              = NULL;
         batch_context->has_throttled_faults        = false;
 
+        batch_start_ns = NV_GETTIME();
+
         status = fetch_fault_buffer_entries(gpu, batch_context, FAULT_FETCH_MODE_BATCH_READY);
         if (status != NV_OK)
             break;
@@ -2813,6 +3225,8 @@ void uvm_gpu_service_replayable_faults(uvm_gpu_t *gpu)
 
         status = preprocess_fault_batch(gpu, batch_context);
 
+        replayable_faults->latency_stats.fetch_ns += NV_GETTIME() - batch_start_ns;
+
         num_replays += batch_context->num_replays;
 
         if (status == NV_WARN_MORE_PROCESSING_REQUIRED)
@@ -2820,8 +3234,12 @@ void uvm_gpu_service_replayable_faults(uvm_gpu_t *gpu)
         else if (status != NV_OK)
             break;
 
+        stage_start_ns = NV_GETTIME();
+
         status = service_fault_batch(gpu, FAULT_SERVICE_MODE_REGULAR, batch_context);
 
+        replayable_faults->latency_stats.service_ns += NV_GETTIME() - stage_start_ns;
+
         // We may have issued replays even if status != NV_OK if
         // UVM_PERF_FAULT_REPLAY_POLICY_BLOCK is being used or the fault buffer
         // was flushed
@@ -2841,12 +3259,15 @@ void uvm_gpu_service_replayable_faults(uvm_gpu_t *gpu)
         }
 
         if (batch_context->fatal_va_space) {
+            stage_start_ns = NV_GETTIME();
             status = uvm_tracker_wait(&batch_context->tracker);
+            replayable_faults->latency_stats.tracker_wait_ns += NV_GETTIME() - stage_start_ns;
             if (status == NV_OK) {
                 status = cancel_faults_precise(gpu, batch_context);
                 if (status == NV_OK) {
                     // Cancel handling should've issued at least one replay
                     UVM_ASSERT(batch_context->num_replays > 0);
+                    fault_batch_record_latency_stats(replayable_faults, batch_context, batch_start_ns);
                     ++num_batches;
                     continue;
                 }
@@ -2856,7 +3277,9 @@ void uvm_gpu_service_replayable_faults(uvm_gpu_t *gpu)
         }
 
         if (replayable_faults->replay_policy == UVM_PERF_FAULT_REPLAY_POLICY_BATCH) {
+            stage_start_ns = NV_GETTIME();
             status = push_replay_on_gpu(gpu, UVM_FAULT_REPLAY_TYPE_START, batch_context);
+            replayable_faults->latency_stats.replay_ns += NV_GETTIME() - stage_start_ns;
             if (status != NV_OK)
                 break;
             ++num_replays;
@@ -2869,11 +3292,15 @@ void uvm_gpu_service_replayable_faults(uvm_gpu_t *gpu)
                 flush_mode = UVM_GPU_BUFFER_FLUSH_MODE_UPDATE_PUT;
             }
 
+            stage_start_ns = NV_GETTIME();
             status = fault_buffer_flush_locked(gpu, flush_mode, UVM_FAULT_REPLAY_TYPE_START, batch_context);
+            replayable_faults->latency_stats.replay_ns += NV_GETTIME() - stage_start_ns;
             if (status != NV_OK)
                 break;
             ++num_replays;
+            stage_start_ns = NV_GETTIME();
             status = uvm_tracker_wait(&replayable_faults->replay_tracker);
+            replayable_faults->latency_stats.tracker_wait_ns += NV_GETTIME() - stage_start_ns;
             if (status != NV_OK)
                 break;
         }
@@ -2881,6 +3308,8 @@ void uvm_gpu_service_replayable_faults(uvm_gpu_t *gpu)
         if (batch_context->has_throttled_faults)
             ++num_throttled;
 
+        fault_batch_record_latency_stats(replayable_faults, batch_context, batch_start_ns);
+
         ++num_batches;
     }
 
@@ -2988,3 +3417,47 @@ NV_STATUS uvm_test_drain_replayable_faults(UVM_TEST_DRAIN_REPLAYABLE_FAULTS_PARA
 
     return status;
 }
+
+NV_STATUS uvm_test_perf_fault_latency(UVM_TEST_PERF_FAULT_LATENCY_PARAMS *params, struct file *filp)
+{
+    uvm_gpu_t *gpu;
+    uvm_replayable_fault_buffer_info_t *replayable_faults;
+    uvm_va_space_t *va_space = uvm_va_space_get(filp);
+
+    BUILD_BUG_ON(UVM_TEST_PERF_FAULT_LATENCY_BINS != UVM_FAULT_BATCH_LATENCY_HISTOGRAM_BINS);
+
+    gpu = uvm_va_space_retain_gpu_by_uuid(va_space, &params->gpu_uuid);
+    if (!gpu)
+        return NV_ERR_INVALID_DEVICE;
+
+    if (!gpu->parent->replayable_faults_supported) {
+        uvm_gpu_release(gpu);
+        return NV_ERR_NOT_SUPPORTED;
+    }
+
+    replayable_faults = &gpu->parent->fault_buffer_info.replayable;
+
+    // The bottom half services faults with the ISR lock held, so taking it
+    // here guarantees a consistent snapshot (and reset) of the statistics
+    uvm_parent_gpu_replayable_faults_isr_lock(gpu->parent);
+
+    params->num_batches     = replayable_faults->latency_stats.num_batches;
+    params->num_faults      = replayable_faults->latency_stats.num_faults;
+    params->fetch_ns        = replayable_faults->latency_stats.fetch_ns;
+    params->service_ns      = replayable_faults->latency_stats.service_ns;
+    params->replay_ns       = replayable_faults->latency_stats.replay_ns;
+    params->tracker_wait_ns = replayable_faults->latency_stats.tracker_wait_ns;
+
+    memcpy(params->batch_latency_hist,
+           replayable_faults->latency_stats.batch_latency_hist,
+           sizeof(params->batch_latency_hist));
+
+    if (params->reset)
+        memset(&replayable_faults->latency_stats, 0, sizeof(replayable_faults->latency_stats));
+
+    uvm_parent_gpu_replayable_faults_isr_unlock(gpu->parent);
+
+    uvm_gpu_release(gpu);
+
+    return NV_OK;
+}
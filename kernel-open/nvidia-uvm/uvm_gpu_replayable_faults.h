@@ -52,6 +52,11 @@ typedef enum
 
 const char *uvm_perf_fault_replay_policy_string(uvm_perf_fault_replay_policy_t fault_replay);
 
+// Number of power-of-two bins in the fault batch servicing latency histogram
+// exposed by UVM_TEST_PERF_FAULT_LATENCY. Bin i counts batches whose
+// end-to-end servicing time fell within [2^i, 2^(i+1)) nanoseconds.
+#define UVM_FAULT_BATCH_LATENCY_HISTOGRAM_BINS 32
+
 NV_STATUS uvm_parent_gpu_fault_buffer_init(uvm_parent_gpu_t *parent_gpu);
 void uvm_parent_gpu_fault_buffer_deinit(uvm_parent_gpu_t *parent_gpu);
 
@@ -42,16 +42,21 @@ struct uvm_gpu_semaphore_pool_struct
     // The GPU owning the pool
     uvm_gpu_t *gpu;
 
-    // List of all the semaphore pages belonging to the pool
+    // List of all the semaphore pages belonging to the pool. Pages are only
+    // ever added to the list until the pool is destroyed, and they are fully
+    // initialized before being published on it, so the list can be walked
+    // without the pool mutex by the semaphore alloc/free fast paths.
     struct list_head pages;
 
     // Pages aperture.
     uvm_aperture_t aperture;
 
     // Count of free semaphores among all the pages
-    NvU32 free_semaphores_count;
+    atomic_t free_semaphores_count;
 
-    // Lock protecting the state of the pool
+    // Lock protecting page additions and removals. The free semaphore bitmaps
+    // within the pages are managed with atomic operations and are not
+    // protected by the mutex.
     uvm_mutex_t mutex;
 };
 
@@ -77,7 +82,9 @@ struct uvm_gpu_semaphore_pool_page_struct
     // Node in the list of all pages in a semaphore pool
     struct list_head all_pages_node;
 
-    // Mask indicating free semaphore indices within the page
+    // Mask indicating free semaphore indices within the page. Indices are
+    // claimed and released with atomic bitmap operations so that semaphore
+    // alloc/free don't need the pool mutex.
     DECLARE_BITMAP(free_semaphores, UVM_SEMAPHORE_COUNT_PER_PAGE);
 };
 
@@ -238,9 +245,6 @@ static NV_STATUS pool_alloc_page(uvm_gpu_semaphore_pool_t *pool)
     // All semaphores are initially free
     bitmap_fill(pool_page->free_semaphores, UVM_SEMAPHORE_COUNT_PER_PAGE);
 
-    list_add(&pool_page->all_pages_node, &pool->pages);
-    pool->free_semaphores_count += UVM_SEMAPHORE_COUNT_PER_PAGE;
-
     if (semaphore_uses_canary(pool)) {
         size_t i;
         NvU32 *payloads = uvm_rm_mem_get_cpu_va(pool_page->memory);
@@ -249,6 +253,13 @@ static NV_STATUS pool_alloc_page(uvm_gpu_semaphore_pool_t *pool)
             payloads[i] = make_canary(0);
     }
 
+    // Order the page initialization above with the list insertion publishing
+    // the page to the lock-free alloc fast path.
+    smp_wmb();
+
+    list_add(&pool_page->all_pages_node, &pool->pages);
+    atomic_add(UVM_SEMAPHORE_COUNT_PER_PAGE, &pool->free_semaphores_count);
+
     return NV_OK;
 
 error:
@@ -267,9 +278,9 @@ static void pool_free_page(uvm_gpu_semaphore_pool_page_t *page)
 
     // Assert that no semaphores are still allocated
     UVM_ASSERT(bitmap_full(page->free_semaphores, UVM_SEMAPHORE_COUNT_PER_PAGE));
-    UVM_ASSERT_MSG(pool->free_semaphores_count >= UVM_SEMAPHORE_COUNT_PER_PAGE,
-                   "count: %u\n",
-                   pool->free_semaphores_count);
+    UVM_ASSERT_MSG(atomic_read(&pool->free_semaphores_count) >= UVM_SEMAPHORE_COUNT_PER_PAGE,
+                   "count: %d\n",
+                   atomic_read(&pool->free_semaphores_count));
 
     if (semaphore_uses_canary(pool)) {
         size_t i;
@@ -278,35 +289,39 @@ static void pool_free_page(uvm_gpu_semaphore_pool_page_t *page)
             UVM_ASSERT(is_canary(payloads[i]));
     }
 
-    pool->free_semaphores_count -= UVM_SEMAPHORE_COUNT_PER_PAGE;
+    atomic_sub(UVM_SEMAPHORE_COUNT_PER_PAGE, &pool->free_semaphores_count);
     list_del(&page->all_pages_node);
     pool_page_free_buffers(page);
     uvm_kvfree(page);
 }
 
-NV_STATUS uvm_gpu_semaphore_alloc(uvm_gpu_semaphore_pool_t *pool, uvm_gpu_semaphore_t *semaphore)
+// Try to claim a free semaphore index anywhere in the pool without taking the
+// pool mutex. The page list can be walked locklessly because pages are only
+// ever added to the pool until it's destroyed, and they are fully initialized
+// before being published on the list.
+static bool semaphore_try_alloc(uvm_gpu_semaphore_pool_t *pool, uvm_gpu_semaphore_t *semaphore)
 {
-    NV_STATUS status = NV_OK;
     uvm_gpu_semaphore_pool_page_t *page;
 
-    memset(semaphore, 0, sizeof(*semaphore));
-
-    uvm_mutex_lock(&pool->mutex);
-
-    if (pool->free_semaphores_count == 0)
-        status = pool_alloc_page(pool);
-
-    if (status != NV_OK)
-        goto done;
-
     list_for_each_entry(page, &pool->pages, all_pages_node) {
-        const NvU32 semaphore_index = find_first_bit(page->free_semaphores, UVM_SEMAPHORE_COUNT_PER_PAGE);
+        NvU32 semaphore_index;
 
-        UVM_ASSERT(semaphore_index <= UVM_SEMAPHORE_COUNT_PER_PAGE);
+        do {
+            semaphore_index = find_first_bit(page->free_semaphores, UVM_SEMAPHORE_COUNT_PER_PAGE);
+            if (semaphore_index == UVM_SEMAPHORE_COUNT_PER_PAGE)
+                break;
+
+            // The index may be claimed by a concurrent allocation between the
+            // bitmap search and the atomic claim, so retry on failure.
+            // test_and_clear_bit orders the reads and writes of the semaphore
+            // state below after the claim.
+        } while (!test_and_clear_bit(semaphore_index, page->free_semaphores));
 
         if (semaphore_index == UVM_SEMAPHORE_COUNT_PER_PAGE)
             continue;
 
+        atomic_dec(&pool->free_semaphores_count);
+
         semaphore->page = page;
         semaphore->index = semaphore_index;
 
@@ -322,16 +337,34 @@ NV_STATUS uvm_gpu_semaphore_alloc(uvm_gpu_semaphore_pool_t *pool, uvm_gpu_semaph
 
         uvm_gpu_semaphore_set_payload(semaphore, 0);
 
-        __clear_bit(semaphore_index, page->free_semaphores);
-        --pool->free_semaphores_count;
-
-        goto done;
+        return true;
     }
 
-    UVM_ASSERT_MSG(0, "Failed to find a semaphore after allocating a new page\n");
-    status = NV_ERR_GENERIC;
+    return false;
+}
+
+NV_STATUS uvm_gpu_semaphore_alloc(uvm_gpu_semaphore_pool_t *pool, uvm_gpu_semaphore_t *semaphore)
+{
+    NV_STATUS status = NV_OK;
+
+    memset(semaphore, 0, sizeof(*semaphore));
+
+    // Fast path: claim a free index with atomic bitmap operations only
+    if (semaphore_try_alloc(pool, semaphore))
+        return NV_OK;
+
+    uvm_mutex_lock(&pool->mutex);
+
+    // Keep growing the pool until an index is claimed. A page freshly added
+    // by this thread may be drained by concurrent fast-path allocations
+    // before this thread can claim an index from it, so failure to allocate
+    // from the new page just means another attempt is needed.
+    while (!semaphore_try_alloc(pool, semaphore)) {
+        status = pool_alloc_page(pool);
+        if (status != NV_OK)
+            break;
+    }
 
-done:
     uvm_mutex_unlock(&pool->mutex);
 
     return status;
@@ -358,14 +391,14 @@ void uvm_gpu_semaphore_free(uvm_gpu_semaphore_t *semaphore)
     if (semaphore_uses_canary(pool))
         uvm_gpu_semaphore_set_payload(semaphore, make_canary(uvm_gpu_semaphore_get_payload(semaphore)));
 
-    uvm_mutex_lock(&pool->mutex);
-
     semaphore->page = NULL;
 
-    ++pool->free_semaphores_count;
-    __set_bit(semaphore->index, page->free_semaphores);
+    // Order the payload writes above with the bit release, which makes the
+    // index visible to the lock-free alloc fast path.
+    smp_mb__before_atomic();
+    set_bit(semaphore->index, page->free_semaphores);
 
-    uvm_mutex_unlock(&pool->mutex);
+    atomic_inc(&pool->free_semaphores_count);
 }
 
 NV_STATUS uvm_gpu_semaphore_pool_create(uvm_gpu_t *gpu, uvm_gpu_semaphore_pool_t **pool_out)
@@ -380,7 +413,7 @@ NV_STATUS uvm_gpu_semaphore_pool_create(uvm_gpu_t *gpu, uvm_gpu_semaphore_pool_t
 
     INIT_LIST_HEAD(&pool->pages);
 
-    pool->free_semaphores_count = 0;
+    atomic_set(&pool->free_semaphores_count, 0);
     pool->gpu = gpu;
     pool->aperture = UVM_APERTURE_SYS;
 
@@ -419,7 +452,9 @@ void uvm_gpu_semaphore_pool_destroy(uvm_gpu_semaphore_pool_t *pool)
     list_for_each_entry_safe(page, next_page, &pool->pages, all_pages_node)
         pool_free_page(page);
 
-    UVM_ASSERT_MSG(pool->free_semaphores_count == 0, "unused: %u", pool->free_semaphores_count);
+    UVM_ASSERT_MSG(atomic_read(&pool->free_semaphores_count) == 0,
+                   "unused: %d",
+                   atomic_read(&pool->free_semaphores_count));
     UVM_ASSERT(list_empty(&pool->pages));
 
     uvm_mutex_unlock(&pool->mutex);
@@ -375,6 +375,7 @@ static uvm_hal_class_ops_t fault_buffer_table[] =
             .write_get = uvm_hal_maxwell_fault_buffer_write_get_unsupported,
             .get_ve_id = uvm_hal_maxwell_fault_buffer_get_ve_id_unsupported,
             .parse_replayable_entry = uvm_hal_maxwell_fault_buffer_parse_replayable_entry_unsupported,
+            .parse_replayable_entries = uvm_hal_maxwell_fault_buffer_parse_replayable_entries,
             .entry_is_valid = uvm_hal_maxwell_fault_buffer_entry_is_valid_unsupported,
             .entry_clear_valid = uvm_hal_maxwell_fault_buffer_entry_clear_valid_unsupported,
             .entry_size = uvm_hal_maxwell_fault_buffer_entry_size_unsupported,
@@ -413,6 +414,7 @@ static uvm_hal_class_ops_t fault_buffer_table[] =
             .write_get = uvm_hal_volta_fault_buffer_write_get,
             .get_ve_id = uvm_hal_volta_fault_buffer_get_ve_id,
             .parse_replayable_entry = uvm_hal_volta_fault_buffer_parse_replayable_entry,
+            .parse_replayable_entries = uvm_hal_volta_fault_buffer_parse_replayable_entries,
             .parse_non_replayable_entry = uvm_hal_volta_fault_buffer_parse_non_replayable_entry,
             .get_fault_type = uvm_hal_volta_fault_buffer_get_fault_type,
         }
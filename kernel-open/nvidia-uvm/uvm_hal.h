@@ -503,6 +503,25 @@ NV_STATUS uvm_hal_volta_fault_buffer_parse_replayable_entry(uvm_parent_gpu_t *pa
                                                             NvU32 index,
                                                             uvm_fault_buffer_entry_t *buffer_entry);
 
+// Parse a run of count consecutive replayable entries starting at the given
+// buffer index. The entries must all be valid and the run must not wrap
+// around the end of the buffer. This also clears the valid bits of the
+// entries in the buffer.
+typedef NV_STATUS (*uvm_hal_fault_buffer_parse_replayable_entries_t)(uvm_parent_gpu_t *gpu,
+                                                                     NvU32 index,
+                                                                     NvU32 count,
+                                                                     uvm_fault_buffer_entry_t *buffer_entries);
+
+NV_STATUS uvm_hal_maxwell_fault_buffer_parse_replayable_entries(uvm_parent_gpu_t *parent_gpu,
+                                                                NvU32 index,
+                                                                NvU32 count,
+                                                                uvm_fault_buffer_entry_t *buffer_entries);
+
+NV_STATUS uvm_hal_volta_fault_buffer_parse_replayable_entries(uvm_parent_gpu_t *parent_gpu,
+                                                              NvU32 index,
+                                                              NvU32 count,
+                                                              uvm_fault_buffer_entry_t *buffer_entries);
+
 typedef bool (*uvm_hal_fault_buffer_entry_is_valid_t)(uvm_parent_gpu_t *parent_gpu, NvU32 index);
 typedef void (*uvm_hal_fault_buffer_entry_clear_valid_t)(uvm_parent_gpu_t *parent_gpu, NvU32 index);
 typedef NvU32 (*uvm_hal_fault_buffer_entry_size_t)(uvm_parent_gpu_t *parent_gpu);
@@ -779,6 +798,7 @@ struct uvm_fault_buffer_hal_struct
     uvm_hal_fault_buffer_write_get_t write_get;
     uvm_hal_fault_buffer_get_ve_id_t get_ve_id;
     uvm_hal_fault_buffer_parse_replayable_entry_t parse_replayable_entry;
+    uvm_hal_fault_buffer_parse_replayable_entries_t parse_replayable_entries;
     uvm_hal_fault_buffer_entry_is_valid_t entry_is_valid;
     uvm_hal_fault_buffer_entry_clear_valid_t entry_clear_valid;
     uvm_hal_fault_buffer_entry_size_t entry_size;
@@ -2338,6 +2338,15 @@ static bool hmm_range_fault_retry(uvm_va_block_t *va_block)
 
 // Make the region be resident on the CPU by calling hmm_range_fault() to fault
 // in CPU pages.
+//
+// Note that this is already batched as far as the surrounding architecture
+// allows: the caller holds mmap_lock across the whole GPU fault batch (see
+// service_fault_batch()), and all faults in the batch that land in this block
+// have been coalesced into the single region serviced here. Faulting a span
+// covering multiple blocks in one hmm_range_fault() call is not possible
+// because the result snapshot can only be validated against this block's
+// mmu_interval_notifier; pages outside the block could be invalidated without
+// detection.
 static NV_STATUS hmm_make_resident_cpu(uvm_va_block_t *va_block,
                                        struct vm_area_struct *vma,
                                        unsigned long *hmm_pfns,
@@ -1112,6 +1112,40 @@ typedef struct
     NV_STATUS               rmStatus; // OUT
 } UVM_MM_INITIALIZE_PARAMS;
 
+//
+// UvmMapExternalAllocationBatch
+//
+// Maps a batch of external allocations which share a single RM client and a
+// single set of per-GPU mapping attributes. Entries are processed in order.
+// On the first entry that fails, that entry's rmStatus identifies the cause,
+// mappings created by earlier entries are left in place, and the overall
+// rmStatus reflects the failing entry. Entries that were not processed have
+// rmStatus set to NV_WARN_NOTHING_TO_DO.
+//
+#define UVM_MAP_EXTERNAL_ALLOCATION_BATCH_MAX_ENTRIES                 256
+
+typedef struct
+{
+    NvU64     base   NV_ALIGN_BYTES(8); // IN
+    NvU64     length NV_ALIGN_BYTES(8); // IN
+    NvU64     offset NV_ALIGN_BYTES(8); // IN
+    NvU32     hMemory;                  // IN
+    NV_STATUS rmStatus;                 // OUT
+} UvmMapExternalAllocationBatchEntry;
+
+#define UVM_MAP_EXTERNAL_ALLOCATION_BATCH                             UVM_IOCTL_BASE(76)
+typedef struct
+{
+    NvP64                   entries                         NV_ALIGN_BYTES(8); // IN/OUT
+    NvU64                   entriesCount                    NV_ALIGN_BYTES(8); // IN
+    UvmGpuMappingAttributes perGpuAttributes[UVM_MAX_GPUS_V2];                 // IN
+    NvU64                   gpuAttributesCount              NV_ALIGN_BYTES(8); // IN
+    NvS32                   rmCtrlFd;                                          // IN
+    NvU32                   hClient;                                           // IN
+
+    NV_STATUS               rmStatus;                                          // OUT
+} UVM_MAP_EXTERNAL_ALLOCATION_BATCH_PARAMS;
+
 //
 // Temporary ioctls which should be removed before UVM 8 release
 // Number backwards from 2047 - highest custom ioctl function number
@@ -21,6 +21,7 @@
 
 *******************************************************************************/
 
+#include "linux/hash.h"
 #include "uvm_common.h"
 #include "uvm_linux.h"
 #include "uvm_global.h"
@@ -60,6 +61,23 @@ typedef enum
 // fine, but the leak checker would get confused.
 static bool g_malloc_initialized = false;
 
+// Number of shards the outstanding allocation table is split into. Every
+// tracked alloc and free takes the lock of the shard its address hashes to, so
+// this bounds the number of CPUs that can contend on any one lock in
+// allocation-heavy phases. Must be a power of two.
+#define UVM_LEAK_CHECKER_SHARD_SHIFT 4
+#define UVM_LEAK_CHECKER_SHARD_COUNT (1 << UVM_LEAK_CHECKER_SHARD_SHIFT)
+
+typedef struct
+{
+    // Use a raw spinlock rather than a uvm_spinlock_t because the kvmalloc
+    // layer is initialized and torn down before the thread context layer.
+    spinlock_t lock;
+
+    // Outstanding allocations whose addresses hash to this shard
+    uvm_rb_tree_t allocation_info;
+} uvm_kvmalloc_shard_t;
+
 static struct
 {
     // Current outstanding bytes allocated
@@ -69,16 +87,19 @@ static struct
     // for sanity checks.
     atomic_long_t untracked_allocations;
 
-    // Use a raw spinlock rather than a uvm_spinlock_t because the kvmalloc
-    // layer is initialized and torn down before the thread context layer.
-    spinlock_t lock;
-
-    // Table of all outstanding allocations
-    uvm_rb_tree_t allocation_info;
+    // Table of all outstanding allocations, sharded by a hash of the
+    // allocation address so that concurrent allocs and frees on different CPUs
+    // don't all serialize on a single lock.
+    uvm_kvmalloc_shard_t shards[UVM_LEAK_CHECKER_SHARD_COUNT];
 
     struct kmem_cache *info_cache;
 } g_uvm_leak_checker;
 
+static uvm_kvmalloc_shard_t *get_shard(void *p)
+{
+    return &g_uvm_leak_checker.shards[hash_long((unsigned long)p, UVM_LEAK_CHECKER_SHARD_SHIFT)];
+}
+
 // Default to byte-count-only leak checking for non-release builds. This can
 // always be overridden by the module parameter.
 static int uvm_leak_checker = (UVM_IS_DEBUG() || UVM_IS_DEVELOP()) ?
@@ -93,8 +114,12 @@ MODULE_PARM_DESC(uvm_leak_checker,
 NV_STATUS uvm_kvmalloc_init(void)
 {
     if (uvm_leak_checker >= UVM_KVMALLOC_LEAK_CHECK_ORIGIN) {
-        spin_lock_init(&g_uvm_leak_checker.lock);
-        uvm_rb_tree_init(&g_uvm_leak_checker.allocation_info);
+        size_t i;
+
+        for (i = 0; i < UVM_LEAK_CHECKER_SHARD_COUNT; i++) {
+            spin_lock_init(&g_uvm_leak_checker.shards[i].lock);
+            uvm_rb_tree_init(&g_uvm_leak_checker.shards[i].allocation_info);
+        }
 
         g_uvm_leak_checker.info_cache = NV_KMEM_CACHE_CREATE("uvm_kvmalloc_info_t", uvm_kvmalloc_info_t);
         if (!g_uvm_leak_checker.info_cache)
@@ -125,21 +150,24 @@ void uvm_kvmalloc_exit(void)
 
     if (uvm_leak_checker >= UVM_KVMALLOC_LEAK_CHECK_ORIGIN) {
         uvm_rb_tree_node_t *node, *next;
-
-        uvm_rb_tree_for_each_safe(node, next, &g_uvm_leak_checker.allocation_info) {
-            uvm_kvmalloc_info_t *info = container_of(node, uvm_kvmalloc_info_t, node);
-
-            printk(KERN_ERR NVIDIA_UVM_PRETTY_PRINTING_PREFIX "    Leaked %zu bytes from %s:%d:%s (0x%llx)\n",
-                   uvm_kvsize((void *)((uintptr_t)info->node.key)),
-                   kbasename(info->file),
-                   info->line,
-                   info->function,
-                   info->node.key);
-
-            // Free so we don't keep eating up memory while debugging. Note that
-            // this also removes the entry from the table, frees info, and drops
-            // the allocated bytes count.
-            uvm_kvfree((void *)((uintptr_t)info->node.key));
+        size_t i;
+
+        for (i = 0; i < UVM_LEAK_CHECKER_SHARD_COUNT; i++) {
+            uvm_rb_tree_for_each_safe(node, next, &g_uvm_leak_checker.shards[i].allocation_info) {
+                uvm_kvmalloc_info_t *info = container_of(node, uvm_kvmalloc_info_t, node);
+
+                printk(KERN_ERR NVIDIA_UVM_PRETTY_PRINTING_PREFIX "    Leaked %zu bytes from %s:%d:%s (0x%llx)\n",
+                       uvm_kvsize((void *)((uintptr_t)info->node.key)),
+                       kbasename(info->file),
+                       info->line,
+                       info->function,
+                       info->node.key);
+
+                // Free so we don't keep eating up memory while debugging. Note
+                // that this also removes the entry from the table, frees info,
+                // and drops the allocated bytes count.
+                uvm_kvfree((void *)((uintptr_t)info->node.key));
+            }
         }
 
         if (atomic_long_read(&g_uvm_leak_checker.untracked_allocations) == 0)
@@ -153,12 +181,13 @@ void uvm_kvmalloc_exit(void)
 
 static void insert_info(uvm_kvmalloc_info_t *info)
 {
+    uvm_kvmalloc_shard_t *shard = get_shard((void *)((uintptr_t)info->node.key));
     NV_STATUS status;
     unsigned long irq_flags;
 
-    spin_lock_irqsave(&g_uvm_leak_checker.lock, irq_flags);
-    status = uvm_rb_tree_insert(&g_uvm_leak_checker.allocation_info, &info->node);
-    spin_unlock_irqrestore(&g_uvm_leak_checker.lock, irq_flags);
+    spin_lock_irqsave(&shard->lock, irq_flags);
+    status = uvm_rb_tree_insert(&shard->allocation_info, &info->node);
+    spin_unlock_irqrestore(&shard->lock, irq_flags);
 
     // We shouldn't have duplicates
     UVM_ASSERT(status == NV_OK);
@@ -166,15 +195,16 @@ static void insert_info(uvm_kvmalloc_info_t *info)
 
 static uvm_kvmalloc_info_t *remove_info(void *p)
 {
+    uvm_kvmalloc_shard_t *shard = get_shard(p);
     uvm_rb_tree_node_t *node;
     uvm_kvmalloc_info_t *info = NULL;
     unsigned long irq_flags;
 
-    spin_lock_irqsave(&g_uvm_leak_checker.lock, irq_flags);
-    node = uvm_rb_tree_find(&g_uvm_leak_checker.allocation_info, (NvU64)p);
+    spin_lock_irqsave(&shard->lock, irq_flags);
+    node = uvm_rb_tree_find(&shard->allocation_info, (NvU64)p);
     if (node)
-        uvm_rb_tree_remove(&g_uvm_leak_checker.allocation_info, node);
-    spin_unlock_irqrestore(&g_uvm_leak_checker.lock, irq_flags);
+        uvm_rb_tree_remove(&shard->allocation_info, node);
+    spin_unlock_irqrestore(&shard->lock, irq_flags);
 
     if (!node) {
         UVM_ASSERT(atomic_long_read(&g_uvm_leak_checker.untracked_allocations) > 0);
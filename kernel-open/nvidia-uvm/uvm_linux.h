@@ -48,6 +48,7 @@
 
 #include <linux/jhash.h>
 #include <linux/rwsem.h>
+#include <linux/percpu-rwsem.h>
 #include <linux/rbtree.h>
 
 #if defined(NV_ASM_BARRIER_H_PRESENT)
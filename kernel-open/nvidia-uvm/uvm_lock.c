@@ -65,6 +65,7 @@ const char *uvm_lock_order_to_string(uvm_lock_order_t lock_order)
         UVM_ENUM_STRING_CASE(UVM_LOCK_ORDER_SEMA_POOL_TRACKER);
         UVM_ENUM_STRING_CASE(UVM_LOCK_ORDER_SECURE_SEMAPHORE);
         UVM_ENUM_STRING_CASE(UVM_LOCK_ORDER_CSL_CTX);
+        UVM_ENUM_STRING_CASE(UVM_LOCK_ORDER_PMM_MAGAZINE);
         UVM_ENUM_STRING_CASE(UVM_LOCK_ORDER_LEAF);
         UVM_ENUM_STRING_DEFAULT();
     }
@@ -449,9 +449,13 @@
 //
 // - VA space events
 //      Order: UVM_LOCK_ORDER_VA_SPACE_EVENTS
-//      Reader/writer lock (rw_semaphore) per uvm_perf_va_space_events_t.
+//      Reader/writer lock (percpu_rw_semaphore) per uvm_perf_va_space_events_t.
 //      serializes perf callbacks with event register/unregister. It's separate
-//      from the VA space lock so it can be taken on the eviction path.
+//      from the VA space lock so it can be taken on the eviction path. A
+//      per-CPU semaphore is used because the read side sits on the fault and
+//      migration paths: readers only touch per-CPU state, while the rare
+//      writers (tools event queue register/unregister) pay for an RCU grace
+//      period.
 //
 // - VA space tools
 //      Order: UVM_LOCK_ORDER_VA_SPACE_TOOLS
@@ -473,6 +477,15 @@
 //      operations to communicate with GPU are handled by the CSL context.
 //      This lock protects RM calls that use this context.
 //
+// - PMM chunk magazine lock
+//      Order: UVM_LOCK_ORDER_PMM_MAGAZINE
+//      Exclusive lock (spinlock)
+//
+//      Protects a per-CPU magazine of free GPU memory chunks kept in front of
+//      the PMM free lists. It is taken on its own by the chunk allocation and
+//      free fast paths, and before the PMM list lock (a leaf lock) when a
+//      magazine is refilled from the free lists.
+//
 // - Leaf locks
 //      Order: UVM_LOCK_ORDER_LEAF
 //
@@ -523,6 +536,7 @@ typedef enum
     // This lock order can be removed after RM no longer relies on RPC event
     // notifications.
     UVM_LOCK_ORDER_CSL_CTX,
+    UVM_LOCK_ORDER_PMM_MAGAZINE,
     UVM_LOCK_ORDER_LEAF,
     UVM_LOCK_ORDER_COUNT,
 } uvm_lock_order_t;
@@ -874,6 +888,74 @@ typedef struct
         uvm_record_downgrade(_sem);                     \
     })
 
+// Variant of uvm_rw_semaphore_t for read-mostly locks on hot paths. The read
+// side only updates per-CPU state when no writer is active, so concurrent
+// readers don't bounce a shared cacheline. Writers are much more expensive
+// than with a regular rw_semaphore (they include an RCU grace period), so
+// this is only appropriate when write acquisitions are rare.
+typedef struct
+{
+    struct percpu_rw_semaphore sem;
+#if UVM_IS_DEBUG()
+    uvm_lock_order_t lock_order;
+#endif
+} uvm_percpu_rw_semaphore_t;
+
+// Unlike uvm_init_rwsem this can fail, since the kernel allocates the per-CPU
+// reader counts dynamically. Returns 0 on success and -errno on failure.
+#define uvm_percpu_init_rwsem(uvm_sem, order) ({                   \
+        uvm_percpu_rw_semaphore_t *uvm_sem_ ## order = (uvm_sem);  \
+        int __ret = percpu_init_rwsem(&uvm_sem_ ## order->sem);    \
+        if (__ret == 0)                                            \
+            uvm_lock_debug_init(uvm_sem, order);                   \
+        __ret;                                                     \
+    })
+
+#define uvm_percpu_free_rwsem(uvm_sem) percpu_free_rwsem(&(uvm_sem)->sem)
+
+// The kernel's percpu_rw_semaphore has no cheap is-locked query, so these
+// asserts rely only on UVM's own lock tracking, which is active in debug mode
+// and when the builtin tests are enabled.
+#define uvm_assert_percpu_rwsem_locked_mode(uvm_sem, flags) ({ \
+        typeof(uvm_sem) _sem_ = (uvm_sem);                     \
+        UVM_ASSERT(uvm_check_locked(_sem_, (flags)));          \
+    })
+
+#define uvm_assert_percpu_rwsem_locked(uvm_sem) \
+        uvm_assert_percpu_rwsem_locked_mode(uvm_sem, UVM_LOCK_FLAGS_MODE_ANY)
+#define uvm_assert_percpu_rwsem_locked_read(uvm_sem) \
+        uvm_assert_percpu_rwsem_locked_mode(uvm_sem, UVM_LOCK_FLAGS_MODE_SHARED)
+#define uvm_assert_percpu_rwsem_locked_write(uvm_sem) \
+        uvm_assert_percpu_rwsem_locked_mode(uvm_sem, UVM_LOCK_FLAGS_MODE_EXCLUSIVE)
+
+#define uvm_percpu_down_read(uvm_sem) ({                   \
+        typeof(uvm_sem) _sem = (uvm_sem);                  \
+        uvm_record_lock(_sem, UVM_LOCK_FLAGS_MODE_SHARED); \
+        percpu_down_read(&_sem->sem);                      \
+        uvm_assert_percpu_rwsem_locked_read(_sem);         \
+    })
+
+#define uvm_percpu_up_read(uvm_sem) ({                       \
+        typeof(uvm_sem) _sem = (uvm_sem);                    \
+        uvm_assert_percpu_rwsem_locked_read(_sem);           \
+        percpu_up_read(&_sem->sem);                          \
+        uvm_record_unlock(_sem, UVM_LOCK_FLAGS_MODE_SHARED); \
+    })
+
+#define uvm_percpu_down_write(uvm_sem) ({                     \
+        typeof(uvm_sem) _sem = (uvm_sem);                     \
+        uvm_record_lock(_sem, UVM_LOCK_FLAGS_MODE_EXCLUSIVE); \
+        percpu_down_write(&_sem->sem);                        \
+        uvm_assert_percpu_rwsem_locked_write(_sem);           \
+    })
+
+#define uvm_percpu_up_write(uvm_sem) ({                         \
+        typeof(uvm_sem) _sem = (uvm_sem);                       \
+        uvm_assert_percpu_rwsem_locked_write(_sem);             \
+        percpu_up_write(&_sem->sem);                            \
+        uvm_record_unlock(_sem, UVM_LOCK_FLAGS_MODE_EXCLUSIVE); \
+    })
+
 typedef struct
 {
     struct mutex m;
@@ -1086,6 +1086,168 @@ NV_STATUS uvm_api_map_external_allocation(UVM_MAP_EXTERNAL_ALLOCATION_PARAMS *pa
     return uvm_map_external_allocation(va_space, params);
 }
 
+// Tear down the mappings a single batch entry created on the given GPUs
+static void map_external_batch_entry_teardown(uvm_va_range_t *va_range,
+                                              uvm_gpu_t **mapping_gpus,
+                                              size_t num_gpus,
+                                              NvU64 base,
+                                              NvU64 length)
+{
+    size_t i;
+
+    for (i = 0; i < num_gpus; i++) {
+        uvm_ext_gpu_range_tree_t *range_tree = uvm_ext_gpu_range_tree(va_range, mapping_gpus[i]);
+        uvm_ext_gpu_map_t *ext_map, *ext_map_next;
+
+        uvm_mutex_lock(&range_tree->lock);
+        uvm_ext_gpu_map_for_each_in_safe(ext_map, ext_map_next, va_range, mapping_gpus[i], base, base + length - 1)
+            uvm_ext_gpu_map_destroy(va_range, ext_map, NULL);
+        uvm_mutex_unlock(&range_tree->lock);
+    }
+}
+
+// Actual implementation of UvmMapExternalAllocationBatch
+static NV_STATUS uvm_map_external_allocation_batch(uvm_va_space_t *va_space,
+                                                   UVM_MAP_EXTERNAL_ALLOCATION_BATCH_PARAMS *params)
+{
+    UvmMapExternalAllocationBatchEntry *entries;
+    uvm_gpu_t *mapping_gpus[UVM_MAX_GPUS_V2];
+    uvm_tracker_t tracker = UVM_TRACKER_INIT();
+    NV_STATUS status = NV_OK;
+    NV_STATUS tracker_status;
+    size_t entries_size;
+    size_t i, gpu_index;
+
+    if (params->entriesCount == 0 || params->entriesCount > UVM_MAP_EXTERNAL_ALLOCATION_BATCH_MAX_ENTRIES)
+        return NV_ERR_INVALID_ARGUMENT;
+
+    if (params->gpuAttributesCount == 0 || params->gpuAttributesCount > UVM_MAX_GPUS_V2)
+        return NV_ERR_INVALID_ARGUMENT;
+
+    // The mapping attributes are shared by all entries, so they only need to
+    // be validated once.
+    for (gpu_index = 0; gpu_index < params->gpuAttributesCount; gpu_index++) {
+        if (uvm_api_mapping_type_invalid(params->perGpuAttributes[gpu_index].gpuMappingType) ||
+            uvm_api_caching_type_invalid(params->perGpuAttributes[gpu_index].gpuCachingType) ||
+            uvm_api_kind_type_invalid(params->perGpuAttributes[gpu_index].gpuFormatType,
+                                      params->perGpuAttributes[gpu_index].gpuElementBits,
+                                      params->perGpuAttributes[gpu_index].gpuCompressionType))
+            return NV_ERR_INVALID_ARGUMENT;
+    }
+
+    entries_size = sizeof(entries[0]) * params->entriesCount;
+    entries = uvm_kvmalloc(entries_size);
+    if (!entries)
+        return NV_ERR_NO_MEMORY;
+
+    if (nv_copy_from_user(entries, (void __user *)params->entries, entries_size)) {
+        uvm_kvfree(entries);
+        return NV_ERR_INVALID_ARGUMENT;
+    }
+
+    for (i = 0; i < params->entriesCount; i++)
+        entries[i].rmStatus = NV_WARN_NOTHING_TO_DO;
+
+    // Take the VA space lock once for the whole batch so the RM calls and
+    // page table writes of all the entries are issued back-to-back.
+    uvm_va_space_down_read_rm(va_space);
+
+    // The GPU list is also common to all entries, so resolve it up front
+    for (gpu_index = 0; gpu_index < params->gpuAttributesCount; gpu_index++) {
+        mapping_gpus[gpu_index] = uvm_va_space_get_gpu_by_uuid_with_gpu_va_space(va_space,
+                                                                                 &params->perGpuAttributes[gpu_index].gpuUuid);
+        if (!mapping_gpus[gpu_index]) {
+            status = NV_ERR_INVALID_DEVICE;
+            goto out;
+        }
+    }
+
+    for (i = 0; i < params->entriesCount; i++) {
+        UvmMapExternalAllocationBatchEntry *entry = &entries[i];
+        uvm_va_range_t *va_range;
+        uvm_rm_user_object_t user_rm_mem =
+        {
+            .rm_control_fd = params->rmCtrlFd,
+            .user_client   = params->hClient,
+            .user_object   = entry->hMemory
+        };
+        NV_STATUS entry_status = NV_OK;
+
+        if (uvm_api_range_invalid_4k(entry->base, entry->length)) {
+            entry->rmStatus = NV_ERR_INVALID_ADDRESS;
+            status = NV_ERR_INVALID_ADDRESS;
+            goto out;
+        }
+
+        va_range = uvm_va_range_find(va_space, entry->base);
+        if (!va_range ||
+            va_range->type != UVM_VA_RANGE_TYPE_EXTERNAL ||
+            va_range->node.end < entry->base + entry->length - 1) {
+            entry->rmStatus = NV_ERR_INVALID_ADDRESS;
+            status = NV_ERR_INVALID_ADDRESS;
+            goto out;
+        }
+
+        // Share one tracker across all entries and GPUs so the page table
+        // writes of the whole batch can be in flight simultaneously, with a
+        // single wait at the end instead of one wait per ioctl.
+        for (gpu_index = 0; gpu_index < params->gpuAttributesCount; gpu_index++) {
+            uvm_map_rm_params_t map_rm_params;
+
+            map_rm_params.map_offset = entry->offset;
+            map_rm_params.mapping_type = params->perGpuAttributes[gpu_index].gpuMappingType;
+            map_rm_params.caching_type = params->perGpuAttributes[gpu_index].gpuCachingType;
+            map_rm_params.format_type = params->perGpuAttributes[gpu_index].gpuFormatType;
+            map_rm_params.element_bits = params->perGpuAttributes[gpu_index].gpuElementBits;
+            map_rm_params.compression_type = params->perGpuAttributes[gpu_index].gpuCompressionType;
+            entry_status = uvm_map_external_allocation_on_gpu(va_range,
+                                                              mapping_gpus[gpu_index],
+                                                              &user_rm_mem,
+                                                              &map_rm_params,
+                                                              entry->base,
+                                                              entry->length,
+                                                              &tracker);
+            if (entry_status != NV_OK)
+                break;
+        }
+
+        entry->rmStatus = entry_status;
+
+        if (entry_status != NV_OK) {
+            // We still have to wait for page table writes to finish, since the
+            // teardown could free them. Mappings created by earlier entries
+            // are left in place.
+            (void)uvm_tracker_wait(&tracker);
+            map_external_batch_entry_teardown(va_range, mapping_gpus, gpu_index, entry->base, entry->length);
+            status = entry_status;
+            goto out;
+        }
+    }
+
+out:
+    // Wait for outstanding page table operations to finish across all GPUs. We
+    // just need to hold the VA space lock to prevent the GPUs on which we're
+    // waiting from getting unregistered underneath us.
+    tracker_status = uvm_tracker_wait_deinit(&tracker);
+    if (status == NV_OK)
+        status = tracker_status;
+
+    uvm_va_space_up_read_rm(va_space);
+
+    if (nv_copy_to_user((void __user *)params->entries, entries, entries_size) && status == NV_OK)
+        status = NV_ERR_INVALID_ARGUMENT;
+
+    uvm_kvfree(entries);
+
+    return status;
+}
+
+NV_STATUS uvm_api_map_external_allocation_batch(UVM_MAP_EXTERNAL_ALLOCATION_BATCH_PARAMS *params, struct file *filp)
+{
+    uvm_va_space_t *va_space = uvm_va_space_get(filp);
+    return uvm_map_external_allocation_batch(va_space, params);
+}
+
 static NvU64 external_sparse_pte_maker(uvm_page_table_range_vec_t *range_vec, NvU64 offset, void *caller_data)
 {
     return range_vec->tree->hal->make_sparse_pte();
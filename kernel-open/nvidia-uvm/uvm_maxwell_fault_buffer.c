@@ -90,6 +90,26 @@ NV_STATUS uvm_hal_maxwell_fault_buffer_parse_replayable_entry_unsupported(uvm_pa
     return NV_ERR_NOT_SUPPORTED;
 }
 
+// Generic implementation for GPUs without a batched parse: defer to the
+// per-entry parse.
+NV_STATUS uvm_hal_maxwell_fault_buffer_parse_replayable_entries(uvm_parent_gpu_t *parent_gpu,
+                                                                NvU32 index,
+                                                                NvU32 count,
+                                                                uvm_fault_buffer_entry_t *buffer_entries)
+{
+    NvU32 i;
+
+    for (i = 0; i < count; ++i) {
+        NV_STATUS status = parent_gpu->fault_buffer_hal->parse_replayable_entry(parent_gpu,
+                                                                                index + i,
+                                                                                &buffer_entries[i]);
+        if (status != NV_OK)
+            return status;
+    }
+
+    return NV_OK;
+}
+
 bool uvm_hal_maxwell_fault_buffer_entry_is_valid_unsupported(uvm_parent_gpu_t *parent_gpu, NvU32 index)
 {
     UVM_ASSERT_MSG(false,
@@ -32,6 +32,7 @@
 #include "uvm_va_block.h"
 #include "uvm_tracker.h"
 #include "uvm_api.h"
+#include "uvm_test.h"
 #include "uvm_channel.h"
 #include "uvm_processors.h"
 #include "uvm_push.h"
@@ -56,6 +57,13 @@ module_param(uvm_perf_migrate_cpu_preunmap_enable, int, S_IRUGO);
 static unsigned uvm_perf_migrate_cpu_preunmap_block_order = UVM_PERF_MIGRATE_CPU_PREUNMAP_BLOCK_ORDER_DEFAULT;
 module_param(uvm_perf_migrate_cpu_preunmap_block_order, uint, S_IRUGO);
 
+// Minimum number of VA blocks a migration must span before its copies are
+// striped over all CE channel pools, so different blocks can be transferred
+// by different CEs concurrently. 0 disables multi-CE striping.
+#define UVM_PERF_MIGRATE_MULTI_CE_MIN_BLOCKS_DEFAULT 4
+static unsigned uvm_perf_migrate_multi_ce_min_blocks = UVM_PERF_MIGRATE_MULTI_CE_MIN_BLOCKS_DEFAULT;
+module_param(uvm_perf_migrate_multi_ce_min_blocks, uint, S_IRUGO);
+
 // Global post-processed values of the module parameters
 static bool g_uvm_perf_migrate_cpu_preunmap_enable __read_mostly;
 static NvU64 g_uvm_perf_migrate_cpu_preunmap_size __read_mostly;
@@ -447,8 +455,11 @@ static NV_STATUS uvm_va_range_migrate_multi_block(uvm_va_range_t *va_range,
                                                   uvm_tracker_t *out_tracker)
 {
     size_t i;
+    NV_STATUS status = NV_OK;
     const size_t first_block_index = uvm_va_range_block_index(va_range, start);
     const size_t last_block_index = uvm_va_range_block_index(va_range, end);
+    const bool stripe_copies = (uvm_perf_migrate_multi_ce_min_blocks > 0) &&
+                               (last_block_index - first_block_index + 1 >= uvm_perf_migrate_multi_ce_min_blocks);
 
     UVM_ASSERT(start >= va_range->node.start);
     UVM_ASSERT(end  <= va_range->node.end);
@@ -462,15 +473,23 @@ static NV_STATUS uvm_va_range_migrate_multi_block(uvm_va_range_t *va_range,
         uvm_va_block_retry_t va_block_retry;
         uvm_va_block_region_t region;
         uvm_va_block_t *va_block;
-        NV_STATUS status = uvm_va_range_block_create(va_range, i, &va_block);
 
+        status = uvm_va_range_block_create(va_range, i, &va_block);
         if (status != NV_OK)
-            return status;
+            break;
 
         region = uvm_va_block_region_from_start_end(va_block,
                                                     max(start, va_block->start),
                                                     min(end, va_block->end));
 
+        // Stripe the copies of large migrations over all CE channel pools,
+        // round-robin by block index. Each block's pushes are tracked in the
+        // block tracker and merged into out_tracker by
+        // uvm_va_block_migrate_locked(), so the per-CE copies are collected in
+        // a single tracker the caller waits on at the end of the migration.
+        if (stripe_copies)
+            service_context->block_context->make_resident.copy_stripe = (NvS32)(i - first_block_index);
+
         status = UVM_VA_BLOCK_LOCK_RETRY(va_block,
                                          &va_block_retry,
                                          uvm_va_block_migrate_locked(va_block,
@@ -481,10 +500,13 @@ static NV_STATUS uvm_va_range_migrate_multi_block(uvm_va_range_t *va_range,
                                                                      mode,
                                                                      out_tracker));
         if (status != NV_OK)
-            return status;
+            break;
     }
 
-    return NV_OK;
+    if (stripe_copies)
+        service_context->block_context->make_resident.copy_stripe = -1;
+
+    return status;
 }
 
 static NV_STATUS uvm_va_range_migrate(uvm_va_range_t *va_range,
@@ -1146,3 +1168,109 @@ done:
 
     return status == NV_OK? tracker_status : status;
 }
+
+NV_STATUS uvm_test_perf_migration_bw(UVM_TEST_PERF_MIGRATION_BW_PARAMS *params, struct file *filp)
+{
+    uvm_va_space_t *va_space = uvm_va_space_get(filp);
+    uvm_tracker_t tracker = UVM_TRACKER_INIT();
+    uvm_va_range_t *first_va_range;
+    uvm_gpu_t *gpu;
+    struct mm_struct *mm;
+    uvm_api_range_type_t type;
+    NV_STATUS status = NV_OK;
+    NV_STATUS tracker_status;
+    NvU64 start_ns;
+    NvU32 iter = 0;
+
+    if (params->iterations == 0)
+        return NV_ERR_INVALID_ARGUMENT;
+
+    if (uvm_api_range_invalid(params->base, params->length))
+        return NV_ERR_INVALID_ADDRESS;
+
+    // mmap_lock will be needed if we have to create CPU mappings
+    mm = uvm_va_space_mm_or_current_retain_lock(va_space);
+    uvm_va_space_down_read(va_space);
+
+    gpu = uvm_va_space_get_gpu_by_uuid_with_gpu_va_space(va_space, &params->gpu_uuid);
+    if (!gpu) {
+        status = NV_ERR_INVALID_DEVICE;
+        goto done;
+    }
+
+    if (!uvm_gpu_can_address(gpu, params->base, params->length)) {
+        status = NV_ERR_OUT_OF_RANGE;
+        goto done;
+    }
+
+    type = uvm_api_range_type_check(va_space, mm, params->base, params->length);
+    if (type == UVM_API_RANGE_TYPE_INVALID) {
+        status = NV_ERR_INVALID_ADDRESS;
+        goto done;
+    }
+
+    // Pageable memory takes the migrate_vma path, whose cost structure is very
+    // different from the copy engine path this benchmark is meant to measure
+    if (type == UVM_API_RANGE_TYPE_ATS) {
+        status = NV_ERR_NOT_SUPPORTED;
+        goto done;
+    }
+
+    first_va_range = uvm_va_space_iter_first(va_space, params->base, params->base);
+
+    start_ns = NV_GETTIME();
+
+    // Ping-pong the range between the GPU and the CPU, waiting for each
+    // transfer to complete so the reported time measures migration bandwidth
+    // rather than work submission throughput
+    for (iter = 0; iter < params->iterations; ++iter) {
+        status = uvm_migrate(va_space,
+                             mm,
+                             params->base,
+                             params->length,
+                             gpu->id,
+                             NUMA_NO_NODE,
+                             0,
+                             first_va_range,
+                             &tracker);
+        if (status == NV_OK)
+            status = uvm_tracker_wait(&tracker);
+        if (status != NV_OK)
+            break;
+
+        status = uvm_migrate(va_space,
+                             mm,
+                             params->base,
+                             params->length,
+                             UVM_ID_CPU,
+                             NUMA_NO_NODE,
+                             0,
+                             first_va_range,
+                             &tracker);
+        if (status == NV_OK)
+            status = uvm_tracker_wait(&tracker);
+        if (status != NV_OK)
+            break;
+
+        if (fatal_signal_pending(current)) {
+            status = NV_ERR_SIGNAL_PENDING;
+            break;
+        }
+    }
+
+    // Only completed round trips are reported, so a failed or interrupted run
+    // still returns a meaningful bandwidth
+    params->total_ns = NV_GETTIME() - start_ns;
+    params->total_bytes = 2 * params->length * iter;
+
+done:
+    tracker_status = uvm_tracker_wait_deinit(&tracker);
+
+    if (mm)
+        uvm_up_read_mmap_lock_out_of_order(mm);
+
+    uvm_va_space_up_read(va_space);
+    uvm_va_space_mm_or_current_release(va_space, mm);
+
+    return status == NV_OK? tracker_status : status;
+}
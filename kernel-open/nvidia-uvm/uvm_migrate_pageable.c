@@ -39,6 +39,12 @@ static struct kmem_cache *g_uvm_migrate_vma_state_cache __read_mostly;
 
 static const gfp_t g_migrate_vma_gfp_flags = NV_UVM_GFP_FLAGS | GFP_HIGHUSER_MOVABLE | __GFP_THISNODE;
 
+// Pipeline chunks of pageable migrations so the CPU-side page isolation and
+// population of one chunk overlaps the GPU copy of the previous one. Requires
+// the migrate_vma_setup() flavor of the kernel API.
+static int uvm_perf_migrate_pageable_pipeline_enable = 1;
+module_param(uvm_perf_migrate_pageable_pipeline_enable, int, S_IRUGO);
+
 // Compute the address needed for copying_gpu to access the given page,
 // resident on resident_id.
 static NV_STATUS migrate_vma_page_copy_address(struct page *page,
@@ -523,12 +529,14 @@ void migrate_vma_cleanup_pages(unsigned long *dst, unsigned long npages)
     }
 }
 
-void uvm_migrate_vma_alloc_and_copy(struct migrate_vma *args, migrate_vma_state_t *state)
+// Allocate the destination pages and push the population and copy work to the
+// GPU, without waiting for it to complete. The work pushed on behalf of the
+// chunk is collected in state->tracker.
+static void migrate_vma_alloc_and_copy_begin(struct migrate_vma *args, migrate_vma_state_t *state)
 {
     struct vm_area_struct *vma = args->vma;
     unsigned long start = args->start;
     unsigned long outer = args->end;
-    NV_STATUS tracker_status;
 
     uvm_tracker_init(&state->tracker);
 
@@ -541,9 +549,13 @@ void uvm_migrate_vma_alloc_and_copy(struct migrate_vma *args, migrate_vma_state_
 
     if (state->status == NV_OK)
         state->status = migrate_vma_copy_pages(vma, args->src, args->dst, start, outer, state);
+}
 
-    // Wait for tracker since all copies must have completed before returning
-    tracker_status = uvm_tracker_wait_deinit(&state->tracker);
+// Wait for the work pushed by migrate_vma_alloc_and_copy_begin(). All copies
+// must have completed before the pages are finalized.
+static void migrate_vma_alloc_and_copy_finish(struct migrate_vma *args, migrate_vma_state_t *state)
+{
+    NV_STATUS tracker_status = uvm_tracker_wait_deinit(&state->tracker);
 
     if (state->status == NV_OK)
         state->status = tracker_status;
@@ -553,6 +565,12 @@ void uvm_migrate_vma_alloc_and_copy(struct migrate_vma *args, migrate_vma_state_
         migrate_vma_cleanup_pages(args->dst, state->num_pages);
 }
 
+void uvm_migrate_vma_alloc_and_copy(struct migrate_vma *args, migrate_vma_state_t *state)
+{
+    migrate_vma_alloc_and_copy_begin(args, state);
+    migrate_vma_alloc_and_copy_finish(args, state);
+}
+
 void uvm_migrate_vma_alloc_and_copy_helper(struct vm_area_struct *vma,
                                 const unsigned long *src,
                                 unsigned long *dst,
@@ -697,6 +715,47 @@ static NV_STATUS nv_migrate_vma(struct migrate_vma *args, migrate_vma_state_t *s
     return state->status;
 }
 
+#if !defined(CONFIG_MIGRATE_VMA_HELPER)
+
+// Start a migrate_vma chunk: isolate the source pages and push the population
+// and copy work to the GPU, without waiting for it to complete. On success the
+// chunk must be completed with migrate_vma_finish(), even if the pushes failed;
+// the failure is recorded in state->status and handled on finish.
+static NV_STATUS migrate_vma_begin(struct migrate_vma *args, migrate_vma_state_t *state)
+{
+    int ret;
+
+#if defined(NV_MIGRATE_VMA_FLAGS_PRESENT)
+    args->flags = MIGRATE_VMA_SELECT_SYSTEM;
+#endif // NV_MIGRATE_VMA_FLAGS_PRESENT
+
+    ret = migrate_vma_setup(args);
+    if (ret < 0)
+        return errno_to_nv_status(ret);
+
+    migrate_vma_alloc_and_copy_begin(args, state);
+
+    return NV_OK;
+}
+
+// Complete a chunk started with migrate_vma_begin(): wait for the pushed work
+// and publish (or, on failure, roll back) the destination pages.
+static NV_STATUS migrate_vma_finish(struct migrate_vma *args, migrate_vma_state_t *state)
+{
+    migrate_vma_alloc_and_copy_finish(args, state);
+
+    if (state->status == NV_OK) {
+        migrate_vma_pages(args);
+        uvm_migrate_vma_finalize_and_map(args, state);
+    }
+
+    migrate_vma_finalize(args);
+
+    return state->status;
+}
+
+#endif // !CONFIG_MIGRATE_VMA_HELPER
+
 static NV_STATUS migrate_pageable_vma_populate_mask(struct vm_area_struct *vma,
                                                     unsigned long start,
                                                     unsigned long outer,
@@ -764,37 +823,19 @@ static NV_STATUS migrate_pageable_vma_migrate_mask(struct vm_area_struct *vma,
     return NV_OK;
 }
 
-static NV_STATUS migrate_pageable_vma_region(struct vm_area_struct *vma,
-                                             unsigned long start,
-                                             unsigned long outer,
-                                             migrate_vma_state_t *state,
-                                             unsigned long *next_addr)
+// Retry logic run after the main migrate_vma of the [start, outer) region:
+// populate the pages the migration could not move, and retry the migration of
+// the pages that look migratable. The populate_pages, allocation_failed and
+// dst_resident_pages masks in state must correspond to the region.
+static NV_STATUS migrate_pageable_vma_region_retries(struct vm_area_struct *vma,
+                                                     unsigned long start,
+                                                     unsigned long outer,
+                                                     migrate_vma_state_t *state,
+                                                     unsigned long *next_addr)
 {
     NV_STATUS status;
     const unsigned long num_pages = (outer - start) / PAGE_SIZE;
-    struct mm_struct *mm = vma->vm_mm;
     uvm_migrate_args_t *uvm_migrate_args = state->uvm_migrate_args;
-    struct migrate_vma args =
-    {
-        .vma = vma,
-        .src = state->src_pfn_array,
-        .dst = state->dst_pfn_array,
-        .start = start,
-        .end = outer,
-    };
-
-    UVM_ASSERT(PAGE_ALIGNED(start));
-    UVM_ASSERT(PAGE_ALIGNED(outer));
-    UVM_ASSERT(start < outer);
-    UVM_ASSERT(start >= vma->vm_start);
-    UVM_ASSERT(outer <= vma->vm_end);
-    UVM_ASSERT(outer - start <= UVM_MIGRATE_VMA_MAX_SIZE);
-    uvm_assert_mmap_lock_locked(mm);
-    uvm_assert_rwsem_locked(&uvm_migrate_args->va_space->lock);
-
-    status = nv_migrate_vma(&args, state);
-    if (status != NV_OK)
-        return status;
 
     // Save the returned page masks because they can be overwritten by
     // migrate_pageable_vma_migrate_mask().
@@ -836,6 +877,121 @@ static NV_STATUS migrate_pageable_vma_region(struct vm_area_struct *vma,
     return NV_OK;
 }
 
+static NV_STATUS migrate_pageable_vma_region(struct vm_area_struct *vma,
+                                             unsigned long start,
+                                             unsigned long outer,
+                                             migrate_vma_state_t *state,
+                                             unsigned long *next_addr)
+{
+    NV_STATUS status;
+    struct mm_struct *mm = vma->vm_mm;
+    uvm_migrate_args_t *uvm_migrate_args = state->uvm_migrate_args;
+    struct migrate_vma args =
+    {
+        .vma = vma,
+        .src = state->src_pfn_array,
+        .dst = state->dst_pfn_array,
+        .start = start,
+        .end = outer,
+    };
+
+    UVM_ASSERT(PAGE_ALIGNED(start));
+    UVM_ASSERT(PAGE_ALIGNED(outer));
+    UVM_ASSERT(start < outer);
+    UVM_ASSERT(start >= vma->vm_start);
+    UVM_ASSERT(outer <= vma->vm_end);
+    UVM_ASSERT(outer - start <= UVM_MIGRATE_VMA_MAX_SIZE);
+    uvm_assert_mmap_lock_locked(mm);
+    uvm_assert_rwsem_locked(&uvm_migrate_args->va_space->lock);
+
+    status = nv_migrate_vma(&args, state);
+    if (status != NV_OK)
+        return status;
+
+    return migrate_pageable_vma_region_retries(vma, start, outer, state, next_addr);
+}
+
+#if !defined(CONFIG_MIGRATE_VMA_HELPER)
+
+// Pipelined version of the migrate_pageable_vma() chunk loop keeping up to two
+// chunks in flight: while the GPU copies chunk N, the CPU isolates the source
+// pages of chunk N + 1 and allocates its destination pages. Each chunk keeps
+// its own migrate_vma_state_t until its retries have completed.
+static NV_STATUS migrate_pageable_vma_pipelined(struct vm_area_struct *vma,
+                                                unsigned long start,
+                                                unsigned long outer,
+                                                migrate_vma_state_t *state,
+                                                migrate_vma_state_t *next_state,
+                                                unsigned long *next_addr)
+{
+    NV_STATUS status;
+    NV_STATUS begin_status = NV_OK;
+    migrate_vma_state_t *states[2] = {state, next_state};
+    struct migrate_vma args[2];
+    unsigned cur = 0;
+    bool cur_in_flight;
+    unsigned i;
+
+    for (i = 0; i < 2; i++) {
+        args[i] = (struct migrate_vma)
+        {
+            .vma = vma,
+            .src = states[i]->src_pfn_array,
+            .dst = states[i]->dst_pfn_array,
+        };
+    }
+
+    args[cur].start = start;
+    args[cur].end = start + min(outer - start, UVM_MIGRATE_VMA_MAX_SIZE);
+
+    status = migrate_vma_begin(&args[cur], states[cur]);
+    if (status != NV_OK)
+        return status;
+
+    cur_in_flight = true;
+
+    while (cur_in_flight) {
+        const unsigned next = cur ^ 1;
+        bool next_in_flight = false;
+
+        // Overlap the CPU-side setup of the next chunk with the in-flight GPU
+        // copy of the current one. Setup failures are reported once all the
+        // started chunks have been completed.
+        if (args[cur].end < outer) {
+            args[next].start = args[cur].end;
+            args[next].end = args[next].start + min(outer - args[next].start, UVM_MIGRATE_VMA_MAX_SIZE);
+
+            begin_status = migrate_vma_begin(&args[next], states[next]);
+            next_in_flight = (begin_status == NV_OK);
+        }
+
+        status = migrate_vma_finish(&args[cur], states[cur]);
+        if (status == NV_OK) {
+            status = migrate_pageable_vma_region_retries(vma,
+                                                         args[cur].start,
+                                                         args[cur].end,
+                                                         states[cur],
+                                                         next_addr);
+        }
+
+        if (status != NV_OK) {
+            // The next chunk may already be in flight. Complete it so its page
+            // locks and device state are released before bailing out.
+            if (next_in_flight)
+                (void)migrate_vma_finish(&args[next], states[next]);
+
+            return status;
+        }
+
+        cur = next;
+        cur_in_flight = next_in_flight;
+    }
+
+    return begin_status;
+}
+
+#endif // !CONFIG_MIGRATE_VMA_HELPER
+
 NV_STATUS uvm_test_skip_migrate_vma(UVM_TEST_SKIP_MIGRATE_VMA_PARAMS *params, struct file *filp)
 {
     uvm_va_space_t *va_space = uvm_va_space_get(filp);
@@ -880,6 +1036,29 @@ static NV_STATUS migrate_pageable_vma(struct vm_area_struct *vma,
     if (uvm_processor_mask_empty(&va_space->registered_gpus))
         return NV_WARN_NOTHING_TO_DO;
 
+#if !defined(CONFIG_MIGRATE_VMA_HELPER)
+    // Pipeline multi-chunk migrations when a second chunk state can be
+    // allocated. Fall back to the sequential loop otherwise.
+    if (uvm_perf_migrate_pageable_pipeline_enable && (outer - start > UVM_MIGRATE_VMA_MAX_SIZE)) {
+        migrate_vma_state_t *next_state = kmem_cache_alloc(g_uvm_migrate_vma_state_cache, NV_UVM_GFP_FLAGS);
+
+        if (next_state) {
+            next_state->uvm_migrate_args = uvm_migrate_args;
+
+            status = migrate_pageable_vma_pipelined(vma, start, outer, state, next_state, next_addr);
+
+            kmem_cache_free(g_uvm_migrate_vma_state_cache, next_state);
+
+            if (status == NV_ERR_MORE_PROCESSING_REQUIRED) {
+                UVM_ASSERT(*next_addr >= start);
+                UVM_ASSERT(*next_addr < outer);
+            }
+
+            return status;
+        }
+    }
+#endif // !CONFIG_MIGRATE_VMA_HELPER
+
     while (start < outer) {
         const size_t region_size = min(outer - start, UVM_MIGRATE_VMA_MAX_SIZE);
 
@@ -169,6 +169,50 @@ static NvU32 mmu_biggest_page_size(uvm_page_tree_t *tree, uvm_aperture_t apertur
     }
 }
 
+// Try to reuse a cached page-table backing allocation of the given size. Any
+// pending operations on a cached allocation are in the tree tracker, and every
+// push writing page tables acquires the tracker, so reuse needs no wait here.
+static bool phys_mem_alloc_cache_get(uvm_page_tree_t *tree, NvLength size, uvm_mmu_page_table_alloc_t *out)
+{
+    bool found = false;
+    NvU32 i;
+
+    uvm_spin_lock(&tree->alloc_cache.lock);
+
+    for (i = 0; i < tree->alloc_cache.count; i++) {
+        if (tree->alloc_cache.entries[i].size == size) {
+            *out = tree->alloc_cache.entries[i];
+            tree->alloc_cache.entries[i] = tree->alloc_cache.entries[--tree->alloc_cache.count];
+            found = true;
+            break;
+        }
+    }
+
+    uvm_spin_unlock(&tree->alloc_cache.lock);
+
+    return found;
+}
+
+// Stash a freed vidmem page-table backing allocation for reuse. Returns false
+// if the cache is full and the caller has to free the allocation instead.
+static bool phys_mem_alloc_cache_put(uvm_page_tree_t *tree, uvm_mmu_page_table_alloc_t *ptr)
+{
+    bool cached = false;
+
+    UVM_ASSERT(ptr->addr.aperture == UVM_APERTURE_VID);
+
+    uvm_spin_lock(&tree->alloc_cache.lock);
+
+    if (tree->alloc_cache.count < UVM_PAGE_TREE_ALLOC_CACHE_ENTRIES) {
+        tree->alloc_cache.entries[tree->alloc_cache.count++] = *ptr;
+        cached = true;
+    }
+
+    uvm_spin_unlock(&tree->alloc_cache.lock);
+
+    return cached;
+}
+
 static NV_STATUS phys_mem_allocate_vidmem(uvm_page_tree_t *tree,
                                           NvLength size,
                                           uvm_pmm_alloc_flags_t pmm_flags,
@@ -178,6 +222,9 @@ static NV_STATUS phys_mem_allocate_vidmem(uvm_page_tree_t *tree,
     uvm_gpu_t *gpu = tree->gpu;
     uvm_tracker_t local_tracker = UVM_TRACKER_INIT();
 
+    if (phys_mem_alloc_cache_get(tree, size, out))
+        return NV_OK;
+
     status = uvm_pmm_gpu_alloc_kernel(&gpu->pmm, 1, size, pmm_flags, &out->handle.chunk, &local_tracker);
     if (status != NV_OK)
         return status;
@@ -222,6 +269,11 @@ static void phys_mem_deallocate_vidmem(uvm_page_tree_t *tree, uvm_mmu_page_table
     uvm_assert_mutex_locked(&tree->lock);
     UVM_ASSERT(ptr->addr.aperture == UVM_APERTURE_VID);
 
+    // Recycle the allocation so that later directory and table allocations in
+    // the fault servicing path can skip PMM.
+    if (phys_mem_alloc_cache_put(tree, ptr))
+        return;
+
     uvm_pmm_gpu_free(&tree->gpu->pmm, ptr->handle.chunk, &tree->tracker);
 }
 
@@ -1087,6 +1139,41 @@ static void page_tree_set_location(uvm_page_tree_t *tree, uvm_aperture_t locatio
     }
 }
 
+// Warm the allocation cache with table-sized allocations so that the first
+// fault-driven mappings on a fresh VA space don't have to call into PMM.
+// Prefilling is best effort and doesn't trigger eviction, so failure to fill
+// the cache is not an error.
+static void phys_mem_alloc_cache_prefill(uvm_page_tree_t *tree)
+{
+    NvLength size = tree->hal->allocation_size(tree->hal->page_table_depth(UVM_PAGE_SIZE_4K), UVM_PAGE_SIZE_4K);
+
+    if (tree->location != UVM_APERTURE_VID)
+        return;
+
+    while (tree->alloc_cache.count < UVM_PAGE_TREE_ALLOC_CACHE_ENTRIES) {
+        uvm_mmu_page_table_alloc_t alloc;
+
+        if (phys_mem_allocate_vidmem(tree, size, UVM_PMM_ALLOC_FLAGS_NONE, &alloc) != NV_OK)
+            return;
+
+        if (!phys_mem_alloc_cache_put(tree, &alloc)) {
+            uvm_pmm_gpu_free(&tree->gpu->pmm, alloc.handle.chunk, NULL);
+            return;
+        }
+    }
+}
+
+static void phys_mem_alloc_cache_drain(uvm_page_tree_t *tree)
+{
+    uvm_assert_mutex_locked(&tree->lock);
+
+    while (tree->alloc_cache.count > 0) {
+        uvm_mmu_page_table_alloc_t *entry = &tree->alloc_cache.entries[--tree->alloc_cache.count];
+
+        uvm_pmm_gpu_free(&tree->gpu->pmm, entry->handle.chunk, &tree->tracker);
+    }
+}
+
 NV_STATUS uvm_page_tree_init(uvm_gpu_t *gpu,
                              uvm_gpu_va_space_t *gpu_va_space,
                              uvm_page_tree_type_t type,
@@ -1102,6 +1189,7 @@ NV_STATUS uvm_page_tree_init(uvm_gpu_t *gpu,
 
     memset(tree, 0, sizeof(*tree));
     uvm_mutex_init(&tree->lock, UVM_LOCK_ORDER_PAGE_TREE);
+    uvm_spin_lock_init(&tree->alloc_cache.lock, UVM_LOCK_ORDER_LEAF);
     tree->hal = gpu->parent->arch_hal->mmu_mode_hal(big_page_size);
     UVM_ASSERT(tree->hal != NULL);
     UVM_ASSERT(MAX_OPERATION_DEPTH >= tree->hal->page_table_depth(UVM_PAGE_SIZE_AGNOSTIC));
@@ -1146,6 +1234,9 @@ NV_STATUS uvm_page_tree_init(uvm_gpu_t *gpu,
     if (status != NV_OK)
         return status;
 
+    if (type == UVM_PAGE_TREE_TYPE_USER)
+        phys_mem_alloc_cache_prefill(tree);
+
     return NV_OK;
 }
 
@@ -1190,6 +1281,8 @@ void uvm_page_tree_deinit(uvm_page_tree_t *tree)
     if (tree->gpu->parent->map_remap_larger_page_promotion)
         map_remap_deinit(tree);
 
+    phys_mem_alloc_cache_drain(tree);
+
     uvm_mutex_unlock(&tree->lock);
 
     uvm_tracker_deinit(&tree->tracker);
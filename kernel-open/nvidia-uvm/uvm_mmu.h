@@ -268,6 +268,9 @@ typedef enum
     UVM_PAGE_TREE_TYPE_COUNT
 } uvm_page_tree_type_t;
 
+// Max number of page-table backing allocations cached per page tree for reuse
+#define UVM_PAGE_TREE_ALLOC_CACHE_ENTRIES 8
+
 struct uvm_page_tree_struct
 {
     uvm_mutex_t lock;
@@ -308,6 +311,20 @@ struct uvm_page_tree_struct
     // canonical form address systems.
     uvm_page_table_range_t no_ats_ranges[2];
 
+    // Cache of vidmem page-table backing allocations, pre-filled at init and
+    // refilled with freed directories and tables, so that PTE materialization
+    // in the fault servicing path doesn't have to call into PMM. Protected by
+    // its own lock since allocations can happen without the tree lock held.
+    // Reuse of a cached allocation is ordered behind any pending operations
+    // on it through the tree tracker, which every push writing page tables
+    // acquires.
+    struct
+    {
+        uvm_spinlock_t lock;
+        uvm_mmu_page_table_alloc_t entries[UVM_PAGE_TREE_ALLOC_CACHE_ENTRIES];
+        NvU32 count;
+    } alloc_cache;
+
     // Tracker for all GPU operations on the tree
     uvm_tracker_t tracker;
 };
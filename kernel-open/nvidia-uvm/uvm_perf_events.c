@@ -43,7 +43,7 @@ static callback_desc_t *event_list_find_callback(uvm_perf_va_space_events_t *va_
 {
     callback_desc_t *callback_desc;
 
-    uvm_assert_rwsem_locked(&va_space_events->lock);
+    uvm_assert_percpu_rwsem_locked(&va_space_events->lock);
 
     list_for_each_entry(callback_desc, callback_list, callback_list_node) {
         if (callback_desc->callback == callback)
@@ -63,7 +63,7 @@ NV_STATUS uvm_perf_register_event_callback_locked(uvm_perf_va_space_events_t *va
     UVM_ASSERT(event_id >= 0 && event_id < UVM_PERF_EVENT_COUNT);
     UVM_ASSERT(callback);
 
-    uvm_assert_rwsem_locked_write(&va_space_events->lock);
+    uvm_assert_percpu_rwsem_locked_write(&va_space_events->lock);
 
     callback_list = &va_space_events->event_callbacks[event_id];
 
@@ -84,9 +84,9 @@ NV_STATUS uvm_perf_register_event_callback(uvm_perf_va_space_events_t *va_space_
 {
     NV_STATUS status;
 
-    uvm_down_write(&va_space_events->lock);
+    uvm_percpu_down_write(&va_space_events->lock);
     status = uvm_perf_register_event_callback_locked(va_space_events, event_id, callback);
-    uvm_up_write(&va_space_events->lock);
+    uvm_percpu_up_write(&va_space_events->lock);
 
     return status;
 }
@@ -100,7 +100,7 @@ void uvm_perf_unregister_event_callback_locked(uvm_perf_va_space_events_t *va_sp
     UVM_ASSERT(event_id >= 0 && event_id < UVM_PERF_EVENT_COUNT);
     UVM_ASSERT(callback);
 
-    uvm_assert_rwsem_locked_write(&va_space_events->lock);
+    uvm_assert_percpu_rwsem_locked_write(&va_space_events->lock);
 
     callback_list = &va_space_events->event_callbacks[event_id];
     callback_desc = event_list_find_callback(va_space_events, callback_list, callback);
@@ -116,9 +116,9 @@ void uvm_perf_unregister_event_callback_locked(uvm_perf_va_space_events_t *va_sp
 void uvm_perf_unregister_event_callback(uvm_perf_va_space_events_t *va_space_events, uvm_perf_event_t event_id,
                                         uvm_perf_event_callback_t callback)
 {
-    uvm_down_write(&va_space_events->lock);
+    uvm_percpu_down_write(&va_space_events->lock);
     uvm_perf_unregister_event_callback_locked(va_space_events, event_id, callback);
-    uvm_up_write(&va_space_events->lock);
+    uvm_percpu_up_write(&va_space_events->lock);
 }
 
 void uvm_perf_event_notify(uvm_perf_va_space_events_t *va_space_events, uvm_perf_event_t event_id,
@@ -132,14 +132,17 @@ void uvm_perf_event_notify(uvm_perf_va_space_events_t *va_space_events, uvm_perf
 
     callback_list = &va_space_events->event_callbacks[event_id];
 
-    uvm_down_read(&va_space_events->lock);
+    // The down_read is a per-CPU operation: unless a callback registration is
+    // in flight, it doesn't bounce any cache lines between the CPUs invoking
+    // event notifications.
+    uvm_percpu_down_read(&va_space_events->lock);
 
     // Invoke all registered callbacks for the events
     list_for_each_entry(callback_desc, callback_list, callback_list_node) {
         callback_desc->callback(event_id, event_data);
     }
 
-    uvm_up_read(&va_space_events->lock);
+    uvm_percpu_up_read(&va_space_events->lock);
 }
 
 bool uvm_perf_is_event_callback_registered(uvm_perf_va_space_events_t *va_space_events,
@@ -149,7 +152,7 @@ bool uvm_perf_is_event_callback_registered(uvm_perf_va_space_events_t *va_space_
     callback_desc_t *callback_desc;
     struct list_head *callback_list;
 
-    uvm_assert_rwsem_locked(&va_space_events->lock);
+    uvm_assert_percpu_rwsem_locked(&va_space_events->lock);
 
     callback_list = &va_space_events->event_callbacks[event_id];
     callback_desc = event_list_find_callback(va_space_events, callback_list, callback);
@@ -161,7 +164,8 @@ NV_STATUS uvm_perf_init_va_space_events(uvm_va_space_t *va_space, uvm_perf_va_sp
 {
     unsigned event_id;
 
-    uvm_init_rwsem(&va_space_events->lock, UVM_LOCK_ORDER_VA_SPACE_EVENTS);
+    if (uvm_percpu_init_rwsem(&va_space_events->lock, UVM_LOCK_ORDER_VA_SPACE_EVENTS) != 0)
+        return NV_ERR_NO_MEMORY;
 
     // Initialize event callback lists
     for (event_id = 0; event_id < UVM_PERF_EVENT_COUNT; ++event_id)
@@ -194,6 +198,8 @@ void uvm_perf_destroy_va_space_events(uvm_perf_va_space_events_t *va_space_event
         }
     }
 
+    uvm_percpu_free_rwsem(&va_space_events->lock);
+
     va_space_events->va_space = NULL;
 }
 
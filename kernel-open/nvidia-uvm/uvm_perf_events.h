@@ -235,10 +235,12 @@ typedef struct
     // Lock protecting the events
     //
     // Held for write during registration/unregistration of callbacks and for
-    // read during notification of events.
+    // read during notification of events. A per-CPU semaphore is used so that
+    // event notification on the fault and migration paths doesn't touch any
+    // shared state when no registration is in flight.
     //
     // Also used by tools to protect their state and registration of perf event callbacks.
-    uvm_rw_semaphore_t lock;
+    uvm_percpu_rw_semaphore_t lock;
 
     // Array of callbacks for event notification
     struct list_head event_callbacks[UVM_PERF_EVENT_COUNT];
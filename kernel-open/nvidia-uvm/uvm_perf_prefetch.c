@@ -101,7 +101,8 @@ NvU16 uvm_perf_prefetch_bitmap_tree_iter_get_count(const uvm_perf_prefetch_bitma
 
 static uvm_va_block_region_t compute_prefetch_region(uvm_page_index_t page_index,
                                                      uvm_perf_prefetch_bitmap_tree_t *bitmap_tree,
-                                                     uvm_va_block_region_t max_prefetch_region)
+                                                     uvm_va_block_region_t max_prefetch_region,
+                                                     NvU32 threshold)
 {
     NvU16 counter;
     uvm_perf_prefetch_bitmap_tree_iter_t iter;
@@ -115,7 +116,7 @@ static uvm_va_block_region_t compute_prefetch_region(uvm_page_index_t page_index
         NvU16 subregion_pages = uvm_va_block_region_num_pages(subregion);
 
         UVM_ASSERT(counter <= subregion_pages);
-        if (counter * 100 > subregion_pages * g_uvm_perf_prefetch_threshold)
+        if (counter * 100 > subregion_pages * threshold)
             prefetch_region = subregion;
     }
 
@@ -300,6 +301,7 @@ static void compute_prefetch_mask(uvm_va_block_region_t faulted_region,
                                   uvm_va_block_region_t max_prefetch_region,
                                   uvm_perf_prefetch_bitmap_tree_t *bitmap_tree,
                                   const uvm_page_mask_t *faulted_pages,
+                                  NvU32 threshold,
                                   uvm_page_mask_t *out_prefetch_mask)
 {
     uvm_page_index_t page_index;
@@ -308,7 +310,10 @@ static void compute_prefetch_mask(uvm_va_block_region_t faulted_region,
 
     // Update the tree using the faulted mask to compute the pages to prefetch.
     for_each_va_block_page_in_region_mask(page_index, faulted_pages, faulted_region) {
-        uvm_va_block_region_t region = compute_prefetch_region(page_index, bitmap_tree, max_prefetch_region);
+        uvm_va_block_region_t region = compute_prefetch_region(page_index,
+                                                               bitmap_tree,
+                                                               max_prefetch_region,
+                                                               threshold);
 
         uvm_page_mask_region_fill(out_prefetch_mask, region);
 
@@ -318,6 +323,44 @@ static void compute_prefetch_mask(uvm_va_block_region_t faulted_region,
     }
 }
 
+// Prefetch threshold to apply on the given block: the per-VA-range override,
+// if set, otherwise the module parameter.
+static NvU32 va_block_prefetch_threshold(uvm_va_block_t *va_block)
+{
+    if (!uvm_va_block_is_hmm(va_block) && va_block->va_range && va_block->va_range->managed.prefetch_threshold != 0)
+        return va_block->va_range->managed.prefetch_threshold;
+
+    return g_uvm_perf_prefetch_threshold;
+}
+
+// Return the resident mask to seed the bitmap tree with, using the
+// incrementally-maintained cache in the block when possible and falling back
+// to a full rebuild from the given resident mask. Returns resident_mask
+// untouched when the cache does not apply (HMM blocks, or no residency).
+static const uvm_page_mask_t *residency_cache_get(uvm_va_block_t *va_block,
+                                                  uvm_processor_id_t new_residency,
+                                                  const uvm_page_mask_t *resident_mask)
+{
+    if (uvm_va_block_is_hmm(va_block) || !resident_mask)
+        return resident_mask;
+
+    UVM_ASSERT(uvm_id_equal(va_block->prefetch_info.last_migration_proc_id, new_residency));
+
+    if (va_block->prefetch_info.residency_cache_valid) {
+        // The incremental patching must keep the cache in sync with the
+        // block's residency state.
+        UVM_ASSERT(uvm_page_mask_equal(&va_block->prefetch_info.residency_cache, resident_mask));
+    }
+    else {
+        // Full rebuild fallback: snapshot the resident mask so subsequent
+        // batches can be served from the cache.
+        uvm_page_mask_copy(&va_block->prefetch_info.residency_cache, resident_mask);
+        va_block->prefetch_info.residency_cache_valid = true;
+    }
+
+    return &va_block->prefetch_info.residency_cache;
+}
+
 // Within a block we only allow prefetching to a single processor. Therefore,
 // if two processors are accessing non-overlapping regions within the same
 // block they won't benefit from prefetching.
@@ -340,6 +383,7 @@ static NvU32 uvm_perf_prefetch_prenotify_fault_migrations(uvm_va_block_t *va_blo
     if (!uvm_id_equal(va_block->prefetch_info.last_migration_proc_id, new_residency)) {
         va_block->prefetch_info.last_migration_proc_id = new_residency;
         va_block->prefetch_info.fault_migrations_to_last_proc = 0;
+        va_block->prefetch_info.residency_cache_valid = false;
     }
 
     // Compute the expanded region that prefetching is allowed from.
@@ -365,7 +409,10 @@ static NvU32 uvm_perf_prefetch_prenotify_fault_migrations(uvm_va_block_t *va_blo
         uvm_page_mask_region_fill(prefetch_pages, max_prefetch_region);
     }
     else {
-        init_bitmap_tree_from_region(bitmap_tree, max_prefetch_region, resident_mask, faulted_pages);
+        init_bitmap_tree_from_region(bitmap_tree,
+                                     max_prefetch_region,
+                                     residency_cache_get(va_block, new_residency, resident_mask),
+                                     faulted_pages);
 
         update_bitmap_tree_from_va_block(bitmap_tree,
                                          va_block,
@@ -384,6 +431,7 @@ static NvU32 uvm_perf_prefetch_prenotify_fault_migrations(uvm_va_block_t *va_blo
                               max_prefetch_region,
                               bitmap_tree,
                               &va_block_context->scratch_page_mask,
+                              va_block_prefetch_threshold(va_block),
                               prefetch_pages);
     }
 
@@ -412,6 +460,37 @@ static NvU32 uvm_perf_prefetch_prenotify_fault_migrations(uvm_va_block_t *va_blo
     return uvm_page_mask_weight(prefetch_pages);
 }
 
+void uvm_perf_prefetch_notify_make_resident(uvm_va_block_t *va_block,
+                                            uvm_processor_id_t dst_id,
+                                            const uvm_page_mask_t *resident_pages)
+{
+    uvm_assert_mutex_locked(&va_block->lock);
+
+    if (!va_block->prefetch_info.residency_cache_valid)
+        return;
+
+    // The cache only tracks the residency of last_migration_proc_id. A
+    // migration to that processor can only add pages to its resident mask, so
+    // the cache can be patched in place. A migration anywhere else may break
+    // residency on the tracked processor, so drop the cache and let the next
+    // prefetch computation rebuild it.
+    if (uvm_id_equal(va_block->prefetch_info.last_migration_proc_id, dst_id)) {
+        uvm_page_mask_or(&va_block->prefetch_info.residency_cache,
+                         &va_block->prefetch_info.residency_cache,
+                         resident_pages);
+    }
+    else {
+        va_block->prefetch_info.residency_cache_valid = false;
+    }
+}
+
+void uvm_perf_prefetch_invalidate_cache(uvm_va_block_t *va_block)
+{
+    uvm_assert_mutex_locked(&va_block->lock);
+
+    va_block->prefetch_info.residency_cache_valid = false;
+}
+
 bool uvm_perf_prefetch_enabled(uvm_va_space_t *va_space)
 {
     if (!g_uvm_perf_prefetch_enable)
@@ -441,7 +520,12 @@ void uvm_perf_prefetch_compute_ats(uvm_va_space_t *va_space,
 
     init_bitmap_tree_from_region(bitmap_tree, max_prefetch_region, residency_mask, faulted_pages);
 
-    compute_prefetch_mask(faulted_region, max_prefetch_region, bitmap_tree, faulted_pages, out_prefetch_mask);
+    compute_prefetch_mask(faulted_region,
+                          max_prefetch_region,
+                          bitmap_tree,
+                          faulted_pages,
+                          g_uvm_perf_prefetch_threshold,
+                          out_prefetch_mask);
 }
 
 void uvm_perf_prefetch_get_hint_va_block(uvm_va_block_t *va_block,
@@ -550,3 +634,25 @@ NV_STATUS uvm_test_set_page_prefetch_policy(UVM_TEST_SET_PAGE_PREFETCH_POLICY_PA
 
     return NV_OK;
 }
+
+NV_STATUS uvm_test_set_prefetch_threshold(UVM_TEST_SET_PREFETCH_THRESHOLD_PARAMS *params, struct file *filp)
+{
+    uvm_va_space_t *va_space = uvm_va_space_get(filp);
+    uvm_va_range_t *va_range;
+    NV_STATUS status = NV_OK;
+
+    if (params->threshold > 100)
+        return NV_ERR_INVALID_ARGUMENT;
+
+    uvm_va_space_down_write(va_space);
+
+    va_range = uvm_va_range_find(va_space, params->base);
+    if (!va_range || va_range->type != UVM_VA_RANGE_TYPE_MANAGED)
+        status = NV_ERR_INVALID_ADDRESS;
+    else
+        va_range->managed.prefetch_threshold = params->threshold;
+
+    uvm_va_space_up_write(va_space);
+
+    return status;
+}
@@ -97,6 +97,23 @@ void uvm_perf_prefetch_get_hint_va_block(uvm_va_block_t *va_block,
                                          uvm_perf_prefetch_bitmap_tree_t *bitmap_tree,
                                          uvm_perf_prefetch_hint_t *out_hint);
 
+// Incrementally patch the cached residency state used to build the prefetch
+// bitmap tree after pages have been made resident on dst_id. resident_pages
+// is the mask of pages that are now resident on dst_id. If the cache does not
+// track dst_id it is invalidated instead, since residency may have been broken
+// on any other processor.
+// Locking: The caller must hold the va_block lock.
+void uvm_perf_prefetch_notify_make_resident(uvm_va_block_t *va_block,
+                                            uvm_processor_id_t dst_id,
+                                            const uvm_page_mask_t *resident_pages);
+
+// Drop the cached residency state, forcing the next prefetch computation to
+// rebuild it from the block's resident mask. To be called when residency
+// changes outside of the make_resident path (e.g. on GPU unregister or block
+// split).
+// Locking: The caller must hold the va_block lock.
+void uvm_perf_prefetch_invalidate_cache(uvm_va_block_t *va_block);
+
 void uvm_perf_prefetch_bitmap_tree_iter_init(const uvm_perf_prefetch_bitmap_tree_t *bitmap_tree,
                                              uvm_page_index_t page_index,
                                              uvm_perf_prefetch_bitmap_tree_iter_t *iter);
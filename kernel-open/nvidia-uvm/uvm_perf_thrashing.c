@@ -139,6 +139,11 @@ typedef struct
     struct list_head             va_block_list_entry;
 } pinned_page_t;
 
+// Number of shards the per-VA space pinned page lists are split into. Must be
+// a power of two. Sharding by VA block keeps pin/unpin operations on
+// different blocks from serializing on a single VA space wide spinlock.
+#define PINNED_PAGES_SHARD_COUNT 16
+
 // Per-VA space data structures and policy configuration
 typedef struct
 {
@@ -150,19 +155,30 @@ typedef struct
         // Work descriptor that is executed asynchronously by a helper thread
         struct delayed_work                    dwork;
 
-        // List of pinned pages. They are (mostly) ordered by unpin deadline.
-        // New entries are inserted blindly at the tail since the expectation
-        // is that they will have the largest deadline value. However, given
-        // the drift between when multiple threads query their timestamps and
-        // add those pages to the list under the lock, it might not be
-        // strictly ordered. But this is OK since the difference will be very
-        // small and they will be eventually removed from the list.
+        // Sharded lists of pinned pages. A pinned page lives in the shard
+        // selected by its VA block, so threads servicing faults on different
+        // blocks take different locks. Within a shard, entries are (mostly)
+        // ordered by unpin deadline. New entries are inserted blindly at the
+        // tail since the expectation is that they will have the largest
+        // deadline value. However, given the drift between when multiple
+        // threads query their timestamps and add those pages to the list
+        // under the lock, it might not be strictly ordered. But this is OK
+        // since the difference will be very small and they will be eventually
+        // removed from the list.
         //
         // Entries are removed when they reach the deadline by the function
-        // configured in dwork. This list is protected by lock.
-        struct list_head                        list;
+        // configured in dwork. Each list is protected by its shard lock.
+        struct
+        {
+            struct list_head                    list;
 
-        uvm_spinlock_t                          lock;
+            uvm_spinlock_t                      lock;
+        } shards[PINNED_PAGES_SHARD_COUNT];
+
+        // Total number of pinned pages across all shards. Used lock-free on
+        // the hot pin/unpin paths to decide when the delayed work needs to be
+        // scheduled, without touching any shard lock.
+        atomic_t                          num_pinned;
 
         uvm_va_block_context_t      *va_block_context;
 
@@ -894,6 +910,16 @@ static pinned_page_t *find_pinned_page(block_thrashing_info_t *block_thrashing,
     return NULL;
 }
 
+// Return the index of the pinned pages shard that tracks pages of the given
+// VA block. All pages of a block map to the same shard so that
+// thrashing_unpin_page can locate them while holding a single shard lock.
+static size_t pinned_pages_shard_index(uvm_va_block_t *va_block)
+{
+    BUILD_BUG_ON(!is_power_of_2(PINNED_PAGES_SHARD_COUNT));
+
+    return (size_t)(va_block->start / UVM_VA_BLOCK_SIZE) & (PINNED_PAGES_SHARD_COUNT - 1);
+}
+
 // Pin a page on the specified processor. All thrashing processors will be
 // mapped remotely on this location, when possible
 //
@@ -928,29 +954,33 @@ static NV_STATUS thrashing_pin_page(va_space_thrashing_info_t *va_space_thrashin
             if (!pinned_page)
                 return NV_ERR_NO_MEMORY;
 
+            size_t shard_index = pinned_pages_shard_index(va_block);
+
             pinned_page->va_block = va_block;
             pinned_page->page_index = page_index;
             pinned_page->deadline = time_stamp + va_space_thrashing->params.pin_ns;
 
-            uvm_spin_lock(&va_space_thrashing->pinned_pages.lock);
+            uvm_spin_lock(&va_space_thrashing->pinned_pages.shards[shard_index].lock);
 
-            list_add_tail(&pinned_page->va_space_list_entry, &va_space_thrashing->pinned_pages.list);
+            list_add_tail(&pinned_page->va_space_list_entry,
+                          &va_space_thrashing->pinned_pages.shards[shard_index].list);
             list_add_tail(&pinned_page->va_block_list_entry, &block_thrashing->pinned_pages.list);
 
-            // We only schedule the delayed work if the list was empty before
-            // adding this page. Otherwise, we just add it to the list. The
-            // unpinning helper will remove from the list those pages with
-            // deadline prior to its wakeup timestamp and will reschedule
-            // itself if there are remaining pages in the list.
-            if (list_is_singular(&va_space_thrashing->pinned_pages.list) &&
+            uvm_spin_unlock(&va_space_thrashing->pinned_pages.shards[shard_index].lock);
+
+            // We only schedule the delayed work if there were no pinned pages
+            // before adding this one. Otherwise, we just add it to its shard.
+            // The unpinning helper will remove from the shards those pages
+            // with deadline prior to its wakeup timestamp and will reschedule
+            // itself if there are remaining pages in any shard. The counter
+            // is incremented after the list insertion (atomic_inc_return is a
+            // full barrier), so if the worker observes a zero counter the
+            // scheduling below is still pending.
+            if (atomic_inc_return(&va_space_thrashing->pinned_pages.num_pinned) == 1 &&
                 !va_space_thrashing->pinned_pages.in_va_space_teardown) {
-                int scheduled;
-                scheduled = schedule_delayed_work(&va_space_thrashing->pinned_pages.dwork,
-                                                  usecs_to_jiffies(va_space_thrashing->params.pin_ns / 1000));
-                UVM_ASSERT(scheduled != 0);
+                schedule_delayed_work(&va_space_thrashing->pinned_pages.dwork,
+                                      usecs_to_jiffies(va_space_thrashing->params.pin_ns / 1000));
             }
-
-            uvm_spin_unlock(&va_space_thrashing->pinned_pages.lock);
         }
 
         page_thrashing->throttling_count = 0;
@@ -982,6 +1012,7 @@ static void thrashing_unpin_page(va_space_thrashing_info_t *va_space_thrashing,
 
     if (va_space_thrashing->params.pin_ns > 0) {
         bool do_free = false;
+        size_t shard_index = pinned_pages_shard_index(va_block);
         pinned_page_t *pinned_page = find_pinned_page(block_thrashing, page_index);
 
         UVM_ASSERT(pinned_page);
@@ -991,26 +1022,28 @@ static void thrashing_unpin_page(va_space_thrashing_info_t *va_space_thrashing,
         // The va_space_list_entry and va_block_list_entry have special
         // meanings here:
         // - va_space_list_entry: when the delayed unpin worker removes the
-        // pinned_page from this list, it takes the ownership of the page and
-        // is in charge of freeing it.
+        // pinned_page from its shard list, it takes the ownership of the page
+        // and is in charge of freeing it.
         // - va_block_list_entry: by removing the page from this list,
         // thrashing_unpin_page tells the unpin delayed worker to skip
         // unpinning that page.
-        uvm_spin_lock(&va_space_thrashing->pinned_pages.lock);
+        uvm_spin_lock(&va_space_thrashing->pinned_pages.shards[shard_index].lock);
         list_del_init(&pinned_page->va_block_list_entry);
 
         if (!list_empty(&pinned_page->va_space_list_entry)) {
             do_free = true;
             list_del_init(&pinned_page->va_space_list_entry);
-
-            if (list_empty(&va_space_thrashing->pinned_pages.list))
-                cancel_delayed_work(&va_space_thrashing->pinned_pages.dwork);
         }
 
-        uvm_spin_unlock(&va_space_thrashing->pinned_pages.lock);
+        uvm_spin_unlock(&va_space_thrashing->pinned_pages.shards[shard_index].lock);
 
-        if (do_free)
+        // The delayed work is not cancelled when the last page goes away: the
+        // worker rechecks the counter on wakeup and exits if there is nothing
+        // left to unpin.
+        if (do_free) {
+            atomic_dec(&va_space_thrashing->pinned_pages.num_pinned);
             kmem_cache_free(g_pinned_page_cache, pinned_page);
+        }
     }
 
     page_thrashing->pinned_residency_id = UVM_ID_INVALID;
@@ -1758,6 +1791,12 @@ done:
 
         PROCESSOR_THRASHING_STATS_INC(va_space, requester, num_throttle);
 
+        if (UVM_ID_IS_GPU(requester)) {
+            uvm_gpu_t *gpu = uvm_va_space_get_gpu(va_space, requester);
+
+            uvm_procfs_counter_inc(gpu->parent->counters, throttle_events);
+        }
+
         hint.throttle.end_time_stamp = page_thrashing_get_throttling_end_time_stamp(page_thrashing);
     }
     else if (hint.type == UVM_PERF_THRASHING_HINT_TYPE_NONE && page_thrashing) {
@@ -1825,43 +1864,58 @@ static void thrashing_unpin_pages(struct work_struct *work)
         goto exit_no_list_lock;
 
     while (1) {
-        pinned_page_t *pinned_page;
+        pinned_page_t *pinned_page = NULL;
         uvm_va_block_t *va_block;
-
-        uvm_spin_lock(&va_space_thrashing->pinned_pages.lock);
-        pinned_page = list_first_entry_or_null(&va_space_thrashing->pinned_pages.list,
-                                               pinned_page_t,
-                                               va_space_list_entry);
-
-        if (pinned_page) {
-            NvU64 now = NV_GETTIME();
-
-            if (pinned_page->deadline <= (now + TIMER_GRANULARITY_NS)) {
-                list_del_init(&pinned_page->va_space_list_entry);
-
-                // Work cancellation is left to thrashing_unpin_page() as this
-                // would only catch the following pattern:
-                // - Worker thread A is in thrashing_unpin_pages but hasn't
-                // looked at the list yet
-                // - Thread B then removes the last entry
-                // - Thread C then adds a new entry and re-schedules work
-                // - Worker thread A removes the entry added by C because the
-                // deadline has passed (unlikely), then cancels the work
-                // scheduled by C.
+        NvU64 earliest_deadline = 0;
+        bool deadline_found = false;
+        size_t shard_index;
+        NvU64 now = NV_GETTIME();
+
+        // Scan the shards for one expired page, keeping track of the earliest
+        // deadline among the non-expired shard heads. Each shard list is
+        // (mostly) ordered by deadline, so only the heads need to be looked
+        // at.
+        for (shard_index = 0; shard_index < PINNED_PAGES_SHARD_COUNT; ++shard_index) {
+            pinned_page_t *head;
+
+            uvm_spin_lock(&va_space_thrashing->pinned_pages.shards[shard_index].lock);
+
+            head = list_first_entry_or_null(&va_space_thrashing->pinned_pages.shards[shard_index].list,
+                                            pinned_page_t,
+                                            va_space_list_entry);
+            if (head) {
+                if (head->deadline <= (now + TIMER_GRANULARITY_NS)) {
+                    list_del_init(&head->va_space_list_entry);
+                    atomic_dec(&va_space_thrashing->pinned_pages.num_pinned);
+                    pinned_page = head;
+                }
+                else if (!deadline_found || head->deadline < earliest_deadline) {
+                    earliest_deadline = head->deadline;
+                    deadline_found = true;
+                }
             }
-            else {
-                NvU64 elapsed_us = (pinned_page->deadline - now) / 1000;
 
-                schedule_delayed_work(&va_space_thrashing->pinned_pages.dwork, usecs_to_jiffies(elapsed_us));
-                uvm_spin_unlock(&va_space_thrashing->pinned_pages.lock);
+            uvm_spin_unlock(&va_space_thrashing->pinned_pages.shards[shard_index].lock);
+
+            if (pinned_page)
                 break;
-            }
         }
 
-        uvm_spin_unlock(&va_space_thrashing->pinned_pages.lock);
+        if (!pinned_page) {
+            if (deadline_found) {
+                schedule_delayed_work(&va_space_thrashing->pinned_pages.dwork,
+                                      usecs_to_jiffies((earliest_deadline - now) / 1000));
+            }
+            else if (atomic_read(&va_space_thrashing->pinned_pages.num_pinned) > 0) {
+                // A page was added after its shard was scanned. Its inserting
+                // thread only schedules the work if it saw a zero counter, so
+                // reschedule conservatively with the full pinning timeout.
+                schedule_delayed_work(&va_space_thrashing->pinned_pages.dwork,
+                                      usecs_to_jiffies(va_space_thrashing->params.pin_ns / 1000));
+            }
 
-        if (!pinned_page)
             break;
+        }
 
         va_block = pinned_page->va_block;
         if (uvm_va_block_is_hmm(va_block))
@@ -1903,6 +1957,7 @@ static void thrashing_unpin_pages_entry(struct work_struct *work)
 NV_STATUS uvm_perf_thrashing_load(uvm_va_space_t *va_space)
 {
     va_space_thrashing_info_t *va_space_thrashing;
+    size_t shard_index;
     NV_STATUS status;
 
     status = uvm_perf_module_load(&g_module_thrashing, va_space);
@@ -1913,8 +1968,12 @@ NV_STATUS uvm_perf_thrashing_load(uvm_va_space_t *va_space)
     if (!va_space_thrashing)
         return NV_ERR_NO_MEMORY;
 
-    uvm_spin_lock_init(&va_space_thrashing->pinned_pages.lock, UVM_LOCK_ORDER_LEAF);
-    INIT_LIST_HEAD(&va_space_thrashing->pinned_pages.list);
+    for (shard_index = 0; shard_index < PINNED_PAGES_SHARD_COUNT; ++shard_index) {
+        uvm_spin_lock_init(&va_space_thrashing->pinned_pages.shards[shard_index].lock, UVM_LOCK_ORDER_LEAF);
+        INIT_LIST_HEAD(&va_space_thrashing->pinned_pages.shards[shard_index].list);
+    }
+
+    atomic_set(&va_space_thrashing->pinned_pages.num_pinned, 0);
     INIT_DELAYED_WORK(&va_space_thrashing->pinned_pages.dwork, thrashing_unpin_pages_entry);
 
     return NV_OK;
@@ -1949,7 +2008,12 @@ void uvm_perf_thrashing_unload(uvm_va_space_t *va_space)
 
     // Make sure that there are not pending work items
     if (va_space_thrashing) {
-        UVM_ASSERT(list_empty(&va_space_thrashing->pinned_pages.list));
+        size_t shard_index;
+
+        UVM_ASSERT(atomic_read(&va_space_thrashing->pinned_pages.num_pinned) == 0);
+
+        for (shard_index = 0; shard_index < PINNED_PAGES_SHARD_COUNT; ++shard_index)
+            UVM_ASSERT(list_empty(&va_space_thrashing->pinned_pages.shards[shard_index].list));
 
         va_space_thrashing_info_destroy(va_space);
     }
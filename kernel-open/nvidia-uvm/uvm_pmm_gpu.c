@@ -185,6 +185,11 @@ MODULE_PARM_DESC(uvm_global_oversubscription, "Enable (1) or disable (0) global
 static unsigned uvm_perf_pma_batch_nonpinned_order = UVM_PERF_PMA_BATCH_NONPINNED_ORDER_DEFAULT;
 module_param(uvm_perf_pma_batch_nonpinned_order, uint, S_IRUGO);
 
+// Enable (1) or disable (0) the per-CPU free chunk magazines that cache user
+// chunks in front of the free lists. See uvm_gpu_chunk_magazine_t.
+static int uvm_perf_pmm_chunk_magazines = 1;
+module_param(uvm_perf_pmm_chunk_magazines, int, S_IRUGO);
+
 // Helper type for refcounting cache
 typedef struct
 {
@@ -317,6 +322,9 @@ static struct list_head *find_free_list(uvm_pmm_gpu_t *pmm,
 static bool check_chunk(uvm_pmm_gpu_t *pmm, uvm_gpu_chunk_t *chunk);
 static struct list_head *find_free_list_chunk(uvm_pmm_gpu_t *pmm, uvm_gpu_chunk_t *chunk);
 static void chunk_free_locked(uvm_pmm_gpu_t *pmm, uvm_gpu_chunk_t *chunk);
+static bool chunk_magazine_try_recycle(uvm_pmm_gpu_t *pmm, uvm_gpu_chunk_t *chunk);
+static void chunk_magazines_drain(uvm_pmm_gpu_t *pmm);
+static void chunk_magazines_drain_locked(uvm_pmm_gpu_t *pmm);
 
 static size_t root_chunk_index(uvm_pmm_gpu_t *pmm, uvm_gpu_root_chunk_t *root_chunk)
 {
@@ -1822,6 +1830,11 @@ static NV_STATUS pick_and_evict_root_chunk_retry(uvm_pmm_gpu_t *pmm,
 {
     NV_STATUS status;
 
+    // Magazine-cached chunks pin their root chunks, making those ineligible
+    // for eviction. Return them to the free lists first since we are under
+    // memory pressure.
+    chunk_magazines_drain_locked(pmm);
+
     // Eviction can fail if the chunk gets selected for PMA eviction at
     // the same time. Keep retrying.
     do {
@@ -1871,11 +1884,13 @@ static uvm_gpu_chunk_t *find_free_chunk_locked(uvm_pmm_gpu_t *pmm,
     return NULL;
 }
 
-static uvm_gpu_chunk_t *claim_free_chunk(uvm_pmm_gpu_t *pmm, uvm_pmm_gpu_memory_type_t type, uvm_chunk_size_t chunk_size)
+static uvm_gpu_chunk_t *claim_free_chunk_locked(uvm_pmm_gpu_t *pmm,
+                                                uvm_pmm_gpu_memory_type_t type,
+                                                uvm_chunk_size_t chunk_size)
 {
     uvm_gpu_chunk_t *chunk;
 
-    uvm_spin_lock(&pmm->list_lock);
+    uvm_assert_spinlock_locked(&pmm->list_lock);
 
     // Prefer zero free chunks as they are likely going to be used for a new
     // allocation.
@@ -1888,7 +1903,7 @@ static uvm_gpu_chunk_t *claim_free_chunk(uvm_pmm_gpu_t *pmm, uvm_pmm_gpu_memory_
         chunk = find_free_chunk_locked(pmm, type, chunk_size, UVM_PMM_LIST_NO_ZERO);
 
     if (!chunk)
-        goto out;
+        return NULL;
 
     UVM_ASSERT_MSG(uvm_gpu_chunk_get_size(chunk) == chunk_size, "chunk size %u expected %u\n",
             uvm_gpu_chunk_get_size(chunk), chunk_size);
@@ -1906,12 +1921,180 @@ static uvm_gpu_chunk_t *claim_free_chunk(uvm_pmm_gpu_t *pmm, uvm_pmm_gpu_memory_
     chunk_pin(pmm, chunk);
     chunk_update_lists_locked(pmm, chunk);
 
-out:
-    uvm_spin_unlock(&pmm->list_lock);
+    return chunk;
+}
+
+// Get the current CPU's magazine for the given chunk type and size, or NULL
+// if chunks of that type and size are not cached in magazines.
+static uvm_gpu_chunk_magazine_t *chunk_magazine_get(uvm_pmm_gpu_t *pmm,
+                                                    uvm_pmm_gpu_memory_type_t type,
+                                                    uvm_chunk_size_t chunk_size)
+{
+    size_t size_index;
+
+    if (!pmm->magazines)
+        return NULL;
+
+    // Only user chunks smaller than the root chunk size are cached. Root
+    // chunks need to go through the PMA batch alloc/free accounting, and
+    // kernel chunks see comparatively little churn.
+    if (!uvm_pmm_gpu_memory_type_is_user(type) || chunk_size == UVM_CHUNK_SIZE_MAX)
+        return NULL;
+
+    size_index = hweight_long(pmm->chunk_sizes[type] & (chunk_size - 1));
+
+    // The CPU index is just a shard selector, so it doesn't matter if the
+    // thread migrates to a different CPU before the magazine lock is taken.
+    return &pmm->magazines[raw_smp_processor_id() * UVM_MAX_CHUNK_SIZES + size_index];
+}
+
+static uvm_gpu_chunk_t *claim_free_chunk(uvm_pmm_gpu_t *pmm, uvm_pmm_gpu_memory_type_t type, uvm_chunk_size_t chunk_size)
+{
+    uvm_gpu_chunk_t *chunk;
+    uvm_gpu_chunk_magazine_t *magazine = chunk_magazine_get(pmm, type, chunk_size);
+
+    if (!magazine) {
+        uvm_spin_lock(&pmm->list_lock);
+        chunk = claim_free_chunk_locked(pmm, type, chunk_size);
+        uvm_spin_unlock(&pmm->list_lock);
+
+        return chunk;
+    }
+
+    uvm_spin_lock(&magazine->lock);
+
+    if (magazine->count == 0) {
+        // The magazine is empty. Refill it in a batch under a single list
+        // lock acquisition, amortizing the cost of the global lock over
+        // several allocations. The magazine lock is kept held so the claimed
+        // chunks are guaranteed to fit.
+        uvm_spin_lock(&pmm->list_lock);
+
+        while (magazine->count < UVM_CHUNK_MAGAZINE_CAPACITY / 2) {
+            chunk = claim_free_chunk_locked(pmm, type, chunk_size);
+            if (!chunk)
+                break;
+
+            magazine->chunks[magazine->count++] = chunk;
+        }
+
+        uvm_spin_unlock(&pmm->list_lock);
+    }
+
+    if (magazine->count > 0)
+        chunk = magazine->chunks[--magazine->count];
+    else
+        chunk = NULL;
+
+    uvm_spin_unlock(&magazine->lock);
 
     return chunk;
 }
 
+// Try putting a chunk being freed in the current CPU's magazine instead of on
+// its free list. On success the chunk is held in the temporarily pinned state
+// with its VA block tracking state cleared, exactly as if it had just been
+// allocated. Returns false if the chunk is not cacheable, the magazine is
+// full, or the chunk's root chunk is being evicted; the caller then needs to
+// follow the regular free path.
+static bool chunk_magazine_try_recycle(uvm_pmm_gpu_t *pmm, uvm_gpu_chunk_t *chunk)
+{
+    uvm_gpu_chunk_magazine_t *magazine = chunk_magazine_get(pmm, chunk->type, uvm_gpu_chunk_get_size(chunk));
+
+    if (!magazine)
+        return false;
+
+    uvm_spin_lock(&magazine->lock);
+
+    if (magazine->count == UVM_CHUNK_MAGAZINE_CAPACITY) {
+        uvm_spin_unlock(&magazine->lock);
+        return false;
+    }
+
+    uvm_spin_lock(&pmm->list_lock);
+
+    // Chunks whose root chunk is being evicted have to take the regular free
+    // path so the evicting thread can pick them up, see chunk_free_locked().
+    if (chunk_is_in_eviction(pmm, chunk)) {
+        uvm_spin_unlock(&pmm->list_lock);
+        uvm_spin_unlock(&magazine->lock);
+        return false;
+    }
+
+    UVM_ASSERT(chunk->state != UVM_PMM_GPU_CHUNK_STATE_ALLOCATED || !chunk->is_referenced);
+
+    chunk->inject_split_error = false;
+
+    if (chunk->state == UVM_PMM_GPU_CHUNK_STATE_ALLOCATED) {
+        chunk->va_block = NULL;
+        chunk_pin(pmm, chunk);
+    }
+
+    chunk->va_block_page_index = PAGES_PER_UVM_VA_BLOCK;
+    chunk->is_zero = false;
+
+    chunk_update_lists_locked(pmm, chunk);
+
+    uvm_spin_unlock(&pmm->list_lock);
+
+    magazine->chunks[magazine->count++] = chunk;
+
+    uvm_spin_unlock(&magazine->lock);
+
+    return true;
+}
+
+// Free all magazine-cached chunks back to the free lists. Cached chunks pin
+// their root chunks, which makes those ineligible for eviction, so this is
+// called on memory pressure before looking for eviction candidates, and on
+// PMM teardown.
+static void chunk_magazines_drain_common(uvm_pmm_gpu_t *pmm, bool pmm_lock_held)
+{
+    size_t i;
+    size_t num_magazines;
+
+    if (!pmm->magazines)
+        return;
+
+    num_magazines = (size_t)num_possible_cpus() * UVM_MAX_CHUNK_SIZES;
+
+    for (i = 0; i < num_magazines; i++) {
+        uvm_gpu_chunk_magazine_t *magazine = &pmm->magazines[i];
+
+        while (1) {
+            uvm_gpu_chunk_t *chunk;
+
+            uvm_spin_lock(&magazine->lock);
+
+            if (magazine->count == 0) {
+                uvm_spin_unlock(&magazine->lock);
+                break;
+            }
+
+            chunk = magazine->chunks[--magazine->count];
+
+            uvm_spin_unlock(&magazine->lock);
+
+            if (pmm_lock_held)
+                free_chunk_with_merges(pmm, chunk);
+            else
+                free_chunk(pmm, chunk);
+        }
+    }
+}
+
+static void chunk_magazines_drain(uvm_pmm_gpu_t *pmm)
+{
+    chunk_magazines_drain_common(pmm, false);
+}
+
+static void chunk_magazines_drain_locked(uvm_pmm_gpu_t *pmm)
+{
+    uvm_assert_mutex_locked(&pmm->lock);
+
+    chunk_magazines_drain_common(pmm, true);
+}
+
 static NV_STATUS alloc_or_evict_root_chunk(uvm_pmm_gpu_t *pmm,
                                            uvm_pmm_gpu_memory_type_t type,
                                            uvm_pmm_alloc_flags_t flags,
@@ -2655,6 +2838,9 @@ static void free_chunk(uvm_pmm_gpu_t *pmm, uvm_gpu_chunk_t *chunk)
 
     UVM_ASSERT(check_chunk(pmm, chunk));
 
+    if (chunk_magazine_try_recycle(pmm, chunk))
+        return;
+
     if (try_chunk_free(pmm, chunk)) {
         try_free = is_root;
     }
@@ -2925,6 +3111,11 @@ static NV_STATUS uvm_pmm_gpu_pma_evict_range(void *void_pmm,
     uvm_down_write(&pmm->pma_lock);
     uvm_up_write(&pmm->pma_lock);
 
+    // Magazine-cached chunks keep their root chunks pinned, which would make
+    // the wait for evictability below time out. Return them to the free lists
+    // first.
+    chunk_magazines_drain(pmm);
+
     for (; address <= phys_end; address += UVM_CHUNK_SIZE_MAX) {
         uvm_gpu_root_chunk_t *root_chunk = root_chunk_from_address(pmm, address);
         uvm_gpu_chunk_t *chunk = &root_chunk->chunk;
@@ -3616,6 +3807,20 @@ NV_STATUS uvm_pmm_gpu_init(uvm_pmm_gpu_t *pmm)
                 "chunk sizes %lu, max chunk sizes %u\n", hweight_long(pmm->chunk_sizes[i]), UVM_MAX_CHUNK_SIZES);
     }
 
+    // The magazines are disabled on NUMA-enabled GPUs: chunks cached there
+    // would bypass the elevated page refcount check done when claiming chunks
+    // from the free lists, see Bug 2085760. The magazines are an optional
+    // optimization, so failure to allocate them is not fatal.
+    if (uvm_perf_pmm_chunk_magazines && !gpu->mem_info.numa.enabled) {
+        const size_t num_magazines = (size_t)num_possible_cpus() * UVM_MAX_CHUNK_SIZES;
+
+        pmm->magazines = uvm_kvmalloc_zero(sizeof(*pmm->magazines) * num_magazines);
+        if (pmm->magazines) {
+            for (i = 0; i < num_magazines; i++)
+                uvm_spin_lock_init(&pmm->magazines[i].lock, UVM_LOCK_ORDER_PMM_MAGAZINE);
+        }
+    }
+
     status = init_caches(pmm);
     if (status != NV_OK)
         goto cleanup;
@@ -3690,6 +3895,10 @@ static void release_free_root_chunks(uvm_pmm_gpu_t *pmm)
 {
     uvm_pmm_gpu_memory_type_t type;
 
+    // Return any magazine-cached chunks to the free lists so that their root
+    // chunks can be released below.
+    chunk_magazines_drain(pmm);
+
     for (type = 0; type < UVM_PMM_GPU_MEMORY_TYPE_COUNT; ++type) {
         uvm_pmm_list_zero_t zero_type;
 
@@ -3749,6 +3958,10 @@ void uvm_pmm_gpu_deinit(uvm_pmm_gpu_t *pmm)
     }
     uvm_kvfree(pmm->root_chunks.array);
 
+    // All magazines have been drained by release_free_root_chunks()
+    uvm_kvfree(pmm->magazines);
+    pmm->magazines = NULL;
+
     deinit_caches(pmm);
 
     devmem_deinit(pmm);
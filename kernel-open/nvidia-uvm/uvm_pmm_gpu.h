@@ -344,6 +344,26 @@ typedef struct
     atomic64_t map_count;
 } uvm_gpu_root_chunk_indirect_peer_t;
 
+// Number of chunks each per-CPU free chunk magazine can hold
+#define UVM_CHUNK_MAGAZINE_CAPACITY 8
+
+// Per-CPU cache of free chunks of a single size, kept in front of the free
+// lists so that the common chunk alloc/free paths don't need to take the
+// global list lock. Cached chunks are held in the temporarily pinned state,
+// which keeps their root chunks off the eviction candidate lists and blocks
+// merges of their parents; the magazines are drained back to the free lists
+// on memory pressure.
+typedef struct
+{
+    // Protects count and chunks. Taken mostly by the owning CPU, so it is
+    // practically uncontended; other CPUs only take it to drain the magazine.
+    uvm_spinlock_t lock;
+
+    size_t count;
+
+    uvm_gpu_chunk_t *chunks[UVM_CHUNK_MAGAZINE_CAPACITY];
+} uvm_gpu_chunk_magazine_t;
+
 typedef struct uvm_pmm_gpu_struct
 {
     // Sizes of the MMU
@@ -408,6 +428,12 @@ typedef struct uvm_pmm_gpu_struct
     // Free chunk lists. There are separate lists for non-zero and zero chunks.
     struct list_head free_list[UVM_PMM_GPU_MEMORY_TYPE_COUNT][UVM_MAX_CHUNK_SIZES][UVM_PMM_LIST_ZERO_COUNT];
 
+    // Per-CPU magazines of free user chunks, indexed by
+    // [cpu * UVM_MAX_CHUNK_SIZES + chunk size index]. NULL when the chunk
+    // magazines are disabled (NUMA-enabled GPUs, see Bug 2085760, or via the
+    // uvm_perf_pmm_chunk_magazines module parameter).
+    uvm_gpu_chunk_magazine_t *magazines;
+
     // Inject an error after evicting a number of chunks. 0 means no error left
     // to be injected.
     NvU32 inject_pma_evict_error_after_num_chunks;
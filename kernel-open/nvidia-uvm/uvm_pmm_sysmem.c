@@ -57,14 +57,27 @@ void uvm_pmm_sysmem_exit(void)
     kmem_cache_destroy_safe(&g_reverse_page_map_cache);
 }
 
+// Shard holding the given DMA address. Mapped regions are at most
+// UVM_VA_BLOCK_SIZE and aligned to their size, so a mapping never straddles a
+// shard boundary.
+static uvm_pmm_sysmem_mappings_shard_t *sysmem_mappings_shard(uvm_pmm_sysmem_mappings_t *sysmem_mappings,
+                                                              NvU64 dma_addr)
+{
+    return &sysmem_mappings->shards[(dma_addr / UVM_VA_BLOCK_SIZE) % UVM_PMM_SYSMEM_MAPPINGS_SHARD_COUNT];
+}
+
 NV_STATUS uvm_pmm_sysmem_mappings_init(uvm_gpu_t *gpu, uvm_pmm_sysmem_mappings_t *sysmem_mappings)
 {
+    size_t i;
+
     memset(sysmem_mappings, 0, sizeof(*sysmem_mappings));
 
     sysmem_mappings->gpu = gpu;
 
-    uvm_mutex_init(&sysmem_mappings->reverse_map_lock, UVM_LOCK_ORDER_LEAF);
-    uvm_init_radix_tree_preloadable(&sysmem_mappings->reverse_map_tree);
+    for (i = 0; i < UVM_PMM_SYSMEM_MAPPINGS_SHARD_COUNT; i++) {
+        uvm_mutex_init(&sysmem_mappings->shards[i].reverse_map_lock, UVM_LOCK_ORDER_LEAF);
+        uvm_init_radix_tree_preloadable(&sysmem_mappings->shards[i].reverse_map_tree);
+    }
 
     return NV_OK;
 }
@@ -72,9 +85,13 @@ NV_STATUS uvm_pmm_sysmem_mappings_init(uvm_gpu_t *gpu, uvm_pmm_sysmem_mappings_t
 void uvm_pmm_sysmem_mappings_deinit(uvm_pmm_sysmem_mappings_t *sysmem_mappings)
 {
     if (sysmem_mappings->gpu) {
-        UVM_ASSERT_MSG(radix_tree_empty(&sysmem_mappings->reverse_map_tree),
-                       "radix_tree not empty for GPU %s\n",
-                       uvm_gpu_name(sysmem_mappings->gpu));
+        size_t i;
+
+        for (i = 0; i < UVM_PMM_SYSMEM_MAPPINGS_SHARD_COUNT; i++) {
+            UVM_ASSERT_MSG(radix_tree_empty(&sysmem_mappings->shards[i].reverse_map_tree),
+                           "radix_tree not empty for GPU %s\n",
+                           uvm_gpu_name(sysmem_mappings->gpu));
+        }
     }
 
     sysmem_mappings->gpu = NULL;
@@ -94,6 +111,7 @@ NV_STATUS uvm_pmm_sysmem_mappings_add_gpu_mapping(uvm_pmm_sysmem_mappings_t *sys
     NvU64 key;
     const NvU64 base_key = dma_addr / PAGE_SIZE;
     const NvU32 num_pages = region_size / PAGE_SIZE;
+    uvm_pmm_sysmem_mappings_shard_t *shard = sysmem_mappings_shard(sysmem_mappings, dma_addr);
     uvm_page_index_t page_index;
 
     UVM_ASSERT(va_block);
@@ -119,21 +137,21 @@ NV_STATUS uvm_pmm_sysmem_mappings_add_gpu_mapping(uvm_pmm_sysmem_mappings_t *sys
     new_reverse_map->region   = uvm_va_block_region(page_index, page_index + num_pages);
     new_reverse_map->owner    = owner;
 
-    uvm_mutex_lock(&sysmem_mappings->reverse_map_lock);
+    uvm_mutex_lock(&shard->reverse_map_lock);
     for (key = base_key; key < base_key + num_pages; ++key) {
-        int ret = radix_tree_insert(&sysmem_mappings->reverse_map_tree, key, new_reverse_map);
+        int ret = radix_tree_insert(&shard->reverse_map_tree, key, new_reverse_map);
         if (ret != 0) {
             NvU64 remove_key;
 
             for (remove_key = base_key; remove_key < key; ++remove_key)
-                (void)radix_tree_delete(&sysmem_mappings->reverse_map_tree, remove_key);
+                (void)radix_tree_delete(&shard->reverse_map_tree, remove_key);
 
             kmem_cache_free(g_reverse_page_map_cache, new_reverse_map);
             status = errno_to_nv_status(ret);
             break;
         }
     }
-    uvm_mutex_unlock(&sysmem_mappings->reverse_map_lock);
+    uvm_mutex_unlock(&shard->reverse_map_lock);
 
     // The assert is added for Coverity's sake. It is equivalent to adding
     // assert(num_pages > 0) before the loop. However, Coverity is not able to
@@ -150,29 +168,30 @@ static void pmm_sysmem_mappings_remove_gpu_mapping(uvm_pmm_sysmem_mappings_t *sy
     uvm_reverse_map_t *reverse_map;
     NvU64 key;
     const NvU64 base_key = dma_addr / PAGE_SIZE;
+    uvm_pmm_sysmem_mappings_shard_t *shard = sysmem_mappings_shard(sysmem_mappings, dma_addr);
 
     if (!sysmem_mappings->gpu->parent->access_counters_can_use_physical_addresses)
         return;
 
-    uvm_mutex_lock(&sysmem_mappings->reverse_map_lock);
+    uvm_mutex_lock(&shard->reverse_map_lock);
 
-    reverse_map = radix_tree_delete(&sysmem_mappings->reverse_map_tree, base_key);
+    reverse_map = radix_tree_delete(&shard->reverse_map_tree, base_key);
     if (check_mapping)
         UVM_ASSERT(reverse_map);
 
     if (!reverse_map) {
-        uvm_mutex_unlock(&sysmem_mappings->reverse_map_lock);
+        uvm_mutex_unlock(&shard->reverse_map_lock);
         return;
     }
 
     uvm_assert_mutex_locked(&reverse_map->va_block->lock);
 
     for (key = base_key + 1; key < base_key + uvm_va_block_region_num_pages(reverse_map->region); ++key) {
-        uvm_reverse_map_t *curr_reverse_map = radix_tree_delete(&sysmem_mappings->reverse_map_tree, key);
+        uvm_reverse_map_t *curr_reverse_map = radix_tree_delete(&shard->reverse_map_tree, key);
         UVM_ASSERT(curr_reverse_map == reverse_map);
     }
 
-    uvm_mutex_unlock(&sysmem_mappings->reverse_map_lock);
+    uvm_mutex_unlock(&shard->reverse_map_lock);
 
     kmem_cache_free(g_reverse_page_map_cache, reverse_map);
 }
@@ -194,6 +213,7 @@ void uvm_pmm_sysmem_mappings_reparent_gpu_mapping(uvm_pmm_sysmem_mappings_t *sys
     NvU64 virt_addr;
     uvm_reverse_map_t *reverse_map;
     const NvU64 base_key = dma_addr / PAGE_SIZE;
+    uvm_pmm_sysmem_mappings_shard_t *shard = sysmem_mappings_shard(sysmem_mappings, dma_addr);
     uvm_page_index_t new_start_page;
 
     UVM_ASSERT(PAGE_ALIGNED(dma_addr));
@@ -203,9 +223,9 @@ void uvm_pmm_sysmem_mappings_reparent_gpu_mapping(uvm_pmm_sysmem_mappings_t *sys
     if (!sysmem_mappings->gpu->parent->access_counters_can_use_physical_addresses)
         return;
 
-    uvm_mutex_lock(&sysmem_mappings->reverse_map_lock);
+    uvm_mutex_lock(&shard->reverse_map_lock);
 
-    reverse_map = radix_tree_lookup(&sysmem_mappings->reverse_map_tree, base_key);
+    reverse_map = radix_tree_lookup(&shard->reverse_map_tree, base_key);
     UVM_ASSERT(reverse_map);
 
     // Compute virt address by hand since the old VA block may be messed up
@@ -220,7 +240,7 @@ void uvm_pmm_sysmem_mappings_reparent_gpu_mapping(uvm_pmm_sysmem_mappings_t *sys
     UVM_ASSERT(uvm_va_block_contains_address(va_block, uvm_reverse_map_start(reverse_map)));
     UVM_ASSERT(uvm_va_block_contains_address(va_block, uvm_reverse_map_end(reverse_map)));
 
-    uvm_mutex_unlock(&sysmem_mappings->reverse_map_lock);
+    uvm_mutex_unlock(&shard->reverse_map_lock);
 }
 
 NV_STATUS uvm_pmm_sysmem_mappings_split_gpu_mappings(uvm_pmm_sysmem_mappings_t *sysmem_mappings,
@@ -230,6 +250,7 @@ NV_STATUS uvm_pmm_sysmem_mappings_split_gpu_mappings(uvm_pmm_sysmem_mappings_t *
     uvm_reverse_map_t *orig_reverse_map;
     const NvU64 base_key = dma_addr / PAGE_SIZE;
     const size_t num_pages = new_region_size / PAGE_SIZE;
+    uvm_pmm_sysmem_mappings_shard_t *shard = sysmem_mappings_shard(sysmem_mappings, dma_addr);
     size_t old_num_pages;
     size_t subregion, num_subregions;
     uvm_reverse_map_t **new_reverse_maps;
@@ -241,9 +262,9 @@ NV_STATUS uvm_pmm_sysmem_mappings_split_gpu_mappings(uvm_pmm_sysmem_mappings_t *
     if (!sysmem_mappings->gpu->parent->access_counters_can_use_physical_addresses)
         return NV_OK;
 
-    uvm_mutex_lock(&sysmem_mappings->reverse_map_lock);
-    orig_reverse_map = radix_tree_lookup(&sysmem_mappings->reverse_map_tree, base_key);
-    uvm_mutex_unlock(&sysmem_mappings->reverse_map_lock);
+    uvm_mutex_lock(&shard->reverse_map_lock);
+    orig_reverse_map = radix_tree_lookup(&shard->reverse_map_tree, base_key);
+    uvm_mutex_unlock(&shard->reverse_map_lock);
 
     // We can access orig_reverse_map outside the tree lock because we hold the
     // VA block lock so we cannot have concurrent modifications in the tree for
@@ -281,24 +302,24 @@ NV_STATUS uvm_pmm_sysmem_mappings_split_gpu_mappings(uvm_pmm_sysmem_mappings_t *
         new_reverse_maps[subregion - 1] = new_reverse_map;
     }
 
-    uvm_mutex_lock(&sysmem_mappings->reverse_map_lock);
+    uvm_mutex_lock(&shard->reverse_map_lock);
 
     for (subregion = 1; subregion < num_subregions; ++subregion) {
         NvU64 key;
 
         for (key = base_key + num_pages * subregion; key < base_key + num_pages * (subregion + 1); ++key) {
-            void **slot = radix_tree_lookup_slot(&sysmem_mappings->reverse_map_tree, key);
+            void **slot = radix_tree_lookup_slot(&shard->reverse_map_tree, key);
             UVM_ASSERT(slot);
             UVM_ASSERT(radix_tree_deref_slot(slot) == orig_reverse_map);
 
-            NV_RADIX_TREE_REPLACE_SLOT(&sysmem_mappings->reverse_map_tree, slot, new_reverse_maps[subregion - 1]);
+            NV_RADIX_TREE_REPLACE_SLOT(&shard->reverse_map_tree, slot, new_reverse_maps[subregion - 1]);
         }
     }
 
     orig_reverse_map->region = uvm_va_block_region(orig_reverse_map->region.first,
                                                    orig_reverse_map->region.first + num_pages);
 
-    uvm_mutex_unlock(&sysmem_mappings->reverse_map_lock);
+    uvm_mutex_unlock(&shard->reverse_map_lock);
 
     uvm_kvfree(new_reverse_maps);
     return NV_OK;
@@ -313,6 +334,7 @@ void uvm_pmm_sysmem_mappings_merge_gpu_mappings(uvm_pmm_sysmem_mappings_t *sysme
     NvU64 key;
     const NvU64 base_key = dma_addr / PAGE_SIZE;
     const size_t num_pages = new_region_size / PAGE_SIZE;
+    uvm_pmm_sysmem_mappings_shard_t *shard = sysmem_mappings_shard(sysmem_mappings, dma_addr);
     size_t num_mapping_pages;
 
     UVM_ASSERT(IS_ALIGNED(dma_addr, new_region_size));
@@ -322,10 +344,10 @@ void uvm_pmm_sysmem_mappings_merge_gpu_mappings(uvm_pmm_sysmem_mappings_t *sysme
     if (!sysmem_mappings->gpu->parent->access_counters_can_use_physical_addresses)
         return;
 
-    uvm_mutex_lock(&sysmem_mappings->reverse_map_lock);
+    uvm_mutex_lock(&shard->reverse_map_lock);
 
     // Find the first mapping in the region
-    first_reverse_map = radix_tree_lookup(&sysmem_mappings->reverse_map_tree, base_key);
+    first_reverse_map = radix_tree_lookup(&shard->reverse_map_tree, base_key);
     UVM_ASSERT(first_reverse_map);
     num_mapping_pages = uvm_va_block_region_num_pages(first_reverse_map->region);
     UVM_ASSERT(num_pages >= num_mapping_pages);
@@ -341,7 +363,7 @@ void uvm_pmm_sysmem_mappings_merge_gpu_mappings(uvm_pmm_sysmem_mappings_t *sysme
     running_page_index = first_reverse_map->region.outer;
     while (key < base_key + num_pages) {
         uvm_reverse_map_t *reverse_map = NULL;
-        void **slot = radix_tree_lookup_slot(&sysmem_mappings->reverse_map_tree, key);
+        void **slot = radix_tree_lookup_slot(&shard->reverse_map_tree, key);
         size_t slot_index;
         UVM_ASSERT(slot);
 
@@ -352,18 +374,18 @@ void uvm_pmm_sysmem_mappings_merge_gpu_mappings(uvm_pmm_sysmem_mappings_t *sysme
         UVM_ASSERT(uvm_id_equal(reverse_map->owner, first_reverse_map->owner));
         UVM_ASSERT(reverse_map->region.first == running_page_index);
 
-        NV_RADIX_TREE_REPLACE_SLOT(&sysmem_mappings->reverse_map_tree, slot, first_reverse_map);
+        NV_RADIX_TREE_REPLACE_SLOT(&shard->reverse_map_tree, slot, first_reverse_map);
 
         num_mapping_pages = uvm_va_block_region_num_pages(reverse_map->region);
         UVM_ASSERT(IS_ALIGNED(key, num_mapping_pages));
         UVM_ASSERT(key + num_mapping_pages <= base_key + num_pages);
 
         for (slot_index = 1; slot_index < num_mapping_pages; ++slot_index) {
-            slot = radix_tree_lookup_slot(&sysmem_mappings->reverse_map_tree, key + slot_index);
+            slot = radix_tree_lookup_slot(&shard->reverse_map_tree, key + slot_index);
             UVM_ASSERT(slot);
             UVM_ASSERT(reverse_map == radix_tree_deref_slot(slot));
 
-            NV_RADIX_TREE_REPLACE_SLOT(&sysmem_mappings->reverse_map_tree, slot, first_reverse_map);
+            NV_RADIX_TREE_REPLACE_SLOT(&shard->reverse_map_tree, slot, first_reverse_map);
         }
 
         key += num_mapping_pages;
@@ -376,30 +398,24 @@ void uvm_pmm_sysmem_mappings_merge_gpu_mappings(uvm_pmm_sysmem_mappings_t *sysme
     first_reverse_map->region.outer = first_reverse_map->region.first + num_pages;
 
 unlock_no_update:
-    uvm_mutex_unlock(&sysmem_mappings->reverse_map_lock);
+    uvm_mutex_unlock(&shard->reverse_map_lock);
 }
 
-size_t uvm_pmm_sysmem_mappings_dma_to_virt(uvm_pmm_sysmem_mappings_t *sysmem_mappings,
-                                           NvU64 dma_addr,
-                                           NvU64 region_size,
-                                           uvm_reverse_map_t *out_mappings,
-                                           size_t max_out_mappings)
+// Translate the keys in [key, key + num_pages), which must all belong to the
+// given shard, with the shard lock held.
+static size_t shard_dma_to_virt(uvm_pmm_sysmem_mappings_shard_t *shard,
+                                NvU64 key,
+                                NvU32 num_pages,
+                                uvm_reverse_map_t *out_mappings,
+                                size_t max_out_mappings)
 {
-    NvU64 key;
     size_t num_mappings = 0;
-    const NvU64 base_key = dma_addr / PAGE_SIZE;
-    NvU32 num_pages = region_size / PAGE_SIZE;
 
-    UVM_ASSERT(region_size >= PAGE_SIZE);
-    UVM_ASSERT(PAGE_ALIGNED(region_size));
-    UVM_ASSERT(sysmem_mappings->gpu->parent->access_counters_can_use_physical_addresses);
+    uvm_assert_mutex_locked(&shard->reverse_map_lock);
     UVM_ASSERT(max_out_mappings > 0);
 
-    uvm_mutex_lock(&sysmem_mappings->reverse_map_lock);
-
-    key = base_key;
     do {
-        uvm_reverse_map_t *reverse_map = radix_tree_lookup(&sysmem_mappings->reverse_map_tree, key);
+        uvm_reverse_map_t *reverse_map = radix_tree_lookup(&shard->reverse_map_tree, key);
 
         if (reverse_map) {
             size_t num_chunk_pages = uvm_va_block_region_num_pages(reverse_map->region);
@@ -427,7 +443,98 @@ size_t uvm_pmm_sysmem_mappings_dma_to_virt(uvm_pmm_sysmem_mappings_t *sysmem_map
     }
     while (num_pages > 0);
 
-    uvm_mutex_unlock(&sysmem_mappings->reverse_map_lock);
+    return num_mappings;
+}
+
+size_t uvm_pmm_sysmem_mappings_dma_to_virt(uvm_pmm_sysmem_mappings_t *sysmem_mappings,
+                                           NvU64 dma_addr,
+                                           NvU64 region_size,
+                                           uvm_reverse_map_t *out_mappings,
+                                           size_t max_out_mappings)
+{
+    const NvU64 keys_per_shard_region = UVM_VA_BLOCK_SIZE / PAGE_SIZE;
+    NvU64 key = dma_addr / PAGE_SIZE;
+    NvU32 num_pages = region_size / PAGE_SIZE;
+    size_t num_mappings = 0;
+
+    UVM_ASSERT(region_size >= PAGE_SIZE);
+    UVM_ASSERT(PAGE_ALIGNED(region_size));
+    UVM_ASSERT(sysmem_mappings->gpu->parent->access_counters_can_use_physical_addresses);
+    UVM_ASSERT(max_out_mappings > 0);
+
+    // Translate one shard at a time since the range may cross a shard boundary
+    while (num_pages > 0 && num_mappings < max_out_mappings) {
+        uvm_pmm_sysmem_mappings_shard_t *shard = sysmem_mappings_shard(sysmem_mappings, key * PAGE_SIZE);
+        NvU64 shard_keys_end = UVM_ALIGN_DOWN(key, keys_per_shard_region) + keys_per_shard_region;
+        NvU32 shard_num_pages = min((NvU64)num_pages, shard_keys_end - key);
+
+        uvm_mutex_lock(&shard->reverse_map_lock);
+        num_mappings += shard_dma_to_virt(shard,
+                                          key,
+                                          shard_num_pages,
+                                          out_mappings + num_mappings,
+                                          max_out_mappings - num_mappings);
+        uvm_mutex_unlock(&shard->reverse_map_lock);
+
+        key       += shard_num_pages;
+        num_pages -= shard_num_pages;
+    }
+
+    return num_mappings;
+}
+
+size_t uvm_pmm_sysmem_mappings_multi_dma_to_virt(uvm_pmm_sysmem_mappings_t *sysmem_mappings,
+                                                 const NvU64 *dma_addrs,
+                                                 const NvU64 *region_sizes,
+                                                 size_t num_ranges,
+                                                 uvm_reverse_map_t *out_mappings,
+                                                 size_t max_out_mappings)
+{
+    const NvU64 keys_per_shard_region = UVM_VA_BLOCK_SIZE / PAGE_SIZE;
+    uvm_pmm_sysmem_mappings_shard_t *locked_shard = NULL;
+    size_t num_mappings = 0;
+    size_t i;
+
+    UVM_ASSERT(sysmem_mappings->gpu->parent->access_counters_can_use_physical_addresses);
+    UVM_ASSERT(max_out_mappings > 0);
+
+    for (i = 0; i < num_ranges && num_mappings < max_out_mappings; i++) {
+        NvU64 key = dma_addrs[i] / PAGE_SIZE;
+        NvU32 num_pages = region_sizes[i] / PAGE_SIZE;
+
+        UVM_ASSERT(region_sizes[i] >= PAGE_SIZE);
+        UVM_ASSERT(PAGE_ALIGNED(region_sizes[i]));
+
+        while (num_pages > 0 && num_mappings < max_out_mappings) {
+            uvm_pmm_sysmem_mappings_shard_t *shard = sysmem_mappings_shard(sysmem_mappings, key * PAGE_SIZE);
+            NvU64 shard_keys_end = UVM_ALIGN_DOWN(key, keys_per_shard_region) + keys_per_shard_region;
+            NvU32 shard_num_pages = min((NvU64)num_pages, shard_keys_end - key);
+
+            // Only cycle the lock when moving to a different shard, so
+            // consecutive ranges within the same naturally-aligned
+            // UVM_VA_BLOCK_SIZE region are translated under a single lock
+            // acquisition.
+            if (shard != locked_shard) {
+                if (locked_shard)
+                    uvm_mutex_unlock(&locked_shard->reverse_map_lock);
+
+                uvm_mutex_lock(&shard->reverse_map_lock);
+                locked_shard = shard;
+            }
+
+            num_mappings += shard_dma_to_virt(shard,
+                                              key,
+                                              shard_num_pages,
+                                              out_mappings + num_mappings,
+                                              max_out_mappings - num_mappings);
+
+            key       += shard_num_pages;
+            num_pages -= shard_num_pages;
+        }
+    }
+
+    if (locked_shard)
+        uvm_mutex_unlock(&locked_shard->reverse_map_lock);
 
     return num_mappings;
 }
@@ -39,14 +39,31 @@
 // DMA address. For now, only PAGE_SIZE translations are supported (i.e. no
 // big/huge pages).
 //
+// The reverse map is sharded by naturally-aligned UVM_VA_BLOCK_SIZE ranges of
+// the DMA address space, each shard with its own tree and lock, so that
+// access-counter translations don't serialize against map/unmap operations
+// from fault servicing on other ranges. Mapped regions are at most
+// UVM_VA_BLOCK_SIZE and aligned to their size, so every mapping is fully
+// contained in a single shard.
+//
 // TODO: Bug 1995015: add support for physically-contiguous mappings.
-struct uvm_pmm_sysmem_mappings_struct
-{
-    uvm_gpu_t                                      *gpu;
 
+// Number of independently locked shards of the reverse map. Must be a power
+// of two.
+#define UVM_PMM_SYSMEM_MAPPINGS_SHARD_COUNT 16
+
+typedef struct
+{
     struct radix_tree_root             reverse_map_tree;
 
     uvm_mutex_t                        reverse_map_lock;
+} uvm_pmm_sysmem_mappings_shard_t;
+
+struct uvm_pmm_sysmem_mappings_struct
+{
+    uvm_gpu_t                                      *gpu;
+
+    uvm_pmm_sysmem_mappings_shard_t    shards[UVM_PMM_SYSMEM_MAPPINGS_SHARD_COUNT];
 };
 
 // See comments in uvm_linux.h
@@ -177,6 +194,22 @@ size_t uvm_pmm_sysmem_mappings_dma_to_virt(uvm_pmm_sysmem_mappings_t *sysmem_map
                                            uvm_reverse_map_t *out_mappings,
                                            size_t max_out_mappings);
 
+// Batched version of uvm_pmm_sysmem_mappings_dma_to_virt for num_ranges DMA
+// ranges given by the dma_addrs and region_sizes arrays. Translations for all
+// the ranges are written to out_mappings sequentially, up to max_out_mappings
+// in total. A shard lock is only dropped and reacquired when consecutive
+// ranges hit different shards, so translating the sub-granularity regions of
+// an access counter notification takes a single lock acquisition.
+//
+// The VA Block in each returned translation entry is retained, and it's up to
+// the caller to release them
+size_t uvm_pmm_sysmem_mappings_multi_dma_to_virt(uvm_pmm_sysmem_mappings_t *sysmem_mappings,
+                                                 const NvU64 *dma_addrs,
+                                                 const NvU64 *region_sizes,
+                                                 size_t num_ranges,
+                                                 uvm_reverse_map_t *out_mappings,
+                                                 size_t max_out_mappings);
+
 #define UVM_CPU_CHUNK_SIZES (UVM_PAGE_SIZE_2M | UVM_PAGE_SIZE_64K | PAGE_SIZE)
 
 typedef enum
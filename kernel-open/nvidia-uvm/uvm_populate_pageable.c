@@ -217,6 +217,57 @@ NV_STATUS uvm_populate_pageable(struct mm_struct *mm,
     return NV_ERR_INVALID_ADDRESS;
 }
 
+// Number of page pointers batched per get_user_pages call in the bulk path
+#define UVM_POPULATE_PAGEABLE_BULK_BATCH_PAGES 512
+
+// Bulk population fast path. Populates the whole [start, start + length)
+// range with batched get_user_pages calls, relying on get_user_pages to split
+// the range across VMAs internally instead of walking them one VMA at a time
+// with a handle_mm_fault call per page. The page references are dropped
+// immediately: the only goal is to fault the pages in.
+//
+// FOLL_WRITE is used for the whole range so that anonymous memory is fully
+// populated rather than mapped to the shared zero page, matching what the
+// slow path does for writable VMAs. Returns NV_WARN_NOTHING_TO_DO if any part
+// of the range cannot be populated this way (read-only or special VMAs,
+// unmapped holes); the caller is expected to fall back to
+// uvm_populate_pageable, which reports precise errors and handles UVM-managed
+// VMAs.
+static NV_STATUS populate_pageable_bulk(struct mm_struct *mm, unsigned long start, unsigned long length)
+{
+    struct page **pages;
+    unsigned long num_pages = length / PAGE_SIZE;
+    unsigned long done = 0;
+
+    UVM_ASSERT(PAGE_ALIGNED(start));
+    UVM_ASSERT(PAGE_ALIGNED(length));
+    UVM_ASSERT(mm == current->mm);
+    uvm_assert_mmap_lock_locked(mm);
+
+    pages = uvm_kvmalloc(min(num_pages, (unsigned long)UVM_POPULATE_PAGEABLE_BULK_BATCH_PAGES) * sizeof(pages[0]));
+    if (!pages)
+        return NV_ERR_NO_MEMORY;
+
+    while (done < num_pages) {
+        unsigned long batch_pages = min(num_pages - done, (unsigned long)UVM_POPULATE_PAGEABLE_BULK_BATCH_PAGES);
+        long ret = NV_GET_USER_PAGES(start + done * PAGE_SIZE, batch_pages, FOLL_WRITE, pages);
+        long i;
+
+        for (i = 0; i < ret; i++)
+            put_page(pages[i]);
+
+        if (ret < (long)batch_pages) {
+            uvm_kvfree(pages);
+            return NV_WARN_NOTHING_TO_DO;
+        }
+
+        done += ret;
+    }
+
+    uvm_kvfree(pages);
+    return NV_OK;
+}
+
 NV_STATUS uvm_api_populate_pageable(const UVM_POPULATE_PAGEABLE_PARAMS *params, struct file *filp)
 {
     NV_STATUS status;
@@ -259,12 +310,22 @@ NV_STATUS uvm_api_populate_pageable(const UVM_POPULATE_PAGEABLE_PARAMS *params,
     uvm_down_read_mmap_lock(current->mm);
 
     if (allow_managed || uvm_va_space_range_empty(va_space, params->base, params->base + params->length - 1)) {
-        status = uvm_populate_pageable(current->mm,
-                                       params->base,
-                                       params->length,
-                                       min_prot,
-                                       false,
-                                       UVM_POPULATE_PERMISSIONS_INHERIT);
+        // Try the bulk fast path first. It only handles the common case
+        // (no UVM-managed VMAs, default protection checks), so fall back to
+        // the per-VMA walk whenever it can't fully populate the range.
+        if (!allow_managed && !skip_prot_check)
+            status = populate_pageable_bulk(current->mm, params->base, params->length);
+        else
+            status = NV_WARN_NOTHING_TO_DO;
+
+        if (status != NV_OK) {
+            status = uvm_populate_pageable(current->mm,
+                                           params->base,
+                                           params->length,
+                                           min_prot,
+                                           false,
+                                           UVM_POPULATE_PERMISSIONS_INHERIT);
+        }
     }
     else {
         status = NV_ERR_INVALID_ADDRESS;
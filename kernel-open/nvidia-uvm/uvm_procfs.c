@@ -81,3 +81,84 @@ struct proc_dir_entry *uvm_procfs_get_cpu_base_dir(void)
     return uvm_proc_cpu;
 }
 
+// Binary telemetry counters
+//
+// Each counters page is a single zeroed kernel page exposed read-only through
+// procfs. read() returns the raw uvm_procfs_counters_t and mmap() maps the
+// backing page directly, so periodic samplers can poll the counters without
+// any text formatting or per-sample system calls.
+
+uvm_procfs_counters_t *uvm_procfs_counters_alloc(void)
+{
+    uvm_procfs_counters_t *counters;
+
+    BUILD_BUG_ON(sizeof(uvm_procfs_counters_t) > PAGE_SIZE);
+
+    counters = (uvm_procfs_counters_t *)get_zeroed_page(NV_UVM_GFP_FLAGS);
+    if (counters == NULL)
+        return NULL;
+
+    counters->version = UVM_PROCFS_COUNTERS_VERSION;
+
+    return counters;
+}
+
+void uvm_procfs_counters_free(uvm_procfs_counters_t *counters)
+{
+    // This only drops the reference taken at allocation. Live user mappings
+    // hold their own references (see uvm_procfs_counters_mmap), so the page
+    // is not actually freed until the last mapping goes away.
+    if (counters != NULL)
+        free_page((unsigned long)counters);
+}
+
+static ssize_t uvm_procfs_counters_read(struct file *file,
+                                        char __user *buf,
+                                        size_t size,
+                                        loff_t *ppos)
+{
+    uvm_procfs_counters_t *counters = NV_PDE_DATA(NV_FILE_INODE(file));
+
+    return simple_read_from_buffer(buf, size, ppos, counters, sizeof(*counters));
+}
+
+static int uvm_procfs_counters_mmap(struct file *file, struct vm_area_struct *vma)
+{
+    uvm_procfs_counters_t *counters = NV_PDE_DATA(NV_FILE_INODE(file));
+
+    if (((vma->vm_end - vma->vm_start) != PAGE_SIZE) || (vma->vm_pgoff != 0))
+        return -EINVAL;
+
+    if (vma->vm_flags & (VM_WRITE | VM_EXEC))
+        return -EACCES;
+
+    // Keep the mapping read-only across future mprotect() calls
+    nv_vm_flags_clear(vma, VM_MAYWRITE | VM_MAYEXEC);
+
+    // VM_MIXEDMAP is required to use vm_insert_page
+    nv_vm_flags_set(vma, VM_MIXEDMAP);
+
+    //
+    // Unlike remap_pfn_range, vm_insert_page takes a reference on the page
+    // for each mapping, so a user mapping that outlives the GPU keeps the
+    // page alive until it is unmapped: uvm_procfs_counters_free only drops
+    // the creator's reference.
+    //
+    return vm_insert_page(vma, vma->vm_start, virt_to_page(counters));
+}
+
+static const nv_proc_ops_t uvm_procfs_counters_fops =
+{
+    NV_PROC_OPS_SET_OWNER()
+    .NV_PROC_OPS_READ  = uvm_procfs_counters_read,
+    .NV_PROC_OPS_LSEEK = default_llseek,
+    .NV_PROC_OPS_MMAP  = uvm_procfs_counters_mmap,
+};
+
+struct proc_dir_entry *uvm_procfs_counters_create_file(const char *name,
+                                                       struct proc_dir_entry *parent,
+                                                       uvm_procfs_counters_t *counters)
+{
+    return proc_create_data(name, S_IFREG | S_IRUGO, parent, &uvm_procfs_counters_fops, counters);
+}
+
@@ -53,6 +53,71 @@ static bool uvm_procfs_is_debug_enabled(void)
 struct proc_dir_entry *uvm_procfs_get_gpu_base_dir(void);
 struct proc_dir_entry *uvm_procfs_get_cpu_base_dir(void);
 
+#define UVM_PROCFS_COUNTERS_VERSION 1
+
+// Layout of the binary counters pages exposed through procfs. All fields
+// after version are monotonically increasing 64-bit event counters, updated
+// with plain stores on the existing statistics update paths. They are
+// telemetry, not an API: rare lost updates from concurrent updaters and
+// torn reads of unrelated fields are acceptable, and samplers are expected
+// to compute rates by diffing periodic snapshots.
+typedef struct uvm_procfs_counters_struct
+{
+    // Layout version of this page, set to UVM_PROCFS_COUNTERS_VERSION
+    NvU64 version;
+
+    // Replayable fault counts by access type
+    NvU64 replayable_prefetch_faults;
+    NvU64 replayable_read_faults;
+    NvU64 replayable_write_faults;
+    NvU64 replayable_atomic_faults;
+    NvU64 replayable_duplicate_faults;
+
+    // Non-replayable fault counts by access type
+    NvU64 non_replayable_read_faults;
+    NvU64 non_replayable_write_faults;
+    NvU64 non_replayable_atomic_faults;
+
+    // Migration traffic in bytes, from the perspective of the GPU owning
+    // this page
+    NvU64 migrated_bytes_in;
+    NvU64 migrated_bytes_out;
+
+    // Bytes migrated in due to the prefetch policy. Together with
+    // replayable_prefetch_faults this allows estimating prefetch hit rates.
+    NvU64 prefetched_bytes_in;
+
+    // Number of thrashing throttle events
+    NvU64 throttle_events;
+} uvm_procfs_counters_t;
+
+// Allocate a zeroed, page-sized counters structure with the version field
+// initialized. Returns NULL on allocation failure.
+uvm_procfs_counters_t *uvm_procfs_counters_alloc(void);
+
+// Free a counters structure. Must not be called before the procfs file
+// exposing it has been removed. Existing user mappings of the page hold
+// their own references, so the backing page outlives this call until the
+// last mapping is torn down. counters may be NULL.
+void uvm_procfs_counters_free(uvm_procfs_counters_t *counters);
+
+// Create a read-only procfs file exposing the given counters page. The file
+// supports both read() of the raw structure and a read-only mmap() of the
+// page. Returns NULL on failure.
+struct proc_dir_entry *uvm_procfs_counters_create_file(const char *name,
+                                                       struct proc_dir_entry *parent,
+                                                       uvm_procfs_counters_t *counters);
+
+// Bump a counter with a plain store. counters may be NULL when procfs is
+// disabled, in which case this is a no-op.
+#define uvm_procfs_counter_add(counters, field, n)  \
+    do {                                            \
+        if ((counters) != NULL)                     \
+            (counters)->field += (n);               \
+    } while (0)
+
+#define uvm_procfs_counter_inc(counters, field) uvm_procfs_counter_add(counters, field, 1)
+
 int uvm_procfs_open_callback(void);
 void uvm_procfs_close_callback(void);
 
@@ -24,6 +24,8 @@
 #include "uvm_pte_batch.h"
 #include "uvm_hal.h"
 
+static void pte_batch_begin_inline(uvm_pte_batch_t *batch);
+
 static bool uvm_gpu_phys_address_eq(uvm_gpu_phys_address_t pa1, uvm_gpu_phys_address_t pa2)
 {
     return pa1.address == pa2.address && pa1.aperture == pa2.aperture;
@@ -63,24 +65,44 @@ static void uvm_pte_batch_flush_ptes_memset(uvm_pte_batch_t *batch)
 {
     uvm_gpu_t *gpu = uvm_push_get_gpu(batch->push);
     uvm_gpu_address_t addr = uvm_mmu_gpu_address(gpu, batch->pte_first_address);
-    NvU32 i;
+    NvU32 i = 0;
 
     UVM_ASSERT(batch->pte_count != 0);
     UVM_ASSERT(!batch->inlining);
 
-    for (i = 0; i < batch->pte_count; ++i) {
+    while (i < batch->pte_count) {
+        NvU32 run = 1;
+
+        // memset_8 writes a repeating 8 byte pattern, so a run of consecutive
+        // entries with the same value can be written with a single memset as
+        // long as the entries are exactly 8 bytes apart.
+        if (batch->pte_entry_size == sizeof(NvU64)) {
+            while (i + run < batch->pte_count && batch->pte_bits_queue[i + run] == batch->pte_bits_queue[i])
+                ++run;
+        }
+
         uvm_push_set_flag(batch->push, UVM_PUSH_FLAG_NEXT_MEMBAR_NONE);
         uvm_push_set_flag(batch->push, UVM_PUSH_FLAG_CE_NEXT_PIPELINED);
-        gpu->parent->ce_hal->memset_8(batch->push, addr, batch->pte_bits_queue[i], sizeof(NvU64));
-        addr.address += batch->pte_entry_size;
+        gpu->parent->ce_hal->memset_8(batch->push, addr, batch->pte_bits_queue[i], run * sizeof(NvU64));
+        addr.address += run * batch->pte_entry_size;
+        i += run;
     }
 }
 
+// Number of queued PTEs above which a flush stages the values as inline data
+// in the pushbuffer and writes them with a single CE copy instead of issuing
+// one memset per PTE. Small runs keep the memset path as it avoids the copy
+// setup overhead and the inline data space in the pushbuffer.
+#define UVM_PTE_BATCH_INLINE_FLUSH_THRESHOLD 16
+
 static void uvm_pte_batch_flush_ptes(uvm_pte_batch_t *batch)
 {
     if (batch->pte_count == 0)
         return;
 
+    if (!batch->inlining && batch->pte_count >= UVM_PTE_BATCH_INLINE_FLUSH_THRESHOLD)
+        pte_batch_begin_inline(batch);
+
     if (batch->inlining)
         uvm_pte_batch_flush_ptes_inline(batch);
     else
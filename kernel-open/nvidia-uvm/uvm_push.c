@@ -278,6 +278,41 @@ NV_STATUS __uvm_push_begin_acquire_with_info(uvm_channel_manager_t *manager,
     return status;
 }
 
+__attribute__ ((format(printf, 9, 10)))
+NV_STATUS __uvm_push_begin_acquire_stripe_with_info(uvm_channel_manager_t *manager,
+                                                    uvm_channel_type_t type,
+                                                    NvU32 stripe,
+                                                    uvm_tracker_t *tracker,
+                                                    uvm_push_t *push,
+                                                    const char *filename,
+                                                    const char *function,
+                                                    int line,
+                                                    const char *format, ...)
+{
+    va_list args;
+    NV_STATUS status;
+    uvm_channel_t *channel;
+
+    status = wait_for_other_gpus_if_needed(tracker, manager->gpu);
+    if (status != NV_OK)
+        return status;
+
+    status = uvm_channel_reserve_type_stripe(manager, type, stripe, &channel);
+    if (status != NV_OK)
+        return status;
+
+    UVM_ASSERT(channel);
+
+    va_start(args, format);
+    status = push_begin_acquire_with_info(channel, tracker, push, filename, function, line, format, args);
+    va_end(args);
+
+    if (status != NV_OK)
+        uvm_channel_release(channel, 1);
+
+    return status;
+}
+
 __attribute__ ((format(printf, 7, 8)))
 NV_STATUS __uvm_push_begin_acquire_on_channel_with_info(uvm_channel_t *channel,
                                                         uvm_tracker_t *tracker,
@@ -199,6 +199,18 @@ NV_STATUS __uvm_push_begin_acquire_with_info(uvm_channel_manager_t *manager,
                                              int line,
                                              const char *format, ...);
 
+// Internal helper for uvm_push_begin_acquire_stripe
+__attribute__ ((format(printf, 9, 10)))
+NV_STATUS __uvm_push_begin_acquire_stripe_with_info(uvm_channel_manager_t *manager,
+                                                    uvm_channel_type_t type,
+                                                    NvU32 stripe,
+                                                    uvm_tracker_t *tracker,
+                                                    uvm_push_t *push,
+                                                    const char *filename,
+                                                    const char *function,
+                                                    int line,
+                                                    const char *format, ...);
+
 // Internal helper for uvm_push_begin_on_channel and
 // uvm_push_begin_acquire_on_channel
 __attribute__ ((format(printf, 7, 8)))
@@ -245,6 +257,16 @@ NV_STATUS __uvm_push_begin_on_reserved_channel_with_info(uvm_channel_t *channel,
     __uvm_push_begin_acquire_with_info((manager), (type), NULL, (tracker), (push), \
         __FILE__, __FUNCTION__, __LINE__, (format), ##__VA_ARGS__)
 
+// Same as uvm_push_begin_acquire, but spreads consecutive stripe values over
+// all CE channel pools instead of always using the default pool for the type.
+// Used to drive independent copies of a large migration through multiple CEs.
+//
+// Locking: on success acquires the concurrent push semaphore until
+//          uvm_push_end()
+#define uvm_push_begin_acquire_stripe(manager, type, stripe, tracker, push, format, ...)          \
+    __uvm_push_begin_acquire_stripe_with_info((manager), (type), (stripe), (tracker), (push), \
+        __FILE__, __FUNCTION__, __LINE__, (format), ##__VA_ARGS__)
+
 // Specialization of uvm_push_begin that is optimized for pushes that
 // transfer data from manager->gpu to dst_gpu.
 // dst_gpu must be NULL or a GPU other than manager->gpu
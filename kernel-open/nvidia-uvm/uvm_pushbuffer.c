@@ -172,28 +172,6 @@ error:
     return status;
 }
 
-static uvm_pushbuffer_chunk_t *get_chunk_in_mask(uvm_pushbuffer_t *pushbuffer, unsigned long *mask)
-{
-    NvU32 index = find_first_bit(mask, UVM_PUSHBUFFER_CHUNKS);
-
-    uvm_assert_spinlock_locked(&pushbuffer->lock);
-
-    if (index == UVM_PUSHBUFFER_CHUNKS)
-        return NULL;
-
-    return &pushbuffer->chunks[index];
-}
-
-static uvm_pushbuffer_chunk_t *get_available_chunk(uvm_pushbuffer_t *pushbuffer)
-{
-    return get_chunk_in_mask(pushbuffer, pushbuffer->available_chunks);
-}
-
-static uvm_pushbuffer_chunk_t *get_idle_chunk(uvm_pushbuffer_t *pushbuffer)
-{
-    return get_chunk_in_mask(pushbuffer, pushbuffer->idle_chunks);
-}
-
 static NvU32 chunk_get_index(uvm_pushbuffer_t *pushbuffer, uvm_pushbuffer_chunk_t *chunk)
 {
     NvU32 index = chunk - pushbuffer->chunks;
@@ -215,46 +193,71 @@ static void set_chunk(uvm_pushbuffer_t *pushbuffer, uvm_pushbuffer_chunk_t *chun
     __set_bit(index, mask);
 }
 
-static void clear_chunk(uvm_pushbuffer_t *pushbuffer, uvm_pushbuffer_chunk_t *chunk, unsigned long *mask)
+static void update_chunk(uvm_pushbuffer_t *pushbuffer, uvm_pushbuffer_chunk_t *chunk);
+
+// Try to claim a chunk from the given bitmap without serializing on the
+// pushbuffer lock. A chunk is claimed by atomically swapping a NULL
+// current_push for the new push; the bitmap is scanned without the lock and
+// acts only as a (possibly stale) hint of which chunks are worth claiming.
+// The winner takes the lock just to re-validate availability and update the
+// bitmaps, so concurrent claimants no longer convoy on the lock. The scan
+// starts at a per-CPU offset to spread concurrent claimants across different
+// chunks.
+static bool try_claim_chunk_in_mask(uvm_pushbuffer_t *pushbuffer,
+                                    uvm_push_t *push,
+                                    unsigned long *mask,
+                                    uvm_pushbuffer_chunk_t **chunk_out)
 {
-    NvU32 index = chunk_get_index(pushbuffer, chunk);
+    NvU32 start = raw_smp_processor_id() % UVM_PUSHBUFFER_CHUNKS;
+    NvU32 i;
 
-    uvm_assert_spinlock_locked(&pushbuffer->lock);
+    for (i = 0; i < UVM_PUSHBUFFER_CHUNKS; i++) {
+        NvU32 index = (start + i) % UVM_PUSHBUFFER_CHUNKS;
+        uvm_pushbuffer_chunk_t *chunk = &pushbuffer->chunks[index];
 
-    __clear_bit(index, mask);
-}
+        if (!test_bit(index, mask))
+            continue;
 
-static uvm_pushbuffer_chunk_t *pick_chunk(uvm_pushbuffer_t *pushbuffer)
-{
-    uvm_pushbuffer_chunk_t *chunk = get_idle_chunk(pushbuffer);
+        // Claim ownership of the chunk. Losers move on to the next candidate.
+        if (nv_atomic_long_cmpxchg((atomic_long_t *)&chunk->current_push, (long)NULL, (long)push) != (long)NULL)
+            continue;
 
-    uvm_assert_spinlock_locked(&pushbuffer->lock);
+        uvm_spin_lock(&pushbuffer->lock);
 
-    if (chunk == NULL)
-        chunk = get_available_chunk(pushbuffer);
+        // The bitmap scan above is racy: the chunk may have been claimed,
+        // filled up and released by another thread after the bit was sampled.
+        // Re-validate now that the CAS made us the owner.
+        if (test_bit(index, pushbuffer->available_chunks)) {
+            __clear_bit(index, pushbuffer->available_chunks);
+            __clear_bit(index, pushbuffer->idle_chunks);
 
-    return chunk;
-}
+            uvm_spin_unlock(&pushbuffer->lock);
 
-static bool try_claim_chunk(uvm_pushbuffer_t *pushbuffer, uvm_push_t *push, uvm_pushbuffer_chunk_t **chunk_out)
-{
-    uvm_pushbuffer_chunk_t *chunk;
+            *chunk_out = chunk;
+            return true;
+        }
 
-    uvm_spin_lock(&pushbuffer->lock);
+        // The chunk has no space after all. Release ownership, processing any
+        // chunk state updates that were deferred while we owned it (see
+        // uvm_pushbuffer_mark_completed()).
+        chunk->current_push = NULL;
+        update_chunk(pushbuffer, chunk);
 
-    chunk = pick_chunk(pushbuffer);
-    if (!chunk)
-        goto done;
+        uvm_spin_unlock(&pushbuffer->lock);
+    }
 
-    chunk->current_push = push;
-    clear_chunk(pushbuffer, chunk, pushbuffer->idle_chunks);
-    clear_chunk(pushbuffer, chunk, pushbuffer->available_chunks);
+    return false;
+}
 
-done:
-    uvm_spin_unlock(&pushbuffer->lock);
-    *chunk_out = chunk;
+static bool try_claim_chunk(uvm_pushbuffer_t *pushbuffer, uvm_push_t *push, uvm_pushbuffer_chunk_t **chunk_out)
+{
+    // Prefer idle chunks: pushes there start at the very beginning of the
+    // chunk, avoiding the waste at its end described at the top of
+    // uvm_pushbuffer.h.
+    if (try_claim_chunk_in_mask(pushbuffer, push, pushbuffer->idle_chunks, chunk_out))
+        return true;
 
-    return chunk != NULL;
+    return try_claim_chunk_in_mask(pushbuffer, push, pushbuffer->available_chunks, chunk_out);
 }
 
 static char *get_base_cpu_va(uvm_pushbuffer_t *pushbuffer)
@@ -636,7 +639,8 @@ bool uvm_pushbuffer_has_space(uvm_pushbuffer_t *pushbuffer)
 
     uvm_spin_lock(&pushbuffer->lock);
 
-    has_space = pick_chunk(pushbuffer) != NULL;
+    // Idle chunks are a subset of the available ones, see update_chunk()
+    has_space = !bitmap_empty(pushbuffer->available_chunks, UVM_PUSHBUFFER_CHUNKS);
 
     uvm_spin_unlock(&pushbuffer->lock);
 
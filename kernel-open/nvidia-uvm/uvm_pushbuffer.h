@@ -202,6 +202,9 @@ typedef struct
     struct list_head pending_gpfifos;
 
     // Currently on-going push in the chunk. There can be only one at a time.
+    // Chunks are claimed for a push by atomically swapping NULL for the new
+    // push (see try_claim_chunk_in_mask()), so claimants do not serialize on
+    // the pushbuffer lock.
     uvm_push_t *current_push;
 } uvm_pushbuffer_chunk_t;
 
@@ -228,7 +231,10 @@ struct uvm_pushbuffer_struct
     // Chunks that do not have an on-going push nor any pending pushes.
     DECLARE_BITMAP(idle_chunks, UVM_PUSHBUFFER_CHUNKS);
 
-    // Lock protecting chunk state and the bitmaps.
+    // Lock protecting chunk state and the bitmaps. Chunk ownership itself is
+    // claimed lock-free via compare-and-swap on each chunk's current_push;
+    // the lock covers the bitmaps, the pending GPFIFO lists and
+    // next_push_start.
     uvm_spinlock_t lock;
 
     // Semaphore enforcing a limited number of concurrent pushes.
@@ -510,6 +510,12 @@ static NV_STATUS uvm_range_groups_set_migration_policy(uvm_va_space_t *va_space,
         atomic_set(&range_groups[i]->allow_migration, !!allow_migration);
     }
 
+    // Invalidate the migratability summaries cached in VA blocks. When
+    // migration is being allowed this only forces blocks to recompute a
+    // summary that can't get less migratable, so doing it with the VA space
+    // lock in read mode is safe.
+    atomic64_inc(&va_space->range_group_change_seq);
+
     // If we are allowing migration, we are done.
     if (!allow_migration) {
         // Any fault handler/migration that executes after downgrading the lock
@@ -558,6 +564,9 @@ NV_STATUS uvm_range_group_assign_range(uvm_va_space_t *va_space, uvm_range_group
 
     uvm_assert_rwsem_locked_write(&va_space->lock);
 
+    // Invalidate the migratability summaries cached in VA blocks
+    atomic64_inc(&va_space->range_group_change_seq);
+
     if (range_group != NULL) {
         new_rgr = range_group_range_create(range_group, start, end);
         if (new_rgr == NULL)
@@ -674,6 +683,37 @@ bool uvm_range_group_all_migratable(uvm_va_space_t *va_space, NvU64 start, NvU64
     return true;
 }
 
+bool uvm_range_group_all_migratable_block(uvm_va_block_t *va_block, NvU64 start, NvU64 end)
+{
+    uvm_va_space_t *va_space = uvm_va_block_get_va_space(va_block);
+    NvU64 seq = (NvU64)atomic64_read(&va_space->range_group_change_seq);
+
+    UVM_ASSERT(start >= va_block->start);
+    UVM_ASSERT(end <= va_block->end);
+    uvm_assert_mutex_locked(&va_block->lock);
+
+    // Fast path: a cached fully-migratable whole-block summary covers any
+    // subrange of the block.
+    if (va_block->range_group_migratable_seq == seq)
+        return true;
+
+    // Refill the cache from a whole-block walk. Only the positive answer is
+    // cached: range group changes require at least the VA space lock in read
+    // mode, which we hold, so the walk cannot race with a change that would
+    // make the block non-migratable before the sequence number is re-checked.
+    if (uvm_range_group_all_migratable(va_space, va_block->start, va_block->end)) {
+        va_block->range_group_migratable_seq = seq;
+        return true;
+    }
+
+    // The block has non-migratable parts, so the requested subrange needs a
+    // precise walk.
+    if (start == va_block->start && end == va_block->end)
+        return false;
+
+    return uvm_range_group_all_migratable(va_space, start, end);
+}
+
 uvm_range_group_range_t *uvm_range_group_range_find(uvm_va_space_t *va_space, NvU64 addr)
 {
     uvm_range_tree_node_t *node;
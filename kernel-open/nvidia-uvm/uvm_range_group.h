@@ -105,6 +105,12 @@ bool uvm_range_group_any_migratable(uvm_va_space_t *va_space, NvU64 start, NvU64
 // True otherwise, even if the range is invalid.
 bool uvm_range_group_all_migratable(uvm_va_space_t *va_space, NvU64 start, NvU64 end);
 
+// Same as uvm_range_group_all_migratable for [start, end] within va_block, but
+// answers from the block's cached migratability summary when it is still
+// valid, only falling back to the range group range tree walk on a cache miss.
+// The block lock must be held.
+bool uvm_range_group_all_migratable_block(uvm_va_block_t *va_block, NvU64 start, NvU64 end);
+
 // These iterators return range group ranges, skipping over addresses that have no associated range group.
 uvm_range_group_range_t *uvm_range_group_range_find(uvm_va_space_t *va_space, NvU64 addr);
 uvm_range_group_range_t *uvm_range_group_range_iter_first(uvm_va_space_t *va_space, NvU64 start, NvU64 end);
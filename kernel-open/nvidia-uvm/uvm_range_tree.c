@@ -238,6 +238,45 @@ uvm_range_tree_node_t *uvm_range_tree_iter_first(uvm_range_tree_t *tree, NvU64 s
     return NULL;
 }
 
+uvm_range_tree_node_t *uvm_range_tree_iter_first_hint(uvm_range_tree_t *tree,
+                                                      NvU64 start,
+                                                      NvU64 end,
+                                                      uvm_range_tree_node_t **hint_inout)
+{
+    uvm_range_tree_node_t *hint = *hint_inout;
+    uvm_range_tree_node_t *node;
+
+    UVM_ASSERT(start <= end);
+
+    if (hint && start >= hint->start) {
+        if (start <= hint->end)
+            return hint;
+
+        // start is past the hint node. Sorted batches usually move to the
+        // immediate successor, so check it before falling back to a full
+        // descent from the root.
+        node = uvm_range_tree_next(tree, hint);
+
+        // The hint is the last node in the tree, so nothing can contain or
+        // follow start. Keep the hint so later lookups stay O(1).
+        if (!node)
+            return NULL;
+
+        if (start <= node->end) {
+            *hint_inout = node;
+            if (node->start <= end)
+                return node;
+            return NULL;
+        }
+    }
+
+    node = uvm_range_tree_iter_first(tree, start, end);
+    if (node)
+        *hint_inout = node;
+
+    return node;
+}
+
 NV_STATUS uvm_range_tree_find_hole(uvm_range_tree_t *tree, NvU64 addr, NvU64 *start, NvU64 *end)
 {
     uvm_range_tree_node_t *node;
@@ -123,6 +123,21 @@ static uvm_range_tree_node_t *uvm_range_tree_next(uvm_range_tree_t *tree, uvm_ra
 // Returns the first node in the range [start, end], if any
 uvm_range_tree_node_t *uvm_range_tree_iter_first(uvm_range_tree_t *tree, NvU64 start, NvU64 end);
 
+// Like uvm_range_tree_iter_first, but consults and updates a caller-owned
+// lookup hint so that consecutive lookups landing on the hint node or its
+// successor skip the full tree descent. This helps batched lookups that are
+// sorted by address, such as fault batches.
+//
+// *hint_inout must be NULL or point to a node currently in the tree. Because
+// the hint is owned by the caller rather than stored in the tree, lookups
+// under a shared lock remain safe. The caller must reset the hint to NULL if
+// the tree may have been modified, or if the lock protecting the tree was
+// dropped, since the hint was last updated.
+uvm_range_tree_node_t *uvm_range_tree_iter_first_hint(uvm_range_tree_t *tree,
+                                                      NvU64 start,
+                                                      NvU64 end,
+                                                      uvm_range_tree_node_t **hint_inout);
+
 // Returns the node following the provided node in address order, if that node's
 // start <= the provided end.
 static uvm_range_tree_node_t *uvm_range_tree_iter_next(uvm_range_tree_t *tree, uvm_range_tree_node_t *node, NvU64 end)
@@ -310,6 +310,9 @@ long uvm_test_ioctl(struct file *filp, unsigned int cmd, unsigned long arg)
         UVM_ROUTE_CMD_STACK_INIT_CHECK(UVM_TEST_VA_SPACE_ALLOW_MOVABLE_ALLOCATIONS,
                                        uvm_test_va_space_allow_movable_allocations);
         UVM_ROUTE_CMD_STACK_INIT_CHECK(UVM_TEST_SKIP_MIGRATE_VMA, uvm_test_skip_migrate_vma);
+        UVM_ROUTE_CMD_STACK_INIT_CHECK(UVM_TEST_SET_PREFETCH_THRESHOLD, uvm_test_set_prefetch_threshold);
+        UVM_ROUTE_CMD_STACK_INIT_CHECK(UVM_TEST_PERF_FAULT_LATENCY, uvm_test_perf_fault_latency);
+        UVM_ROUTE_CMD_STACK_INIT_CHECK(UVM_TEST_PERF_MIGRATION_BW, uvm_test_perf_migration_bw);
     }
 
     return -EINVAL;
@@ -1478,6 +1478,72 @@ typedef struct
     NV_STATUS rmStatus;                                  // Out
 } UVM_TEST_SKIP_MIGRATE_VMA_PARAMS;
 
+// Set the prefetch threshold of the managed VA range containing base:
+// percentage (1-100) of resident pages in a subregion required to trigger
+// prefetching of the rest of the subregion. 0 reverts to the
+// uvm_perf_prefetch_threshold module parameter.
+#define UVM_TEST_SET_PREFETCH_THRESHOLD                  UVM_TEST_IOCTL_BASE(104)
+typedef struct
+{
+    NvU64 base          NV_ALIGN_BYTES(8);               // In
+    NvU32 threshold;                                     // In
+    NV_STATUS rmStatus;                                  // Out
+} UVM_TEST_SET_PREFETCH_THRESHOLD_PARAMS;
+
+// Retrieve (and optionally reset) the replayable fault servicing latency
+// statistics of a GPU. The per-stage counters aggregate the time spent in
+// each stage of the fault servicing loop across all batches serviced since
+// the statistics were last reset.
+#define UVM_TEST_PERF_FAULT_LATENCY                      UVM_TEST_IOCTL_BASE(105)
+
+// Number of power-of-two bins in the batch latency histogram. Bin i counts
+// batches whose end-to-end servicing time fell within [2^i, 2^(i+1))
+// nanoseconds.
+#define UVM_TEST_PERF_FAULT_LATENCY_BINS 32
+
+typedef struct
+{
+    NvProcessorUuid gpu_uuid;                                        // In
+    NvBool          reset;                                           // In
+
+    NvU64           num_batches      NV_ALIGN_BYTES(8);              // Out
+    NvU64           num_faults       NV_ALIGN_BYTES(8);              // Out
+
+    // Total time spent fetching and preprocessing fault buffer entries
+    NvU64           fetch_ns         NV_ALIGN_BYTES(8);              // Out
+
+    // Total time spent servicing ordered fault batches
+    NvU64           service_ns       NV_ALIGN_BYTES(8);              // Out
+
+    // Total time spent issuing replays and flushing the fault buffer
+    NvU64           replay_ns        NV_ALIGN_BYTES(8);              // Out
+
+    // Total time spent waiting on batch trackers
+    NvU64           tracker_wait_ns  NV_ALIGN_BYTES(8);              // Out
+
+    NvU64           batch_latency_hist[UVM_TEST_PERF_FAULT_LATENCY_BINS] NV_ALIGN_BYTES(8); // Out
+
+    NV_STATUS       rmStatus;                                        // Out
+} UVM_TEST_PERF_FAULT_LATENCY_PARAMS;
+
+// Measure migration bandwidth by ping-ponging the given range of managed
+// memory between the given GPU and the CPU, synchronously, for the requested
+// number of iterations. Only completed round trips are accounted in
+// total_bytes, so the reported bandwidth remains meaningful if the run fails
+// or is interrupted part-way.
+#define UVM_TEST_PERF_MIGRATION_BW                       UVM_TEST_IOCTL_BASE(106)
+typedef struct
+{
+    NvU64           base             NV_ALIGN_BYTES(8);              // In
+    NvU64           length           NV_ALIGN_BYTES(8);              // In
+    NvProcessorUuid gpu_uuid;                                        // In
+    NvU32           iterations;                                      // In
+
+    NvU64           total_ns         NV_ALIGN_BYTES(8);              // Out
+    NvU64           total_bytes      NV_ALIGN_BYTES(8);              // Out
+    NV_STATUS       rmStatus;                                        // Out
+} UVM_TEST_PERF_MIGRATION_BW_PARAMS;
+
 #ifdef __cplusplus
 }
 #endif
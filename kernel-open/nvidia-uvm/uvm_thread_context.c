@@ -53,6 +53,12 @@
 // Both the table and array entries are cache aligned to avoid false sharing
 // overheads due to cache thrashing between concurrent operations on separate
 // thread contexts.
+//
+// A per-CPU cache sits in front of the table: each CPU remembers the thread
+// context most recently added or looked up on it, so the common case of a
+// single thread context per thread skips the hash and table scan entirely.
+// The table remains the source of truth for nested entries and for threads
+// that migrated or were evicted from the cache.
 
 #define UVM_THREAD_CONTEXT_ARRAY_SIZE 8
 
@@ -98,6 +104,19 @@ static DEFINE_PER_CPU(uvm_thread_context_wrapper_t, interrupt_thread_context_wra
 // allocates the array when locking for the first time.
 static DEFINE_PER_CPU(uvm_thread_context_lock_acquired_t, interrupt_thread_context_lock_acquired);
 
+// Per-CPU front-end cache for non-interrupt lookups, holding the thread
+// context most recently added or looked up on each CPU. In the common case of
+// a single thread context per thread, uvm_thread_context() is answered with a
+// couple of loads from this cache instead of hashing into the global table.
+// Zero initialized, i.e. all entries start out empty.
+//
+// An entry is only filled by its own CPU with preemption disabled, so fills
+// of a given entry never run concurrently with each other. Remote CPUs only
+// ever clear an entry (cmpxchg of the task word to 0), which means a reader
+// that sees a matching task word both before and after loading the
+// thread_context pointer is guaranteed to have read a consistent pair.
+static DEFINE_PER_CPU(uvm_thread_context_array_entry_t, thread_context_cache);
+
 static void thread_context_non_interrupt_remove(uvm_thread_context_t *thread_context,
                                                 uvm_thread_context_table_entry_t *thread_context_entry);
 
@@ -274,6 +293,7 @@ static void thread_context_non_interrupt_init(uvm_thread_context_t *thread_conte
     UVM_ASSERT(!in_interrupt());
 
     thread_context->array_index = UVM_THREAD_CONTEXT_ARRAY_SIZE;
+    thread_context->cache_cpu = -1;
 
     if (uvm_thread_context_wrapper_is_used()) {
         uvm_thread_context_wrapper_t *thread_context_wrapper;
@@ -330,12 +350,93 @@ static uvm_thread_context_table_entry_t *thread_context_non_interrupt_table_entr
     return g_thread_context_table + table_index;
 }
 
+static uvm_thread_context_t *thread_context_cache_lookup(void)
+{
+    uvm_thread_context_t *thread_context;
+    uvm_thread_context_array_entry_t *cache_entry;
+
+    UVM_ASSERT(!in_interrupt());
+
+    cache_entry = &get_cpu_var(thread_context_cache);
+    put_cpu_var(thread_context_cache);
+
+    if (atomic64_read(&cache_entry->task) != (NvU64) current)
+        return NULL;
+
+    smp_rmb();
+    thread_context = cache_entry->thread_context;
+    smp_rmb();
+
+    // Re-check the task word to validate the pair of loads. A concurrent fill
+    // by another task on this CPU clears the task word before touching the
+    // thread_context pointer, so if the task word still matches, the pointer
+    // read above belongs to the current task.
+    if (atomic64_read(&cache_entry->task) != (NvU64) current)
+        return NULL;
+
+    UVM_ASSERT(thread_context->task == current);
+
+    return thread_context;
+}
+
+// Drop the cached location of the given thread context, if any. Only called
+// by the owning task, possibly for an entry of a CPU the task has since
+// migrated away from.
+static void thread_context_cache_invalidate(uvm_thread_context_t *thread_context)
+{
+    int cpu = thread_context->cache_cpu;
+
+    if (cpu < 0)
+        return;
+
+    atomic64_cmpxchg(&per_cpu(thread_context_cache, cpu).task, (NvU64) thread_context->task, 0);
+    thread_context->cache_cpu = -1;
+}
+
+static void thread_context_cache_fill(uvm_thread_context_t *thread_context)
+{
+    int cpu;
+    uvm_thread_context_array_entry_t *cache_entry;
+
+    UVM_ASSERT(!in_interrupt());
+    UVM_ASSERT(thread_context->task == current);
+
+    // Keep at most one cached location per thread context, so removal only
+    // needs to invalidate a single entry.
+    cpu = get_cpu();
+    if (thread_context->cache_cpu != cpu)
+        thread_context_cache_invalidate(thread_context);
+
+    cache_entry = &per_cpu(thread_context_cache, cpu);
+
+    // Publish with the task word cleared while the pointer is updated, so
+    // that readers validating the task word before and after their pointer
+    // load can never observe a mixed pair. Fills are serialized per entry by
+    // having preemption disabled.
+    atomic64_set(&cache_entry->task, 0);
+    smp_wmb();
+    cache_entry->thread_context = thread_context;
+    smp_wmb();
+    atomic64_set(&cache_entry->task, (NvU64) current);
+
+    thread_context->cache_cpu = cpu;
+    put_cpu();
+}
+
 static uvm_thread_context_t *thread_context_non_interrupt(void)
 {
     unsigned long flags;
     size_t i, array_index;
     uvm_thread_context_t *thread_context;
-    uvm_thread_context_table_entry_t *table_entry = thread_context_non_interrupt_table_entry(&array_index);
+    uvm_thread_context_table_entry_t *table_entry;
+
+    // Common case: the context was added or looked up on this CPU and nothing
+    // has evicted it from the per-CPU cache since.
+    thread_context = thread_context_cache_lookup();
+    if (thread_context != NULL)
+        return thread_context;
+
+    table_entry = thread_context_non_interrupt_table_entry(&array_index);
 
     for (i = array_index; i < (UVM_THREAD_CONTEXT_ARRAY_SIZE + array_index); i++) {
         size_t curr_array_index = i % UVM_THREAD_CONTEXT_ARRAY_SIZE;
@@ -347,6 +448,8 @@ static uvm_thread_context_t *thread_context_non_interrupt(void)
             UVM_ASSERT(thread_context != NULL);
             UVM_ASSERT(thread_context->array_index == curr_array_index);
 
+            thread_context_cache_fill(thread_context);
+
             return thread_context;
         }
     }
@@ -355,6 +458,9 @@ static uvm_thread_context_t *thread_context_non_interrupt(void)
     thread_context = thread_context_non_interrupt_tree_search(&table_entry->tree, current);
     spin_unlock_irqrestore(&table_entry->tree_lock, flags);
 
+    if (thread_context != NULL)
+        thread_context_cache_fill(thread_context);
+
     return thread_context;
 }
 
@@ -500,7 +606,11 @@ bool uvm_thread_context_add(uvm_thread_context_t *thread_context)
     thread_context->task = current;
     thread_context->ignore_hmm_invalidate_va_block = NULL;
     table_entry = thread_context_non_interrupt_table_entry(&array_index);
-    return thread_context_non_interrupt_add(thread_context, table_entry, array_index);
+    if (!thread_context_non_interrupt_add(thread_context, table_entry, array_index))
+        return false;
+
+    thread_context_cache_fill(thread_context);
+    return true;
 }
 
 bool uvm_thread_context_add_at(uvm_thread_context_t *thread_context, size_t table_index)
@@ -528,6 +638,8 @@ static void thread_context_non_interrupt_remove(uvm_thread_context_t *thread_con
     array_index = thread_context->array_index;
     UVM_ASSERT(array_index <= UVM_THREAD_CONTEXT_ARRAY_SIZE);
 
+    thread_context_cache_invalidate(thread_context);
+
     // We cannot use RB_EMPTY_NODE to determine if the thread context is in the
     // tree, because the tree lock is not held and we haven't called RB_CLEAR_NODE.
     // If the thread context is indeed in the tree, concurrent operations on
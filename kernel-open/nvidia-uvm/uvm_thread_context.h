@@ -70,6 +70,13 @@ struct uvm_thread_context_struct
     // This field is ignored in interrupt paths
     NvU32 array_index;
 
+    // CPU whose per-CPU lookup cache entry points at this context, or -1 if
+    // the context is not cached. Only accessed by the owning task, so no
+    // synchronization is needed.
+    //
+    // This field is ignored in interrupt paths
+    int cache_cpu;
+
     // Set if uvm_hmm_invalidate() callbacks should be ignored on this va_block.
     // This needs to be set whenever the va_block lock is held and
     // migrate_vma_setup() needs to be called since the "slow path" which
@@ -119,6 +119,34 @@ void uvm_tlb_batch_invalidate(uvm_tlb_batch_t *batch, NvU64 start, NvU64 size, N
 
     batch->membar = uvm_membar_max(tlb_membar, batch->membar);
 
+    // Unmap storms feed many VA-contiguous ranges into the batch back to
+    // back. Extend the previous entry instead of adding a new one when the
+    // new range directly follows it, so that large contiguous unmaps are
+    // flushed as a few range invalidates instead of degrading to an
+    // invalidate-all once the entry budget is exceeded. Mixing page sizes
+    // within one entry is fine as the flush already uses the smallest page
+    // size in the entry for the invalidation stride and the depth of the
+    // biggest one.
+    //
+    // Note that once the batch has overflowed into invalidate-all mode the
+    // last stored entry may be stale, but extending it is harmless since the
+    // flush won't use the per-VA entries in that case.
+    if (batch->count > 0 && batch->count <= UVM_TLB_BATCH_MAX_ENTRIES) {
+        uvm_tlb_batch_range_t *prev_entry = &batch->ranges[batch->count - 1];
+
+        if (prev_entry->start + prev_entry->size == start) {
+            prev_entry->size += size;
+            prev_entry->page_sizes |= page_sizes;
+
+            batch->biggest_page_size = max(batch->biggest_page_size, biggest_page_size(page_sizes));
+
+            if (!batch->tree->gpu->parent->tlb_batch.va_range_invalidate_supported)
+                batch->total_pages += uvm_div_pow2_64(size, smallest_page_size(prev_entry->page_sizes));
+
+            return;
+        }
+    }
+
     ++batch->count;
 
     if (batch->tree->gpu->parent->tlb_batch.va_range_invalidate_supported)
@@ -75,6 +75,16 @@ typedef struct
     wait_queue_head_t wait_queue;
     bool is_wakeup_get_valid;
     NvU32 wakeup_get;
+
+    // Kernel-owned producer state for the lock-free enqueue path. A producer
+    // reserves a slot by atomically incrementing put_reserve, copies its entry
+    // with no lock held, then publishes the slot to the user-visible control
+    // page in reservation order by advancing put_publish. Both counters are
+    // free-running and are masked by the queue size when indexing the queue.
+    // The put pointers in the control page are mapped writable in user space,
+    // so they are never trusted for producer-side decisions.
+    atomic_t put_reserve;
+    atomic_t put_publish;
 } uvm_tools_queue_t;
 
 typedef struct
@@ -393,7 +403,7 @@ static void destroy_event_tracker(uvm_tools_event_tracker_t *event_tracker)
         uvm_va_space_t *va_space = tools_event_tracker_va_space(event_tracker);
 
         uvm_down_write(&g_tools_va_space_list_lock);
-        uvm_down_write(&va_space->perf_events.lock);
+        uvm_percpu_down_write(&va_space->perf_events.lock);
         uvm_down_write(&va_space->tools.lock);
 
         if (event_tracker->is_queue) {
@@ -448,7 +458,7 @@ static void destroy_event_tracker(uvm_tools_event_tracker_t *event_tracker)
         UVM_ASSERT(status == NV_OK);
 
         uvm_up_write(&va_space->tools.lock);
-        uvm_up_write(&va_space->perf_events.lock);
+        uvm_percpu_up_write(&va_space->perf_events.lock);
         uvm_up_write(&g_tools_va_space_list_lock);
 
         fput(event_tracker->uvm_file);
@@ -456,12 +466,89 @@ static void destroy_event_tracker(uvm_tools_event_tracker_t *event_tracker)
     kmem_cache_free(g_tools_event_tracker_cache, event_tracker);
 }
 
+// Reserve a queue slot for one entry, or return false if the queue is full.
+// The caller must have preemption disabled and, on success, must copy its
+// entry into the slot and call enqueue_event_publish().
+static bool enqueue_event_reserve(uvm_tools_queue_t *queue, NvU32 get_behind_raw, NvU32 *reserve_out)
+{
+    NvU32 queue_size = queue->queue_buffer_count;
+    NvU32 queue_mask = queue_size - 1;
+    NvU32 reserve;
+    NvU32 get_behind = get_behind_raw & queue_mask;
+
+    // get_behind is mapped into user space with read and write permissions, so
+    // it cannot be trusted. A bogus value can only cause events to be dropped
+    // or overwritten, never an out-of-bounds access, since all queue indexing
+    // masks by the queue size.
+    do {
+        reserve = (NvU32)atomic_read(&queue->put_reserve);
+
+        // one free element means that the queue is full
+        if (((queue_size + get_behind - (reserve & queue_mask)) & queue_mask) == 1)
+            return false;
+    } while ((NvU32)atomic_cmpxchg(&queue->put_reserve, (int)reserve, (int)(reserve + 1)) != reserve);
+
+    *reserve_out = reserve;
+    return true;
+}
+
+// Publish a slot reserved by enqueue_event_reserve() to the user-visible
+// control page. Slots are published in reservation order, so wait for the
+// producers of all earlier slots first. Those producers are in this same path
+// with preemption disabled, so the wait is short and bounded, like waiting on
+// a ticket spinlock.
+static void enqueue_event_publish(uvm_tools_queue_t *queue, atomic_t *put_ahead, atomic_t *put_behind, NvU32 reserve)
+{
+    NvU32 published = (reserve + 1) & (queue->queue_buffer_count - 1);
+
+    while ((NvU32)atomic_read(&queue->put_publish) != reserve)
+        cpu_relax();
+
+    // Order the entry copy before the put pointer updates so the consumer
+    // never reads a partially-written entry.
+    smp_wmb();
+
+    // put_ahead and put_behind will always be the same outside of the publish
+    // window. This allows the user-space consumer to choose either a 2 or 4
+    // pointer synchronization approach.
+    atomic_set(put_ahead, published);
+    atomic_set(put_behind, published);
+
+    atomic_set(&queue->put_publish, (int)(reserve + 1));
+}
+
+// Wake up the consumer if the notification threshold has been crossed. The
+// wakeup bookkeeping needs the queue lock, so check the threshold and the
+// last-signalled get pointer racily first to keep the common case lock-free.
+static void enqueue_event_wakeup(uvm_tools_queue_t *queue, uvm_tools_queue_snapshot_t *sn)
+{
+    NvU32 queue_mask = queue->queue_buffer_count - 1;
+
+    if (((queue->queue_buffer_count + sn->put_behind - sn->get_ahead) & queue_mask) < queue->notification_threshold)
+        return;
+
+    if (UVM_READ_ONCE(queue->is_wakeup_get_valid) && UVM_READ_ONCE(queue->wakeup_get) == sn->get_ahead)
+        return;
+
+    uvm_spin_lock(&queue->lock);
+
+    // if the queue needs to be woken up, only signal if we haven't signaled
+    // before for this value of get_ahead.
+    if (queue_needs_wakeup(queue, sn) && !(queue->is_wakeup_get_valid && queue->wakeup_get == sn->get_ahead)) {
+        queue->is_wakeup_get_valid = true;
+        queue->wakeup_get = sn->get_ahead;
+        wake_up_all(&queue->wait_queue);
+    }
+
+    uvm_spin_unlock(&queue->lock);
+}
+
 static void enqueue_event_v1(const UvmEventEntry_V1 *entry, uvm_tools_queue_t *queue)
 {
     UvmToolsEventControlData_V1 *ctrl = queue->control_v1;
     uvm_tools_queue_snapshot_t sn;
-    NvU32 queue_size = queue->queue_buffer_count;
-    NvU32 queue_mask = queue_size - 1;
+    NvU32 queue_mask = queue->queue_buffer_count - 1;
+    NvU32 reserve;
 
     // Prevent processor speculation prior to accessing user-mapped memory to
     // avoid leaking information from side-channel attacks. There are many
@@ -471,50 +558,34 @@ static void enqueue_event_v1(const UvmEventEntry_V1 *entry, uvm_tools_queue_t *q
     // safe side we'll just always block speculation.
     nv_speculation_barrier();
 
-    uvm_spin_lock(&queue->lock);
-
-    // ctrl is mapped into user space with read and write permissions,
-    // so its values cannot be trusted.
-    sn.get_behind = atomic_read((atomic_t *)&ctrl->get_behind) & queue_mask;
-    sn.put_behind = atomic_read((atomic_t *)&ctrl->put_behind) & queue_mask;
-    sn.put_ahead = (sn.put_behind + 1) & queue_mask;
+    // Disable preemption from reservation to publication so that a producer
+    // holding an unpublished slot can't be preempted while later producers
+    // spin waiting to publish after it.
+    preempt_disable();
 
-    // one free element means that the queue is full
-    if (((queue_size + sn.get_behind - sn.put_behind) & queue_mask) == 1) {
+    if (!enqueue_event_reserve(queue, atomic_read((atomic_t *)&ctrl->get_behind), &reserve)) {
         atomic64_inc((atomic64_t *)&ctrl->dropped + entry->eventData.eventType);
-        goto unlock;
+        preempt_enable();
+        return;
     }
 
-    memcpy(queue->queue_v1 + sn.put_behind, entry, sizeof(*entry));
+    memcpy(queue->queue_v1 + (reserve & queue_mask), entry, sizeof(*entry));
 
-    sn.put_behind = sn.put_ahead;
+    enqueue_event_publish(queue, (atomic_t *)&ctrl->put_ahead, (atomic_t *)&ctrl->put_behind, reserve);
 
-    // put_ahead and put_behind will always be the same outside of queue->lock
-    // this allows the user-space consumer to choose either a 2 or 4 pointer
-    // synchronization approach.
-    atomic_set((atomic_t *)&ctrl->put_ahead, sn.put_behind);
-    atomic_set((atomic_t *)&ctrl->put_behind, sn.put_behind);
+    preempt_enable();
 
+    sn.put_behind = (reserve + 1) & queue_mask;
     sn.get_ahead = atomic_read((atomic_t *)&ctrl->get_ahead);
-
-    // if the queue needs to be woken up, only signal if we haven't signaled
-    // before for this value of get_ahead.
-    if (queue_needs_wakeup(queue, &sn) && !(queue->is_wakeup_get_valid && queue->wakeup_get == sn.get_ahead)) {
-        queue->is_wakeup_get_valid = true;
-        queue->wakeup_get = sn.get_ahead;
-        wake_up_all(&queue->wait_queue);
-    }
-
-unlock:
-    uvm_spin_unlock(&queue->lock);
+    enqueue_event_wakeup(queue, &sn);
 }
 
 static void enqueue_event_v2(const UvmEventEntry_V2 *entry, uvm_tools_queue_t *queue)
 {
     UvmToolsEventControlData_V2 *ctrl = queue->control_v2;
     uvm_tools_queue_snapshot_t sn;
-    NvU32 queue_size = queue->queue_buffer_count;
-    NvU32 queue_mask = queue_size - 1;
+    NvU32 queue_mask = queue->queue_buffer_count - 1;
+    NvU32 reserve;
 
     // Prevent processor speculation prior to accessing user-mapped memory to
     // avoid leaking information from side-channel attacks. There are many
@@ -524,38 +595,26 @@ static void enqueue_event_v2(const UvmEventEntry_V2 *entry, uvm_tools_queue_t *q
     // safe side we'll just always block speculation.
     nv_speculation_barrier();
 
-    uvm_spin_lock(&queue->lock);
+    // Disable preemption from reservation to publication so that a producer
+    // holding an unpublished slot can't be preempted while later producers
+    // spin waiting to publish after it.
+    preempt_disable();
 
-    // ctrl is mapped into user space with read and write permissions,
-    // so its values cannot be trusted.
-    sn.get_behind = atomic_read((atomic_t *)&ctrl->get_behind) & queue_mask;
-    sn.put_behind = atomic_read((atomic_t *)&ctrl->put_behind) & queue_mask;
-    sn.put_ahead = (sn.put_behind + 1) & queue_mask;
-
-    // one free element means that the queue is full
-    if (((queue_size + sn.get_behind - sn.put_behind) & queue_mask) == 1) {
+    if (!enqueue_event_reserve(queue, atomic_read((atomic_t *)&ctrl->get_behind), &reserve)) {
         atomic64_inc((atomic64_t *)&ctrl->dropped + entry->eventData.eventType);
-        goto unlock;
+        preempt_enable();
+        return;
     }
 
-    memcpy(queue->queue_v2 + sn.put_behind, entry, sizeof(*entry));
+    memcpy(queue->queue_v2 + (reserve & queue_mask), entry, sizeof(*entry));
 
-    sn.put_behind = sn.put_ahead;
-    // put_ahead and put_behind will always be the same outside of queue->lock
-    // this allows the user-space consumer to choose either a 2 or 4 pointer synchronization approach
-    atomic_set((atomic_t *)&ctrl->put_ahead, sn.put_behind);
-    atomic_set((atomic_t *)&ctrl->put_behind, sn.put_behind);
+    enqueue_event_publish(queue, (atomic_t *)&ctrl->put_ahead, (atomic_t *)&ctrl->put_behind, reserve);
 
-    sn.get_ahead = atomic_read((atomic_t *)&ctrl->get_ahead);
-    // if the queue needs to be woken up, only signal if we haven't signaled before for this value of get_ahead
-    if (queue_needs_wakeup(queue, &sn) && !(queue->is_wakeup_get_valid && queue->wakeup_get == sn.get_ahead)) {
-        queue->is_wakeup_get_valid = true;
-        queue->wakeup_get = sn.get_ahead;
-        wake_up_all(&queue->wait_queue);
-    }
+    preempt_enable();
 
-unlock:
-    uvm_spin_unlock(&queue->lock);
+    sn.put_behind = (reserve + 1) & queue_mask;
+    sn.get_ahead = atomic_read((atomic_t *)&ctrl->get_ahead);
+    enqueue_event_wakeup(queue, &sn);
 }
 
 static void uvm_tools_record_event_v1(uvm_va_space_t *va_space, const UvmEventEntry_V1 *entry)
@@ -886,7 +945,7 @@ static void uvm_tools_record_fault(uvm_perf_event_t event_id, uvm_perf_event_dat
     UVM_ASSERT(event_data->fault.space);
 
     uvm_assert_rwsem_locked(&va_space->lock);
-    uvm_assert_rwsem_locked(&va_space->perf_events.lock);
+    uvm_assert_percpu_rwsem_locked(&va_space->perf_events.lock);
     UVM_ASSERT(va_space->tools.enabled);
 
     uvm_down_read(&va_space->tools.lock);
@@ -1265,7 +1324,7 @@ static void uvm_tools_record_migration(uvm_perf_event_t event_id, uvm_perf_event
     UVM_ASSERT(event_id == UVM_PERF_EVENT_MIGRATION);
 
     uvm_assert_mutex_locked(&va_block->lock);
-    uvm_assert_rwsem_locked(&va_space->perf_events.lock);
+    uvm_assert_percpu_rwsem_locked(&va_space->perf_events.lock);
     UVM_ASSERT(va_space->tools.enabled);
 
     uvm_down_read(&va_space->tools.lock);
@@ -2193,6 +2252,22 @@ NV_STATUS uvm_api_tools_init_event_tracker(UVM_TOOLS_INIT_EVENT_TRACKER_PARAMS *
 
         if (status != NV_OK)
             goto fail;
+
+        // Seed the kernel-owned producer counters from the initial put pointer
+        // supplied by user space. From this point on, user modifications of
+        // the put pointers have no effect on where the kernel writes entries.
+        if (event_tracker->version == UvmToolsEventQueueVersion_V1) {
+            atomic_set(&queue->put_reserve,
+                       (int)(atomic_read((atomic_t *)&queue->control_v1->put_behind) &
+                             (queue->queue_buffer_count - 1)));
+        }
+        else {
+            atomic_set(&queue->put_reserve,
+                       (int)(atomic_read((atomic_t *)&queue->control_v2->put_behind) &
+                             (queue->queue_buffer_count - 1)));
+        }
+
+        atomic_set(&queue->put_publish, atomic_read(&queue->put_reserve));
     }
     else {
         uvm_tools_counter_t *counter = &event_tracker->counter;
@@ -2257,7 +2332,7 @@ static NV_STATUS tools_update_perf_events_callbacks(uvm_va_space_t *va_space)
 {
     NV_STATUS status;
 
-    uvm_assert_rwsem_locked_write(&va_space->perf_events.lock);
+    uvm_assert_percpu_rwsem_locked_write(&va_space->perf_events.lock);
     uvm_assert_rwsem_locked_write(&va_space->tools.lock);
 
     if (tools_is_fault_callback_needed(va_space)) {
@@ -2304,7 +2379,7 @@ static NV_STATUS tools_update_status(uvm_va_space_t *va_space)
     NV_STATUS status;
     bool should_be_enabled;
     uvm_assert_rwsem_locked_write(&g_tools_va_space_list_lock);
-    uvm_assert_rwsem_locked_write(&va_space->perf_events.lock);
+    uvm_assert_percpu_rwsem_locked_write(&va_space->perf_events.lock);
     uvm_assert_rwsem_locked_write(&va_space->tools.lock);
 
     status = tools_update_perf_events_callbacks(va_space);
@@ -2379,7 +2454,7 @@ NV_STATUS uvm_api_tools_event_queue_enable_events(UVM_TOOLS_EVENT_QUEUE_ENABLE_E
     va_space = tools_event_tracker_va_space(event_tracker);
 
     uvm_down_write(&g_tools_va_space_list_lock);
-    uvm_down_write(&va_space->perf_events.lock);
+    uvm_percpu_down_write(&va_space->perf_events.lock);
     uvm_down_write(&va_space->tools.lock);
 
     insert_event_tracker(va_space,
@@ -2403,7 +2478,7 @@ NV_STATUS uvm_api_tools_event_queue_enable_events(UVM_TOOLS_EVENT_QUEUE_ENABLE_E
     }
 
     uvm_up_write(&va_space->tools.lock);
-    uvm_up_write(&va_space->perf_events.lock);
+    uvm_percpu_up_write(&va_space->perf_events.lock);
     uvm_up_write(&g_tools_va_space_list_lock);
 
     return status;
@@ -2421,7 +2496,7 @@ NV_STATUS uvm_api_tools_event_queue_disable_events(UVM_TOOLS_EVENT_QUEUE_DISABLE
     va_space = tools_event_tracker_va_space(event_tracker);
 
     uvm_down_write(&g_tools_va_space_list_lock);
-    uvm_down_write(&va_space->perf_events.lock);
+    uvm_percpu_down_write(&va_space->perf_events.lock);
     uvm_down_write(&va_space->tools.lock);
     remove_event_tracker(va_space,
                          event_tracker->queue.queue_nodes,
@@ -2434,7 +2509,7 @@ NV_STATUS uvm_api_tools_event_queue_disable_events(UVM_TOOLS_EVENT_QUEUE_DISABLE
     UVM_ASSERT(status == NV_OK);
 
     uvm_up_write(&va_space->tools.lock);
-    uvm_up_write(&va_space->perf_events.lock);
+    uvm_percpu_up_write(&va_space->perf_events.lock);
     uvm_up_write(&g_tools_va_space_list_lock);
     return NV_OK;
 }
@@ -2452,7 +2527,7 @@ NV_STATUS uvm_api_tools_enable_counters(UVM_TOOLS_ENABLE_COUNTERS_PARAMS *params
     va_space = tools_event_tracker_va_space(event_tracker);
 
     uvm_down_write(&g_tools_va_space_list_lock);
-    uvm_down_write(&va_space->perf_events.lock);
+    uvm_percpu_down_write(&va_space->perf_events.lock);
     uvm_down_write(&va_space->tools.lock);
 
     insert_event_tracker(va_space,
@@ -2474,7 +2549,7 @@ NV_STATUS uvm_api_tools_enable_counters(UVM_TOOLS_ENABLE_COUNTERS_PARAMS *params
     }
 
     uvm_up_write(&va_space->tools.lock);
-    uvm_up_write(&va_space->perf_events.lock);
+    uvm_percpu_up_write(&va_space->perf_events.lock);
     uvm_up_write(&g_tools_va_space_list_lock);
 
     return status;
@@ -2492,7 +2567,7 @@ NV_STATUS uvm_api_tools_disable_counters(UVM_TOOLS_DISABLE_COUNTERS_PARAMS *para
     va_space = tools_event_tracker_va_space(event_tracker);
 
     uvm_down_write(&g_tools_va_space_list_lock);
-    uvm_down_write(&va_space->perf_events.lock);
+    uvm_percpu_down_write(&va_space->perf_events.lock);
     uvm_down_write(&va_space->tools.lock);
     remove_event_tracker(va_space,
                          event_tracker->counter.counter_nodes,
@@ -2505,7 +2580,7 @@ NV_STATUS uvm_api_tools_disable_counters(UVM_TOOLS_DISABLE_COUNTERS_PARAMS *para
     UVM_ASSERT(status == NV_OK);
 
     uvm_up_write(&va_space->tools.lock);
-    uvm_up_write(&va_space->perf_events.lock);
+    uvm_percpu_up_write(&va_space->perf_events.lock);
     uvm_up_write(&g_tools_va_space_list_lock);
 
     return NV_OK;
@@ -21,6 +21,8 @@
 
 *******************************************************************************/
 
+#include "linux/sort.h"
+
 #include "uvm_tracker.h"
 #include "uvm_push.h"
 #include "uvm_channel.h"
@@ -102,9 +104,9 @@ NV_STATUS uvm_tracker_overwrite(uvm_tracker_t *dst, uvm_tracker_t *src)
 NV_STATUS uvm_tracker_reserve(uvm_tracker_t *tracker, NvU32 min_free_entries)
 {
     if (tracker->size + min_free_entries > tracker->max_size) {
-        // Special case the first resize to jump from 1 all the way to 8.
-        // This is based on a guess that if a tracker needs more than 1
-        // entry it likely needs much more.
+        // Special case the first resize to jump from the static size all the
+        // way to 8. This is based on a guess that if a tracker needs more
+        // than the static entries it likely needs much more.
         // TODO: Bug 1764961: Verify that guess.
         NvU32 new_max_size = max((NvU32)8, (NvU32)roundup_pow_of_two(tracker->size + min_free_entries));
         uvm_tracker_entry_t *new_entries;
@@ -175,6 +177,56 @@ void uvm_tracker_overwrite_with_push(uvm_tracker_t *tracker, uvm_push_t *push)
     uvm_tracker_overwrite_with_entry(tracker, &entry);
 }
 
+// When both trackers are at least this big, uvm_tracker_add_tracker() merges
+// them with a sort instead of the O(dst->size * src->size) per-entry
+// deduplication.
+#define UVM_TRACKER_SORTED_MERGE_THRESHOLD 8
+
+static int tracker_entry_cmp_sort(const void *_a, const void *_b)
+{
+    const uvm_tracker_entry_t *a = (const uvm_tracker_entry_t *)_a;
+    const uvm_tracker_entry_t *b = (const uvm_tracker_entry_t *)_b;
+
+    if (a->channel != b->channel)
+        return a->channel < b->channel ? -1 : 1;
+
+    // Sort higher values first so that the collapse pass in
+    // tracker_add_tracker_sorted() keeps the first entry seen for each channel
+    if (a->value != b->value)
+        return a->value > b->value ? -1 : 1;
+
+    return 0;
+}
+
+// O((n + m) * log(n + m)) merge for large trackers: append all src entries to
+// dst, sort the combined array by channel, then collapse duplicated channels
+// in a single pass. The caller must have reserved space in dst for all src
+// entries.
+static void tracker_add_tracker_sorted(uvm_tracker_t *dst, uvm_tracker_t *src)
+{
+    uvm_tracker_entry_t *entries = uvm_tracker_get_entries(dst);
+    NvU32 out_index = 0;
+    NvU32 i;
+
+    UVM_ASSERT(dst->size + src->size <= dst->max_size);
+
+    memcpy(entries + dst->size, uvm_tracker_get_entries(src), src->size * sizeof(*entries));
+    dst->size += src->size;
+
+    sort(entries, dst->size, sizeof(*entries), tracker_entry_cmp_sort, NULL);
+
+    for (i = 1; i < dst->size; i++) {
+        if (entries[i].channel == entries[out_index].channel)
+            continue;
+
+        ++out_index;
+        if (out_index != i)
+            entries[out_index] = entries[i];
+    }
+
+    dst->size = out_index + 1;
+}
+
 static NV_STATUS reserve_for_entries_from_tracker(uvm_tracker_t *dst, uvm_tracker_t *src)
 {
     NvU32 needed_free_entries = 0;
@@ -221,6 +273,14 @@ NV_STATUS uvm_tracker_add_tracker(uvm_tracker_t *dst, uvm_tracker_t *src)
     if (status != NV_OK)
         return status;
 
+    // The per-entry adds below deduplicate with a linear scan each, which is
+    // quadratic when both trackers are large. Merge those with a sort instead.
+    if (min(dst->size, src->size) >= UVM_TRACKER_SORTED_MERGE_THRESHOLD &&
+        dst->size + src->size <= dst->max_size) {
+        tracker_add_tracker_sorted(dst, src);
+        return NV_OK;
+    }
+
     for_each_tracker_entry(src_entry, src) {
         status = uvm_tracker_add_entry(dst, src_entry);
         UVM_ASSERT_MSG(status == NV_OK, "Expected success with reserved memory but got error %d\n", status);
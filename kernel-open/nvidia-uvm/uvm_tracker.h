@@ -41,15 +41,19 @@ typedef struct
     NvU64 value;
 } uvm_tracker_entry_t;
 
+// Number of entries stored inline in the tracker. Trackers with one or two
+// entries dominate, so storing two inline avoids the dynamic allocation on
+// the common paths while keeping the tracker small enough to embed freely.
+#define UVM_TRACKER_NUM_STATIC_ENTRIES 2
+
 typedef struct
 {
     union
     {
-        // The default static storage can fit a single entry as that's likely
-        // the most common use-case. If the tracker ever needs more space, a
-        // dynamic allocation will be made as part of adding an entry and
-        // dynamic_entries below will be used.
-        uvm_tracker_entry_t static_entries[1];
+        // The default static storage fits the most common use-cases. If the
+        // tracker ever needs more space, a dynamic allocation will be made as
+        // part of adding an entry and dynamic_entries below will be used.
+        uvm_tracker_entry_t static_entries[UVM_TRACKER_NUM_STATIC_ENTRIES];
 
         // Pointer to the array with dynamically allocated entries
         uvm_tracker_entry_t *dynamic_entries;
@@ -999,6 +999,7 @@ void uvm_va_block_context_init(uvm_va_block_context_t *va_block_context, struct
 
     va_block_context->mm = mm;
     va_block_context->make_resident.dest_nid = NUMA_NO_NODE;
+    va_block_context->make_resident.copy_stripe = -1;
     nodes_clear(va_block_context->make_resident.cpu_pages_used.nodes);
 }
 
@@ -3471,6 +3472,7 @@ typedef struct
 // Begin a push appropriate for copying data from src_id processor to dst_id processor.
 // One of src_id and dst_id needs to be a GPU.
 static NV_STATUS block_copy_begin_push(uvm_va_block_t *va_block,
+                                       uvm_va_block_context_t *block_context,
                                        block_copy_state_t *copy_state,
                                        uvm_tracker_t *tracker,
                                        uvm_push_t *push)
@@ -3571,15 +3573,32 @@ static NV_STATUS block_copy_begin_push(uvm_va_block_t *va_block,
         tracker_ptr = &local_tracker;
     }
 
-    status = uvm_push_begin_acquire(gpu->channel_manager,
-                                    channel_type,
-                                    tracker_ptr,
-                                    push,
-                                    "Copy from %s to %s for block [0x%llx, 0x%llx]",
-                                    block_processor_name(va_block, src_id),
-                                    block_processor_name(va_block, dst_id),
-                                    va_block->start,
-                                    va_block->end);
+    // A non-negative stripe hint spreads the copies of a multi-block migration
+    // over all CE channel pools, so independent blocks can be transferred by
+    // different CEs concurrently.
+    if (block_context->make_resident.copy_stripe >= 0) {
+        status = uvm_push_begin_acquire_stripe(gpu->channel_manager,
+                                               channel_type,
+                                               (NvU32)block_context->make_resident.copy_stripe,
+                                               tracker_ptr,
+                                               push,
+                                               "Copy from %s to %s for block [0x%llx, 0x%llx]",
+                                               block_processor_name(va_block, src_id),
+                                               block_processor_name(va_block, dst_id),
+                                               va_block->start,
+                                               va_block->end);
+    }
+    else {
+        status = uvm_push_begin_acquire(gpu->channel_manager,
+                                        channel_type,
+                                        tracker_ptr,
+                                        push,
+                                        "Copy from %s to %s for block [0x%llx, 0x%llx]",
+                                        block_processor_name(va_block, src_id),
+                                        block_processor_name(va_block, dst_id),
+                                        va_block->start,
+                                        va_block->end);
+    }
 
 error:
     // Caller is responsible for freeing the DMA buffer on error
@@ -4115,6 +4134,7 @@ static NV_STATUS block_copy_resident_pages_between(uvm_va_block_t *block,
     uvm_va_space_t *va_space = uvm_va_block_get_va_space(block);
     uvm_va_block_region_t contig_region = {0};
     NvU64 cpu_migration_begin_timestamp = 0;
+    NvU64 copy_mask_summary;
 
     *copied_pages = 0;
 
@@ -4125,11 +4145,15 @@ static NV_STATUS block_copy_resident_pages_between(uvm_va_block_t *block,
         UVM_ASSERT(dst_nid != NUMA_NO_NODE);
 
     // If there are no pages to be copied, exit early
-    if (!uvm_page_mask_andnot(copy_mask, copy_mask, dst_resident_mask))
+    copy_mask_summary = uvm_page_mask_andnot_summary(copy_mask, copy_mask, dst_resident_mask);
+    if (!copy_mask_summary)
         return NV_OK;
 
-    if (migrated_pages && !uvm_page_mask_andnot(copy_mask, copy_mask, migrated_pages))
-        return NV_OK;
+    if (migrated_pages) {
+        copy_mask_summary = uvm_page_mask_andnot_summary(copy_mask, copy_mask, migrated_pages);
+        if (!copy_mask_summary)
+            return NV_OK;
+    }
 
     copy_state.src.id = src_id;
     copy_state.dst.id = dst_id;
@@ -4150,7 +4174,9 @@ static NV_STATUS block_copy_resident_pages_between(uvm_va_block_t *block,
     }
 
     // TODO: Bug 3745051: This function is complicated and needs refactoring
-    for_each_va_block_page_in_region_mask(page_index, copy_mask, region) {
+    // copy_mask is not modified until after this loop, so the summary computed
+    // above remains valid for the whole scan.
+    for_each_va_block_page_in_region_mask_summary(page_index, copy_mask, copy_mask_summary, region) {
         NvU64 page_start = uvm_va_block_cpu_page_address(block, page_index);
         uvm_make_resident_cause_t page_cause = (may_prefetch && uvm_page_mask_test(prefetch_page_mask, page_index)) ?
                                                 UVM_MAKE_RESIDENT_CAUSE_PREFETCH:
@@ -4207,7 +4233,7 @@ static NV_STATUS block_copy_resident_pages_between(uvm_va_block_t *block,
 
         if (block_copy_should_use_push(block, &copy_state)) {
             if (!copying_gpu) {
-                status = block_copy_begin_push(block, &copy_state, &block->tracker, &push);
+                status = block_copy_begin_push(block, block_context, &copy_state, &block->tracker, &push);
 
                 if (status != NV_OK)
                     break;
@@ -5043,6 +5069,10 @@ void uvm_va_block_make_resident_finish(uvm_va_block_t *va_block,
     if (uvm_processor_mask_test(&va_block->resident, dst_id))
         block_mark_memory_used(va_block, dst_id);
 
+    uvm_perf_prefetch_notify_make_resident(va_block,
+                                           dst_id,
+                                           &va_block_context->make_resident.pages_changed_residency);
+
     // Check state of all chunks after residency change.
     // TODO: Bug 4207783: Check both CPU and GPU chunks.
     UVM_ASSERT(block_check_cpu_chunks(va_block));
@@ -5263,6 +5293,10 @@ NV_STATUS uvm_va_block_make_resident_read_duplicate(uvm_va_block_t *va_block,
     if (uvm_processor_mask_test(&va_block->resident, dest_id))
         block_mark_memory_used(va_block, dest_id);
 
+    uvm_perf_prefetch_notify_make_resident(va_block,
+                                           dest_id,
+                                           &va_block_context->make_resident.pages_changed_residency);
+
     // Check state of all chunks after residency change.
     // TODO: Bug 4207783: Check both CPU and GPU chunks.
     UVM_ASSERT(block_check_cpu_chunks(va_block));
@@ -9143,6 +9177,7 @@ static void block_destroy_gpu_state(uvm_va_block_t *block, uvm_va_block_context_
         update_read_duplicated_pages_mask(block, id, gpu_state);
         uvm_page_mask_zero(&gpu_state->resident);
         block_clear_resident_processor(block, id);
+        uvm_perf_prefetch_invalidate_cache(block);
 
         num_chunks = block_num_gpu_chunks(block, gpu);
         for (i = 0; i < num_chunks; i++) {
@@ -10936,6 +10971,9 @@ NV_STATUS uvm_va_block_split_locked(uvm_va_block_t *existing_va_block,
     event_data.block_shrink.block = existing_va_block;
     uvm_perf_event_notify(&va_space->perf_events, UVM_PERF_EVENT_BLOCK_SHRINK, &event_data);
 
+    // The resident masks of both blocks are about to be recomputed.
+    uvm_perf_prefetch_invalidate_cache(existing_va_block);
+
     block_split_cpu(existing_va_block, new_block);
 
     for_each_gpu_id(id)
@@ -11261,9 +11299,9 @@ NV_STATUS uvm_va_block_add_mappings_after_migration(uvm_va_block_t *va_block,
     // We can't map non-migratable pages to the CPU. If we have any, build a
     // new mask of migratable pages and map the CPU separately.
     if (uvm_processor_mask_test(map_other_processors, UVM_ID_CPU) &&
-        !uvm_range_group_all_migratable(va_space,
-                                        uvm_va_block_region_start(va_block, region),
-                                        uvm_va_block_region_end(va_block, region))) {
+        !uvm_range_group_all_migratable_block(va_block,
+                                              uvm_va_block_region_start(va_block, region),
+                                              uvm_va_block_region_end(va_block, region))) {
         uvm_page_mask_t *migratable_mask = &va_block_context->mapping.migratable_mask;
 
         uvm_range_group_migratable_page_mask(va_block, region, migratable_mask);
@@ -12286,6 +12324,57 @@ NV_STATUS uvm_va_block_service_locked(uvm_processor_id_t processor_id,
                                    uvm_va_policy_get_region(va_block, service_context->region),
                                    service_context);
 
+    // When the batch migrates pages to multiple destinations, issue the copy
+    // steps for all of them before any of the finish steps. The copies to
+    // different destinations operate on disjoint pages and pipeline on the
+    // block tracker, so this avoids serializing each copy behind the previous
+    // destination's mapping updates. The finish steps consume the copy result
+    // masks in make_resident, which each copy step resets, so those are saved
+    // in per_processor_masks across the copy steps and restored before each
+    // finish step.
+    if (!uvm_va_block_is_hmm(va_block) &&
+        uvm_processor_mask_get_count(&service_context->resident_processors) > 1) {
+        uvm_page_mask_t *did_migrate_mask = &service_context->block_context->make_resident.pages_changed_residency;
+        uvm_page_mask_t *migrated_mask = &service_context->block_context->make_resident.pages_migrated;
+        uvm_page_mask_t *caller_page_mask = &service_context->block_context->caller_page_mask;
+
+        for_each_id_in_mask(new_residency, &service_context->resident_processors) {
+            status = uvm_va_block_service_copy(processor_id, new_residency, va_block, block_retry, service_context);
+            if (status != NV_OK)
+                return status;
+
+            uvm_page_mask_copy(&service_context->per_processor_masks[uvm_id_value(new_residency)].did_migrate,
+                               did_migrate_mask);
+            uvm_page_mask_copy(&service_context->per_processor_masks[uvm_id_value(new_residency)].migrated,
+                               migrated_mask);
+        }
+
+        for_each_id_in_mask(new_residency, &service_context->resident_processors) {
+            uvm_page_mask_t *new_residency_mask =
+                &service_context->per_processor_masks[uvm_id_value(new_residency)].new_residency;
+
+            // Restore the copy step results for this destination.
+            service_context->block_context->make_resident.dest_id = new_residency;
+            uvm_page_mask_copy(did_migrate_mask,
+                               &service_context->per_processor_masks[uvm_id_value(new_residency)].did_migrate);
+            uvm_page_mask_copy(migrated_mask,
+                               &service_context->per_processor_masks[uvm_id_value(new_residency)].migrated);
+
+            // Recompute the caller page mask the same way the copy step did:
+            // the pages of this destination that are not read-duplicated.
+            if (service_context->read_duplicate_count == 0)
+                uvm_page_mask_copy(caller_page_mask, new_residency_mask);
+            else
+                uvm_page_mask_andnot(caller_page_mask, new_residency_mask, &service_context->read_duplicate_mask);
+
+            status = uvm_va_block_service_finish(processor_id, va_block, service_context);
+            if (status != NV_OK)
+                return status;
+        }
+
+        return NV_OK;
+    }
+
     for_each_id_in_mask(new_residency, &service_context->resident_processors) {
         if (uvm_va_block_is_hmm(va_block)) {
             status = uvm_hmm_va_block_service_locked(processor_id,
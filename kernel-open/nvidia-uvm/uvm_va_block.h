@@ -340,6 +340,13 @@ struct uvm_va_block_struct
     // within this block (all evicted entries are 0).
     uvm_processor_mask_t evicted_gpus;
 
+    // Value of the VA space's range_group_change_seq counter at which the
+    // whole block was last observed to be fully migratable, or 0 if that has
+    // never been observed. Only written with the block lock held. Allows
+    // uvm_range_group_all_migratable_block() to answer the common
+    // everything-migratable case without walking the range group range tree.
+    NvU64 range_group_migratable_seq;
+
     struct
     {
         // Per-NUMA node tracking of CPU allocations.
@@ -480,6 +487,16 @@ struct uvm_va_block_struct
         uvm_processor_id_t last_migration_proc_id;
 
         NvU16 fault_migrations_to_last_proc;
+
+        // Cached copy of the resident mask of last_migration_proc_id, used to
+        // seed the prefetch bitmap tree without rebuilding it from the
+        // residency state on every fault batch. Patched incrementally by
+        // uvm_perf_prefetch_notify_make_resident() and rebuilt from the
+        // resident mask when residency_cache_valid is false. Only used for
+        // non-HMM blocks.
+        uvm_page_mask_t residency_cache;
+
+        bool residency_cache_valid;
     } prefetch_info;
 
     struct
@@ -1887,6 +1904,45 @@ static bool uvm_page_mask_intersects(const uvm_page_mask_t *mask1, const uvm_pag
     return bitmap_intersects(mask1->bitmap, mask2->bitmap, PAGES_PER_UVM_VA_BLOCK);
 }
 
+// Two-level view of a page mask: a single word with one bit per page mask
+// word, set if the corresponding group of BITS_PER_LONG pages has any page
+// set. Iterators can consult the summary to jump over empty groups without
+// re-reading the mask, which helps on sparse masks - the common case when a
+// 2MB block is operating on a handful of 4KB pages. The summary is only valid
+// as long as the mask is not modified.
+static NvU64 uvm_page_mask_summary(const uvm_page_mask_t *mask)
+{
+    NvU64 summary = 0;
+    size_t i;
+
+    BUILD_BUG_ON(BITS_TO_LONGS(PAGES_PER_UVM_VA_BLOCK) > 64);
+
+    for (i = 0; i < BITS_TO_LONGS(PAGES_PER_UVM_VA_BLOCK); i++) {
+        if (mask->bitmap[i])
+            summary |= 1ULL << i;
+    }
+
+    return summary;
+}
+
+// Same as uvm_page_mask_andnot(), but computes the summary of the resulting
+// mask in the same word-wise pass. Returns 0 iff the resulting mask is empty.
+static NvU64 uvm_page_mask_andnot_summary(uvm_page_mask_t *mask_out,
+                                          const uvm_page_mask_t *mask_in1,
+                                          const uvm_page_mask_t *mask_in2)
+{
+    NvU64 summary = 0;
+    size_t i;
+
+    for (i = 0; i < BITS_TO_LONGS(PAGES_PER_UVM_VA_BLOCK); i++) {
+        mask_out->bitmap[i] = mask_in1->bitmap[i] & ~mask_in2->bitmap[i];
+        if (mask_out->bitmap[i])
+            summary |= 1ULL << i;
+    }
+
+    return summary;
+}
+
 // Print the given page mask on the given buffer using hex symbols. The
 // minimum required size of the buffer is UVM_PAGE_MASK_PRINT_MIN_BUFFER_SIZE.
 static void uvm_page_mask_print(const uvm_page_mask_t *mask, char *buffer)
@@ -1979,6 +2035,52 @@ static uvm_page_index_t uvm_va_block_next_page_in_mask(uvm_va_block_region_t reg
     }
 }
 
+// Find the first set page at or after page_index, skipping empty
+// BITS_PER_LONG-page groups using the mask's summary word (see
+// uvm_page_mask_summary()).
+static uvm_page_index_t uvm_page_mask_find_next_bit_summary(const uvm_page_mask_t *page_mask,
+                                                            NvU64 summary,
+                                                            uvm_page_index_t page_index,
+                                                            uvm_page_index_t outer)
+{
+    size_t word_index;
+    NvU64 groups;
+
+    if (page_index >= outer)
+        return outer;
+
+    word_index = page_index / BITS_PER_LONG;
+    groups = summary & (~0ULL << word_index);
+    if (!groups)
+        return outer;
+
+    // Jump directly to the start of the next non-empty group
+    if (!(groups & (1ULL << word_index)))
+        page_index = (uvm_page_index_t)(__ffs(groups) * BITS_PER_LONG);
+
+    return find_next_bit(page_mask->bitmap, outer, page_index);
+}
+
+// Summary-accelerated variants of uvm_va_block_first/next_page_in_mask. The
+// caller computes the summary once for a mask that is scanned but not modified
+// during the iteration.
+static uvm_page_index_t uvm_va_block_first_page_in_mask_summary(uvm_va_block_region_t region,
+                                                                const uvm_page_mask_t *page_mask,
+                                                                NvU64 summary)
+{
+    return uvm_page_mask_find_next_bit_summary(page_mask, summary, region.first, region.outer);
+}
+
+static uvm_page_index_t uvm_va_block_next_page_in_mask_summary(uvm_va_block_region_t region,
+                                                               const uvm_page_mask_t *page_mask,
+                                                               NvU64 summary,
+                                                               uvm_page_index_t previous_page)
+{
+    UVM_ASSERT(previous_page < region.outer);
+
+    return uvm_page_mask_find_next_bit_summary(page_mask, summary, previous_page + 1, region.outer);
+}
+
 static uvm_page_index_t uvm_va_block_first_unset_page_in_mask(uvm_va_block_region_t region,
                                                               const uvm_page_mask_t *page_mask)
 {
@@ -2020,6 +2122,14 @@ static NvU64 uvm_reverse_map_end(const uvm_reverse_map_t *reverse_map)
          (page_index) != (region).outer;                                                     \
          (page_index) = uvm_va_block_next_page_in_mask((region), (page_mask), (page_index)))
 
+// Same as for_each_va_block_page_in_region_mask, but uses a precomputed
+// summary word (see uvm_page_mask_summary()) to skip empty BITS_PER_LONG-page
+// groups. The mask must not be modified during the iteration.
+#define for_each_va_block_page_in_region_mask_summary(page_index, page_mask, summary, region)               \
+    for ((page_index) = uvm_va_block_first_page_in_mask_summary((region), (page_mask), (summary));          \
+         (page_index) != (region).outer;                                                                    \
+         (page_index) = uvm_va_block_next_page_in_mask_summary((region), (page_mask), (summary), (page_index)))
+
 // Same as for_each_va_block_page_in_region_mask, but the region spans the
 // whole given VA block
 #define for_each_va_block_page_in_mask(page_index, page_mask, va_block)                      \
@@ -235,6 +235,12 @@ typedef struct
 
         // Event that triggered the call
         uvm_make_resident_cause_t cause;
+
+        // Stripe hint used to spread the copies of a multi-block migration
+        // over all CE channel pools. Negative values (the default) select the
+        // default pool for the channel type. Set by uvm_migrate() when
+        // migrating ranges large enough to benefit from multiple CEs.
+        NvS32 copy_stripe;
     } make_resident;
 
     // State used by the mapping APIs (unmap, map, revoke). This could be used
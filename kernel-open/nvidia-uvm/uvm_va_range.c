@@ -163,6 +163,7 @@ static uvm_va_range_t *uvm_va_range_alloc_managed(uvm_va_space_t *va_space, NvU6
 
     va_range->type = UVM_VA_RANGE_TYPE_MANAGED;
     va_range->managed.policy = uvm_va_policy_default;
+    va_range->managed.prefetch_threshold = 0;
 
     va_range->blocks = uvm_kvmalloc_zero(uvm_va_range_num_blocks(va_range) * sizeof(va_range->blocks[0]));
     if (!va_range->blocks) {
@@ -1180,6 +1181,7 @@ NV_STATUS uvm_va_range_split(uvm_va_range_t *existing_va_range,
     uvm_va_range_get_policy(new)->read_duplication = uvm_va_range_get_policy(existing_va_range)->read_duplication;
     uvm_va_range_get_policy(new)->preferred_location = uvm_va_range_get_policy(existing_va_range)->preferred_location;
     uvm_va_range_get_policy(new)->preferred_nid = uvm_va_range_get_policy(existing_va_range)->preferred_nid;
+    new->managed.prefetch_threshold = existing_va_range->managed.prefetch_threshold;
     uvm_processor_mask_copy(&uvm_va_range_get_policy(new)->accessed_by,
                             &uvm_va_range_get_policy(existing_va_range)->accessed_by);
     uvm_processor_mask_copy(&new->uvm_lite_gpus, &existing_va_range->uvm_lite_gpus);
@@ -1218,6 +1220,15 @@ uvm_va_range_t *uvm_va_space_iter_first(uvm_va_space_t *va_space, NvU64 start, N
     return uvm_va_range_container(node);
 }
 
+uvm_va_range_t *uvm_va_space_iter_first_hint(uvm_va_space_t *va_space,
+                                             NvU64 start,
+                                             NvU64 end,
+                                             uvm_range_tree_node_t **hint_inout)
+{
+    uvm_range_tree_node_t *node = uvm_range_tree_iter_first_hint(&va_space->va_range_tree, start, end, hint_inout);
+    return uvm_va_range_container(node);
+}
+
 uvm_va_range_t *uvm_va_space_iter_next(uvm_va_range_t *va_range, NvU64 end)
 {
     uvm_range_tree_node_t *node;
@@ -145,6 +145,11 @@ typedef struct
     // stored in the va_block for HMM allocations.
     uvm_va_policy_t policy;
 
+    // Per-range override of the uvm_perf_prefetch_threshold module parameter:
+    // percentage (1-100) of resident pages in a subregion required to trigger
+    // prefetching of the rest of the subregion. 0 uses the module parameter.
+    NvU32 prefetch_threshold;
+
     uvm_perf_module_data_desc_t perf_modules_data[UVM_PERF_MODULE_TYPE_COUNT];
 } uvm_va_range_managed_t;
 
@@ -576,6 +581,15 @@ static uvm_ext_gpu_map_t *uvm_ext_gpu_map_container(uvm_range_tree_node_t *node)
 // Returns the first va_range in the range [start, end], if any
 uvm_va_range_t *uvm_va_space_iter_first(uvm_va_space_t *va_space, NvU64 start, NvU64 end);
 
+// Like uvm_va_space_iter_first, but takes a caller-owned lookup hint to speed
+// up batches of address-sorted lookups. See uvm_range_tree_iter_first_hint
+// for the hint rules; in particular, the hint must be reset to NULL whenever
+// the VA space lock is dropped.
+uvm_va_range_t *uvm_va_space_iter_first_hint(uvm_va_space_t *va_space,
+                                             NvU64 start,
+                                             NvU64 end,
+                                             uvm_range_tree_node_t **hint_inout);
+
 // Returns the va_range following the provided va_range in address order, if
 // that va_range's start <= the provided end.
 uvm_va_range_t *uvm_va_space_iter_next(uvm_va_range_t *va_range, NvU64 end);
@@ -201,6 +201,12 @@ struct uvm_va_space_struct
     struct radix_tree_root range_groups;
     uvm_range_tree_t range_group_ranges;
 
+    // Counter bumped on every change to range group ranges or their
+    // migratability. Used to invalidate the per-block migratability summary
+    // cached in uvm_va_block_t. Initialized to 1 so a zero-initialized block
+    // cache never matches.
+    atomic64_t range_group_change_seq;
+
     // Peer to peer table
     // A bitmask of peer to peer pairs enabled in this va_space
     // indexed by a peer_table_index returned by uvm_gpu_peer_table_index().
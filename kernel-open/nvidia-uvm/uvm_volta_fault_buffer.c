@@ -381,6 +381,70 @@ NV_STATUS uvm_hal_volta_fault_buffer_parse_replayable_entry(uvm_parent_gpu_t *pa
     return NV_OK;
 }
 
+// Number of fault packets staged per pass in the batched parse path. 8
+// packets (256 bytes) keep the staging buffer within a few cachelines of
+// stack while still amortizing the sequential read of the buffer memory.
+#define FAULT_PARSE_STAGE_COUNT 8
+
+NV_STATUS uvm_hal_volta_fault_buffer_parse_replayable_entries(uvm_parent_gpu_t *parent_gpu,
+                                                              NvU32 index,
+                                                              NvU32 count,
+                                                              uvm_fault_buffer_entry_t *buffer_entries)
+{
+    fault_buffer_entry_c369_t stage[FAULT_PARSE_STAGE_COUNT];
+    NvU32 parsed = 0;
+    NvU32 i;
+
+    UVM_ASSERT(count > 0);
+
+    // The caller is responsible for splitting runs at the buffer wrap-around
+    UVM_ASSERT(index + count <= parent_gpu->fault_buffer_info.replayable.max_faults);
+
+    // Valid bits must be set before this function is called
+    for (i = 0; i < count; ++i)
+        UVM_ASSERT(parent_gpu->fault_buffer_hal->entry_is_valid(parent_gpu, index + i));
+
+    // When Confidential Computing is enabled each packet needs to be
+    // decrypted, which already stages it into CPU memory. Defer to the
+    // per-entry parse, which keeps the decryption IVs in sync.
+    if (g_uvm_global.conf_computing_enabled) {
+        for (i = 0; i < count; ++i) {
+            NV_STATUS status = uvm_hal_volta_fault_buffer_parse_replayable_entry(parent_gpu,
+                                                                                 index + i,
+                                                                                 &buffer_entries[i]);
+            if (status != NV_OK)
+                return status;
+        }
+
+        return NV_OK;
+    }
+
+    while (parsed < count) {
+        NvU32 stage_count = min(count - parsed, (NvU32)FAULT_PARSE_STAGE_COUNT);
+
+        // Stage the run of packets with a single word-wise sequential pass
+        // over the buffer memory, then decode the fields from the staged
+        // (cacheable) copy. This avoids issuing tens of scattered reads to
+        // the coherent buffer memory per packet during field extraction.
+        memcpy(stage, get_fault_buffer_entry(parent_gpu, index + parsed), stage_count * sizeof(stage[0]));
+
+        for (i = 0; i < stage_count; ++i) {
+            parse_fault_entry_common(parent_gpu, (NvU32 *)&stage[i], &buffer_entries[parsed + i]);
+
+            UVM_ASSERT(buffer_entries[parsed + i].is_replayable);
+        }
+
+        parsed += stage_count;
+    }
+
+    // Clear the valid bits in a single pass once the whole run has been
+    // staged
+    for (i = 0; i < count; ++i)
+        parent_gpu->fault_buffer_hal->entry_clear_valid(parent_gpu, index + i);
+
+    return NV_OK;
+}
+
 void uvm_hal_volta_fault_buffer_parse_non_replayable_entry(uvm_parent_gpu_t *parent_gpu,
                                                            void *fault_packet,
                                                            uvm_fault_buffer_entry_t *buffer_entry)
@@ -27,6 +27,7 @@
 #ifdef USE_LKCA
 #define BUFFER_SIZE (2 * 1024 * 1024)
 #define AUTH_TAG_SIZE 16
+#define MAX_KEY_SIZE 32
 struct lkca_aead_ctx
 {
     struct crypto_aead *aead;
@@ -35,6 +36,14 @@ struct lkca_aead_ctx
     char *in_buffer;
     char *out_buffer;
     char tag[AUTH_TAG_SIZE];
+    //
+    // Key most recently programmed into the transform. Session keys are
+    // reused across many calls, and crypto_aead_setkey() reruns the full AES
+    // key schedule (and GHASH subkey derivation), so skip it when the caller
+    // passes the same key again.
+    //
+    char last_key[MAX_KEY_SIZE];
+    size_t last_key_size;
 };
 #endif
 
@@ -108,6 +117,7 @@ void libspdm_aead_free(void *context)
     kfree(ctx->a_data_buffer);
     kfree(ctx->in_buffer);
     kfree(ctx->out_buffer);
+    memzero_explicit(ctx->last_key, sizeof(ctx->last_key));
     kfree(ctx);
 #endif
 }
@@ -119,10 +129,21 @@ void libspdm_aead_free(void *context)
 #define SG_AEAD_LEN 3
 
 #ifdef USE_LKCA
+// Programs the key into the transform, rerunning the key schedule
+static int lkca_aead_setkey(struct crypto_aead *aead,
+                            const uint8_t *key, size_t key_size)
+{
+    if (crypto_aead_setkey(aead, key, key_size)) {
+        pr_info("key could not be set\n");
+        return -EINVAL;
+    }
+
+    return 0;
+}
+
 // This function doesn't do any allocs, it uses temp buffers instead
 static int lkca_aead_internal(struct crypto_aead *aead,
                               struct aead_request *req,
-                              const uint8_t *key, size_t key_size,
                               const uint8_t *iv, size_t iv_size,
                               struct scatterlist sg_in[],
                               struct scatterlist sg_out[],
@@ -135,11 +156,6 @@ static int lkca_aead_internal(struct crypto_aead *aead,
     DECLARE_CRYPTO_WAIT(wait);
     int rc = 0;
 
-    if (crypto_aead_setkey(aead, key, key_size)) {
-        pr_info("key could not be set\n");
-        return -EINVAL;
-    }
-
     if (crypto_aead_ivsize(aead) != iv_size) {
         pr_info("iv could not be set\n");
         return -EINVAL;
@@ -192,6 +208,24 @@ int libspdm_aead_prealloced(void *context,
     struct scatterlist sg_out[SG_AEAD_LEN];
     struct lkca_aead_ctx *ctx = context;
 
+    //
+    // Only rerun the key schedule when the key actually changes; session
+    // traffic reuses the same key for many consecutive calls.
+    //
+    if ((ctx->last_key_size != key_size) ||
+        (memcmp(ctx->last_key, key, key_size) != 0)) {
+        if (key_size > MAX_KEY_SIZE) {
+            return -EINVAL;
+        }
+
+        rc = lkca_aead_setkey(ctx->aead, key, key_size);
+        if (rc != 0) {
+            return rc;
+        }
+
+        memcpy(ctx->last_key, key, key_size);
+        ctx->last_key_size = key_size;
+    }
 
     sg_init_table(sg_in, SG_AEAD_LEN);
     sg_init_table(sg_out, SG_AEAD_LEN);
@@ -238,7 +272,7 @@ int libspdm_aead_prealloced(void *context,
     if(!enc)
         memcpy(ctx->tag, tag, tag_size);
 
-    rc = lkca_aead_internal(ctx->aead, ctx->req, key, key_size, iv, iv_size,
+    rc = lkca_aead_internal(ctx->aead, ctx->req, iv, iv_size,
                             sg_in, sg_out, a_data_size, data_in_size,
                             data_out_size, tag_size, enc);
 
@@ -350,7 +384,12 @@ int libspdm_aead(const uint8_t *key, size_t key_size,
         sg_set_buf(&sg_out[SG_AEAD_SIG], tag, tag_size);
     }
 
-    rc = lkca_aead_internal(aead, req, key, key_size, iv, iv_size,
+    rc = lkca_aead_setkey(aead, key, key_size);
+    if (rc != 0) {
+        goto out;
+    }
+
+    rc = lkca_aead_internal(aead, req, iv, iv_size,
                             sg_in, sg_out, a_data_size, data_in_size,
                             data_out_size, tag_size, enc);
 
@@ -365,9 +404,9 @@ out:
         kfree(a_data_shadow);
     if (data_in_shadow != NULL)
         kfree(data_in_shadow);
-    if (data_out != NULL)
+    if (data_out_shadow != NULL)
        kfree(data_out_shadow);
-    if (tag != NULL)
+    if (tag_shadow != NULL)
         kfree(tag_shadow);
     if (aead != NULL)
         crypto_free_aead(aead);
@@ -165,6 +165,12 @@ MODULE_PARM_DESC(NvSwitchBlacklist, "NvSwitchBlacklist=uuid[,uuid...]");
 //   are going on and without successful .open one can't execute any file ops.
 //   This behavior guarantees correctness of the locking model.
 //
+//   nvswitch_dev.fabric_state_lock is a seqlock publishing a snapshot of
+//   the device fabric state for monitoring queries. Writers hold the
+//   device_mutex; readers (nvswitch-ctl GET_DEVICES_V2) retry instead of
+//   blocking, so status polling never contends with link management
+//   operations holding the device_mutex.
+//
 //   If .close is invoked and holding the lock which is also used by threaded
 //   tasks such as interrupt, driver will deadlock while trying to stop such
 //   tasks. For example, when threaded interrupts are enabled, free_irq() calls
@@ -277,6 +283,43 @@ nvswitch_is_device_blacklisted
     return device_fabric_state == NVSWITCH_DEVICE_FABRIC_STATE_BLACKLISTED;
 }
 
+//
+// Refresh the seqlock-published fabric state snapshot consumed by
+// nvswitch_ctl_get_devices_v2().  Must be called with device_mutex held
+// (or before the device is visible to other threads) so the library
+// reads are atomic with respect to other library calls.
+//
+static void
+nvswitch_publish_fabric_state
+(
+    NVSWITCH_DEV *nvswitch_dev
+)
+{
+    NVSWITCH_DEVICE_FABRIC_STATE device_fabric_state = 0;
+    NVSWITCH_DEVICE_BLACKLIST_REASON device_blacklist_reason = 0;
+    NVSWITCH_DRIVER_FABRIC_STATE driver_fabric_state = 0;
+    NvBool tnvl_enabled;
+
+    if (nvswitch_dev->lib_device == NULL)
+    {
+        return;
+    }
+
+    (void)nvswitch_lib_read_fabric_state(nvswitch_dev->lib_device,
+                                         &device_fabric_state,
+                                         &device_blacklist_reason,
+                                         &driver_fabric_state);
+
+    tnvl_enabled = nvswitch_lib_is_tnvl_enabled(nvswitch_dev->lib_device);
+
+    write_seqlock(&nvswitch_dev->fabric_state_lock);
+    nvswitch_dev->device_fabric_state = device_fabric_state;
+    nvswitch_dev->device_blacklist_reason = device_blacklist_reason;
+    nvswitch_dev->driver_fabric_state = driver_fabric_state;
+    nvswitch_dev->tnvl_enabled = tnvl_enabled;
+    write_sequnlock(&nvswitch_dev->fabric_state_lock);
+}
+
 static void
 nvswitch_deinit_background_tasks
 (
@@ -904,6 +947,9 @@ nvswitch_device_ioctl
 
     nvswitch_ioctl_state_cleanup(&state);
 
+    // The control may have changed the fabric state; republish the snapshot.
+    nvswitch_publish_fabric_state(nvswitch_dev);
+
 nvswitch_device_ioctl_exit:
     mutex_unlock(&nvswitch_dev->device_mutex);
 
@@ -995,14 +1041,21 @@ nvswitch_ctl_get_devices_v2(NVSWITCH_GET_DEVICES_V2_PARAMS *p)
 
         if (nvswitch_dev->lib_device != NULL)
         {
-            mutex_lock(&nvswitch_dev->device_mutex);
-            (void)nvswitch_lib_read_fabric_state(nvswitch_dev->lib_device,
-                                                 &p->info[index].deviceState,
-                                                 &p->info[index].deviceReason,
-                                                 &p->info[index].driverState);
-
-            p->info[index].bTnvlEnabled = nvswitch_lib_is_tnvl_enabled(nvswitch_dev->lib_device);
-            mutex_unlock(&nvswitch_dev->device_mutex);
+            unsigned seq;
+
+            //
+            // Read the seqlock-published snapshot so fabric manager status
+            // polling never blocks behind link management operations that
+            // hold device_mutex.
+            //
+            do
+            {
+                seq = read_seqbegin(&nvswitch_dev->fabric_state_lock);
+                p->info[index].deviceState = nvswitch_dev->device_fabric_state;
+                p->info[index].deviceReason = nvswitch_dev->device_blacklist_reason;
+                p->info[index].driverState = nvswitch_dev->driver_fabric_state;
+                p->info[index].bTnvlEnabled = nvswitch_dev->tnvl_enabled;
+            } while (read_seqretry(&nvswitch_dev->fabric_state_lock, seq));
         }
         index++;
     }
@@ -1219,6 +1272,10 @@ nvswitch_task_dispatch
 
     nsec = nvswitch_lib_deferred_task_dispatcher(nvswitch_dev->lib_device);
 
+    // Keep the monitoring snapshot current with library-internal updates
+    // such as fabric manager heartbeat timeouts.
+    nvswitch_publish_fabric_state(nvswitch_dev);
+
     mutex_unlock(&nvswitch_dev->device_mutex);
 
     timeout = usecs_to_jiffies(nsec / NSEC_PER_USEC);
@@ -1295,6 +1352,7 @@ nvswitch_probe
     }
 
     mutex_init(&nvswitch_dev->device_mutex);
+    seqlock_init(&nvswitch_dev->fabric_state_lock);
     init_waitqueue_head(&nvswitch_dev->wait_q_errors);
     init_waitqueue_head(&nvswitch_dev->wait_q_shutdown);
 
@@ -1367,6 +1425,9 @@ nvswitch_probe
     }
 
 blacklisted:
+    // Device is not visible to other threads yet, so no device_mutex here.
+    nvswitch_publish_fabric_state(nvswitch_dev);
+
     rc = nvswitch_init_background_tasks(nvswitch_dev);
     if (rc)
     {
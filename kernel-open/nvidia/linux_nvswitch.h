@@ -29,6 +29,8 @@
 #include "nv-kthread-q.h"
 #include "export_nvswitch.h"
 
+#include <linux/seqlock.h>
+
 #define NVSWITCH_SHORT_NAME "nvswi"
 
 #define NVSWITCH_IRQ_NONE 0
@@ -80,6 +82,17 @@ typedef struct
 #endif
     NvU8 irq_mechanism;
     struct list_head i2c_adapter_list;
+
+    /*
+     * Monitoring snapshot of the fabric state, published with a seqlock
+     * so status queries never block behind device_mutex.  Writers hold
+     * device_mutex; readers retry instead of sleeping.
+     */
+    seqlock_t fabric_state_lock;
+    NVSWITCH_DEVICE_FABRIC_STATE device_fabric_state;
+    NVSWITCH_DEVICE_BLACKLIST_REASON device_blacklist_reason;
+    NVSWITCH_DRIVER_FABRIC_STATE driver_fabric_state;
+    NvBool tnvl_enabled;
 } NVSWITCH_DEV;
 
 
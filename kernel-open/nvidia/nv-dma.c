@@ -26,6 +26,7 @@
 #include "os-interface.h"
 #include "nv-linux.h"
 #include "nv-reg.h"
+#include "nv-proto.h"
 
 #define NV_DMA_DEV_PRINTF(debuglevel, dma_dev, format, ... )                \
     nv_printf(debuglevel, "NVRM: %s: " format,                              \
@@ -132,6 +133,184 @@ static void nv_fill_scatterlist
 #endif
 }
 
+/*
+ * Cache of scatterlist metadata retained across DMA unmap/map cycles.
+ *
+ * With an IOMMU enabled, allocation churn rebuilds the same submap arrays and
+ * scatter-gather tables over and over, once per IOVA allocation. The IOVA
+ * ranges themselves cannot be retained at this layer - their lifetime is tied
+ * to the mapping, and keeping mappings to freed pages alive is unsafe with
+ * bounce buffering - but the kernel's per-CPU IOVA caches already recycle
+ * windows as long as the request sizes repeat. Retaining the metadata for
+ * repeated mapping geometries removes the driver-side share of the cost and
+ * keeps those request sizes stable.
+ *
+ * Cached descriptors are unmapped and device-independent: the page pointers
+ * and DMA addresses they hold are stale, and are rewritten before the next
+ * dma_map_sg() call. Only fully expanded tables (one page per sg entry) are
+ * eligible, since tables built by sg_alloc_table_from_pages() have a
+ * page-set-dependent layout.
+ */
+
+#define NV_DMA_MAP_CACHE_MAX_ENTRIES 16
+
+typedef struct nv_dma_map_cache_entry_s
+{
+    struct list_head list;
+    NvU64 page_count;
+    NvU32 submap_count;
+    nv_dma_submap_t *submaps;
+} nv_dma_map_cache_entry_t;
+
+static nv_spinlock_t nv_dma_map_cache_lock;
+static struct list_head nv_dma_map_cache_list;
+static NvU32 nv_dma_map_cache_count;
+
+void nv_dma_map_cache_init(void)
+{
+    NV_SPIN_LOCK_INIT(&nv_dma_map_cache_lock);
+    INIT_LIST_HEAD(&nv_dma_map_cache_list);
+    nv_dma_map_cache_count = 0;
+}
+
+static void nv_dma_map_cache_free_entry(nv_dma_map_cache_entry_t *entry)
+{
+    NvU32 i;
+
+    for (i = 0; i < entry->submap_count; i++)
+    {
+        sg_free_table(&entry->submaps[i].sgt);
+    }
+
+    os_free_mem(entry->submaps);
+    os_free_mem(entry);
+}
+
+void nv_dma_map_cache_purge(void)
+{
+    nv_dma_map_cache_entry_t *entry;
+    unsigned long flags;
+
+    for (;;)
+    {
+        NV_SPIN_LOCK_IRQSAVE(&nv_dma_map_cache_lock, flags);
+        entry = list_first_entry_or_null(&nv_dma_map_cache_list,
+                                         nv_dma_map_cache_entry_t, list);
+        if (entry != NULL)
+        {
+            list_del(&entry->list);
+            nv_dma_map_cache_count--;
+        }
+        NV_SPIN_UNLOCK_IRQRESTORE(&nv_dma_map_cache_lock, flags);
+
+        if (entry == NULL)
+        {
+            break;
+        }
+
+        nv_dma_map_cache_free_entry(entry);
+    }
+}
+
+/*
+ * Try to satisfy a discontiguous mapping's metadata from the cache. The
+ * cached tables carry stale page pointers, so refill them for the new page
+ * set before returning.
+ */
+static NvBool nv_dma_map_cache_acquire(nv_dma_map_t *dma_map)
+{
+    nv_dma_map_cache_entry_t *entry;
+    nv_dma_submap_t *submap;
+    unsigned long flags;
+    NvU64 i;
+    NvBool found = NV_FALSE;
+
+    NV_SPIN_LOCK_IRQSAVE(&nv_dma_map_cache_lock, flags);
+    list_for_each_entry(entry, &nv_dma_map_cache_list, list)
+    {
+        if (entry->page_count == dma_map->page_count)
+        {
+            list_del(&entry->list);
+            nv_dma_map_cache_count--;
+            found = NV_TRUE;
+            break;
+        }
+    }
+    NV_SPIN_UNLOCK_IRQRESTORE(&nv_dma_map_cache_lock, flags);
+
+    if (!found)
+    {
+        return NV_FALSE;
+    }
+
+    dma_map->mapping.discontig.submap_count = entry->submap_count;
+    dma_map->mapping.discontig.submaps = entry->submaps;
+
+    os_free_mem(entry);
+
+    NV_FOR_EACH_DMA_SUBMAP(dma_map, submap, i)
+    {
+        submap->sg_map_count = 0;
+        nv_fill_scatterlist(submap->sgt.sgl,
+            &dma_map->pages[NV_DMA_SUBMAP_IDX_TO_PAGE_IDX(i)],
+            submap->page_count);
+    }
+
+    return NV_TRUE;
+}
+
+/*
+ * Park a discontiguous mapping's metadata in the cache for reuse, or fall
+ * back to freeing it. Imported tables are owned by the exporter, and merged
+ * tables (fewer sg entries than pages) cannot be refilled for a different
+ * page set.
+ */
+static void nv_dma_map_cache_release(nv_dma_map_t *dma_map)
+{
+    nv_dma_map_cache_entry_t *entry = NULL;
+    nv_dma_submap_t *submap;
+    unsigned long flags;
+    NvU64 i;
+    NvBool cacheable = (nv_dma_map_cache_count < NV_DMA_MAP_CACHE_MAX_ENTRIES);
+
+    NV_FOR_EACH_DMA_SUBMAP(dma_map, submap, i)
+    {
+        if (submap->imported ||
+            (submap->page_count == 0) ||
+            (submap->sgt.orig_nents != submap->page_count))
+        {
+            cacheable = NV_FALSE;
+            break;
+        }
+    }
+
+    if (cacheable &&
+        (os_alloc_mem((void **)&entry, sizeof(*entry)) == NV_OK))
+    {
+        entry->page_count = dma_map->page_count;
+        entry->submap_count = dma_map->mapping.discontig.submap_count;
+        entry->submaps = dma_map->mapping.discontig.submaps;
+
+        NV_SPIN_LOCK_IRQSAVE(&nv_dma_map_cache_lock, flags);
+        if (nv_dma_map_cache_count < NV_DMA_MAP_CACHE_MAX_ENTRIES)
+        {
+            list_add(&entry->list, &nv_dma_map_cache_list);
+            nv_dma_map_cache_count++;
+            entry = NULL;
+        }
+        NV_SPIN_UNLOCK_IRQRESTORE(&nv_dma_map_cache_lock, flags);
+
+        if (entry == NULL)
+        {
+            return;
+        }
+
+        os_free_mem(entry);
+    }
+
+    nv_destroy_dma_map_scatterlist(dma_map);
+}
+
 NV_STATUS nv_create_dma_map_scatterlist(nv_dma_map_t *dma_map)
 {
     /*
@@ -163,6 +342,11 @@ NV_STATUS nv_create_dma_map_scatterlist(nv_dma_map_t *dma_map)
 
     dma_map->mapping.discontig.submap_count = NvU64_LO32(num_submaps);
 
+    if ((dma_map->import_sgt == NULL) && nv_dma_map_cache_acquire(dma_map))
+    {
+        return NV_OK;
+    }
+
     status = os_alloc_mem((void **)&dma_map->mapping.discontig.submaps,
         sizeof(nv_dma_submap_t) * dma_map->mapping.discontig.submap_count);
     if (status != NV_OK)
@@ -367,7 +551,7 @@ static NV_STATUS nv_dma_map_scatterlist(
 static void nv_dma_unmap_scatterlist(nv_dma_map_t *dma_map)
 {
     nv_unmap_dma_map_scatterlist(dma_map);
-    nv_destroy_dma_map_scatterlist(dma_map);
+    nv_dma_map_cache_release(dma_map);
 }
 
 static void nv_dma_nvlink_addr_compress
@@ -95,6 +95,21 @@ typedef struct nv_dma_buf_file_private
     NvBool                   static_phys_addrs;
 } nv_dma_buf_file_private_t;
 
+//
+// Per-attachment state used to cache the DMA mapping built for an importer.
+// The backing memory is pinned for the life of the dma-buf and mappings are
+// created bidirectional, so one table per attachment satisfies repeated
+// map_dma_buf calls in any direction until the importer detaches.
+//
+typedef struct nv_dma_buf_attachment_private
+{
+    // Mapping built on the first map_dma_buf call, freed at detach
+    struct sg_table         *sgt;
+
+    // Outstanding map_dma_buf calls against sgt
+    NvU32                    map_count;
+} nv_dma_buf_attachment_private_t;
+
 static void
 nv_dma_buf_free_file_private(
     nv_dma_buf_file_private_t *priv
@@ -768,6 +783,97 @@ free_sgt:
     return NULL;
 }
 
+#if defined(NV_DMA_BUF_OPS_ATTACH_HAS_DEVICE_ARG)
+static int
+nv_dma_buf_attach(
+    struct dma_buf *buf,
+    struct device *dev,
+    struct dma_buf_attachment *attachment
+)
+#else
+static int
+nv_dma_buf_attach(
+    struct dma_buf *buf,
+    struct dma_buf_attachment *attachment
+)
+#endif
+{
+    nv_dma_buf_attachment_private_t *ap = NULL;
+
+    NV_KZALLOC(ap, sizeof(nv_dma_buf_attachment_private_t));
+    if (ap == NULL)
+    {
+        return -ENOMEM;
+    }
+
+    attachment->priv = ap;
+
+    return 0;
+}
+
+//
+// Tear down a mapping built by nv_dma_buf_map().
+// priv->lock must be held by the caller.
+//
+static void
+nv_dma_buf_unmap_locked(
+    struct device *dev,
+    nv_dma_buf_file_private_t *priv,
+    struct sg_table *sgt
+)
+{
+    if (priv->nv->coherent)
+    {
+        nv_dma_buf_unmap_pages(dev, sgt);
+    }
+    else
+    {
+        nv_dma_buf_unmap_pfns(dev, sgt);
+    }
+
+    //
+    // For static_phys_addrs platforms, this operation is done in release
+    // since getting the phys_addrs was done in create/reuse.
+    //
+    if (!priv->static_phys_addrs)
+    {
+        nv_dma_buf_put_phys_addresses(priv, 0, priv->num_objects);
+    }
+
+    sg_free_table(sgt);
+
+    NV_KFREE(sgt, sizeof(struct sg_table));
+}
+
+static void
+nv_dma_buf_detach(
+    struct dma_buf *buf,
+    struct dma_buf_attachment *attachment
+)
+{
+    nv_dma_buf_file_private_t *priv = buf->priv;
+    nv_dma_buf_attachment_private_t *ap = attachment->priv;
+
+    if (ap == NULL)
+    {
+        return;
+    }
+
+    if (ap->sgt != NULL)
+    {
+        mutex_lock(&priv->lock);
+
+        WARN_ON(ap->map_count > 0);
+
+        nv_dma_buf_unmap_locked(attachment->dev, priv, ap->sgt);
+
+        mutex_unlock(&priv->lock);
+    }
+
+    NV_KFREE(ap, sizeof(nv_dma_buf_attachment_private_t));
+    attachment->priv = NULL;
+}
+
 static struct sg_table*
 nv_dma_buf_map(
     struct dma_buf_attachment *attachment,
@@ -778,6 +884,7 @@ nv_dma_buf_map(
     struct sg_table *sgt = NULL;
     struct dma_buf *buf = attachment->dmabuf;
     nv_dma_buf_file_private_t *priv = buf->priv;
+    nv_dma_buf_attachment_private_t *ap = attachment->priv;
 
     //
     // On non-coherent platforms, importers must be able to handle peer
@@ -797,6 +904,18 @@ nv_dma_buf_map(
 
     mutex_lock(&priv->lock);
 
+    //
+    // The backing memory is pinned and cannot move, so a mapping built once
+    // for this attachment remains valid until detach: reuse it instead of
+    // rebuilding and re-mapping the scatterlist on every call.
+    //
+    if ((ap != NULL) && (ap->sgt != NULL))
+    {
+        ap->map_count++;
+        mutex_unlock(&priv->lock);
+        return ap->sgt;
+    }
+
     if (priv->num_objects != priv->total_objects)
     {
         goto unlock_priv;
@@ -824,6 +943,12 @@ nv_dma_buf_map(
         goto unmap_handles;
     }
 
+    if (ap != NULL)
+    {
+        ap->sgt = sgt;
+        ap->map_count = 1;
+    }
+
     mutex_unlock(&priv->lock);
 
     return sgt;
@@ -849,30 +974,23 @@ nv_dma_buf_unmap(
 {
     struct dma_buf *buf = attachment->dmabuf;
     nv_dma_buf_file_private_t *priv = buf->priv;
+    nv_dma_buf_attachment_private_t *ap = attachment->priv;
 
     mutex_lock(&priv->lock);
 
-    if (priv->nv->coherent)
-    {
-        nv_dma_buf_unmap_pages(attachment->dev, sgt);
-    }
-    else
-    {
-        nv_dma_buf_unmap_pfns(attachment->dev, sgt);
-    }
-
     //
-    // For static_phys_addrs platforms, this operation is done in release
-    // since getting the phys_addrs was done in create/reuse.
+    // Cached mappings stay live until detach so that the next map_dma_buf
+    // call on this attachment can reuse them.
     //
-    if (!priv->static_phys_addrs)
+    if ((ap != NULL) && (ap->sgt == sgt))
     {
-        nv_dma_buf_put_phys_addresses(priv, 0, priv->num_objects);
+        WARN_ON(ap->map_count == 0);
+        ap->map_count--;
+        mutex_unlock(&priv->lock);
+        return;
     }
 
-    sg_free_table(sgt);
-
-    NV_KFREE(sgt, sizeof(struct sg_table));
+    nv_dma_buf_unmap_locked(attachment->dev, priv, sgt);
 
     mutex_unlock(&priv->lock);
 }
@@ -995,6 +1113,8 @@ nv_dma_buf_kunmap_atomic_stub(
 // f9b67f0014cb: dma-buf: Rename dma-ops to prevent conflict with kunmap_atomic
 //
 static const struct dma_buf_ops nv_dma_buf_ops = {
+    .attach        = nv_dma_buf_attach,
+    .detach        = nv_dma_buf_detach,
     .map_dma_buf   = nv_dma_buf_map,
     .unmap_dma_buf = nv_dma_buf_unmap,
     .release       = nv_dma_buf_release,
@@ -24,30 +24,170 @@
 #include "nv-memdbg.h"
 #include "nv-linux.h"
 
+#include <linux/hash.h>
+#include <linux/log2.h>
+
 /* track who's allocating memory and print out a list of leaked allocations at
  * teardown.
+ *
+ * The per-allocation tracking is sharded by allocation-address hash, with one
+ * rb-tree and one lock per shard, so that concurrent allocation-heavy paths
+ * (multi-GPU init, UVM stress) do not serialize on a single global lock.
+ *
+ * Independently of the full tracking, a small table of per-allocation-site
+ * counters is maintained with a few atomic operations per allocation. Those
+ * counters are cheap enough to stay enabled in builds where NV_MEM_LOGGER is
+ * off; see nv-memdbg.h.
  */
 
+#define NV_MEMDBG_SHARD_SHIFT 4
+#define NV_MEMDBG_NUM_SHARDS  (1 << NV_MEMDBG_SHARD_SHIFT)
+
+/* Slots in the per-site counter table. Sites that do not find a slot are
+ * accounted in a shared overflow counter. */
+#define NV_MEMDBG_MAX_SITES   128
+
+/* Probe length bound for the open-addressed site table */
+#define NV_MEMDBG_SITE_MAX_PROBES 8
+
+typedef struct {
+    /* file is the slot's claim flag: NULL means the slot is free. It is
+     * written with release semantics after line, so a reader that observes
+     * a non-NULL file can trust line. Valid slots never change again. */
+    const char *file;
+    int line;
+    atomic64_t num_allocs;
+    atomic64_t num_frees;
+    atomic64_t total_bytes;
+} nv_memdbg_site_t;
+
 typedef struct {
     struct rb_node rb_node;
     void *addr;
     NvU64 size;
     NvU32 line;
     const char *file;
+    nv_memdbg_site_t *site;
 } nv_memdbg_node_t;
 
-struct
-{
+typedef struct {
     struct rb_root rb_root;
     NvU64 untracked_bytes;
     NvU64 num_untracked_allocs;
     nv_spinlock_t lock;
+} nv_memdbg_shard_t;
+
+struct
+{
+    nv_memdbg_shard_t shards[NV_MEMDBG_NUM_SHARDS];
+
+    nv_memdbg_site_t sites[NV_MEMDBG_MAX_SITES];
+
+    /* Only taken when claiming a new site table slot, which happens at most
+     * NV_MEMDBG_MAX_SITES times over the life of the driver. Lookups of
+     * already-claimed slots are lock-free. */
+    nv_spinlock_t site_lock;
+
+    /* Allocations whose site did not fit in the table */
+    atomic64_t num_unattributed_allocs;
+
+    /* Global outstanding counters, maintained on all builds */
+    atomic64_t outstanding_allocs;
+    atomic64_t outstanding_bytes;
 } g_nv_memdbg;
 
 void nv_memdbg_init(void)
 {
-    NV_SPIN_LOCK_INIT(&g_nv_memdbg.lock);
-    g_nv_memdbg.rb_root = RB_ROOT;
+    NvU32 i;
+
+    for (i = 0; i < NV_MEMDBG_NUM_SHARDS; i++)
+    {
+        NV_SPIN_LOCK_INIT(&g_nv_memdbg.shards[i].lock);
+        g_nv_memdbg.shards[i].rb_root = RB_ROOT;
+    }
+
+    NV_SPIN_LOCK_INIT(&g_nv_memdbg.site_lock);
+}
+
+static nv_memdbg_shard_t *nv_memdbg_shard(void *addr)
+{
+    return &g_nv_memdbg.shards[hash_ptr(addr, NV_MEMDBG_SHARD_SHIFT)];
+}
+
+static nv_memdbg_site_t *nv_memdbg_site_get(const char *file, int line)
+{
+    NvU64 key = (NvU64)(NvUPtr)file + (NvU64)line;
+    NvU32 bucket = hash_64(key, ilog2(NV_MEMDBG_MAX_SITES));
+    unsigned long flags;
+    NvU32 i;
+
+    if (file == NULL)
+        return NULL;
+
+    for (i = 0; i < NV_MEMDBG_SITE_MAX_PROBES; i++)
+    {
+        nv_memdbg_site_t *site =
+            &g_nv_memdbg.sites[(bucket + i) % NV_MEMDBG_MAX_SITES];
+        const char *slot_file = smp_load_acquire(&site->file);
+
+        if (slot_file == file && site->line == line)
+            return site;
+
+        if (slot_file != NULL)
+            continue;
+
+        /* Empty slot: re-check and claim it under the lock */
+        NV_SPIN_LOCK_IRQSAVE(&g_nv_memdbg.site_lock, flags);
+
+        if (site->file == NULL)
+        {
+            site->line = line;
+            smp_store_release(&site->file, file);
+        }
+
+        NV_SPIN_UNLOCK_IRQRESTORE(&g_nv_memdbg.site_lock, flags);
+
+        if (site->file == file && site->line == line)
+            return site;
+
+        /* Another site won the slot; keep probing */
+    }
+
+    return NULL;
+}
+
+static nv_memdbg_site_t *nv_memdbg_site_account_alloc(NvU64 size,
+                                                      const char *file,
+                                                      int line)
+{
+    nv_memdbg_site_t *site = nv_memdbg_site_get(file, line);
+
+    if (site)
+    {
+        atomic64_inc(&site->num_allocs);
+        atomic64_add(size, &site->total_bytes);
+    }
+    else
+    {
+        atomic64_inc(&g_nv_memdbg.num_unattributed_allocs);
+    }
+
+    atomic64_inc(&g_nv_memdbg.outstanding_allocs);
+    atomic64_add(size, &g_nv_memdbg.outstanding_bytes);
+
+    return site;
+}
+
+/* Counter-only tracking, used when NV_MEM_LOGGER is off */
+void nv_memdbg_count_alloc(NvU64 size, const char *file, int line)
+{
+    nv_memdbg_site_account_alloc(size, file, line);
+}
+
+void nv_memdbg_count_free(NvU64 size)
+{
+    atomic64_dec(&g_nv_memdbg.outstanding_allocs);
+    atomic64_sub(size, &g_nv_memdbg.outstanding_bytes);
 }
 
 static nv_memdbg_node_t *nv_memdbg_node_entry(struct rb_node *rb_node)
@@ -55,10 +195,11 @@ static nv_memdbg_node_t *nv_memdbg_node_entry(struct rb_node *rb_node)
     return rb_entry(rb_node, nv_memdbg_node_t, rb_node);
 }
 
-static void nv_memdbg_insert_node(nv_memdbg_node_t *new)
+static void nv_memdbg_insert_node(nv_memdbg_shard_t *shard,
+                                  nv_memdbg_node_t *new)
 {
     nv_memdbg_node_t *node;
-    struct rb_node **rb_node = &g_nv_memdbg.rb_root.rb_node;
+    struct rb_node **rb_node = &shard->rb_root.rb_node;
     struct rb_node *rb_parent = NULL;
 
     while (*rb_node)
@@ -76,13 +217,14 @@ static void nv_memdbg_insert_node(nv_memdbg_node_t *new)
     }
 
     rb_link_node(&new->rb_node, rb_parent, rb_node);
-    rb_insert_color(&new->rb_node, &g_nv_memdbg.rb_root);
+    rb_insert_color(&new->rb_node, &shard->rb_root);
 }
 
-static nv_memdbg_node_t *nv_memdbg_remove_node(void *addr)
+static nv_memdbg_node_t *nv_memdbg_remove_node(nv_memdbg_shard_t *shard,
+                                               void *addr)
 {
     nv_memdbg_node_t *node = NULL;
-    struct rb_node *rb_node = g_nv_memdbg.rb_root.rb_node;
+    struct rb_node *rb_node = shard->rb_root.rb_node;
 
     while (rb_node)
     {
@@ -97,17 +239,21 @@ static nv_memdbg_node_t *nv_memdbg_remove_node(void *addr)
 
     WARN_ON(!node || node->addr != addr);
 
-    rb_erase(&node->rb_node, &g_nv_memdbg.rb_root);
+    rb_erase(&node->rb_node, &shard->rb_root);
     return node;
 }
 
 void nv_memdbg_add(void *addr, NvU64 size, const char *file, int line)
 {
+    nv_memdbg_shard_t *shard = nv_memdbg_shard(addr);
     nv_memdbg_node_t *node;
+    nv_memdbg_site_t *site;
     unsigned long flags;
 
     WARN_ON(addr == NULL);
 
+    site = nv_memdbg_site_account_alloc(size, file, line);
+
     /* If node allocation fails, we can still update the untracked counters */
     node = kmalloc(sizeof(*node),
                    NV_MAY_SLEEP() ? NV_GFP_KERNEL : NV_GFP_ATOMIC);
@@ -117,43 +263,51 @@ void nv_memdbg_add(void *addr, NvU64 size, const char *file, int line)
         node->size = size;
         node->file = file;
         node->line = line;
+        node->site = site;
     }
 
-    NV_SPIN_LOCK_IRQSAVE(&g_nv_memdbg.lock, flags);
+    NV_SPIN_LOCK_IRQSAVE(&shard->lock, flags);
 
     if (node)
     {
-        nv_memdbg_insert_node(node);
+        nv_memdbg_insert_node(shard, node);
     }
     else
     {
-        ++g_nv_memdbg.num_untracked_allocs;
-        g_nv_memdbg.untracked_bytes += size;
+        ++shard->num_untracked_allocs;
+        shard->untracked_bytes += size;
     }
 
-    NV_SPIN_UNLOCK_IRQRESTORE(&g_nv_memdbg.lock, flags);
+    NV_SPIN_UNLOCK_IRQRESTORE(&shard->lock, flags);
 }
 
 void nv_memdbg_remove(void *addr, NvU64 size, const char *file, int line)
 {
+    nv_memdbg_shard_t *shard = nv_memdbg_shard(addr);
     nv_memdbg_node_t *node;
     unsigned long flags;
 
-    NV_SPIN_LOCK_IRQSAVE(&g_nv_memdbg.lock, flags);
+    NV_SPIN_LOCK_IRQSAVE(&shard->lock, flags);
 
-    node = nv_memdbg_remove_node(addr);
+    node = nv_memdbg_remove_node(shard, addr);
     if (!node)
     {
-        WARN_ON(g_nv_memdbg.num_untracked_allocs == 0);
-        WARN_ON(g_nv_memdbg.untracked_bytes < size);
-        --g_nv_memdbg.num_untracked_allocs;
-        g_nv_memdbg.untracked_bytes -= size;
+        WARN_ON(shard->num_untracked_allocs == 0);
+        WARN_ON(shard->untracked_bytes < size);
+        --shard->num_untracked_allocs;
+        shard->untracked_bytes -= size;
     }
 
-    NV_SPIN_UNLOCK_IRQRESTORE(&g_nv_memdbg.lock, flags);
+    NV_SPIN_UNLOCK_IRQRESTORE(&shard->lock, flags);
 
     if (node)
     {
+        if (node->site)
+            atomic64_inc(&node->site->num_frees);
+
+        /* Use the recorded size: some call sites pass size 0 on free */
+        nv_memdbg_count_free(node->size);
+
         if ((size != 0) && (node->size != size))
         {
             nv_printf(NV_DBG_ERRORS,
@@ -176,57 +330,115 @@ void nv_memdbg_remove(void *addr, NvU64 size, const char *file, int line)
 
         kfree(node);
     }
+    else
+    {
+        nv_memdbg_count_free(size);
+    }
 }
 
 void nv_memdbg_exit(void)
 {
     nv_memdbg_node_t *node;
+    nv_memdbg_shard_t *shard;
     NvU64 leaked_bytes = 0, num_leaked_allocs = 0;
+    NvU64 untracked_bytes = 0, num_untracked_allocs = 0;
+    NvBool printed_leak_header = NV_FALSE;
+    NvU32 i;
 
-    if (!RB_EMPTY_ROOT(&g_nv_memdbg.rb_root))
-    {
-        nv_printf(NV_DBG_ERRORS,
-            "NVRM: list of leaked memory allocations:\n");
-    }
-
-    while (!RB_EMPTY_ROOT(&g_nv_memdbg.rb_root))
+    for (i = 0; i < NV_MEMDBG_NUM_SHARDS; i++)
     {
-        node = nv_memdbg_node_entry(rb_first(&g_nv_memdbg.rb_root));
-
-        leaked_bytes += node->size;
-        ++num_leaked_allocs;
+        shard = &g_nv_memdbg.shards[i];
 
-        if (node->file)
+        if (!RB_EMPTY_ROOT(&shard->rb_root) && !printed_leak_header)
         {
             nv_printf(NV_DBG_ERRORS,
-                "NVRM:    %llu bytes, 0x%p @ %s:%d\n",
-                node->size, node->addr, node->file, node->line);
+                "NVRM: list of leaked memory allocations:\n");
+            printed_leak_header = NV_TRUE;
         }
-        else
+
+        while (!RB_EMPTY_ROOT(&shard->rb_root))
         {
-            nv_printf(NV_DBG_ERRORS,
-                "NVRM:    %llu bytes, 0x%p\n",
-                node->size, node->addr);
+            node = nv_memdbg_node_entry(rb_first(&shard->rb_root));
+
+            leaked_bytes += node->size;
+            ++num_leaked_allocs;
+
+            if (node->file)
+            {
+                nv_printf(NV_DBG_ERRORS,
+                    "NVRM:    %llu bytes, 0x%p @ %s:%d\n",
+                    node->size, node->addr, node->file, node->line);
+            }
+            else
+            {
+                nv_printf(NV_DBG_ERRORS,
+                    "NVRM:    %llu bytes, 0x%p\n",
+                    node->size, node->addr);
+            }
+
+            rb_erase(&node->rb_node, &shard->rb_root);
+            kfree(node);
         }
 
-        rb_erase(&node->rb_node, &g_nv_memdbg.rb_root);
-        kfree(node);
+        num_untracked_allocs += shard->num_untracked_allocs;
+        untracked_bytes += shard->untracked_bytes;
     }
 
     /* If we failed to allocate a node at some point, we may have leaked memory
-     * even if the tree is empty */
-    if (num_leaked_allocs > 0 || g_nv_memdbg.num_untracked_allocs > 0)
+     * even if the trees are empty */
+    if (num_leaked_allocs > 0 || num_untracked_allocs > 0)
     {
         nv_printf(NV_DBG_ERRORS,
             "NVRM: total leaked memory: %llu bytes in %llu allocations\n",
-            leaked_bytes + g_nv_memdbg.untracked_bytes,
-            num_leaked_allocs + g_nv_memdbg.num_untracked_allocs);
+            leaked_bytes + untracked_bytes,
+            num_leaked_allocs + num_untracked_allocs);
 
-        if (g_nv_memdbg.num_untracked_allocs > 0)
+        if (num_untracked_allocs > 0)
         {
             nv_printf(NV_DBG_ERRORS,
                 "NVRM:                      %llu bytes in %llu allocations untracked\n",
-                g_nv_memdbg.untracked_bytes, g_nv_memdbg.num_untracked_allocs);
+                untracked_bytes, num_untracked_allocs);
         }
     }
+
+#if defined(NV_MEM_LOGGER)
+    /* With full tracking, frees are attributed to the allocating site, so an
+     * alloc/free count mismatch pins a leak on its site even when the leaked
+     * allocation's node could not be allocated. */
+    for (i = 0; i < NV_MEMDBG_MAX_SITES; i++)
+    {
+        nv_memdbg_site_t *site = &g_nv_memdbg.sites[i];
+        NvS64 outstanding;
+
+        if (site->file == NULL)
+            continue;
+
+        outstanding = (NvS64)(atomic64_read(&site->num_allocs) -
+                              atomic64_read(&site->num_frees));
+        if (outstanding != 0)
+        {
+            nv_printf(NV_DBG_ERRORS,
+                "NVRM:    %lld outstanding allocations @ %s:%d\n",
+                outstanding, site->file, site->line);
+        }
+    }
+#else
+    /* Counter-only builds cannot attribute frees to allocation sites, so
+     * just report the global imbalance */
+    if (atomic64_read(&g_nv_memdbg.outstanding_allocs) != 0)
+    {
+        nv_printf(NV_DBG_ERRORS,
+            "NVRM: leaked memory: %lld bytes in %lld allocations\n",
+            (NvS64)atomic64_read(&g_nv_memdbg.outstanding_bytes),
+            (NvS64)atomic64_read(&g_nv_memdbg.outstanding_allocs));
+    }
+#endif
+
+    if (atomic64_read(&g_nv_memdbg.num_unattributed_allocs) != 0)
+    {
+        nv_printf(NV_DBG_INFO,
+            "NVRM: %lld allocations from sites beyond the %d tracked\n",
+            (NvS64)atomic64_read(&g_nv_memdbg.num_unattributed_allocs),
+            NV_MEMDBG_MAX_SITES);
+    }
 }
@@ -27,6 +27,18 @@
 #include "nv-linux.h"
 #include "nv_speculation_barrier.h"
 
+/*
+ * Huge (PMD and, where supported, PUD level) user mappings of BAR memory
+ * require the vmf_insert_pfn_pmd() fault-time API and transparent huge page
+ * support in the kernel.
+ */
+#if defined(NV_VMF_INSERT_PFN_PMD_PRESENT) && \
+    defined(CONFIG_TRANSPARENT_HUGEPAGE)
+#define NV_MMAP_HUGE_MAPPINGS_SUPPORTED 1
+#include <linux/pfn_t.h>
+#include <linux/huge_mm.h>
+#endif
+
 /*
  * The 'struct vm_operations' open() callback is called by the Linux
  * kernel when the parent VMA is split or copied, close() when the
@@ -137,7 +149,18 @@ nvidia_vma_access(
         return -EINVAL;
     }
 
-    if (!mmap_context->valid)
+    if ((vma->vm_pgoff != 0) && !(nv->flags & NV_FLAG_CONTROL))
+    {
+        // A non-zero file offset selects a tree-indexed mapping allowance.
+        mmap_context = nv_mmap_context_lookup(nvlfp,
+                                              (NvU64)vma->vm_pgoff << PAGE_SHIFT);
+        if (mmap_context == NULL)
+        {
+            nv_printf(NV_DBG_ERRORS, "NVRM: VM: invalid mmap context\n");
+            return -EINVAL;
+        }
+    }
+    else if (!mmap_context->valid)
     {
         nv_printf(NV_DBG_ERRORS, "NVRM: VM: invalid mmap context\n");
         return -EINVAL;
@@ -212,22 +235,31 @@ static vm_fault_t nvidia_fault(
     nv_linux_state_t *nvl = nvlfp->nvptr;
     nv_state_t *nv = NV_STATE_PTR(nvl);
     vm_fault_t ret = VM_FAULT_NOPAGE;
+    const nv_alloc_mapping_context_t *mmap_context = &nvlfp->mmap_context;
 
     NvU64 page;
     NvU64 num_pages = NV_VMA_SIZE(vma) >> PAGE_SHIFT;
-    NvU64 pfn_start = (nvlfp->mmap_context.mmap_start >> PAGE_SHIFT);
+    NvU64 pfn_start;
 
-    if (vma->vm_pgoff != 0)
+    // Mapping revocation is only supported for GPU mappings.
+    if (NV_IS_CTL_DEVICE(nv))
     {
         return VM_FAULT_SIGBUS;
     }
 
-    // Mapping revocation is only supported for GPU mappings.
-    if (NV_IS_CTL_DEVICE(nv))
+    // A non-zero file offset selects a tree-indexed mapping allowance.
+    if (vma->vm_pgoff != 0)
     {
-        return VM_FAULT_SIGBUS;
+        mmap_context = nv_mmap_context_lookup(nvlfp,
+                                              (NvU64)vma->vm_pgoff << PAGE_SHIFT);
+        if (mmap_context == NULL)
+        {
+            return VM_FAULT_SIGBUS;
+        }
     }
 
+    pfn_start = (mmap_context->mmap_start >> PAGE_SHIFT);
+
     // Wake up GPU and reinstate mappings only if we are not in S3/S4 entry
     if (!down_read_trylock(&nv_system_pm_lock))
     {
@@ -277,7 +309,7 @@ static vm_fault_t nvidia_fault(
         NvU64 pfn = pfn_start + page;
 
         ret = nv_insert_pfn(vma, virt_addr, pfn,
-                            nvlfp->mmap_context.remap_prot_extra);
+                            mmap_context->remap_prot_extra);
         if (ret != VM_FAULT_NOPAGE)
         {
             nv_printf(NV_DBG_ERRORS,
@@ -293,11 +325,179 @@ static vm_fault_t nvidia_fault(
     return ret;
 }
 
+#if defined(NV_MMAP_HUGE_MAPPINGS_SUPPORTED)
+/*
+ * Check whether a BAR mapping is eligible for huge mappings: both the user
+ * virtual address and the backing physical range must be PMD-aligned, the
+ * size must be a PMD multiple, and no extra PTE protection bits (PPC64LE 4K
+ * page isolation) may be required. Eligible VMAs are left unpopulated at
+ * mmap() time and established at PMD/PUD granularity by nvidia_huge_fault(),
+ * with nvidia_fault() as the 4K fallback.
+ */
+static NvBool nv_vma_is_huge_mappable(
+    struct vm_area_struct *vma,
+    NvU64 mmap_start,
+    NvU64 mmap_length,
+    NvU32 remap_prot_extra
+)
+{
+    return (remap_prot_extra == 0) &&
+           ((vma->vm_start & ~PMD_MASK) == 0) &&
+           ((mmap_start & ~PMD_MASK) == 0) &&
+           ((mmap_length & ~PMD_MASK) == 0) &&
+           (mmap_length != 0);
+}
+
+/*
+ * Attempt to satisfy a PMD- or PUD-level fault against a BAR mapping with a
+ * single huge mapping covering the aligned range around the fault address.
+ * Any condition that cannot be satisfied at this level returns
+ * VM_FAULT_FALLBACK so the kernel retries with the next smaller size,
+ * ultimately landing in nvidia_fault() for 4K PTEs.
+ */
+static vm_fault_t nvidia_huge_fault_common(
+    struct vm_fault *vmf,
+    NvU64 size,
+    NvBool is_pud
+)
+{
+    struct vm_area_struct *vma = vmf->vma;
+    nv_linux_file_private_t *nvlfp = NV_GET_LINUX_FILE_PRIVATE(NV_VMA_FILE(vma));
+    nv_linux_state_t *nvl = nvlfp->nvptr;
+    nv_state_t *nv;
+    const nv_alloc_mapping_context_t *mmap_context = &nvlfp->mmap_context;
+    NvU64 virt_addr, phys_addr;
+    bool write = ((vmf->flags & FAULT_FLAG_WRITE) != 0);
+    vm_fault_t ret;
+
+    if (nvl == NULL)
+    {
+        return VM_FAULT_FALLBACK;
+    }
+
+    nv = NV_STATE_PTR(nvl);
+
+    /* Huge mappings are only established for BAR memory on GPU device nodes. */
+    if (NV_IS_CTL_DEVICE(nv))
+    {
+        return VM_FAULT_FALLBACK;
+    }
+
+    /* A non-zero file offset selects a tree-indexed mapping allowance. */
+    if (vma->vm_pgoff != 0)
+    {
+        mmap_context = nv_mmap_context_lookup(nvlfp,
+                                              (NvU64)vma->vm_pgoff << PAGE_SHIFT);
+        if (mmap_context == NULL)
+        {
+            return VM_FAULT_FALLBACK;
+        }
+    }
+
+    if (!mmap_context->valid || (mmap_context->remap_prot_extra != 0))
+    {
+        return VM_FAULT_FALLBACK;
+    }
+
+    virt_addr = (vmf->address & ~(size - 1));
+    if ((virt_addr < vma->vm_start) || ((virt_addr + size) > vma->vm_end))
+    {
+        return VM_FAULT_FALLBACK;
+    }
+
+    phys_addr = mmap_context->mmap_start + (virt_addr - vma->vm_start);
+    if ((phys_addr & (size - 1)) != 0)
+    {
+        return VM_FAULT_FALLBACK;
+    }
+
+    // Do not wait on the PM lock in the fault path during S3/S4 entry.
+    if (!down_read_trylock(&nv_system_pm_lock))
+    {
+        return VM_FAULT_FALLBACK;
+    }
+
+    down(&nvl->mmap_lock);
+
+    if (!nvl->safe_to_mmap)
+    {
+        /* Let the 4K fault path schedule the GPU wakeup. */
+        up(&nvl->mmap_lock);
+        up_read(&nv_system_pm_lock);
+        return VM_FAULT_FALLBACK;
+    }
+
+#if defined(NV_VMF_INSERT_PFN_PUD_PRESENT)
+    if (is_pud)
+    {
+        ret = vmf_insert_pfn_pud(vmf,
+                phys_to_pfn_t(phys_addr, PFN_DEV | PFN_SPECIAL), write);
+    }
+    else
+#endif
+    {
+        ret = vmf_insert_pfn_pmd(vmf,
+                phys_to_pfn_t(phys_addr, PFN_DEV | PFN_SPECIAL), write);
+    }
+
+    if (ret == VM_FAULT_NOPAGE)
+    {
+        nvl->all_mappings_revoked = NV_FALSE;
+    }
+
+    up(&nvl->mmap_lock);
+    up_read(&nv_system_pm_lock);
+
+    return ret;
+}
+
+#if defined(NV_VM_OPS_HUGE_FAULT_REMOVED_PE_SIZE_ARG)
+static vm_fault_t nvidia_huge_fault(
+    struct vm_fault *vmf,
+    unsigned int order
+)
+{
+    if (order == (PMD_SHIFT - PAGE_SHIFT))
+    {
+        return nvidia_huge_fault_common(vmf, PMD_SIZE, NV_FALSE);
+    }
+#if defined(NV_VMF_INSERT_PFN_PUD_PRESENT)
+    if (order == (PUD_SHIFT - PAGE_SHIFT))
+    {
+        return nvidia_huge_fault_common(vmf, PUD_SIZE, NV_TRUE);
+    }
+#endif
+    return VM_FAULT_FALLBACK;
+}
+#else
+static vm_fault_t nvidia_huge_fault(
+    struct vm_fault *vmf,
+    enum page_entry_size pe_size
+)
+{
+    switch (pe_size)
+    {
+        case PE_SIZE_PMD:
+            return nvidia_huge_fault_common(vmf, PMD_SIZE, NV_FALSE);
+#if defined(NV_VMF_INSERT_PFN_PUD_PRESENT)
+        case PE_SIZE_PUD:
+            return nvidia_huge_fault_common(vmf, PUD_SIZE, NV_TRUE);
+#endif
+        default:
+            return VM_FAULT_FALLBACK;
+    }
+}
+#endif
+#endif /* NV_MMAP_HUGE_MAPPINGS_SUPPORTED */
+
 static struct vm_operations_struct nv_vm_ops = {
     .open   = nvidia_vma_open,
     .close  = nvidia_vma_release,
     .fault  = nvidia_fault,
     .access = nvidia_vma_access,
+#if defined(NV_MMAP_HUGE_MAPPINGS_SUPPORTED)
+    .huge_fault = nvidia_huge_fault,
+#endif
 };
 
 int nv_encode_caching(
@@ -490,17 +690,30 @@ int nvidia_mmap_helper(
         return NV_ERR_INVALID_ARGUMENT;
 
     /*
-     * If mmap context is not valid on this file descriptor, this mapping wasn't
-     * previously validated with the RM so it must be rejected.
+     * If no mmap context is found on this file descriptor, this mapping
+     * wasn't previously validated with the RM so it must be rejected. A
+     * zero file offset selects the legacy single-slot context; a non-zero
+     * offset selects a tree-indexed allowance by its mmap_start, which
+     * only exists for device (non-control) nodes.
      */
-    if (!mmap_context->valid)
+    if (vma->vm_pgoff != 0)
     {
-        nv_printf(NV_DBG_ERRORS, "NVRM: VM: invalid mmap\n");
-        return -EINVAL;
-    }
+        if (NV_IS_CTL_DEVICE(nv))
+        {
+            return -EINVAL;
+        }
 
-    if (vma->vm_pgoff != 0)
+        mmap_context = nv_mmap_context_lookup(nvlfp,
+                                              (NvU64)vma->vm_pgoff << PAGE_SHIFT);
+        if (mmap_context == NULL)
+        {
+            nv_printf(NV_DBG_ERRORS, "NVRM: VM: invalid mmap\n");
+            return -EINVAL;
+        }
+    }
+    else if (!mmap_context->valid)
     {
+        nv_printf(NV_DBG_ERRORS, "NVRM: VM: invalid mmap\n");
         return -EINVAL;
     }
 
@@ -590,8 +803,22 @@ int nvidia_mmap_helper(
             }
             else
             {
-                if (nv_io_remap_page_range(vma, mmap_start, mmap_length,
-                        remap_prot_extra) != 0)
+                NvBool bDeferToFault = NV_FALSE;
+
+#if defined(NV_MMAP_HUGE_MAPPINGS_SUPPORTED)
+                //
+                // Suitably aligned BAR mappings are not populated here:
+                // nvidia_huge_fault() establishes them with PMD/PUD entries
+                // on first access, cutting both mmap() latency and TLB
+                // pressure for large (e.g. resizable BAR1) mappings.
+                //
+                bDeferToFault = nv_vma_is_huge_mappable(vma, mmap_start,
+                                                        mmap_length,
+                                                        remap_prot_extra);
+#endif
+                if (!bDeferToFault &&
+                    (nv_io_remap_page_range(vma, mmap_start, mmap_length,
+                        remap_prot_extra) != 0))
                 {
                     up(&nvl->mmap_lock);
                     return -EAGAIN;
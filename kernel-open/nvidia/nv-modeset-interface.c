@@ -76,7 +76,7 @@ static NvU32 nvidia_modeset_enumerate_gpus(nv_gpu_info_t *gpu_info)
     nv_linux_state_t *nvl;
     unsigned int count;
 
-    LOCK_NV_LINUX_DEVICES();
+    LOCK_NV_LINUX_DEVICES_READ();
 
     count = 0;
 
@@ -107,7 +107,7 @@ static NvU32 nvidia_modeset_enumerate_gpus(nv_gpu_info_t *gpu_info)
         count++;
     }
 
-    UNLOCK_NV_LINUX_DEVICES();
+    UNLOCK_NV_LINUX_DEVICES_READ();
 
     return count;
 }
@@ -145,21 +145,52 @@ NvS32 NV_API_CALL nv_request_msix_irq(nv_linux_state_t *nvl)
     struct msix_entry *msix_entries;
     int rc = NV_ERR_INVALID_ARGUMENT;
     nv_state_t *nv = NV_STATE_PTR(nvl);
+    int node = dev_to_node(&nvl->pci_dev->dev);
+
+    NV_KZALLOC(nvl->msix_irq_names, NV_MSIX_IRQ_NAME_SIZE * nvl->num_intr);
+    if (nvl->msix_irq_names == NULL)
+    {
+        return NV_ERR_NO_MEMORY;
+    }
 
     for (i = 0, msix_entries = nvl->msix_entries; i < nvl->num_intr;
          i++, msix_entries++)
     {
+        char *name = nvl->msix_irq_names + (i * NV_MSIX_IRQ_NAME_SIZE);
+
+        //
+        // Name each vector individually so userspace affinity policies
+        // (irqbalance bans, smp_affinity pinning) can target a single
+        // vector. The vector index is stable across loads; RM decides
+        // which interrupt classes it routes to which vector.
+        //
+        snprintf(name, NV_MSIX_IRQ_NAME_SIZE, "%s%u-msix%d",
+                 nv_device_name, nvl->minor_num, i);
+
         rc = request_threaded_irq(msix_entries->vector, nvidia_isr_msix,
                                   nvidia_isr_msix_kthread_bh, nv_default_irq_flags(nv),
-                                  nv_device_name, (void *)nvl);
+                                  name, (void *)nvl);
         if (rc)
         {
             for( j = 0; j < i; j++)
             {
+                irq_set_affinity_hint(nvl->msix_entries[j].vector, NULL);
                 free_irq(nvl->msix_entries[j].vector, (void *)nvl);
             }
+
+            NV_KFREE(nvl->msix_irq_names,
+                     NV_MSIX_IRQ_NAME_SIZE * nvl->num_intr);
+            nvl->msix_irq_names = NULL;
             break;
         }
+
+        //
+        // Spread vector servicing across the CPUs of the GPU's local NUMA
+        // node instead of letting all vectors concentrate on one core.
+        // This is a hint, so userspace policies can still override it.
+        //
+        irq_set_affinity_hint(msix_entries->vector,
+                              cpumask_of(cpumask_local_spread(i, node)));
     }
 
     return rc;
@@ -50,6 +50,19 @@ typedef struct nv_p2p_mem_info {
         struct semaphore lock;
     } dma_mapping_list;
     void *private;
+    //
+    // Registration cache state: see nv_p2p_reg_cache_list below.
+    //
+    struct {
+        struct list_head list_node;
+        nv_p2p_page_table_type_t pt_type;
+        uint64_t p2p_token;
+        uint32_t va_space;
+        uint64_t virtual_address;
+        uint64_t length;
+        NvU64 refcount;
+        NvBool cached;
+    } reg;
 } nv_p2p_mem_info_t;
 
 // declared and created in nv.c
@@ -114,6 +127,186 @@ static NV_STATUS nvidia_p2p_map_page_size(NvU32 page_size, NvU32 *page_size_inde
     return NV_OK;
 }
 
+//
+// Registration cache for repeated get_pages/put_pages cycles.
+//
+// RDMA stacks (nvidia-peermem, GPUDirect Storage) re-register the same GPU
+// buffers every time a memory region cycles, paying a full re-pin and
+// re-translation each time. The cache keeps a registration alive after the
+// last importer reference is dropped: put_pages only unlinks from RM once a
+// registration is evicted, and a later get_pages with the same
+// (type, token, va_space, address, length) key takes over the idle
+// registration without calling into RM at all.
+//
+// Idle registrations still hold their pages pinned, so the pool is bounded
+// (LRU eviction) and teardown remains tied to RM revocation: the free
+// callback registered with RM at first registration claims the entry out of
+// the cache before the page table is freed, whether an importer currently
+// holds it or not.
+//
+#define NV_P2P_REG_CACHE_MAX_IDLE 32
+
+static LIST_HEAD(nv_p2p_reg_cache_list);
+static DEFINE_MUTEX(nv_p2p_reg_cache_lock);
+static NvU32 nv_p2p_reg_cache_idle_count;
+
+static struct nv_p2p_mem_info* nv_p2p_reg_cache_lookup(
+    nv_p2p_page_table_type_t pt_type,
+    uint64_t p2p_token,
+    uint32_t va_space,
+    uint64_t virtual_address,
+    uint64_t length,
+    void (*free_callback)(void *data),
+    void *data
+)
+{
+    struct nv_p2p_mem_info *mem_info;
+
+    mutex_lock(&nv_p2p_reg_cache_lock);
+
+    list_for_each_entry(mem_info, &nv_p2p_reg_cache_list, reg.list_node)
+    {
+        if ((mem_info->reg.refcount == 0) &&
+            (mem_info->reg.pt_type == pt_type) &&
+            (mem_info->reg.p2p_token == p2p_token) &&
+            (mem_info->reg.va_space == va_space) &&
+            (mem_info->reg.virtual_address == virtual_address) &&
+            (mem_info->reg.length == length))
+        {
+            mem_info->reg.refcount = 1;
+            mem_info->free_callback = free_callback;
+            mem_info->data = data;
+            list_move(&mem_info->reg.list_node, &nv_p2p_reg_cache_list);
+            nv_p2p_reg_cache_idle_count--;
+            mutex_unlock(&nv_p2p_reg_cache_lock);
+            return mem_info;
+        }
+    }
+
+    mutex_unlock(&nv_p2p_reg_cache_lock);
+
+    return NULL;
+}
+
+static void nv_p2p_reg_cache_insert(
+    struct nv_p2p_mem_info *mem_info,
+    nv_p2p_page_table_type_t pt_type,
+    uint64_t p2p_token,
+    uint32_t va_space,
+    uint64_t virtual_address,
+    uint64_t length
+)
+{
+    mem_info->reg.pt_type = pt_type;
+    mem_info->reg.p2p_token = p2p_token;
+    mem_info->reg.va_space = va_space;
+    mem_info->reg.virtual_address = virtual_address;
+    mem_info->reg.length = length;
+    mem_info->reg.refcount = 1;
+
+    mutex_lock(&nv_p2p_reg_cache_lock);
+    mem_info->reg.cached = NV_TRUE;
+    list_add(&mem_info->reg.list_node, &nv_p2p_reg_cache_list);
+    mutex_unlock(&nv_p2p_reg_cache_lock);
+}
+
+//
+// Remove mem_info from the registration cache if it is still there. Called
+// from every teardown path before the page table is freed, so that a freed
+// registration can never be handed out again.
+//
+static void nv_p2p_reg_cache_remove(
+    struct nv_p2p_mem_info *mem_info
+)
+{
+    mutex_lock(&nv_p2p_reg_cache_lock);
+
+    if (mem_info->reg.cached)
+    {
+        list_del(&mem_info->reg.list_node);
+        mem_info->reg.cached = NV_FALSE;
+        if (mem_info->reg.refcount == 0)
+        {
+            nv_p2p_reg_cache_idle_count--;
+        }
+    }
+
+    mutex_unlock(&nv_p2p_reg_cache_lock);
+}
+
+//
+// Drop an importer reference on a cached registration. The mem_info pointer
+// is only dereferenced if it is found on the cache list under the lock, as a
+// non-persistent page table may already have been freed by the revocation
+// callback.
+//
+// Returns NV_TRUE if the reference was dropped and the registration stays
+// pinned for reuse; *evicted is set if an idle registration must really be
+// unlinked by the caller to bound the pool.
+//
+static NvBool nv_p2p_reg_cache_release(
+    struct nv_p2p_mem_info *mem_info,
+    struct nv_p2p_mem_info **evicted
+)
+{
+    struct nv_p2p_mem_info *cur;
+    NvBool found = NV_FALSE;
+
+    *evicted = NULL;
+
+    mutex_lock(&nv_p2p_reg_cache_lock);
+
+    list_for_each_entry(cur, &nv_p2p_reg_cache_list, reg.list_node)
+    {
+        if (cur == mem_info)
+        {
+            found = NV_TRUE;
+            break;
+        }
+    }
+
+    if (!found)
+    {
+        mutex_unlock(&nv_p2p_reg_cache_lock);
+        return NV_FALSE;
+    }
+
+    WARN_ON(mem_info->reg.refcount == 0);
+    mem_info->reg.refcount--;
+
+    if (mem_info->reg.refcount == 0)
+    {
+        //
+        // The departing importer's callback must not fire once it has put
+        // its reference; revocation of an idle registration only tears down
+        // the page table.
+        //
+        mem_info->free_callback = NULL;
+        mem_info->data = NULL;
+        nv_p2p_reg_cache_idle_count++;
+
+        if (nv_p2p_reg_cache_idle_count > NV_P2P_REG_CACHE_MAX_IDLE)
+        {
+            list_for_each_entry_reverse(cur, &nv_p2p_reg_cache_list,
+                                        reg.list_node)
+            {
+                if (cur->reg.refcount == 0)
+                {
+                    list_del(&cur->reg.list_node);
+                    cur->reg.cached = NV_FALSE;
+                    nv_p2p_reg_cache_idle_count--;
+                    *evicted = cur;
+                    break;
+                }
+            }
+        }
+    }
+
+    mutex_unlock(&nv_p2p_reg_cache_lock);
+
+    return NV_TRUE;
+}
+
 static NV_STATUS nv_p2p_insert_dma_mapping(
     struct nv_p2p_mem_info *mem_info,
     struct nvidia_p2p_dma_mapping *dma_mapping
@@ -260,6 +453,8 @@ static void nv_p2p_free_page_table(
 
     mem_info = container_of(page_table, nv_p2p_mem_info_t, page_table);
 
+    nv_p2p_reg_cache_remove(mem_info);
+
     dma_mapping = nv_p2p_remove_dma_mapping(mem_info, NULL);
     while (dma_mapping != NULL)
     {
@@ -286,7 +481,7 @@ static void nv_p2p_free_page_table(
     os_free_mem(mem_info);
 }
 
-static NV_STATUS nv_p2p_put_pages(
+static NV_STATUS nv_p2p_put_pages_unlink(
     nv_p2p_page_table_type_t pt_type,
     nvidia_stack_t * sp,
     uint64_t p2p_token,
@@ -341,6 +536,46 @@ static NV_STATUS nv_p2p_put_pages(
     return status;
 }
 
+static NV_STATUS nv_p2p_put_pages(
+    nv_p2p_page_table_type_t pt_type,
+    nvidia_stack_t * sp,
+    uint64_t p2p_token,
+    uint32_t va_space,
+    uint64_t virtual_address,
+    struct nvidia_p2p_page_table **page_table
+)
+{
+    struct nv_p2p_mem_info *mem_info;
+    struct nv_p2p_mem_info *evicted = NULL;
+
+    //
+    // Note that this container_of is pure pointer arithmetic; mem_info is
+    // only dereferenced by the cache release if it is still alive.
+    //
+    mem_info = container_of(*page_table, nv_p2p_mem_info_t, page_table);
+
+    if (nv_p2p_reg_cache_release(mem_info, &evicted))
+    {
+        *page_table = NULL;
+
+        if (evicted != NULL)
+        {
+            struct nvidia_p2p_page_table *evicted_pt = &evicted->page_table;
+
+            (void)nv_p2p_put_pages_unlink(evicted->reg.pt_type, sp,
+                                          evicted->reg.p2p_token,
+                                          evicted->reg.va_space,
+                                          evicted->reg.virtual_address,
+                                          &evicted_pt);
+        }
+
+        return NV_OK;
+    }
+
+    return nv_p2p_put_pages_unlink(pt_type, sp, p2p_token, va_space,
+                                   virtual_address, page_table);
+}
+
 void NV_API_CALL nv_p2p_free_platform_data(
     void *data
 )
@@ -376,8 +611,24 @@ NV_EXPORT_SYMBOL(nvidia_p2p_destroy_mapping);
 static void nv_p2p_mem_info_free_callback(void *data)
 {
     nv_p2p_mem_info_t *mem_info = (nv_p2p_mem_info_t*) data;
+    void (*free_callback)(void *data);
+    void *cb_data;
+
+    //
+    // Claim the registration out of the cache before anything is torn down
+    // so that a concurrent get_pages cannot take it over, then snapshot the
+    // callback: it is NULL while the registration sits idle (the original
+    // importer has already put its reference).
+    //
+    nv_p2p_reg_cache_remove(mem_info);
 
-    mem_info->free_callback(mem_info->data);
+    free_callback = mem_info->free_callback;
+    cb_data = mem_info->data;
+
+    if (free_callback != NULL)
+    {
+        free_callback(cb_data);
+    }
 
     nv_p2p_free_platform_data(&mem_info->page_table);
 }
@@ -419,6 +670,39 @@ static int nv_p2p_get_pages(
     }
 
     *page_table = NULL;
+
+    //
+    // Reuse an idle registration of the same range if one is cached: the
+    // pages are still pinned and translated, so no RM call is needed.
+    //
+    mem_info = nv_p2p_reg_cache_lookup(pt_type, p2p_token, va_space,
+                                       virtual_address, length,
+                                       free_callback, data);
+    if (mem_info != NULL)
+    {
+        if (pt_type == NV_P2P_PAGE_TABLE_TYPE_PERSISTENT)
+        {
+            rc = nvidia_dev_get_uuid(mem_info->page_table.gpu_uuid, sp);
+            if (rc != 0)
+            {
+                mutex_lock(&nv_p2p_reg_cache_lock);
+                mem_info->reg.refcount = 0;
+                mem_info->free_callback = NULL;
+                mem_info->data = NULL;
+                nv_p2p_reg_cache_idle_count++;
+                mutex_unlock(&nv_p2p_reg_cache_lock);
+
+                nv_kmem_cache_free_stack(sp);
+                return nvidia_p2p_map_status(NV_ERR_GPU_UUID_NOT_FOUND);
+            }
+        }
+
+        *page_table = &mem_info->page_table;
+
+        nv_kmem_cache_free_stack(sp);
+        return 0;
+    }
+
     status = os_alloc_mem((void **)&mem_info, sizeof(*mem_info));
     if (status != NV_OK)
     {
@@ -575,6 +859,9 @@ static int nv_p2p_get_pages(
         }
     }
 
+    nv_p2p_reg_cache_insert(mem_info, pt_type, p2p_token, va_space,
+                            virtual_address, length);
+
     nv_kmem_cache_free_stack(sp);
 
     return nvidia_p2p_map_status(status);
@@ -1001,7 +1288,7 @@ int nvidia_p2p_get_rsync_registers(
 
     info->version = NVIDIA_P2P_RSYNC_REG_INFO_VERSION;
 
-    LOCK_NV_LINUX_DEVICES();
+    LOCK_NV_LINUX_DEVICES_READ();
 
     for (nvl = nv_linux_devices; nvl; nvl = nvl->next)
     {
@@ -1012,7 +1299,7 @@ int nvidia_p2p_get_rsync_registers(
     if (status != NV_OK)
     {
         nvidia_p2p_put_rsync_registers(info);
-        UNLOCK_NV_LINUX_DEVICES();
+        UNLOCK_NV_LINUX_DEVICES_READ();
         return -ENOMEM;
     }
 
@@ -1045,7 +1332,7 @@ int nvidia_p2p_get_rsync_registers(
         index++;
     }
 
-    UNLOCK_NV_LINUX_DEVICES();
+    UNLOCK_NV_LINUX_DEVICES_READ();
 
     info->regs = regs;
     info->entries = index;
@@ -1143,7 +1143,7 @@ nv_linux_state_t * find_pci(NvU32 domain, NvU8 bus, NvU8 slot, NvU8 function)
 {
     nv_linux_state_t *nvl = NULL;
 
-    LOCK_NV_LINUX_DEVICES();
+    LOCK_NV_LINUX_DEVICES_READ();
 
     for (nvl = nv_linux_devices; nvl != NULL; nvl = nvl->next)
     {
@@ -1158,7 +1158,7 @@ nv_linux_state_t * find_pci(NvU32 domain, NvU8 bus, NvU8 slot, NvU8 function)
         }
     }
 
-    UNLOCK_NV_LINUX_DEVICES();
+    UNLOCK_NV_LINUX_DEVICES_READ();
     return nvl;
 }
 
@@ -1404,9 +1404,41 @@ void nv_pci_unregister_driver(void)
 
 int nv_pci_register_driver(void)
 {
+    int rc;
+
     if (NVreg_RegisterPCIDriver == 0)
     {
         return 0;
     }
-    return pci_register_driver(&nv_pci_driver);
+
+#if defined(NV_DEVICE_DRIVER_HAS_PROBE_TYPE)
+    /*
+     * Let the kernel probe each GPU on its own probe thread, so that on
+     * multi-GPU systems the probes run in parallel and module load time
+     * tracks the slowest GPU rather than the sum. Minor numbers are
+     * assigned in probe-completion order, so they can vary between loads;
+     * clients are expected to identify GPUs by PCI bus address.
+     */
+    if (NVreg_EnableAsyncPciProbe)
+    {
+        nv_pci_driver.driver.probe_type = PROBE_PREFER_ASYNCHRONOUS;
+    }
+#endif
+
+    rc = pci_register_driver(&nv_pci_driver);
+
+#if defined(NV_DEVICE_DRIVER_HAS_PROBE_TYPE)
+    /*
+     * Module init checks how many devices were probed after this function
+     * returns, so wait here for the asynchronous probes to complete. The
+     * probes still run concurrently with each other; only their completion
+     * is awaited.
+     */
+    if ((rc == 0) && NVreg_EnableAsyncPciProbe)
+    {
+        wait_for_device_probe();
+    }
+#endif
+
+    return rc;
 }
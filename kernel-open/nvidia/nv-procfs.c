@@ -226,6 +226,41 @@ nv_procfs_read_power(
 
 NV_DEFINE_SINGLE_NVRM_PROCFS_FILE(power);
 
+#define NV_GSP_RPC_STATS_BUFFER_SIZE 8192
+
+static int
+nv_procfs_read_gsp_rpc_stats(
+    struct seq_file *s,
+    void *v
+)
+{
+    nv_state_t *nv = s->private;
+    nvidia_stack_t *sp = NULL;
+    char *stats;
+
+    if (os_alloc_mem((void **)&stats, NV_GSP_RPC_STATS_BUFFER_SIZE) != NV_OK)
+    {
+        return 0;
+    }
+
+    if (nv_kmem_cache_alloc_stack(&sp) != 0)
+    {
+        os_free_mem(stats);
+        return 0;
+    }
+
+    stats[0] = '\0';
+    rm_get_gsp_rpc_stats(sp, nv, stats, NV_GSP_RPC_STATS_BUFFER_SIZE);
+    seq_puts(s, stats);
+
+    nv_kmem_cache_free_stack(sp);
+    os_free_mem(stats);
+
+    return 0;
+}
+
+NV_DEFINE_SINGLE_NVRM_PROCFS_FILE(gsp_rpc_stats);
+
 static int
 nv_procfs_read_version(
     struct seq_file *s,
@@ -1414,6 +1449,11 @@ int nv_procfs_add_gpu(nv_linux_state_t *nvl)
     if (!entry)
         goto failed;
 
+    entry = NV_CREATE_PROC_FILE("gsp-rpc-stats", proc_nvidia_gpu, gsp_rpc_stats,
+                                nv);
+    if (!entry)
+        goto failed;
+
     if (IS_EXERCISE_ERROR_FORWARDING_ENABLED())
     {
         entry = NV_CREATE_PROC_FILE("exercise_error_forwarding", proc_nvidia_gpu,
@@ -839,6 +839,32 @@
 #define __NV_ENABLE_NONBLOCKING_OPEN EnableNonblockingOpen
 #define NV_ENABLE_NONBLOCKING_OPEN NV_REG_STRING(__NV_ENABLE_NONBLOCKING_OPEN)
 
+/*
+ * Option: NVreg_EnableAsyncPciProbe
+ *
+ * Description:
+ *
+ * When this option is enabled, the NVIDIA driver asks the kernel to probe
+ * the GPUs it binds to on asynchronous probe threads, so that on multi-GPU
+ * systems the per-GPU probe and boot work proceeds in parallel instead of
+ * serially during module load.
+ *
+ * With asynchronous probing, the order in which GPUs finish probing - and
+ * therefore the assignment of /dev/nvidiaN minor numbers to GPUs - can vary
+ * from one driver load to the next. Clients should identify GPUs by PCI bus
+ * address rather than by minor number, as they already must on systems with
+ * hotplug or excluded GPUs.
+ *
+ * This option has no effect on kernels without asynchronous device probing
+ * support (added in Linux 4.2).
+ *
+ * Possible Values:
+ *  0 = GPUs are probed synchronously during module load
+ *  1 = GPUs are probed on asynchronous probe threads (default)
+ */
+#define __NV_ENABLE_ASYNC_PCI_PROBE EnableAsyncPciProbe
+#define NV_ENABLE_ASYNC_PCI_PROBE NV_REG_STRING(__NV_ENABLE_ASYNC_PCI_PROBE)
+
 /*
  * Option: NVreg_ImexChannelCount
  *
@@ -917,6 +943,7 @@ NV_DEFINE_REG_ENTRY_GLOBAL(__NV_REGISTER_PCI_DRIVER, 1);
 NV_DEFINE_REG_ENTRY_GLOBAL(__NV_ENABLE_RESIZABLE_BAR, 0);
 NV_DEFINE_REG_ENTRY_GLOBAL(__NV_ENABLE_DBG_BREAKPOINT, 0);
 NV_DEFINE_REG_ENTRY_GLOBAL(__NV_ENABLE_NONBLOCKING_OPEN, 1);
+NV_DEFINE_REG_ENTRY_GLOBAL(__NV_ENABLE_ASYNC_PCI_PROBE, 1);
 
 NV_DEFINE_REG_STRING_ENTRY(__NV_REGISTRY_DWORDS, NULL);
 NV_DEFINE_REG_STRING_ENTRY(__NV_REGISTRY_DWORDS_PER_DEVICE, NULL);
@@ -26,6 +26,122 @@
 #include "os-interface.h"
 #include "nv-linux.h"
 
+/*
+ * Register an additional mapping allowance on a file descriptor whose
+ * single mmap_context slot is already in use. The caller identifies the
+ * allowance at mmap() time by passing mmap_start as the file offset.
+ * Entries persist until the file descriptor is closed, matching the
+ * lifetime of the single-slot context.
+ */
+static NV_STATUS nv_mmap_context_tree_insert(
+    nv_linux_file_private_t *nvlfp,
+    const nv_alloc_mapping_context_t *nvamc
+)
+{
+    nv_mmap_context_entry_t *entry;
+    struct interval_tree_node *node;
+    unsigned long flags;
+    NvU64 start = nvamc->mmap_start;
+    NvU64 last = nvamc->mmap_start + nvamc->mmap_size - 1;
+
+    if (nvamc->mmap_size == 0)
+        return NV_ERR_INVALID_ARGUMENT;
+
+    NV_KMALLOC(entry, sizeof(nv_mmap_context_entry_t));
+    if (entry == NULL)
+        return NV_ERR_NO_MEMORY;
+
+    entry->context = *nvamc;
+    entry->node.start = start;
+    entry->node.last = last;
+
+    NV_SPIN_LOCK_IRQSAVE(&nvlfp->mmap_context_lock, flags);
+
+    /*
+     * Allowances are looked up by their exact mmap_start, so reject
+     * duplicate starting offsets to keep the lookup unambiguous.
+     */
+    for (node = interval_tree_iter_first(&nvlfp->mmap_context_tree,
+                                         start, last);
+         node != NULL;
+         node = interval_tree_iter_next(node, start, last))
+    {
+        if (node->start == start)
+        {
+            NV_SPIN_UNLOCK_IRQRESTORE(&nvlfp->mmap_context_lock, flags);
+            NV_KFREE(entry, sizeof(nv_mmap_context_entry_t));
+            return NV_ERR_STATE_IN_USE;
+        }
+    }
+
+    interval_tree_insert(&entry->node, &nvlfp->mmap_context_tree);
+
+    NV_SPIN_UNLOCK_IRQRESTORE(&nvlfp->mmap_context_lock, flags);
+
+    return NV_OK;
+}
+
+/*
+ * Find the mapping allowance whose mmap_start matches the given mmap()
+ * file offset. The returned context remains valid until the file
+ * descriptor is closed; entries are never removed while other
+ * references to the file can exist.
+ */
+const nv_alloc_mapping_context_t *nv_mmap_context_lookup(
+    nv_linux_file_private_t *nvlfp,
+    NvU64 offset
+)
+{
+    nv_mmap_context_entry_t *entry = NULL;
+    struct interval_tree_node *node;
+    unsigned long flags;
+
+    NV_SPIN_LOCK_IRQSAVE(&nvlfp->mmap_context_lock, flags);
+
+    for (node = interval_tree_iter_first(&nvlfp->mmap_context_tree,
+                                         offset, offset);
+         node != NULL;
+         node = interval_tree_iter_next(node, offset, offset))
+    {
+        if (node->start == offset)
+        {
+            entry = container_of(node, nv_mmap_context_entry_t, node);
+            break;
+        }
+    }
+
+    NV_SPIN_UNLOCK_IRQRESTORE(&nvlfp->mmap_context_lock, flags);
+
+    return (entry != NULL) ? &entry->context : NULL;
+}
+
+/*
+ * Free all mapping allowances registered on this file descriptor. Called
+ * when the file private is torn down; no concurrent lookups are possible
+ * at that point.
+ */
+void nv_mmap_context_tree_purge(
+    nv_linux_file_private_t *nvlfp
+)
+{
+    struct interval_tree_node *node;
+    nv_mmap_context_entry_t *entry;
+
+    while ((node = interval_tree_iter_first(&nvlfp->mmap_context_tree,
+                                            0, NV_U64_MAX)) != NULL)
+    {
+        entry = container_of(node, nv_mmap_context_entry_t, node);
+        interval_tree_remove(node, &nvlfp->mmap_context_tree);
+
+        if (entry->context.page_array != NULL)
+        {
+            os_free_mem(entry->context.page_array);
+        }
+
+        NV_KFREE(entry, sizeof(nv_mmap_context_entry_t));
+    }
+}
+
 NV_STATUS NV_API_CALL nv_add_mapping_context_to_file(
     nv_state_t *nv,
     nv_usermap_access_params_t *nvuap,
@@ -50,40 +166,69 @@ NV_STATUS NV_API_CALL nv_add_mapping_context_to_file(
 
     nvamc = &nvlfp->mmap_context;
 
-    if (nvamc->valid)
-    {
-        status = NV_ERR_STATE_IN_USE;
-        goto done;
-    }
-
     if (NV_IS_CTL_DEVICE(nv))
     {
+        /*
+         * Control-node contexts are keyed by the allocation private
+         * pointer rather than by a mapping offset, so they cannot be
+         * indexed in the interval tree and keep the single-slot
+         * protocol.
+         */
+        if (nvamc->valid)
+        {
+            status = NV_ERR_STATE_IN_USE;
+            goto done;
+        }
+
         nvamc->alloc = pAllocPriv;
         nvamc->page_index = pageIndex;
+        nvamc->prot = prot;
+        nvamc->valid = NV_TRUE;
+        nvamc->caching = nvuap->caching;
     }
     else
     {
+        nv_alloc_mapping_context_t context;
+
         if (NV_STATE_PTR(nvlfp->nvptr) != nv)
         {
             status = NV_ERR_INVALID_ARGUMENT;
             goto done;
         }
 
-        nvamc->mmap_start = nvuap->mmap_start;
-        nvamc->mmap_size = nvuap->mmap_size;
+        memset(&context, 0, sizeof(context));
+
+        context.mmap_start = nvuap->mmap_start;
+        context.mmap_size = nvuap->mmap_size;
         if (nv_get_numa_status(nvl) == NV_NUMA_STATUS_ONLINE)
         {
-            nvamc->page_array = nvuap->page_array;
-            nvamc->num_pages = nvuap->num_pages;
+            context.page_array = nvuap->page_array;
+            context.num_pages = nvuap->num_pages;
         }
-        nvamc->access_start = nvuap->access_start;
-        nvamc->access_size = nvuap->access_size;
-        nvamc->remap_prot_extra = nvuap->remap_prot_extra;
-    }
+        context.access_start = nvuap->access_start;
+        context.access_size = nvuap->access_size;
+        context.remap_prot_extra = nvuap->remap_prot_extra;
+        context.prot = prot;
+        context.valid = NV_TRUE;
+        context.caching = nvuap->caching;
 
-    nvamc->prot = prot;
-    nvamc->valid = NV_TRUE;
-    nvamc->caching = nvuap->caching;
+        if (!nvamc->valid)
+        {
+            /* First allowance on this descriptor: single-slot protocol. */
+            *nvamc = context;
+        }
+        else
+        {
+            /*
+             * The slot is already occupied: index the additional
+             * allowance in the per-fd interval tree instead of failing
+             * with NV_ERR_STATE_IN_USE. This lets userspace validate
+             * many ranges up front and mmap() them later in any order,
+             * identified by file offset.
+             */
+            status = nv_mmap_context_tree_insert(nvlfp, &context);
+        }
+    }
 
 done:
     nv_put_file_private(priv);
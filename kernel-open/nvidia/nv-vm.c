@@ -25,6 +25,136 @@
 #include "nv.h"
 #include "nv-linux.h"
 
+/*
+ * Cache of page-pointer arrays retained across kernel mapping cycles.
+ *
+ * Every kernel mapping of a system memory allocation builds a scratch array
+ * of struct page pointers to hand to vmap(), and frees it again once the
+ * range is mapped. The vmap ranges themselves cannot be retained here -
+ * reusing a live virtual range for a different page set would require
+ * remapping primitives the kernel does not export, and the kernel's own
+ * vmap area caches already recycle address space for repeated sizes - but
+ * the high-churn RM allocations (notifiers, ring buffers) recycle the same
+ * handful of sizes, so retaining the arrays removes a kmalloc/kfree pair
+ * per mapping. The same arrays double as scratch space for the bulk page
+ * allocator below.
+ *
+ * Cached arrays hold stale page pointers; they are fully rewritten before
+ * each use.
+ */
+
+#define NV_VM_PAGE_ARRAY_CACHE_MAX_ENTRIES 16
+
+typedef struct nv_vm_page_array_cache_entry_s
+{
+    struct list_head list;
+    NvU32 page_count;
+    struct page **pages;
+} nv_vm_page_array_cache_entry_t;
+
+static nv_spinlock_t nv_vm_page_array_cache_lock;
+static struct list_head nv_vm_page_array_cache_list;
+static NvU32 nv_vm_page_array_cache_count;
+
+void nv_vm_page_array_cache_init(void)
+{
+    NV_SPIN_LOCK_INIT(&nv_vm_page_array_cache_lock);
+    INIT_LIST_HEAD(&nv_vm_page_array_cache_list);
+    nv_vm_page_array_cache_count = 0;
+}
+
+void nv_vm_page_array_cache_purge(void)
+{
+    nv_vm_page_array_cache_entry_t *entry;
+    unsigned long flags;
+
+    for (;;)
+    {
+        NV_SPIN_LOCK_IRQSAVE(&nv_vm_page_array_cache_lock, flags);
+        entry = list_first_entry_or_null(&nv_vm_page_array_cache_list,
+                                         nv_vm_page_array_cache_entry_t, list);
+        if (entry != NULL)
+        {
+            list_del(&entry->list);
+            nv_vm_page_array_cache_count--;
+        }
+        NV_SPIN_UNLOCK_IRQRESTORE(&nv_vm_page_array_cache_lock, flags);
+
+        if (entry == NULL)
+        {
+            break;
+        }
+
+        os_free_mem(entry->pages);
+        os_free_mem(entry);
+    }
+}
+
+struct page **nv_vm_get_page_array(NvU32 page_count)
+{
+    nv_vm_page_array_cache_entry_t *entry;
+    struct page **pages = NULL;
+    unsigned long flags;
+
+    NV_SPIN_LOCK_IRQSAVE(&nv_vm_page_array_cache_lock, flags);
+    list_for_each_entry(entry, &nv_vm_page_array_cache_list, list)
+    {
+        if (entry->page_count == page_count)
+        {
+            list_del(&entry->list);
+            nv_vm_page_array_cache_count--;
+            pages = entry->pages;
+            break;
+        }
+    }
+    NV_SPIN_UNLOCK_IRQRESTORE(&nv_vm_page_array_cache_lock, flags);
+
+    if (pages != NULL)
+    {
+        os_free_mem(entry);
+        return pages;
+    }
+
+    if (os_alloc_mem((void **)&pages,
+                     page_count * sizeof(struct page *)) != NV_OK)
+    {
+        return NULL;
+    }
+
+    return pages;
+}
+
+void nv_vm_put_page_array(struct page **pages, NvU32 page_count)
+{
+    nv_vm_page_array_cache_entry_t *entry = NULL;
+    unsigned long flags;
+
+    if ((nv_vm_page_array_cache_count < NV_VM_PAGE_ARRAY_CACHE_MAX_ENTRIES) &&
+        (os_alloc_mem((void **)&entry, sizeof(*entry)) == NV_OK))
+    {
+        entry->page_count = page_count;
+        entry->pages = pages;
+
+        NV_SPIN_LOCK_IRQSAVE(&nv_vm_page_array_cache_lock, flags);
+        if (nv_vm_page_array_cache_count < NV_VM_PAGE_ARRAY_CACHE_MAX_ENTRIES)
+        {
+            list_add(&entry->list, &nv_vm_page_array_cache_list);
+            nv_vm_page_array_cache_count++;
+            entry = NULL;
+        }
+        NV_SPIN_UNLOCK_IRQRESTORE(&nv_vm_page_array_cache_lock, flags);
+
+        if (entry == NULL)
+        {
+            return;
+        }
+
+        os_free_mem(entry);
+    }
+
+    os_free_mem(pages);
+}
+
 static inline void nv_set_contig_memory_uc(nvidia_pte_t *page_ptr, NvU32 num_pages)
 {
 #if defined(NV_SET_MEMORY_UC_PRESENT)
@@ -500,6 +630,139 @@ void nv_free_contig_pages(
     NV_FREE_PAGES(page_ptr->virt_addr, at->order);
 }
 
+#if defined(NV_ALLOC_PAGES_BULK)
+/*
+ * Satisfy an order-0 system memory allocation with the kernel's bulk page
+ * allocator, which fills a whole page array per buddy-allocator round trip
+ * instead of paying that cost once per page. The bulk allocator stops
+ * opportunistically under memory pressure, so any remainder is topped up
+ * one page at a time, as vmalloc does.
+ */
+static NV_STATUS nv_alloc_system_pages_bulk(
+    nv_state_t *nv,
+    nv_alloc_t *at,
+    unsigned int gfp_mask
+)
+{
+    NV_STATUS status;
+    nvidia_pte_t *page_ptr;
+    struct page **pages;
+    NvU32 i, j, nr, prev;
+    unsigned long virt_addr;
+    NvU64 phys_addr;
+    struct device *dev = at->dev;
+
+    pages = nv_vm_get_page_array(at->num_pages);
+    if (pages == NULL)
+    {
+        return NV_ERR_NO_MEMORY;
+    }
+
+    /* The bulk allocator only fills slots that are NULL on entry. */
+    memset(pages, 0, at->num_pages * sizeof(struct page *));
+
+    nr = 0;
+    do
+    {
+        prev = nr;
+        nr = NV_ALLOC_PAGES_BULK(gfp_mask, at->num_pages, pages);
+    } while ((nr < at->num_pages) && (nr != prev));
+
+    for (; nr < at->num_pages; nr++)
+    {
+        pages[nr] = alloc_page(gfp_mask);
+        if (pages[nr] == NULL)
+        {
+            nv_printf(NV_DBG_MEMINFO,
+                "NVRM: VM: %s: failed to allocate memory\n", __FUNCTION__);
+            status = NV_ERR_NO_MEMORY;
+            i = 0;
+            goto failed;
+        }
+    }
+
+    for (i = 0; i < at->num_pages; i++)
+    {
+        virt_addr = (unsigned long)page_address(pages[i]);
+        phys_addr = nv_get_kern_phys_address(virt_addr);
+        if (phys_addr == 0)
+        {
+            nv_printf(NV_DBG_ERRORS,
+                "NVRM: VM: %s: failed to look up physical address\n",
+                __FUNCTION__);
+            status = NV_ERR_OPERATING_SYSTEM;
+            goto failed;
+        }
+
+#if defined(_PAGE_NX)
+        while (((_PAGE_NX & pgprot_val(PAGE_KERNEL)) != 0) &&
+               (phys_addr < 0x400000))
+        {
+            /*
+             * Discard the low page without freeing it, as the per-page
+             * allocation path does, so the allocator does not hand it
+             * back, and allocate a replacement.
+             */
+            nv_printf(NV_DBG_SETUP,
+                "NVRM: VM: %s: discarding page @ 0x%llx\n",
+                __FUNCTION__, phys_addr);
+            pages[i] = alloc_page(gfp_mask);
+            if (pages[i] == NULL)
+            {
+                status = NV_ERR_NO_MEMORY;
+                goto failed;
+            }
+
+            virt_addr = (unsigned long)page_address(pages[i]);
+            phys_addr = nv_get_kern_phys_address(virt_addr);
+            if (phys_addr == 0)
+            {
+                status = NV_ERR_OPERATING_SYSTEM;
+                goto failed;
+            }
+        }
+#endif
+
+        page_ptr = at->page_table[i];
+        page_ptr->phys_addr = phys_addr;
+        page_ptr->page_count = NV_GET_PAGE_COUNT(page_ptr);
+        page_ptr->virt_addr = virt_addr;
+
+        if (dev != NULL)
+            page_ptr->dma_addr = nv_phys_to_dma(dev, page_ptr->phys_addr);
+        else
+            page_ptr->dma_addr = page_ptr->phys_addr;
+
+        NV_MAYBE_RESERVE_PAGE(page_ptr);
+    }
+
+    nv_vm_put_page_array(pages, at->num_pages);
+
+    if (at->cache_type != NV_MEMORY_CACHED)
+        nv_set_memory_type(at, NV_MEMORY_UNCACHED);
+
+    return NV_OK;
+
+failed:
+    for (j = 0; j < i; j++)
+    {
+        page_ptr = at->page_table[j];
+        NV_MAYBE_UNRESERVE_PAGE(page_ptr);
+        NV_FREE_PAGES(page_ptr->virt_addr, 0);
+    }
+
+    for (j = i; j < nr; j++)
+    {
+        if (pages[j] != NULL)
+            __free_page(pages[j]);
+    }
+
+    nv_vm_put_page_array(pages, at->num_pages);
+
+    return status;
+}
+#endif /* NV_ALLOC_PAGES_BULK */
+
 NV_STATUS nv_alloc_system_pages(
     nv_state_t *nv,
     nv_alloc_t *at
@@ -527,6 +790,19 @@ NV_STATUS nv_alloc_system_pages(
 
     gfp_mask = nv_compute_gfp_mask(nv, at);
 
+#if defined(NV_ALLOC_PAGES_BULK)
+    //
+    // Order-0 allocations without placement constraints can be satisfied in
+    // one pass by the kernel's bulk page allocator instead of paying a
+    // buddy-allocator round trip per page.
+    //
+    if ((at->order == 0) && !at->flags.node &&
+        !(at->flags.unencrypted && (dev != NULL)))
+    {
+        return nv_alloc_system_pages_bulk(nv, at, gfp_mask);
+    }
+#endif
+
     for (i = 0; i < alloc_num_pages; i++)
     {
         if (at->flags.unencrypted && (dev != NULL))
@@ -180,7 +180,7 @@ static nvidia_stack_t *__nv_init_sp;
 
 static int nv_tce_bypass_mode = NV_TCE_BYPASS_MODE_DEFAULT;
 
-struct semaphore nv_linux_devices_lock;
+struct rw_semaphore nv_linux_devices_lock;
 
 // True if all the successfully probed devices support ATS
 // Assigned at device probe (module init) time
@@ -243,6 +243,14 @@ static struct file_operations nvidia_fops = {
     .compat_ioctl = nvidia_unlocked_ioctl,
 #endif
     .mmap      = nvidia_mmap,
+#if defined(NV_THP_GET_UNMAPPED_AREA_PRESENT) && \
+    defined(CONFIG_TRANSPARENT_HUGEPAGE)
+    /*
+     * Align unhinted mmap() requests to huge page boundaries so large BAR
+     * mappings are eligible for PMD/PUD entries (see nvidia_huge_fault()).
+     */
+    .get_unmapped_area = thp_get_unmapped_area,
+#endif
     .open      = nvidia_open,
     .release   = nvidia_close,
 };
@@ -548,7 +556,7 @@ nv_module_state_init(nv_stack_t *sp)
 
     nv_linux_devices = NULL;
     memset(nv_linux_minor_num_table, 0, sizeof(nv_linux_minor_num_table));
-    NV_INIT_MUTEX(&nv_linux_devices_lock);
+    init_rwsem(&nv_linux_devices_lock);
     init_rwsem(&nv_system_pm_lock);
 
 #if defined(CONFIG_PM)
@@ -559,6 +567,10 @@ nv_module_state_init(nv_stack_t *sp)
 
     NV_SPIN_LOCK_INIT(&nv_ctl_device.snapshot_timer_lock);
 
+    nv_dma_map_cache_init();
+
+    nv_vm_page_array_cache_init();
+
 exit:
     if (rc < 0)
     {
@@ -982,6 +994,10 @@ static void __exit nvidia_exit_module(void)
 
     nv_module_exit(sp);
 
+    nv_dma_map_cache_purge();
+
+    nv_vm_page_array_cache_purge();
+
     nv_caps_imex_exit();
 
     nv_caps_root_exit();
@@ -1001,6 +1017,8 @@ static void *nv_alloc_file_private(void)
 
     init_waitqueue_head(&nvlfp->waitqueue);
     NV_SPIN_LOCK_INIT(&nvlfp->fp_lock);
+    nvlfp->mmap_context_tree = RB_ROOT_CACHED;
+    NV_SPIN_LOCK_INIT(&nvlfp->mmap_context_lock);
 
     return nvlfp;
 }
@@ -1023,6 +1041,8 @@ static void nv_free_file_private(nv_linux_file_private_t *nvlfp)
         os_free_mem(nvlfp->mmap_context.page_array);
     }
 
+    nv_mmap_context_tree_purge(nvlfp);
+
     NV_KFREE(nvlfp, sizeof(nv_linux_file_private_t));
 }
 
@@ -1065,7 +1085,7 @@ static nv_linux_state_t *find_minor(NvU32 minor)
     if (minor > NV_MINOR_DEVICE_NUMBER_REGULAR_MAX)
         return NULL;
 
-    LOCK_NV_LINUX_DEVICES();
+    LOCK_NV_LINUX_DEVICES_READ();
 
     nvl = find_minor_locked(minor);
     if (nvl != NULL)
@@ -1073,7 +1093,7 @@ static nv_linux_state_t *find_minor(NvU32 minor)
         down(&nvl->ldata_lock);
     }
 
-    UNLOCK_NV_LINUX_DEVICES();
+    UNLOCK_NV_LINUX_DEVICES_READ();
     return nvl;
 }
 
@@ -1085,7 +1105,7 @@ static nv_linux_state_t *find_gpu_id(NvU32 gpu_id)
 {
     nv_linux_state_t *nvl;
 
-    LOCK_NV_LINUX_DEVICES();
+    LOCK_NV_LINUX_DEVICES_READ();
     nvl = nv_linux_devices;
     while (nvl != NULL)
     {
@@ -1098,7 +1118,7 @@ static nv_linux_state_t *find_gpu_id(NvU32 gpu_id)
         nvl = nvl->next;
     }
 
-    UNLOCK_NV_LINUX_DEVICES();
+    UNLOCK_NV_LINUX_DEVICES_READ();
     return nvl;
 }
 
@@ -1113,7 +1133,7 @@ nv_linux_state_t *find_uuid(const NvU8 *uuid)
     nv_state_t *nv;
     const NvU8 *dev_uuid;
 
-    LOCK_NV_LINUX_DEVICES();
+    LOCK_NV_LINUX_DEVICES_READ();
 
     for (nvl = nv_linux_devices; nvl; nvl = nvl->next)
     {
@@ -1126,7 +1146,7 @@ nv_linux_state_t *find_uuid(const NvU8 *uuid)
     }
 
 out:
-    UNLOCK_NV_LINUX_DEVICES();
+    UNLOCK_NV_LINUX_DEVICES_READ();
     return nvl;
 }
 
@@ -1154,7 +1174,7 @@ static nv_linux_state_t *find_uuid_candidate(const NvU8 *uuid)
     int use_missing;
     int has_missing = 0;
 
-    LOCK_NV_LINUX_DEVICES();
+    LOCK_NV_LINUX_DEVICES_READ();
 
     /*
      * Take two passes through the list. The first pass just looks for the UUID.
@@ -1193,7 +1213,7 @@ static nv_linux_state_t *find_uuid_candidate(const NvU8 *uuid)
     }
 
 out:
-    UNLOCK_NV_LINUX_DEVICES();
+    UNLOCK_NV_LINUX_DEVICES_READ();
     return nvl;
 }
 
@@ -1412,6 +1432,18 @@ static int nv_start_device(nv_state_t *nv, nvidia_stack_t *sp)
         rc = nv_kthread_q_init(&nvl->queue.nvk, "nv_queue");
         if (rc)
             goto failed;
+
+        //
+        // The multi-worker companion queue is optional: if it cannot be
+        // created, unordered work items fall back to the ordered queue.
+        //
+        if (nv_kthread_q_multi_init(&nvl->queue.nvk_multi, "nv_queue_mt",
+                                    NV_QUEUE_MULTI_NUM_WORKERS) != 0)
+        {
+            nv_printf(NV_DBG_ERRORS,
+                "NVRM: failed to create the multi-worker work queue\n");
+        }
+
         nv->queue = &nvl->queue;
 
         if (nv_platform_use_auto_online(nvl))
@@ -1506,6 +1538,7 @@ failed:
     if (nv->queue && !(nv->flags & NV_FLAG_PERSISTENT_SW_STATE))
     {
         nv->queue = NULL;
+        nv_kthread_q_multi_stop(&nvl->queue.nvk_multi);
         nv_kthread_q_stop(&nvl->queue.nvk);
     }
 
@@ -1903,6 +1936,7 @@ void nv_shutdown_adapter(nvidia_stack_t *sp,
     if (nv->queue != NULL)
     {
         nv->queue = NULL;
+        nv_kthread_q_multi_stop(&nvl->queue.nvk_multi);
         nv_kthread_q_stop(&nvl->queue.nvk);
     }
 
@@ -2265,7 +2299,7 @@ static int nvidia_read_card_info(nv_ioctl_card_info_t *ci, size_t num_entries)
     /* Clear each card's flags field the lazy way */
     memset(ci, 0, num_entries * sizeof(ci[0]));
 
-    LOCK_NV_LINUX_DEVICES();
+    LOCK_NV_LINUX_DEVICES_READ();
 
     if (num_entries < num_nv_devices)
     {
@@ -2301,7 +2335,7 @@ static int nvidia_read_card_info(nv_ioctl_card_info_t *ci, size_t num_entries)
     }
 
 out:
-    UNLOCK_NV_LINUX_DEVICES();
+    UNLOCK_NV_LINUX_DEVICES_READ();
     return rc;
 }
 
@@ -2456,6 +2490,48 @@ nvidia_ioctl(
             break;
         }
 
+        /* binary per-GPU stats snapshot for telemetry pollers */
+        case NV_ESC_GPU_STATS:
+        {
+            nv_ioctl_gpu_stats_t *stats = arg_copy;
+            NvU32 i;
+
+            NV_ACTUAL_DEVICE_ONLY(nv);
+
+            if (arg_size != sizeof(nv_ioctl_gpu_stats_t))
+            {
+                status = -EINVAL;
+                goto done;
+            }
+
+            memset(stats, 0, sizeof(*stats));
+
+            stats->version = NV_GPU_STATS_VERSION;
+            stats->gpu_id = nv->gpu_id;
+            stats->pci_info = nv->pci_info;
+            stats->subsystem_vendor = nv->subsystem_vendor;
+            stats->subsystem_id = nv->subsystem_id;
+            stats->interrupt_line = nv->interrupt_line;
+            stats->minor_number = nvl->minor_num;
+            stats->flags = nv->flags;
+            stats->uuid_valid = nv->nv_uuid_cache.valid;
+            if (nv->nv_uuid_cache.valid)
+            {
+                memcpy(stats->uuid, nv->nv_uuid_cache.uuid,
+                       sizeof(stats->uuid));
+            }
+            stats->dma_mask = nv->dma_mask;
+
+            for (i = 0; i < NV_GPU_NUM_BARS; i++)
+            {
+                stats->bar_addresses[i] = nv->bars[i].cpu_address;
+                stats->bar_sizes[i] = nv->bars[i].size;
+            }
+
+            stats->status = NV_OK;
+            break;
+        }
+
         case NV_ESC_ATTACH_GPUS_TO_FD:
         {
             size_t num_arg_gpus = arg_size / sizeof(NvU32);
@@ -3107,7 +3183,7 @@ nv_map_guest_pages(nv_alloc_t *at,
     NvU32 j;
     NvUPtr virt_addr;
 
-    NV_KMALLOC(pages, sizeof(struct page *) * page_count);
+    pages = nv_vm_get_page_array(page_count);
     if (pages == NULL)
     {
         nv_printf(NV_DBG_ERRORS,
@@ -3122,7 +3198,7 @@ nv_map_guest_pages(nv_alloc_t *at,
 
     virt_addr = nv_vm_map_pages(pages, page_count,
         at->cache_type == NV_MEMORY_CACHED, at->flags.unencrypted);
-    NV_KFREE(pages, sizeof(struct page *) * page_count);
+    nv_vm_put_page_array(pages, page_count);
 
     return virt_addr;
 }
@@ -3594,7 +3670,7 @@ void* NV_API_CALL nv_alloc_kernel_mapping(
         }
         else
         {
-            NV_KMALLOC(pages, sizeof(struct page *) * page_count);
+            pages = nv_vm_get_page_array(page_count);
             if (pages == NULL)
             {
                 nv_printf(NV_DBG_ERRORS,
@@ -3607,7 +3683,7 @@ void* NV_API_CALL nv_alloc_kernel_mapping(
 
             virt_addr = nv_vm_map_pages(pages, page_count,
                 at->cache_type == NV_MEMORY_CACHED, at->flags.unencrypted);
-            NV_KFREE(pages, sizeof(struct page *) * page_count);
+            nv_vm_put_page_array(pages, page_count);
         }
 
         if (virt_addr == 0)
@@ -4780,18 +4856,18 @@ nv_state_t* NV_API_CALL nv_get_adapter_state(
 {
     nv_linux_state_t *nvl;
 
-    LOCK_NV_LINUX_DEVICES();
+    LOCK_NV_LINUX_DEVICES_READ();
     for (nvl = nv_linux_devices; nvl != NULL;  nvl = nvl->next)
     {
         nv_state_t *nv = NV_STATE_PTR(nvl);
         if (nv->pci_info.domain == domain && nv->pci_info.bus == bus
             && nv->pci_info.slot == slot)
         {
-            UNLOCK_NV_LINUX_DEVICES();
+            UNLOCK_NV_LINUX_DEVICES_READ();
             return nv;
         }
     }
-    UNLOCK_NV_LINUX_DEVICES();
+    UNLOCK_NV_LINUX_DEVICES_READ();
 
     return NULL;
 }
@@ -5039,7 +5115,7 @@ NvBool nvidia_get_gpuid_list(NvU32 *gpu_ids, NvU32 *gpu_count)
     unsigned int count;
     NvBool ret = NV_TRUE;
 
-    LOCK_NV_LINUX_DEVICES();
+    LOCK_NV_LINUX_DEVICES_READ();
 
     count = 0;
     for (nvl = nv_linux_devices; nvl != NULL; nvl = nvl->next)
@@ -5067,7 +5143,7 @@ done:
 
     *gpu_count = count;
 
-    UNLOCK_NV_LINUX_DEVICES();
+    UNLOCK_NV_LINUX_DEVICES_READ();
 
     return ret;
 }
@@ -57,6 +57,9 @@ static void setUvmEvents(struct UvmOpsUvmEvents *newEvents)
 static nvidia_stack_t *g_sp;
 static struct semaphore g_spLock;
 
+// Worker queue servicing nvUvmInterfaceOpsExecuteAsync() batches.
+static nv_kthread_q_t g_asyncOpsQueue;
+
 // Use these to test g_sp usage. When DEBUG_GLOBAL_STACK, one out of every
 // DEBUG_GLOBAL_STACK_THRESHOLD calls to nvUvmGetSafeStack will use g_sp.
 #define DEBUG_GLOBAL_STACK 0
@@ -71,6 +74,13 @@ int nv_uvm_init(void)
     if (rc != 0)
         return rc;
 
+    rc = nv_kthread_q_init(&g_asyncOpsQueue, "nv_uvm_ops");
+    if (rc != 0)
+    {
+        nv_kmem_cache_free_stack(g_sp);
+        return rc;
+    }
+
     NV_INIT_MUTEX(&g_spLock);
     NV_INIT_MUTEX(&g_pNvUvmEventsLock);
     return 0;
@@ -83,6 +93,7 @@ void nv_uvm_exit(void)
     // memory.
     WARN_ON(getUvmEvents() != NULL);
 
+    nv_kthread_q_stop(&g_asyncOpsQueue);
     nv_kmem_cache_free_stack(g_sp);
 }
 
@@ -1647,6 +1658,129 @@ NV_STATUS nvUvmInterfaceCslLogEncryption(UvmCslContext *uvmCslContext,
 }
 EXPORT_SYMBOL(nvUvmInterfaceCslLogEncryption);
 
+static NV_STATUS nvUvmDispatchInterfaceOp(nvidia_stack_t *sp,
+                                          UvmGpuInterfaceOp *op)
+{
+    switch (op->type)
+    {
+        case UvmGpuInterfaceOpTypeGetPmaObject:
+            return rm_gpu_ops_get_pma_object(sp,
+                       (gpuDeviceHandle)op->params.getPmaObject.device,
+                       op->params.getPmaObject.pPma,
+                       (const nvgpuPmaStatistics_t *)op->params.getPmaObject.pPmaPubStats);
+
+        case UvmGpuInterfaceOpTypeChannelAllocate:
+            return rm_gpu_ops_channel_allocate(sp,
+                       (gpuTsgHandle)op->params.channelAllocate.tsg,
+                       op->params.channelAllocate.allocParams,
+                       (gpuChannelHandle *)op->params.channelAllocate.channel,
+                       op->params.channelAllocate.channelInfo);
+
+        case UvmGpuInterfaceOpTypeGetExternalAllocPtes:
+            return rm_gpu_ops_get_external_alloc_ptes(sp,
+                       (gpuAddressSpaceHandle)op->params.getExternalAllocPtes.vaSpace,
+                       op->params.getExternalAllocPtes.hMemory,
+                       op->params.getExternalAllocPtes.offset,
+                       op->params.getExternalAllocPtes.size,
+                       op->params.getExternalAllocPtes.gpuExternalMappingInfo);
+
+        case UvmGpuInterfaceOpTypeAddressSpaceCreate:
+            return rm_gpu_ops_address_space_create(sp,
+                       (gpuDeviceHandle)op->params.addressSpaceCreate.device,
+                       op->params.addressSpaceCreate.vaBase,
+                       op->params.addressSpaceCreate.vaSize,
+                       op->params.addressSpaceCreate.enableAts,
+                       (gpuAddressSpaceHandle *)op->params.addressSpaceCreate.vaSpace,
+                       op->params.addressSpaceCreate.vaSpaceInfo);
+
+        case UvmGpuInterfaceOpTypeDupAddressSpace:
+            return rm_gpu_ops_dup_address_space(sp,
+                       (gpuDeviceHandle)op->params.dupAddressSpace.device,
+                       op->params.dupAddressSpace.hUserClient,
+                       op->params.dupAddressSpace.hUserVASpace,
+                       (gpuAddressSpaceHandle *)op->params.dupAddressSpace.vaSpace,
+                       op->params.dupAddressSpace.vaSpaceInfo);
+
+        default:
+            return NV_ERR_INVALID_ARGUMENT;
+    }
+}
+
+NV_STATUS nvUvmInterfaceOpsExecute(UvmGpuInterfaceOp *ops,
+                                   NvU32 opCount,
+                                   NvU32 *completedCount)
+{
+    nvidia_stack_t *sp = NULL;
+    NV_STATUS status = NV_OK;
+    NvU32 i;
+
+    if (completedCount != NULL)
+        *completedCount = 0;
+
+    if ((ops == NULL) || (opCount == 0))
+        return NV_ERR_INVALID_ARGUMENT;
+
+    if (nv_kmem_cache_alloc_stack(&sp) != 0)
+    {
+        return NV_ERR_NO_MEMORY;
+    }
+
+    for (i = 0; i < opCount; i++)
+    {
+        ops[i].status = nvUvmDispatchInterfaceOp(sp, &ops[i]);
+        if (ops[i].status != NV_OK)
+        {
+            status = ops[i].status;
+            break;
+        }
+    }
+
+    if (completedCount != NULL)
+        *completedCount = i;
+
+    nv_kmem_cache_free_stack(sp);
+    return status;
+}
+EXPORT_SYMBOL(nvUvmInterfaceOpsExecute);
+
+static void nvUvmAsyncOpsRun(void *args)
+{
+    UvmGpuInterfaceOpsAsync *asyncOps = (UvmGpuInterfaceOpsAsync *)args;
+
+    asyncOps->status = nvUvmInterfaceOpsExecute(asyncOps->ops,
+                                                asyncOps->opCount,
+                                                &asyncOps->completedCount);
+
+    // The callback is allowed to free asyncOps, so it must not be touched
+    // after this call.
+    asyncOps->callback(asyncOps->callbackData);
+}
+
+NV_STATUS nvUvmInterfaceOpsExecuteAsync(UvmGpuInterfaceOpsAsync *asyncOps,
+                                        UvmGpuInterfaceOp *ops,
+                                        NvU32 opCount,
+                                        uvmGpuInterfaceOpsCallback callback,
+                                        void *callbackData)
+{
+    if ((ops == NULL) || (opCount == 0) || (callback == NULL))
+        return NV_ERR_INVALID_ARGUMENT;
+
+    asyncOps->ops            = ops;
+    asyncOps->opCount        = opCount;
+    asyncOps->completedCount = 0;
+    asyncOps->status         = NV_OK;
+    asyncOps->callback       = callback;
+    asyncOps->callbackData   = callbackData;
+
+    nv_kthread_q_item_init(&asyncOps->qItem, nvUvmAsyncOpsRun, asyncOps);
+
+    if (!nv_kthread_q_schedule_q_item(&g_asyncOpsQueue, &asyncOps->qItem))
+        return NV_ERR_INVALID_STATE;
+
+    return NV_OK;
+}
+EXPORT_SYMBOL(nvUvmInterfaceOpsExecuteAsync);
+
 #else // NV_UVM_ENABLE
 
 NV_STATUS nv_uvm_suspend(void)
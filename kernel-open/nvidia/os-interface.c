@@ -1173,6 +1173,33 @@ NV_STATUS NV_API_CALL os_queue_work_item(struct os_work_queue *queue, void *data
     return NV_OK;
 }
 
+NV_STATUS NV_API_CALL os_queue_work_item_unordered(struct os_work_queue *queue, void *data)
+{
+    os_queue_data_t *oqd;
+
+    /*
+     * Items with no ordering requirement relative to the rest of the queue
+     * run on the queue's multi-worker threads, so they don't serialize
+     * behind unrelated deferred work. Fall back to the ordered queue when
+     * no multi-worker queue is available (system work items, or a failed
+     * multi-worker init).
+     */
+    if (!queue || (queue->nvk_multi.num_workers == 0))
+        return os_queue_work_item(queue, data);
+
+    /* Allocate atomically just in case we're called in atomic context. */
+    NV_KMALLOC_ATOMIC(oqd, sizeof(os_queue_data_t));
+    if (!oqd)
+        return NV_ERR_NO_MEMORY;
+
+    nv_kthread_q_item_init(&oqd->item, os_execute_work_item, oqd);
+    oqd->data = data;
+
+    nv_kthread_q_multi_schedule_q_item(&queue->nvk_multi, &oqd->item);
+
+    return NV_OK;
+}
+
 NV_STATUS NV_API_CALL os_flush_work_queue(struct os_work_queue *queue)
 {
     nv_kthread_q_t *kthread;
@@ -1185,6 +1212,9 @@ NV_STATUS NV_API_CALL os_flush_work_queue(struct os_work_queue *queue)
         if (kthread->q_kthread)
             nv_kthread_q_flush(kthread);
 
+        if (queue && (queue->nvk_multi.num_workers != 0))
+            nv_kthread_q_multi_flush(&queue->nvk_multi);
+
         return NV_OK;
     }
     else
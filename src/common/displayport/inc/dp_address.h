@@ -136,6 +136,19 @@ namespace DisplayPort
             hops--;
         }
 
+        //
+        //  Fold the path into a value suitable for bucketed lookup.
+        //  Ports are four bit values, so mix the size in as well to keep
+        //  addresses that are prefixes of one another apart.
+        //
+        unsigned hash() const
+        {
+            unsigned h = hops;
+            for (unsigned i = 0; i < hops; i++)
+                h = h * 31 + hop[i];
+            return h;
+        }
+
         // Just to keep clear copy
         Address & operator = (const Address & other)
         {
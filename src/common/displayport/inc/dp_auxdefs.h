@@ -50,6 +50,19 @@
 //
 #define DPCD_MESSAGE_REPLY_TIMEOUT              4000
 
+//
+//  The sideband message header carries a one bit Message_Sequence_No,
+//  so up to two down requests may be in flight per target address.
+//
+#define DPCD_MESSAGES_OUTSTANDING_PER_TARGET    2
+
+//
+//  How long an offline probe of the DPCD caps block stays valid.  The
+//  sideband busy-wait loops re-check for device presence every iteration;
+//  without a shadow the 16 byte probe read dominates the AUX traffic.
+//
+#define DPCD_OFFLINE_CACHE_LIFETIME             10  // 10ms
+
 #define DPCD_LINK_ADDRESS_MESSAGE_RETRIES       20  // 20 retries
 #define DPCD_LINK_ADDRESS_MESSAGE_COOLDOWN      10  // 10ms between attempts
 
@@ -38,15 +38,28 @@ namespace DisplayPort
 {
     enum
     {
-        minimumRetriesOnDefer = 7
+        minimumRetriesOnDefer = 7,
+        maximumRetriesOnDefer = 32
     };
 
     class AuxRetry
     {
         AuxBus * aux;
+
+        //
+        //  Running defer budget for this bus.  Devices on marginal cables
+        //  defer far more often than the default retry count assumes, so
+        //  remember how many defers recent transactions needed and grant at
+        //  least that much headroom next time.  Decays on clean transactions
+        //  so a transient glitch doesn't inflate the budget forever.
+        //
+        unsigned adaptiveRetriesOnDefer;
+
+        unsigned effectiveRetries(unsigned retries);
+        void recordDeferStatistics(unsigned defersSeen);
     public:
         AuxRetry(AuxBus * aux = 0)
-            : aux(aux)
+            : aux(aux), adaptiveRetriesOnDefer(minimumRetriesOnDefer)
         {
         }
 
@@ -180,6 +180,20 @@ namespace DisplayPort
         bool modesetOrderMitigation;
 
         List deviceList;
+
+        //
+        //  Address-keyed index over deviceList.  Every sideband message and
+        //  hotplug event resolves a device by RAD; with large MST topologies
+        //  the linear list walk shows up inside the timer driven message
+        //  pump, so keep hash buckets of devices chained through
+        //  DeviceImpl::hashNext alongside the list.
+        //
+        enum { deviceIndexBuckets = 32 };
+        DeviceImpl * deviceIndex[deviceIndexBuckets];
+
+        void deviceIndexInsert(DeviceImpl * dev);
+        void deviceIndexRemove(DeviceImpl * dev);
+
         List activeGroups;
         LinkedList<GroupImpl> intransitionGroups;
         LinkedList<GroupImpl> addStreamMSTIntransitionGroups;
@@ -315,6 +329,9 @@ namespace DisplayPort
         NvU32       maxLinkRateFromRegkey;
         bool        bFlushTimeslotWhenDirty;
 
+        // Sideband down request window per target; 0 keeps the built-in default.
+        NvU32       mstSidebandMessageWindow;
+
         //
         // Latency(ms) to apply between link-train and FEC enable for bug
         // 2561206.
@@ -562,6 +579,52 @@ namespace DisplayPort
         void setIgnoreSourceOuiHandshake(bool bIgnore);
         bool getIgnoreSourceOuiHandshake();
         bool willLinkSupportModeSST(const LinkConfiguration & linkConfig, const ModesetInfo & modesetInfo);
+
+        //
+        //  Memoized IMP results.  Mode search sweeps many candidate link
+        //  configurations over the same timings and the watermark math is a
+        //  pure function of its inputs, so repeated queries are answered
+        //  from a small per connector cache keyed by every input the
+        //  computation reads.
+        //
+        enum WatermarkVariant
+        {
+            DP_WATERMARK_SST,
+            DP_WATERMARK_SST_FEC,
+            DP_WATERMARK_MST,
+            DP_WATERMARK_MST_FEC,
+        };
+
+        enum { watermarkCacheEntries = 16 };
+
+        struct WatermarkCacheEntry
+        {
+            bool            valid;
+
+            // Key: variant plus every linkConfig/modesetInfo field the math reads
+            unsigned        variant;
+            bool            increasedWatermarkLimits;
+            unsigned        lanes;
+            NvU64           minRate;
+            NvU64           peakRate;
+            bool            enhancedFraming;
+            bool            bEnableFEC;
+            bool            multistream;
+            ModesetInfo     modesetInfo;
+
+            bool            possible;
+            Watermark       water;
+        };
+
+        WatermarkCacheEntry watermarkCache[watermarkCacheEntries];
+        unsigned            watermarkCacheNext;
+
+        bool isModePossibleCached(WatermarkVariant variant,
+                                  const LinkConfiguration & linkConfig,
+                                  const ModesetInfo & modesetInfo,
+                                  Watermark * dpInfo,
+                                  bool bUseIncreasedWatermarkLimits = false);
+
         void forceLinkTraining();
 
         void assessLink(LinkTrainingType trainType = NORMAL_LINK_TRAINING);
@@ -122,6 +122,12 @@ namespace DisplayPort
         ConnectorImpl   * connector;
         ConnectorType     connectorType;
         Address           address;
+
+        //
+        //  Next device in the connector's address index bucket.
+        //  Maintained by ConnectorImpl::deviceIndexInsert/Remove.
+        //
+        DeviceImpl      * hashNext;
         GUID              guid;
         GUID              guid2;
         bool              bVirtualPeerDevice;
@@ -233,6 +233,7 @@ namespace DisplayPort
 
             void detectCompleted(bool passed);
             void messageFailed(MessageManager::Message * from, NakData * nakData);
+            void handlePowerUpPhyDownReply();
             void handleRemoteDpcdReadDownReply();
             void handleRemoteDpcdWriteDownReply();
             void handleLinkAddressDownReply();
@@ -235,7 +235,7 @@ namespace DisplayPort
     //
     //  SST EDID Read API
     //
-    bool EdidReadSST(Edid & edid, AuxBus * aux, Timer * timer, bool pendingTestRequestEdidRead = false, bool bBypassAssembler = false, MainLink *main = NULL);
+    bool EdidReadSST(Edid & edid, AuxBus * aux, Timer * timer, bool pendingTestRequestEdidRead = false, bool bBypassAssembler = false, MainLink *main = NULL, const Edid * cachedEdid = NULL);
 
     enum EDID_DDC
     {
@@ -168,6 +168,15 @@ namespace DisplayPort
         //
         unsigned _rmPhyRepeaterCount;
 
+        //
+        // The UEFI trained max link config is fixed at boot.  Pay the
+        // provider round trip once and serve later queries (one per link
+        // assessment on UEFI systems, i.e. every display wake) from here.
+        //
+        bool _bUefiMaxLinkConfigCached;
+        NvU8 _uefiMaxLinkRate;
+        NvU8 _uefiMaxLaneCount;
+
         struct DSC
         {
             bool isDscSupported;
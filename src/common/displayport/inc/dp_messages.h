@@ -115,6 +115,7 @@ namespace DisplayPort
         DownReplyManager    mergerDownReply;
         bool                isBeingDestroyed;
         bool                isPaused;
+        unsigned            messageWindowPerTarget;   // Down requests kept in flight per target address
 
         List                messageReceivers;
         List                notYetSentDownRequest;    // Down Messages yet to be processed
@@ -139,6 +140,22 @@ namespace DisplayPort
             isPaused = true;
         }
 
+        //
+        // Bound the number of down requests pipelined to one target address.
+        // The protocol limit is DPCD_MESSAGES_OUTSTANDING_PER_TARGET; a
+        // window of 1 serializes messaging for branches that mishandle
+        // pipelined requests.
+        //
+        void setMessageWindowPerTarget(unsigned window)
+        {
+            if (window < 1)
+                window = 1;
+            else if (window > DPCD_MESSAGES_OUTSTANDING_PER_TARGET)
+                window = DPCD_MESSAGES_OUTSTANDING_PER_TARGET;
+
+            messageWindowPerTarget = window;
+        }
+
         void clearPendingMsg()
         {
             hal->clearPendingMsg();
@@ -159,7 +176,8 @@ namespace DisplayPort
             splitterUpReply(hal, timer),
             mergerUpRequest(hal, timer, Address(0), this),
             mergerDownReply(hal, timer, Address(0), this),
-            isBeingDestroyed(false), isPaused(false)
+            isBeingDestroyed(false), isPaused(false),
+            messageWindowPerTarget(DPCD_MESSAGES_OUTSTANDING_PER_TARGET)
         {
         }
 
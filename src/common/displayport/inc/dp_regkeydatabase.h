@@ -85,6 +85,13 @@
 #define NV_DP_REGKEY_FORCE_DSC_ON_SINK                 "DP_FORCE_DSC_ON_SINK"
 #define NV_DP_REGKEY_ENABLE_SKIP_DPCD_READS_WAR        "DP_BUG_4478047_WAR"
 
+//
+// Number of sideband down requests kept in flight per target address.
+// 0 leaves the default (DPCD_MESSAGES_OUTSTANDING_PER_TARGET); 1 restores
+// fully serialized messaging for branch devices that mishandle pipelining.
+//
+#define NV_DP_REGKEY_MST_SIDEBAND_MESSAGE_WINDOW       "DP_MST_SIDEBAND_MESSAGE_WINDOW"
+
 //
 // Data Base used to store all the regkey values.
 // The actual data base is declared statically in dp_evoadapter.cpp.
@@ -122,6 +129,7 @@ struct DP_REGKEY_DATABASE
     bool  bForceDscOnSink;
     bool  bSkipFakeDeviceDpcdAccess;
     bool  bFlushTimeslotWhenDirty;
+    NvU32 mstSidebandMessageWindow;
 };
 
 #endif //INCLUDED_DP_REGKEYDATABASE_H
@@ -90,6 +90,24 @@ namespace DisplayPort
            bEnableDsc(newBEnableDsc),
            mode(newMode),
            bEnablePassThroughForPCON(newBEnablePassThroughForPCON) {}
+
+        bool operator == (const ModesetInfo & other) const
+        {
+            return twoChannelAudioHz == other.twoChannelAudioHz &&
+                   eightChannelAudioHz == other.eightChannelAudioHz &&
+                   pixelClockHz == other.pixelClockHz &&
+                   rasterWidth == other.rasterWidth &&
+                   rasterHeight == other.rasterHeight &&
+                   surfaceWidth == other.surfaceWidth &&
+                   surfaceHeight == other.surfaceHeight &&
+                   depth == other.depth &&
+                   rasterBlankStartX == other.rasterBlankStartX &&
+                   rasterBlankEndX == other.rasterBlankEndX &&
+                   bitsPerComponent == other.bitsPerComponent &&
+                   bEnableDsc == other.bEnableDsc &&
+                   mode == other.mode &&
+                   bEnablePassThroughForPCON == other.bEnablePassThroughForPCON;
+        }
     };
 
     struct Watermark
@@ -36,6 +36,45 @@
 
 using namespace DisplayPort;
 
+//
+//    Raise the caller's retry count to the adaptive budget earned by
+//    this bus's recent defer behavior.
+//
+unsigned AuxRetry::effectiveRetries(unsigned retries)
+{
+    return retries > adaptiveRetriesOnDefer ? retries : adaptiveRetriesOnDefer;
+}
+
+//
+//    Fold the defer count of a completed transaction into the budget.
+//
+void AuxRetry::recordDeferStatistics(unsigned defersSeen)
+{
+    if (defersSeen == 0)
+    {
+        //
+        //    Clean transaction: decay toward the default budget.
+        //
+        if (adaptiveRetriesOnDefer > minimumRetriesOnDefer)
+            --adaptiveRetriesOnDefer;
+
+        return;
+    }
+
+    //
+    //    Grant twice what this transaction needed so the next one doesn't
+    //    run out right at the edge, bounded to keep worst-case transaction
+    //    time sane.
+    //
+    unsigned wanted = 2 * defersSeen;
+
+    if (wanted > maximumRetriesOnDefer)
+        wanted = maximumRetriesOnDefer;
+
+    if (wanted > adaptiveRetriesOnDefer)
+        adaptiveRetriesOnDefer = wanted;
+}
+
 //
 //    Read a DPCD address.
 //        - allows size greater than single transaction/burst size
@@ -45,10 +84,13 @@ using namespace DisplayPort;
 AuxRetry::status AuxRetry::readTransaction(int address, NvU8 * buffer, unsigned size, unsigned retries)
 {
     unsigned completed;
+    unsigned defersSeen = 0;
     AuxBus::status s;
 
     DP_ASSERT( size <= aux->transactionSize() );
 
+    retries = effectiveRetries(retries);
+
     do
     {
         s = aux->transaction(AuxBus::read, AuxBus::native, address, buffer, size, &completed);
@@ -59,6 +101,7 @@ AuxRetry::status AuxRetry::readTransaction(int address, NvU8 * buffer, unsigned
         //
         if ((s == AuxBus::success) && (completed == size) && (completed != 0))
         {
+            recordDeferStatistics(defersSeen);
             return ack;
         }
         else
@@ -68,12 +111,15 @@ AuxRetry::status AuxRetry::readTransaction(int address, NvU8 * buffer, unsigned
             //
             if (s == AuxBus::defer)
             {
+                ++defersSeen;
+
                 if (retries)
                 {
                     --retries;
                     continue;
                 }
 
+                recordDeferStatistics(defersSeen);
                 return defer;
             }
 
@@ -118,6 +164,8 @@ AuxRetry::status AuxRetry::readTransaction(int address, NvU8 * buffer, unsigned
         }
     } while(retries);
 
+    recordDeferStatistics(defersSeen);
+
     if ((s == AuxBus::defer) || (completed < size))
     {
         return defer;
@@ -135,10 +183,13 @@ AuxRetry::status AuxRetry::readTransaction(int address, NvU8 * buffer, unsigned
 AuxRetry::status AuxRetry::writeTransaction(int address, NvU8 * buffer, unsigned size, unsigned retries)
 {
     unsigned completed;
+    unsigned defersSeen = 0;
     AuxBus::status s;
 
     DP_ASSERT( size <= aux->transactionSize() );
 
+    retries = effectiveRetries(retries);
+
     do
     {
         s = aux->transaction(AuxBus::write, AuxBus::native, address, buffer, size, &completed);
@@ -149,6 +200,7 @@ AuxRetry::status AuxRetry::writeTransaction(int address, NvU8 * buffer, unsigned
         //
         if ((s == AuxBus::success) && (completed == size) && (completed != 0))
         {
+            recordDeferStatistics(defersSeen);
             return ack;
         }
         else
@@ -158,12 +210,15 @@ AuxRetry::status AuxRetry::writeTransaction(int address, NvU8 * buffer, unsigned
             //
             if (s == AuxBus::defer)
             {
+                ++defersSeen;
+
                 if (retries)
                 {
                     --retries;
                     continue;
                 }
 
+                recordDeferStatistics(defersSeen);
                 return defer;
             }
 
@@ -206,6 +261,8 @@ AuxRetry::status AuxRetry::writeTransaction(int address, NvU8 * buffer, unsigned
         }
     } while(retries);
 
+    recordDeferStatistics(defersSeen);
+
     if ((s == AuxBus::defer) || (completed < size))
     {
         return defer;
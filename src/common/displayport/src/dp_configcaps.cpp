@@ -40,6 +40,15 @@ struct DPCDHALImpl : DPCDHAL
     AuxRetry  bus;
     Timer    * timer;
     bool      dpcdOffline;
+
+    //
+    //  Shadow of the last offline probe.  The sideband busy-wait loops call
+    //  updateDPCDOffline() every iteration; within the cache lifetime we
+    //  answer from the shadow instead of re-reading the caps block.  Any
+    //  HPD or IRQ_HPD invalidates it since presence may have changed.
+    //
+    bool      bDpcdOfflineCacheValid;
+    NvU64     dpcdOfflineCacheTime;
     bool      bGrantsPostLtRequest;
     bool      pc2Disabled;
     bool      uprequestEnable;
@@ -218,6 +227,8 @@ struct DPCDHALImpl : DPCDHAL
     DPCDHALImpl(AuxBus * bus, Timer * timer)
     : bus(bus),
     timer(timer),
+    bDpcdOfflineCacheValid(false),
+    dpcdOfflineCacheTime(0),
     bGrantsPostLtRequest(false),
     uprequestEnable(false),
     upstreamIsSource(false),
@@ -249,12 +260,20 @@ struct DPCDHALImpl : DPCDHAL
     void setDPCDOffline(bool bOffline)
     {
         dpcdOffline = bOffline;
+        bDpcdOfflineCacheValid = false;
     }
 
     void updateDPCDOffline()
     {
         NvU8 buffer[16];
         unsigned retries = 16;
+
+        if (bDpcdOfflineCacheValid &&
+            (timer->getTimeUs() - dpcdOfflineCacheTime) < DPCD_OFFLINE_CACHE_LIFETIME * 1000ULL)
+        {
+            return;
+        }
+
         // Burst read from 0x00 to 0x0F.
         if (AuxRetry::ack != bus.read(NV_DPCD_REV, &buffer[0], sizeof buffer, retries))
         {
@@ -264,6 +283,9 @@ struct DPCDHALImpl : DPCDHAL
         {
             dpcdOffline = false;
         }
+
+        bDpcdOfflineCacheValid = true;
+        dpcdOfflineCacheTime = timer->getTimeUs();
     }
 
     void setPC2Disabled(bool disabled)
@@ -292,6 +314,16 @@ struct DPCDHALImpl : DPCDHAL
         caps.phyRepeaterCount = 0;
 
         // Burst read from 0x00 to 0x0F.
+        status = bus.read(NV_DPCD_REV, &buffer[0], sizeof buffer, retries);
+
+        if (AuxRetry::ack != status)
+        {
+            // Failed to read caps.
+            // Set an invalid state here and make sure we REMEMBER we couldn't get the caps
+            caps.revisionMajor = 0;
+            dpcdOffline = true;
+            return;
+        }
 
         //
         // The Extended Receiver Capability field at DPCD Addresses 02200h through 022FFh is valid
@@ -299,30 +331,23 @@ struct DPCDHALImpl : DPCDHAL
         //
         // A DPRX that supports the Extended Receiver Capability field must set the
         // EXTENDED_RECEIVER_CAPABILITY_FIELD_PRESENT bit in the TRAINING_AUX_RD_INTERVAL
-        // register (DPCD Address 0000Eh, bit 7) to 1
+        // register (DPCD Address 0000Eh, bit 7) to 1.  That register is part of the burst
+        // we just did, so decode it from there rather than paying a separate transaction.
         //
-        caps.extendedRxCapsPresent = false;
-        if (AuxRetry::ack == bus.read(NV_DPCD_TRAINING_AUX_RD_INTERVAL, &byte, sizeof byte))
-        {
-            caps.extendedRxCapsPresent = DRF_VAL(_DPCD14, _TRAINING_AUX_RD_INTERVAL, _EXTENDED_RX_CAP, byte);
-        }
+        caps.extendedRxCapsPresent = DRF_VAL(_DPCD14, _TRAINING_AUX_RD_INTERVAL, _EXTENDED_RX_CAP, buffer[0xE]);
 
         if (caps.extendedRxCapsPresent)
         {
             status = bus.read(NV_DPCD14_EXTENDED_REV, &buffer[0], sizeof buffer, retries);
-        }
-        else
-        {
-            status = bus.read(NV_DPCD_REV, &buffer[0], sizeof buffer, retries);
-        }
 
-        if (AuxRetry::ack != status)
-        {
-            // Failed to read caps.
-            // Set an invalid state here and make sure we REMEMBER we couldn't get the caps
-            caps.revisionMajor = 0;
-            dpcdOffline = true;
-            return;
+            if (AuxRetry::ack != status)
+            {
+                // Failed to read caps.
+                // Set an invalid state here and make sure we REMEMBER we couldn't get the caps
+                caps.revisionMajor = 0;
+                dpcdOffline = true;
+                return;
+            }
         }
 
         // reset the faked dpcd flag since real LT should be possible now.
@@ -1132,6 +1157,7 @@ struct DPCDHALImpl : DPCDHAL
     //
     virtual void notifyIRQ()
     {
+        bDpcdOfflineCacheValid = false;
         parseAndReadInterrupts();
     }
 
@@ -1191,6 +1217,8 @@ struct DPCDHALImpl : DPCDHAL
 
     virtual void notifyHPD(bool status, bool bSkipDPCDRead)
     {
+        bDpcdOfflineCacheValid = false;
+
         if (!status)
         {
             // check if dpcd is alive
@@ -104,8 +104,14 @@ ConnectorImpl::ConnectorImpl(MainLink * main, AuxBus * auxBus, Timer * timer, Co
       bFECEnable(false),
       bDscCapBasedOnParent(false),
       inTransitionHeadMask(0x0),
+      watermarkCacheNext(0),
       ResStatus(this)
 {
+    dpMemZero(deviceIndex, sizeof(deviceIndex));
+
+    for (unsigned i = 0; i < watermarkCacheEntries; i++)
+        watermarkCache[i].valid = false;
+
     clearTimeslices();
     hal = MakeDPCDHAL(auxBus, timer);
     if (hal == NULL)
@@ -177,6 +183,7 @@ void ConnectorImpl::applyRegkeyOverrides(const DP_REGKEY_DATABASE& dpRegkeyDatab
     this->bForceDscOnSink                = dpRegkeyDatabase.bForceDscOnSink;
     this->bSkipFakeDeviceDpcdAccess      = dpRegkeyDatabase.bSkipFakeDeviceDpcdAccess;
     this->bFlushTimeslotWhenDirty        = dpRegkeyDatabase.bFlushTimeslotWhenDirty;
+    this->mstSidebandMessageWindow       = dpRegkeyDatabase.mstSidebandMessageWindow;
 }
 
 void ConnectorImpl::setPolicyModesetOrderMitigation(bool enabled)
@@ -316,6 +323,32 @@ void ConnectorImpl::discoveryNewDevice(const DiscoveryManager::Device & device)
             processNewDevice(device, Edid(), false, DISPLAY_PORT, RESERVED);
             return;
         }
+
+        //
+        //  If this is a rediscovery of a sink we already validated -- same
+        //  topology address, same nonzero GUID, and not the port a CSN delta
+        //  applies to -- reuse the EDID we read last time instead of going
+        //  back to the wire.  A single device power-cycling mid-chain tears
+        //  down and rediscovers everything beneath it; without this the
+        //  untouched devices each pay a sideband EDID read again.  Dongles
+        //  are excluded since the legacy sink behind one can change without
+        //  the dongle's GUID changing.
+        //
+        GUID peerGuid = device.peerGuid;
+        if (!device.dirty && (device.peerDevice != Dongle) &&
+            !peerGuid.isGuidZero())
+        {
+            DeviceImpl * existingDev = findDeviceInList(device.address);
+
+            if (existingDev && !existingDev->plugged &&
+                existingDev->guid == device.peerGuid &&
+                existingDev->rawEDID.getEdidSize() != 0)
+            {
+                processNewDevice(device, existingDev->rawEDID, true, DISPLAY_PORT, RESERVED);
+                return;
+            }
+        }
+
         pendingEdidReads.insertBack(new DevicePendingEDIDRead(this, messageManager, device));
     }
     else
@@ -476,6 +509,8 @@ create:
     if (existingDev && existingDev->isFakedMuxDevice())
     {
         newDev = existingDev;
+        // The device is about to be re-addressed: take it out of the index first
+        deviceIndexRemove(newDev);
         existingDev = NULL;
     }
     else
@@ -600,10 +635,13 @@ create:
     {
         newDev->bIsFakedMuxDevice = false;
         newDev->bIsPreviouslyFakedMuxDevice = true;
+        // Already on deviceList; re-index under the discovered address
+        deviceIndexInsert(newDev);
     }
     else
     {
         deviceList.insertBack(newDev);
+        deviceIndexInsert(newDev);
     }
 
     // if a new device has replaced a previous compliance device; let this event be exposed to DD now.
@@ -1685,7 +1723,7 @@ bool ConnectorImpl::compoundQueryAttachMSTGeneric(Group * target,
 
     if (this->isFECSupported())
     {
-        if (!isModePossibleMSTWithFEC(localInfo->lc, localInfo->localModesetInfo, &dpinfo))
+        if (!isModePossibleCached(DP_WATERMARK_MST_FEC, localInfo->lc, localInfo->localModesetInfo, &dpinfo))
         {
             compoundQueryResult = false;
             SET_DP_IMP_ERROR(pErrorCode, DP_IMP_ERROR_WATERMARK_BLANKING)
@@ -1693,7 +1731,7 @@ bool ConnectorImpl::compoundQueryAttachMSTGeneric(Group * target,
     }
     else
     {
-        if (!isModePossibleMST(localInfo->lc, localInfo->localModesetInfo, &dpinfo))
+        if (!isModePossibleCached(DP_WATERMARK_MST, localInfo->lc, localInfo->localModesetInfo, &dpinfo))
         {
             compoundQueryResult = false;
             SET_DP_IMP_ERROR(pErrorCode, DP_IMP_ERROR_WATERMARK_BLANKING)
@@ -3659,6 +3697,73 @@ bool ConnectorImpl::performIeeeOuiHandshake()
 }
 
 
+bool ConnectorImpl::isModePossibleCached(WatermarkVariant variant,
+                                         const LinkConfiguration & linkConfig,
+                                         const ModesetInfo & modesetInfo,
+                                         Watermark * dpInfo,
+                                         bool bUseIncreasedWatermarkLimits)
+{
+    for (unsigned i = 0; i < watermarkCacheEntries; i++)
+    {
+        WatermarkCacheEntry & hit = watermarkCache[i];
+
+        if (hit.valid &&
+            hit.variant == (unsigned)variant &&
+            hit.increasedWatermarkLimits == bUseIncreasedWatermarkLimits &&
+            hit.lanes == linkConfig.lanes &&
+            hit.minRate == linkConfig.minRate &&
+            hit.peakRate == linkConfig.peakRate &&
+            hit.enhancedFraming == linkConfig.enhancedFraming &&
+            hit.bEnableFEC == linkConfig.bEnableFEC &&
+            hit.multistream == linkConfig.multistream &&
+            hit.modesetInfo == modesetInfo)
+        {
+            *dpInfo = hit.water;
+            return hit.possible;
+        }
+    }
+
+    bool possible = false;
+
+    switch (variant)
+    {
+        case DP_WATERMARK_SST:
+            possible = isModePossibleSST(linkConfig, modesetInfo, dpInfo, bUseIncreasedWatermarkLimits);
+            break;
+        case DP_WATERMARK_SST_FEC:
+            possible = isModePossibleSSTWithFEC(linkConfig, modesetInfo, dpInfo, bUseIncreasedWatermarkLimits);
+            break;
+        case DP_WATERMARK_MST:
+            possible = isModePossibleMST(linkConfig, modesetInfo, dpInfo);
+            break;
+        case DP_WATERMARK_MST_FEC:
+            possible = isModePossibleMSTWithFEC(linkConfig, modesetInfo, dpInfo);
+            break;
+        default:
+            DP_ASSERT(0 && "Unknown watermark variant");
+            return false;
+    }
+
+    // Replace the oldest entry, round robin
+    WatermarkCacheEntry & entry = watermarkCache[watermarkCacheNext];
+    watermarkCacheNext = (watermarkCacheNext + 1) % watermarkCacheEntries;
+
+    entry.valid = true;
+    entry.variant = (unsigned)variant;
+    entry.increasedWatermarkLimits = bUseIncreasedWatermarkLimits;
+    entry.lanes = linkConfig.lanes;
+    entry.minRate = linkConfig.minRate;
+    entry.peakRate = linkConfig.peakRate;
+    entry.enhancedFraming = linkConfig.enhancedFraming;
+    entry.bEnableFEC = linkConfig.bEnableFEC;
+    entry.multistream = linkConfig.multistream;
+    entry.modesetInfo = modesetInfo;
+    entry.possible = possible;
+    entry.water = *dpInfo;
+
+    return possible;
+}
+
 bool ConnectorImpl::willLinkSupportModeSST(const LinkConfiguration & linkConfig, const ModesetInfo & modesetInfo)
 {
     DP_ASSERT(!linkUseMultistream() && "IMP for SST only");
@@ -3678,7 +3783,7 @@ bool ConnectorImpl::willLinkSupportModeSST(const LinkConfiguration & linkConfig,
 
     if (this->isFECSupported())
     {
-        if (!isModePossibleSSTWithFEC(linkConfig, modesetInfo, &water, main->hasIncreasedWatermarkLimits()))
+        if (!isModePossibleCached(DP_WATERMARK_SST_FEC, linkConfig, modesetInfo, &water, main->hasIncreasedWatermarkLimits()))
         {
             // Verify audio
             return false;
@@ -3686,7 +3791,7 @@ bool ConnectorImpl::willLinkSupportModeSST(const LinkConfiguration & linkConfig,
     }
     else
     {
-        if (!isModePossibleSST(linkConfig, modesetInfo, &water, main->hasIncreasedWatermarkLimits()))
+        if (!isModePossibleCached(DP_WATERMARK_SST, linkConfig, modesetInfo, &water, main->hasIncreasedWatermarkLimits()))
         {
             // Verify audio
             return false;
@@ -5468,9 +5573,10 @@ bool ConnectorImpl::checkIsModePossibleMST(GroupImpl *targetGroup)
 {
     if (this->isFECSupported())
     {
-        if (!isModePossibleMSTWithFEC(activeLinkConfig,
-                                      targetGroup->lastModesetInfo,
-                                      &targetGroup->timeslot.watermarks))
+        if (!isModePossibleCached(DP_WATERMARK_MST_FEC,
+                                  activeLinkConfig,
+                                  targetGroup->lastModesetInfo,
+                                  &targetGroup->timeslot.watermarks))
         {
             DP_ASSERT(0 && "DisplayDriver bug! This mode is not possible at any "
                            "link configuration. It should have been rejected at mode filtering time!");
@@ -5479,9 +5585,10 @@ bool ConnectorImpl::checkIsModePossibleMST(GroupImpl *targetGroup)
     }
     else
     {
-        if (!isModePossibleMST(activeLinkConfig,
-                               targetGroup->lastModesetInfo,
-                               &targetGroup->timeslot.watermarks))
+        if (!isModePossibleCached(DP_WATERMARK_MST,
+                                  activeLinkConfig,
+                                  targetGroup->lastModesetInfo,
+                                  &targetGroup->timeslot.watermarks))
         {
             DP_ASSERT(0 && "DisplayDriver bug! This mode is not possible at any "
                            "link configuration. It should have been rejected at mode filtering time!");
@@ -5732,17 +5839,19 @@ bool ConnectorImpl::beforeAddStream(GroupImpl * group, bool test, bool forFlushM
 
         if (this->isFECSupported())
         {
-            bIsModePossible = isModePossibleSSTWithFEC(activeLinkConfig,
-                                                       group->lastModesetInfo,
-                                                       &water,
-                                                       main->hasIncreasedWatermarkLimits());
+            bIsModePossible = isModePossibleCached(DP_WATERMARK_SST_FEC,
+                                                   activeLinkConfig,
+                                                   group->lastModesetInfo,
+                                                   &water,
+                                                   main->hasIncreasedWatermarkLimits());
         }
         else
         {
-            bIsModePossible = isModePossibleSST(activeLinkConfig,
-                                                group->lastModesetInfo,
-                                                &water,
-                                                main->hasIncreasedWatermarkLimits());
+            bIsModePossible = isModePossibleCached(DP_WATERMARK_SST,
+                                                   activeLinkConfig,
+                                                   group->lastModesetInfo,
+                                                   &water,
+                                                   main->hasIncreasedWatermarkLimits());
         }
 
         if (bIsModePossible)
@@ -5951,11 +6060,44 @@ void ConnectorImpl::disableFlush( bool test)
     }
 }
 
+void ConnectorImpl::deviceIndexInsert(DeviceImpl * dev)
+{
+    unsigned bucket = dev->address.hash() % deviceIndexBuckets;
+
+    DP_ASSERT(dev->hashNext == 0 && "Device is already indexed");
+
+    dev->hashNext = deviceIndex[bucket];
+    deviceIndex[bucket] = dev;
+}
+
+void ConnectorImpl::deviceIndexRemove(DeviceImpl * dev)
+{
+    //
+    // The bucket is derived from the current address, so callers must
+    // remove BEFORE re-addressing a device.  Removal of a device that was
+    // never indexed is a no-op.
+    //
+    for (DeviceImpl ** prev = &deviceIndex[dev->address.hash() % deviceIndexBuckets];
+         *prev; prev = &(*prev)->hashNext)
+    {
+        if (*prev == dev)
+        {
+            *prev = dev->hashNext;
+            dev->hashNext = 0;
+            return;
+        }
+    }
+}
+
 DeviceImpl* ConnectorImpl::findDeviceInList(const Address & address)
 {
-    for (ListElement * e = deviceList.begin(); e != deviceList.end(); e = e->next)
+    DeviceImpl * unpluggedDevice = 0;
+
+    for (DeviceImpl * device = deviceIndex[address.hash() % deviceIndexBuckets];
+         device; device = device->hashNext)
     {
-        DeviceImpl* device = (DeviceImpl*)e;
+        if (device->address != address)
+            continue;
 
         //
         // There may be multiple hits with the same address.  This can
@@ -5964,24 +6106,20 @@ DeviceImpl* ConnectorImpl::findDeviceInList(const Address & address)
         // object will be destroyed as soon as the DD handles the
         // notifyZombie message.
         //
-        if ((device->address == address) && device->plugged)
+        if (device->plugged)
             return device;
-    }
 
-    //
-    // If no plugged devices are found, we should search back through zombied devices.
-    // This is purely as an optimizations to allow the automatic restoration of a
-    // panel if it 'reappears' while its still being driven
-    //
-    for (ListElement * e = deviceList.begin(); e != deviceList.end(); e = e->next)
-    {
-        DeviceImpl* device = (DeviceImpl*)e;
-
-        if (device->address == address)
-            return device;
+        //
+        // Remember any unplugged hit.  Returning it when no plugged device
+        // matches is purely an optimization to allow the automatic
+        // restoration of a panel if it 'reappears' while its still being
+        // driven
+        //
+        if (!unpluggedDevice)
+            unpluggedDevice = device;
     }
 
-    return 0;
+    return unpluggedDevice;
 }
 
 void ConnectorImpl::disconnectDeviceList()
@@ -6232,6 +6370,11 @@ void ConnectorImpl::notifyLongPulseInternal(bool statusConnected)
             messageManager = new MessageManager(hal, timer);
             messageManager->registerReceiver(&ResStatus);
 
+            if (mstSidebandMessageWindow != 0)
+            {
+                messageManager->setMessageWindowPerTarget(mstSidebandMessageWindow);
+            }
+
             //
             // Create a discovery manager to initiate detection
             //
@@ -6302,11 +6445,25 @@ void ConnectorImpl::notifyLongPulseInternal(bool statusConnected)
             {
                 dev.peerDevice = DownstreamSink;
 
+                //
+                // KVM switches generate spurious hotplugs.  Seed the read
+                // with the EDID we already validated so an unchanged
+                // monitor costs a single block read instead of a full
+                // re-fetch.
+                //
+                const Edid * cachedEdid = 0;
+                DeviceImpl * existingDev = findDeviceInList(Address());
+                if (existingDev && existingDev->rawEDID.getEdidSize())
+                {
+                    cachedEdid = &existingDev->rawEDID;
+                }
+
                 //  Handle fallback EDID
                 if(!EdidReadSST(tmpEdid, auxBus, timer,
                                 hal->getPendingTestRequestEdidRead(),
                                 main->isForceRmEdidRequired(),
-                                main->isForceRmEdidRequired() ? main : 0))
+                                main->isForceRmEdidRequired() ? main : 0,
+                                cachedEdid))
                 {
                     bool status = false;
                     //
@@ -7042,6 +7199,7 @@ void ConnectorImpl::createFakeMuxDevice(const NvU8 *buffer, NvU32 bufferSize)
 
     populateAllDpConfigs();
     deviceList.insertBack(newDev);
+    deviceIndexInsert(newDev);
     sink->newDevice(newDev);
     sink->notifyDetectComplete();
 }
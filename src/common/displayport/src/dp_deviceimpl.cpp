@@ -50,6 +50,10 @@ bool DeviceImpl::isMustDisconnect()
 
 DeviceImpl::~DeviceImpl()
 {
+    // Drop out of the connector's address index before the address goes away
+    if (connector)
+        connector->deviceIndexRemove(this);
+
     if (isDeviceHDCPDetectionAlive && deviceHDCPDetection)
     {
         delete deviceHDCPDetection;
@@ -81,6 +85,7 @@ DeviceImpl::DeviceImpl(DPCDHAL * hal, ConnectorImpl * connector, DeviceImpl * pa
       activeGroup(0),
       connector(connector),
       address(),
+      hashNext(0),
       bVirtualPeerDevice(false),
       plugged(false),
       friendlyAux(this),
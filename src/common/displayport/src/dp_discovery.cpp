@@ -499,6 +499,16 @@ void DiscoveryManager::BranchDetection::messageFailed(MessageManager::Message *
 
 void DiscoveryManager::SinkDetection::messageFailed(MessageManager::Message * from, NakData * nakData)
 {
+    if (from == &powerUpPhyMessage)
+    {
+        //
+        // PowerUpPhy failures have never aborted detection;
+        // carry on with identification of the sink regardless.
+        //
+        handlePowerUpPhyDownReply();
+        return;
+    }
+
     if (from == &remoteDpcdReadMessage)
     {
         if ((retriesRemoteDpcdReadMessage < DPCD_REMOTE_DPCD_READ_MESSAGE_RETRIES) &&
@@ -733,6 +743,8 @@ void DiscoveryManager::SinkDetection::messageCompleted(MessageManager::Message *
         handleLinkAddressDownReply();
     else if (from == &remoteDpcdWriteMessage)
         detectCompleted(true);
+    else if (from == &powerUpPhyMessage)
+        handlePowerUpPhyDownReply();
 }
 
 void DiscoveryManager::BranchDetection::start()
@@ -760,17 +772,23 @@ void DiscoveryManager::SinkDetection::start()
     // Per DP1.4 requirement:
     // Send PowerUpPhy message first, to make sure device is ready to work
     //
-    NakData nakData;
+    // The reply is handled asynchronously so that detections of other
+    // devices may proceed while this one powers up; detection of this sink
+    // continues in handlePowerUpPhyDownReply().
+    //
+    parent->outstandingSinkDetections.insertBack(this);
     powerUpPhyMessage.set(address.parent(), address.tail(), NV_TRUE);
-    parent->messageManager->send(&powerUpPhyMessage, nakData);
+    parent->messageManager->post(&powerUpPhyMessage, this);
+}
 
+void DiscoveryManager::SinkDetection::handlePowerUpPhyDownReply()
+{
     Address::StringBuffer sb;
     DP_USED(sb);
 
     // The sink is found in CSN, missing dpcd revision
     if (bFromCSN)
     {
-        parent->outstandingSinkDetections.insertBack(this);
         // Create a LINK_ADDRESS_MESSAGE to send to parent of this target
         linkAddressMessage.set(address.parent());
 
@@ -793,7 +811,6 @@ void DiscoveryManager::SinkDetection::start()
             return;
         }
 
-        parent->outstandingSinkDetections.insertBack(this);
         Address parentAddress = address.parent();
         remoteDpcdReadMessage.set(parentAddress, address.tail(), NV_DPCD_GUID, sizeof(GUID));
 
@@ -915,6 +932,13 @@ void DiscoveryManager::ReceiverSink::handleCSN(MessageManager::MessageReceiver *
     newDevice.legacy = csnMessage->getUpRequestData()->legacyPlugged == true;
     newDevice.SDPStreams = newDevice.SDPStreamSinks = 0;
 
+    //
+    // The CSN delta applies to this port: whatever is plugged here now must
+    // be validated from scratch.  Devices rediscovered beneath it keep
+    // dirty == false, letting the client reuse their validated state.
+    //
+    newDevice.dirty = true;
+
     if (csnMessage->getUpRequestData()->devicePlugged)  // Check for a new device only if it's plugged
     {
         if (newDevice.branch)
@@ -97,7 +97,8 @@ const struct
     {NV_DP_REGKEY_MST_PCON_CAPS_READ_DISABLED,      &dpRegkeyDatabase.bMSTPCONCapsReadDisabled,        DP_REG_VAL_BOOL},
     {NV_DP_REGKEY_FORCE_DSC_ON_SINK,                &dpRegkeyDatabase.bForceDscOnSink,                 DP_REG_VAL_BOOL},
     {NV_DP_REGKEY_ENABLE_SKIP_DPCD_READS_WAR,       &dpRegkeyDatabase.bSkipFakeDeviceDpcdAccess,       DP_REG_VAL_BOOL},
-    {NV_DP_REGKEY_FLUSH_TIMESLOT_INFO_WHEN_DIRTY,   &dpRegkeyDatabase.bFlushTimeslotWhenDirty,         DP_REG_VAL_BOOL}
+    {NV_DP_REGKEY_FLUSH_TIMESLOT_INFO_WHEN_DIRTY,   &dpRegkeyDatabase.bFlushTimeslotWhenDirty,         DP_REG_VAL_BOOL},
+    {NV_DP_REGKEY_MST_SIDEBAND_MESSAGE_WINDOW,      &dpRegkeyDatabase.mstSidebandMessageWindow,        DP_REG_VAL_U32}
 };
 
 EvoMainLink::EvoMainLink(EvoInterface * provider, Timer * timer) :
@@ -118,6 +119,9 @@ EvoMainLink::EvoMainLink(EvoInterface * provider, Timer * timer) :
     _isDynamicMuxCapable       = false;
     _isLTPhyRepeaterSupported  = true;
     _rmPhyRepeaterCount        = 0;
+    _bUefiMaxLinkConfigCached  = false;
+    _uefiMaxLinkRate           = 0;
+    _uefiMaxLaneCount          = 0;
     dpMemZero(&_DSC, sizeof(_DSC));
     dpMemZero(&dfpParams, sizeof(dfpParams));
     dpMemZero(&dpParams, sizeof(dpParams));
@@ -1363,10 +1367,20 @@ void EvoMainLink::getLinkConfig(unsigned &laneCount, NvU64 & linkRate)
 
 bool EvoMainLink::getMaxLinkConfigFromUefi(NvU8 &linkRate, NvU8 &laneCount)
 {
+    if (_bUefiMaxLinkConfigCached)
+    {
+        linkRate = _uefiMaxLinkRate;
+        laneCount = _uefiMaxLaneCount;
+        return true;
+    }
+
     if (provider->getMaxLinkConfigFromUefi(linkRate, laneCount))
     {
         if (IS_VALID_LANECOUNT(laneCount) && IS_VALID_LINKBW(linkRate))
         {
+            _bUefiMaxLinkConfigCached = true;
+            _uefiMaxLinkRate = linkRate;
+            _uefiMaxLaneCount = laneCount;
             return true;
         }
     }
@@ -225,34 +225,63 @@ void  MessageManager::Message::expired(const void * tag)
 }
 
 //
-//  Enqueue the next message to the splitterDownRequest
+//  Enqueue the next messages to the splitterDownRequest
+//
+//  Down requests to distinct target addresses are independent, and each
+//  target accepts messageWindowPerTarget messages in flight
+//  (distinguished by the message number in the transaction header).  Walk
+//  the outgoing queue in priority order and hand every message whose
+//  target still has a free message number to the splitter, rather than
+//  waiting for the previous reply before sending the next request.
 //
 void MessageManager::transmitAwaitingDownRequests()
 {
-    for (ListElement * i = notYetSentDownRequest.begin(); i!=notYetSentDownRequest.end(); )
+    ListElement * i = notYetSentDownRequest.begin();
+
+    while (i != notYetSentDownRequest.end())
     {
         Message * m = (Message *)i;
         i = i->next;                    // Do this first since we may unlink the current node
 
-        if (awaitingReplyDownRequest.isEmpty())
+        //
+        //    Count the replies still outstanding for this target, and note
+        //    which message numbers they occupy.
+        //
+        unsigned outstanding = 0;
+        unsigned messageNumbersInFlight = 0;
+        for (ListElement * e = awaitingReplyDownRequest.begin(); e != awaitingReplyDownRequest.end(); e = e->next)
         {
-            //
-            //    Set the message number, and unlink from the outgoing queue
-            //
-            m->encodedMessage.messageNumber = 0;
-            m->state.messageNumber = 0;
+            Message * inFlight = (Message *)e;
+            if (inFlight->state.target == m->state.target)
+            {
+                outstanding++;
+                messageNumbersInFlight |= 1 << inFlight->state.messageNumber;
+            }
+        }
 
-            notYetSentDownRequest.remove(m);
-            awaitingReplyDownRequest.insertBack(m);
+        if (outstanding >= messageWindowPerTarget)
+        {
+            continue;
+        }
 
-            //
-            //  This call can cause transmitAwaitingDownRequests to be called again
-            //
-            bool sent = splitterDownRequest.send(m->encodedMessage, m);
-            DP_ASSERT(sent);
+        //
+        //    Set the message number, and unlink from the outgoing queue
+        //
+        m->encodedMessage.messageNumber = (messageNumbersInFlight & 1) ? 1 : 0;
+        m->state.messageNumber = m->encodedMessage.messageNumber;
 
-            return;
-        }
+        notYetSentDownRequest.remove(m);
+        awaitingReplyDownRequest.insertBack(m);
+
+        //
+        //  This call can cause transmitAwaitingDownRequests to be called
+        //  again, which may unlink or retire arbitrary queue entries.
+        //  Restart the walk afterwards rather than trusting the iterator.
+        //
+        bool sent = splitterDownRequest.send(m->encodedMessage, m);
+        DP_ASSERT(sent);
+
+        i = notYetSentDownRequest.begin();
     }
 }
 
@@ -235,13 +235,61 @@ EDID_DDC DisplayPort::sstDDCPing(AuxBus  & dpAux)
 
 bool DisplayPort::EdidReadSST(Edid & edid, AuxBus * auxBus, Timer* timer,
                               bool pendingTestRequestEdidRead, bool bBypassAssembler,
-                              MainLink * main)
+                              MainLink * main, const Edid * cachedEdid)
 {
     Edid previousEdid;
     Buffer *buffer;
     bool status;
     bool firstTrial = true;
     NvU64 startTime, elapsedTime;
+
+    //
+    //  Fast path for spurious hotplugs: when the caller still holds the
+    //  EDID from the previous detection, read back just the first block
+    //  and compare.  It carries the header, vendor/product and serial
+    //  identity plus its own checksum, so a byte exact match means the
+    //  same monitor is still attached and the remaining blocks need not
+    //  be fetched again.
+    //
+    if (cachedEdid && !pendingTestRequestEdidRead &&
+        cachedEdid->isChecksumValid() &&
+        (cachedEdid->getEdidSize() >= EDID_BLOCK_SIZE))
+    {
+        EDID_DDC ddc = sstDDCPing(*auxBus);
+
+        if (ddc != EDID_DDC_NONE)
+        {
+            Buffer firstBlock;
+            unsigned totalRead = 0;
+
+            if (readNextBlock(auxBus, 0, 0, firstBlock, totalRead, ddc, timer) &&
+                (totalRead == EDID_BLOCK_SIZE))
+            {
+                const NvU8 * cachedData = cachedEdid->getBuffer()->getData();
+                bool identical = true;
+
+                for (unsigned j = 0; j < EDID_BLOCK_SIZE; j++)
+                {
+                    if (firstBlock.getData()[j] != cachedData[j])
+                    {
+                        identical = false;
+                        break;
+                    }
+                }
+
+                if (identical)
+                {
+                    Buffer * target = edid.getBuffer();
+                    if (target->resize(cachedEdid->getEdidSize()))
+                    {
+                        dpMemCopy(target->getData(), cachedData, cachedEdid->getEdidSize());
+                        return true;
+                    }
+                }
+            }
+        }
+    }
+
     for (unsigned i = 0; i < ddcAddrListSize; i++)
     {
         startTime = timer->getTimeUs();
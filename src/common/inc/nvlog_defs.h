@@ -134,6 +134,8 @@ typedef struct _NVLOG_LOGGER
     PORT_MUTEX*  buffersLock;
     /** Lock for registering/deregistering flush callbacks */
     PORT_RWLOCK  *flushCbsLock;
+    /** Number of lock-free ring reservation retries; indicates producer contention */
+    volatile NvU32  pushContentionCount;
 } NVLOG_LOGGER;
 extern NVLOG_LOGGER NvLogLogger;
 
@@ -233,6 +233,7 @@ CODE_SEGMENT(PAGE_DD_CODE)
 NVT_STATUS NvTiming_CalcDMT(NvU32 width, NvU32 height, NvU32 rr, NvU32 flag, NVT_TIMING *pT)
 {
     NVT_TIMING *p = (NVT_TIMING *)DMT;
+    NVT_TIMING *pRB = NULL;
 
     if (pT == NULL)
         return NVT_STATUS_ERR;
@@ -244,13 +245,17 @@ NVT_STATUS NvTiming_CalcDMT(NvU32 width, NvU32 height, NvU32 rr, NvU32 flag, NVT
     if ((flag & NVT_PVT_INTERLACED_MASK) != 0)
         return NVT_STATUS_ERR;
 
+    //
+    // A single pass over the table; remember the first reduced-blanking match
+    // so a miss on the regular-blanking timings doesn't require a rescan.
+    //
     while (p->HVisible != 0 && p->VVisible != 0)
     {
-        if (NVT_GET_TIMING_STATUS_TYPE(p->etc.status) == NVT_TYPE_DMT)
+        if ((NvU32)p->HVisible == width &&
+            (NvU32)p->VVisible == height &&
+            (NvU32)p->etc.rr == rr)
         {
-            if ((NvU32)p->HVisible == width &&
-                (NvU32)p->VVisible == height &&
-                (NvU32)p->etc.rr == rr)
+            if (NVT_GET_TIMING_STATUS_TYPE(p->etc.status) == NVT_TYPE_DMT)
             {
                 NVMISC_MEMSET(pT, 0, sizeof(NVT_TIMING));
                 *pT = *p;
@@ -260,12 +265,29 @@ NVT_STATUS NvTiming_CalcDMT(NvU32 width, NvU32 height, NvU32 rr, NvU32 flag, NVT
                 pT->etc.rgb444.bpc.bpc8 = 1;
                 return NVT_STATUS_SUCCESS;
             }
-        }   
+
+            if ((NVT_GET_TIMING_STATUS_TYPE(p->etc.status) == NVT_TYPE_DMT_RB) &&
+                (pRB == NULL))
+            {
+                pRB = p;
+            }
+        }
         p ++;
     }
 
-    // if we couldn't find a DMT with regular blanking, try the DMT with reduced blanking next
-    return NvTiming_CalcDMT_RB(width, height, rr, flag, pT);
+    // if we couldn't find a DMT with regular blanking, use the DMT with reduced blanking
+    if (pRB != NULL)
+    {
+        NVMISC_MEMSET(pT, 0, sizeof(NVT_TIMING));
+        *pT = *pRB;
+        pT->etc.rrx1k = axb_div_c((NvU32)pT->pclk, (NvU32)10000*(NvU32)1000, (NvU32)pT->HTotal*(NvU32)pT->VTotal);
+        NVT_SNPRINTF((char *)pT->etc.name, 40, "DMT-RB:%dx%dx%dHz",width, height, rr);
+        pT->etc.name[39] = '\0';
+        pT->etc.rgb444.bpc.bpc8 = 1;
+        return NVT_STATUS_SUCCESS;
+    }
+
+    return NVT_STATUS_ERR;
 }
 
 CODE_SEGMENT(PAGE_DD_CODE)
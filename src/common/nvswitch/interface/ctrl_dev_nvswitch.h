@@ -100,6 +100,13 @@ typedef enum nvswitch_get_info_index
     NVSWITCH_GET_INFO_INDEX_PCI_BUS,
     NVSWITCH_GET_INFO_INDEX_PCI_DEVICE,
     NVSWITCH_GET_INFO_INDEX_PCI_FUNCTION,
+
+    /*
+     * Monotonic count of port up/down events on this device. Sweeps may
+     * poll this index and skip the full CTRL_NVSWITCH_GET_NVLINK_STATUS
+     * query when the count is unchanged since the previous sweep.
+     */
+    NVSWITCH_GET_INFO_INDEX_PORT_EVENT_SEQUENCE = 0x400,
     /* See enum modification guidelines at the top of this file */
 } NVSWITCH_GET_INFO_INDEX;
 
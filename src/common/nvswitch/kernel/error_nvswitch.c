@@ -95,6 +95,11 @@ nvswitch_construct_error_log
     errors->error_log_size = 0;
     errors->error_log = NULL;
     errors->overwritable = overwritable;
+    errors->burst_error_type = 0;
+    errors->burst_instance = 0;
+    errors->burst_start_time = 0;
+    errors->burst_count = 0;
+    errors->burst_suppressed = 0;
 
     if (error_log_size > 0)
     {
@@ -140,6 +145,54 @@ nvswitch_destroy_error_log
     }
 }
 
+// Dump throttle: per-source window length and dumps allowed per window
+#define NVSWITCH_ERROR_BURST_WINDOW_NS  1000000000ULL
+#define NVSWITCH_ERROR_BURST_DUMP_LIMIT 8
+
+//
+// Returns NV_TRUE if the console dump for this error should be suppressed
+// because the same source is producing an error burst.  Errors are still
+// recorded in the log either way; only the dump is throttled.
+//
+static NvBool
+_nvswitch_error_dump_throttled
+(
+    nvswitch_device *device,
+    NVSWITCH_ERROR_LOG_TYPE *errors,
+    NvU32 error_type,
+    NvU32 instance,
+    NvU64 time
+)
+{
+    if ((error_type != errors->burst_error_type) ||
+        (instance != errors->burst_instance) ||
+        ((time - errors->burst_start_time) > NVSWITCH_ERROR_BURST_WINDOW_NS))
+    {
+        if (errors->burst_suppressed != 0)
+        {
+            NVSWITCH_PRINT(device, ERROR,
+                "Suppressed %d repeats of SXid %d (instance %d)\n",
+                errors->burst_suppressed, errors->burst_error_type,
+                errors->burst_instance);
+        }
+
+        errors->burst_error_type = error_type;
+        errors->burst_instance = instance;
+        errors->burst_start_time = time;
+        errors->burst_count = 0;
+        errors->burst_suppressed = 0;
+    }
+
+    errors->burst_count++;
+    if (errors->burst_count > NVSWITCH_ERROR_BURST_DUMP_LIMIT)
+    {
+        errors->burst_suppressed++;
+        return NV_TRUE;
+    }
+
+    return NV_FALSE;
+}
+
 void
 nvswitch_record_error
 (
@@ -215,7 +268,11 @@ nvswitch_record_error
             nvswitch_os_memcpy(&errors->error_log[idx_error].data, data, data_size);
         }
 
-        _nvswitch_dump_error_entry(device, idx_error, &errors->error_log[idx_error]);
+        if (!_nvswitch_error_dump_throttled(device, errors, error_type, instance,
+                                            errors->error_log[idx_error].time))
+        {
+            _nvswitch_dump_error_entry(device, idx_error, &errors->error_log[idx_error]);
+        }
     }
     errors->error_total++;
     device->error_total++;
@@ -511,6 +568,7 @@ nvswitch_ctrl_get_errors
 {
     NvU32 index = 0;
     NvU32 count = 0;
+    NvU64 last_error_num = 0;
     NVSWITCH_ERROR_LOG_TYPE *error_log;
     NVSWITCH_ERROR_TYPE error;
 
@@ -556,27 +614,30 @@ nvswitch_ctrl_get_errors
 
     while ((p->errorCount < NVSWITCH_ERROR_COUNT_SIZE) && (index < count))
     {
-        // Get the next error to consider from the log
-        nvswitch_get_error(device, error_log, &error, index, NULL);
-
-        p->error[p->errorCount].error_value = error.error_type;
-        p->error[p->errorCount].error_src = error.error_src;
-        p->error[p->errorCount].instance = error.instance;
-        p->error[p->errorCount].subinstance = error.subinstance;
-        p->error[p->errorCount].time = error.time;
-        p->error[p->errorCount].error_resolved = error.error_resolved;
-        p->error[p->errorCount].error_data_size = error.data_size;
-        if (error.data_size > 0)
+        // Copy the next error directly out of the log ring
+        NVSWITCH_ERROR_TYPE *entry =
+            &error_log->error_log[(error_log->error_start + index) %
+                                  error_log->error_log_size];
+
+        p->error[p->errorCount].error_value = entry->error_type;
+        p->error[p->errorCount].error_src = entry->error_src;
+        p->error[p->errorCount].instance = entry->instance;
+        p->error[p->errorCount].subinstance = entry->subinstance;
+        p->error[p->errorCount].time = entry->time;
+        p->error[p->errorCount].error_resolved = entry->error_resolved;
+        p->error[p->errorCount].error_data_size = entry->data_size;
+        if (entry->data_size > 0)
         {
-            nvswitch_os_memcpy(p->error[p->errorCount].error_data, error.data.raw.data, error.data_size);
+            nvswitch_os_memcpy(p->error[p->errorCount].error_data, entry->data.raw.data, entry->data_size);
         }
-        nvswitch_os_memcpy(p->error[p->errorCount].error_description, error.description, sizeof(error.description));
-        
+        nvswitch_os_memcpy(p->error[p->errorCount].error_description, entry->description, sizeof(entry->description));
+
+        last_error_num = entry->local_error_num;
         p->errorCount++;
         index++;
     }
 
-    p->errorIndex = error.local_error_num + 1;
+    p->errorIndex = last_error_num + 1;
 
     return NVL_SUCCESS;
 }
@@ -467,6 +467,13 @@ struct nvswitch_device
     // List of client events
     NVListRec                            client_events_list;
 
+    //
+    // Pool of recycled inband message buffers so the receive path does
+    // not allocate and free a buffer per message.
+    //
+    NVListRec                            inband_buffer_pool;
+    NvU32                                inband_buffer_pool_count;
+
     // To be removed once newer vbios is on TOT.
     NvBool  bIsNvlinkVbiosTableVersion2;
 
@@ -632,6 +639,8 @@ NvlStatus nvswitch_launch_ALI(nvswitch_device *device);
 NvlStatus nvswitch_launch_ALI_link_training(nvswitch_device *device, nvlink_link *link, NvBool bSync);
 NvlStatus nvswitch_inband_read_data(nvswitch_device *device, NvU8 *dest, NvU32 linkId, NvU32 *dataSize);
 void      nvswitch_filter_messages(nvswitch_device *device, NvU32 linkId);
+nvswitch_inband_data_list *nvswitch_inband_buffer_get(nvswitch_device *device);
+void      nvswitch_inband_buffer_put(nvswitch_device *device, nvswitch_inband_data_list *curr);
 NvlStatus nvswitch_reset_and_train_link(nvswitch_device *device, nvlink_link *link);
 NvlStatus nvswitch_set_training_mode(nvswitch_device *device);
 NvBool    nvswitch_is_link_in_reset(nvswitch_device *device, nvlink_link *link);
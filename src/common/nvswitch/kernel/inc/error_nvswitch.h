@@ -121,6 +121,16 @@ typedef struct
     NVSWITCH_ERROR_TYPE *error_log;
     NvBool              overwritable;   // Old CB entries can be overwritten
 
+    //
+    // Console dump throttling for repeated errors from the same source,
+    // so an error storm on one link does not flood the system log.
+    //
+    NvU32               burst_error_type;
+    NvU32               burst_instance;
+    NvU64               burst_start_time;
+    NvU32               burst_count;
+    NvU32               burst_suppressed;
+
 } NVSWITCH_ERROR_LOG_TYPE;
 
 //
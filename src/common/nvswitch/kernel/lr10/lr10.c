@@ -4780,6 +4780,9 @@ nvswitch_ctrl_get_info_lr10
             case NVSWITCH_GET_INFO_INDEX_PCI_FUNCTION:
                 p->info[i] = device->nvlink_device->pciInfo.function;
                 break;
+            case NVSWITCH_GET_INFO_INDEX_PORT_EVENT_SEQUENCE:
+                p->info[i] = (NvU32)device->log_PORT_EVENTS.port_event_total;
+                break;
             default:
                 NVSWITCH_PRINT(device, ERROR,
                     "%s: Undefined NVSWITCH_GET_INFO_INDEX 0x%x\n",
@@ -855,7 +855,7 @@ nvswitch_minion_receive_inband_data_ls10
          }
 
          device->link[linkId].inbandData.message =
-                                   nvswitch_os_malloc(sizeof(nvswitch_inband_data_list));
+                                   nvswitch_inband_buffer_get(device);
          if (device->link[linkId].inbandData.message == NULL)
          {
              status = -NVL_NO_MEM;
@@ -938,7 +938,7 @@ cleanup:
     }
     if (device->link[linkId].inbandData.message != NULL)
     {
-        nvswitch_os_free(device->link[linkId].inbandData.message);
+        nvswitch_inband_buffer_put(device, device->link[linkId].inbandData.message);
         device->link[linkId].inbandData.message = NULL;
     }
     //TODO: Check if we need to send a failure msg to client?
@@ -1576,7 +1576,7 @@ _nvswitch_inband_clear_lists
         }
 
         nvListDel(&curr->entry);
-        nvswitch_os_free(curr);
+        nvswitch_inband_buffer_put(device, curr);
     }
 
     if (bNonPersistentOnly)
@@ -1592,7 +1592,7 @@ _nvswitch_inband_clear_lists
         }
 
         nvListDel(&curr->entry);
-        nvswitch_os_free(curr);
+        nvswitch_inband_buffer_put(device, curr);
     }
 }
 
@@ -1764,6 +1764,9 @@ nvswitch_lib_initialize_device
 
     nvListInit(&device->client_events_list);
 
+    nvListInit(&device->inband_buffer_pool);
+    device->inband_buffer_pool_count = 0;
+
     for (link_num=0; link_num < nvswitch_get_num_links(device); link_num++)
     {
         nvListInit(&device->link[link_num].inbandData.persistent_list);
@@ -2556,6 +2559,24 @@ _nvswitch_destroy_rom(nvswitch_device *device)
     }
 }
 
+/*!
+ * @brief: Free the device's recycled inband message buffers
+ */
+static void
+_nvswitch_destroy_inband_buffer_pool(nvswitch_device *device)
+{
+    nvswitch_inband_data_list *curr = NULL;
+    nvswitch_inband_data_list *next = NULL;
+
+    nvListForEachEntry_safe(curr, next, &device->inband_buffer_pool, entry)
+    {
+        nvListDel(&curr->entry);
+        nvswitch_os_free(curr);
+    }
+
+    device->inband_buffer_pool_count = 0;
+}
+
 /*!
  * @brief: Free the device's client event list
  */
@@ -2612,6 +2633,8 @@ nvswitch_lib_shutdown_device
     nvswitch_smbpbi_unload(device);
     _nvswitch_destroy_event_list(device);
 
+    _nvswitch_destroy_inband_buffer_pool(device);
+
     nvswitch_destroy_inforom_objects(device);
     nvswitch_destroy_inforom(device);
 
@@ -4392,6 +4415,68 @@ _nvswitch_lib_validate_privileged_ctrl
     return -NVL_ERR_INSUFFICIENT_PERMISSIONS;
 }
 
+// Upper bound on recycled inband message buffers kept per device
+#define NVSWITCH_INBAND_BUFFER_POOL_MAX 8
+
+/*
+ * @Brief : Get an inband message buffer, reusing a pooled one if available
+ *
+ * @Description : Message buffers are recycled through a per-device pool
+ *                so the receive path does not pay an allocation per
+ *                message. Called with the device lock held.
+ *
+ * @param[in] device            NvSwitch device to contain this link
+ *
+ * @returns                     Message buffer, NULL if out of memory
+ */
+nvswitch_inband_data_list *
+nvswitch_inband_buffer_get
+(
+    nvswitch_device *device
+)
+{
+    nvswitch_inband_data_list *curr;
+
+    if (!nvListIsEmpty(&device->inband_buffer_pool))
+    {
+        curr = nvListFirstEntry(&device->inband_buffer_pool,
+                                nvswitch_inband_data_list, entry);
+        nvListDel(&curr->entry);
+        device->inband_buffer_pool_count--;
+        curr->dataSize = 0;
+        return curr;
+    }
+
+    return nvswitch_os_malloc(sizeof(nvswitch_inband_data_list));
+}
+
+/*
+ * @Brief : Return an inband message buffer to the per-device pool
+ *
+ * @Description : Buffers above the pool bound are freed. Called with the
+ *                device lock held. The buffer must already be unlinked
+ *                from any message list.
+ *
+ * @param[in] device            NvSwitch device to contain this link
+ * @param[in] curr              Message buffer being released
+ */
+void
+nvswitch_inband_buffer_put
+(
+    nvswitch_device *device,
+    nvswitch_inband_data_list *curr
+)
+{
+    if (device->inband_buffer_pool_count >= NVSWITCH_INBAND_BUFFER_POOL_MAX)
+    {
+        nvswitch_os_free(curr);
+        return;
+    }
+
+    nvListAdd(&curr->entry, &device->inband_buffer_pool);
+    device->inband_buffer_pool_count++;
+}
+
 /*
  * @Brief : Copy the data from the persistant or nonpersistant list
  *
@@ -4435,7 +4520,7 @@ nvswitch_inband_read_data
          *dataSize = curr->dataSize;
          nvswitch_os_memcpy(dest, curr->data, curr->dataSize);
          nvListDel(&curr->entry);
-         nvswitch_os_free(curr);
+         nvswitch_inband_buffer_put(device, curr);
          break;
     }
 
@@ -4526,7 +4611,7 @@ nvswitch_filter_messages
     if (bSendNackOrDrop)
     {
         nvswitch_send_nack_or_drop(device, linkId, msghdr);
-        nvswitch_os_free(msg);
+        nvswitch_inband_buffer_put(device, msg);
     }
     else
     {
@@ -194,6 +194,70 @@ typedef struct RUSD_INST_POWER_USAGE {
     RUSD_INST_POWER_INFO info;
 } RUSD_INST_POWER_USAGE;
 
+//
+// Kernel-written low-water marks for FB allocation headroom. Each field
+// tracks the minimum value observed since the mark was last re-armed via
+// NV00DE_CTRL_CMD_RESET_MEMORY_WATERMARKS, letting a monitor read the
+// worst case over its collection interval from the shared mapping instead
+// of sampling controls at high rate. RUSD_MEM_WATERMARK_UNARMED means no
+// sample has been published since (re-)arming.
+//
+#define RUSD_MEM_WATERMARK_UNARMED NV_U64_MAX
+
+typedef struct RUSD_MEM_WATERMARK_INFO {
+    NvU64 minFreePmaMemory; // bytes
+    NvU64 minBar1AvailSize; // KiB, same units as bar1AvailSize
+} RUSD_MEM_WATERMARK_INFO;
+
+typedef struct RUSD_MEM_WATERMARKS {
+    RUSD_MEM_WATERMARK_INFO info;
+} RUSD_MEM_WATERMARKS;
+
+//
+// Read-only mirror of the RM control cache for cacheable GET_INFO-style
+// controls, so that userspace can answer repeated queries (e.g.
+// NV2080_CTRL_CMD_GPU_GET_INFO_V2) from the shared mapping without entering
+// the kernel. Population is opt-in via the RmCacheableControlsMirror regkey;
+// when disabled (or before RM has serviced a given control at least once) the
+// valid flags stay zero and userspace must fall back to the control call.
+//
+// Each table mirrors one control's per-index cache: data[i] holds the value
+// for info index i and is meaningful only while valid[i] is nonzero. Readers
+// must bracket accesses with the same seq checks as the rest of this struct.
+//
+
+// Large enough for every mirrored control's info list
+// (NV2080_CTRL_FIFO_GET_INFO_MAX_ENTRIES is the current maximum).
+#define RUSD_CTRL_CACHE_GET_INFO_MAX_LIST 256
+
+// Covers NV2080_GPU_MAX_NAME_STRING_LENGTH
+#define RUSD_CTRL_CACHE_GPU_NAME_LENGTH   64
+
+typedef struct RUSD_CTRL_CACHE_INFO_TABLE {
+    NvU32 cmd;           // Mirrored RM control cmd, 0 while the slot is unpopulated
+    NvU32 listSizeLimit; // Number of meaningful slots in valid[]/data[]
+    NvU8  valid[RUSD_CTRL_CACHE_GET_INFO_MAX_LIST];
+    NvU32 data[RUSD_CTRL_CACHE_GET_INFO_MAX_LIST];
+} RUSD_CTRL_CACHE_INFO_TABLE;
+
+// Fixed table assignment per mirrored control
+#define RUSD_CTRL_CACHE_TABLE_GPU_INFO   0 // NV2080_CTRL_CMD_GPU_GET_INFO_V2
+#define RUSD_CTRL_CACHE_TABLE_FIFO_INFO  1 // NV2080_CTRL_CMD_FIFO_GET_INFO
+#define RUSD_CTRL_CACHE_TABLE_BUS_INFO   2 // NV2080_CTRL_CMD_BUS_GET_INFO_V2
+#define RUSD_CTRL_CACHE_TABLE_COUNT      3
+
+typedef struct RUSD_CTRL_CACHE_GPU_NAME {
+    NvU32 bAsciiValid;
+    NvU32 bUnicodeValid;
+    NvU8  ascii[RUSD_CTRL_CACHE_GPU_NAME_LENGTH];
+    NvU16 unicode[RUSD_CTRL_CACHE_GPU_NAME_LENGTH];
+} RUSD_CTRL_CACHE_GPU_NAME;
+
+typedef struct RUSD_CTRL_CACHE {
+    RUSD_CTRL_CACHE_INFO_TABLE infoTables[RUSD_CTRL_CACHE_TABLE_COUNT];
+    RUSD_CTRL_CACHE_GPU_NAME gpuName;
+} RUSD_CTRL_CACHE;
+
 typedef struct NV00DE_SHARED_DATA {
     volatile NvU64 seq;
 
@@ -213,6 +277,14 @@ typedef struct NV00DE_SHARED_DATA {
     NV_DECLARE_ALIGNED(RUSD_MEM_ROW_REMAP memRowRemap, 8);
     NV_DECLARE_ALIGNED(RUSD_AVG_POWER_USAGE avgPowerUsage, 8);
     NV_DECLARE_ALIGNED(RUSD_INST_POWER_USAGE instPowerUsage, 8);
+
+    //
+    // The sections below are written only by kernel RM, never by GSP; they
+    // must stay after the polling data section so the GSP-written offsets
+    // above are unchanged.
+    //
+    NV_DECLARE_ALIGNED(RUSD_MEM_WATERMARKS memWatermarks, 8);
+    NV_DECLARE_ALIGNED(RUSD_CTRL_CACHE ctrlCache, 8);
 } NV00DE_SHARED_DATA;
 
 #define NV00DE_RUSD_POLL_CLOCK     0x1
@@ -221,6 +293,9 @@ typedef struct NV00DE_SHARED_DATA {
 #define NV00DE_RUSD_POLL_POWER     0x8
 #define NV00DE_RUSD_POLL_THERMAL   0x10
 
+#define NV00DE_RUSD_WATERMARK_PMA_FREE   0x1
+#define NV00DE_RUSD_WATERMARK_BAR1_AVAIL 0x2
+
 typedef struct NV00DE_ALLOC_PARAMETERS {
     NvU64 polledDataMask; // Bitmask of data to request polling at alloc time, 0 if not needed
 } NV00DE_ALLOC_PARAMETERS;
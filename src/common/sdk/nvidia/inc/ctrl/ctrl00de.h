@@ -54,4 +54,26 @@ typedef struct NV00DE_CTRL_REQUEST_DATA_POLL_PARAMS {
     NV_DECLARE_ALIGNED(NvU64 polledDataMask, 8);
 } NV00DE_CTRL_REQUEST_DATA_POLL_PARAMS;
 
+/*
+ * NV00DE_CTRL_CMD_RESET_MEMORY_WATERMARKS
+ *
+ * @brief Re-arm the kernel-written FB allocation watermarks
+ *
+ * The selected watermarks restart tracking from the values currently
+ * published in NV00DE_SHARED_DATA, so callers can read per-interval minima
+ * from the shared mapping between resets.
+ *
+ * @param[in]  watermarkMask Bitmask of NV00DE_RUSD_WATERMARK_* to re-arm
+ *
+ * @return NV_OK on success
+ * @return NV_ERR_ otherwise
+ */
+#define NV00DE_CTRL_CMD_RESET_MEMORY_WATERMARKS (0xde0002U) /* finn: Evaluated from "(FINN_RM_USER_SHARED_DATA_INTERFACE_ID << 8) | NV00DE_CTRL_RESET_MEMORY_WATERMARKS_PARAMS_MESSAGE_ID" */
+
+#define NV00DE_CTRL_RESET_MEMORY_WATERMARKS_PARAMS_MESSAGE_ID (0x2U)
+
+typedef struct NV00DE_CTRL_RESET_MEMORY_WATERMARKS_PARAMS {
+    NV_DECLARE_ALIGNED(NvU64 watermarkMask, 8);
+} NV00DE_CTRL_RESET_MEMORY_WATERMARKS_PARAMS;
+
 /* _ctrl00de.h_ */
@@ -58,6 +58,7 @@
 #define NV00F1_CTRL_FABRIC_EVENT_TYPE_MEM_UNIMPORT      1U
 #define NV00F1_CTRL_FABRIC_EVENT_TYPE_REMOTE_GPU_ATTACH 2U
 #define NV00F1_CTRL_FABRIC_EVENT_TYPE_CLIQUE_ID_CHANGE  3U
+#define NV00F1_CTRL_FABRIC_EVENT_TYPE_PROBE_COMPLETE    4U
 
 /*
  *  id
@@ -137,6 +138,18 @@ typedef struct NV00F1_CTRL_CLIQUE_ID_CHANGE_GPU_EVENT_DATA {
     NvU32 cliqueId;
 } NV00F1_CTRL_CLIQUE_ID_CHANGE_GPU_EVENT_DATA;
 
+/*
+ *  gpuId
+ *    GPU ID of the GPU whose fabric probe completed.
+ *
+ *  status
+ *    Final probe status as reported by the fabric manager.
+ */
+typedef struct NV00F1_CTRL_PROBE_COMPLETE_GPU_EVENT_DATA {
+    NvU32 gpuId;
+    NvU32 status;
+} NV00F1_CTRL_PROBE_COMPLETE_GPU_EVENT_DATA;
+
 /*
  *  type
  *    Event type, one of NV00F1_CTRL_FABRIC_EVENT_TYPE_*.
@@ -160,6 +173,7 @@ typedef struct NV00F1_CTRL_FABRIC_EVENT {
         NV_DECLARE_ALIGNED(NV00F1_CTRL_FABRIC_MEM_UNIMPORT_EVENT_DATA unimport, 8);
         NV_DECLARE_ALIGNED(NV00F1_CTRL_ATTACH_REMOTE_GPU_EVENT_DATA attach, 8);
         NV00F1_CTRL_CLIQUE_ID_CHANGE_GPU_EVENT_DATA cliqueIdChange;
+        NV00F1_CTRL_PROBE_COMPLETE_GPU_EVENT_DATA probeComplete;
     } data;
 } NV00F1_CTRL_FABRIC_EVENT;
 
@@ -338,6 +338,49 @@ typedef struct NV2080_CTRL_CE_GET_ALL_CAPS_PARAMS {
 
 typedef NV2080_CTRL_CE_GET_ALL_CAPS_PARAMS NV2080_CTRL_CE_GET_ALL_PHYSICAL_CAPS_PARAMS;
 
+/*
+ * NV2080_CTRL_CMD_CE_GET_UTILIZATION
+ *
+ * Query per-LCE occupancy counters and a least-loaded allocation hint.
+ *
+ * The counters track CE channel contexts resident on each LCE, so a
+ * scheduler can see how copy work is spread across the LCEs and steer new
+ * channels accordingly. Indexing follows NV2080_CTRL_CMD_CE_GET_ALL_CAPS:
+ * entry i describes the i-th copy engine visible to the client.
+ *
+ *   [out] activeContextCount
+ *     Number of CE channel contexts currently allocated on each LCE.
+ *   [out] totalContextCount
+ *     Number of CE channel contexts allocated on each LCE since boot.
+ *   [out] present
+ *     Bit mask indicating which LCEs are usable by the client and have
+ *     their counters indicated above.
+ *     If client is subscribed to a MIG instance, only the CEs present in
+ *     the instance are tagged as such.
+ *   [out] preferredCe
+ *     Index of the asynchronous (non-GRCE) LCE with the fewest active
+ *     contexts; NV2080_CTRL_CE_UTILIZATION_INVALID_LCE if no such LCE
+ *     is available. Allocating new copy channels on this LCE keeps the
+ *     load balanced.
+ *
+ * Possible status values returned are:
+ *   NV_OK
+ *   NV_ERR_NOT_SUPPORTED
+ */
+
+#define NV2080_CTRL_CMD_CE_GET_UTILIZATION       (0x20802a0c) /* finn: Evaluated from "(FINN_NV20_SUBDEVICE_0_CE_INTERFACE_ID << 8) | NV2080_CTRL_CE_GET_UTILIZATION_PARAMS_MESSAGE_ID" */
+
+#define NV2080_CTRL_CE_UTILIZATION_INVALID_LCE   (0xffffffffU)
+
+#define NV2080_CTRL_CE_GET_UTILIZATION_PARAMS_MESSAGE_ID (0xcU)
+
+typedef struct NV2080_CTRL_CE_GET_UTILIZATION_PARAMS {
+    NvU32 activeContextCount[NV2080_CTRL_MAX_CES];
+    NvU32 totalContextCount[NV2080_CTRL_MAX_CES];
+    NV_DECLARE_ALIGNED(NvU64 present, 8);
+    NvU32 preferredCe;
+} NV2080_CTRL_CE_GET_UTILIZATION_PARAMS;
+
 
 
 /* _ctrl2080ce_h_ */
@@ -2795,4 +2795,49 @@ typedef struct NV2080_CTRL_CMD_FB_STATS_GET_PARAMS {
     NV_DECLARE_ALIGNED(NV2080_CTRL_CMD_FB_STATS_OWNER_INFO fbBlockInfo[NV2080_CTRL_CMD_FB_STATS_MAX_OWNER], 8);
 } NV2080_CTRL_CMD_FB_STATS_GET_PARAMS;
 
+/*
+ * NV2080_CTRL_CMD_FB_GET_CTX_BUF_POOL_STATS
+ *
+ * Get usage statistics for the engine-global RM context buffer pools:
+ * the per-GR-engine global context buffer pools and the per-engine
+ * runlist buffer pools. Returns one entry per live pool.
+ *
+ *   numEntries [out]
+ *     Number of valid entries in the entries array.
+ *
+ * Each entry reports:
+ *   engineType
+ *     NV2080_ENGINE_TYPE_* of the engine owning the pool.
+ *   bRefillPending
+ *     NV_TRUE if a low-watermark refill work item is queued for the pool.
+ *   freeBytes
+ *     Amount of pre-reserved memory currently sitting free in the pool.
+ *   reservedBytes
+ *     High-water mark of memory reserved in the pool.
+ *   allocCount / freeCount
+ *     Number of buffer allocations/frees served by the pool.
+ *   refillCount
+ *     Number of times the pool was topped back up by a refill work item.
+ */
+#define NV2080_CTRL_CMD_FB_GET_CTX_BUF_POOL_STATS (0x20801353) /* finn: Evaluated from "(FINN_NV20_SUBDEVICE_0_FB_INTERFACE_ID << 8) | NV2080_CTRL_FB_GET_CTX_BUF_POOL_STATS_PARAMS_MESSAGE_ID" */
+
+#define NV2080_CTRL_FB_CTX_BUF_POOL_STATS_MAX_ENTRIES 80U
+
+typedef struct NV2080_CTRL_FB_CTX_BUF_POOL_STATS_ENTRY {
+    NvU32  engineType;
+    NvBool bRefillPending;
+    NV_DECLARE_ALIGNED(NvU64 freeBytes, 8);
+    NV_DECLARE_ALIGNED(NvU64 reservedBytes, 8);
+    NV_DECLARE_ALIGNED(NvU64 allocCount, 8);
+    NV_DECLARE_ALIGNED(NvU64 freeCount, 8);
+    NV_DECLARE_ALIGNED(NvU64 refillCount, 8);
+} NV2080_CTRL_FB_CTX_BUF_POOL_STATS_ENTRY;
+
+#define NV2080_CTRL_FB_GET_CTX_BUF_POOL_STATS_PARAMS_MESSAGE_ID (0x53U)
+
+typedef struct NV2080_CTRL_FB_GET_CTX_BUF_POOL_STATS_PARAMS {
+    NvU32 numEntries;
+    NV_DECLARE_ALIGNED(NV2080_CTRL_FB_CTX_BUF_POOL_STATS_ENTRY entries[NV2080_CTRL_FB_CTX_BUF_POOL_STATS_MAX_ENTRIES], 8);
+} NV2080_CTRL_FB_GET_CTX_BUF_POOL_STATS_PARAMS;
+
 /* _ctrl2080fb_h_ */
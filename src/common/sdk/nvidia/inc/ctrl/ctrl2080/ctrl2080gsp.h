@@ -130,4 +130,84 @@ typedef struct NV2080_CTRL_GSP_GET_RM_HEAP_STATS_PARAMS {
     NV_DECLARE_ALIGNED(NV2080_CTRL_GSP_RM_HEAP_STATS_SNAPSHOT peak, 8);
 } NV2080_CTRL_GSP_GET_RM_HEAP_STATS_PARAMS;
 
+/*
+ * NV2080_CTRL_CMD_GSP_GET_RPC_PROFILE
+ *
+ * This command reports the RPC latency profile accumulated by CPU-RM since
+ * the GPU was attached: a histogram of RPC round-trip latencies, per-RPC-type
+ * accumulators, and the most recent entries of the RPC trace ring.
+ *
+ *  histogram
+ *    Count of completed RPCs per latency bucket; bucket i covers round-trip
+ *    durations in [2^i, 2^(i+1)) microseconds, with the last bucket also
+ *    counting everything larger.
+ *  numFunctions
+ *    Number of valid entries in the functions array.
+ *  functions
+ *    Per-RPC-type accumulators, one entry per distinct RPC function number
+ *    seen so far (NV_VGPU_MSG_FUNCTION_*).
+ *  numRingEntries
+ *    Number of valid entries in the ring array.
+ *  ring
+ *    The most recent completed RPCs, newest first.
+ *
+ * Possible status return values are:
+ *   NV_OK
+ *   NV_ERR_NOT_SUPPORTED
+ */
+#define NV2080_CTRL_CMD_GSP_GET_RPC_PROFILE (0x20803603) /* finn: Evaluated from "(FINN_NV20_SUBDEVICE_0_GSP_INTERFACE_ID << 8) | NV2080_CTRL_GSP_GET_RPC_PROFILE_PARAMS_MESSAGE_ID" */
+
+#define NV2080_CTRL_GSP_RPC_PROFILE_HIST_BUCKETS  (24)
+#define NV2080_CTRL_GSP_RPC_PROFILE_MAX_FUNCTIONS (64)
+#define NV2080_CTRL_GSP_RPC_PROFILE_RING_ENTRIES  (64)
+
+/*
+ * NV2080_CTRL_GSP_RPC_PROFILE_FUNC
+ *
+ * Latency accumulator for one RPC function number.
+ *
+ *  function
+ *    RPC function number (NV_VGPU_MSG_FUNCTION_*).
+ *  maxUs
+ *    Largest observed round-trip duration, in microseconds.
+ *  count
+ *    Number of completed RPCs of this type.
+ *  totalUs
+ *    Sum of round-trip durations, in microseconds.
+ */
+typedef struct NV2080_CTRL_GSP_RPC_PROFILE_FUNC {
+    NvU32 function;
+    NvU32 maxUs;
+    NV_DECLARE_ALIGNED(NvU64 count, 8);
+    NV_DECLARE_ALIGNED(NvU64 totalUs, 8);
+} NV2080_CTRL_GSP_RPC_PROFILE_FUNC;
+
+/*
+ * NV2080_CTRL_GSP_RPC_PROFILE_RING_ENTRY
+ *
+ * One completed RPC from the trace ring.
+ *
+ *  function
+ *    RPC function number (NV_VGPU_MSG_FUNCTION_*).
+ *  durationUs
+ *    Round-trip duration, in microseconds.
+ *  tsStart
+ *    Submission timestamp, in osGetTimestamp() units.
+ */
+typedef struct NV2080_CTRL_GSP_RPC_PROFILE_RING_ENTRY {
+    NvU32 function;
+    NvU32 durationUs;
+    NV_DECLARE_ALIGNED(NvU64 tsStart, 8);
+} NV2080_CTRL_GSP_RPC_PROFILE_RING_ENTRY;
+
+#define NV2080_CTRL_GSP_GET_RPC_PROFILE_PARAMS_MESSAGE_ID (0x3U)
+
+typedef struct NV2080_CTRL_GSP_GET_RPC_PROFILE_PARAMS {
+    NV_DECLARE_ALIGNED(NvU64 histogram[NV2080_CTRL_GSP_RPC_PROFILE_HIST_BUCKETS], 8);
+    NvU32 numFunctions;
+    NvU32 numRingEntries;
+    NV_DECLARE_ALIGNED(NV2080_CTRL_GSP_RPC_PROFILE_FUNC functions[NV2080_CTRL_GSP_RPC_PROFILE_MAX_FUNCTIONS], 8);
+    NV_DECLARE_ALIGNED(NV2080_CTRL_GSP_RPC_PROFILE_RING_ENTRY ring[NV2080_CTRL_GSP_RPC_PROFILE_RING_ENTRIES], 8);
+} NV2080_CTRL_GSP_GET_RPC_PROFILE_PARAMS;
+
 // _ctrl2080gsp_h_
@@ -321,4 +321,36 @@ typedef struct NV2080_CTRL_MC_GET_STATIC_INTR_TABLE_PARAMS {
     NV2080_CTRL_MC_STATIC_INTR_ENTRY entries[NV2080_CTRL_MC_GET_STATIC_INTR_TABLE_MAX];
 } NV2080_CTRL_MC_GET_STATIC_INTR_TABLE_PARAMS;
 
+/*
+ * NV2080_CTRL_CMD_MC_GET_INTR_VECTOR_COUNTERS
+ *
+ * This command returns the per-vector stall interrupt counters accumulated
+ * by kernel RM since the interrupt table was last (re)initialized. The
+ * counter for a given NV_CTRL tree interrupt vector is incremented each
+ * time that vector is observed pending while scanning the stall interrupt
+ * leaf registers.
+ *
+ *   numVectors [out]
+ *     Number of valid entries in the counters array. Zero when the
+ *     per-vector dispatch table is not in use on this GPU.
+ *
+ *   counters [out]
+ *     counters[v] is the number of times interrupt vector v was observed
+ *     pending.
+ *
+ * Possible status values returned are:
+ *   NV_OK
+ *   NV_ERR_NOT_SUPPORTED
+ */
+#define NV2080_CTRL_CMD_MC_GET_INTR_VECTOR_COUNTERS (0x2080170f) /* finn: Evaluated from "(FINN_NV20_SUBDEVICE_0_MC_INTERFACE_ID << 8) | NV2080_CTRL_MC_GET_INTR_VECTOR_COUNTERS_PARAMS_MESSAGE_ID" */
+
+#define NV2080_CTRL_MC_INTR_VECTOR_COUNTERS_MAX     512
+
+#define NV2080_CTRL_MC_GET_INTR_VECTOR_COUNTERS_PARAMS_MESSAGE_ID (0xFU)
+
+typedef struct NV2080_CTRL_MC_GET_INTR_VECTOR_COUNTERS_PARAMS {
+    NvU32 numVectors;
+    NV_DECLARE_ALIGNED(NvU64 counters[NV2080_CTRL_MC_INTR_VECTOR_COUNTERS_MAX], 8);
+} NV2080_CTRL_MC_GET_INTR_VECTOR_COUNTERS_PARAMS;
+
 /* _ctrl2080mc_h_ */
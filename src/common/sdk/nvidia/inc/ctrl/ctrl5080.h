@@ -208,5 +208,37 @@ typedef struct NV5080_CTRL_REMOVE_API_PARAMS {
     NvHandle hApiHandle;
 } NV5080_CTRL_REMOVE_API_PARAMS;
 
+/*
+ * NV5080_CTRL_CMD_DEFERRED_API_ASYNC
+ *
+ * This command registers a deferred api call like
+ * NV5080_CTRL_CMD_DEFERRED_API_V2, but instead of waiting for a software
+ * method to trigger it, the call is queued for asynchronous execution in a
+ * kernel work item and the control returns immediately. All calls queued on
+ * the same object since the last work item ran are executed under a single
+ * lock acquisition. Completion is reported through the object's notifier
+ * (allocate the object with notifyCompletion and register an NV01_EVENT
+ * against it); the notification status carries the status of the first
+ * failing queued call, or NV_OK if all of them succeeded.
+ *    api
+ *      The deferred api call to queue; see
+ *      NV5080_CTRL_DEFERRED_API_V2_PARAMS. flags_delete applies once the
+ *      call has executed, exactly as it does for the software method
+ *      trigger.
+ * Possible status values returned are:
+ *   NV_OK
+ *   NV_ERR_INVALID_OBJECT_HANDLE
+ *   NV_ERR_NO_MEMORY
+ *   NV_ERR_NOT_SUPPORTED
+ */
+
+#define NV5080_CTRL_CMD_DEFERRED_API_ASYNC (0x50800104) /* finn: Evaluated from "(FINN_NV50_DEFERRED_API_CLASS_DEFERRED_INTERFACE_ID << 8) | NV5080_CTRL_DEFERRED_API_ASYNC_PARAMS_MESSAGE_ID" */
+
+#define NV5080_CTRL_DEFERRED_API_ASYNC_PARAMS_MESSAGE_ID (0x4U)
+
+typedef struct NV5080_CTRL_DEFERRED_API_ASYNC_PARAMS {
+    NV_DECLARE_ALIGNED(NV5080_CTRL_DEFERRED_API_V2_PARAMS api, 8);
+} NV5080_CTRL_DEFERRED_API_ASYNC_PARAMS;
+
 /* _ctrl5080_h_ */
 
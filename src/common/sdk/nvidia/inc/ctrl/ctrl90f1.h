@@ -404,4 +404,72 @@ typedef struct NV90F1_CTRL_VASPACE_GET_VAS_HEAP_INFO_PARAMS {
     NvU32    numFreeBlocks;
 } NV90F1_CTRL_VASPACE_GET_VAS_HEAP_INFO_PARAMS;
 
+/*!
+ * Map a batch of virtual memory allocations on this VAS in a single call.
+ *
+ * Each entry behaves like an individual NvRmMapMemoryDma() call except that
+ * the per-map TLB invalidate is deferred and a single invalidate is issued
+ * once the whole batch has been processed.
+ *
+ * The batch is all-or-nothing: if any entry fails, mappings made by the
+ * preceding entries are torn down and failedEntry reports the offending
+ * index.
+ */
+#define NV90F1_CTRL_CMD_VASPACE_MAP_BATCH         (0x90f10109U) /* finn: Evaluated from "(FINN_FERMI_VASPACE_A_VASPACE_INTERFACE_ID << 8) | NV90F1_CTRL_VASPACE_MAP_BATCH_PARAMS_MESSAGE_ID" */
+
+#define NV90F1_CTRL_VASPACE_MAP_BATCH_MAX_ENTRIES 64U
+
+typedef struct NV90F1_CTRL_VASPACE_MAP_BATCH_ENTRY {
+    /*!
+     * [in] Virtual memory allocation (mapper) on this VAS.
+     */
+    NvHandle hVirtualMemory;
+
+    /*!
+     * [in] Physical memory allocation to map.
+     */
+    NvHandle hMemory;
+
+    /*!
+     * [in] NVOS46_FLAGS_* for this mapping. DEFER_TLB_INVALIDATION is
+     *      forced on for every entry.
+     */
+    NvU32    flags;
+
+    /*!
+     * [in] Offset into hMemory at which the mapping starts.
+     */
+    NV_DECLARE_ALIGNED(NvU64 offset, 8);
+
+    /*!
+     * [in] Length of the mapping.
+     */
+    NV_DECLARE_ALIGNED(NvU64 length, 8);
+
+    /*!
+     * [in/out] Mapped GPU virtual offset. Input only when
+     *          NVOS46_FLAGS_DMA_OFFSET_FIXED is set.
+     */
+    NV_DECLARE_ALIGNED(NvU64 dmaOffset, 8);
+} NV90F1_CTRL_VASPACE_MAP_BATCH_ENTRY;
+
+#define NV90F1_CTRL_VASPACE_MAP_BATCH_PARAMS_MESSAGE_ID (0x9U)
+
+typedef struct NV90F1_CTRL_VASPACE_MAP_BATCH_PARAMS {
+    /*!
+     * [in] Number of valid entries in the entries array.
+     */
+    NvU32 numEntries;
+
+    /*!
+     * [out] Index of the first entry that failed. Valid only on error.
+     */
+    NvU32 failedEntry;
+
+    /*!
+     * [in/out] The mappings to perform.
+     */
+    NV_DECLARE_ALIGNED(NV90F1_CTRL_VASPACE_MAP_BATCH_ENTRY entries[NV90F1_CTRL_VASPACE_MAP_BATCH_MAX_ENTRIES], 8);
+} NV90F1_CTRL_VASPACE_MAP_BATCH_PARAMS;
+
 /* _ctrl90f1_h_ */
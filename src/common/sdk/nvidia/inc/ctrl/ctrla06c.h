@@ -363,6 +363,39 @@ typedef struct NVA06C_CTRL_INTERNAL_PROMOTE_FAULT_METHOD_BUFFERS_PARAMS {
     NvU32 numValidEntries;
 } NVA06C_CTRL_INTERNAL_PROMOTE_FAULT_METHOD_BUFFERS_PARAMS;
 
+/*
+ * NVA06C_CTRL_CMD_BIND_AND_SCHEDULE
+ *
+ * This command binds every channel in the group to the given engine and then
+ * schedules the group in hardware, issuing a single scheduling update for the
+ * whole group instead of one per channel.  It is equivalent to a call to
+ * NVA06C_CTRL_CMD_BIND followed by NVA06C_CTRL_CMD_GPFIFO_SCHEDULE and is
+ * intended for clients that launch wide multi-channel workloads and are
+ * sensitive to the serialization of per-call scheduling updates.
+ *
+ * engineType
+ *   The engine to configure the group for.  See NVA06C_CTRL_CMD_BIND.
+ *
+ * bEnable
+ * bSkipSubmit
+ *   See NVA06F_CTRL_CMD_GPFIFO_SCHEDULE.
+ *
+ * Possible status values returned are:
+ *   NV_OK
+ *   NV_ERR_INVALID_ARGUMENT
+ *   NV_ERR_INVALID_STATE
+ *   NV_ERR_INVALID_OPERATION
+ */
+#define NVA06C_CTRL_CMD_BIND_AND_SCHEDULE (0xa06c010b) /* finn: Evaluated from "(FINN_KEPLER_CHANNEL_GROUP_A_GPFIFO_INTERFACE_ID << 8) | NVA06C_CTRL_BIND_AND_SCHEDULE_PARAMS_MESSAGE_ID" */
+
+#define NVA06C_CTRL_BIND_AND_SCHEDULE_PARAMS_MESSAGE_ID (0xbU)
+
+typedef struct NVA06C_CTRL_BIND_AND_SCHEDULE_PARAMS {
+    NvU32  engineType;
+    NvBool bEnable;
+    NvBool bSkipSubmit;
+} NVA06C_CTRL_BIND_AND_SCHEDULE_PARAMS;
+
 /*
  * NVA06C_CTRL_CMD_MAKE_REALTIME
  *
@@ -479,6 +479,98 @@ typedef struct
     NvV32    status;                              // [OUT] status
 } NVOS64_PARAMETERS;
 
+/* Batched NV04_ALLOC
+ *
+ * Submits a dependency-ordered list of allocations in one call. Entries are
+ * processed in order under a single RM API lock acquisition; processing stops
+ * at the first failing entry, since later entries typically depend on handles
+ * created by earlier ones. Entries that were not attempted report
+ * NV_ERR_INVALID_STATE in their per-entry status.
+ */
+#define NV_BATCH_ALLOC_MAX_ENTRIES 64
+
+typedef struct
+{
+    NvHandle hRoot;                               // [IN] client handle
+    NvHandle hObjectParent;                       // [IN] parent handle of new object
+    NvHandle hObjectNew;                          // [INOUT] new object handle, 0 to generate
+    NvV32    hClass;                              // [IN] class num of new object
+    NvP64    pAllocParms NV_ALIGN_BYTES(8);       // [IN] class-specific alloc parameters
+    NvU32    paramsSize;                          // [IN] Size of alloc params
+    NvV32    status;                              // [OUT] status of this allocation
+} NVOS_BATCH_ALLOC_ENTRY;
+
+typedef struct
+{
+    NvU32    numEntries;                          // [IN] number of entries at pEntries
+    NvP64    pEntries NV_ALIGN_BYTES(8);          // [INOUT] array of NVOS_BATCH_ALLOC_ENTRY
+    NvV32    status;                              // [OUT] status of the batch
+} NVOS_BATCH_ALLOC_PARAMETERS;
+
+/* Batched NV04_CONTROL
+ *
+ * Submits a list of control calls in one user/kernel crossing. Entries are
+ * processed in order under a single RM API lock acquisition. Unlike the
+ * batched alloc, entries are independent: every entry is attempted and
+ * reports its own status, while the batch status reflects setup failures
+ * only. Controls serviced by deprecated-API handlers are not supported in
+ * a batch and fail with NV_ERR_NOT_SUPPORTED in their per-entry status.
+ */
+#define NV_BATCH_CONTROL_MAX_ENTRIES 64
+
+typedef struct
+{
+    NvHandle hClient;                             // [IN] client handle
+    NvHandle hObject;                             // [IN] object handle
+    NvV32    cmd;                                 // [IN] control command number
+    NvU32    flags;                               // [IN] NVOS54_FLAGS_*
+    NvP64    params NV_ALIGN_BYTES(8);            // [INOUT] control parameters
+    NvU32    paramsSize;                          // [IN] Size of control parameters
+    NvV32    status;                              // [OUT] status of this control
+} NVOS_BATCH_CONTROL_ENTRY;
+
+typedef struct
+{
+    NvU32    numEntries;                          // [IN] number of entries at pEntries
+    NvP64    pEntries NV_ALIGN_BYTES(8);          // [INOUT] array of NVOS_BATCH_CONTROL_ENTRY
+    NvV32    status;                              // [OUT] status of the batch
+} NVOS_BATCH_CONTROL_PARAMETERS;
+
+/* Driver microbenchmarks
+ *
+ * Runs a fixed number of iterations of one in-kernel hot-path operation on
+ * the GPU the ioctl was issued against and reports the elapsed wall time,
+ * so driver performance regressions can be caught by comparing successive
+ * builds. Administrator-only.
+ */
+
+/*
+ * Returns immediately; time the ioctl round trip from userspace to measure
+ * the raw ioctl entry and escape dispatch overhead.
+ */
+#define NV_PERF_BENCHMARK_NOP                     0x00000000
+/* memdescCreate/memdescDestroy cycles of a 64KB sysmem descriptor */
+#define NV_PERF_BENCHMARK_MEMDESC_CREATE_DESTROY  0x00000001
+/* PMA alloc/free cycles of one contiguous 64KB video memory page */
+#define NV_PERF_BENCHMARK_PMA_ALLOC_FREE          0x00000002
+/*
+ * Read-only RM control round trips through the control dispatch path; on
+ * GSP-offloaded systems each iteration is a full message queue round trip
+ * to GSP
+ */
+#define NV_PERF_BENCHMARK_CONTROL_ROUNDTRIP       0x00000003
+
+#define NV_PERF_BENCHMARK_MAX_ITERATIONS          0x01000000
+
+typedef struct
+{
+    NvU32    benchmark;                           // [IN] NV_PERF_BENCHMARK_*
+    NvU32    iterations;                          // [IN] iterations to run
+    NvU64    totalNs NV_ALIGN_BYTES(8);           // [OUT] elapsed wall time
+    NvU64    ops NV_ALIGN_BYTES(8);               // [OUT] completed iterations
+    NvV32    status;                              // [OUT] status of the run
+} NVOS_PERF_BENCHMARK_PARAMETERS;
+
 /* RM Alloc header
  *
  * Replacement for NVOS21/64_PARAMETERS where embedded pointers are not allowed.
@@ -2516,6 +2608,13 @@ typedef struct
     NvU32 caps;
 } NV_ME_ALLOCATION_PARAMETERS;
 
+//
+// Placement hint for the video engine allocation parameters below. Passing
+// this value in engineInstance asks RM to place the allocation on the engine
+// instance with the fewest active contexts instead of a fixed instance.
+//
+#define NV_ALLOC_ENGINE_INSTANCE_ANY        (0xFFFFFFFF)
+
 typedef struct
 {
     NvU32 size;
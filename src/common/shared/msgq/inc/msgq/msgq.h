@@ -137,6 +137,10 @@ int msgqRxLink(msgqHandle handle, const void *pBackingStore, unsigned size,
  *
  * WARING: This function doesn NOT flush caches. It's fast, but in reality
  * there may be more space than is reported.
+ *
+ * The shared read pointer is only re-read when the cached count is zero;
+ * a non-zero cached count is returned as-is, as it is a valid lower bound.
+ * Use msgqTxSync() to force a refresh.
  */
 unsigned msgqTxGetFreeSpace(msgqHandle handle);
 
@@ -187,6 +191,10 @@ unsigned msgqTxGetPending(msgqHandle handle);
  * @brief Get number of unread messages in RX channel
  * @param handle
  * @return Number of messages. 0 if queue is empty or not linked.
+ *
+ * The shared write pointer is only re-read when the cached count is zero;
+ * a non-zero cached count is returned as-is, as it is a valid lower bound.
+ * Use msgqRxSync() to force a refresh.
  */
 unsigned msgqRxGetReadAvailable(msgqHandle handle);
 
@@ -441,16 +441,16 @@ msgqRxLink(msgqHandle handle, const void *pBackingStore, unsigned size, unsigned
  *
  */
 
-sysSHARED_CODE unsigned
-msgqTxGetFreeSpace(msgqHandle handle)
+/**
+ * @brief Re-read the peer read pointer and recompute the free element count.
+ *
+ * The incoming read pointer may live in uncached or bus-resident memory, so
+ * this is the costly path; callers that can make do with the cached count
+ * should avoid it.
+ */
+sysSHARED_CODE static unsigned
+_msgqTxRefreshFreeSpace(msgqMetadata *pQueue)
 {
-    msgqMetadata *pQueue = (msgqMetadata*)handle;
-
-    if ((pQueue == NULL) || !pQueue->txLinked)
-    {
-        return 0;
-    }
-
     _backendRead32(pQueue, pQueue->pReadIncoming, &pQueue->txReadPtr,
         pQueue->rxSwapped ? FCN_FLAG_BACKEND_QUEUE_RX : FCN_FLAG_BACKEND_QUEUE_TX);
     if (pQueue->txReadPtr >= pQueue->tx.msgCount)
@@ -469,6 +469,31 @@ msgqTxGetFreeSpace(msgqHandle handle)
     return pQueue->txFree;
 }
 
+sysSHARED_CODE unsigned
+msgqTxGetFreeSpace(msgqHandle handle)
+{
+    msgqMetadata *pQueue = (msgqMetadata*)handle;
+
+    if ((pQueue == NULL) || !pQueue->txLinked)
+    {
+        return 0;
+    }
+
+    //
+    // The peer can only grow the free space, and local submits keep the
+    // cached count up to date, so a non-zero cached value is a valid lower
+    // bound and the backend read can be skipped.  Only a cache showing no
+    // room requires going out to the shared read pointer.  Use msgqTxSync
+    // to force a refresh.
+    //
+    if (pQueue->txFree != 0)
+    {
+        return pQueue->txFree;
+    }
+
+    return _msgqTxRefreshFreeSpace(pQueue);
+}
+
 sysSHARED_CODE void *
 msgqTxGetWriteBuffer(msgqHandle handle, unsigned n)
 {
@@ -487,7 +512,7 @@ msgqTxGetWriteBuffer(msgqHandle handle, unsigned n)
     // msgqTxGetFreeSpace can be a very costly operation.
     //
     if ((n >= pQueue->txFree) &&
-        (n >= msgqTxGetFreeSpace(handle)))
+        (n >= _msgqTxRefreshFreeSpace(pQueue)))
     {
         return NULL;
     }
@@ -512,7 +537,7 @@ msgqTxSubmitBuffers(msgqHandle handle, unsigned n)
     }
 
     if ((n > pQueue->txFree) &&
-        (n > msgqTxGetFreeSpace(handle)))
+        (n > _msgqTxRefreshFreeSpace(pQueue)))
     {
         return -1;
     }
@@ -574,7 +599,7 @@ msgqTxSync(msgqHandle handle) // "transmit"
         pQueue->fcnInvalidate((void*)pQueue->pReadIncoming, sizeof(NvU32));
     }
 
-    return msgqTxGetFreeSpace(handle);
+    return _msgqTxRefreshFreeSpace(pQueue);
 }
 
 sysSHARED_CODE unsigned
@@ -596,16 +621,15 @@ msgqTxGetPending(msgqHandle handle)
  *
  */
 
-sysSHARED_CODE unsigned
-msgqRxGetReadAvailable(msgqHandle handle)
+/**
+ * @brief Re-read the peer write pointer and recompute the available count.
+ *
+ * As with _msgqTxRefreshFreeSpace, the incoming write pointer may be costly
+ * to read; callers that can make do with the cached count should avoid it.
+ */
+sysSHARED_CODE static unsigned
+_msgqRxRefreshReadAvailable(msgqMetadata *pQueue)
 {
-    msgqMetadata *pQueue = (msgqMetadata*)handle;
-
-    if ((pQueue == NULL) || !pQueue->rxLinked)
-    {
-        return 0;
-    }
-
     _backendRead32(pQueue, pQueue->pWriteIncoming, &pQueue->rx.writePtr, FCN_FLAG_BACKEND_QUEUE_RX);
     if (pQueue->rx.writePtr >= pQueue->rx.msgCount)
     {
@@ -623,6 +647,31 @@ msgqRxGetReadAvailable(msgqHandle handle)
     return pQueue->rxAvail;
 }
 
+sysSHARED_CODE unsigned
+msgqRxGetReadAvailable(msgqHandle handle)
+{
+    msgqMetadata *pQueue = (msgqMetadata*)handle;
+
+    if ((pQueue == NULL) || !pQueue->rxLinked)
+    {
+        return 0;
+    }
+
+    //
+    // The peer can only add messages, and local consumes keep the cached
+    // count up to date, so a non-zero cached value is a valid lower bound
+    // and the backend read can be skipped.  Only an apparently empty queue
+    // requires going out to the shared write pointer.  Use msgqRxSync to
+    // force a refresh.
+    //
+    if (pQueue->rxAvail != 0)
+    {
+        return pQueue->rxAvail;
+    }
+
+    return _msgqRxRefreshReadAvailable(pQueue);
+}
+
 sysSHARED_CODE const void *
 msgqRxGetReadBuffer(msgqHandle handle, unsigned n)
 {
@@ -641,7 +690,7 @@ msgqRxGetReadBuffer(msgqHandle handle, unsigned n)
     // rx.writePtr, msgqRxGetReadAvailable can be a very costly operation.
     //
     if ((n >= pQueue->rxAvail) &&
-        (n >= msgqRxGetReadAvailable(handle)))
+        (n >= _msgqRxRefreshReadAvailable(pQueue)))
     {
         return NULL;
     }
@@ -666,7 +715,7 @@ msgqRxMarkConsumed(msgqHandle handle, unsigned n)
     }
 
     if ((n > pQueue->rxAvail) &&
-        (n > msgqRxGetReadAvailable(handle)))
+        (n > _msgqRxRefreshReadAvailable(pQueue)))
     {
         return -1;
     }
@@ -725,5 +774,5 @@ msgqRxSync(msgqHandle handle)
         pQueue->fcnInvalidate((void*)pQueue->pWriteIncoming, sizeof(NvU32));
     }
 
-    return msgqRxGetReadAvailable(handle);
+    return _msgqRxRefreshReadAvailable(pQueue);
 }
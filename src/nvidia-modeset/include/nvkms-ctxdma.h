@@ -34,6 +34,11 @@ void nvCtxDmaFreeSyncptHandle(NVDevEvoRec *pDevEvo, NVEvoSyncpt *pSyncpt);
 
 NvU32 nvCtxDmaBind(NVDevEvoPtr pDevEvo, NVEvoChannelPtr pChannel, NvU32 hCtxDma);
 
+NvU32 nvCtxDmaBindChannels(NVDevEvoPtr pDevEvo,
+                           NVEvoChannelPtr const *pChannels,
+                           NvU32 numChannels,
+                           NvU32 hCtxDma);
+
 void nvCtxDmaFree(NVDevEvoPtr pDevEvo, NvU32 deviceHandle, NvU32 *hDispCtxDma);
 
 NvU32 nvCtxDmaAlloc(NVDevEvoPtr pDevEvo, NvU32 *pCtxDmaHandle,
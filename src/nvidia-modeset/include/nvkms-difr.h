@@ -37,6 +37,9 @@ NvU32               nvDIFRPrefetchSurfaces(NVDIFRStateEvoPtr pDifr,
                                            size_t l2CacheSize);
 NvBool              nvDIFRSendPrefetchResponse(NVDIFRStateEvoPtr pDifr,
                                                NvU32 responseStatus);
+NvBool              nvDIFRGetPrefetchLatencyHistogram(
+                        const NVDIFRStateEvoRec *pDifr,
+                        NvS64 *pValue);
 
 #ifdef __cplusplus
 };
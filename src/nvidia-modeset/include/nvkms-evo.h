@@ -44,6 +44,8 @@ void nvEvoAttachConnector(NVConnectorEvoRec *pConnectorEvo,
                           NVEvoModesetUpdateState *pModesetUpdateState);
 void nvEvoUpdateAndKickOff(const NVDispEvoRec *pDispEvo, NvBool sync,
                            NVEvoUpdateState *updateState, NvBool releaseElv);
+void nvEvoBeginUpdateTransaction(const NVDispEvoRec *pDispEvo);
+void nvEvoEndUpdateTransaction(const NVDispEvoRec *pDispEvo);
 void nvDoIMPUpdateEvo(NVDispEvoPtr pDispEvo,
                       NVEvoUpdateState *updateState);
 void nvEvoFlipUpdate(NVDispEvoPtr pDispEvo,
@@ -232,6 +234,8 @@ NvBool nvValidateImpOneDispDowngrade(
     NVEvoReallocateBandwidthMode            reallocBandwidth,
     NvU32                                   downgradePossibleHeadsBitMask);
 
+void nvFreeImpMemoEvo(NVDispEvoPtr pDispEvo);
+
 NvBool nvFrameLockServerPossibleEvo(const NVDpyEvoRec *pDpyEvo);
 NvBool nvFrameLockClientPossibleEvo(const NVDpyEvoRec *pDpyEvo);
 
@@ -63,6 +63,13 @@ void nvHs3dReleaseSemaphore(
     const NvU32 payload,
     const NvBool allPreceedingReads);
 
+void nvHs3dAcquireSemaphore(
+    NVHsChannelEvoPtr pHsChannel,
+    const NVSurfaceEvoRec *pSurfaceEvo,
+    const enum NvKmsNIsoFormat nIsoFormat,
+    const NvU16 offsetInWords,
+    const NvU32 payload);
+
 NvU32 nvHs3dLastRenderedOffset(NVHsChannelEvoPtr pHsChannel);
 
 void nvHs3dPushPendingViewportFlip(NVHsChannelEvoPtr pHsChannel);
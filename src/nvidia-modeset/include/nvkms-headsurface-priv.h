@@ -434,6 +434,34 @@ static inline NvU16 HsGetFrameSemaphoreOffsetInWords(
     return offsetInBytes / 4;
 }
 
+/*!
+ * Get the offset, in words, of the frame semaphore used by the most recently
+ * pushed flip: i.e., (head, frameSemaphoreIndex - 1).
+ *
+ * The display hardware releases this semaphore back to
+ * NVKMS_HEAD_SURFACE_FRAME_SEMAPHORE_RENDERABLE when that flip latches, so it
+ * can be used to interlock rendering of the next frame with the flip away from
+ * the render target buffer.
+ */
+static inline NvU16 HsGetPreviousFrameSemaphoreOffsetInWords(
+    const NVHsChannelEvoRec *pHsChannel)
+{
+    const NvU8 previousFrameSemaphoreIndex =
+        A_minus_b_with_wrap_U8(pHsChannel->frameSemaphoreIndex, 1,
+                               NVKMS_HEAD_SURFACE_MAX_FRAME_SEMAPHORES);
+
+    const NvU16 semBase =
+        offsetof(NVHsNotifiersOneSdRec, semaphore[pHsChannel->apiHead]);
+    const NvU16 semOffset = sizeof(NvGpuSemaphore) *
+        previousFrameSemaphoreIndex;
+
+    const NvU16 offsetInBytes = semBase + semOffset;
+
+    nvAssert((offsetInBytes % 4) == 0);
+
+    return offsetInBytes / 4;
+}
+
 static inline void HsIncrementFrameSemaphoreIndex(
     NVHsChannelEvoRec *pHsChannel)
 {
@@ -30,6 +30,17 @@ extern "C" {
 
 #include "nvkms-types.h"
 
+/*
+ * The NVEvoLutDataRec passed to nvUploadDataToLutSurfaceEvo() contains two
+ * independently updated segments.  Callers describe which segments contain
+ * new data with a mask of the following, so that partial LUT updates only
+ * copy the changed ranges.
+ */
+#define NVKMS_LUT_SEGMENT_BASE      NVBIT(0)
+#define NVKMS_LUT_SEGMENT_OUTPUT    NVBIT(1)
+#define NVKMS_LUT_SEGMENT_ALL       (NVKMS_LUT_SEGMENT_BASE | \
+                                     NVKMS_LUT_SEGMENT_OUTPUT)
+
 NvBool nvSetTmoLutSurfacesEvo(NVDevEvoPtr pDevEvo,
                               NVFlipEvoHwState *pFlipState,
                               NvU32 head);
@@ -46,7 +57,8 @@ void nvFreeLutSurfacesEvo(NVDevEvoPtr pDevEvo);
 
 void nvUploadDataToLutSurfaceEvo(NVLutSurfaceEvoPtr pSurfEvo,
                                  const NVEvoLutDataRec *pLUTBuffer,
-                                 NVDispEvoPtr pDispEvo);
+                                 NVDispEvoPtr pDispEvo,
+                                 NvU32 dirtySegmentMask);
 
 static inline void nvCancelLutUpdateEvo(
     const NVDispEvoRec *pDispEvo,
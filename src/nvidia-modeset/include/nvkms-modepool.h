@@ -57,6 +57,8 @@ const NVT_TIMING *nvFindEdidNVT_TIMING(
     const NvModeTimings *pModeTimings,
     const struct NvKmsModeValidationParams *pParams);
 
+void nvFreeModeValidationCache(NVDispEvoPtr pDispEvo);
+
 #ifdef __cplusplus
 };
 #endif
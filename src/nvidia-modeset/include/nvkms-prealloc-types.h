@@ -46,9 +46,32 @@ enum NVPreallocType {
     PREALLOC_TYPE_MAX
 };
 
+/* Smallest slab payload size, in bytes; class i holds slabs of this << i. */
+#define NV_PREALLOC_POOL_MIN_SLAB_SIZE      1024
+
+/* Number of slab size classes: 1KB through 128KB. */
+#define NV_PREALLOC_POOL_NUM_CLASSES        8
+
+/* Maximum number of free slabs cached per size class. */
+#define NV_PREALLOC_POOL_MAX_CACHED_SLABS   4
+
+/*
+ * One slab size class: a small stack of cached free slabs plus the
+ * bookkeeping needed to trim the cache back to the recently observed high
+ * watermark of concurrent users.
+ */
+struct NVPreallocPoolClassRec {
+    void *freeSlab[NV_PREALLOC_POOL_MAX_CACHED_SLABS];
+    NvU8 numFree;
+    NvU8 numOutstanding;
+    NvU8 highWater;
+    NvU8 putsSinceTrim;
+};
+
 struct NVDevPreallocRec {
     void *ptr[PREALLOC_TYPE_MAX];
     NvU8 used[(PREALLOC_TYPE_MAX + 7) / 8];
+    struct NVPreallocPoolClassRec pool[NV_PREALLOC_POOL_NUM_CLASSES];
 };
 
 #endif /* __NVKMS_PREALLOC_TYPES_H__ */
@@ -34,6 +34,9 @@ extern "C" {
 void *nvPreallocGet(NVDevEvoPtr pDevEvo, enum NVPreallocType type, size_t sizeCheck);
 void nvPreallocRelease(NVDevEvoPtr pDevEvo, enum NVPreallocType type);
 
+void *nvPreallocPoolGet(NVDevEvoPtr pDevEvo, size_t size);
+void nvPreallocPoolPut(NVDevEvoPtr pDevEvo, void *ptr);
+
 NvBool nvPreallocAlloc(NVDevEvoPtr pDevEvo);
 void nvPreallocFree(NVDevEvoPtr pDevEvo);
 
@@ -71,6 +71,15 @@ const NVEvoApiHandlesRec *nvGetSurfaceHandlesFromOpenDevConst(
 
 void nvKmsServiceNonStallInterrupt(void *dataPtr, NvU32 dataU32);
 
+/*
+ * Tear down any armed cursor motion fast paths referencing pDevEvo (or
+ * all devices, if pDevEvo is NULL), and wait for movers currently inside
+ * the fast path to drain.  Must be called with the global lock held,
+ * before changing state the fast path reads: head configuration, cursor
+ * PIO mappings, headSurface configuration, or VRR active state.
+ */
+void nvKmsQuiesceCursorFastPath(const NVDevEvoRec *pDevEvo);
+
 #ifdef __cplusplus
 };
 #endif
@@ -54,6 +54,25 @@ NvU32 nvRmApiControl(
     void *pParams,
     NvU32 paramsSize);
 
+/*
+ * Issue the same RM control to hObject once per element of the pParams
+ * array (numOps parameter structs, each paramsSize bytes), crossing the
+ * OS interface once per batch rather than once per call.
+ *
+ * All operations are submitted even if an earlier one fails.  Returns
+ * NVOS_STATUS_SUCCESS if every operation succeeded; otherwise returns
+ * the status of the first failing operation.  If pStatuses is non-NULL,
+ * it receives the individual status of each of the numOps operations.
+ */
+NvU32 nvRmApiControlBatch(
+    NvU32 hClient,
+    NvU32 hObject,
+    NvU32 cmd,
+    void *pParams,
+    NvU32 paramsSize,
+    NvU32 numOps,
+    NvU32 *pStatuses);
+
 NvU32 nvRmApiDupObject2(
     NvU32 hClient,
     NvU32 hParent,
@@ -88,6 +88,17 @@ NvBool nvEvoAccelVblankSemControls(
     NvU32 dispIndex,
     NvU32 hwHeadMask);
 
+NVVblankInfoControl *nvEvoEnableVblankInfoControl(
+    NVDevEvoRec *pDevEvo,
+    NVDispEvoRec *pDispEvo,
+    NvU32 apiHead,
+    NVSurfaceEvoRec *pSurfaceEvo,
+    NvU64 surfaceOffset);
+
+NvBool nvEvoDisableVblankInfoControl(
+    NVDevEvoRec *pDevEvo,
+    NVVblankInfoControl *pVblankInfoControl);
+
 static inline NvBool nvEvoIsSurfaceOwner(const NVSurfaceEvoRec *pSurfaceEvo,
                                          const struct NvKmsPerOpenDev *pOpenDev,
                                          NvKmsSurfaceHandle surfaceHandle)
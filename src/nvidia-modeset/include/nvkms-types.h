@@ -68,6 +68,13 @@ extern "C" {
 #endif
 
 #define NV_DMA_EVO_PUSH_BUFFER_SIZE         (4 * 1024)
+/*
+ * Flip-carrying channels (base and window) get a larger pushbuffer: method
+ * consumption in those channels is paced by scanout, so a burst of queued
+ * flips can fill a small ring and stall method generation in nvEvoMakeRoom()
+ * waiting for GET to advance.
+ */
+#define NV_DMA_EVO_FLIP_PUSH_BUFFER_SIZE    (16 * 1024)
 #define NV_DMA_EVO_PUSH_BUFFER_PAD_SIZE     (4 * 12)
 #define NV_DMA_EVO_NOTIFIER_SIZE            4096
 
@@ -152,6 +159,7 @@ typedef struct _NVSwapGroupRec *NVSwapGroupPtr;
 typedef struct _NVEvoModesetUpdateState NVEvoModesetUpdateState;
 typedef struct _NVLockGroup NVLockGroup;
 typedef struct _NVVblankSemControl *NVVblankSemControlPtr;
+typedef struct _NVVblankInfoControl *NVVblankInfoControlPtr;
 
 /*
  * _NVHs*EvoRec are defined in nvkms-headsurface-priv.h; they are intentionally
@@ -802,6 +810,12 @@ typedef struct _NVEvoSubDevRec {
     NVEvoHeadControl            headControl[NVKMS_MAX_HEADS_PER_DISP];
     NVEvoHeadControl            headControlAssy[NVKMS_MAX_HEADS_PER_DISP];
     void                       *cursorPio[NVKMS_MAX_HEADS_PER_DISP];
+    /*
+     * Serializes access to cursorPio[head]: the cursor PIO may be
+     * written both under the global NVKMS lock and from the lockless
+     * cursor motion fast path; claimed with an atomic exchange.
+     */
+    NvU32                       cursorPioBusy[NVKMS_MAX_HEADS_PER_DISP];
     NvBool                      (*scanLockState)(NVDispEvoPtr pDispEvo,
                                                  NVEvoSubDevPtr pEvoSubDev,
                                                  NvU32 action,
@@ -1059,6 +1073,20 @@ typedef struct _NVEvoDevRec {
     NVEvoCoreChannelDmaRec coreChannelDma;
     NvU32               nvkmsGpuVASpace;
 
+    /*
+     * Open update transaction, if any.  While updateTransaction.pDispEvo is
+     * non-NULL, nvEvoUpdateAndKickOff() calls on that disp accumulate their
+     * methods here instead of issuing individual UPDATEs; the accumulated
+     * methods are interlocked and kicked off with a single UPDATE by
+     * nvEvoEndUpdateTransaction().
+     */
+    struct {
+        const NVDispEvoRec *pDispEvo;
+        NvBool sync;
+        NvBool releaseElv;
+        NVEvoUpdateState updateState;
+    } updateTransaction;
+
     NvBool              mobile                   : 1;
     NvBool              usesTegraDevice          : 1;
 
@@ -1252,6 +1280,30 @@ typedef struct _NVEvoDevRec {
                 } notifiers[NVKMS_MAX_HEADS_PER_DISP];
             } sd[NVKMS_MAX_SUBDEVICES];
         } notifierState;
+
+        /*
+         * Copy-engine path for LUT uploads.
+         *
+         * When available, new LUT data is staged in a CPU-writable sysmem
+         * buffer and copied into the (uncached) LUT surface with a DMA
+         * copy, rather than with CPU writes through the BAR mapping.
+         * Restricted to single-subdevice configurations: the GPU virtual
+         * mapping of a LUT surface has per-device scope, so a CE write
+         * would be broadcast and clobber the per-pDisp LUT contents in
+         * SLI.
+         */
+        struct {
+            NvBool available;
+            NvU32 copyEngineType;
+            NvPushChannelRec pushChannel;
+            NvU32 pushChannelHandlePool[NV_PUSH_CHANNEL_HANDLE_POOL_NUM];
+            NvU32 copyEngine;
+            struct {
+                NvU32 handle;
+                void *pBase;
+                NvU64 gpuAddress;
+            } staging;
+        } dma;
     } lut;
 
     /*! stores pre-syncpts */
@@ -2020,6 +2072,18 @@ typedef struct _NVDispEvoRec {
     NvU32 vrrSetTimeoutEventUsageCount;
     NVOS10_EVENT_KERNEL_CALLBACK_EX vrrSetTimeoutCallback;
     NvU32 vrrSetTimeoutEventHandle;
+
+    /*
+     * Cache of mode validation results, keyed by EDID and dpy
+     * capabilities; owned by nvkms-modepool.c.
+     */
+    struct _NVModeValidationCache *pModeValidationCache;
+
+    /*
+     * Memoized IsModePossible results for the configuration search;
+     * owned by nvkms-evo.c.
+     */
+    struct _NVImpMemoEvo *pImpMemo;
 } NVDispEvoRec;
 
 static inline NvU32 GetNextHwHead(NvU32 hwHeadsMask, const NvU32 prevHwHead)
@@ -2099,6 +2163,29 @@ typedef struct _NVDpyAttributeRequestedDitheringConfigRec {
     enum NvKmsDpyAttributeRequestedDitheringModeValue mode;
 } NVDpyAttributeRequestedDitheringConfig;
 
+/*
+ * One cache slot per HDMI infoframe packet type programmed by nvkms-hdmi.c.
+ * The vendor specific and dynamic range mastering infoframes need separate
+ * slots even though they share an NVHDMIPKT_TYPE in the hdmipkt library.
+ */
+typedef enum {
+    NV_HDMI_INFOFRAME_SLOT_AVI = 0,
+    NV_HDMI_INFOFRAME_SLOT_VENDOR_SPECIFIC,
+    NV_HDMI_INFOFRAME_SLOT_DRM,
+    NV_HDMI_INFOFRAME_SLOT_EXTENDED_METADATA,
+    NV_HDMI_INFOFRAME_SLOT_COUNT,
+} NVHdmiInfoFrameSlot;
+
+/* Large enough for any infoframe packet plus an inserted checksum byte. */
+#define NV_HDMI_INFOFRAME_CACHE_MAX_SIZE 48
+
+typedef struct _NVHdmiInfoFramePacketRec {
+    NvBool valid;
+    NVHDMIPKT_TC transmitControl;
+    NvU32 size;
+    NvU8 data[NV_HDMI_INFOFRAME_CACHE_MAX_SIZE];
+} NVHdmiInfoFramePacketRec;
+
 typedef struct _NVDpyEvoRec {
     NVListRec dpyListEntry;
     NVDpyId  id;
@@ -2168,6 +2255,13 @@ typedef struct _NVDpyEvoRec {
     struct {
         HDMI_SRC_CAPS srcCaps;
         HDMI_SINK_CAPS sinkCaps;
+
+        /*
+         * The most recently written infoframe packets, used to skip
+         * redundant hdmipkt library writes when the packet content is
+         * unchanged.
+         */
+        NVHdmiInfoFramePacketRec infoFrameCache[NV_HDMI_INFOFRAME_SLOT_COUNT];
     } hdmi;
 
     struct {
@@ -3177,6 +3271,16 @@ typedef struct _NVVblankSemControl {
     NVSurfaceEvoRec *pSurfaceEvo;
 } NVVblankSemControl;
 
+typedef struct _NVVblankInfoControl {
+    NVDispEvoRec *pDispEvo;
+    NvU32 apiHead;
+    NvU64 surfaceOffset;
+    NVSurfaceEvoRec *pSurfaceEvo;
+    void *pCpuMapping;
+    struct NvKmsVblankInfoData *pData;
+    NVVBlankCallbackPtr pVBlankCallback;
+} NVVblankInfoControl;
+
 #ifdef __cplusplus
 };
 #endif
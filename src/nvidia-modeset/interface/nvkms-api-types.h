@@ -59,6 +59,7 @@ typedef NvU32 NvKmsDeferredRequestFifoHandle;
 typedef NvU32 NvKmsSwapGroupHandle;
 typedef NvU32 NvKmsVblankSyncObjectHandle;
 typedef NvU32 NvKmsVblankSemControlHandle;
+typedef NvU32 NvKmsVblankInfoControlHandle;
 
 struct NvKmsSize {
     NvU16 width;
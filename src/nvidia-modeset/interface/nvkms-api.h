@@ -271,6 +271,8 @@ enum NvKmsIoctlCommand {
     NVKMS_IOCTL_ENABLE_VBLANK_SEM_CONTROL,
     NVKMS_IOCTL_DISABLE_VBLANK_SEM_CONTROL,
     NVKMS_IOCTL_ACCEL_VBLANK_SEM_CONTROLS,
+    NVKMS_IOCTL_ENABLE_VBLANK_INFO_CONTROL,
+    NVKMS_IOCTL_DISABLE_VBLANK_INFO_CONTROL,
 };
 
 
@@ -2577,6 +2579,15 @@ enum NvKmsDpyAttribute {
     NV_KMS_DPY_ATTRIBUTE_DISPLAYPORT_SINK_IS_AUDIO_CAPABLE,
 
     NV_KMS_DPY_ATTRIBUTE_NUMBER_OF_HARDWARE_HEADS_USED,
+
+    /*
+     * Histogram of Display Idle Frame Refresh (display caching) prefetch
+     * latencies on the device driving this dpy. The value packs eight
+     * saturating 8-bit bucket counts, least significant byte first; bucket
+     * i counts prefetch passes that completed in less than 250 * 2^i
+     * microseconds, with the last bucket also counting everything slower.
+     */
+    NV_KMS_DPY_ATTRIBUTE_DISPLAY_CACHING_PREFETCH_LATENCY_HISTOGRAM,
 };
 
 /*! Values for the NV_KMS_DPY_ATTRIBUTE_REQUESTED_DITHERING attribute. */
@@ -4162,4 +4173,71 @@ struct NvKmsAccelVblankSemControlsParams {
     struct NvKmsAccelVblankSemControlsReply reply;
 };
 
+/*
+ * NVKMS_IOCTL_ENABLE_VBLANK_INFO_CONTROL
+ * NVKMS_IOCTL_DISABLE_VBLANK_INFO_CONTROL
+ *
+ * Enable or disable vblank info control for the given head using the specified
+ * surface and surface offset.  While enabled, NVKMS writes an
+ * NvKmsVblankInfoData to that location on every vblank of the head, publishing
+ * the most recent vblank count and timestamp.
+ *
+ * This gives clients that only need to *poll* vblank state (e.g., compositors
+ * estimating the next presentation deadline) a way to read it from shared
+ * memory, without consuming a per-vblank event-queue wakeup per head through
+ * NVKMS_IOCTL_NOTIFY_VBLANK.
+ *
+ * NvKmsVblankInfoData::sequence is a seqlock: NVKMS increments it before and
+ * after updating the other fields, so it is odd while an update is in
+ * progress.  Readers should read sequence, retry if it is odd, read the
+ * payload, re-read sequence, and retry if it changed.
+ *
+ * NvKmsVblankInfoData::timeStampUs is sampled when the NVKMS vblank callback
+ * runs, so it reflects the vblank time plus callback scheduling latency.
+ *
+ * Unlike the vblank sem controls above, the data is written by the CPU from
+ * the NVKMS vblank callback, so these ioctls are available regardless of
+ * NvKmsAllocDeviceReply::supportsVblankSemControl, and an enabled vblank info
+ * control remains enabled across modesets: updates stop while the head is
+ * shut down and resume when it is driving a mode again.
+ */
+
+struct NvKmsVblankInfoData {
+    NvU32 sequence;
+    NvU32 vblankCount;
+    NvU64 timeStampUs NV_ALIGN_BYTES(8);
+};
+
+struct NvKmsEnableVblankInfoControlRequest {
+    NvKmsDeviceHandle deviceHandle;
+    NvKmsDispHandle dispHandle;
+    NvU32 head;
+    NvKmsSurfaceHandle surfaceHandle;
+    NvU64 surfaceOffset NV_ALIGN_BYTES(8);
+};
+
+struct NvKmsEnableVblankInfoControlReply {
+    NvKmsVblankInfoControlHandle vblankInfoControlHandle;
+};
+
+struct NvKmsEnableVblankInfoControlParams {
+    struct NvKmsEnableVblankInfoControlRequest request;
+    struct NvKmsEnableVblankInfoControlReply reply;
+};
+
+struct NvKmsDisableVblankInfoControlRequest {
+    NvKmsDeviceHandle deviceHandle;
+    NvKmsDispHandle dispHandle;
+    NvKmsVblankInfoControlHandle vblankInfoControlHandle;
+};
+
+struct NvKmsDisableVblankInfoControlReply {
+    NvU32 padding;
+};
+
+struct NvKmsDisableVblankInfoControlParams {
+    struct NvKmsDisableVblankInfoControlRequest request;
+    struct NvKmsDisableVblankInfoControlReply reply;
+};
+
 #endif /* NVKMS_API_H */
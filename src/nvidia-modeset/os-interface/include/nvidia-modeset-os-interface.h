@@ -104,6 +104,9 @@ NvBool nvkms_vblank_sem_control(void);
 NvBool nvkms_opportunistic_display_sync(void);
 
 void   nvkms_call_rm    (void *ops);
+void   nvkms_call_rm_batch(void *ops,
+                         NvU32 opCount,
+                         size_t opStride);
 void*  nvkms_alloc      (size_t size,
                          NvBool zero);
 void   nvkms_free       (void *ptr,
@@ -74,6 +74,13 @@ NvBool nvKmsIoctl(
     NvU64 paramsAddress,
     const size_t paramSize);
 
+NvBool nvKmsIoctlLockless(
+    void *pOpenVoid,
+    NvU32 cmd,
+    NvU64 paramsAddress,
+    const size_t paramSize,
+    NvBool *pRet);
+
 void nvKmsClose(void *pOpenVoid);
 
 void* nvKmsOpen(
@@ -32,6 +32,7 @@
 #include "nvos.h"
 #include "nvkms-stereo.h"
 #include "nvkms-hdmi.h"
+#include "nvkms-difr.h"
 
 #include <ctrl/ctrl0073/ctrl0073dp.h> // NV0073_CTRL_CMD_DP_GET_LINK_CONFIG_*
 
@@ -1158,6 +1159,19 @@ static NvBool GetNumberOfHardwareHeadsUsed(
     *pNumHwHeadsUsed = pDpyEvo->currentAttributes.numberOfHardwareHeadsUsed;
     return TRUE;
 }
+
+static NvBool GetDisplayCachingPrefetchLatencyHistogram(
+    const NVDpyEvoRec *pDpyEvo,
+    NvS64 *pValue)
+{
+    const NVDevEvoRec *pDevEvo = pDpyEvo->pDispEvo->pDevEvo;
+
+    if (pDevEvo->pDifrState == NULL) {
+        return FALSE;
+    }
+
+    return nvDIFRGetPrefetchLatencyHistogram(pDevEvo->pDifrState, pValue);
+}
 static const struct {
     NvBool (*set)(NVDpyEvoPtr pDpyEvo, NvS64 value);
     NvBool (*get)(const NVDpyEvoRec *pDpyEvo, NvS64 *pValue);
@@ -1352,6 +1366,12 @@ static const struct {
         .getValidValues = NULL,
         .type           = NV_KMS_ATTRIBUTE_TYPE_INTEGER,
     },
+    [NV_KMS_DPY_ATTRIBUTE_DISPLAY_CACHING_PREFETCH_LATENCY_HISTOGRAM] = {
+        .set            = NULL,
+        .get            = GetDisplayCachingPrefetchLatencyHistogram,
+        .getValidValues = NULL,
+        .type           = NV_KMS_ATTRIBUTE_TYPE_INTEGER,
+    },
 };
 
 /*!
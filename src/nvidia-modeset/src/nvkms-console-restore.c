@@ -345,7 +345,8 @@ ConstructModeOneHeadRequestForOneDpy(NVDpyEvoRec *pDpyEvo,
                                      NVSurfaceEvoPtr pSurfaceEvo,
                                      struct NvKmsSetModeParams *pParams,
                                      const NvU32 dispIndex,
-                                     NvU32 *pAvailableApiHeadsMask)
+                                     NvU32 *pAvailableApiHeadsMask,
+                                     const NvBool validateEachDpy)
 {
     NvBool ret = FALSE;
     const NvU32 apiHead = PickApiHead(pDpyEvo, *pAvailableApiHeadsMask);
@@ -376,7 +377,8 @@ ConstructModeOneHeadRequestForOneDpy(NVDpyEvoRec *pDpyEvo,
     nvAssert(!pRequestHead->viewPortOutSpecified);
     nvAssert(!pRequest->commit);
 
-    while (!nvSetDispModeEvo(pDevEvo,
+    while (validateEachDpy &&
+           !nvSetDispModeEvo(pDevEvo,
                              pDevEvo->pNvKmsOpenDev,
                              pRequest,
                              &pParams->reply,
@@ -562,7 +564,8 @@ ConstructModeRequestForTiledDisplay(const NVDispEvoRec *pDispEvo,
                                     struct NvKmsSetModeParams *pParams,
                                     const NvU32 dispIndex,
                                     NVDpyIdList tiledDisplayDpysList,
-                                    NvU32 *pAvailableApiHeadsMask)
+                                    NvU32 *pAvailableApiHeadsMask,
+                                    const NvBool validateEachDpy)
 {
     NVDevEvoRec *pDevEvo = pDispEvo->pDevEvo;
     /*
@@ -663,7 +666,8 @@ ConstructModeRequestForTiledDisplay(const NVDispEvoRec *pDispEvo,
 
     nvAssert(!pRequest->commit);
 
-    if (!nvSetDispModeEvo(pDevEvo,
+    if (validateEachDpy &&
+        !nvSetDispModeEvo(pDevEvo,
                           pDevEvo->pNvKmsOpenDev,
                           pRequest,
                           &pParams->reply,
@@ -689,123 +693,38 @@ failed:
     return FALSE;
 }
 
-static NvBool isDpMSTModeActiveOnAnyConnector(NVDevEvoPtr pDevEvo)
-{
-    NvU32 i;
-    NVDispEvoPtr pDispEvo;
-
-    FOR_ALL_EVO_DISPLAYS(pDispEvo, i, pDevEvo) {
-        NvU32 apiHead;
-
-        for (apiHead = 0; apiHead < pDevEvo->numApiHeads; apiHead++) {
-            const NVDispApiHeadStateEvoRec *pApiHeadState =
-                &pDispEvo->apiHeadState[apiHead];
-            const NVDpyEvoRec *pDpyEvo =
-                nvGetOneArbitraryDpyEvo(pApiHeadState->activeDpys, pDispEvo);
-            const NVConnectorEvoRec *pConnectorEvo = (pDpyEvo != NULL) ?
-                pDpyEvo->pConnectorEvo : NULL;
-
-            if ((pConnectorEvo != NULL) &&
-                    nvConnectorUsesDPLib(pConnectorEvo)) {
-                const enum NVDpLinkMode activeLinkMode =
-                    nvDPGetActiveLinkMode(pConnectorEvo->pDpLibConnector);
-
-                nvAssert(activeLinkMode != NV_DP_LINK_MODE_OFF);
-
-                if (activeLinkMode == NV_DP_LINK_MODE_MST) {
-                    return TRUE;
-                }
-            }
-        }
-    }
-
-    return FALSE;
-}
-
 /*!
- * Attempt to restore the console.
+ * Construct the console restore modeset request, enabling as many
+ * connected dpys as possible.
  *
- * If a framebuffer console surface was successfully imported from RM, then use
- * the core channel to set a mode that displays it.
+ * When validateEachDpy is FALSE, the request is only constructed: the
+ * caller is expected to validate all heads with a single modeset, which
+ * avoids one validation round trip per dpy.  When TRUE, each dpy is
+ * validated (with a scaling-disabled retry) as it is added, and dpys
+ * that fail validation are left inactive.
  *
- * This enables as many heads as possible in a clone configuration.
- * In the first pass we select connected active dpys, in the second pass
- * any other connected boot dpys, and in a third pass any other
- * remaining connected dpys:
- *
- *   1. Populate modeset request to enable the given dpy.
- *
- *   2. Do modeset request validation, if it fails then disable scaling. If
- *   modeset request validation fails even after disabling scaling then do not
- *   enable that dpy.
- *
- * If console restore succeeds, set pDevEvo->skipConsoleRestore to skip
- * deallocating the core channel and triggering RM's console restore code.
+ * \return  TRUE if a configuration for at least one dpy was constructed.
  */
-NvBool nvEvoRestoreConsole(NVDevEvoPtr pDevEvo, const NvBool allowMST)
+static NvBool ConstructConsoleRestoreModeRequest(
+    NVDevEvoPtr pDevEvo,
+    NVSurfaceEvoPtr pSurfaceEvo,
+    struct NvKmsSetModeParams *pParams,
+    const NvBool validateEachDpy)
 {
-    NvBool ret = FALSE;
+    struct NvKmsSetModeRequest *pRequest = &pParams->request;
+    NvBool foundDpysConfigForConsoleRestore = FALSE;
     NvU32 dispIndex;
     NVDispEvoPtr pDispEvo;
-    const NVEvoApiHandlesRec *pOpenDevSurfaceHandles =
-        nvGetSurfaceHandlesFromOpenDevConst(pDevEvo->pNvKmsOpenDev);
-    NVSurfaceEvoPtr pSurfaceEvo =
-        nvEvoGetPointerFromApiHandle(pOpenDevSurfaceHandles,
-                                     pDevEvo->fbConsoleSurfaceHandle);
-    struct NvKmsSetModeParams *params;
-
-    /*
-     * If this function fails to restore a console then NVKMS frees
-     * and reallocates the core channel, to attempt the console
-     * restore using Resman. The core channel reallocation also may
-     * fail and nvEvoRestoreConsole() again may get called from
-     * nvFreeDevEvo() when client frees the NVKMS device.
-     *
-     * If nvEvoRestoreConsole() gets called after the core channel
-     * allocation/reallocation failure then do nothing and return
-     * early.
-     */
-    if (pDevEvo->displayHandle == 0x0) {
-        goto done;
-    }
-
-    /*
-     * If any DP-MST mode is active on any connector of this device but
-     * DP-MST is disallowed then force console-restore.
-     */
-    if (pDevEvo->skipConsoleRestore &&
-            !allowMST && isDpMSTModeActiveOnAnyConnector(pDevEvo)) {
-        pDevEvo->skipConsoleRestore = FALSE;
-    }
-
-    if (pDevEvo->skipConsoleRestore) {
-        ret = TRUE;
-        goto done;
-    }
-
-    if (!pSurfaceEvo) {
-        // No console surface to restore.
-        goto done;
-    }
-
-    FlipBaseToNull(pDevEvo);
-
-    params = nvPreallocGet(pDevEvo, PREALLOC_TYPE_RESTORE_CONSOLE_SET_MODE,
-                           sizeof(*params));
-    nvkms_memset(params, 0, sizeof(*params));
-
-    nvDPSetAllowMultiStreaming(pDevEvo, allowMST);
-
-    // Construct the request.
-    //
-    // To start with, try to enable as many connected dpys as possible,
-    // preferring the connected active displays first.
-    struct NvKmsSetModeRequest *pRequest = &params->request;
-    NvBool foundDpysConfigForConsoleRestore = FALSE;
 
     FOR_ALL_EVO_DISPLAYS(pDispEvo, dispIndex, pDevEvo) {
         NvU32 availableApiHeadsMask = NVBIT(pDevEvo->numApiHeads) - 1;
-        NVDpyIdList connectedDpys = UpdateConnectedDpys(pDispEvo);
+        /*
+         * Skip the (slow) dpy re-detection when re-constructing the
+         * request for the validate-each-dpy fallback: connectivity was
+         * refreshed when the request was first constructed.
+         */
+        NVDpyIdList connectedDpys = validateEachDpy ?
+            pDispEvo->connectedDisplays : UpdateConnectedDpys(pDispEvo);
         const NVDpyIdList activeDpys = nvActiveDpysOnDispEvo(pDispEvo);
         const NVDpyIdList connectedActiveDpys =
             nvIntersectDpyIdListAndDpyIdList(connectedDpys,
@@ -888,10 +807,11 @@ NvBool nvEvoRestoreConsole(NVDevEvoPtr pDevEvo, const NvBool allowMST)
                     done = ConstructModeRequestForTiledDisplay(
                                                     pDispEvo,
                                                     pSurfaceEvo,
-                                                    params,
+                                                    pParams,
                                                     dispIndex,
                                                     tiledDisplayInfo.detectedDpysList,
-                                                    &availableApiHeadsMask);
+                                                    &availableApiHeadsMask,
+                                                    validateEachDpy);
                     isTiledDisplayEnable = done;
                 }
 
@@ -910,9 +830,10 @@ NvBool nvEvoRestoreConsole(NVDevEvoPtr pDevEvo, const NvBool allowMST)
                     done = ConstructModeOneHeadRequestForOneDpy(
                                                     pDpyEvo,
                                                     pSurfaceEvo,
-                                                    params,
+                                                    pParams,
                                                     dispIndex,
-                                                    &availableApiHeadsMask);
+                                                    &availableApiHeadsMask,
+                                                    validateEachDpy);
                     isTiledDisplayEnable =
                         done && tiledDisplayInfo.isCapToScaleSingleTile;
                 }
@@ -933,6 +854,129 @@ NvBool nvEvoRestoreConsole(NVDevEvoPtr pDevEvo, const NvBool allowMST)
         }
     }
 
+    return foundDpysConfigForConsoleRestore;
+}
+
+static NvBool isDpMSTModeActiveOnAnyConnector(NVDevEvoPtr pDevEvo)
+{
+    NvU32 i;
+    NVDispEvoPtr pDispEvo;
+
+    FOR_ALL_EVO_DISPLAYS(pDispEvo, i, pDevEvo) {
+        NvU32 apiHead;
+
+        for (apiHead = 0; apiHead < pDevEvo->numApiHeads; apiHead++) {
+            const NVDispApiHeadStateEvoRec *pApiHeadState =
+                &pDispEvo->apiHeadState[apiHead];
+            const NVDpyEvoRec *pDpyEvo =
+                nvGetOneArbitraryDpyEvo(pApiHeadState->activeDpys, pDispEvo);
+            const NVConnectorEvoRec *pConnectorEvo = (pDpyEvo != NULL) ?
+                pDpyEvo->pConnectorEvo : NULL;
+
+            if ((pConnectorEvo != NULL) &&
+                    nvConnectorUsesDPLib(pConnectorEvo)) {
+                const enum NVDpLinkMode activeLinkMode =
+                    nvDPGetActiveLinkMode(pConnectorEvo->pDpLibConnector);
+
+                nvAssert(activeLinkMode != NV_DP_LINK_MODE_OFF);
+
+                if (activeLinkMode == NV_DP_LINK_MODE_MST) {
+                    return TRUE;
+                }
+            }
+        }
+    }
+
+    return FALSE;
+}
+
+/*!
+ * Attempt to restore the console.
+ *
+ * If a framebuffer console surface was successfully imported from RM, then use
+ * the core channel to set a mode that displays it.
+ *
+ * This enables as many heads as possible in a clone configuration.
+ * In the first pass we select connected active dpys, in the second pass
+ * any other connected boot dpys, and in a third pass any other
+ * remaining connected dpys:
+ *
+ *   1. Populate modeset request to enable the given dpy.
+ *
+ *   2. Do modeset request validation, if it fails then disable scaling. If
+ *   modeset request validation fails even after disabling scaling then do not
+ *   enable that dpy.
+ *
+ * If console restore succeeds, set pDevEvo->skipConsoleRestore to skip
+ * deallocating the core channel and triggering RM's console restore code.
+ */
+NvBool nvEvoRestoreConsole(NVDevEvoPtr pDevEvo, const NvBool allowMST)
+{
+    NvBool ret = FALSE;
+    const NVEvoApiHandlesRec *pOpenDevSurfaceHandles =
+        nvGetSurfaceHandlesFromOpenDevConst(pDevEvo->pNvKmsOpenDev);
+    NVSurfaceEvoPtr pSurfaceEvo =
+        nvEvoGetPointerFromApiHandle(pOpenDevSurfaceHandles,
+                                     pDevEvo->fbConsoleSurfaceHandle);
+    struct NvKmsSetModeParams *params;
+
+    /*
+     * If this function fails to restore a console then NVKMS frees
+     * and reallocates the core channel, to attempt the console
+     * restore using Resman. The core channel reallocation also may
+     * fail and nvEvoRestoreConsole() again may get called from
+     * nvFreeDevEvo() when client frees the NVKMS device.
+     *
+     * If nvEvoRestoreConsole() gets called after the core channel
+     * allocation/reallocation failure then do nothing and return
+     * early.
+     */
+    if (pDevEvo->displayHandle == 0x0) {
+        goto done;
+    }
+
+    /*
+     * If any DP-MST mode is active on any connector of this device but
+     * DP-MST is disallowed then force console-restore.
+     */
+    if (pDevEvo->skipConsoleRestore &&
+            !allowMST && isDpMSTModeActiveOnAnyConnector(pDevEvo)) {
+        pDevEvo->skipConsoleRestore = FALSE;
+    }
+
+    if (pDevEvo->skipConsoleRestore) {
+        ret = TRUE;
+        goto done;
+    }
+
+    if (!pSurfaceEvo) {
+        // No console surface to restore.
+        goto done;
+    }
+
+    FlipBaseToNull(pDevEvo);
+
+    params = nvPreallocGet(pDevEvo, PREALLOC_TYPE_RESTORE_CONSOLE_SET_MODE,
+                           sizeof(*params));
+    nvkms_memset(params, 0, sizeof(*params));
+
+    nvDPSetAllowMultiStreaming(pDevEvo, allowMST);
+
+    // Construct the request.
+    //
+    // To start with, try to enable as many connected dpys as possible,
+    // preferring the connected active displays first.
+    //
+    // The request for all heads is constructed without per-dpy
+    // validation first, so that the common case needs just one modeset
+    // (which validates and programs all heads together).  Only if that
+    // single modeset fails is the request re-constructed validating each
+    // dpy individually, leaving the dpys that fail validation inactive.
+    struct NvKmsSetModeRequest *pRequest = &params->request;
+    NvBool foundDpysConfigForConsoleRestore =
+        ConstructConsoleRestoreModeRequest(pDevEvo, pSurfaceEvo, params,
+                                           FALSE /* validateEachDpy */);
+
     /*
      * Disable all (flip/raster) locks, dirty locking state in hardware
      * left behind by NVKMS console restore causes XID errors and engine hang
@@ -951,6 +995,25 @@ NvBool nvEvoRestoreConsole(NVDevEvoPtr pDevEvo, const NvBool allowMST)
                                FALSE /* doRasterLock */);
     }
 
+    if (foundDpysConfigForConsoleRestore && !ret) {
+        nvkms_memset(params, 0, sizeof(*params));
+
+        foundDpysConfigForConsoleRestore =
+            ConstructConsoleRestoreModeRequest(pDevEvo, pSurfaceEvo, params,
+                                               TRUE /* validateEachDpy */);
+
+        if (foundDpysConfigForConsoleRestore) {
+            pRequest->commit = TRUE;
+
+            ret = nvSetDispModeEvo(pDevEvo,
+                                   pDevEvo->pNvKmsOpenDev,
+                                   pRequest,
+                                   &params->reply,
+                                   TRUE /* bypassComposition */,
+                                   FALSE /* doRasterLock */);
+        }
+    }
+
     nvPreallocRelease(pDevEvo, PREALLOC_TYPE_RESTORE_CONSOLE_SET_MODE);
 
 done:
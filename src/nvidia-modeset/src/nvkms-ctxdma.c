@@ -177,6 +177,61 @@ retryOnce:
     return ret;
 }
 
+/*!
+ * Bind a ctxDma to several display channels with one batched RM
+ * submission, rather than one RM round trip per channel.  This matters
+ * for surface registration sequences on GSP systems, where per-call
+ * latency dominates.
+ *
+ * As in nvCtxDmaBind(), a failed bind may be caused by lazily-freed
+ * syncpts occupying space in the disp ctxDma hash table.  If any bind in
+ * the batch fails, fall back to binding the remaining channels one at a
+ * time through nvCtxDmaBind(), which garbage collects unused syncpts and
+ * retries.
+ */
+NvU32 nvCtxDmaBindChannels(
+    NVDevEvoPtr pDevEvo,
+    NVEvoChannelPtr const *pChannels,
+    NvU32 numChannels,
+    NvU32 hCtxDma)
+{
+    NV0002_CTRL_BIND_CONTEXTDMA_PARAMS
+        params[1 + NVKMS_MAX_HEADS_PER_DISP * NVKMS_MAX_LAYERS_PER_HEAD];
+    NvU32 statuses[ARRAY_LEN(params)];
+    NvU32 i, ret;
+
+    if (numChannels > ARRAY_LEN(params)) {
+        nvAssert(numChannels <= ARRAY_LEN(params));
+        return NVOS_STATUS_ERROR_INVALID_ARGUMENT;
+    }
+
+    nvkms_memset(params, 0, sizeof(params[0]) * numChannels);
+
+    for (i = 0; i < numChannels; i++) {
+        params[i].hChannel = pChannels[i]->pb.channel_handle;
+    }
+
+    ret = nvRmApiControlBatch(nvEvoGlobal.clientHandle,
+                              hCtxDma,
+                              NV0002_CTRL_CMD_BIND_CONTEXTDMA,
+                              params, sizeof(params[0]),
+                              numChannels, statuses);
+    if (ret != NVOS_STATUS_SUCCESS) {
+        for (i = 0; i < numChannels; i++) {
+            if (statuses[i] == NVOS_STATUS_SUCCESS) {
+                continue;
+            }
+            ret = nvCtxDmaBind(pDevEvo, pChannels[i], hCtxDma);
+            if (ret != NVOS_STATUS_SUCCESS) {
+                return ret;
+            }
+        }
+        ret = NVOS_STATUS_SUCCESS;
+    }
+
+    return ret;
+}
+
 void nvCtxDmaFree(NVDevEvoPtr pDevEvo,
                   NvU32 deviceHandle,
                   NvU32 *hDispCtxDma)
@@ -270,8 +270,20 @@ void nvEvoMoveCursorInternal(NVDispEvoPtr pDispEvo,
     const NvU32 sd = pDispEvo->displayOwner;
     NVEvoSubDevPtr pEvoSubDev = &pDevEvo->gpus[sd];
 
+    /*
+     * This may be called both under the global NVKMS lock and from the
+     * lockless cursor motion fast path; serialize writes to the per-head
+     * cursor PIO.
+     */
+    while (__atomic_exchange_n(&pEvoSubDev->cursorPioBusy[head], 1,
+                               __ATOMIC_ACQUIRE) != 0) {
+        nvkms_yield();
+    }
+
     pDevEvo->cursorHal->MoveCursor(pDevEvo, sd, head, x, y);
 
+    __atomic_store_n(&pEvoSubDev->cursorPioBusy[head], 0, __ATOMIC_RELEASE);
+
     /* If the cursor is visible, trigger VRR unstall to display the
      * cursor at the new postion */
     if (pEvoSubDev->headState[head].cursor.pSurfaceEvo) {
@@ -120,6 +120,12 @@
 /* How long to wait for prefetch dma completion. */
 #define DIFR_PREFETCH_WAIT_PERIOD_US    10000 /* 10ms */
 
+/* Number of buckets in the prefetch latency histogram. */
+#define DIFR_PREFETCH_LATENCY_BUCKETS   8
+
+/* Microseconds covered by the first latency histogram bucket. */
+#define DIFR_PREFETCH_LATENCY_BUCKET0_US 250
+
 /*
  * DIFR runtime state
  */
@@ -144,6 +150,24 @@ typedef struct _NVDIFRStateEvoRec {
 
     /* For tracking which surfaces have been prefetched already. */
     NvU32 prefetchPass;
+
+    /*
+     * L2 cache size offered with the most recent prefetch request. Used to
+     * size opportunistic warm-up prefetches issued when DIFR gets
+     * re-enabled after idle detection.
+     */
+    size_t lastL2CacheSize;
+
+    /* Measured aggregate surface footprint of the most recent prefetch. */
+    size_t lastMeasuredFootprint;
+
+    /*
+     * Saturating per-bucket counts of whole-pass prefetch latencies.
+     * Bucket i counts passes that completed in less than
+     * DIFR_PREFETCH_LATENCY_BUCKET0_US * 2^i microseconds; the last bucket
+     * also absorbs everything slower.
+     */
+    NvU8 prefetchLatencyHist[DIFR_PREFETCH_LATENCY_BUCKETS];
 } NVDIFRStateEvoRec;
 
 /*
@@ -161,17 +185,26 @@ static void FreeDIFRPushChannel(NVDIFRStateEvoPtr pDifr);
 static NvBool AllocDIFRCopyEngine(NVDIFRStateEvoPtr pDifr);
 static void FreeDIFRCopyEngine(NVDIFRStateEvoPtr pDifr);
 
+static NvU32 PrefetchAllSurfaces(NVDIFRStateEvoPtr pDifr,
+                                 size_t l2CacheSize,
+                                 NvBool measureOnly,
+                                 size_t *pFootprint);
 static NvU32 PrefetchSingleSurface(NVDIFRStateEvoPtr pDifr,
                                    NVDIFRPrefetchParams *pParams,
-                                   size_t *remainingCache);
+                                   size_t *remainingCache,
+                                   NvBool measureOnly);
 static NvBool PrefetchHelperSurfaceEvo(NVDIFRStateEvoPtr pDifr,
                                        size_t *cacheRemaining,
                                        NVSurfaceEvoPtr pSurfaceEvo,
+                                       NvBool measureOnly,
                                        NvU32 *status);
 static NvBool PrefetchHelperLutSurface(NVDIFRStateEvoPtr pDifr,
                                        size_t *cacheRemaining,
                                        NVLutSurfaceEvoPtr pLutSurface,
+                                       NvBool measureOnly,
                                        NvU32 *status);
+static void RecordPrefetchLatency(NVDIFRStateEvoPtr pDifr, NvU64 latencyUs);
+static void PreArmPrefetch(NVDIFRStateEvoPtr pDifr);
 
 static NvBool SetDisabledState(NVDIFRStateEvoPtr pDifr,
                                NvBool shouldDisable);
@@ -265,14 +298,8 @@ void nvDIFRNotifyFlip(NVDIFRStateEvoPtr pDifr)
 NvU32 nvDIFRPrefetchSurfaces(NVDIFRStateEvoPtr pDifr, size_t l2CacheSize)
 {
     NVDevEvoPtr pDevEvo = pDifr->pDevEvo;
-    NVEvoSubDevPtr pSubDev;
-    NVEvoSubDevHeadStatePtr pHeadState;
-    size_t cacheRemaining = l2CacheSize;
-    NvU32 layer;
-    NvU32 head;
-    NvU32 apiHead;
-    NvU32 eye;
-    NvU32 i;
+    size_t footprint;
+    NvU64 starttime;
     NvU32 status;
 
     /*
@@ -296,6 +323,55 @@ NvU32 nvDIFRPrefetchSurfaces(NVDIFRStateEvoPtr pDifr, size_t l2CacheSize)
         return NV2080_CTRL_LPWR_DIFR_PREFETCH_FAIL_OS_FLIPS_ENABLED;
     }
 
+    /* Remember the offered cache size for later warm-up prefetches. */
+    pDifr->lastL2CacheSize = l2CacheSize;
+
+    /*
+     * First measure the aggregate footprint of all surfaces without
+     * touching the copy engine. If the footprint can't fit in the offered
+     * L2 size this avoids issuing prefetch copies (and their completion
+     * waits) that are doomed to fail partway through.
+     */
+    status = PrefetchAllSurfaces(pDifr, l2CacheSize, TRUE, &footprint);
+
+    pDifr->lastMeasuredFootprint = footprint;
+
+    if (status != NV2080_CTRL_LPWR_DIFR_PREFETCH_SUCCESS) {
+        return status;
+    }
+
+    starttime = nvkms_get_usec();
+
+    status = PrefetchAllSurfaces(pDifr, l2CacheSize, FALSE, &footprint);
+
+    if (status == NV2080_CTRL_LPWR_DIFR_PREFETCH_SUCCESS) {
+        RecordPrefetchLatency(pDifr, nvkms_get_usec() - starttime);
+    }
+
+    return status;
+}
+
+/*
+ * Walk the cursor, layer, and LUT surfaces of all active heads and either
+ * just accumulate their footprint (measureOnly) or actually prefetch them
+ * into L2.
+ */
+static NvU32 PrefetchAllSurfaces(NVDIFRStateEvoPtr pDifr,
+                                 size_t l2CacheSize,
+                                 NvBool measureOnly,
+                                 size_t *pFootprint)
+{
+    NVDevEvoPtr pDevEvo = pDifr->pDevEvo;
+    NVEvoSubDevPtr pSubDev;
+    NVEvoSubDevHeadStatePtr pHeadState;
+    size_t cacheRemaining = l2CacheSize;
+    NvU32 layer;
+    NvU32 head;
+    NvU32 apiHead;
+    NvU32 eye;
+    NvU32 i;
+    NvU32 status;
+
     status = NV2080_CTRL_LPWR_DIFR_PREFETCH_SUCCESS;
 
     pSubDev = &pDevEvo->gpus[0];
@@ -313,6 +389,7 @@ NvU32 nvDIFRPrefetchSurfaces(NVDIFRStateEvoPtr pDifr, size_t l2CacheSize)
         if (!PrefetchHelperSurfaceEvo(pDifr,
                                       &cacheRemaining,
                                       pHeadState->cursor.pSurfaceEvo,
+                                      measureOnly,
                                       &status)) {
             goto out;
         }
@@ -323,6 +400,7 @@ NvU32 nvDIFRPrefetchSurfaces(NVDIFRStateEvoPtr pDifr, size_t l2CacheSize)
                 if (!PrefetchHelperSurfaceEvo(pDifr,
                                               &cacheRemaining,
                                               pHeadState->layer[layer].pSurfaceEvo[eye],
+                                              measureOnly,
                                               &status)) {
                     goto out;
                 }
@@ -335,6 +413,7 @@ NvU32 nvDIFRPrefetchSurfaces(NVDIFRStateEvoPtr pDifr, size_t l2CacheSize)
             if (!PrefetchHelperLutSurface(pDifr,
                                           &cacheRemaining,
                                           pHeadState->layer[layer].inputLut.pLutSurfaceEvo,
+                                          measureOnly,
                                           &status)) {
                 goto out;
             }
@@ -342,6 +421,7 @@ NvU32 nvDIFRPrefetchSurfaces(NVDIFRStateEvoPtr pDifr, size_t l2CacheSize)
             if (!PrefetchHelperLutSurface(pDifr,
                                           &cacheRemaining,
                                           pHeadState->layer[layer].tmoLut.pLutSurfaceEvo,
+                                          measureOnly,
                                           &status)) {
                 goto out;
             }
@@ -354,6 +434,7 @@ NvU32 nvDIFRPrefetchSurfaces(NVDIFRStateEvoPtr pDifr, size_t l2CacheSize)
     if (!PrefetchHelperLutSurface(pDifr,
                                   &cacheRemaining,
                                   pDevEvo->lut.defaultLut,
+                                  measureOnly,
                                   &status)) {
         goto out;
     }
@@ -363,6 +444,7 @@ NvU32 nvDIFRPrefetchSurfaces(NVDIFRStateEvoPtr pDifr, size_t l2CacheSize)
             if (!PrefetchHelperLutSurface(pDifr,
                                           &cacheRemaining,
                                           pDevEvo->lut.apiHead[apiHead].LUT[i],
+                                          measureOnly,
                                           &status)) {
                 goto out;
             }
@@ -370,6 +452,8 @@ NvU32 nvDIFRPrefetchSurfaces(NVDIFRStateEvoPtr pDifr, size_t l2CacheSize)
     }
 
 out:
+    *pFootprint = l2CacheSize - cacheRemaining;
+
     return status;
 }
 
@@ -388,6 +472,27 @@ NvBool nvDIFRSendPrefetchResponse(NVDIFRStateEvoPtr pDifr, NvU32 responseStatus)
             == NV_OK);
 }
 
+/*
+ * Report the prefetch latency histogram with the eight saturating 8-bit
+ * bucket counts packed into a single value, least significant byte first.
+ */
+NvBool nvDIFRGetPrefetchLatencyHistogram(const NVDIFRStateEvoRec *pDifr,
+                                         NvS64 *pValue)
+{
+    NvU64 value = 0;
+    NvU32 i;
+
+    ct_assert(DIFR_PREFETCH_LATENCY_BUCKETS * 8 <= 64);
+
+    for (i = 0; i < DIFR_PREFETCH_LATENCY_BUCKETS; i++) {
+        value |= (NvU64)pDifr->prefetchLatencyHist[i] << (i * 8);
+    }
+
+    *pValue = (NvS64)value;
+
+    return TRUE;
+}
+
 /*
  * Local helper functions.
  */
@@ -495,7 +600,8 @@ static void FreeDIFRCopyEngine(NVDIFRStateEvoPtr pDifr)
 
 static NvU32 PrefetchSingleSurface(NVDIFRStateEvoPtr pDifr,
                                    NVDIFRPrefetchParams *pParams,
-                                   size_t *cacheRemaining)
+                                   size_t *cacheRemaining,
+                                   NvBool measureOnly)
 {
     NvPushChannelPtr p = &pDifr->prefetchPushChannel;
     NvU64 semaphoreGPUAddress = nvPushGetNotifierGpuAddress(p, 0, 0);
@@ -570,6 +676,11 @@ static NvU32 PrefetchSingleSurface(NVDIFRStateEvoPtr pDifr,
 
     *cacheRemaining -= pParams->surfSizeBytes;
 
+    /* In the measurement phase only account for the footprint. */
+    if (measureOnly) {
+        return NV2080_CTRL_LPWR_DIFR_PREFETCH_SUCCESS;
+    }
+
     /*
      * Push buffer DMA copy and semaphore programming.
      */
@@ -668,6 +779,7 @@ static NvU32 PrefetchSingleSurface(NVDIFRStateEvoPtr pDifr,
 static NvBool PrefetchHelperSurfaceEvo(NVDIFRStateEvoPtr pDifr,
                                        size_t *cacheRemaining,
                                        NVSurfaceEvoPtr pSurfaceEvo,
+                                       NvBool measureOnly,
                                        NvU32 *status)
 {
     NVDIFRPrefetchParams params;
@@ -708,7 +820,8 @@ static NvBool PrefetchHelperSurfaceEvo(NVDIFRStateEvoPtr pDifr,
         params.surfPitchBytes *= NVKMS_BLOCK_LINEAR_GOB_WIDTH;
     }
 
-    *status = PrefetchSingleSurface(pDifr, &params, cacheRemaining);
+    *status = PrefetchSingleSurface(pDifr, &params, cacheRemaining,
+                                    measureOnly);
 
     return *status == NV2080_CTRL_LPWR_DIFR_PREFETCH_SUCCESS;
 }
@@ -716,6 +829,7 @@ static NvBool PrefetchHelperSurfaceEvo(NVDIFRStateEvoPtr pDifr,
 static NvBool PrefetchHelperLutSurface(NVDIFRStateEvoPtr pDifr,
                                        size_t *cacheRemaining,
                                        NVLutSurfaceEvoPtr pLutSurface,
+                                       NvBool measureOnly,
                                        NvU32 *status)
 {
     NVDIFRPrefetchParams params;
@@ -742,7 +856,8 @@ static NvBool PrefetchHelperLutSurface(NVDIFRStateEvoPtr pDifr,
     params.surfPitchBytes = pLutSurface->size;
     params.surfFormat = NvKmsSurfaceMemoryFormatI8;
 
-    *status = PrefetchSingleSurface(pDifr, &params, cacheRemaining);
+    *status = PrefetchSingleSurface(pDifr, &params, cacheRemaining,
+                                    measureOnly);
 
     return *status == NV2080_CTRL_LPWR_DIFR_PREFETCH_SUCCESS;
 }
@@ -809,6 +924,50 @@ static NvBool IsCECompatibleWithDIFR(NVDevEvoPtr pDevEvo, NvU32 instance)
     return TRUE;
 }
 
+/*
+ * Record the duration of a completed prefetch pass into the latency
+ * histogram.
+ */
+static void RecordPrefetchLatency(NVDIFRStateEvoPtr pDifr, NvU64 latencyUs)
+{
+    NvU64 limit = DIFR_PREFETCH_LATENCY_BUCKET0_US;
+    NvU32 bucket = 0;
+
+    while (bucket < DIFR_PREFETCH_LATENCY_BUCKETS - 1 && latencyUs >= limit) {
+        bucket++;
+        limit *= 2;
+    }
+
+    if (pDifr->prefetchLatencyHist[bucket] < NV_U8_MAX) {
+        pDifr->prefetchLatencyHist[bucket]++;
+    }
+}
+
+/*
+ * Opportunistically warm the L2 cache with the current scanout surfaces
+ * right after DIFR has been re-enabled. When hardware later requests the
+ * actual prefetch most of the lines will already be resident and the
+ * idle-to-cached-scanout transition completes faster. No response is sent
+ * to RM for these passes.
+ */
+static void PreArmPrefetch(NVDIFRStateEvoPtr pDifr)
+{
+    size_t footprint;
+
+    /* Nothing to do before the first hardware prefetch request. */
+    if (pDifr->lastL2CacheSize == 0) {
+        return;
+    }
+
+    /* Don't bother if the last measured footprint can't fit anyway. */
+    if (pDifr->lastMeasuredFootprint > pDifr->lastL2CacheSize) {
+        return;
+    }
+
+    (void)PrefetchAllSurfaces(pDifr, pDifr->lastL2CacheSize, FALSE,
+                              &footprint);
+}
+
 /*
  * Make sure we have a pending idle timer to check back on idleness.
  */
@@ -867,7 +1026,9 @@ static void IdleTimerProc(void *dataPtr, NvU32 dataU32)
          * will remain disabled.
          */
         if (!nvEvoIsConsoleActive(pDifr->pDevEvo)) {
-            SetDisabledState(pDifr, FALSE);
+            if (SetDisabledState(pDifr, FALSE)) {
+                PreArmPrefetch(pDifr);
+            }
         }
     } else {
         /* New flips have happened since the original, reset idle timer. */
@@ -504,9 +504,99 @@ static void EvoUpdateAndKickOffWithNotifier(
     return;
 }
 
+/*!
+ * Merge the channel masks accumulated in pSrc into pDst.
+ */
+static void EvoMergeUpdateState(NVEvoUpdateState *pDst,
+                                const NVEvoUpdateState *pSrc)
+{
+    NvU32 sd, head;
+
+    for (sd = 0; sd < NVKMS_MAX_SUBDEVICES; sd++) {
+        pDst->subdev[sd].channelMask |= pSrc->subdev[sd].channelMask;
+        pDst->subdev[sd].noCoreInterlockMask |=
+            pSrc->subdev[sd].noCoreInterlockMask;
+        pDst->subdev[sd].flipLockQualifyingMask |=
+            pSrc->subdev[sd].flipLockQualifyingMask;
+        pDst->subdev[sd].flipTransitionWAR |=
+            pSrc->subdev[sd].flipTransitionWAR;
+        pDst->subdev[sd].winImmChannelMask |=
+            pSrc->subdev[sd].winImmChannelMask;
+        pDst->subdev[sd].winImmInterlockMask |=
+            pSrc->subdev[sd].winImmInterlockMask;
+
+        for (head = 0; head < NVKMS_MAX_HEADS_PER_DISP; head++) {
+            pDst->subdev[sd].base[head].vrrTearing |=
+                pSrc->subdev[sd].base[head].vrrTearing;
+        }
+    }
+}
+
+/*!
+ * Begin an update transaction on pDispEvo.
+ *
+ * Until the matching nvEvoEndUpdateTransaction() call, methods pushed through
+ * nvEvoUpdateAndKickOff() on this disp are not kicked off individually: their
+ * update states are accumulated, and all of them are interlocked and kicked
+ * off with a single UPDATE at the end of the transaction.  This lets
+ * operations that program multiple heads through per-head helpers pay for one
+ * UPDATE/kickoff sequence rather than one per head.
+ *
+ * Synchronous updates requested within a transaction are deferred, too: the
+ * final UPDATE waits for a completion notifier if any accumulated update
+ * requested sync.  Operations that must observe completion of an individual
+ * update before proceeding (e.g., nvDoIMPUpdateEvo()) must not be called
+ * within a transaction.
+ */
+void nvEvoBeginUpdateTransaction(const NVDispEvoRec *pDispEvo)
+{
+    NVDevEvoPtr pDevEvo = pDispEvo->pDevEvo;
+
+    nvAssert(pDevEvo->updateTransaction.pDispEvo == NULL);
+
+    nvkms_memset(&pDevEvo->updateTransaction, 0,
+                 sizeof(pDevEvo->updateTransaction));
+    pDevEvo->updateTransaction.pDispEvo = pDispEvo;
+}
+
+/*!
+ * End the update transaction started with nvEvoBeginUpdateTransaction(),
+ * kicking off the accumulated methods with a single UPDATE.
+ */
+void nvEvoEndUpdateTransaction(const NVDispEvoRec *pDispEvo)
+{
+    NVDevEvoPtr pDevEvo = pDispEvo->pDevEvo;
+    const NvBool sync = pDevEvo->updateTransaction.sync;
+    const NvBool releaseElv = pDevEvo->updateTransaction.releaseElv;
+    NVEvoUpdateState updateState;
+
+    nvAssert(pDevEvo->updateTransaction.pDispEvo == pDispEvo);
+
+    updateState = pDevEvo->updateTransaction.updateState;
+    pDevEvo->updateTransaction.pDispEvo = NULL;
+
+    if (!nvIsUpdateStateEmpty(pDevEvo, &updateState)) {
+        nvEvoUpdateAndKickOff(pDispEvo, sync, &updateState, releaseElv);
+    }
+}
+
 void nvEvoUpdateAndKickOff(const NVDispEvoRec *pDispEvo, NvBool sync,
                            NVEvoUpdateState *updateState, NvBool releaseElv)
 {
+    NVDevEvoPtr pDevEvo = pDispEvo->pDevEvo;
+
+    /*
+     * Within an update transaction, accumulate the caller's methods and
+     * defer the UPDATE to nvEvoEndUpdateTransaction().
+     */
+    if (pDevEvo->updateTransaction.pDispEvo == pDispEvo) {
+        EvoMergeUpdateState(&pDevEvo->updateTransaction.updateState,
+                            updateState);
+        pDevEvo->updateTransaction.sync |= sync;
+        pDevEvo->updateTransaction.releaseElv |= releaseElv;
+        return;
+    }
+
     EvoUpdateAndKickOffWithNotifier(pDispEvo, sync, sync, 0, updateState,
                                     releaseElv);
 }
@@ -5873,6 +5963,12 @@ NvBool nvLayerSetPositionEvo(
             continue;
         }
 
+        /*
+         * Accumulate the methods for all requested heads on this disp into
+         * one UPDATE, rather than kicking off once per head.
+         */
+        nvEvoBeginUpdateTransaction(pDispEvo);
+
         for (apiHead = 0; apiHead < NVKMS_MAX_HEADS_PER_DISP; apiHead++) {
             NVEvoUpdateState updateState = { };
             NvU32 layer;
@@ -5899,8 +5995,11 @@ NvBool nvLayerSetPositionEvo(
                                            &updateState);
             }
 
-            pDevEvo->hal->Update(pDevEvo, &updateState, TRUE /* releaseElv */);
+            nvEvoUpdateAndKickOff(pDispEvo, FALSE /* sync */, &updateState,
+                                  TRUE /* releaseElv */);
         }
+
+        nvEvoEndUpdateTransaction(pDispEvo);
     }
 
     return TRUE;
@@ -7591,6 +7690,149 @@ static void AssignNVEvoIsModePossibleDispInput(
     }
 }
 
+/*
+ * Memoization of IsModePossible results.
+ *
+ * The multi-head configuration search in nvkms-modeset.c evaluates IMP
+ * once per candidate configuration, and the usage bounds downgrade loop
+ * retries with progressively reduced bounds; with several heads the
+ * combinatorial probing issues many RM IMP queries, most of which repeat
+ * earlier candidates or differ only on a subset of heads.  IsModePossible
+ * is a pure function of the per-head inputs, so remember its output keyed
+ * on a per-head hash of those inputs and skip the RM control call when an
+ * identical configuration has already been evaluated.
+ *
+ * Only queries with NV_EVO_REALLOCATE_BANDWIDTH_MODE_NONE are memoized:
+ * the final check for the chosen configuration, which also reallocates
+ * display bandwidth, always reaches the hardware.
+ */
+
+typedef struct _NVImpMemoEntryEvo {
+    NvBool used;
+    NvBool requireBootClocks;
+    NvU64 headHash[NVKMS_MAX_HEADS_PER_DISP];
+    NVEvoIsModePossibleDispOutput output;
+} NVImpMemoEntryEvo;
+
+#define NV_IMP_MEMO_MAX_ENTRIES 32
+
+struct _NVImpMemoEvo {
+    NvU32 nextEntry;
+    NVImpMemoEntryEvo entries[NV_IMP_MEMO_MAX_ENTRIES];
+};
+
+/* 64-bit FNV-1a, seeded with the running hash. */
+static NvU64 ImpMemoHashBytes(NvU64 hash, const void *pData, size_t size)
+{
+    const NvU8 *bytes = pData;
+    size_t i;
+
+    for (i = 0; i < size; i++) {
+        hash ^= bytes[i];
+        hash *= 1099511628211ULL;
+    }
+
+    return hash;
+}
+
+/*
+ * Hash everything about one head that influences the IMP verdict; an
+ * inactive head hashes to zero.
+ */
+static NvU64 ImpMemoHashHeadInput(const NVEvoIsModePossibleDispInput *pImpInput,
+                                  const NvU32 head)
+{
+    NvU64 hash = 14695981039346656037ULL;
+    struct {
+        enum nvKmsPixelDepth pixelDepth;
+        NvU32 displayId;
+        NvU32 orIndex;
+        NvU8 orType;
+        NvU8 enableDsc;
+        NvU8 b2Heads1Or;
+        NvU8 pad;
+    } scalars;
+
+    if (pImpInput->head[head].pTimings == NULL) {
+        return 0;
+    }
+
+    hash = ImpMemoHashBytes(hash, pImpInput->head[head].pTimings,
+                            sizeof(*pImpInput->head[head].pTimings));
+    hash = ImpMemoHashBytes(hash, pImpInput->head[head].pUsage,
+                            sizeof(*pImpInput->head[head].pUsage));
+
+    nvkms_memset(&scalars, 0, sizeof(scalars));
+
+    scalars.pixelDepth = pImpInput->head[head].pixelDepth;
+    scalars.displayId = pImpInput->head[head].displayId;
+    scalars.orIndex = pImpInput->head[head].orIndex;
+    scalars.orType = pImpInput->head[head].orType;
+    scalars.enableDsc = pImpInput->head[head].enableDsc;
+    scalars.b2Heads1Or = pImpInput->head[head].b2Heads1Or;
+
+    return ImpMemoHashBytes(hash, &scalars, sizeof(scalars));
+}
+
+static const NVImpMemoEntryEvo *ImpMemoLookup(
+    const NVDispEvoRec *pDispEvo,
+    const NvU64 headHash[NVKMS_MAX_HEADS_PER_DISP],
+    const NvBool requireBootClocks)
+{
+    const struct _NVImpMemoEvo *pMemo = pDispEvo->pImpMemo;
+    NvU32 i;
+
+    if (pMemo == NULL) {
+        return NULL;
+    }
+
+    for (i = 0; i < ARRAY_LEN(pMemo->entries); i++) {
+        const NVImpMemoEntryEvo *pEntry = &pMemo->entries[i];
+
+        if (pEntry->used &&
+            (pEntry->requireBootClocks == requireBootClocks) &&
+            (nvkms_memcmp(pEntry->headHash, headHash,
+                          sizeof(pEntry->headHash)) == 0)) {
+            return pEntry;
+        }
+    }
+
+    return NULL;
+}
+
+static void ImpMemoInsert(
+    NVDispEvoRec *pDispEvo,
+    const NvU64 headHash[NVKMS_MAX_HEADS_PER_DISP],
+    const NvBool requireBootClocks,
+    const NVEvoIsModePossibleDispOutput *pOutput)
+{
+    struct _NVImpMemoEvo *pMemo = pDispEvo->pImpMemo;
+    NVImpMemoEntryEvo *pEntry;
+
+    if (pMemo == NULL) {
+        pMemo = nvCalloc(1, sizeof(*pMemo));
+        if (pMemo == NULL) {
+            /* Memoization is purely an optimization; press on without it. */
+            return;
+        }
+        pDispEvo->pImpMemo = pMemo;
+    }
+
+    pEntry = &pMemo->entries[pMemo->nextEntry];
+    pMemo->nextEntry = (pMemo->nextEntry + 1) % ARRAY_LEN(pMemo->entries);
+
+    pEntry->used = TRUE;
+    pEntry->requireBootClocks = requireBootClocks;
+    nvkms_memcpy(pEntry->headHash, headHash, sizeof(pEntry->headHash));
+    pEntry->output = *pOutput;
+}
+
+void nvFreeImpMemoEvo(NVDispEvoPtr pDispEvo)
+{
+    nvFree(pDispEvo->pImpMemo);
+    pDispEvo->pImpMemo = NULL;
+}
+
 /*!
  * Validate the described disp configuration through IMP.
 
@@ -7648,6 +7890,8 @@ NvBool nvValidateImpOneDisp(
     NVDevEvoPtr pDevEvo = pDispEvo->pDevEvo;
     NVEvoIsModePossibleDispInput impInput = { };
     NVEvoIsModePossibleDispOutput impOutput = { };
+    NvU64 headHash[NVKMS_MAX_HEADS_PER_DISP] = { };
+    const NVImpMemoEntryEvo *pMemoEntry = NULL;
     NvU32 newIsoBandwidthKBPS, newDramFloorKBPS;
     NvBool needToRealloc = FALSE;
 
@@ -7656,7 +7900,26 @@ NvBool nvValidateImpOneDisp(
                                        reallocBandwidth,
                                        &impInput);
 
-    pDevEvo->hal->IsModePossible(pDispEvo, &impInput, &impOutput);
+    if (reallocBandwidth == NV_EVO_REALLOCATE_BANDWIDTH_MODE_NONE) {
+        NvU32 head;
+
+        for (head = 0; head < NVKMS_MAX_HEADS_PER_DISP; head++) {
+            headHash[head] = ImpMemoHashHeadInput(&impInput, head);
+        }
+
+        pMemoEntry = ImpMemoLookup(pDispEvo, headHash, requireBootClocks);
+    }
+
+    if (pMemoEntry != NULL) {
+        impOutput = pMemoEntry->output;
+    } else {
+        pDevEvo->hal->IsModePossible(pDispEvo, &impInput, &impOutput);
+
+        if (reallocBandwidth == NV_EVO_REALLOCATE_BANDWIDTH_MODE_NONE) {
+            ImpMemoInsert(pDispEvo, headHash, requireBootClocks, &impOutput);
+        }
+    }
+
     if (!impOutput.possible) {
         return FALSE;
     }
@@ -8233,7 +8496,7 @@ static NVEvoLutDataRec *GetNewLutBuffer(
     //
     // Filed bug: 2042919 to track removing this TODO.
 
-    pLUTBuffer = nvCalloc(1, sizeof(*pLUTBuffer));
+    pLUTBuffer = nvPreallocPoolGet(pDispEvo->pDevEvo, sizeof(*pLUTBuffer));
 
     if (pLUTBuffer == NULL) {
         goto done;
@@ -8347,6 +8610,7 @@ void nvEvoSetLut(NVDispEvoPtr pDispEvo, NvU32 apiHead, NvBool kickoff,
     if ((pParams->input.specified && pParams->input.end != 0) ||
         (pParams->output.specified && pParams->output.enabled)) {
         NVEvoLutDataRec *pLUTBuffer = GetNewLutBuffer(pDispEvo, pParams);
+        NvU32 dirtySegmentMask = 0;
 
         if (pLUTBuffer == NULL) {
             nvEvoLogDev(pDevEvo, EVO_LOG_WARN,
@@ -8354,10 +8618,24 @@ void nvEvoSetLut(NVDispEvoPtr pDispEvo, NvU32 apiHead, NvBool kickoff,
             return;
         }
 
+        /*
+         * GetNewLutBuffer() only filled in the segments for which the
+         * client provided new data; only those need to be copied to the
+         * LUT surface.
+         */
+        if (pParams->input.specified && pParams->input.end != 0) {
+            dirtySegmentMask |= NVKMS_LUT_SEGMENT_BASE;
+        }
+
+        if (pParams->output.specified && pParams->output.enabled) {
+            dirtySegmentMask |= NVKMS_LUT_SEGMENT_OUTPUT;
+        }
+
         // Fill in the new LUT buffer.
-        nvUploadDataToLutSurfaceEvo(pSurfEvo, pLUTBuffer, pDispEvo);
+        nvUploadDataToLutSurfaceEvo(pSurfEvo, pLUTBuffer, pDispEvo,
+                                    dirtySegmentMask);
 
-        nvFree(pLUTBuffer);
+        nvPreallocPoolPut(pDevEvo, pLUTBuffer);
     }
 
     /* Kill a pending timer */
@@ -8591,6 +8869,8 @@ NvBool nvFreeDevEvo(NVDevEvoPtr pDevEvo)
         return FALSE;
     }
 
+    nvKmsQuiesceCursorFastPath(pDevEvo);
+
     if (pDevEvo->pDifrState) {
         nvRmUnregisterDIFREventHandler(pDevEvo);
         nvDIFRFree(pDevEvo->pDifrState);
@@ -343,7 +343,8 @@ static void HdmiSendEnable(NVDpyEvoPtr pDpyEvo, NvBool hdmiEnable)
  */
 static void DisableVendorSpecificInfoFrame(
     const NVDispEvoRec *pDispEvo,
-    const NvU32 head)
+    const NvU32 head,
+    NVDpyEvoPtr pDpyEvo)
 {
     const NVDispHeadStateEvoRec *pHeadState = &pDispEvo->headState[head];
     NV0073_CTRL_SPECIFIC_SET_OD_PACKET_CTRL_PARAMS params = { 0 };
@@ -364,6 +365,13 @@ static void DisableVendorSpecificInfoFrame(
     if (ret != NVOS_STATUS_SUCCESS) {
         nvAssert(!"NV0073_CTRL_CMD_SPECIFIC_SET_OD_PACKET_CTRL failed");
     }
+
+    /*
+     * This write bypasses the infoframe packet cache; drop any cached
+     * vendor specific packet so a later re-enable is not skipped.
+     */
+    pDpyEvo->hdmi.infoFrameCache[NV_HDMI_INFOFRAME_SLOT_VENDOR_SPECIFIC].valid =
+        FALSE;
 }
 
 /*!
@@ -410,15 +418,19 @@ static void SendInfoFrame(const NVDispEvoRec *pDispEvo,
                           const NvU32 head,
                           NVHDMIPKT_TC transmitControl,
                           NVT_INFOFRAME_HEADER *pInfoFrameHeader,
-                          NvU32 infoframeSize)
+                          NvU32 infoframeSize,
+                          NVDpyEvoPtr pDpyEvo)
 {
     const NVDispHeadStateEvoRec *pHeadState = &pDispEvo->headState[head];
     NVDevEvoPtr pDevEvo = pDispEvo->pDevEvo;
     NVHDMIPKT_TYPE hdmiLibType;
     NVHDMIPKT_RESULT ret;
+    NVHdmiInfoFramePacketRec *pCachedPacket = NULL;
+    NVHdmiInfoFrameSlot slot;
     NvU8 *infoframe = NULL;
     NvU8 hdmiPacketType, checksum;
     NvU32 i;
+    NvU32 packetSize;
     NvU8 *pPayload;
     size_t headerSize;
     NvBool needChecksum =
@@ -440,18 +452,22 @@ static void SendInfoFrame(const NVDispEvoRec *pDispEvo,
         case NVT_INFOFRAME_TYPE_EXTENDED_METADATA_PACKET:
             hdmiLibType = NVHDMIPKT_TYPE_GENERIC;
             hdmiPacketType = hdmi_pktType_ExtendedMetadata;
+            slot = NV_HDMI_INFOFRAME_SLOT_EXTENDED_METADATA;
             break;
         case NVT_INFOFRAME_TYPE_VIDEO:
             hdmiLibType = NVHDMIPKT_TYPE_AVI_INFOFRAME;
             hdmiPacketType = hdmi_pktType_AviInfoFrame;
+            slot = NV_HDMI_INFOFRAME_SLOT_AVI;
             break;
         case NVT_INFOFRAME_TYPE_VENDOR_SPECIFIC:
             hdmiLibType = NVHDMIPKT_TYPE_VENDOR_SPECIFIC_INFOFRAME;
             hdmiPacketType = hdmi_pktType_VendorSpecInfoFrame;
+            slot = NV_HDMI_INFOFRAME_SLOT_VENDOR_SPECIFIC;
             break;
         case NVT_INFOFRAME_TYPE_DYNAMIC_RANGE_MASTERING:
             hdmiLibType = NVHDMIPKT_TYPE_VENDOR_SPECIFIC_INFOFRAME;
             hdmiPacketType = hdmi_pktType_DynamicRangeMasteringInfoFrame;
+            slot = NV_HDMI_INFOFRAME_SLOT_DRM;
             break;
     }
 
@@ -502,6 +518,26 @@ static void SendInfoFrame(const NVDispEvoRec *pDispEvo,
     nvkms_memcpy(&infoframe[headerSize + (needChecksum ? sizeof(checksum) : 0)],
                  pPayload, infoframeSize - headerSize /* payload size */);
 
+    /*
+     * Skip the write if this exact packet is already being transmitted.
+     * HDR entry/exit and the SDR transition timer re-send every infoframe;
+     * only the packets whose content actually changed need to reach the
+     * hardware, which keeps the unrelated packets from being reprogrammed
+     * during those transitions.
+     */
+    packetSize = infoframeSize + (needChecksum ? sizeof(checksum) : 0);
+    if ((pDpyEvo != NULL) && (packetSize <= NV_HDMI_INFOFRAME_CACHE_MAX_SIZE)) {
+        pCachedPacket = &pDpyEvo->hdmi.infoFrameCache[slot];
+
+        if (pCachedPacket->valid &&
+            (pCachedPacket->transmitControl == transmitControl) &&
+            (pCachedPacket->size == packetSize) &&
+            (nvkms_memcmp(pCachedPacket->data, infoframe, packetSize) == 0)) {
+            nvFree(infoframe);
+            return;
+        }
+    }
+
     ret = NvHdmiPkt_PacketWrite(pDevEvo->hdmiLib.handle,
                                 pDispEvo->displayOwner,
                                 pHeadState->activeRmId,
@@ -513,6 +549,11 @@ static void SendInfoFrame(const NVDispEvoRec *pDispEvo,
 
     if (ret != NVHDMIPKT_SUCCESS) {
         nvAssert(ret == NVHDMIPKT_SUCCESS);
+    } else if (pCachedPacket != NULL) {
+        pCachedPacket->valid = TRUE;
+        pCachedPacket->transmitControl = transmitControl;
+        pCachedPacket->size = packetSize;
+        nvkms_memcpy(pCachedPacket->data, infoframe, packetSize);
     }
 
     nvFree(infoframe);
@@ -526,8 +567,9 @@ static void SendVideoInfoFrame(const NVDispEvoRec *pDispEvo,
                                const NvU32 head,
                                const NVAttributesSetEvoRec *pAttributesSet,
                                const NVDispHeadInfoFrameStateEvoRec *pInfoFrameState,
-                               NVT_EDID_INFO *pEdidInfo)
+                               NVDpyEvoPtr pDpyEvo)
 {
+    NVT_EDID_INFO *pEdidInfo = &pDpyEvo->parsedEdid.info;
     NvBool hdTimings = pInfoFrameState->hdTimings;
     NVT_VIDEO_INFOFRAME_CTRL videoCtrl = pInfoFrameState->ctrl;
     NVT_VIDEO_INFOFRAME VideoInfoFrame;
@@ -553,7 +595,8 @@ static void SendVideoInfoFrame(const NVDispEvoRec *pDispEvo,
                   head,
                   NVHDMIPKT_TRANSMIT_CONTROL_ENABLE_EVERY_FRAME,
                   (NVT_INFOFRAME_HEADER *) &VideoInfoFrame,
-                  sizeof(VideoInfoFrame));
+                  sizeof(VideoInfoFrame),
+                  pDpyEvo);
 }
 
 /*
@@ -564,10 +607,11 @@ static void SendVideoInfoFrame(const NVDispEvoRec *pDispEvo,
 
 static void
 SendHDMI3DVendorSpecificInfoFrame(const NVDispEvoRec *pDispEvo,
-                                  const NvU32 head, NVT_EDID_INFO *pEdidInfo)
+                                  const NvU32 head, NVDpyEvoPtr pDpyEvo)
 {
     const NVDispHeadStateEvoRec *pHeadState =
                                  &pDispEvo->headState[head];
+    NVT_EDID_INFO *pEdidInfo = &pDpyEvo->parsedEdid.info;
     NVT_VENDOR_SPECIFIC_INFOFRAME_CTRL vendorCtrl = {
         .Enable          = 1,
         .HDMIFormat      = NVT_HDMI_VS_BYTE4_HDMI_VID_FMT_3D,
@@ -588,7 +632,7 @@ SendHDMI3DVendorSpecificInfoFrame(const NVDispEvoRec *pDispEvo,
     // Send the infoframe with HDMI 3D configured if we're setting an HDMI 3D
     // mode.
     if (!pHeadState->timings.hdmi3D) {
-        DisableVendorSpecificInfoFrame(pDispEvo, head);
+        DisableVendorSpecificInfoFrame(pDispEvo, head, pDpyEvo);
         return;
     }
 
@@ -605,15 +649,17 @@ SendHDMI3DVendorSpecificInfoFrame(const NVDispEvoRec *pDispEvo,
                   head,
                   NVHDMIPKT_TRANSMIT_CONTROL_ENABLE_EVERY_FRAME,
                   &vendorInfoFrame.Header,
-                  sizeof(vendorInfoFrame));
+                  sizeof(vendorInfoFrame),
+                  pDpyEvo);
 }
 
 static void
 SendHDRInfoFrame(const NVDispEvoRec *pDispEvo, const NvU32 head,
-                 NVT_EDID_INFO *pEdidInfo)
+                 NVDpyEvoPtr pDpyEvo)
 {
     const NVDispHeadStateEvoRec *pHeadState =
                                  &pDispEvo->headState[head];
+    NVT_EDID_INFO *pEdidInfo = &pDpyEvo->parsedEdid.info;
     NVT_HDR_INFOFRAME hdrInfoFrame = { 0 };
     NVHDMIPKT_TC transmitControl;
     const NVT_HDR_STATIC_METADATA *pHdrInfo =
@@ -666,7 +712,8 @@ SendHDRInfoFrame(const NVDispEvoRec *pDispEvo, const NvU32 head,
                   head,
                   transmitControl,
                   (NVT_INFOFRAME_HEADER *) &hdrInfoFrame.header,
-                  sizeof(hdrInfoFrame));
+                  sizeof(hdrInfoFrame),
+                  pDpyEvo);
 }
 
 
@@ -694,15 +741,15 @@ void nvUpdateHdmiInfoFrames(const NVDispEvoRec *pDispEvo,
                        head,
                        pAttributesSet,
                        pInfoFrameState,
-                       &pDpyEvo->parsedEdid.info);
+                       pDpyEvo);
 
     SendHDMI3DVendorSpecificInfoFrame(pDispEvo,
                                       head,
-                                      &pDpyEvo->parsedEdid.info);
+                                      pDpyEvo);
 
     SendHDRInfoFrame(pDispEvo,
                      head,
-                     &pDpyEvo->parsedEdid.info);
+                     pDpyEvo);
 }
 
 static void SetDpAudioMute(const NVDispEvoRec *pDispEvo,
@@ -1371,6 +1418,13 @@ void nvHdmiDpEnableDisableAudio(const NVDispEvoRec *pDispEvo,
  */
 void nvDpyUpdateHdmiPreModesetEvo(NVDpyEvoPtr pDpyEvo)
 {
+    /*
+     * The modeset reprograms the infoframe packets; force the next writes
+     * through to the hardware.
+     */
+    nvkms_memset(pDpyEvo->hdmi.infoFrameCache, 0,
+                 sizeof(pDpyEvo->hdmi.infoFrameCache));
+
     if (!nvDpyIsHdmiEvo(pDpyEvo)) {
         pDpyEvo->pConnectorEvo->isHdmiEnabled = FALSE;
         return;
@@ -1863,11 +1917,16 @@ void nvHdmiSetVRR(NVDispEvoPtr pDispEvo, NvU32 head, NvBool enable)
         transmitControl |= DRF_DEF(_HDMI_PKT, _TRANSMIT_CTRL, _SINGLE, _EN);
     }
 
+    /*
+     * No NVDpyEvoRec is available here, so bypass the infoframe packet
+     * cache; the VRR enable/disable packets must always reach the hardware.
+     */
     SendInfoFrame(pDispEvo,
                   head,
                   transmitControl,
                   (NVT_INFOFRAME_HEADER *) &empInfoFrame,
-                  sizeof(empInfoFrame));
+                  sizeof(empInfoFrame),
+                  NULL);
 }
 
 /*
@@ -2060,3 +2060,40 @@ void nvHs3dReleaseSemaphore(
 
     nvPushKickoff(p);
 }
+
+/*!
+ * Push a host semaphore acquire, waiting until the semaphore payload equals
+ * 'payload'.
+ *
+ * This stalls subsequent methods in the headSurface channel, without involving
+ * the CPU, until the semaphore is released.  It is used to interlock
+ * headSurface rendering with display: rendering into a buffer must wait until
+ * the flip that displaces that buffer has latched and released the frame
+ * semaphore back to NVKMS_HEAD_SURFACE_FRAME_SEMAPHORE_RENDERABLE.
+ */
+void nvHs3dAcquireSemaphore(
+    NVHsChannelEvoPtr pHsChannel,
+    const NVSurfaceEvoRec *pSurfaceEvo,
+    const enum NvKmsNIsoFormat nIsoFormat,
+    const NvU16 offsetInWords,
+    const NvU32 payload)
+{
+    NvPushChannelPtr p = &pHsChannel->nvPush.channel;
+
+    const NvU32 payloadByteOffsetInSemaphore =
+        nvKmsSemaphorePayloadOffset(nIsoFormat) * 4;
+
+    const NvU64 gpuAddress =
+        pSurfaceEvo->gpuAddress +
+        (offsetInWords * 4) +
+        payloadByteOffsetInSemaphore;
+
+    const NvU32 semaphoreOperation =
+        DRF_DEF(A06F, _SEMAPHORED, _OPERATION, _ACQUIRE) |
+        DRF_DEF(A06F, _SEMAPHORED, _ACQUIRE_SWITCH, _ENABLED);
+
+    nvPushMethod(p, 0, NVA06F_SEMAPHOREA, 4);
+    nvPushSetMethodDataU64(p, gpuAddress);
+    nvPushSetMethodData(p, payload);
+    nvPushSetMethodData(p, semaphoreOperation);
+}
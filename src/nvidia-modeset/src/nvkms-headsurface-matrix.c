@@ -163,6 +163,53 @@ static inline void TransformVertex(
     *pQ = oneOverW;
 }
 
+/*!
+ * Return whether 'mat' only scales and translates: no rotation, shear, or
+ * projective terms.  The tests compare bit patterns, so a term that is a
+ * negative zero simply falls back to the general path.
+ */
+static NvBool MatrixIsScaleTranslate(const struct NvKmsMatrixF32 *mat)
+{
+    return (F32viewAsNvU32(mat->m[0][1]) == NV_FLOAT_ZERO) &&
+           (F32viewAsNvU32(mat->m[1][0]) == NV_FLOAT_ZERO) &&
+           (F32viewAsNvU32(mat->m[2][0]) == NV_FLOAT_ZERO) &&
+           (F32viewAsNvU32(mat->m[2][1]) == NV_FLOAT_ZERO) &&
+           (F32viewAsNvU32(mat->m[2][2]) == NV_FLOAT_ONE);
+}
+
+/*!
+ * Transform a batch of vertices with the same matrix.
+ *
+ * The matrix classification is hoisted out of the loop: for the common
+ * scale/translate matrices built by the viewport and pixelShift paths, each
+ * vertex costs two softfloat multiply-adds instead of nine multiplies and
+ * nine adds, and the perspective divide is skipped since w is exactly one.
+ */
+static void TransformVertices(
+    const struct NvKmsMatrixF32 *mat,
+    float32_t *pX,
+    float32_t *pY,
+    float32_t *pQ,
+    unsigned int count)
+{
+    unsigned int i;
+
+    if (MatrixIsScaleTranslate(mat)) {
+        const float32_t oneF32 = NvU32viewAsF32(NV_FLOAT_ONE);
+
+        for (i = 0; i < count; i++) {
+            pX[i] = f32_add(f32_mul(pX[i], mat->m[0][0]), mat->m[0][2]);
+            pY[i] = f32_add(f32_mul(pY[i], mat->m[1][1]), mat->m[1][2]);
+            pQ[i] = oneF32;
+        }
+        return;
+    }
+
+    for (i = 0; i < count; i++) {
+        TransformVertex(mat, &pX[i], &pY[i], &pQ[i]);
+    }
+}
+
 /*!
  * Transform pRectIn by the matrix, returning the result in pRectOut.
  *
@@ -207,19 +254,20 @@ static struct NvKmsRect TransformRect(
     NvU8 i;
     NvU16 minx, maxx, miny, maxy;
     struct NvKmsRect rectOut = { };
+    float32_t x[4], y[4], q[4];
 
     /* Apply the matrix transform to each point. */
 
     for (i = 0; i < 4; i++) {
+        x[i] = ui32_to_f32(p[i].x);
+        y[i] = ui32_to_f32(p[i].y);
+    }
 
-        float32_t x = ui32_to_f32(p[i].x);
-        float32_t y = ui32_to_f32(p[i].y);
-        float32_t unused;
-
-        TransformVertex(transform, &x, &y, &unused);
+    TransformVertices(transform, x, y, q, 4);
 
-        p[i].x = F32toNvU16(x);
-        p[i].y = F32toNvU16(y);
+    for (i = 0; i < 4; i++) {
+        p[i].x = F32toNvU16(x[i]);
+        p[i].y = F32toNvU16(y[i]);
     }
 
     /* Compute the screen-aligned bounding box of the transformed points. */
@@ -575,26 +623,22 @@ static NvBool AssignStaticWarpMesh(
     swm->vertex[3].x = swm->vertex[3].u = NV_FLOAT_ONE;
     swm->vertex[3].y = swm->vertex[3].v = NV_FLOAT_ONE;
 
-    for (i = 0; i < 4; i++) {
-
-        float32_t x = NvU32viewAsF32(swm->vertex[i].x);
-        float32_t y = NvU32viewAsF32(swm->vertex[i].y);
-        float32_t q;
-
-        // Scale to input region
-        x = f32_mul(x, viewPortInWidthF);
-        y = f32_mul(y, viewPortInHeightF);
+    float32_t x[4], y[4], q[4];
 
-        // Transform
-        TransformVertex(&invertedTransform, &x, &y, &q);
+    // Scale to input region
+    for (i = 0; i < 4; i++) {
+        x[i] = f32_mul(NvU32viewAsF32(swm->vertex[i].x), viewPortInWidthF);
+        y[i] = f32_mul(NvU32viewAsF32(swm->vertex[i].y), viewPortInHeightF);
+    }
 
-        // Normalize to output region
-        x = f32_div(x, viewPortOutWidthF);
-        y = f32_div(y, viewPortOutHeightF);
+    // Transform
+    TransformVertices(&invertedTransform, x, y, q, 4);
 
-        swm->vertex[i].x = F32viewAsNvU32(x);
-        swm->vertex[i].y = F32viewAsNvU32(y);
-        swm->vertex[i].q = F32viewAsNvU32(q);
+    // Normalize to output region
+    for (i = 0; i < 4; i++) {
+        swm->vertex[i].x = F32viewAsNvU32(f32_div(x[i], viewPortOutWidthF));
+        swm->vertex[i].y = F32viewAsNvU32(f32_div(y[i], viewPortOutHeightF));
+        swm->vertex[i].q = F32viewAsNvU32(q[i]);
     }
 
     return TRUE;
@@ -781,10 +781,22 @@ static void HsUpdateFlipQueueCurrent(
         NVHsLayerRequestedFlipState newCurrent = { };
 
         /*
-         * XXX NVKMS HEADSURFACE TODO: fast forward to the last ready flip queue
-         * entry.  Share code with similar functionality in
-         * nvHsPushFlipQueueEntry().
+         * Fast forward through flip queue entries that are already ready:
+         * when the client submits faster than headSurface consumes, only
+         * the most recently submitted ready entry needs to be displayed,
+         * and HsReleaseFlipQueueEntry() completes the entries skipped over
+         * (releasing their semaphores) as they are passed.  This gives
+         * mailbox-style, latest-frame presentation rather than a queue
+         * that grows deeper, and accumulates latency, every frame.
+         *
+         * HsFastForwardFlipQueue() keeps FIFO semantics for swapgroup
+         * channels, and stops at entries that requested a non-zero
+         * minimum present interval so each of those is displayed for at
+         * least one frame.
          */
+        HsFastForwardFlipQueue(pHsChannel, layer,
+                               TRUE /* honorIsReadyCriteria */,
+                               TRUE /* honorMinPresentInterval */);
 
         if (!HsPopFlipQueueEntry(pHsChannel, layer, &newCurrent)) {
             continue;
@@ -1638,6 +1650,26 @@ void nvHsNextFrame(
 
     HsUpdateFlipQueueCurrent(pHsChannel);
 
+    if (workArea.doFlipToNextIndex &&
+        !pHsChannel->config.neededForSwapGroup) {
+        /*
+         * Interlock this frame's rendering with the previous flip: make the
+         * headSurface channel wait, on the GPU, for the previous flip to
+         * latch (and thereby release its frame semaphore back to
+         * RENDERABLE) before rendering into the buffer that flip displaces.
+         *
+         * This allows the flip below to be pushed while the previous flip
+         * is still pending, without the risk of rendering into the buffer
+         * that is still being scanned out.
+         */
+        nvHs3dAcquireSemaphore(
+            pHsChannel,
+            pHsDevice->notifiers.pSurfaceEvo,
+            pHsDevice->notifiers.nIsoFormat,
+            HsGetPreviousFrameSemaphoreOffsetInWords(pHsChannel),
+            NVKMS_HEAD_SURFACE_FRAME_SEMAPHORE_RENDERABLE);
+    }
+
     for (dstEye = NVKMS_LEFT; dstEye < NVKMS_MAX_EYES; dstEye++) {
 
         const NVSurfaceEvoRec *pSurfaceEvo[NVKMS_MAX_LAYERS_PER_HEAD];
@@ -1875,15 +1907,15 @@ static void HsProcFsRecordOmittedNonSgHsUpdate(
 }
 
 /*!
- * Determine if we've flipped to the previous frame.
+ * Determine if we've flipped to the frame 'framesAgo' flips ago.
  *
  * When we program the flip method, we reset the notifier to NOT_BEGUN, and when
  * EVO peforms the flip, it changes the notifier to BEGUN.
  *
- * Find the notifier slot for the previous frame, parse its notifier, and return
- * whether it is BEGUN.
+ * Find the notifier slot for the requested frame, parse its notifier, and
+ * return whether it is BEGUN.
  */
-static NvBool IsPreviousFlipDone(NVHsChannelEvoPtr pHsChannel)
+static NvBool IsFlipDone(NVHsChannelEvoPtr pHsChannel, NvU8 framesAgo)
 {
     const NVDispEvoRec *pDispEvo = pHsChannel->pDispEvo;
     const NvU32 apiHead = pHsChannel->apiHead;
@@ -1894,16 +1926,26 @@ static NvBool IsPreviousFlipDone(NVHsChannelEvoPtr pHsChannel)
     const NvU8 nextSlot = pHsNotifiers->sd[sd].apiHead[apiHead].nextSlot;
     struct nvKmsParsedNotifier parsed = { };
 
-    const NvU8 prevSlot =
-        A_minus_b_with_wrap_U8(nextSlot, 1,
+    const NvU8 slot =
+        A_minus_b_with_wrap_U8(nextSlot, framesAgo,
                                NVKMS_HEAD_SURFACE_MAX_NOTIFIERS_PER_HEAD);
 
+    nvAssert(framesAgo < NVKMS_HEAD_SURFACE_MAX_NOTIFIERS_PER_HEAD);
+
     nvKmsParseNotifier(pHsNotifiers->nIsoFormat, FALSE /* overlay */,
-                       prevSlot, pHsNotifiersOneSd->notifier[apiHead], &parsed);
+                       slot, pHsNotifiersOneSd->notifier[apiHead], &parsed);
 
     return parsed.status == NVKMS_NOTIFIER_STATUS_BEGUN;
 }
 
+/*!
+ * Determine if we've flipped to the previous frame.
+ */
+static NvBool IsPreviousFlipDone(NVHsChannelEvoPtr pHsChannel)
+{
+    return IsFlipDone(pHsChannel, 1);
+}
+
 /*!
  * Determine if we've flipped to the previous frame.
  */
@@ -2237,12 +2279,26 @@ static void HsVBlankCallback(NVDispEvoRec *pDispEvo,
     }
 
     /*
-     * If we have not flipped to the previous buffer, yet, we should not render
-     * to the next buffer.  Wait until the next vblank callback.
+     * If we have not flipped to the previous buffer yet, we may still render
+     * one frame ahead: the frame semaphore acquire pushed by nvHsNextFrame()
+     * makes the headSurface channel wait, on the GPU, for the previous flip
+     * to latch before rendering into the buffer it displaces, and the flip
+     * below it simply queues behind the pending flip.
+     *
+     * This keeps transformed-mode output at full refresh rate when a frame's
+     * rendering occasionally overruns into the next vblank; without it, every
+     * overrun would drop the next frame, halving the flip rate.
+     *
+     * Do not queue more than one frame ahead: if the flip before the previous
+     * one has not latched either, skip this frame and wait for the next
+     * vblank callback.
      */
     if (!IsPreviousFrameDone(pHsChannel)) {
-        HsProcFsRecordPreviousFrameNotDone(pHsChannel);
-        return;
+        if (pHsChannel->config.neededForSwapGroup ||
+            !IsFlipDone(pHsChannel, 2)) {
+            HsProcFsRecordPreviousFrameNotDone(pHsChannel);
+            return;
+        }
     }
 
     HsProcFsRecordScanline(pDispEvo, apiHead);
@@ -28,7 +28,25 @@
 #include "nvkms-utils.h"
 #include "nvos.h"
 
+#include "nvidia-push-init.h"
+#include "nvidia-push-methods.h"
+#include "nvidia-push-types.h"
+#include "nvidia-push-utils.h"
+
 #include <class/cl0040.h> /* NV01_MEMORY_LOCAL_USER */
+#include <class/cl2080.h>
+#include <class/cla06f.h>
+#include <class/cla06fsubch.h>
+#include <class/cla0b5.h>
+#include <class/clb0b5sw.h>
+#include <class/clc7b5.h> /* AMPERE_DMA_COPY_B */
+#include <ctrl/ctrl2080/ctrl2080ce.h>
+
+/* Semaphore payload released when a LUT DMA copy completes. */
+#define LUT_DMA_COPY_DONE_VALUE         0x00000fab
+
+/* How long to wait for LUT DMA copy completion. */
+#define LUT_DMA_COPY_WAIT_PERIOD_US     10000 /* 10ms */
 
 static void FreeLutSurfaceEvoInVidmem(NVLutSurfaceEvoPtr pSurfEvo)
 {
@@ -154,8 +172,9 @@ static NVLutSurfaceEvoPtr AllocLutSurfaceEvoInVidmem(NVDevEvoPtr pDevEvo)
     }
 
     /*
-     * The GPU mapping is only needed for prefetching LUT surfaces for DIFR.
-     * It isn't worth failing alone but we want to keep gpuAddress coherent.
+     * The GPU mapping is only needed for prefetching LUT surfaces for DIFR
+     * and for writing LUT data with the copy engine.  It isn't worth
+     * failing alone but we want to keep gpuAddress coherent.
      */
     ret = nvRmApiMapMemoryDma(nvEvoGlobal.clientHandle,
                               pDevEvo->deviceHandle,
@@ -164,7 +183,7 @@ static NVLutSurfaceEvoPtr AllocLutSurfaceEvoInVidmem(NVDevEvoPtr pDevEvo)
                               0,
                               pSurfEvo->size,
                               DRF_DEF(OS46, _FLAGS, _CACHE_SNOOP, _ENABLE) |
-                              DRF_DEF(OS46, _FLAGS, _ACCESS, _READ_ONLY),
+                              DRF_DEF(OS46, _FLAGS, _ACCESS, _READ_WRITE),
                               &pSurfEvo->gpuAddress);
 
     if (ret != NVOS_STATUS_SUCCESS) {
@@ -324,6 +343,325 @@ static NVLutSurfaceEvoPtr AllocLutSurfaceEvo(NVDevEvoPtr pDevEvo)
     }
 }
 
+static NvBool IsCECompatibleWithLutUpdates(NVDevEvoPtr pDevEvo, NvU32 instance)
+{
+    NV2080_CTRL_CE_GET_CAPS_V2_PARAMS params;
+    NvU32 ret;
+
+    nvkms_memset(&params, 0, sizeof(params));
+    params.ceEngineType = NV2080_ENGINE_TYPE_COPY(instance);
+
+    ret = nvRmApiControl(nvEvoGlobal.clientHandle,
+                         pDevEvo->pSubDevices[0]->handle,
+                         NV2080_CTRL_CMD_CE_GET_CAPS_V2,
+                         &params,
+                         sizeof(params));
+
+    if (ret != NVOS_STATUS_SUCCESS) {
+        return FALSE;
+    }
+
+    ct_assert(sizeof(params.capsTbl) == NV2080_CTRL_CE_CAPS_TBL_SIZE);
+
+    /* Don't occupy a graphics CE with LUT updates. */
+    if (NV2080_CTRL_CE_GET_CAP(params.capsTbl, NV2080_CTRL_CE_CAPS_CE_GRCE)) {
+        return FALSE;
+    }
+
+    return TRUE;
+}
+
+static NvBool AllocLutDmaPushChannel(NVDevEvoPtr pDevEvo)
+{
+    NvPushAllocChannelParams params = { 0 };
+    NvU32 i;
+
+    pDevEvo->lut.dma.copyEngineType = NV2080_ENGINE_TYPE_NULL;
+
+    for (i = 0; i < NV2080_ENGINE_TYPE_COPY_SIZE; i++) {
+        if (IsCECompatibleWithLutUpdates(pDevEvo, i)) {
+            pDevEvo->lut.dma.copyEngineType = NV2080_ENGINE_TYPE_COPY(i);
+            break;
+        }
+    }
+
+    if (pDevEvo->lut.dma.copyEngineType == NV2080_ENGINE_TYPE_NULL) {
+        return FALSE;
+    }
+
+    params.engineType = pDevEvo->lut.dma.copyEngineType;
+    params.pDevice = &pDevEvo->nvPush.device;
+    params.difrPrefetch = FALSE;
+    params.logNvDiss = FALSE;
+    params.noTimeout = FALSE;
+    params.ignoreChannelErrors = FALSE;
+    params.numNotifiers = 1;
+    params.pushBufferSizeInBytes = 1024;
+
+    ct_assert(sizeof(params.handlePool) ==
+              sizeof(pDevEvo->lut.dma.pushChannelHandlePool));
+
+    for (i = 0; i < ARRAY_LEN(pDevEvo->lut.dma.pushChannelHandlePool); i++) {
+        pDevEvo->lut.dma.pushChannelHandlePool[i] =
+            nvGenerateUnixRmHandle(&pDevEvo->handleAllocator);
+
+        params.handlePool[i] = pDevEvo->lut.dma.pushChannelHandlePool[i];
+    }
+
+    if (!nvPushAllocChannel(&params, &pDevEvo->lut.dma.pushChannel)) {
+        return FALSE;
+    }
+
+    return TRUE;
+}
+
+static void FreeLutDmaPushChannel(NVDevEvoPtr pDevEvo)
+{
+    NvU32 i;
+
+    nvPushFreeChannel(&pDevEvo->lut.dma.pushChannel);
+
+    for (i = 0; i < ARRAY_LEN(pDevEvo->lut.dma.pushChannelHandlePool); i++) {
+        nvFreeUnixRmHandle(&pDevEvo->handleAllocator,
+                           pDevEvo->lut.dma.pushChannelHandlePool[i]);
+        pDevEvo->lut.dma.pushChannelHandlePool[i] = 0;
+    }
+}
+
+static NvBool AllocLutDmaCopyEngine(NVDevEvoPtr pDevEvo)
+{
+    NVB0B5_ALLOCATION_PARAMETERS allocParams = { 0 };
+    NvU32 ret;
+
+    pDevEvo->lut.dma.copyEngine =
+        nvGenerateUnixRmHandle(&pDevEvo->handleAllocator);
+    if (pDevEvo->lut.dma.copyEngine == 0) {
+        return FALSE;
+    }
+
+    allocParams.version = NVB0B5_ALLOCATION_PARAMETERS_VERSION_1;
+    allocParams.engineType = pDevEvo->lut.dma.copyEngineType;
+
+    ret = nvRmApiAlloc(nvEvoGlobal.clientHandle,
+                       pDevEvo->lut.dma.pushChannel.channelHandle[0],
+                       pDevEvo->lut.dma.copyEngine,
+                       AMPERE_DMA_COPY_B,
+                       &allocParams);
+    if (ret != NVOS_STATUS_SUCCESS) {
+        return FALSE;
+    }
+
+    return TRUE;
+}
+
+static void FreeLutDmaCopyEngine(NVDevEvoPtr pDevEvo)
+{
+    if (pDevEvo->lut.dma.copyEngine != 0) {
+        nvRmApiFree(nvEvoGlobal.clientHandle,
+                    pDevEvo->pSubDevices[0]->handle,
+                    pDevEvo->lut.dma.copyEngine);
+    }
+
+    nvFreeUnixRmHandle(&pDevEvo->handleAllocator,
+                       pDevEvo->lut.dma.copyEngine);
+    pDevEvo->lut.dma.copyEngine = 0;
+}
+
+static NvBool AllocLutDmaStaging(NVDevEvoPtr pDevEvo)
+{
+    const NvU64 size = (sizeof(NVEvoLutDataRec) + 63) & ~63;
+    NvU32 ret;
+
+    pDevEvo->lut.dma.staging.handle =
+        nvGenerateUnixRmHandle(&pDevEvo->handleAllocator);
+    if (pDevEvo->lut.dma.staging.handle == 0) {
+        return FALSE;
+    }
+
+    /*
+     * The staging buffer is filled by the CPU and only read by the copy
+     * engine, so it doesn't need to be ISO-capable.
+     */
+    if (!nvRmAllocSysmem(pDevEvo, pDevEvo->lut.dma.staging.handle, NULL,
+                         &pDevEvo->lut.dma.staging.pBase, size,
+                         NVKMS_MEMORY_NISO)) {
+        nvFreeUnixRmHandle(&pDevEvo->handleAllocator,
+                           pDevEvo->lut.dma.staging.handle);
+        pDevEvo->lut.dma.staging.handle = 0;
+
+        return FALSE;
+    }
+
+    ret = nvRmApiMapMemoryDma(nvEvoGlobal.clientHandle,
+                              pDevEvo->deviceHandle,
+                              pDevEvo->nvkmsGpuVASpace,
+                              pDevEvo->lut.dma.staging.handle,
+                              0,
+                              size,
+                              DRF_DEF(OS46, _FLAGS, _CACHE_SNOOP, _ENABLE) |
+                              DRF_DEF(OS46, _FLAGS, _ACCESS, _READ_ONLY),
+                              &pDevEvo->lut.dma.staging.gpuAddress);
+    if (ret != NVOS_STATUS_SUCCESS) {
+        pDevEvo->lut.dma.staging.gpuAddress = 0ULL;
+
+        return FALSE;
+    }
+
+    return TRUE;
+}
+
+static void FreeLutDmaStaging(NVDevEvoPtr pDevEvo)
+{
+    if (pDevEvo->lut.dma.staging.handle == 0) {
+        return;
+    }
+
+    if (pDevEvo->lut.dma.staging.gpuAddress != 0) {
+        nvRmApiUnmapMemoryDma(nvEvoGlobal.clientHandle,
+                              pDevEvo->deviceHandle,
+                              pDevEvo->nvkmsGpuVASpace,
+                              pDevEvo->lut.dma.staging.handle,
+                              0,
+                              pDevEvo->lut.dma.staging.gpuAddress);
+        pDevEvo->lut.dma.staging.gpuAddress = 0ULL;
+    }
+
+    if (pDevEvo->lut.dma.staging.pBase != NULL) {
+        nvRmApiUnmapMemory(nvEvoGlobal.clientHandle,
+                           pDevEvo->deviceHandle,
+                           pDevEvo->lut.dma.staging.handle,
+                           pDevEvo->lut.dma.staging.pBase,
+                           0);
+        pDevEvo->lut.dma.staging.pBase = NULL;
+    }
+
+    nvRmApiFree(nvEvoGlobal.clientHandle,
+                pDevEvo->deviceHandle,
+                pDevEvo->lut.dma.staging.handle);
+    nvFreeUnixRmHandle(&pDevEvo->handleAllocator,
+                       pDevEvo->lut.dma.staging.handle);
+    pDevEvo->lut.dma.staging.handle = 0;
+}
+
+static void FreeLutDma(NVDevEvoPtr pDevEvo)
+{
+    pDevEvo->lut.dma.available = FALSE;
+
+    FreeLutDmaStaging(pDevEvo);
+    FreeLutDmaCopyEngine(pDevEvo);
+    FreeLutDmaPushChannel(pDevEvo);
+}
+
+static void AllocLutDma(NVDevEvoPtr pDevEvo)
+{
+    pDevEvo->lut.dma.available = FALSE;
+
+    /*
+     * The copy engine writes through the GPU virtual mapping of the LUT
+     * surface, which has per-device scope, so a CE write would be
+     * broadcast in SLI and clobber the per-pDisp LUT contents; restrict
+     * the DMA path to single-subdevice configurations.  SOC devices keep
+     * their CPU-accessible sysmem LUTs.
+     */
+    if (pDevEvo->requiresAllAllocationsInSysmem ||
+        pDevEvo->numSubDevices != 1 ||
+        pDevEvo->nvkmsGpuVASpace == 0 ||
+        !nvRmEvoClassListCheck(pDevEvo, AMPERE_DMA_COPY_B)) {
+        return;
+    }
+
+    if (!AllocLutDmaPushChannel(pDevEvo) ||
+        !AllocLutDmaCopyEngine(pDevEvo) ||
+        !AllocLutDmaStaging(pDevEvo)) {
+        /* Fall back to CPU writes through the mapped surface. */
+        FreeLutDma(pDevEvo);
+
+        return;
+    }
+
+    pDevEvo->lut.dma.available = TRUE;
+}
+
+/*
+ * Copy 'size' bytes at 'offset' from the staging buffer into the LUT
+ * surface with the copy engine, and wait for the copy to complete.
+ *
+ * The display engine fetches the palette directly from the LUT surface, so
+ * the handoff to the core channel update that consumes the surface must
+ * not happen until the copy has fully landed; a semaphore release after
+ * the copy provides that interlock.
+ */
+static NvBool LutDmaCopySegment(NVDevEvoPtr pDevEvo,
+                                NVLutSurfaceEvoPtr pSurfEvo,
+                                size_t offset, size_t size)
+{
+    NvPushChannelPtr p = &pDevEvo->lut.dma.pushChannel;
+    NvU64 semaphoreGPUAddress = nvPushGetNotifierGpuAddress(p, 0, 0);
+    NvGpuSemaphore *semaphore = (NvGpuSemaphore *)
+        nvPushGetNotifierCpuAddress(p, 0, 0);
+    NvU64 starttime;
+    NvU64 endtime;
+
+    nvAssert((offset + size) <= pSurfEvo->size);
+    nvAssert(size <= NV_S32_MAX);
+
+    nvPushSetObject(p, NVA06F_SUBCHANNEL_COPY_ENGINE,
+                    &pDevEvo->lut.dma.copyEngine);
+    nvPushMethod(p, NVA06F_SUBCHANNEL_COPY_ENGINE, NVA0B5_OFFSET_IN_UPPER, 2);
+    nvPushSetMethodDataU64(p, pDevEvo->lut.dma.staging.gpuAddress + offset);
+    nvPushMethod(p, NVA06F_SUBCHANNEL_COPY_ENGINE, NVA0B5_OFFSET_OUT_UPPER, 2);
+    nvPushSetMethodDataU64(p, pSurfEvo->gpuAddress + offset);
+    nvPushMethod(p, NVA06F_SUBCHANNEL_COPY_ENGINE, NVA0B5_LINE_LENGTH_IN, 1);
+    nvPushSetMethodData(p, size);
+
+    nvPushMethod(p, NVA06F_SUBCHANNEL_COPY_ENGINE, NVA0B5_LAUNCH_DMA, 1);
+    nvPushSetMethodData
+        (p,
+         DRF_DEF(A0B5, _LAUNCH_DMA, _DATA_TRANSFER_TYPE, _NON_PIPELINED) |
+         DRF_DEF(A0B5, _LAUNCH_DMA, _FLUSH_ENABLE,       _TRUE)          |
+         DRF_DEF(A0B5, _LAUNCH_DMA, _SEMAPHORE_TYPE,     _NONE)          |
+         DRF_DEF(A0B5, _LAUNCH_DMA, _INTERRUPT_TYPE,     _NONE)          |
+         DRF_DEF(A0B5, _LAUNCH_DMA, _SRC_MEMORY_LAYOUT,  _PITCH)         |
+         DRF_DEF(A0B5, _LAUNCH_DMA, _DST_MEMORY_LAYOUT,  _PITCH)         |
+         DRF_DEF(A0B5, _LAUNCH_DMA, _MULTI_LINE_ENABLE,  _FALSE)         |
+         DRF_DEF(A0B5, _LAUNCH_DMA, _SRC_TYPE,           _VIRTUAL)       |
+         DRF_DEF(A0B5, _LAUNCH_DMA, _DST_TYPE,           _VIRTUAL));
+
+    /*
+     * Reset semaphore value. A memory barrier will be issued by nvidia-push
+     * so we don't need one here.
+     */
+    semaphore->data[0] = 0;
+
+    /* Program a semaphore release after the DMA copy. */
+    nvPushMethod(p, 0, NVA06F_SEMAPHOREA, 4);
+    nvPushSetMethodDataU64(p, semaphoreGPUAddress);
+    nvPushSetMethodData(p, LUT_DMA_COPY_DONE_VALUE);
+    nvPushSetMethodData(p,
+                        DRF_DEF(A06F, _SEMAPHORED, _OPERATION, _RELEASE) |
+                        DRF_DEF(A06F, _SEMAPHORED, _RELEASE_WFI, _EN) |
+                        DRF_DEF(A06F, _SEMAPHORED, _RELEASE_SIZE, _4BYTE));
+    nvPushKickoff(p);
+
+    /*
+     * A LUT segment is only a few KB so the copy should complete within
+     * microseconds; wait 100us at a time with a generous upper bound
+     * before declaring the channel hosed.
+     */
+    starttime = nvkms_get_usec();
+    do {
+        endtime = nvkms_get_usec();
+
+        if (semaphore->data[0] == LUT_DMA_COPY_DONE_VALUE) {
+            return TRUE;
+        }
+
+        nvkms_usleep(100);
+    } while (endtime - starttime < LUT_DMA_COPY_WAIT_PERIOD_US);
+
+    return FALSE;
+}
+
 NvBool nvSetTmoLutSurfacesEvo(NVDevEvoPtr pDevEvo,
                               NVFlipEvoHwState *pFlipState,
                               NvU32 head)
@@ -434,6 +772,12 @@ NvBool nvAllocLutSurfacesEvo(NVDevEvoPtr pDevEvo)
         pDevEvo->hal->InitDefaultLut(pDevEvo);
     }
 
+    /*
+     * Try to set up the copy engine path for LUT uploads; if any of this
+     * fails, LUT updates fall back to CPU writes.
+     */
+    AllocLutDma(pDevEvo);
+
     return TRUE;
 }
 
@@ -476,38 +820,96 @@ void nvFreeLutSurfacesEvo(NVDevEvoPtr pDevEvo)
             }
         }
     }
+
+    FreeLutDma(pDevEvo);
 }
 
 void nvUploadDataToLutSurfaceEvo(NVLutSurfaceEvoPtr pSurfEvo,
                                  const NVEvoLutDataRec *pLUTBuffer,
-                                 NVDispEvoPtr pDispEvo)
+                                 NVDispEvoPtr pDispEvo,
+                                 NvU32 dirtySegmentMask)
 {
-    const NvU32* data = (const NvU32*)pLUTBuffer;
-    size_t size = sizeof(*pLUTBuffer);
     const int sd = pDispEvo->displayOwner;
-    NvU32 *dst;
-    const NvU32 *src;
-    int dword;
+    struct {
+        size_t offset;
+        size_t size;
+    } segment[2];
+    NvU32 numSegments = 0;
+    NVDevEvoPtr pDevEvo;
+    NvU32 i;
 
     if (pSurfEvo == NULL) {
         nvAssert(pSurfEvo);
         return;
     }
 
-    nvAssert(pSurfEvo->subDeviceAddress[sd]);
+    pDevEvo = pSurfEvo->pDevEvo;
 
     /* The size to copy should not be larger than the surface. */
-    nvAssert(size <= pSurfEvo->size);
+    nvAssert(sizeof(*pLUTBuffer) <= pSurfEvo->size);
+
+    /*
+     * Only copy the segments that contain new data: the base and output
+     * LUTs are updated independently, and the segments the caller didn't
+     * fill in retain their previous contents in the surface.
+     */
+    if (dirtySegmentMask & NVKMS_LUT_SEGMENT_BASE) {
+        segment[numSegments].offset = offsetof(NVEvoLutDataRec, base);
+        segment[numSegments].size = sizeof(pLUTBuffer->base);
+        numSegments++;
+    }
 
-    /* The source, destination, and size should be 4-byte aligned. */
-    nvAssert((((NvUPtr)data) & 0x3) == 0);
-    nvAssert((((NvUPtr)pSurfEvo->subDeviceAddress[sd]) & 0x3) == 0);
-    nvAssert((size % 4) == 0);
+    if (dirtySegmentMask & NVKMS_LUT_SEGMENT_OUTPUT) {
+        segment[numSegments].offset = offsetof(NVEvoLutDataRec, output);
+        segment[numSegments].size = sizeof(pLUTBuffer->output);
+        numSegments++;
+    }
+
+    if (pDevEvo->lut.dma.available && pSurfEvo->gpuAddress != 0) {
+        NvBool success = TRUE;
+
+        for (i = 0; i < numSegments; i++) {
+            nvkms_memcpy((NvU8 *)pDevEvo->lut.dma.staging.pBase +
+                             segment[i].offset,
+                         (const NvU8 *)pLUTBuffer + segment[i].offset,
+                         segment[i].size);
 
-    src = data;
-    dst = (NvU32*)pSurfEvo->subDeviceAddress[sd];
+            if (!LutDmaCopySegment(pDevEvo, pSurfEvo,
+                                   segment[i].offset, segment[i].size)) {
+                success = FALSE;
+                break;
+            }
+        }
 
-    for (dword = 0; dword < (size/4); dword++) {
-        *(dst++) = *(src++);
+        if (success) {
+            return;
+        }
+
+        /*
+         * The copy engine timed out; don't trust the channel for further
+         * updates and redo this update with CPU writes.
+         */
+        nvEvoLogDev(pDevEvo, EVO_LOG_WARN,
+                    "LUT DMA update failed; falling back to CPU updates");
+        pDevEvo->lut.dma.available = FALSE;
+    }
+
+    nvAssert(pSurfEvo->subDeviceAddress[sd]);
+
+    for (i = 0; i < numSegments; i++) {
+        const NvU32 *src = (const NvU32 *)
+            ((const NvU8 *)pLUTBuffer + segment[i].offset);
+        NvU32 *dst = (NvU32 *)
+            ((NvU8 *)pSurfEvo->subDeviceAddress[sd] + segment[i].offset);
+        size_t dword;
+
+        /* The source, destination, and size should be 4-byte aligned. */
+        nvAssert((((NvUPtr)src) & 0x3) == 0);
+        nvAssert((((NvUPtr)dst) & 0x3) == 0);
+        nvAssert((segment[i].size % 4) == 0);
+
+        for (dword = 0; dword < (segment[i].size / 4); dword++) {
+            *(dst++) = *(src++);
+        }
     }
 }
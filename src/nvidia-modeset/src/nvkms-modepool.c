@@ -42,6 +42,194 @@ typedef struct {
     NvBool patchedStereoTimings;
 } EvoValidateModeFlags;
 
+/*
+ * Mode validation cache.
+ *
+ * Validating a mode involves IMP checks and watermark computation in
+ * nvkms-evo.c that take on the order of milliseconds per mode, so walking
+ * a display's full mode list on every hotplug adds up to hundreds of
+ * milliseconds.  The result of ValidateMode() only depends on the dpy's
+ * EDID, the dpy's link and connector capabilities, the validation
+ * parameters, and the mode itself, so cache the outcome per pDispEvo:
+ * replugging the same display (e.g., docking) then revalidates its modes
+ * with cache hits instead of recomputing them.
+ *
+ * Entries are replaced round-robin once the cache is full.  The cache is
+ * allocated on first insertion and freed when the disp is torn down.
+ */
+
+typedef struct _NVModeValidationCacheEntry {
+    NvBool used;
+
+    /* Lookup key. */
+    NvU32 edidHash;
+    NvU32 dpyCapsHash;
+    EvoValidateModeFlags flags;
+    struct NvKmsModeValidationParams params;
+    NvModeTimings modeTimings;
+
+    /* Cached validation outcome. */
+    NvBool valid;
+    struct NvKmsModeValidationValidSyncs validSyncs;
+    struct NvKmsUsageBounds modeUsage;
+} NVModeValidationCacheEntry;
+
+#define NV_MODE_VALIDATION_CACHE_MAX_ENTRIES 64
+
+struct _NVModeValidationCache {
+    NvU32 nextEntry;
+    NVModeValidationCacheEntry entries[NV_MODE_VALIDATION_CACHE_MAX_ENTRIES];
+};
+
+/* 32-bit FNV-1a. */
+static NvU32 HashBytes(const void *pData, size_t size)
+{
+    const NvU8 *bytes = pData;
+    NvU32 hash = 2166136261U;
+    size_t i;
+
+    for (i = 0; i < size; i++) {
+        hash ^= bytes[i];
+        hash *= 16777619U;
+    }
+
+    return hash;
+}
+
+/*
+ * Hash the dpy capabilities, beyond the EDID itself, that influence mode
+ * validation: the link configuration and connector properties determine
+ * the outcome of the DP bandwidth and HDMI FRL checks and the maximum
+ * pixel clock tests.
+ */
+static NvU32 HashDpyValidationCaps(const NVDpyEvoRec *pDpyEvo)
+{
+    struct {
+        NvU32 maxPixelClockKHz;
+        NvU32 maxSingleLinkPixelClockKHz;
+        NvU8 signalFormat;
+        NvU8 hdmiCapable;
+        NvU8 internal;
+        NvU8 dpLaneCount;
+        NvU8 dpLinkRate;
+        NvU8 ycbcr422Capable;
+        NvU8 ycbcr444Capable;
+        NvU8 pad;
+    } caps;
+
+    nvkms_memset(&caps, 0, sizeof(caps));
+
+    caps.maxPixelClockKHz = pDpyEvo->maxPixelClockKHz;
+    caps.maxSingleLinkPixelClockKHz = pDpyEvo->maxSingleLinkPixelClockKHz;
+    caps.signalFormat = pDpyEvo->pConnectorEvo->signalFormat;
+    caps.hdmiCapable = pDpyEvo->hdmiCapable;
+    caps.internal = pDpyEvo->internal;
+    caps.dpLaneCount = pDpyEvo->dp.laneCount;
+    caps.dpLinkRate = pDpyEvo->dp.linkRate;
+    caps.ycbcr422Capable = pDpyEvo->colorSpaceCaps.ycbcr422Capable;
+    caps.ycbcr444Capable = pDpyEvo->colorSpaceCaps.ycbcr444Capable;
+
+    return HashBytes(&caps, sizeof(caps));
+}
+
+static NvBool GetModeValidationCacheHashes(const NVDpyEvoRec *pDpyEvo,
+                                           NvU32 *pEdidHash,
+                                           NvU32 *pDpyCapsHash)
+{
+    /* Without an EDID there is no stable identity to key the cache on. */
+    if ((pDpyEvo->edid.buffer == NULL) || (pDpyEvo->edid.length == 0)) {
+        return FALSE;
+    }
+
+    *pEdidHash = HashBytes(pDpyEvo->edid.buffer, pDpyEvo->edid.length);
+    *pDpyCapsHash = HashDpyValidationCaps(pDpyEvo);
+
+    return TRUE;
+}
+
+static const NVModeValidationCacheEntry *ModeValidationCacheLookup(
+    const NVDispEvoRec *pDispEvo,
+    const NvU32 edidHash,
+    const NvU32 dpyCapsHash,
+    const EvoValidateModeFlags *pFlags,
+    const struct NvKmsModeValidationParams *pParams,
+    const NvModeTimings *pModeTimings)
+{
+    const struct _NVModeValidationCache *pCache =
+        pDispEvo->pModeValidationCache;
+    NvU32 i;
+
+    if (pCache == NULL) {
+        return NULL;
+    }
+
+    for (i = 0; i < ARRAY_LEN(pCache->entries); i++) {
+        const NVModeValidationCacheEntry *pEntry = &pCache->entries[i];
+
+        if (pEntry->used &&
+            (pEntry->edidHash == edidHash) &&
+            (pEntry->dpyCapsHash == dpyCapsHash) &&
+            (nvkms_memcmp(&pEntry->flags, pFlags,
+                          sizeof(pEntry->flags)) == 0) &&
+            (nvkms_memcmp(&pEntry->params, pParams,
+                          sizeof(pEntry->params)) == 0) &&
+            (nvkms_memcmp(&pEntry->modeTimings, pModeTimings,
+                          sizeof(pEntry->modeTimings)) == 0)) {
+            return pEntry;
+        }
+    }
+
+    return NULL;
+}
+
+static void ModeValidationCacheInsert(
+    NVDispEvoRec *pDispEvo,
+    const NvU32 edidHash,
+    const NvU32 dpyCapsHash,
+    const EvoValidateModeFlags *pFlags,
+    const struct NvKmsModeValidationParams *pParams,
+    const NvModeTimings *pModeTimings,
+    const NvBool valid,
+    const struct NvKmsModeValidationValidSyncs *pValidSyncs,
+    const struct NvKmsUsageBounds *pModeUsage)
+{
+    struct _NVModeValidationCache *pCache = pDispEvo->pModeValidationCache;
+    NVModeValidationCacheEntry *pEntry;
+
+    if (pCache == NULL) {
+        pCache = nvCalloc(1, sizeof(*pCache));
+        if (pCache == NULL) {
+            /* The cache is purely an optimization; press on without it. */
+            return;
+        }
+        pDispEvo->pModeValidationCache = pCache;
+    }
+
+    pEntry = &pCache->entries[pCache->nextEntry];
+    pCache->nextEntry = (pCache->nextEntry + 1) % ARRAY_LEN(pCache->entries);
+
+    nvkms_memset(pEntry, 0, sizeof(*pEntry));
+
+    pEntry->used = TRUE;
+    pEntry->edidHash = edidHash;
+    pEntry->dpyCapsHash = dpyCapsHash;
+    pEntry->flags = *pFlags;
+    pEntry->params = *pParams;
+    pEntry->modeTimings = *pModeTimings;
+
+    pEntry->valid = valid;
+    if (valid) {
+        pEntry->validSyncs = *pValidSyncs;
+        pEntry->modeUsage = *pModeUsage;
+    }
+}
+
+void nvFreeModeValidationCache(NVDispEvoPtr pDispEvo)
+{
+    nvFree(pDispEvo->pModeValidationCache);
+    pDispEvo->pModeValidationCache = NULL;
+}
+
 static NvBool
 ValidateModeIndexEdid(NVDpyEvoPtr pDpyEvo,
                       const struct NvKmsModeValidationParams *pParams,
@@ -1644,6 +1832,9 @@ static NvBool ValidateMode(NVDpyEvoPtr pDpyEvo,
     NvU32 impOutNumHeads = 0x0;
     NvU32 head;
     NvU8 hdmiFrlBpc;
+    NvU32 edidHash = 0;
+    NvU32 dpyCapsHash = 0;
+    NvBool updateCache = FALSE;
     NvBool ret = FALSE;
 
     const NVColorFormatInfoRec supportedColorFormats = nvGetColorFormatInfo(pDpyEvo);
@@ -1663,6 +1854,29 @@ static NvBool ValidateMode(NVDpyEvoPtr pDpyEvo,
     nvkms_memset(pDscInfo, 0, sizeof(*pDscInfo));
     nvkms_memset(impOutTimings, 0, sizeof(*impOutTimings) * NVKMS_MAX_HEADS_PER_DISP);
 
+    /*
+     * Consult the validation cache, but only when the caller didn't
+     * request the verbose validation log: a cache hit skips the work that
+     * produces it.
+     */
+    if ((pInfoString->totalLength == 0) &&
+        GetModeValidationCacheHashes(pDpyEvo, &edidHash, &dpyCapsHash)) {
+        const NVModeValidationCacheEntry *pEntry =
+            ModeValidationCacheLookup(pDispEvo, edidHash, dpyCapsHash,
+                                      flags, pParams, pModeTimings);
+
+        if (pEntry != NULL) {
+            if (pEntry->valid) {
+                *pValidSyncs = pEntry->validSyncs;
+                *pModeUsage = pEntry->modeUsage;
+            }
+            ret = pEntry->valid;
+            goto done;
+        }
+
+        updateCache = TRUE;
+    }
+
     /* begin logging of ModeValidation for this mode */
 
     LogModeValidationBegin(pInfoString, pModeTimings, modeName);
@@ -1802,6 +2016,12 @@ static NvBool ValidateMode(NVDpyEvoPtr pDpyEvo,
     ret = TRUE;
 
 done:
+    if (updateCache) {
+        ModeValidationCacheInsert(pDispEvo, edidHash, dpyCapsHash,
+                                  flags, pParams, pModeTimings, ret,
+                                  pValidSyncs, pModeUsage);
+    }
+
     nvPreallocRelease(pDevEvo, PREALLOC_TYPE_VALIDATE_MODE_HW_MODE_TIMINGS);
     nvPreallocRelease(pDevEvo, PREALLOC_TYPE_VALIDATE_MODE_HDMI_FRL_CONFIG);
     nvPreallocRelease(pDevEvo, PREALLOC_TYPE_VALIDATE_MODE_DSC_INFO);
@@ -1443,8 +1443,8 @@ ValidateProposedModeSetHwStateOneDispImp(NVDispEvoPtr pDispEvo,
     if (pDevEvo->isSOCDisplay) {
         NvBool ret;
         struct NvKmsUsageBounds *guaranteedAndProposed =
-            nvCalloc(1, sizeof(*guaranteedAndProposed) *
-                            NVKMS_MAX_HEADS_PER_DISP);
+            nvPreallocPoolGet(pDevEvo, sizeof(*guaranteedAndProposed) *
+                              NVKMS_MAX_HEADS_PER_DISP);
         if (guaranteedAndProposed == NULL) {
             return FALSE;
         }
@@ -1478,7 +1478,7 @@ ValidateProposedModeSetHwStateOneDispImp(NVDispEvoPtr pDispEvo,
                                    &pWorkArea->postModesetIsoBandwidthKBPS,
                                    &pWorkArea->postModesetDramFloorKBPS);
 
-        nvFree(guaranteedAndProposed);
+        nvPreallocPoolPut(pDevEvo, guaranteedAndProposed);
 
         if (!ret) {
             return FALSE;
@@ -3716,6 +3716,13 @@ NvBool nvSetDispModeEvo(NVDevEvoPtr pDevEvo,
 
     nvAssert(pOpenDev != NULL);
 
+    /*
+     * The modeset will change state the lockless cursor motion fast path
+     * depends on (head configuration, headSurface state); tear down any
+     * armed fast paths before proceeding.
+     */
+    nvKmsQuiesceCursorFastPath(pDevEvo);
+
     InitializeReply(pDevEvo, pRequest, pReply);
 
     if (!ValidateRequest(pDevEvo, pOpenDev, pRequest, pReply)) {
@@ -136,6 +136,7 @@ NvBool nvPreallocAlloc(NVDevEvoPtr pDevEvo)
     }
 
     nvkms_memset(pPrealloc->used, 0, sizeof(pPrealloc->used));
+    nvkms_memset(pPrealloc->pool, 0, sizeof(pPrealloc->pool));
 
     return TRUE;
 
@@ -148,6 +149,7 @@ void nvPreallocFree(NVDevEvoPtr pDevEvo)
 {
     struct NVDevPreallocRec *pPrealloc = &pDevEvo->prealloc;
     NvU32 type;
+    NvU32 class;
 
     for (type = 0; type < PREALLOC_TYPE_MAX; type++) {
         if ((pDevEvo->prealloc.used[type / 8] & NVBIT(type % 8)) != 0) {
@@ -158,4 +160,150 @@ void nvPreallocFree(NVDevEvoPtr pDevEvo)
         nvFree(pPrealloc->ptr[type]);
         pPrealloc->ptr[type] = NULL;
     }
+
+    for (class = 0; class < NV_PREALLOC_POOL_NUM_CLASSES; class++) {
+        struct NVPreallocPoolClassRec *pClass = &pPrealloc->pool[class];
+
+        if (pClass->numOutstanding != 0) {
+            nvEvoLogDevDebug(pDevEvo, EVO_LOG_ERROR,
+                "Prealloc pool class %d still used in nvPreallocFree.", class);
+        }
+
+        while (pClass->numFree > 0) {
+            pClass->numFree--;
+            nvFree(pClass->freeSlab[pClass->numFree]);
+            pClass->freeSlab[pClass->numFree] = NULL;
+        }
+    }
+}
+
+/*
+ * The prealloc pool: per-device caches of dynamically sized scratch
+ * buffers, bucketed into power-of-two size classes.  Unlike the typed
+ * preallocations above, pool buffers are acquired by size and released by
+ * pointer, so any number can be outstanding at once.  Released slabs are
+ * cached for reuse so that large per-request allocations (LUT staging
+ * buffers, modeset validation state) don't hit the system allocator on
+ * every request; a small amount of bookkeeping trims the cache back to the
+ * recently observed high watermark of concurrent users.
+ *
+ * Each slab is prefixed with a header recording its size class; the
+ * header is sized to preserve the allocator's natural alignment for the
+ * payload.
+ */
+
+typedef struct {
+    NvU64 class;
+} NVPreallocPoolSlabHeaderRec;
+
+/* Sentinel class for oversized allocations that bypass the cache. */
+#define NV_PREALLOC_POOL_CLASS_UNPOOLED NV_PREALLOC_POOL_NUM_CLASSES
+
+/* How many releases to observe in a class between cache trims. */
+#define NV_PREALLOC_POOL_TRIM_PUT_INTERVAL 128
+
+static size_t PoolClassSize(NvU32 class)
+{
+    return (size_t)NV_PREALLOC_POOL_MIN_SLAB_SIZE << class;
+}
+
+static NvU32 PoolClassForSize(size_t size)
+{
+    NvU32 class;
+
+    for (class = 0; class < NV_PREALLOC_POOL_NUM_CLASSES; class++) {
+        if (size <= PoolClassSize(class)) {
+            return class;
+        }
+    }
+
+    return NV_PREALLOC_POOL_CLASS_UNPOOLED;
+}
+
+void *nvPreallocPoolGet(NVDevEvoPtr pDevEvo, size_t size)
+{
+    const NvU32 class = PoolClassForSize(size);
+    NVPreallocPoolSlabHeaderRec *pHeader = NULL;
+
+    if (class != NV_PREALLOC_POOL_CLASS_UNPOOLED) {
+        struct NVPreallocPoolClassRec *pClass = &pDevEvo->prealloc.pool[class];
+
+        if (pClass->numFree > 0) {
+            pClass->numFree--;
+            pHeader = pClass->freeSlab[pClass->numFree];
+            pClass->freeSlab[pClass->numFree] = NULL;
+        } else {
+            pHeader = nvAlloc(sizeof(*pHeader) + PoolClassSize(class));
+        }
+
+        if (pHeader == NULL) {
+            return NULL;
+        }
+
+        pClass->numOutstanding++;
+        if (pClass->numOutstanding > pClass->highWater) {
+            pClass->highWater = pClass->numOutstanding;
+        }
+    } else {
+        pHeader = nvAlloc(sizeof(*pHeader) + size);
+
+        if (pHeader == NULL) {
+            return NULL;
+        }
+    }
+
+    pHeader->class = class;
+
+    nvkms_memset(pHeader + 1, 0, size);
+
+    return pHeader + 1;
+}
+
+void nvPreallocPoolPut(NVDevEvoPtr pDevEvo, void *ptr)
+{
+    NVPreallocPoolSlabHeaderRec *pHeader;
+    struct NVPreallocPoolClassRec *pClass;
+
+    if (ptr == NULL) {
+        return;
+    }
+
+    pHeader = (NVPreallocPoolSlabHeaderRec *)ptr - 1;
+
+    if (pHeader->class == NV_PREALLOC_POOL_CLASS_UNPOOLED) {
+        nvFree(pHeader);
+        return;
+    }
+
+    nvAssert(pHeader->class < NV_PREALLOC_POOL_NUM_CLASSES);
+
+    pClass = &pDevEvo->prealloc.pool[pHeader->class];
+
+    nvAssert(pClass->numOutstanding > 0);
+    pClass->numOutstanding--;
+
+    if (pClass->numFree < NV_PREALLOC_POOL_MAX_CACHED_SLABS) {
+        pClass->freeSlab[pClass->numFree] = pHeader;
+        pClass->numFree++;
+    } else {
+        nvFree(pHeader);
+    }
+
+    /*
+     * Periodically trim cached slabs the recent workload didn't need:
+     * discard cache entries above the high watermark of concurrent users
+     * observed since the previous trim, then restart the measurement.
+     */
+    pClass->putsSinceTrim++;
+    if (pClass->putsSinceTrim >= NV_PREALLOC_POOL_TRIM_PUT_INTERVAL) {
+        while (pClass->numFree > 0 &&
+               pClass->numFree + pClass->numOutstanding > pClass->highWater) {
+            pClass->numFree--;
+            nvFree(pClass->freeSlab[pClass->numFree]);
+            pClass->freeSlab[pClass->numFree] = NULL;
+        }
+
+        pClass->highWater = pClass->numOutstanding;
+        pClass->putsSinceTrim = 0;
+    }
 }
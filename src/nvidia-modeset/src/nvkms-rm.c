@@ -34,8 +34,10 @@
 #include "nvkms-types.h"
 #include "nvkms-evo.h"
 #include "nvkms-dma.h"
+#include "nvkms-ctxdma.h"
 #include "nvkms-utils.h"
 #include "nvkms-private.h"
+#include "nvkms-modepool.h"
 #include "nvkms-modeset.h"
 #include "nvkms-surface.h"
 #include "nvkms-vrr.h"
@@ -298,6 +300,9 @@ static void FreeDisplay(NVDispEvoPtr pDispEvo)
 
     nvkms_free_ref_ptr(pDispEvo->ref_ptr);
 
+    nvFreeModeValidationCache(pDispEvo);
+    nvFreeImpMemoEvo(pDispEvo);
+
     nvInvalidateRasterLockGroupsEvo();
     nvFree(pDispEvo);
 }
@@ -2567,14 +2572,15 @@ void nvRmFreeEvoDma(NVDevEvoPtr pDevEvo, NVEvoDmaPtr pDma)
 /*****************************************************************************/
 /* RmAllocEvoChannel ()
  * Allocates the EVO channel and associated notifier surfaces and ctxdmas.
- * Takes how big the DMA controls are (varies by class of channel) and which
- * class to allocate.
+ * Takes how big the DMA controls are (varies by class of channel), which
+ * class to allocate, and the pushbuffer size in bytes.
  */
 /*****************************************************************************/
 static NVEvoChannelPtr
 RmAllocEvoChannel(NVDevEvoPtr pDevEvo,
                   NVEvoChannelMask channelMask,
-                  NvV32 instance, NvU32 class)
+                  NvV32 instance, NvU32 class,
+                  NvU32 pushBufferSize)
 {
     NVEvoChannelPtr pChannel = NULL;
     NVDmaBufferEvoPtr buffer = NULL;
@@ -2628,7 +2634,7 @@ RmAllocEvoChannel(NVDevEvoPtr pDevEvo,
         if (sd == 0) {
             NV50VAIO_CHANNELDMA_ALLOCATION_PARAMETERS ChannelAllocParams = { 0 };
 
-            NvU64 limit = NV_DMA_EVO_PUSH_BUFFER_SIZE - 1;
+            NvU64 limit = pushBufferSize - 1;
             NVEvoDmaPtr pDma = &buffer->dma;
 
             // Allocation of the push buffer
@@ -2700,7 +2706,7 @@ RmAllocEvoChannel(NVDevEvoPtr pDevEvo,
     /* Initialize the rest of the required push buffer information */
     buffer->buffer          = buffer->base;
     buffer->end             = (NvU32 *)((char *)buffer->base +
-                              NV_DMA_EVO_PUSH_BUFFER_SIZE - 8);
+                              pushBufferSize - 8);
 
     /*
      * Due to hardware bug 235044, we can not use the last 12 dwords of the
@@ -2709,7 +2715,7 @@ RmAllocEvoChannel(NVDevEvoPtr pDevEvo,
      * This bug is fixed in Volta and newer, so this workaround can be removed
      * when Pascal support is dropped. See bug 3116066.
      */
-    buffer->offset_max   = NV_DMA_EVO_PUSH_BUFFER_SIZE -
+    buffer->offset_max   = pushBufferSize -
                            NV_DMA_EVO_PUSH_BUFFER_PAD_SIZE;
     buffer->fifo_free_count = (buffer->offset_max >> 2) - 2;
     buffer->put_offset   = 0;
@@ -2964,7 +2970,8 @@ AllocImmediateChannelDma(NVDevEvoPtr pDevEvo,
     NVEvoChannelPtr pImmChannel = RmAllocEvoChannel(
         pDevEvo,
         DRF_DEF64(_EVO, _CHANNEL_MASK, _WINDOW_IMM, _ENABLE),
-        pChannel->instance, immClass);
+        pChannel->instance, immClass,
+        NV_DMA_EVO_PUSH_BUFFER_SIZE);
 
     if (!pImmChannel) {
         return FALSE;
@@ -3002,7 +3009,8 @@ NvBool nvRMAllocateBaseChannels(NVDevEvoPtr pDevEvo)
         pDevEvo->base[head] = RmAllocEvoChannel(
             pDevEvo,
             DRF_IDX_DEF64(_EVO, _CHANNEL_MASK, _BASE, head, _ENABLE),
-            head, baseClass);
+            head, baseClass,
+            NV_DMA_EVO_FLIP_PUSH_BUFFER_SIZE);
 
         if (!pDevEvo->base[head]) {
             return FALSE;
@@ -3043,7 +3051,8 @@ NvBool nvRMAllocateOverlayChannels(NVDevEvoPtr pDevEvo)
         pDevEvo->overlay[head] = RmAllocEvoChannel(
             pDevEvo,
             DRF_IDX_DEF64(_EVO, _CHANNEL_MASK, _OVERLAY, head, _ENABLE),
-            head, NV917E_OVERLAY_CHANNEL_DMA);
+            head, NV917E_OVERLAY_CHANNEL_DMA,
+            NV_DMA_EVO_PUSH_BUFFER_SIZE);
 
         if (!pDevEvo->overlay[head]) {
             return FALSE;
@@ -3165,7 +3174,8 @@ NvBool nvRMAllocateWindowChannels(NVDevEvoPtr pDevEvo)
         pDevEvo->window[window] = RmAllocEvoChannel(
             pDevEvo,
             DRF_IDX_DEF64(_EVO, _CHANNEL_MASK, _WINDOW, window, _ENABLE),
-            window, c->windowClass);
+            window, c->windowClass,
+            NV_DMA_EVO_FLIP_PUSH_BUFFER_SIZE);
 
         if (!pDevEvo->window[window]) {
             return FALSE;
@@ -3236,7 +3246,8 @@ static NVEvoChannel* EvoAllocateCoreChannel(NVDevEvoRec *pDevEvo)
         RmAllocEvoChannel(pDevEvo,
                           DRF_DEF64(_EVO, _CHANNEL_MASK, _CORE, _ENABLE),
                           0,
-                          pDevEvo->coreChannelDma.coreChannelClass);
+                          pDevEvo->coreChannelDma.coreChannelClass,
+                          NV_DMA_EVO_PUSH_BUFFER_SIZE);
 
     if (pChannel == NULL) {
         goto failed;
@@ -5541,25 +5552,54 @@ NvU32 nvRmAllocAndBindSurfaceDescriptor(
         return ret;
     }
 
-    ret =
-        pDevEvo->hal->BindSurfaceDescriptor(pDevEvo,
-                                            pDevEvo->core,
-                                            &surfaceDesc);
-    if (ret != NVOS_STATUS_SUCCESS) {
-        goto free_this_handle_and_fail;
-    }
+    if (surfaceDesc.ctxDmaHandle != 0) {
+        /*
+         * The descriptor is a ctxDma: bind it to the core channel and
+         * every layer channel with one batched RM submission, instead of
+         * one RM round trip per channel.
+         */
+        NVEvoChannelPtr channels[1 + NVKMS_MAX_HEADS_PER_DISP *
+                                     NVKMS_MAX_LAYERS_PER_HEAD];
+        NvU32 numChannels = 0;
 
-    for (head = 0; head < pDevEvo->numHeads; head++) {
-        for (layer = 0; layer < pDevEvo->head[head].numLayers; layer++) {
-            if (pDevEvo->head[head].layer[layer]) {
-                 nvAssert(pDevEvo->head[head].layer[layer]->pb.channel_handle);
-
-                 ret = pDevEvo->hal->BindSurfaceDescriptor(pDevEvo,
-                         pDevEvo->head[head].layer[layer],
-                         &surfaceDesc);
-                 if (ret != NVOS_STATUS_SUCCESS) {
-                     goto free_this_handle_and_fail;
-                 }
+        channels[numChannels++] = pDevEvo->core;
+
+        for (head = 0; head < pDevEvo->numHeads; head++) {
+            for (layer = 0; layer < pDevEvo->head[head].numLayers; layer++) {
+                if (pDevEvo->head[head].layer[layer]) {
+                    nvAssert(pDevEvo->head[head].layer[layer]->pb.channel_handle);
+
+                    channels[numChannels++] = pDevEvo->head[head].layer[layer];
+                }
+            }
+        }
+
+        ret = nvCtxDmaBindChannels(pDevEvo, channels, numChannels,
+                                   surfaceDesc.ctxDmaHandle);
+        if (ret != NVOS_STATUS_SUCCESS) {
+            goto free_this_handle_and_fail;
+        }
+    } else {
+        ret =
+            pDevEvo->hal->BindSurfaceDescriptor(pDevEvo,
+                                                pDevEvo->core,
+                                                &surfaceDesc);
+        if (ret != NVOS_STATUS_SUCCESS) {
+            goto free_this_handle_and_fail;
+        }
+
+        for (head = 0; head < pDevEvo->numHeads; head++) {
+            for (layer = 0; layer < pDevEvo->head[head].numLayers; layer++) {
+                if (pDevEvo->head[head].layer[layer]) {
+                     nvAssert(pDevEvo->head[head].layer[layer]->pb.channel_handle);
+
+                     ret = pDevEvo->hal->BindSurfaceDescriptor(pDevEvo,
+                             pDevEvo->head[head].layer[layer],
+                             &surfaceDesc);
+                     if (ret != NVOS_STATUS_SUCCESS) {
+                         goto free_this_handle_and_fail;
+                     }
+                }
             }
         }
     }
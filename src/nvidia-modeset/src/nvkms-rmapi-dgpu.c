@@ -100,6 +100,63 @@ NvU32 nvRmApiControl(
     return ops.params.control.status;
 }
 
+/*
+ * Number of operations submitted to the OS interface at a time by
+ * nvRmApiControlBatch(); bounds the on-stack ops array.
+ */
+#define NV_RM_API_BATCH_CHUNK_OPS 8
+
+NvU32 nvRmApiControlBatch(
+    NvU32 hClient,
+    NvU32 hObject,
+    NvU32 cmd,
+    void *pParams,
+    NvU32 paramsSize,
+    NvU32 numOps,
+    NvU32 *pStatuses)
+{
+    nvidia_kernel_rmapi_ops_t ops[NV_RM_API_BATCH_CHUNK_OPS];
+    NvU8 *pParamBytes = pParams;
+    NvU32 status = NVOS_STATUS_SUCCESS;
+    NvU32 base, i;
+
+    for (base = 0; base < numOps; base += NV_RM_API_BATCH_CHUNK_OPS) {
+        NvU32 chunk = numOps - base;
+
+        if (chunk > NV_RM_API_BATCH_CHUNK_OPS) {
+            chunk = NV_RM_API_BATCH_CHUNK_OPS;
+        }
+
+        nvkms_memset(ops, 0, sizeof(ops[0]) * chunk);
+
+        for (i = 0; i < chunk; i++) {
+            ops[i].op = NV04_CONTROL;
+
+            ops[i].params.control.hClient    = hClient;
+            ops[i].params.control.hObject    = hObject;
+            ops[i].params.control.cmd        = cmd;
+            ops[i].params.control.params     =
+                NV_PTR_TO_NvP64(pParamBytes +
+                                ((size_t)(base + i) * paramsSize));
+            ops[i].params.control.paramsSize = paramsSize;
+        }
+
+        nvkms_call_rm_batch(ops, chunk, sizeof(ops[0]));
+
+        for (i = 0; i < chunk; i++) {
+            if (pStatuses != NULL) {
+                pStatuses[base + i] = ops[i].params.control.status;
+            }
+            if ((status == NVOS_STATUS_SUCCESS) &&
+                (ops[i].params.control.status != NVOS_STATUS_SUCCESS)) {
+                status = ops[i].params.control.status;
+            }
+        }
+    }
+
+    return status;
+}
+
 NvU32 nvRmApiDupObject2(
     NvU32 hClient,
     NvU32 hParent,
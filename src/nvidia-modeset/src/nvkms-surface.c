@@ -26,9 +26,11 @@
 #include "nvkms-rmapi.h"
 #include "nvkms-utils.h"
 #include "nvkms-flip.h"
+#include "nvkms-modeset.h"
 #include "nvkms-private.h"
 #include "nvkms-headsurface.h"
 #include "nvkms-headsurface-swapgroup.h"
+#include "nvidia-modeset-os-interface.h"
 #include "nvos.h"
 
 // NV0000_CTRL_CMD_OS_UNIX_IMPORT_OBJECT_FROM_FD
@@ -1333,3 +1335,118 @@ NvBool nvEvoAccelVblankSemControls(
                           NV0073_CTRL_CMD_SYSTEM_ACCEL_VBLANK_SEM_CONTROLS,
                           &params, sizeof(params)) == NVOS_STATUS_SUCCESS;
 }
+
+static void VblankInfoControlCallback(NVDispEvoRec *pDispEvo,
+                                      NVVBlankCallbackPtr pCallbackData)
+{
+    const NVVblankInfoControl *pVblankInfoControl = pCallbackData->pUserData;
+    struct NvKmsVblankInfoData *pData = pVblankInfoControl->pData;
+
+    /*
+     * Seqlock write protocol: the sequence number is odd while the payload is
+     * being updated.  Readers retry if they observe an odd sequence number, or
+     * if the sequence number changed while they read the payload.
+     */
+    pData->sequence++;
+    pData->vblankCount++;
+    pData->timeStampUs = nvkms_get_usec();
+    pData->sequence++;
+}
+
+NVVblankInfoControl *nvEvoEnableVblankInfoControl(
+    NVDevEvoRec *pDevEvo,
+    NVDispEvoRec *pDispEvo,
+    NvU32 apiHead,
+    NVSurfaceEvoRec *pSurfaceEvo,
+    NvU64 surfaceOffset)
+{
+    NVVblankInfoControl *pVblankInfoControl;
+    NvU32 ret;
+
+    /*
+     * We cannot enable VblankInfoControl if the requested offset within the
+     * surface is too large.
+     */
+    if (A_plus_B_greater_than_C_U64(
+            surfaceOffset,
+            sizeof(struct NvKmsVblankInfoData),
+            pSurfaceEvo->planes[0].rmObjectSizeInBytes)) {
+        return NULL;
+    }
+
+    if (nvEvoSurfaceRefCntsTooLarge(pSurfaceEvo)) {
+        return NULL;
+    }
+
+    pVblankInfoControl = nvCalloc(1, sizeof(*pVblankInfoControl));
+
+    if (pVblankInfoControl == NULL) {
+        return NULL;
+    }
+
+    /* Get a CPU mapping of the surface through the vblank info data. */
+
+    ret = nvRmApiMapMemory(nvEvoGlobal.clientHandle,
+                           pDevEvo->deviceHandle,
+                           pSurfaceEvo->planes[0].rmHandle,
+                           0,
+                           surfaceOffset + sizeof(struct NvKmsVblankInfoData),
+                           &pVblankInfoControl->pCpuMapping,
+                           0);
+
+    if (ret != NVOS_STATUS_SUCCESS) {
+        nvFree(pVblankInfoControl);
+        return NULL;
+    }
+
+    pVblankInfoControl->pDispEvo = pDispEvo;
+    pVblankInfoControl->apiHead = apiHead;
+    pVblankInfoControl->surfaceOffset = surfaceOffset;
+    pVblankInfoControl->pSurfaceEvo = pSurfaceEvo;
+    pVblankInfoControl->pData = (struct NvKmsVblankInfoData *)
+        ((NvU8 *)pVblankInfoControl->pCpuMapping + surfaceOffset);
+
+    nvkms_memset(pVblankInfoControl->pData, 0,
+                 sizeof(*pVblankInfoControl->pData));
+
+    pVblankInfoControl->pVBlankCallback =
+        nvApiHeadRegisterVBlankCallback(pDispEvo,
+                                        apiHead,
+                                        VblankInfoControlCallback,
+                                        pVblankInfoControl);
+
+    if (pVblankInfoControl->pVBlankCallback == NULL) {
+        nvRmApiUnmapMemory(nvEvoGlobal.clientHandle,
+                           pDevEvo->deviceHandle,
+                           pSurfaceEvo->planes[0].rmHandle,
+                           pVblankInfoControl->pCpuMapping,
+                           0);
+        nvFree(pVblankInfoControl);
+        return NULL;
+    }
+
+    nvEvoIncrementSurfaceRefCnts(pSurfaceEvo);
+
+    return pVblankInfoControl;
+}
+
+NvBool nvEvoDisableVblankInfoControl(
+    NVDevEvoRec *pDevEvo,
+    NVVblankInfoControl *pVblankInfoControl)
+{
+    nvApiHeadUnregisterVBlankCallback(pVblankInfoControl->pDispEvo,
+                                      pVblankInfoControl->pVBlankCallback);
+
+    nvRmApiUnmapMemory(
+        nvEvoGlobal.clientHandle,
+        pDevEvo->deviceHandle,
+        pVblankInfoControl->pSurfaceEvo->planes[0].rmHandle,
+        pVblankInfoControl->pCpuMapping,
+        0);
+
+    nvEvoDecrementSurfaceRefCnts(pDevEvo, pVblankInfoControl->pSurfaceEvo);
+
+    nvFree(pVblankInfoControl);
+
+    return TRUE;
+}
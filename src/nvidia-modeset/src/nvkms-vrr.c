@@ -23,6 +23,7 @@
 
 #include "nvkms-dma.h"
 #include "nvkms-evo.h"
+#include "nvkms-private.h"
 #include "nvkms-rm.h"
 #include "nvkms-rmapi.h"
 #include "nvkms-vrr.h"
@@ -1055,6 +1056,15 @@ static NvBool SetVrrActivePriv(NVDevEvoPtr pDevEvo, NvBool active)
         return NV_TRUE;
     }
 
+    /*
+     * The cursor motion fast path is only armed while VRR is inactive
+     * (cursor moves under VRR need an unstall timer); tear it down
+     * before activating VRR.
+     */
+    if (active) {
+        nvKmsQuiesceCursorFastPath(pDevEvo);
+    }
+
     // TODO: Drain the base channel first?
     SetStallLockOneDev(pDevEvo, active);
 
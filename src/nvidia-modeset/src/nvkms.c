@@ -36,6 +36,7 @@
 #include "nvkms-modepool.h"
 #include "nvkms-modeset.h"
 #include "nvkms-attributes.h"
+#include "nvkms-cursor.h" /* nvEvoMoveCursorInternal */
 #include "nvkms-dpy-override.h"
 #include "nvkms-framelock.h"
 #include "nvkms-surface.h"
@@ -146,6 +147,7 @@ struct NvKmsPerOpenDisp {
     NVEvoApiHandlesRec           vblankSyncObjectHandles[NVKMS_MAX_HEADS_PER_DISP];
     NVEvoApiHandlesRec           vblankCallbackHandles[NVKMS_MAX_HEADS_PER_DISP];
     NVEvoApiHandlesRec           vblankSemControlHandles;
+    NVEvoApiHandlesRec           vblankInfoControlHandles;
 };
 
 struct NvKmsPerOpenDev {
@@ -161,9 +163,20 @@ struct NvKmsPerOpenDev {
     NVEvoApiHandlesRec           swapGroupHandles;
 };
 
-struct NvKmsPerOpenEventListEntry {
-    NVListRec                    eventListEntry;
-    struct NvKmsEvent            event;
+/*
+ * Fixed-size ring of events pending delivery to one client.  The producer
+ * side (SendEvent(), always called with the global NVKMS lock held)
+ * advances 'put'; consumers (NVKMS_IOCTL_GET_NEXT_EVENT, possibly without
+ * the global lock through nvKmsIoctlLockless()) claim entries by advancing
+ * 'get' with a compare-and-swap.  Both indices increase monotonically and
+ * are reduced modulo NVKMS_EVENT_RING_SIZE on access.
+ */
+#define NVKMS_EVENT_RING_SIZE 256
+
+struct NvKmsPerOpenEventRing {
+    struct NvKmsEvent            event[NVKMS_EVENT_RING_SIZE];
+    NvU32                        put;
+    NvU32                        get;
 };
 
 struct NvKmsPerOpen {
@@ -176,10 +189,32 @@ struct NvKmsPerOpen {
 
     union {
         struct {
-            NVListRec            eventList;
+            struct NvKmsPerOpenEventRing *pEventRing;
             NvU32                eventInterestMask;
             NVEvoApiHandlesRec   devHandles;
             NVEvoApiHandlesRec   frameLockHandles;
+
+            /*
+             * Cached state for the lockless cursor motion fast path.
+             * Armed (under the global lock) by MoveCursor() after a
+             * successful locked cursor move, consumed without the global
+             * lock by MoveCursorLockless(), and torn down by
+             * nvKmsQuiesceCursorFastPath() before any state it depends
+             * on (head configuration, cursor PIO mappings, VRR state)
+             * changes.  'busy' is claimed with an atomic exchange by
+             * whoever reads or writes the rest of the structure.
+             */
+            struct {
+                NvU32             busy;
+                NvBool            valid;
+                NvKmsDeviceHandle deviceHandle;
+                NvKmsDispHandle   dispHandle;
+                NvU32             apiHead;
+                NVDispEvoPtr      pDispEvo;
+                NvU32             numHwHeads;
+                NvU32             hwHead[NVKMS_MAX_HEADS_PER_DISP];
+                NvS16             xOffset[NVKMS_MAX_HEADS_PER_DISP];
+            } cursorFastPath;
         } ioctl;
 
         struct {
@@ -700,6 +735,8 @@ static void ClearPerOpenDisp(
 
     nvEvoDestroyApiHandles(&pOpenDisp->vblankSemControlHandles);
 
+    nvEvoDestroyApiHandles(&pOpenDisp->vblankInfoControlHandles);
+
     nvEvoDestroyApiHandle(&pOpenDev->dispHandles, pOpenDisp->nvKmsApiHandle);
 
     nvkms_memset(pOpenDisp, 0, sizeof(*pOpenDisp));
@@ -783,6 +820,15 @@ static NvBool InitPerOpenDisp(
         goto fail;
     }
 
+    /* Initialize the vblankInfoControlHandles.
+     *
+     * The initial value of VBLANK_SYNC_OBJECTS_PER_HEAD doesn't really apply
+     * here, but we need something. */
+    if (!nvEvoInitApiHandles(&pOpenDisp->vblankInfoControlHandles,
+                             NVKMS_MAX_VBLANK_SYNC_OBJECTS_PER_HEAD)) {
+        goto fail;
+    }
+
     if (!AllocPerOpenFrameLock(pOpen, pOpenDisp)) {
         goto fail;
     }
@@ -1284,7 +1330,10 @@ static NvBool AssignNvKmsPerOpenType(struct NvKmsPerOpen *pOpen,
 
     switch (type) {
     case NvKmsPerOpenTypeIoctl:
-        nvListInit(&pOpen->ioctl.eventList);
+        pOpen->ioctl.pEventRing = NULL;
+
+        nvkms_memset(&pOpen->ioctl.cursorFastPath, 0,
+                     sizeof(pOpen->ioctl.cursorFastPath));
 
         if (!nvEvoInitApiHandles(&pOpen->ioctl.devHandles, NV_MAX_DEVICES)) {
             return FALSE;
@@ -1599,14 +1648,50 @@ static void DisableRemainingVblankSemControls(
     }
 }
 
+static void DisableRemainingVblankInfoControls(
+    struct NvKmsPerOpen *pOpen,
+    struct NvKmsPerOpenDev *pOpenDev)
+{
+    struct NvKmsPerOpenDisp *pOpenDisp;
+    NvKmsGenericHandle dispHandle;
+    NVDevEvoPtr pDevEvo = pOpenDev->pDevEvo;
+
+    nvAssert(pOpen->type == NvKmsPerOpenTypeIoctl);
+
+    FOR_ALL_POINTERS_IN_EVO_API_HANDLES(&pOpenDev->dispHandles,
+                                        pOpenDisp,
+                                        dispHandle) {
+
+        NVVblankInfoControl *pVblankInfoControl;
+        NvKmsGenericHandle vblankInfoControlHandle;
+
+        FOR_ALL_POINTERS_IN_EVO_API_HANDLES(&pOpenDisp->vblankInfoControlHandles,
+                                            pVblankInfoControl,
+                                            vblankInfoControlHandle) {
+            NvBool ret =
+                nvEvoDisableVblankInfoControl(pDevEvo, pVblankInfoControl);
+
+            if (!ret) {
+                nvAssert(!"implicit disable of vblank info control failed.");
+            }
+            nvEvoDestroyApiHandle(&pOpenDisp->vblankInfoControlHandles,
+                                  vblankInfoControlHandle);
+        }
+    }
+}
+
 static void FreeDeviceReference(struct NvKmsPerOpen *pOpen,
                                 struct NvKmsPerOpenDev *pOpenDev)
 {
+    nvKmsQuiesceCursorFastPath(pOpenDev->pDevEvo);
+
     /* Disable all client-owned vblank sync objects that still exist. */
     DisableRemainingVblankSyncObjects(pOpen, pOpenDev);
 
     DisableRemainingVblankSemControls(pOpen, pOpenDev);
 
+    DisableRemainingVblankInfoControls(pOpen, pOpenDev);
+
     FreeSwapGroups(pOpenDev);
 
     UnregisterDeferredRequestFifos(pOpenDev);
@@ -2253,6 +2338,159 @@ static NvBool SetCursorImage(struct NvKmsPerOpen *pOpen,
                                    &pParams->request.common);
 }
 
+/*!
+ * Arm the lockless cursor motion fast path for this client.
+ *
+ * Called with the global lock held, after a successful locked cursor
+ * move.  Snapshot everything MoveCursorLockless() needs (the hardware
+ * heads driving the api head, and each head's viewport tile offset), so
+ * that subsequent NVKMS_IOCTL_MOVE_CURSOR requests for the same head can
+ * be satisfied without taking the global lock.
+ *
+ * The fast path is only armed when nothing beyond the cursor PIO write
+ * is needed: no headSurface on the head (cursor motion would require
+ * re-rendering) and VRR inactive (cursor motion would require an
+ * unstall timer).
+ */
+static void ArmCursorFastPath(struct NvKmsPerOpen *pOpen,
+                              NVDispEvoPtr pDispEvo,
+                              const struct NvKmsMoveCursorParams *pParams)
+{
+    const NvU32 apiHead = pParams->request.head;
+    const NVDispApiHeadStateEvoRec *pApiHeadState =
+        &pDispEvo->apiHeadState[apiHead];
+    NVDevEvoPtr pDevEvo = pDispEvo->pDevEvo;
+    NvU32 head, numHwHeads;
+
+    /*
+     * Claim the cache against a concurrent lockless consumer from
+     * another thread of the same client; if one is inside the fast path
+     * right now, just skip re-arming.
+     */
+    if (__atomic_exchange_n(&pOpen->ioctl.cursorFastPath.busy, 1,
+                            __ATOMIC_ACQUIRE) != 0) {
+        return;
+    }
+
+    pOpen->ioctl.cursorFastPath.valid = FALSE;
+
+    if ((pDispEvo->pHsChannel[apiHead] == NULL) &&
+        !pDevEvo->vrr.active) {
+
+        numHwHeads = 0;
+        FOR_EACH_EVO_HW_HEAD_IN_MASK(pApiHeadState->hwHeadsMask, head) {
+            const NVDispHeadStateEvoRec *pHeadState =
+                &pDispEvo->headState[head];
+
+            pOpen->ioctl.cursorFastPath.hwHead[numHwHeads] = head;
+            pOpen->ioctl.cursorFastPath.xOffset[numHwHeads] =
+                pHeadState->timings.viewPort.in.width *
+                pHeadState->tilePosition;
+            numHwHeads++;
+        }
+
+        pOpen->ioctl.cursorFastPath.numHwHeads = numHwHeads;
+        pOpen->ioctl.cursorFastPath.deviceHandle =
+            pParams->request.deviceHandle;
+        pOpen->ioctl.cursorFastPath.dispHandle =
+            pParams->request.dispHandle;
+        pOpen->ioctl.cursorFastPath.apiHead = apiHead;
+        pOpen->ioctl.cursorFastPath.pDispEvo = pDispEvo;
+
+        __atomic_store_n(&pOpen->ioctl.cursorFastPath.valid, TRUE,
+                         __ATOMIC_RELEASE);
+    }
+
+    __atomic_store_n(&pOpen->ioctl.cursorFastPath.busy, 0,
+                     __ATOMIC_RELEASE);
+}
+
+/*!
+ * Attempt a cursor move without the global lock, using the state cached
+ * by ArmCursorFastPath().
+ *
+ * \return  TRUE if the move was performed; FALSE if the caller should
+ *          fall back to the locked path.
+ */
+static NvBool MoveCursorLockless(struct NvKmsPerOpen *pOpen,
+                                 const struct NvKmsMoveCursorParams *pParams)
+{
+    NvBool done = FALSE;
+
+    if (__atomic_exchange_n(&pOpen->ioctl.cursorFastPath.busy, 1,
+                            __ATOMIC_ACQUIRE) != 0) {
+        return FALSE;
+    }
+
+    if (__atomic_load_n(&pOpen->ioctl.cursorFastPath.valid,
+                        __ATOMIC_ACQUIRE) &&
+        (pParams->request.deviceHandle ==
+         pOpen->ioctl.cursorFastPath.deviceHandle) &&
+        (pParams->request.dispHandle ==
+         pOpen->ioctl.cursorFastPath.dispHandle) &&
+        (pParams->request.head == pOpen->ioctl.cursorFastPath.apiHead)) {
+
+        NVDispEvoPtr pDispEvo = pOpen->ioctl.cursorFastPath.pDispEvo;
+        NVDevEvoPtr pDevEvo = pDispEvo->pDevEvo;
+        const NvU32 sd = pDispEvo->displayOwner;
+        NvU32 i;
+
+        for (i = 0; i < pOpen->ioctl.cursorFastPath.numHwHeads; i++) {
+            const NvU32 head = pOpen->ioctl.cursorFastPath.hwHead[i];
+            const NvS16 x = pParams->request.common.x -
+                            pOpen->ioctl.cursorFastPath.xOffset[i];
+            const NvS16 y = pParams->request.common.y;
+
+            pDevEvo->gpus[sd].headState[head].cursor.x = x;
+            pDevEvo->gpus[sd].headState[head].cursor.y = y;
+
+            nvEvoMoveCursorInternal(pDispEvo, head, x, y);
+        }
+
+        done = TRUE;
+    }
+
+    __atomic_store_n(&pOpen->ioctl.cursorFastPath.busy, 0, __ATOMIC_RELEASE);
+
+    return done;
+}
+
+void nvKmsQuiesceCursorFastPath(const NVDevEvoRec *pDevEvo)
+{
+    struct NvKmsPerOpen *pOpen;
+
+    nvListForEachEntry(pOpen, &perOpenIoctlList, perOpenIoctlListEntry) {
+
+        if (!pOpen->ioctl.cursorFastPath.valid) {
+            continue;
+        }
+
+        if ((pDevEvo != NULL) &&
+            (pOpen->ioctl.cursorFastPath.pDispEvo->pDevEvo != pDevEvo)) {
+            continue;
+        }
+
+        /*
+         * Claim 'busy' with the same exchange protocol the movers use.
+         * This both waits for a mover currently inside the fast path to
+         * drain, and orders the valid=FALSE store below against the next
+         * mover's exchange; a release store of 'valid' followed by an
+         * acquire poll of 'busy' would not order that store-load pair,
+         * and a mover could still read stale valid==TRUE after quiesce
+         * returned.
+         */
+        while (__atomic_exchange_n(&pOpen->ioctl.cursorFastPath.busy, 1,
+                                   __ATOMIC_ACQUIRE) != 0) {
+            nvkms_yield();
+        }
+
+        pOpen->ioctl.cursorFastPath.valid = FALSE;
+
+        __atomic_store_n(&pOpen->ioctl.cursorFastPath.busy, 0,
+                         __ATOMIC_RELEASE);
+    }
+}
+
 /*!
  * Change the cursor position.
  */
@@ -2276,9 +2514,15 @@ static NvBool MoveCursor(struct NvKmsPerOpen *pOpen,
         return FALSE;
     }
 
-    return nvHsIoctlMoveCursor(pDispEvo,
-                               pParams->request.head,
-                               &pParams->request.common);
+    if (!nvHsIoctlMoveCursor(pDispEvo,
+                             pParams->request.head,
+                             &pParams->request.common)) {
+        return FALSE;
+    }
+
+    ArmCursorFastPath(pOpen, pDispEvo, pParams);
+
+    return TRUE;
 }
 
 /* No extra user state needed for SetLut; although we lose the user pointers
@@ -3235,39 +3479,66 @@ static NvBool GetFrameLockAttributeValidValues(struct NvKmsPerOpen *pOpen,
 
 
 /*!
- * Pop the next event off of the client's event queue.
+ * Claim and copy out the oldest event in the client's event ring, if any.
+ *
+ * The producer side (SendEvent()) always runs with the global NVKMS lock
+ * held, but this may be called without it: 'get' is advanced with a
+ * compare-and-swap so concurrent consumers never deliver the same event
+ * twice, and the entry is copied before the claim so the producer cannot
+ * recycle the slot while it is being read.
  */
-static NvBool GetNextEvent(struct NvKmsPerOpen *pOpen,
-                           void *pParamsVoid)
+static NvBool EventRingDequeue(struct NvKmsPerOpen *pOpen,
+                               struct NvKmsEvent *pEvent)
 {
-    struct NvKmsGetNextEventParams *pParams = pParamsVoid;
-    struct NvKmsPerOpenEventListEntry *pEntry;
-
-    nvAssert(pOpen->type == NvKmsPerOpenTypeIoctl);
+    struct NvKmsPerOpenEventRing *pRing =
+        __atomic_load_n(&pOpen->ioctl.pEventRing, __ATOMIC_ACQUIRE);
+    NvU32 get, put;
 
-    if (nvListIsEmpty(&pOpen->ioctl.eventList)) {
-        pParams->reply.valid = FALSE;
-        return TRUE;
+    if (pRing == NULL) {
+        return FALSE;
     }
 
-    pEntry = nvListFirstEntry(&pOpen->ioctl.eventList,
-                              struct NvKmsPerOpenEventListEntry,
-                              eventListEntry);
-
-    pParams->reply.valid = TRUE;
-    pParams->reply.event = pEntry->event;
+    do {
+        get = __atomic_load_n(&pRing->get, __ATOMIC_RELAXED);
+        put = __atomic_load_n(&pRing->put, __ATOMIC_ACQUIRE);
 
-    nvListDel(&pEntry->eventListEntry);
+        if (get == put) {
+            return FALSE;
+        }
 
-    nvFree(pEntry);
+        *pEvent = pRing->event[get % NVKMS_EVENT_RING_SIZE];
+    } while (!__atomic_compare_exchange_n(&pRing->get, &get, get + 1,
+                                          FALSE /* weak */,
+                                          __ATOMIC_RELEASE,
+                                          __ATOMIC_RELAXED));
 
-    if (nvListIsEmpty(&pOpen->ioctl.eventList)) {
+    if ((get + 1) == put) {
         nvkms_event_queue_changed(pOpen->pOpenKernel, FALSE);
+
+        /* Re-signal if the producer raced in another event. */
+        if (__atomic_load_n(&pRing->put, __ATOMIC_ACQUIRE) != (get + 1)) {
+            nvkms_event_queue_changed(pOpen->pOpenKernel, TRUE);
+        }
     }
 
     return TRUE;
 }
 
+/*!
+ * Pop the next event off of the client's event queue.
+ */
+static NvBool GetNextEvent(struct NvKmsPerOpen *pOpen,
+                           void *pParamsVoid)
+{
+    struct NvKmsGetNextEventParams *pParams = pParamsVoid;
+
+    nvAssert(pOpen->type == NvKmsPerOpenTypeIoctl);
+
+    pParams->reply.valid = EventRingDequeue(pOpen, &pParams->reply.event);
+
+    return TRUE;
+}
+
 
 /*!
  * Record the client's event interest for the specified device.
@@ -3279,6 +3550,23 @@ static NvBool DeclareEventInterest(struct NvKmsPerOpen *pOpen,
 
     nvAssert(pOpen->type == NvKmsPerOpenTypeIoctl);
 
+    if ((pParams->request.interestMask != 0) &&
+        (pOpen->ioctl.pEventRing == NULL)) {
+
+        struct NvKmsPerOpenEventRing *pRing = nvCalloc(1, sizeof(*pRing));
+
+        if (pRing == NULL) {
+            return FALSE;
+        }
+
+        /*
+         * Publish the ring only after it is fully initialized:
+         * nvKmsIoctlLockless() may load the pointer without holding the
+         * global NVKMS lock.
+         */
+        __atomic_store_n(&pOpen->ioctl.pEventRing, pRing, __ATOMIC_RELEASE);
+    }
+
     pOpen->ioctl.eventInterestMask = pParams->request.interestMask;
 
     return TRUE;
@@ -4858,6 +5146,107 @@ static NvBool AccelVblankSemControls(
                 hwHeadMask);
 }
 
+static NvBool EnableVblankInfoControl(
+    struct NvKmsPerOpen *pOpen,
+    void *pParamsVoid)
+{
+    struct NvKmsEnableVblankInfoControlParams *pParams = pParamsVoid;
+    struct NvKmsPerOpenDev *pOpenDev;
+    struct NvKmsPerOpenDisp *pOpenDisp;
+    NVDevEvoPtr pDevEvo;
+    NVDispEvoRec *pDispEvo;
+    NVSurfaceEvoPtr pSurfaceEvo;
+    NVVblankInfoControl *pVblankInfoControl;
+    NvKmsVblankInfoControlHandle vblankInfoControlHandle;
+
+    if (!GetPerOpenDevAndDisp(pOpen,
+                              pParams->request.deviceHandle,
+                              pParams->request.dispHandle,
+                              &pOpenDev,
+                              &pOpenDisp)) {
+        return FALSE;
+    }
+
+    pDevEvo = pOpenDev->pDevEvo;
+    pDispEvo = pOpenDisp->pDispEvo;
+
+    pSurfaceEvo =
+        nvEvoGetSurfaceFromHandleNoDispHWAccessOk(
+            pDevEvo,
+            &pOpenDev->surfaceHandles,
+            pParams->request.surfaceHandle);
+
+    if (pSurfaceEvo == NULL) {
+        return FALSE;
+    }
+
+    if (pParams->request.head >= pDevEvo->numApiHeads) {
+        return FALSE;
+    }
+
+    pVblankInfoControl = nvEvoEnableVblankInfoControl(
+                            pDevEvo,
+                            pDispEvo,
+                            pParams->request.head,
+                            pSurfaceEvo,
+                            pParams->request.surfaceOffset);
+
+    if (pVblankInfoControl == NULL) {
+        return FALSE;
+    }
+
+    vblankInfoControlHandle =
+        nvEvoCreateApiHandle(&pOpenDisp->vblankInfoControlHandles,
+                             pVblankInfoControl);
+
+    if (vblankInfoControlHandle == 0) {
+        (void)nvEvoDisableVblankInfoControl(pDevEvo, pVblankInfoControl);
+        return FALSE;
+    }
+
+    pParams->reply.vblankInfoControlHandle = vblankInfoControlHandle;
+
+    return TRUE;
+}
+
+static NvBool DisableVblankInfoControl(
+    struct NvKmsPerOpen *pOpen,
+    void *pParamsVoid)
+{
+    const struct NvKmsDisableVblankInfoControlParams *pParams = pParamsVoid;
+    struct NvKmsPerOpenDev *pOpenDev;
+    struct NvKmsPerOpenDisp *pOpenDisp;
+    NVDevEvoPtr pDevEvo;
+    NVVblankInfoControl *pVblankInfoControl;
+    NvBool ret;
+
+    if (!GetPerOpenDevAndDisp(pOpen,
+                              pParams->request.deviceHandle,
+                              pParams->request.dispHandle,
+                              &pOpenDev,
+                              &pOpenDisp)) {
+        return FALSE;
+    }
+
+    pDevEvo = pOpenDev->pDevEvo;
+
+    pVblankInfoControl =
+        nvEvoGetPointerFromApiHandle(&pOpenDisp->vblankInfoControlHandles,
+                                     pParams->request.vblankInfoControlHandle);
+    if (pVblankInfoControl == NULL) {
+        return FALSE;
+    }
+
+    ret = nvEvoDisableVblankInfoControl(pDevEvo, pVblankInfoControl);
+
+    if (ret) {
+        nvEvoDestroyApiHandle(&pOpenDisp->vblankInfoControlHandles,
+                              pParams->request.vblankInfoControlHandle);
+    }
+
+    return ret;
+}
+
 /*!
  * Perform the ioctl operation requested by the client.
  *
@@ -4983,6 +5372,8 @@ NvBool nvKmsIoctl(
         ENTRY(NVKMS_IOCTL_ENABLE_VBLANK_SEM_CONTROL, EnableVblankSemControl),
         ENTRY(NVKMS_IOCTL_DISABLE_VBLANK_SEM_CONTROL, DisableVblankSemControl),
         ENTRY(NVKMS_IOCTL_ACCEL_VBLANK_SEM_CONTROLS, AccelVblankSemControls),
+        ENTRY(NVKMS_IOCTL_ENABLE_VBLANK_INFO_CONTROL, EnableVblankInfoControl),
+        ENTRY(NVKMS_IOCTL_DISABLE_VBLANK_INFO_CONTROL, DisableVblankInfoControl),
     };
 
     struct NvKmsPerOpen *pOpen = pOpenVoid;
@@ -5069,6 +5460,114 @@ NvBool nvKmsIoctl(
 }
 
 
+/*!
+ * Handle an ioctl without the global NVKMS lock, if possible.
+ *
+ * Only NVKMS_IOCTL_GET_NEXT_EVENT and NVKMS_IOCTL_MOVE_CURSOR are
+ * currently eligible: draining the per-open event ring only requires the
+ * ring's own atomic index protocol, and cursor motion can be satisfied
+ * by the fast path cache armed by ArmCursorFastPath().  Handling these
+ * off the global lock keeps event-heavy periods (hotplug storms) from
+ * extending lock hold times seen by other clients, and keeps pointer
+ * motion smooth regardless of concurrent flip and modeset traffic.
+ *
+ * \return  TRUE if the ioctl was fully handled, with the result in *pRet.
+ *          FALSE if the caller should take the global lock and call
+ *          nvKmsIoctl() instead.
+ */
+NvBool nvKmsIoctlLockless(
+    void *pOpenVoid,
+    const NvU32 cmd,
+    const NvU64 paramsAddress,
+    const size_t paramSize,
+    NvBool *pRet)
+{
+    struct NvKmsPerOpen *pOpen = pOpenVoid;
+
+    if (pOpen == NULL) {
+        return FALSE;
+    }
+
+    /*
+     * The per-open type only ever transitions away from Undefined once,
+     * under the global lock; fall back to the locked path until the
+     * transition to Ioctl is visible here.
+     */
+    if (pOpen->type != NvKmsPerOpenTypeIoctl) {
+        return FALSE;
+    }
+
+    switch (cmd) {
+
+    case NVKMS_IOCTL_GET_NEXT_EVENT: {
+        struct NvKmsGetNextEventParams params = { };
+
+        if (paramSize != sizeof(params)) {
+            *pRet = FALSE;
+            return TRUE;
+        }
+
+        params.reply.valid = EventRingDequeue(pOpen, &params.reply.event);
+
+        if (pOpen->clientType == NVKMS_CLIENT_USER_SPACE) {
+            int status = nvkms_copyout(
+                paramsAddress +
+                offsetof(struct NvKmsGetNextEventParams, reply),
+                (char *)&params +
+                offsetof(struct NvKmsGetNextEventParams, reply),
+                sizeof(params.reply));
+
+            *pRet = (status == 0);
+        } else {
+            struct NvKmsGetNextEventParams *pKernelParams =
+                nvKmsNvU64ToPointer(paramsAddress);
+
+            pKernelParams->reply = params.reply;
+            *pRet = TRUE;
+        }
+
+        return TRUE;
+    }
+
+    case NVKMS_IOCTL_MOVE_CURSOR: {
+        struct NvKmsMoveCursorParams params = { };
+
+        if (paramSize != sizeof(params)) {
+            *pRet = FALSE;
+            return TRUE;
+        }
+
+        if (pOpen->clientType == NVKMS_CLIENT_USER_SPACE) {
+            if (nvkms_copyin((char *)&params, paramsAddress,
+                             sizeof(params)) != 0) {
+                *pRet = FALSE;
+                return TRUE;
+            }
+        } else {
+            const struct NvKmsMoveCursorParams *pKernelParams =
+                nvKmsNvU64ToPointer(paramsAddress);
+
+            params = *pKernelParams;
+        }
+
+        if (!MoveCursorLockless(pOpen, &params)) {
+            /* The fast path is not armed for this request. */
+            return FALSE;
+        }
+
+        /* NvKmsMoveCursorReply is empty; nothing to copy back out. */
+        *pRet = TRUE;
+        return TRUE;
+    }
+
+    default:
+        break;
+    }
+
+    return FALSE;
+}
+
+
 /*!
  * Close callback.
  *
@@ -5091,7 +5590,6 @@ void nvKmsClose(void *pOpenVoid)
 
     if (pOpen->type == NvKmsPerOpenTypeIoctl) {
 
-        struct NvKmsPerOpenEventListEntry *pEntry, *pEntryTmp;
         struct NvKmsPerOpenDev *pOpenDev;
         NvKmsGenericHandle dev;
 
@@ -5104,11 +5602,8 @@ void nvKmsClose(void *pOpenVoid)
 
         nvEvoDestroyApiHandles(&pOpen->ioctl.devHandles);
 
-        nvListForEachEntry_safe(pEntry, pEntryTmp,
-                                &pOpen->ioctl.eventList, eventListEntry) {
-            nvListDel(&pEntry->eventListEntry);
-            nvFree(pEntry);
-        }
+        nvFree(pOpen->ioctl.pEventRing);
+        pOpen->ioctl.pEventRing = NULL;
 
         nvListDel(&pOpen->perOpenIoctlListEntry);
     }
@@ -6055,16 +6550,31 @@ void nvKmsModuleUnload(void)
 static void SendEvent(struct NvKmsPerOpen *pOpen,
                       const struct NvKmsEvent *pEvent)
 {
-    struct NvKmsPerOpenEventListEntry *pEntry = nvAlloc(sizeof(*pEntry));
+    struct NvKmsPerOpenEventRing *pRing;
+    NvU32 put, get;
 
     nvAssert(pOpen->type == NvKmsPerOpenTypeIoctl);
 
-    if (pEntry == NULL) {
+    pRing = pOpen->ioctl.pEventRing;
+
+    /* The client has never declared event interest. */
+    if (pRing == NULL) {
+        return;
+    }
+
+    put = __atomic_load_n(&pRing->put, __ATOMIC_RELAXED);
+    get = __atomic_load_n(&pRing->get, __ATOMIC_ACQUIRE);
+
+    /*
+     * The client has stopped draining its queue; drop the event, like the
+     * allocation failure path of the old per-event list did.
+     */
+    if ((put - get) >= NVKMS_EVENT_RING_SIZE) {
         return;
     }
 
-    pEntry->event = *pEvent;
-    nvListAppend(&pEntry->eventListEntry, &pOpen->ioctl.eventList);
+    pRing->event[put % NVKMS_EVENT_RING_SIZE] = *pEvent;
+    __atomic_store_n(&pRing->put, put + 1, __ATOMIC_RELEASE);
 
     nvkms_event_queue_changed(pOpen->pOpenKernel, TRUE);
 }
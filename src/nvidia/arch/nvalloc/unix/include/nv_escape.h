@@ -51,5 +51,8 @@
 #define NV_ESC_RM_IMPORT_OBJECT_FROM_FD             0x5D
 #define NV_ESC_RM_UPDATE_DEVICE_MAPPING_INFO        0x5E
 #define NV_ESC_RM_LOCKLESS_DIAGNOSTIC               0x5F
+#define NV_ESC_RM_BATCH_ALLOC                       0x60
+#define NV_ESC_RM_BATCH_CONTROL                     0x61
+#define NV_ESC_RM_PERF_BENCHMARK                    0x62
 
 #endif // NV_ESCAPE_H_INCLUDED
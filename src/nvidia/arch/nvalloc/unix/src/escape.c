@@ -49,6 +49,11 @@
 #include "rmapi/client_resource.h"
 #include "nvlog/nvlog.h"
 #include <nv-ioctl-lockless-diag.h>
+#include <nv-priv.h>
+
+#include "gpu/mem_mgr/mem_mgr.h"
+#include "gpu/mem_mgr/heap.h"
+#include "ctrl/ctrl2080/ctrl2080gsp.h"
 
 #include <ctrl/ctrl00fd.h>
 
@@ -276,6 +281,143 @@ done:
         pApi->status = rmStatus;
 }
 
+//
+// In-kernel microbenchmarks for catching driver performance regressions
+// before rollout. Each benchmark runs a fixed number of iterations of one
+// hot kernel operation against the GPU the ioctl was issued on and reports
+// the elapsed wall time, so fleet tooling can compare successive builds
+// without parsing any text output.
+//
+static NV_STATUS RmRunPerfBenchmark(
+    nv_state_t *nv,
+    NVOS_PERF_BENCHMARK_PARAMETERS *pApi
+)
+{
+    THREAD_STATE_NODE threadState;
+    RM_API *pRmApi;
+    OBJGPU *pGpu;
+    NV_STATUS status = NV_OK;
+    NvU64 startNs = 0;
+    NvU64 endNs = 0;
+    NvU32 i;
+
+    pApi->totalNs = 0;
+    pApi->ops = 0;
+
+    if ((pApi->iterations == 0) ||
+        (pApi->iterations > NV_PERF_BENCHMARK_MAX_ITERATIONS))
+    {
+        return NV_ERR_INVALID_ARGUMENT;
+    }
+
+    //
+    // The NOP benchmark measures the ioctl entry and escape dispatch
+    // overhead itself: the caller times the full ioctl round trip from
+    // userspace, so there is nothing to do here.
+    //
+    if (pApi->benchmark == NV_PERF_BENCHMARK_NOP)
+        return NV_OK;
+
+    pRmApi = RmUnixRmApiPrologue(nv, &threadState, RM_LOCK_MODULES_DIAG);
+    if (pRmApi == NULL)
+        return NV_ERR_INVALID_STATE;
+
+    pGpu = NV_GET_NV_PRIV_PGPU(nv);
+    if (pGpu == NULL)
+    {
+        status = NV_ERR_INVALID_STATE;
+        goto done;
+    }
+
+    switch (pApi->benchmark)
+    {
+        case NV_PERF_BENCHMARK_MEMDESC_CREATE_DESTROY:
+        {
+            MEMORY_DESCRIPTOR *pMemDesc;
+
+            osGetCurrentTick(&startNs);
+            for (i = 0; i < pApi->iterations; i++)
+            {
+                status = memdescCreate(&pMemDesc, pGpu, 0x10000, 0, NV_TRUE,
+                                       ADDR_SYSMEM, NV_MEMORY_CACHED,
+                                       MEMDESC_FLAGS_NONE);
+                if (status != NV_OK)
+                    break;
+                memdescDestroy(pMemDesc);
+                pApi->ops++;
+            }
+            osGetCurrentTick(&endNs);
+            break;
+        }
+
+        case NV_PERF_BENCHMARK_PMA_ALLOC_FREE:
+        {
+            MemoryManager *pMemoryManager = GPU_GET_MEMORY_MANAGER(pGpu);
+            PMA *pPma;
+            PMA_ALLOCATION_OPTIONS allocOptions;
+            NvU64 page;
+
+            if ((pMemoryManager == NULL) ||
+                !memmgrIsPmaInitialized(pMemoryManager))
+            {
+                status = NV_ERR_NOT_SUPPORTED;
+                break;
+            }
+
+            pPma = &pMemoryManager->pHeap->pmaObject;
+
+            osGetCurrentTick(&startNs);
+            for (i = 0; i < pApi->iterations; i++)
+            {
+                portMemSet(&allocOptions, 0, sizeof(allocOptions));
+                allocOptions.flags = PMA_ALLOCATE_CONTIGUOUS;
+
+                status = pmaAllocatePages(pPma, 1, _PMA_64KB, &allocOptions,
+                                          &page);
+                if (status != NV_OK)
+                    break;
+                pmaFreePages(pPma, &page, 1, _PMA_64KB, 0);
+                pApi->ops++;
+            }
+            osGetCurrentTick(&endNs);
+            break;
+        }
+
+        case NV_PERF_BENCHMARK_CONTROL_ROUNDTRIP:
+        {
+            NV2080_CTRL_GSP_GET_FEATURES_PARAMS featuresParams;
+
+            osGetCurrentTick(&startNs);
+            for (i = 0; i < pApi->iterations; i++)
+            {
+                portMemSet(&featuresParams, 0, sizeof(featuresParams));
+
+                status = pRmApi->Control(pRmApi,
+                                         nv->rmapi.hClient,
+                                         nv->rmapi.hSubDevice,
+                                         NV2080_CTRL_CMD_GSP_GET_FEATURES,
+                                         &featuresParams,
+                                         sizeof(featuresParams));
+                if (status != NV_OK)
+                    break;
+                pApi->ops++;
+            }
+            osGetCurrentTick(&endNs);
+            break;
+        }
+
+        default:
+            status = NV_ERR_INVALID_ARGUMENT;
+            break;
+    }
+
+    pApi->totalNs = endNs - startNs;
+
+done:
+    RmUnixRmApiEpilogue(nv, &threadState);
+    return status;
+}
+
 ct_assert(NV_OFFSETOF(NVOS21_PARAMETERS, hRoot) == NV_OFFSETOF(NVOS64_PARAMETERS, hRoot));
 ct_assert(NV_OFFSETOF(NVOS21_PARAMETERS, hObjectParent) == NV_OFFSETOF(NVOS64_PARAMETERS, hObjectParent));
 ct_assert(NV_OFFSETOF(NVOS21_PARAMETERS, hObjectNew) == NV_OFFSETOF(NVOS64_PARAMETERS, hObjectNew));
@@ -421,6 +563,139 @@ NV_STATUS RmIoctl(
             break;
         }
 
+        case NV_ESC_RM_BATCH_ALLOC:
+        {
+            NVOS_BATCH_ALLOC_PARAMETERS *pApi = data;
+            NVOS_BATCH_ALLOC_ENTRY *pEntries;
+            NvLength entriesSize;
+            NvU32 i;
+
+            NV_CTL_DEVICE_ONLY(nv);
+
+            if (dataSize != sizeof(NVOS_BATCH_ALLOC_PARAMETERS))
+            {
+                rmStatus = NV_ERR_INVALID_ARGUMENT;
+                goto done;
+            }
+
+            if ((pApi->numEntries == 0) ||
+                (pApi->numEntries > NV_BATCH_ALLOC_MAX_ENTRIES))
+            {
+                pApi->status = NV_ERR_INVALID_ARGUMENT;
+                break;
+            }
+
+            entriesSize = sizeof(NVOS_BATCH_ALLOC_ENTRY) * pApi->numEntries;
+
+            pEntries = portMemAllocNonPaged(entriesSize);
+            if (pEntries == NULL)
+            {
+                pApi->status = NV_ERR_NO_MEMORY;
+                break;
+            }
+
+            if (portMemExCopyFromUser(pApi->pEntries, pEntries, entriesSize) != NV_OK)
+            {
+                portMemFree(pEntries);
+                pApi->status = NV_ERR_INVALID_POINTER;
+                break;
+            }
+
+            // Force userspace client allocations to be the _CLIENT class.
+            for (i = 0; i < pApi->numEntries; i++)
+            {
+                if ((pEntries[i].hClass == NV01_ROOT) ||
+                    (pEntries[i].hClass == NV01_ROOT_CLIENT) ||
+                    (pEntries[i].hClass == NV01_ROOT_NON_PRIV))
+                {
+                    pEntries[i].hClass = NV01_ROOT_CLIENT;
+                }
+            }
+
+            Nv04AllocBatchWithSecInfo(pApi, pEntries, secInfo);
+
+            if ((portMemExCopyToUser(pEntries, pApi->pEntries, entriesSize) != NV_OK) &&
+                (pApi->status == NV_OK))
+            {
+                pApi->status = NV_ERR_INVALID_POINTER;
+            }
+
+            portMemFree(pEntries);
+            break;
+        }
+
+        case NV_ESC_RM_BATCH_CONTROL:
+        {
+            NVOS_BATCH_CONTROL_PARAMETERS *pApi = data;
+            NVOS_BATCH_CONTROL_ENTRY *pEntries;
+            NvLength entriesSize;
+            NvBool bUnsupportedCmd = NV_FALSE;
+            NvU32 i;
+
+            NV_CTL_DEVICE_ONLY(nv);
+
+            if (dataSize != sizeof(NVOS_BATCH_CONTROL_PARAMETERS))
+            {
+                rmStatus = NV_ERR_INVALID_ARGUMENT;
+                goto done;
+            }
+
+            if ((pApi->numEntries == 0) ||
+                (pApi->numEntries > NV_BATCH_CONTROL_MAX_ENTRIES))
+            {
+                pApi->status = NV_ERR_INVALID_ARGUMENT;
+                break;
+            }
+
+            entriesSize = sizeof(NVOS_BATCH_CONTROL_ENTRY) * pApi->numEntries;
+
+            pEntries = portMemAllocNonPaged(entriesSize);
+            if (pEntries == NULL)
+            {
+                pApi->status = NV_ERR_NO_MEMORY;
+                break;
+            }
+
+            if (portMemExCopyFromUser(pApi->pEntries, pEntries, entriesSize) != NV_OK)
+            {
+                portMemFree(pEntries);
+                pApi->status = NV_ERR_INVALID_POINTER;
+                break;
+            }
+
+            //
+            // Controls that take a reference on a device fd (see
+            // RmGetDeviceFd) are not supported in a batch.
+            //
+            for (i = 0; i < pApi->numEntries; i++)
+            {
+                if ((pEntries[i].cmd == NV00FD_CTRL_CMD_ATTACH_GPU) ||
+                    (pEntries[i].cmd == NV00E0_CTRL_CMD_EXPORT_MEM))
+                {
+                    bUnsupportedCmd = NV_TRUE;
+                    break;
+                }
+            }
+
+            if (bUnsupportedCmd)
+            {
+                portMemFree(pEntries);
+                pApi->status = NV_ERR_NOT_SUPPORTED;
+                break;
+            }
+
+            Nv04ControlBatchWithSecInfo(pApi, pEntries, secInfo);
+
+            if ((portMemExCopyToUser(pEntries, pApi->pEntries, entriesSize) != NV_OK) &&
+                (pApi->status == NV_OK))
+            {
+                pApi->status = NV_ERR_INVALID_POINTER;
+            }
+
+            portMemFree(pEntries);
+            break;
+        }
+
         case NV_ESC_RM_FREE:
         {
             NVOS00_PARAMETERS *pApi = data;
@@ -874,6 +1149,28 @@ NV_STATUS RmIoctl(
             goto done;
         }
 
+        case NV_ESC_RM_PERF_BENCHMARK:
+        {
+            NVOS_PERF_BENCHMARK_PARAMETERS *pApi = data;
+
+            NV_ACTUAL_DEVICE_ONLY(nv);
+
+            if (dataSize != sizeof(NVOS_PERF_BENCHMARK_PARAMETERS))
+            {
+                rmStatus = NV_ERR_INVALID_ARGUMENT;
+                goto done;
+            }
+
+            if (!osIsAdministrator())
+            {
+                pApi->status = NV_ERR_INSUFFICIENT_PERMISSIONS;
+                break;
+            }
+
+            pApi->status = RmRunPerfBenchmark(nv, pApi);
+            break;
+        }
+
         case NV_ESC_REGISTER_FD:
         {
             nv_ioctl_register_fd_t *params = data;
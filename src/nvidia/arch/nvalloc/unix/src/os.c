@@ -731,7 +731,10 @@ NV_STATUS osQueueWorkItemWithFlags(
     pWi->pData = pParams;
     nv = NV_GET_NV_STATE(pGpu);
 
-    status = os_queue_work_item(nv ? nv->queue : NULL, pWi);
+    if (flags & OS_QUEUE_WORKITEM_FLAGS_UNORDERED)
+        status = os_queue_work_item_unordered(nv ? nv->queue : NULL, pWi);
+    else
+        status = os_queue_work_item(nv ? nv->queue : NULL, pWi);
 
     if (NV_OK != status)
     {
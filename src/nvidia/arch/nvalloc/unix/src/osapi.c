@@ -4931,6 +4931,100 @@ finish:
     NV_EXIT_RM_RUNTIME(sp,fp);
 }
 
+//
+// This function will be called by nv_procfs_read_gsp_rpc_stats().  It
+// formats the RPC latency profile reported by
+// NV2080_CTRL_CMD_GSP_GET_RPC_PROFILE as text: the latency histogram
+// followed by the per-RPC-type accumulators.
+//
+// On GPUs without GSP offload (or on any error), 'buf' is left empty and the
+// procfs file reads back empty.
+//
+void NV_API_CALL rm_get_gsp_rpc_stats(
+    nvidia_stack_t *sp,
+    nv_state_t *nv,
+    char *buf,
+    NvLength size
+)
+{
+    NV2080_CTRL_GSP_GET_RPC_PROFILE_PARAMS *pParams;
+    RM_API            *pRmApi;
+    THREAD_STATE_NODE  threadState;
+    NV_STATUS          rmStatus = NV_OK;
+    NvLength           used = 0;
+    NvU32              i;
+    void              *fp;
+
+    NV_ENTER_RM_RUNTIME(sp,fp);
+
+    buf[0] = '\0';
+
+    pParams = portMemAllocNonPaged(sizeof(*pParams));
+    if (pParams == NULL)
+        goto finish;
+    portMemSet(pParams, 0, sizeof(*pParams));
+
+    pRmApi = RmUnixRmApiPrologue(nv, &threadState, RM_LOCK_MODULES_GPU);
+    if (pRmApi != NULL)
+    {
+        rmStatus = pRmApi->Control(pRmApi,
+                                   nv->rmapi.hClient,
+                                   nv->rmapi.hSubDevice,
+                                   NV2080_CTRL_CMD_GSP_GET_RPC_PROFILE,
+                                   pParams,
+                                   sizeof(*pParams));
+
+        RmUnixRmApiEpilogue(nv, &threadState);
+    }
+    else
+    {
+        rmStatus = NV_ERR_INVALID_STATE;
+    }
+
+    if (rmStatus != NV_OK)
+    {
+        NV_PRINTF(LEVEL_INFO,
+                  "%s: Failed to query GSP RPC profile, status=0x%x\n",
+                  __FUNCTION__,
+                  rmStatus);
+        goto finish;
+    }
+
+    used += os_snprintf(buf + used, size - used,
+                        "RPC latency histogram (bucket i covers [2^i, 2^(i+1)) us):\n");
+    for (i = 0; (i < NV2080_CTRL_GSP_RPC_PROFILE_HIST_BUCKETS) && (used < size); i++)
+    {
+        if (pParams->histogram[i] == 0)
+            continue;
+
+        used += os_snprintf(buf + used, size - used,
+                            "  bucket %2u: %llu\n", i, pParams->histogram[i]);
+    }
+
+    if (used < size)
+    {
+        used += os_snprintf(buf + used, size - used,
+                            "\nfunction      count      total_us        max_us        avg_us\n");
+    }
+    for (i = 0; (i < pParams->numFunctions) && (used < size); i++)
+    {
+        const NV2080_CTRL_GSP_RPC_PROFILE_FUNC *pFunc = &pParams->functions[i];
+        NvU64 avgUs = (pFunc->count != 0) ? (pFunc->totalUs / pFunc->count) : 0;
+
+        used += os_snprintf(buf + used, size - used,
+                            "%8u %10llu %13llu %13u %13llu\n",
+                            pFunc->function, pFunc->count, pFunc->totalUs,
+                            pFunc->maxUs, avgUs);
+    }
+
+    // os_snprintf reports would-be lengths; make sure the result is terminated.
+    buf[size - 1] = '\0';
+
+finish:
+    portMemFree(pParams);
+    NV_EXIT_RM_RUNTIME(sp,fp);
+}
+
 //
 // disable GPU SW state persistence
 //
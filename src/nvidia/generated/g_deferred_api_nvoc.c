@@ -297,14 +297,29 @@ static const struct NVOC_EXPORTED_METHOD_DEF __nvoc_exported_method_def_Deferred
         /*pClassInfo=*/ &(__nvoc_class_def_DeferredApiObject.classInfo),
 #if NV_PRINTF_STRINGS_ALLOWED
         /*func=*/       "defapiCtrlCmdDeferredApiV2"
+#endif
+    },
+    {               /*  [3] */
+#if NVOC_EXPORTED_METHOD_DISABLED_BY_FLAG(0x400210u)
+        /*pFunc=*/      (void (*)(void)) NULL,
+#else
+        /*pFunc=*/      (void (*)(void)) defapiCtrlCmdDeferredApiAsync_IMPL,
+#endif // NVOC_EXPORTED_METHOD_DISABLED_BY_FLAG(0x400210u)
+        /*flags=*/      0x400210u,
+        /*accessRight=*/0x0u,
+        /*methodId=*/   0x50800104u,
+        /*paramSize=*/  sizeof(NV5080_CTRL_DEFERRED_API_ASYNC_PARAMS),
+        /*pClassInfo=*/ &(__nvoc_class_def_DeferredApiObject.classInfo),
+#if NV_PRINTF_STRINGS_ALLOWED
+        /*func=*/       "defapiCtrlCmdDeferredApiAsync"
 #endif
     },
 
 };
 
-const struct NVOC_EXPORT_INFO __nvoc_export_info_DeferredApiObject = 
+const struct NVOC_EXPORT_INFO __nvoc_export_info_DeferredApiObject =
 {
-    /*numEntries=*/     3,
+    /*numEntries=*/     4,
     /*pExportEntries=*/ __nvoc_exported_method_def_DeferredApiObject
 };
 
@@ -353,6 +368,10 @@ static void __nvoc_init_funcTable_DeferredApiObject_1(DeferredApiObject *pThis)
     pThis->__defapiCtrlCmdDeferredApiV2__ = &defapiCtrlCmdDeferredApiV2_IMPL;
 #endif
 
+#if !NVOC_EXPORTED_METHOD_DISABLED_BY_FLAG(0x400210u)
+    pThis->__defapiCtrlCmdDeferredApiAsync__ = &defapiCtrlCmdDeferredApiAsync_IMPL;
+#endif
+
 #if !NVOC_EXPORTED_METHOD_DISABLED_BY_FLAG(0x400210u)
     pThis->__defapiCtrlCmdRemoveApi__ = &defapiCtrlCmdRemoveApi_IMPL;
 #endif
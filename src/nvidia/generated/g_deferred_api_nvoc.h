@@ -42,6 +42,7 @@ extern "C" {
 #define DEFERRED_API_INFO_FLAGS_HAS_EXECUTED            0x00000001
 #define DEFERRED_API_INFO_FLAGS_HAS_TLB_FLUSHED         0x00000002
 #define DEFERRED_API_INFO_FLAGS_HAS_PRIVATE_DATA_ALLOC  0x00000004
+#define DEFERRED_API_INFO_FLAGS_ASYNC_PENDING           0x00000008
 
 typedef struct _def_deferred_api_info
 {
@@ -83,6 +84,7 @@ struct DeferredApiObject {
     NvBool (*__defapiIsSwMethodStalling__)(struct DeferredApiObject *, NvU32);
     NV_STATUS (*__defapiCtrlCmdDeferredApi__)(struct DeferredApiObject *, NV5080_CTRL_DEFERRED_API_PARAMS *);
     NV_STATUS (*__defapiCtrlCmdDeferredApiV2__)(struct DeferredApiObject *, NV5080_CTRL_DEFERRED_API_V2_PARAMS *);
+    NV_STATUS (*__defapiCtrlCmdDeferredApiAsync__)(struct DeferredApiObject *, NV5080_CTRL_DEFERRED_API_ASYNC_PARAMS *);
     NV_STATUS (*__defapiCtrlCmdRemoveApi__)(struct DeferredApiObject *, NV5080_CTRL_REMOVE_API_PARAMS *);
     NV_STATUS (*__defapiCheckMemInterUnmap__)(struct DeferredApiObject *, NvBool);
     NvBool (*__defapiShareCallback__)(struct DeferredApiObject *, struct RsClient *, struct RsResourceRef *, RS_SHARE_POLICY *);
@@ -116,6 +118,7 @@ struct DeferredApiObject {
     NV_STATUS (*__defapiGetOrAllocNotifShare__)(struct DeferredApiObject *, NvHandle, NvHandle, struct NotifShare **);
     PNODE DeferredApiList;
     NvU32 NumWaitingOnTLBFlush;
+    NvBool bAsyncWorkQueued;
 };
 
 #ifndef __NVOC_CLASS_DeferredApiObject_TYPEDEF__
@@ -150,6 +153,7 @@ NV_STATUS __nvoc_objCreate_DeferredApiObject(DeferredApiObject**, Dynamic*, NvU3
 #define defapiIsSwMethodStalling(pDeferredApi, hDeferredApi) defapiIsSwMethodStalling_DISPATCH(pDeferredApi, hDeferredApi)
 #define defapiCtrlCmdDeferredApi(pDeferredApiObj, pDeferredApi) defapiCtrlCmdDeferredApi_DISPATCH(pDeferredApiObj, pDeferredApi)
 #define defapiCtrlCmdDeferredApiV2(pDeferredApiObj, pDeferredApi) defapiCtrlCmdDeferredApiV2_DISPATCH(pDeferredApiObj, pDeferredApi)
+#define defapiCtrlCmdDeferredApiAsync(pDeferredApiObj, pDeferredApi) defapiCtrlCmdDeferredApiAsync_DISPATCH(pDeferredApiObj, pDeferredApi)
 #define defapiCtrlCmdRemoveApi(pDeferredApiObj, pRemoveApi) defapiCtrlCmdRemoveApi_DISPATCH(pDeferredApiObj, pRemoveApi)
 #define defapiCheckMemInterUnmap(pChannelDescendant, bSubdeviceHandleProvided) defapiCheckMemInterUnmap_DISPATCH(pChannelDescendant, bSubdeviceHandleProvided)
 #define defapiShareCallback(pGpuResource, pInvokingClient, pParentRef, pSharePolicy) defapiShareCallback_DISPATCH(pGpuResource, pInvokingClient, pParentRef, pSharePolicy)
@@ -205,6 +209,12 @@ static inline NV_STATUS defapiCtrlCmdDeferredApiV2_DISPATCH(struct DeferredApiOb
     return pDeferredApiObj->__defapiCtrlCmdDeferredApiV2__(pDeferredApiObj, pDeferredApi);
 }
 
+NV_STATUS defapiCtrlCmdDeferredApiAsync_IMPL(struct DeferredApiObject *pDeferredApiObj, NV5080_CTRL_DEFERRED_API_ASYNC_PARAMS *pDeferredApi);
+
+static inline NV_STATUS defapiCtrlCmdDeferredApiAsync_DISPATCH(struct DeferredApiObject *pDeferredApiObj, NV5080_CTRL_DEFERRED_API_ASYNC_PARAMS *pDeferredApi) {
+    return pDeferredApiObj->__defapiCtrlCmdDeferredApiAsync__(pDeferredApiObj, pDeferredApi);
+}
+
 NV_STATUS defapiCtrlCmdRemoveApi_IMPL(struct DeferredApiObject *pDeferredApiObj, NV5080_CTRL_REMOVE_API_PARAMS *pRemoveApi);
 
 static inline NV_STATUS defapiCtrlCmdRemoveApi_DISPATCH(struct DeferredApiObject *pDeferredApiObj, NV5080_CTRL_REMOVE_API_PARAMS *pRemoveApi) {
@@ -135,6 +135,9 @@ typedef struct
     GPUHWREG     *gpuFbAddr;
     GPUHWREG     *gpuInstAddr;
 
+    // Cached DEVICE_INDEX_GPU instance 0 mapping for the fast-path accessors
+    DEVICE_MAPPING *pGpuMapping;
+
     // Register access profiling
     NvU32         regReadCount;
     NvU32         regWriteCount;
@@ -182,6 +185,36 @@ void regRemoveRegisterFilter(RegisterAccess *, REGISTER_FILTER *);
 /*! Check status of read return value for GPU/bus errors */
 void regCheckAndLogReadFailure(RegisterAccess *, NvU32 addr, NvU32 mask, NvU32 value);
 
+/*! Fast-path 32 bit read of the common GPU (BAR0) aperture */
+NvU32 regRead032Fast(RegisterAccess *, NvU32, THREAD_STATE_NODE *);
+
+/*! Fast-path 32 bit write of the common GPU (BAR0) aperture */
+void regWrite032Fast(RegisterAccess *, NvU32, NvV32, THREAD_STATE_NODE *);
+
+//
+// Batched sequence of 32 bit accesses to the common GPU (BAR0) aperture. The
+// fast-path eligibility checks are evaluated once at regAccessBatchBegin
+// instead of once per access; each access falls back to the generic
+// filter-aware path when the fast path is unavailable. Accesses are still
+// issued to the device immediately: MMIO side effects are order-sensitive, so
+// writes are never deferred or coalesced.
+//
+typedef struct
+{
+    RegisterAccess    *pRegisterAccess;
+    DEVICE_MAPPING    *pMapping;     // non-NULL when the direct path may be used
+    THREAD_STATE_NODE *pThreadState;
+} REG_ACCESS_BATCH;
+
+/*! Begin a batched sequence of 32 bit accesses to the GPU aperture */
+void regAccessBatchBegin(RegisterAccess *, THREAD_STATE_NODE *, REG_ACCESS_BATCH *);
+
+/*! Batched 32 bit read */
+NvU32 regAccessBatchRead032(REG_ACCESS_BATCH *, NvU32);
+
+/*! Batched 32 bit write */
+void regAccessBatchWrite032(REG_ACCESS_BATCH *, NvU32, NvV32);
+
 //
 // GPU register I/O macros.
 //
@@ -255,6 +288,18 @@ void regCheckAndLogReadFailure(RegisterAccess *, NvU32 addr, NvU32 mask, NvU32 v
 #define GPU_REG_RD32_EX(g,a,t)    REG_INST_RD32_EX(g,GPU,0,a,t)
 #define GPU_REG_WR32_EX(g,a,v,t)  REG_INST_WR32_EX(g,GPU,0,a,v,t)
 
+//
+// Fast-path variants of the 32-bit GPU register accessors, specialized for
+// the common DEVICE_INDEX_GPU instance 0 (BAR0) aperture. They skip the SLI
+// loop, the device-mapping lookup and the register-filter walk when no filter
+// is installed, and fall back to the generic accessors otherwise. Intended
+// for interrupt service and other per-access-latency-sensitive paths.
+//
+#define GPU_REG_RD32_FAST(g,a,t)    regRead032Fast(GPU_GET_REGISTER_ACCESS(g), a, t)
+#define GPU_REG_WR32_FAST(g,a,v,t)  regWrite032Fast(GPU_GET_REGISTER_ACCESS(g), a, v, t)
+#define GPU_VREG_RD32_FAST(g,a,t)   regRead032Fast(GPU_GET_REGISTER_ACCESS(g), g->sriovState.virtualRegPhysOffset + a, t)
+#define GPU_VREG_WR32_FAST(g,a,v,t) regWrite032Fast(GPU_GET_REGISTER_ACCESS(g), g->sriovState.virtualRegPhysOffset + a, v, t)
+
 // Uncomment this to enable register access dump in gsp client
 // #define GPU_REGISTER_ACCESS_DUMP    RMCFG_FEATURE_GSP_CLIENT_RM
 #ifndef GPU_REGISTER_ACCESS_DUMP
@@ -82,6 +82,7 @@ typedef struct
 typedef struct
 {
     NvU8                             uuid[RM_SHA1_GID_SIZE];
+    NvU64                            uuidHash;
     PCI_PORT_INFO                    pciPortInfo;
     PCI_PORT_INFO                    upstreamPciPortInfo;
     GPU_COMPUTE_POLICY_INFO          policyInfo;
@@ -1261,6 +1261,9 @@ struct OBJGPU {
     NvU32 encSessionStatsReportingState;
     NvBool bNvEncSessionDataProcessingWorkItemPending;
     NVFBC_SESSION_LIST nvfbcSessionList;
+    NvU32 nvdecActiveContextCount[GPU_MAX_NVDECS];
+    NvU32 msencActiveContextCount[GPU_MAX_MSENCS];
+    NvU32 nvjpgActiveContextCount[GPU_MAX_NVJPGS];
     struct OBJVASPACE *pFabricVAS;
     NvBool bPipelinedPteMemEnabled;
     NvBool bIsBarPteInSysmemSupported;
@@ -3841,6 +3844,37 @@ static inline NvBool gpuIsEngDescSupported(struct OBJGPU *pGpu, NvU32 arg0) {
 #define gpuIsEngDescSupported(pGpu, arg0) gpuIsEngDescSupported_IMPL(pGpu, arg0)
 #endif //__nvoc_gpu_h_disabled
 
+NvU32 gpuGetLeastLoadedVideoEngineInstance_IMPL(struct OBJGPU *pGpu, NvU32 engClass);
+
+#ifdef __nvoc_gpu_h_disabled
+static inline NvU32 gpuGetLeastLoadedVideoEngineInstance(struct OBJGPU *pGpu, NvU32 engClass) {
+    NV_ASSERT_FAILED_PRECOMP("OBJGPU was disabled!");
+    return 0;
+}
+#else //__nvoc_gpu_h_disabled
+#define gpuGetLeastLoadedVideoEngineInstance(pGpu, engClass) gpuGetLeastLoadedVideoEngineInstance_IMPL(pGpu, engClass)
+#endif //__nvoc_gpu_h_disabled
+
+void gpuVideoEngineCtxAcquired_IMPL(struct OBJGPU *pGpu, ENGDESCRIPTOR engDesc);
+
+#ifdef __nvoc_gpu_h_disabled
+static inline void gpuVideoEngineCtxAcquired(struct OBJGPU *pGpu, ENGDESCRIPTOR engDesc) {
+    NV_ASSERT_FAILED_PRECOMP("OBJGPU was disabled!");
+}
+#else //__nvoc_gpu_h_disabled
+#define gpuVideoEngineCtxAcquired(pGpu, engDesc) gpuVideoEngineCtxAcquired_IMPL(pGpu, engDesc)
+#endif //__nvoc_gpu_h_disabled
+
+void gpuVideoEngineCtxReleased_IMPL(struct OBJGPU *pGpu, ENGDESCRIPTOR engDesc);
+
+#ifdef __nvoc_gpu_h_disabled
+static inline void gpuVideoEngineCtxReleased(struct OBJGPU *pGpu, ENGDESCRIPTOR engDesc) {
+    NV_ASSERT_FAILED_PRECOMP("OBJGPU was disabled!");
+}
+#else //__nvoc_gpu_h_disabled
+#define gpuVideoEngineCtxReleased(pGpu, engDesc) gpuVideoEngineCtxReleased_IMPL(pGpu, engDesc)
+#endif //__nvoc_gpu_h_disabled
+
 NV_STATUS gpuReadBusConfigCycle_IMPL(struct OBJGPU *pGpu, NvU32 index, NvU32 *pData);
 
 #ifdef __nvoc_gpu_h_disabled
@@ -216,14 +216,29 @@ static const struct NVOC_EXPORTED_METHOD_DEF __nvoc_exported_method_def_GpuUserS
         /*pClassInfo=*/ &(__nvoc_class_def_GpuUserSharedData.classInfo),
 #if NV_PRINTF_STRINGS_ALLOWED
         /*func=*/       "gpushareddataCtrlCmdRequestDataPoll"
+#endif
+    },
+    {               /*  [1] */
+#if NVOC_EXPORTED_METHOD_DISABLED_BY_FLAG(0x10u)
+        /*pFunc=*/      (void (*)(void)) NULL,
+#else
+        /*pFunc=*/      (void (*)(void)) gpushareddataCtrlCmdResetMemoryWatermarks_IMPL,
+#endif // NVOC_EXPORTED_METHOD_DISABLED_BY_FLAG(0x10u)
+        /*flags=*/      0x10u,
+        /*accessRight=*/0x0u,
+        /*methodId=*/   0xde0002u,
+        /*paramSize=*/  sizeof(NV00DE_CTRL_RESET_MEMORY_WATERMARKS_PARAMS),
+        /*pClassInfo=*/ &(__nvoc_class_def_GpuUserSharedData.classInfo),
+#if NV_PRINTF_STRINGS_ALLOWED
+        /*func=*/       "gpushareddataCtrlCmdResetMemoryWatermarks"
 #endif
     },
 
 };
 
-const struct NVOC_EXPORT_INFO __nvoc_export_info_GpuUserSharedData = 
+const struct NVOC_EXPORT_INFO __nvoc_export_info_GpuUserSharedData =
 {
-    /*numEntries=*/     1,
+    /*numEntries=*/     2,
     /*pExportEntries=*/ __nvoc_exported_method_def_GpuUserSharedData
 };
 
@@ -266,6 +281,10 @@ static void __nvoc_init_funcTable_GpuUserSharedData_1(GpuUserSharedData *pThis)
     pThis->__gpushareddataCtrlCmdRequestDataPoll__ = &gpushareddataCtrlCmdRequestDataPoll_IMPL;
 #endif
 
+#if !NVOC_EXPORTED_METHOD_DISABLED_BY_FLAG(0x10u)
+    pThis->__gpushareddataCtrlCmdResetMemoryWatermarks__ = &gpushareddataCtrlCmdResetMemoryWatermarks_IMPL;
+#endif
+
     pThis->__nvoc_base_Memory.__nvoc_base_RmResource.__nvoc_base_RsResource.__resCanCopy__ = &__nvoc_thunk_GpuUserSharedData_resCanCopy;
 
     pThis->__gpushareddataCheckMemInterUnmap__ = &__nvoc_thunk_Memory_gpushareddataCheckMemInterUnmap;
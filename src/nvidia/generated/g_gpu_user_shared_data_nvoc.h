@@ -68,6 +68,7 @@ struct GpuUserSharedData {
     struct GpuUserSharedData *__nvoc_pbase_GpuUserSharedData;
     NvBool (*__gpushareddataCanCopy__)(struct GpuUserSharedData *);
     NV_STATUS (*__gpushareddataCtrlCmdRequestDataPoll__)(struct GpuUserSharedData *, NV00DE_CTRL_REQUEST_DATA_POLL_PARAMS *);
+    NV_STATUS (*__gpushareddataCtrlCmdResetMemoryWatermarks__)(struct GpuUserSharedData *, NV00DE_CTRL_RESET_MEMORY_WATERMARKS_PARAMS *);
     NV_STATUS (*__gpushareddataCheckMemInterUnmap__)(struct GpuUserSharedData *, NvBool);
     NvBool (*__gpushareddataShareCallback__)(struct GpuUserSharedData *, struct RsClient *, struct RsResourceRef *, RS_SHARE_POLICY *);
     NV_STATUS (*__gpushareddataMapTo__)(struct GpuUserSharedData *, RS_RES_MAP_TO_PARAMS *);
@@ -126,6 +127,7 @@ NV_STATUS __nvoc_objCreate_GpuUserSharedData(GpuUserSharedData**, Dynamic*, NvU3
 
 #define gpushareddataCanCopy(pData) gpushareddataCanCopy_DISPATCH(pData)
 #define gpushareddataCtrlCmdRequestDataPoll(pData, pParams) gpushareddataCtrlCmdRequestDataPoll_DISPATCH(pData, pParams)
+#define gpushareddataCtrlCmdResetMemoryWatermarks(pData, pParams) gpushareddataCtrlCmdResetMemoryWatermarks_DISPATCH(pData, pParams)
 #define gpushareddataCheckMemInterUnmap(pMemory, bSubdeviceHandleProvided) gpushareddataCheckMemInterUnmap_DISPATCH(pMemory, bSubdeviceHandleProvided)
 #define gpushareddataShareCallback(pResource, pInvokingClient, pParentRef, pSharePolicy) gpushareddataShareCallback_DISPATCH(pResource, pInvokingClient, pParentRef, pSharePolicy)
 #define gpushareddataMapTo(pResource, pParams) gpushareddataMapTo_DISPATCH(pResource, pParams)
@@ -163,6 +165,12 @@ static inline NV_STATUS gpushareddataCtrlCmdRequestDataPoll_DISPATCH(struct GpuU
     return pData->__gpushareddataCtrlCmdRequestDataPoll__(pData, pParams);
 }
 
+NV_STATUS gpushareddataCtrlCmdResetMemoryWatermarks_IMPL(struct GpuUserSharedData *pData, NV00DE_CTRL_RESET_MEMORY_WATERMARKS_PARAMS *pParams);
+
+static inline NV_STATUS gpushareddataCtrlCmdResetMemoryWatermarks_DISPATCH(struct GpuUserSharedData *pData, NV00DE_CTRL_RESET_MEMORY_WATERMARKS_PARAMS *pParams) {
+    return pData->__gpushareddataCtrlCmdResetMemoryWatermarks__(pData, pParams);
+}
+
 static inline NV_STATUS gpushareddataCheckMemInterUnmap_DISPATCH(struct GpuUserSharedData *pMemory, NvBool bSubdeviceHandleProvided) {
     return pMemory->__gpushareddataCheckMemInterUnmap__(pMemory, bSubdeviceHandleProvided);
 }
@@ -593,6 +593,26 @@ static inline void gvaspaceWalkUserCtxAcquire(struct OBJGVASPACE *pGVAS, struct
 #define gvaspaceWalkUserCtxAcquire(pGVAS, pGpu, pVASBlock, pUserCtx) gvaspaceWalkUserCtxAcquire_IMPL(pGVAS, pGpu, pVASBlock, pUserCtx)
 #endif //__nvoc_gpu_vaspace_h_disabled
 
+void gvaspaceWalkBatchBegin_IMPL(struct OBJGVASPACE *pGVAS, struct OBJGPU *pGpu);
+
+#ifdef __nvoc_gpu_vaspace_h_disabled
+static inline void gvaspaceWalkBatchBegin(struct OBJGVASPACE *pGVAS, struct OBJGPU *pGpu) {
+    NV_ASSERT_FAILED_PRECOMP("OBJGVASPACE was disabled!");
+}
+#else //__nvoc_gpu_vaspace_h_disabled
+#define gvaspaceWalkBatchBegin(pGVAS, pGpu) gvaspaceWalkBatchBegin_IMPL(pGVAS, pGpu)
+#endif //__nvoc_gpu_vaspace_h_disabled
+
+void gvaspaceWalkBatchEnd_IMPL(struct OBJGVASPACE *pGVAS, struct OBJGPU *pGpu, VAS_PTE_UPDATE_TYPE update_type);
+
+#ifdef __nvoc_gpu_vaspace_h_disabled
+static inline void gvaspaceWalkBatchEnd(struct OBJGVASPACE *pGVAS, struct OBJGPU *pGpu, VAS_PTE_UPDATE_TYPE update_type) {
+    NV_ASSERT_FAILED_PRECOMP("OBJGVASPACE was disabled!");
+}
+#else //__nvoc_gpu_vaspace_h_disabled
+#define gvaspaceWalkBatchEnd(pGVAS, pGpu, update_type) gvaspaceWalkBatchEnd_IMPL(pGVAS, pGpu, update_type)
+#endif //__nvoc_gpu_vaspace_h_disabled
+
 void gvaspaceWalkUserCtxRelease_IMPL(struct OBJGVASPACE *pGVAS, struct MMU_WALK_USER_CTX *pUserCtx);
 
 #ifdef __nvoc_gpu_vaspace_h_disabled
@@ -236,6 +236,13 @@ struct MEM_BLOCK
     MEM_BLOCK *nextFreeNoncontig;
     MEM_BLOCK *prevFreeNoncontig;
     MEM_BLOCK *noncontigAllocListNext;
+
+    // hooks into the size-indexed view of the contiguous freelist; sizeNode
+    // is only linked into the tree while this block heads its size class
+    NODE sizeNode;
+    MEM_BLOCK *pPrevFreeSize;
+    MEM_BLOCK *pNextFreeSize;
+    NvBool bFreeSizeIndexed;
 };
 
 typedef struct TEX_INFO
@@ -300,6 +307,7 @@ struct Heap {
     struct MEM_BLOCK *pBlockList;
     struct MEM_BLOCK *pFreeBlockList;
     NODE *pBlockTree;
+    NODE *pFreeSizeTree;
     NvHandle memHandle;
     NvU32 numBlocks;
     TEX_INFO textureData[4];
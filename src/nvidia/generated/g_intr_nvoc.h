@@ -322,6 +322,7 @@ struct Intr {
     IntrServiceRecord intrServiceTable[171];
     InterruptEntry *(vectorToMcIdx[1]);
     NvLength vectorToMcIdxCounts[1];
+    NvU64 *(vectorIntrCount[1]);
     NvBool bDefaultNonstallNotify;
     NvBool bUseLegacyVectorAssignment;
     NV2080_INTR_CATEGORY_SUBTREE_MAP subtreeMap[7];
@@ -1714,6 +1715,17 @@ static inline NV_STATUS intrSetInterruptEntry(struct Intr *pIntr, INTR_TREE tree
 #define intrSetInterruptEntry(pIntr, tree, vector, pEntry) intrSetInterruptEntry_IMPL(pIntr, tree, vector, pEntry)
 #endif //__nvoc_intr_h_disabled
 
+NV_STATUS intrBuildVectorToMcIdxTable_IMPL(OBJGPU *pGpu, struct Intr *pIntr);
+
+#ifdef __nvoc_intr_h_disabled
+static inline NV_STATUS intrBuildVectorToMcIdxTable(OBJGPU *pGpu, struct Intr *pIntr) {
+    NV_ASSERT_FAILED_PRECOMP("Intr was disabled!");
+    return NV_ERR_NOT_SUPPORTED;
+}
+#else //__nvoc_intr_h_disabled
+#define intrBuildVectorToMcIdxTable(pGpu, pIntr) intrBuildVectorToMcIdxTable_IMPL(pGpu, pIntr)
+#endif //__nvoc_intr_h_disabled
+
 void intrServiceStallListAllGpusCond_IMPL(OBJGPU *pGpu, struct Intr *pIntr, union MC_ENGINE_BITVECTOR *arg0, NvBool arg1);
 
 #ifdef __nvoc_intr_h_disabled
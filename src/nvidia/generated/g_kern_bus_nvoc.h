@@ -172,6 +172,11 @@ typedef struct
     NvU32               refCount;
     NvU32               remotePeerId;
     NvBool              bReserved;
+    //
+    // The last reference was dropped but the mailbox/HSHUB configuration is
+    // kept warm so that the next mapping to the same GPU pair can reuse it.
+    //
+    NvBool              bCached;
     PMEMORY_DESCRIPTOR  pRemoteP2PDomMemDesc;
     PMEMORY_DESCRIPTOR  pRemoteWMBoxMemDesc;
 } KBUS_PCIE_PEER;
@@ -2639,6 +2644,26 @@ static inline void kbusDestroyMailbox(struct OBJGPU *pGpu0, struct KernelBus *pK
 #define kbusDestroyMailbox(pGpu0, pKernelBus0, pGpu1, peerIdx) kbusDestroyMailbox_IMPL(pGpu0, pKernelBus0, pGpu1, peerIdx)
 #endif //__nvoc_kern_bus_h_disabled
 
+void kbusEvictCachedPciePeerMapping_IMPL(struct OBJGPU *pGpu, struct KernelBus *pKernelBus, NvU32 peerId);
+
+#ifdef __nvoc_kern_bus_h_disabled
+static inline void kbusEvictCachedPciePeerMapping(struct OBJGPU *pGpu, struct KernelBus *pKernelBus, NvU32 peerId) {
+    NV_ASSERT_FAILED_PRECOMP("KernelBus was disabled!");
+}
+#else //__nvoc_kern_bus_h_disabled
+#define kbusEvictCachedPciePeerMapping(pGpu, pKernelBus, peerId) kbusEvictCachedPciePeerMapping_IMPL(pGpu, pKernelBus, peerId)
+#endif //__nvoc_kern_bus_h_disabled
+
+void kbusFlushCachedPciePeerMappings_IMPL(struct OBJGPU *pGpu, struct KernelBus *pKernelBus);
+
+#ifdef __nvoc_kern_bus_h_disabled
+static inline void kbusFlushCachedPciePeerMappings(struct OBJGPU *pGpu, struct KernelBus *pKernelBus) {
+    NV_ASSERT_FAILED_PRECOMP("KernelBus was disabled!");
+}
+#else //__nvoc_kern_bus_h_disabled
+#define kbusFlushCachedPciePeerMappings(pGpu, pKernelBus) kbusFlushCachedPciePeerMappings_IMPL(pGpu, pKernelBus)
+#endif //__nvoc_kern_bus_h_disabled
+
 RmPhysAddr kbusSetupPeerBarAccess_IMPL(struct OBJGPU *pGpu0, struct OBJGPU *pGpu1, RmPhysAddr arg0, NvU64 arg1, PMEMORY_DESCRIPTOR *arg2);
 
 #define kbusSetupPeerBarAccess(pGpu0, pGpu1, arg0, arg1, arg2) kbusSetupPeerBarAccess_IMPL(pGpu0, pGpu1, arg0, arg1, arg2)
@@ -151,6 +151,8 @@ struct KernelCE {
     NvU32 publicID;
     NvBool bShimOwner;
     NvBool bStubbed;
+    NvU32 activeContextCount;
+    NvU32 totalContextCount;
     NvU32 nvlinkPeerMask;
     NvU32 nvlinkNumPeers;
     NvBool bIsAutoConfigEnabled;
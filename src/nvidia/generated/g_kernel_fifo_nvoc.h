@@ -204,8 +204,44 @@ typedef struct _fifo_hw_id
      * Number of elements in pHwIdInUse
      */
     NvU32 hwIdInUseSz;
+
+    /*!
+     * Number of IDs currently reserved through alloc/free.
+     * Does not include the padding bits set at init time.
+     */
+    NvU32 hwIdInUseCount;
+
+    /*!
+     * Index of the lowest element of pHwIdInUse that may still contain a
+     * free bit. Elements below it are known to be fully reserved, so
+     * allocation scans can skip them.
+     */
+    NvU32 hwIdLowestFreeElem;
 } FIFO_HW_ID;
 
+/*!
+ * Maximum number of recycled instance blocks kept per GPU.
+ * @see kfifoInstMemCachePut
+ */
+#define KFIFO_INST_MEM_CACHE_WATERMARK 16
+
+/*!
+ * LIFO cache of instance block allocations recycled from torn-down
+ * channels for reuse by the next channel construction, so heavy channel
+ * churn does not pay a fresh instance memory allocation on every create.
+ * Only plain allocations are cached; protected or ctx buf pool backed
+ * instance blocks are freed immediately.
+ */
+typedef struct _fifo_inst_mem_cache
+{
+    MEMORY_DESCRIPTOR *ppMemDesc[KFIFO_INST_MEM_CACHE_WATERMARK];
+
+    /*!
+     * Number of entries currently held in ppMemDesc.
+     */
+    NvU32 count;
+} FIFO_INST_MEM_CACHE;
+
 DECLARE_INTRUSIVE_MAP(KernelChannelGroupMap);
 
 typedef struct _chid_mgr
@@ -470,6 +506,7 @@ struct KernelFifo {
     MEMORY_DESCRIPTOR *pRegVF;
     CTX_BUF_POOL_INFO *pRunlistBufPool[64];
     MEMORY_DESCRIPTOR ***pppRunlistBufMemDesc;
+    FIFO_INST_MEM_CACHE instMemCache;
 };
 
 #ifndef __NVOC_CLASS_KernelFifo_TYPEDEF__
@@ -1982,6 +2019,38 @@ static inline CTX_BUF_POOL_INFO *kfifoGetRunlistBufPool(struct OBJGPU *pGpu, str
 #define kfifoGetRunlistBufPool(pGpu, pKernelFifo, rmEngineType) kfifoGetRunlistBufPool_IMPL(pGpu, pKernelFifo, rmEngineType)
 #endif //__nvoc_kernel_fifo_h_disabled
 
+MEMORY_DESCRIPTOR *kfifoInstMemCacheGet_IMPL(struct OBJGPU *pGpu, struct KernelFifo *pKernelFifo, NvU64 size, NvU32 cpuCacheAttrib);
+
+#ifdef __nvoc_kernel_fifo_h_disabled
+static inline MEMORY_DESCRIPTOR *kfifoInstMemCacheGet(struct OBJGPU *pGpu, struct KernelFifo *pKernelFifo, NvU64 size, NvU32 cpuCacheAttrib) {
+    NV_ASSERT_FAILED_PRECOMP("KernelFifo was disabled!");
+    return NULL;
+}
+#else //__nvoc_kernel_fifo_h_disabled
+#define kfifoInstMemCacheGet(pGpu, pKernelFifo, size, cpuCacheAttrib) kfifoInstMemCacheGet_IMPL(pGpu, pKernelFifo, size, cpuCacheAttrib)
+#endif //__nvoc_kernel_fifo_h_disabled
+
+NvBool kfifoInstMemCachePut_IMPL(struct OBJGPU *pGpu, struct KernelFifo *pKernelFifo, MEMORY_DESCRIPTOR *pMemDesc);
+
+#ifdef __nvoc_kernel_fifo_h_disabled
+static inline NvBool kfifoInstMemCachePut(struct OBJGPU *pGpu, struct KernelFifo *pKernelFifo, MEMORY_DESCRIPTOR *pMemDesc) {
+    NV_ASSERT_FAILED_PRECOMP("KernelFifo was disabled!");
+    return NV_FALSE;
+}
+#else //__nvoc_kernel_fifo_h_disabled
+#define kfifoInstMemCachePut(pGpu, pKernelFifo, pMemDesc) kfifoInstMemCachePut_IMPL(pGpu, pKernelFifo, pMemDesc)
+#endif //__nvoc_kernel_fifo_h_disabled
+
+void kfifoInstMemCacheTrim_IMPL(struct OBJGPU *pGpu, struct KernelFifo *pKernelFifo, NvU32 watermark);
+
+#ifdef __nvoc_kernel_fifo_h_disabled
+static inline void kfifoInstMemCacheTrim(struct OBJGPU *pGpu, struct KernelFifo *pKernelFifo, NvU32 watermark) {
+    NV_ASSERT_FAILED_PRECOMP("KernelFifo was disabled!");
+}
+#else //__nvoc_kernel_fifo_h_disabled
+#define kfifoInstMemCacheTrim(pGpu, pKernelFifo, watermark) kfifoInstMemCacheTrim_IMPL(pGpu, pKernelFifo, watermark)
+#endif //__nvoc_kernel_fifo_h_disabled
+
 NV_STATUS kfifoGetRunlistBufInfo_IMPL(struct OBJGPU *pGpu, struct KernelFifo *pKernelFifo, NvU32 arg0, NvBool arg1, NvU32 arg2, NvU64 *arg3, NvU64 *arg4);
 
 #ifdef __nvoc_kernel_fifo_h_disabled
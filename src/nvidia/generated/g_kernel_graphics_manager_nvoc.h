@@ -98,6 +98,8 @@ struct KernelGraphicsManager {
     KGRMGR_FECS_GLOBAL_TRACE_INFO *PRIVATE_FIELD(pFecsGlobalTraceInfo);
     KGRMGR_FECS_VGPU_GLOBAL_TRACE_INFO *PRIVATE_FIELD(pFecsVgpuGlobalTraceInfo);
     CTX_BUF_INFO PRIVATE_FIELD(globalCtxBufInfo)[10];
+    NvBool PRIVATE_FIELD(bMainCtxBufferCacheEnabled);
+    MEMORY_DESCRIPTOR *PRIVATE_FIELD(mainCtxBufferCache)[4];
 };
 
 struct KernelGraphicsManager_PRIVATE {
@@ -127,6 +129,8 @@ struct KernelGraphicsManager_PRIVATE {
     KGRMGR_FECS_GLOBAL_TRACE_INFO *pFecsGlobalTraceInfo;
     KGRMGR_FECS_VGPU_GLOBAL_TRACE_INFO *pFecsVgpuGlobalTraceInfo;
     CTX_BUF_INFO globalCtxBufInfo[10];
+    NvBool bMainCtxBufferCacheEnabled;
+    MEMORY_DESCRIPTOR *mainCtxBufferCache[4];
 };
 
 #ifndef __NVOC_CLASS_KernelGraphicsManager_TYPEDEF__
@@ -458,6 +462,38 @@ static inline void kgrmgrSetGlobalCtxBufInfo(OBJGPU *arg0, struct KernelGraphics
 #define kgrmgrSetGlobalCtxBufInfo(arg0, arg1, arg2, size, align, attr, bContiguous) kgrmgrSetGlobalCtxBufInfo_IMPL(arg0, arg1, arg2, size, align, attr, bContiguous)
 #endif //__nvoc_kernel_graphics_manager_h_disabled
 
+MEMORY_DESCRIPTOR *kgrmgrGetCachedMainCtxBuffer_IMPL(OBJGPU *arg0, struct KernelGraphicsManager *arg1, NvU64 size);
+
+#ifdef __nvoc_kernel_graphics_manager_h_disabled
+static inline MEMORY_DESCRIPTOR *kgrmgrGetCachedMainCtxBuffer(OBJGPU *arg0, struct KernelGraphicsManager *arg1, NvU64 size) {
+    NV_ASSERT_FAILED_PRECOMP("KernelGraphicsManager was disabled!");
+    return NULL;
+}
+#else //__nvoc_kernel_graphics_manager_h_disabled
+#define kgrmgrGetCachedMainCtxBuffer(arg0, arg1, size) kgrmgrGetCachedMainCtxBuffer_IMPL(arg0, arg1, size)
+#endif //__nvoc_kernel_graphics_manager_h_disabled
+
+NvBool kgrmgrCacheMainCtxBuffer_IMPL(OBJGPU *arg0, struct KernelGraphicsManager *arg1, MEMORY_DESCRIPTOR *pMemDesc);
+
+#ifdef __nvoc_kernel_graphics_manager_h_disabled
+static inline NvBool kgrmgrCacheMainCtxBuffer(OBJGPU *arg0, struct KernelGraphicsManager *arg1, MEMORY_DESCRIPTOR *pMemDesc) {
+    NV_ASSERT_FAILED_PRECOMP("KernelGraphicsManager was disabled!");
+    return NV_FALSE;
+}
+#else //__nvoc_kernel_graphics_manager_h_disabled
+#define kgrmgrCacheMainCtxBuffer(arg0, arg1, pMemDesc) kgrmgrCacheMainCtxBuffer_IMPL(arg0, arg1, pMemDesc)
+#endif //__nvoc_kernel_graphics_manager_h_disabled
+
+void kgrmgrFreeMainCtxBufferCache_IMPL(OBJGPU *arg0, struct KernelGraphicsManager *arg1);
+
+#ifdef __nvoc_kernel_graphics_manager_h_disabled
+static inline void kgrmgrFreeMainCtxBufferCache(OBJGPU *arg0, struct KernelGraphicsManager *arg1) {
+    NV_ASSERT_FAILED_PRECOMP("KernelGraphicsManager was disabled!");
+}
+#else //__nvoc_kernel_graphics_manager_h_disabled
+#define kgrmgrFreeMainCtxBufferCache(arg0, arg1) kgrmgrFreeMainCtxBufferCache_IMPL(arg0, arg1)
+#endif //__nvoc_kernel_graphics_manager_h_disabled
+
 NV_STATUS kgrmgrDiscoverMaxGlobalCtxBufSizes_IMPL(OBJGPU *arg0, struct KernelGraphicsManager *arg1, struct KernelGraphics *arg2, NvBool bMemoryPartitioningNeeded);
 
 #ifdef __nvoc_kernel_graphics_manager_h_disabled
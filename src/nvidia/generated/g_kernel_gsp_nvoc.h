@@ -172,6 +172,54 @@ typedef enum KernelGspRpcEventHandlerContext
     KGSP_RPC_EVENT_HANDLER_CONTEXT_INTERRUPT // called in bottom-half interrupt path
 } KernelGspRpcEventHandlerContext;
 
+/*!
+ * Deferred GSP RPC submission (see kgspQueueAsyncRpc).
+ *
+ * The issue function performs the actual RPC exchange; it runs from a work
+ * item with the API and GPU locks held, off the submitting thread's critical
+ * path.  The optional completion callback is invoked afterwards with the
+ * issue function's status.
+ */
+typedef NV_STATUS KernelGspAsyncRpcIssueFunc(struct OBJGPU *pGpu, void *pRpcData);
+typedef void KernelGspAsyncRpcCallback(struct OBJGPU *pGpu, void *pRpcData, NV_STATUS status);
+
+/*!
+ * Always-on RPC latency accounting.
+ *
+ * Every completed RPC is recorded in a trace ring and folded into a latency
+ * histogram plus per-function accumulators.  Updates are a handful of stores
+ * on the RPC completion path (no locks, no allocation), so the accounting is
+ * cheap enough to stay enabled in production; readers take unsynchronized
+ * snapshots via NV2080_CTRL_CMD_GSP_GET_RPC_PROFILE.
+ */
+#define KGSP_RPC_PROF_RING_DEPTH    256
+#define KGSP_RPC_PROF_HIST_BUCKETS  24
+#define KGSP_RPC_PROF_FUNC_SLOTS    64
+
+typedef struct KernelGspRpcProfEntry
+{
+    NvU32 function;
+    NvU32 durationUs;
+    NvU64 ts_start;
+} KernelGspRpcProfEntry;
+
+typedef struct KernelGspRpcProfFunc
+{
+    NvU32 function;
+    NvU32 maxUs;
+    NvU64 count;
+    NvU64 totalUs;
+} KernelGspRpcProfFunc;
+
+typedef struct KernelGspRpcProfile
+{
+    KernelGspRpcProfEntry ring[KGSP_RPC_PROF_RING_DEPTH];
+    NvU32 ringNext;                                 // Monotonic; slot is ringNext % depth.
+    NvU64 histogram[KGSP_RPC_PROF_HIST_BUCKETS];    // Bucket i: [2^i, 2^(i+1)) us.
+    KernelGspRpcProfFunc funcs[KGSP_RPC_PROF_FUNC_SLOTS];
+    NvU32 numFuncs;
+} KernelGspRpcProfile;
+
 /*!
  * Tagged union of falcon ucode variants used by early FRTS and GSP-RM boot.
  */
@@ -399,6 +447,7 @@ struct KernelGsp {
     struct MESSAGE_QUEUE_COLLECTION *pMQCollection;
     struct OBJRPC *pRpc;
     struct OBJRPC *pLocklessRpc;
+    KernelGspRpcProfile rpcProfile;
     char vbiosVersionStr[16];
     KernelGspFlcnUcode *pFwsecUcode;
     KernelGspFlcnUcode *pScrubberUcode;
@@ -441,6 +490,7 @@ struct KernelGsp {
     NvBool bInLockdown;
     NvBool bPollingForRpcResponse;
     NvBool bFatalError;
+    volatile NvU32 haltHealthCheckPending;
     MEMORY_DESCRIPTOR *pMemDesc_simAccessBuf;
     SimAccessBuffer *pSimAccessBuf;
     NvP64 pSimAccessBufPriv;
@@ -1381,6 +1431,28 @@ static inline NV_STATUS kgspInitRm(struct OBJGPU *pGpu, struct KernelGsp *pKerne
 #define kgspInitRm(pGpu, pKernelGsp, pGspFw) kgspInitRm_IMPL(pGpu, pKernelGsp, pGspFw)
 #endif //__nvoc_kernel_gsp_h_disabled
 
+NV_STATUS kgspQueueAsyncRpc_IMPL(struct OBJGPU *pGpu, struct KernelGsp *pKernelGsp, KernelGspAsyncRpcIssueFunc *pfnIssue, KernelGspAsyncRpcCallback *pfnCallback, void *pRpcData);
+
+#ifdef __nvoc_kernel_gsp_h_disabled
+static inline NV_STATUS kgspQueueAsyncRpc(struct OBJGPU *pGpu, struct KernelGsp *pKernelGsp, KernelGspAsyncRpcIssueFunc *pfnIssue, KernelGspAsyncRpcCallback *pfnCallback, void *pRpcData) {
+    NV_ASSERT_FAILED_PRECOMP("KernelGsp was disabled!");
+    return NV_ERR_NOT_SUPPORTED;
+}
+#else //__nvoc_kernel_gsp_h_disabled
+#define kgspQueueAsyncRpc(pGpu, pKernelGsp, pfnIssue, pfnCallback, pRpcData) kgspQueueAsyncRpc_IMPL(pGpu, pKernelGsp, pfnIssue, pfnCallback, pRpcData)
+#endif //__nvoc_kernel_gsp_h_disabled
+
+struct OBJRPC *kgspGetHighPriorityRpc_IMPL(struct OBJGPU *pGpu, struct KernelGsp *pKernelGsp);
+
+#ifdef __nvoc_kernel_gsp_h_disabled
+static inline struct OBJRPC *kgspGetHighPriorityRpc(struct OBJGPU *pGpu, struct KernelGsp *pKernelGsp) {
+    NV_ASSERT_FAILED_PRECOMP("KernelGsp was disabled!");
+    return NULL;
+}
+#else //__nvoc_kernel_gsp_h_disabled
+#define kgspGetHighPriorityRpc(pGpu, pKernelGsp) kgspGetHighPriorityRpc_IMPL(pGpu, pKernelGsp)
+#endif //__nvoc_kernel_gsp_h_disabled
+
 NV_STATUS kgspCreateRadix3_IMPL(struct OBJGPU *pGpu, struct KernelGsp *pKernelGsp, MEMORY_DESCRIPTOR **ppMemdescRadix3, MEMORY_DESCRIPTOR *pMemdescData, const void *pData, NvU64 sizeOfData);
 
 #ifdef __nvoc_kernel_gsp_h_disabled
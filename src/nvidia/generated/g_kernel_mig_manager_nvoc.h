@@ -83,6 +83,8 @@ typedef struct MIG_GPU_INSTANCE MIG_GPU_INSTANCE;
     ((KMIGMGR_MAX_GPU_SWIZZID * KMIGMGR_MAX_GPU_SWIZZID) + \
      KMIGMGR_MAX_COMPUTE_INSTANCES)
 
+#define KMIGMGR_MAX_CACHED_PARTITION_PLANS  4
+
 MAKE_BITVECTOR(GFID_BIT_VECTOR, VMMU_MAX_GFID);
 
 typedef struct KMIGMGR_INSTANCE_HANDLES
@@ -430,6 +432,45 @@ typedef struct KMIGMGR_CREATE_GPU_INSTANCE_PARAMS
     } inst;
 } KMIGMGR_CREATE_GPU_INSTANCE_PARAMS;
 
+/*!
+ * @brief Cached partition plan describing a previously applied layout
+ *
+ * A plan is keyed by the canonicalized partition flags of a SET_PARTITIONS
+ * request (sorted, with placement request bits cleared). Once a layout has
+ * been validated and applied, recurring requests for the same layout skip
+ * the per-entry flag validation pass, and the exported GPU instance info
+ * recorded for each placement lets the kernel skip the
+ * NV2080_CTRL_CMD_INTERNAL_MIGMGR_EXPORT_GPU_INSTANCE round-trip to GSP.
+ */
+typedef struct KMIGMGR_PARTITION_PLAN
+{
+    /*!
+     * States that this plan holds a previously validated and applied layout
+     */
+    NvBool bValid;
+
+    /*!
+     * Number of GPU instances requested by this layout
+     */
+    NvU32 partitionCount;
+
+    /*!
+     * Canonicalized partition flags of the requested layout
+     */
+    NvU32 partitionFlags[KMIGMGR_MAX_GPU_INSTANCES];
+
+    /*!
+     * Placements the layout resolved to the last time it was applied
+     */
+    struct
+    {
+        NvBool bValid;
+        NvU32 swizzId;
+        NvU32 partitionFlag;
+        NV2080_CTRL_INTERNAL_KMIGMGR_EXPORTED_GPU_INSTANCE_INFO giInfo;
+    } placements[KMIGMGR_MAX_GPU_INSTANCES];
+} KMIGMGR_PARTITION_PLAN;
+
 /*!
  * @brief Packed pointer to a GPU instance/compute instance combo
  * @note  Having NULL pKernelMIGGpuInstance and non-NULL pMIGComputeInstance is never expected
@@ -528,6 +569,9 @@ struct KernelMIGManager {
     NvBool PRIVATE_FIELD(bGlobalBootConfigUsed);
     NvU64 PRIVATE_FIELD(validGlobalCTSIdMask);
     NvU64 PRIVATE_FIELD(validGlobalGfxCTSIdMask);
+    KMIGMGR_PARTITION_PLAN PRIVATE_FIELD(partitionPlans)[4];
+    NvU32 PRIVATE_FIELD(partitionPlanEvictIdx);
+    KMIGMGR_PARTITION_PLAN *PRIVATE_FIELD(pActivePartitionPlan);
 };
 
 struct KernelMIGManager_PRIVATE {
@@ -586,6 +630,9 @@ struct KernelMIGManager_PRIVATE {
     NvBool bGlobalBootConfigUsed;
     NvU64 validGlobalCTSIdMask;
     NvU64 validGlobalGfxCTSIdMask;
+    KMIGMGR_PARTITION_PLAN partitionPlans[4];
+    NvU32 partitionPlanEvictIdx;
+    KMIGMGR_PARTITION_PLAN *pActivePartitionPlan;
 };
 
 #ifndef __NVOC_CLASS_KernelMIGManager_TYPEDEF__
@@ -1707,6 +1754,58 @@ static inline NV_STATUS kmigmgrSwizzIdToResourceAllocation(OBJGPU *arg0, struct
 #define kmigmgrSwizzIdToResourceAllocation(arg0, arg1, swizzId, arg2, arg3, arg4) kmigmgrSwizzIdToResourceAllocation_IMPL(arg0, arg1, swizzId, arg2, arg3, arg4)
 #endif //__nvoc_kernel_mig_manager_h_disabled
 
+NvBool kmigmgrBeginPartitionPlan_IMPL(OBJGPU *arg0, struct KernelMIGManager *arg1, NV2080_CTRL_GPU_SET_PARTITIONS_PARAMS *arg2);
+
+#ifdef __nvoc_kernel_mig_manager_h_disabled
+static inline NvBool kmigmgrBeginPartitionPlan(OBJGPU *arg0, struct KernelMIGManager *arg1, NV2080_CTRL_GPU_SET_PARTITIONS_PARAMS *arg2) {
+    NV_ASSERT_FAILED_PRECOMP("KernelMIGManager was disabled!");
+    return NV_FALSE;
+}
+#else //__nvoc_kernel_mig_manager_h_disabled
+#define kmigmgrBeginPartitionPlan(arg0, arg1, arg2) kmigmgrBeginPartitionPlan_IMPL(arg0, arg1, arg2)
+#endif //__nvoc_kernel_mig_manager_h_disabled
+
+void kmigmgrEndPartitionPlan_IMPL(OBJGPU *arg0, struct KernelMIGManager *arg1, NvBool bApplied);
+
+#ifdef __nvoc_kernel_mig_manager_h_disabled
+static inline void kmigmgrEndPartitionPlan(OBJGPU *arg0, struct KernelMIGManager *arg1, NvBool bApplied) {
+    NV_ASSERT_FAILED_PRECOMP("KernelMIGManager was disabled!");
+}
+#else //__nvoc_kernel_mig_manager_h_disabled
+#define kmigmgrEndPartitionPlan(arg0, arg1, bApplied) kmigmgrEndPartitionPlan_IMPL(arg0, arg1, bApplied)
+#endif //__nvoc_kernel_mig_manager_h_disabled
+
+NvBool kmigmgrLookupPlannedGPUInstanceInfo_IMPL(OBJGPU *arg0, struct KernelMIGManager *arg1, NvU32 swizzId, NvU32 partitionFlag, NV2080_CTRL_INTERNAL_KMIGMGR_EXPORTED_GPU_INSTANCE_INFO *arg2);
+
+#ifdef __nvoc_kernel_mig_manager_h_disabled
+static inline NvBool kmigmgrLookupPlannedGPUInstanceInfo(OBJGPU *arg0, struct KernelMIGManager *arg1, NvU32 swizzId, NvU32 partitionFlag, NV2080_CTRL_INTERNAL_KMIGMGR_EXPORTED_GPU_INSTANCE_INFO *arg2) {
+    NV_ASSERT_FAILED_PRECOMP("KernelMIGManager was disabled!");
+    return NV_FALSE;
+}
+#else //__nvoc_kernel_mig_manager_h_disabled
+#define kmigmgrLookupPlannedGPUInstanceInfo(arg0, arg1, swizzId, partitionFlag, arg2) kmigmgrLookupPlannedGPUInstanceInfo_IMPL(arg0, arg1, swizzId, partitionFlag, arg2)
+#endif //__nvoc_kernel_mig_manager_h_disabled
+
+void kmigmgrRecordPlannedGPUInstanceInfo_IMPL(OBJGPU *arg0, struct KernelMIGManager *arg1, NvU32 swizzId, NvU32 partitionFlag, const NV2080_CTRL_INTERNAL_KMIGMGR_EXPORTED_GPU_INSTANCE_INFO *arg2);
+
+#ifdef __nvoc_kernel_mig_manager_h_disabled
+static inline void kmigmgrRecordPlannedGPUInstanceInfo(OBJGPU *arg0, struct KernelMIGManager *arg1, NvU32 swizzId, NvU32 partitionFlag, const NV2080_CTRL_INTERNAL_KMIGMGR_EXPORTED_GPU_INSTANCE_INFO *arg2) {
+    NV_ASSERT_FAILED_PRECOMP("KernelMIGManager was disabled!");
+}
+#else //__nvoc_kernel_mig_manager_h_disabled
+#define kmigmgrRecordPlannedGPUInstanceInfo(arg0, arg1, swizzId, partitionFlag, arg2) kmigmgrRecordPlannedGPUInstanceInfo_IMPL(arg0, arg1, swizzId, partitionFlag, arg2)
+#endif //__nvoc_kernel_mig_manager_h_disabled
+
+void kmigmgrInvalidatePartitionPlans_IMPL(OBJGPU *arg0, struct KernelMIGManager *arg1);
+
+#ifdef __nvoc_kernel_mig_manager_h_disabled
+static inline void kmigmgrInvalidatePartitionPlans(OBJGPU *arg0, struct KernelMIGManager *arg1) {
+    NV_ASSERT_FAILED_PRECOMP("KernelMIGManager was disabled!");
+}
+#else //__nvoc_kernel_mig_manager_h_disabled
+#define kmigmgrInvalidatePartitionPlans(arg0, arg1) kmigmgrInvalidatePartitionPlans_IMPL(arg0, arg1)
+#endif //__nvoc_kernel_mig_manager_h_disabled
+
 NV_STATUS kmigmgrAllocComputeInstanceHandles_IMPL(OBJGPU *arg0, struct KernelMIGManager *arg1, KERNEL_MIG_GPU_INSTANCE *arg2, MIG_COMPUTE_INSTANCE *arg3);
 
 #ifdef __nvoc_kernel_mig_manager_h_disabled
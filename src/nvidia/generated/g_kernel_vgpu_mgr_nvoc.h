@@ -194,6 +194,16 @@ typedef struct
      */
     NvU64                            assignedSwizzIdMask;
     NvU32                            fractionalMultiVgpu;
+
+    /*!
+     * Cached results of idempotent GSP queries. These are constant while the
+     * GPU stays attached; the cache is dropped on detach and repopulated on
+     * the first query after the next attach.
+     */
+    NvBool                           bMigrationSupportCached;
+    NvBool                           bMigrationSupported;
+    NvU32                            fsEncodingSize;
+    NvU8                             fsEncoding[NVA081_PGPU_METADATA_STRING_SIZE];
 } KERNEL_PHYS_GPU_INFO;
 
 /* vGPU info received from mdev kernel module for KVM */
@@ -657,6 +657,11 @@ NV_STATUS memdescCreate(MEMORY_DESCRIPTOR **ppMemDesc, OBJGPU *pGpu, NvU64 Size,
                         NvU64 alignment, NvBool PhysicallyContiguous,
                         NV_ADDRESS_SPACE AddressSpace, NvU32 CpuCacheAttrib, NvU64 Flags);
 
+// Create/destroy the pool of fixed-size memory descriptors that memdescCreate
+// draws from; without the pool every descriptor comes from the heap.
+void memdescPoolInit(void);
+void memdescPoolDestroy(void);
+
 #define MEMDESC_FLAGS_ALLOC_PER_SUBDEVICE_FB_BC_ONLY(pGpu, addressSpace) \
     ((gpumgrGetBcEnabledStatus(pGpu) && (pGpu != NULL) && (addressSpace == ADDR_FBMEM)) ?  MEMDESC_FLAGS_ALLOC_PER_SUBDEVICE : MEMDESC_FLAGS_NONE)
 
@@ -114,6 +114,13 @@ typedef struct
 //
 #define RM_DEFAULT_PTE_KIND                 0x100
 
+//
+// Number of warm CeUtils channels in the shared per-GPU pool, including the
+// primary global instance. Internal copy users dispatch round-robin across
+// the pool instead of instantiating their own channels.
+//
+#define MEMMGR_CEUTILS_POOL_SIZE            4
+
 typedef enum
 {
     FB_IS_KIND_Z,                           // Kind is a Z buffer
@@ -573,6 +580,9 @@ struct MemoryManager {
     NvU32 rsvdMemorySize;
     struct CeUtils *pCeUtils;
     struct CeUtils *pCeUtilsSuspended;
+    struct CeUtils *pCeUtilsPool[MEMMGR_CEUTILS_POOL_SIZE];
+    NvU32 ceUtilsPoolCount;
+    NvU32 ceUtilsPoolNext;
     NvBool bDisableGlobalCeUtils;
     OBJSCRUB eccScrubberState;
     struct __nvoc_inner_struc_MemoryManager_1__ Ram;
@@ -2774,6 +2784,17 @@ static inline void memmgrDestroyCeUtils(struct MemoryManager *pMemoryManager, Nv
 #define memmgrDestroyCeUtils(pMemoryManager, bSuspendCeUtils) memmgrDestroyCeUtils_IMPL(pMemoryManager, bSuspendCeUtils)
 #endif //__nvoc_mem_mgr_h_disabled
 
+struct CeUtils *memmgrGetCeUtils_IMPL(struct MemoryManager *pMemoryManager);
+
+#ifdef __nvoc_mem_mgr_h_disabled
+static inline struct CeUtils *memmgrGetCeUtils(struct MemoryManager *pMemoryManager) {
+    NV_ASSERT_FAILED_PRECOMP("MemoryManager was disabled!");
+    return NULL;
+}
+#else //__nvoc_mem_mgr_h_disabled
+#define memmgrGetCeUtils(pMemoryManager) memmgrGetCeUtils_IMPL(pMemoryManager)
+#endif //__nvoc_mem_mgr_h_disabled
+
 NV_STATUS memmgrSetMIGPartitionableBAR1Range_IMPL(OBJGPU *arg0, struct MemoryManager *arg1);
 
 #ifdef __nvoc_mem_mgr_h_disabled
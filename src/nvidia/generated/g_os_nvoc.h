@@ -418,6 +418,14 @@ typedef NvBool     OSIsEqualGUID(void *, void *);
 //
 #define OS_QUEUE_WORKITEM_FLAGS_FULL_GPU_SANITY              NVBIT(17)
 #define OS_QUEUE_WORKITEM_FLAGS_FOR_PM_RESUME                NVBIT(18)
+//
+// The work item has no ordering requirement relative to other work items
+// queued on the same GPU: it may run concurrently with them, subject only
+// to the lock flags above. On platforms with a multi-threaded work queue
+// this keeps independent deferred work from serializing behind unrelated
+// items.
+//
+#define OS_QUEUE_WORKITEM_FLAGS_UNORDERED                    NVBIT(19)
 typedef void       OSWorkItemFunction(NvU32 gpuInstance, void *);
 typedef void       OSSystemWorkItemFunction(void *);
 NV_STATUS  osQueueWorkItemWithFlags(OBJGPU *, OSWorkItemFunction, void *, NvU32);
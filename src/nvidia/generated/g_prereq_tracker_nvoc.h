@@ -77,7 +77,7 @@ extern "C" {
  * @return  boolean if prerequisite has been satisfied.
  */
 #define PREREQ_IS_SATISFIED(_pPrereq)                                      \
-    ((_pPrereq)->countRequested == (_pPrereq)->countSatisfied)
+    bitVectorTestAllCleared(&(_pPrereq)->remaining)
 
 /* ------------------------ Datatypes --------------------------------------- */
 
@@ -126,14 +126,11 @@ typedef struct
     PREREQ_ID_BIT_VECTOR requested;
 
     /*!
-     * Counter of all dependencies (prerequisites) tracked by this structure.
+     * Mask of requested dependencies that are not yet satisfied. The callback
+     * can be issued once this mask drains to zero; with the 64-bit ID space
+     * that check is a single-word test.
      */
-    NvS32                countRequested;
-    /*!
-     * Counter of currently satisfied dependencies (prerequisites) tracked by
-     * this structure. Once equal to @ref countRequested, callback can be issued.
-     */
-    NvS32                countSatisfied;
+    PREREQ_ID_BIT_VECTOR remaining;
 
     /*!
      * Boolean indicating that the given PREREQ_ENTRY is armed and ready to fire @ref
@@ -173,6 +170,7 @@ struct PrereqTracker {
     union PREREQ_ID_BIT_VECTOR satisfied;
     NvBool bInitialized;
     PrereqList prereqList;
+    NvU32 gateCount[PREREQ_ID_VECTOR_SIZE];
     struct OBJGPU *pParent;
 };
 
@@ -243,6 +241,17 @@ static inline NvBool prereqIdIsSatisfied(struct PrereqTracker *pTracker, PREREQ_
 #define prereqIdIsSatisfied(pTracker, prereqId) prereqIdIsSatisfied_IMPL(pTracker, prereqId)
 #endif //__nvoc_prereq_tracker_h_disabled
 
+NvU32 prereqIdGetGateCount_IMPL(struct PrereqTracker *pTracker, PREREQ_ID prereqId);
+
+#ifdef __nvoc_prereq_tracker_h_disabled
+static inline NvU32 prereqIdGetGateCount(struct PrereqTracker *pTracker, PREREQ_ID prereqId) {
+    NV_ASSERT_FAILED_PRECOMP("PrereqTracker was disabled!");
+    return 0;
+}
+#else //__nvoc_prereq_tracker_h_disabled
+#define prereqIdGetGateCount(pTracker, prereqId) prereqIdGetGateCount_IMPL(pTracker, prereqId)
+#endif //__nvoc_prereq_tracker_h_disabled
+
 NV_STATUS prereqComposeEntry_IMPL(struct PrereqTracker *pTracker, GpuPrereqCallback *callback, union PREREQ_ID_BIT_VECTOR *pDepends, PREREQ_ENTRY **ppPrereq);
 
 #ifdef __nvoc_prereq_tracker_h_disabled
@@ -66,6 +66,63 @@ typedef struct AccessBackRef
 
 MAKE_LIST(AccessBackRefList, AccessBackRef);
 
+/**
+ * Number of slots in the per-client handle lookup cache. Must be a power of
+ * two; slots are direct-mapped by resource handle.
+ */
+#define RS_CLIENT_REF_CACHE_SIZE 8
+
+/**
+ * One slot of the per-client handle lookup cache.
+ *
+ * seq is a per-slot sequence counter: a writer claims the slot by moving seq
+ * from even to odd with a compare-and-swap, fills in the fields, then bumps
+ * seq back to even. A reader discards the slot if seq is odd or changes while
+ * the fields are read, so lookups racing under a shared client lock never
+ * observe a torn update. A slot is only valid while generation matches the
+ * client's refCacheGeneration; freeing any resource bumps the generation,
+ * which invalidates every slot at once.
+ */
+typedef struct RS_REF_CACHE_SLOT
+{
+    volatile NvU32 seq;
+    NvU32 generation;
+    NvHandle hResource;
+    RsResourceRef *pResourceRef;
+} RS_REF_CACHE_SLOT;
+
+/**
+ * Number of memoized access decisions kept per client; must be a power of
+ * two; slots are direct-mapped by target resource handle.
+ */
+#define RS_CLIENT_ACCESS_CACHE_SIZE 8
+
+/**
+ * One memoized access-rights decision for a resource owned by another client.
+ *
+ * Shared-rights evaluation walks the resource's share policy list and invokes
+ * share callbacks; this slot remembers the verdict so repeated checks (e.g.
+ * back-to-back dups of the same resource) skip the walk. The seq protocol is
+ * identical to RS_REF_CACHE_SLOT. A slot is only valid while all three
+ * generations still match: the global share policy generation (bumped on any
+ * share policy mutation or client teardown) and the refCacheGeneration of
+ * both the owning and the invoking client (bumped on any resource free, which
+ * covers handle reuse and loss of sharing-relevant objects such as MIG
+ * partition subscriptions).
+ */
+typedef struct RS_ACCESS_CACHE_SLOT
+{
+    volatile NvU32 seq;
+    NvHandle hOwnerClient;
+    NvHandle hResource;
+    NvHandle hContext;
+    RS_ACCESS_MASK rightsRequired;
+    NvU32 shareGeneration;
+    NvU32 ownerGeneration;
+    NvU32 invokerGeneration;
+    NvBool bAllowed;
+} RS_ACCESS_CACHE_SLOT;
+
 /**
  * Information about a client
  */
@@ -102,6 +159,9 @@ struct RsClient {
     NvBool bDisabled;
     NvBool bHighPriorityFreeDone;
     RsRefMap resourceMap;
+    RS_REF_CACHE_SLOT refCache[RS_CLIENT_REF_CACHE_SIZE];
+    volatile NvU32 refCacheGeneration;
+    RS_ACCESS_CACHE_SLOT accessCache[RS_CLIENT_ACCESS_CACHE_SIZE];
     AccessBackRefList accessBackRefList;
     NvHandle handleRangeStart;
     NvHandle handleRangeSize;
@@ -700,6 +700,15 @@ struct RsResourceRef
     ListNode   freeNode;        ///< Links to the client's pendingFreeList
 };
 MAKE_MAP(RsRefMap, RsResourceRef);
+
+//
+// Hash map alternative for RsClient::resourceMap. Resserv only uses the
+// unordered subset of the map interface on the resource map (find, insertNew,
+// remove, iterAll), so the O(log n) red-black tree can be swapped for O(1)
+// probes by retyping the field and renaming the map* calls to hashmap*.
+// Iteration order changes from handle order to unspecified order.
+//
+MAKE_HASHMAP(RsRefHashMap, RsResourceRef);
 MAKE_INTRUSIVE_LIST(RsRefFreeList, RsResourceRef, freeNode);
 
 
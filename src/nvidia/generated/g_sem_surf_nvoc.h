@@ -55,15 +55,15 @@ typedef struct {
     /* List of listeners waiting for the value */
     EVENTNOTIFICATION *pListeners;
 
-    ListNode valueListEntry;
+    MapNode valueMapEntry;
     ListNode pendingNotificationsEntry;
 } SEM_VALUE_LISTENERS_NODE;
 
-MAKE_INTRUSIVE_LIST(SEM_VALUE_LISTENERS, SEM_VALUE_LISTENERS_NODE, valueListEntry);
+MAKE_INTRUSIVE_MAP(SEM_VALUE_LISTENERS, SEM_VALUE_LISTENERS_NODE, valueMapEntry);
 MAKE_INTRUSIVE_LIST(SEM_PENDING_NOTIFICATIONS, SEM_VALUE_LISTENERS_NODE, pendingNotificationsEntry);
 
 typedef struct {
-    /* List of values being listened for at this index, ordered by value. */
+    /* Map of values being listened for at this index, keyed by value. */
     SEM_VALUE_LISTENERS listeners;
 
     MapNode node;
@@ -399,6 +399,7 @@ struct OBJSYS {
     NvBool PDB_PROP_SYS_CLIENT_HANDLE_LOOKUP;
     NvBool PDB_PROP_SYS_RM_LOCK_TIME_COLLECT;
     NvU32 apiLockMask;
+    NvU32 clientLockMask;
     NvU32 apiLockModuleMask;
     NvU32 gpuLockModuleMask;
     NvBool PDB_PROP_SYS_ROUTE_TO_PHYSICAL_LOCK_BYPASS;
@@ -122,6 +122,7 @@ struct TimedSemaSwObject {
     NvU64 WaitTimestamp;
     NvU64 FlushLimitTimestamp;
     GF100_TIMED_SEM_ENTRY_LIST entryList;
+    struct TMR_EVENT *pTmrEvent;
 };
 
 #ifndef __NVOC_CLASS_TimedSemaSwObject_TYPEDEF__
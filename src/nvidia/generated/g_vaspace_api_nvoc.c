@@ -287,14 +287,29 @@ static const struct NVOC_EXPORTED_METHOD_DEF __nvoc_exported_method_def_VaSpaceA
         /*pClassInfo=*/ &(__nvoc_class_def_VaSpaceApi.classInfo),
 #if NV_PRINTF_STRINGS_ALLOWED
         /*func=*/       "vaspaceapiCtrlCmdVaspaceGetHostRmManagedSize"
+#endif
+    },
+    {               /*  [6] */
+#if NVOC_EXPORTED_METHOD_DISABLED_BY_FLAG(0x8011u)
+        /*pFunc=*/      (void (*)(void)) NULL,
+#else
+        /*pFunc=*/      (void (*)(void)) vaspaceapiCtrlCmdVaspaceMapBatch_IMPL,
+#endif // NVOC_EXPORTED_METHOD_DISABLED_BY_FLAG(0x8011u)
+        /*flags=*/      0x8011u,
+        /*accessRight=*/0x0u,
+        /*methodId=*/   0x90f10109u,
+        /*paramSize=*/  sizeof(NV90F1_CTRL_VASPACE_MAP_BATCH_PARAMS),
+        /*pClassInfo=*/ &(__nvoc_class_def_VaSpaceApi.classInfo),
+#if NV_PRINTF_STRINGS_ALLOWED
+        /*func=*/       "vaspaceapiCtrlCmdVaspaceMapBatch"
 #endif
     },
 
 };
 
-const struct NVOC_EXPORT_INFO __nvoc_export_info_VaSpaceApi = 
+const struct NVOC_EXPORT_INFO __nvoc_export_info_VaSpaceApi =
 {
-    /*numEntries=*/     6,
+    /*numEntries=*/     7,
     /*pExportEntries=*/ __nvoc_exported_method_def_VaSpaceApi
 };
 
@@ -357,6 +372,10 @@ static void __nvoc_init_funcTable_VaSpaceApi_1(VaSpaceApi *pThis) {
     pThis->__vaspaceapiCtrlCmdVaspaceGetHostRmManagedSize__ = &vaspaceapiCtrlCmdVaspaceGetHostRmManagedSize_IMPL;
 #endif
 
+#if !NVOC_EXPORTED_METHOD_DISABLED_BY_FLAG(0x8011u)
+    pThis->__vaspaceapiCtrlCmdVaspaceMapBatch__ = &vaspaceapiCtrlCmdVaspaceMapBatch_IMPL;
+#endif
+
     pThis->__nvoc_base_GpuResource.__nvoc_base_RmResource.__nvoc_base_RsResource.__resCanCopy__ = &__nvoc_thunk_VaSpaceApi_resCanCopy;
 
     pThis->__vaspaceapiShareCallback__ = &__nvoc_thunk_GpuResource_vaspaceapiShareCallback;
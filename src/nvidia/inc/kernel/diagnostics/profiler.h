@@ -116,4 +116,81 @@ void rmProfGroupStart(RM_PROF_GROUP *pGroup, RM_PROF_STATS *pTotal, RM_PROF_STAT
 void rmProfGroupNext (RM_PROF_GROUP *pGroup, RM_PROF_STATS *pNext);
 void rmProfGroupStop (RM_PROF_GROUP *pGroup);
 
+/***************************************************************************\
+*                             Phase profiler                                *
+\***************************************************************************/
+
+/*!
+ * Well-known RM phases instrumented with begin/end markers. Each phase
+ * aggregates into its own latency histogram so that regressions can be
+ * attributed to a specific driver path without external tracing tools.
+ */
+typedef enum
+{
+    RM_PROF_PHASE_GPU_STATE_LOAD = 0, //<! gpuStateLoad() (boot / resume)
+    RM_PROF_PHASE_SERVER_ALLOC,       //<! RM API object allocation (server path)
+    RM_PROF_PHASE_SERVER_FREE,        //<! RM API object free (server path)
+    RM_PROF_PHASE_GSP_RPC_WAIT,       //<! Synchronous GSP RPC round-trip wait
+    RM_PROF_PHASE_RUNLIST_COMMIT,     //<! GPFIFO schedule / runlist commit
+    RM_PROF_PHASE_COUNT
+} RM_PROF_PHASE;
+
+/*!
+ * Number of logarithmic histogram buckets per phase. Bucket 0 holds cycles
+ * shorter than 1us (1024ns); bucket N holds cycles in [2^(N+9), 2^(N+10)) ns;
+ * the last bucket holds everything from ~16.8 seconds up.
+ */
+#define RM_PROF_PHASE_HIST_BUCKETS 26
+
+/*!
+ * Per-phase latency histogram. All fields are updated with relaxed atomics so
+ * concurrent producers never serialize on a lock.
+ */
+typedef struct
+{
+    NvU64 count;                               //<! Number of recorded cycles
+    NvU64 total_ns;                            //<! Sum of all cycle times
+    NvU64 min_ns;                              //<! Shortest cycle (0 = none yet)
+    NvU64 max_ns;                              //<! Longest cycle
+    NvU64 buckets[RM_PROF_PHASE_HIST_BUCKETS]; //<! Log2 latency distribution
+} RM_PROF_PHASE_HIST;
+
+#define RM_PROF_PHASE_PAGE_MAGIC   0x524D5050 // 'RMPP'
+#define RM_PROF_PHASE_PAGE_VERSION 1
+#define RM_PROF_PHASE_PAGE_SIZE    4096
+
+/*!
+ * Layout of the phase profiler's shared page. The page is a single
+ * physically contiguous nonpaged allocation so an external consumer (debugger
+ * or crash dump decoder) can locate it by magic and read the histograms
+ * without stopping the driver.
+ *
+ * enabledMask is re-read on every marker, so individual phases can be toggled
+ * at runtime by rewriting the mask in place; the registry only provides the
+ * initial value.
+ */
+typedef struct
+{
+    NvU32 magic;       //<! RM_PROF_PHASE_PAGE_MAGIC
+    NvU32 version;     //<! RM_PROF_PHASE_PAGE_VERSION
+    volatile NvU32 enabledMask; //<! Bitmask of enabled RM_PROF_PHASE values
+    NvU32 phaseCount;  //<! RM_PROF_PHASE_COUNT at build time
+    RM_PROF_PHASE_HIST phases[RM_PROF_PHASE_COUNT];
+} RM_PROF_PHASE_PAGE;
+
+/*!
+ * Begin/end markers around a well-known phase. Begin returns an opaque start
+ * token (0 when the phase is disabled); end is a no-op for a zero token, so
+ * callers need no separate enablement checks.
+ */
+#define RM_PROF_PHASE_BEGIN(phase)          rmProfPhaseBegin(phase)
+#define RM_PROF_PHASE_END(phase, start_ns)  rmProfPhaseEnd(phase, start_ns)
+
+void   rmProfPhaseInit(void);
+void   rmProfPhaseDestroy(void);
+NvBool rmProfPhaseEnabled(RM_PROF_PHASE phase);
+NvU64  rmProfPhaseBegin(RM_PROF_PHASE phase);
+void   rmProfPhaseEnd(RM_PROF_PHASE phase, NvU64 start_ns);
+const RM_PROF_PHASE_PAGE *rmProfPhaseGetPage(void);
+
 #endif /* _PROFILER_H_ */
@@ -41,5 +41,8 @@ void      GspMsgQueuesCleanup(MESSAGE_QUEUE_COLLECTION **ppMQCollection);
 NV_STATUS GspStatusQueueInit(OBJGPU *pGpu, MESSAGE_QUEUE_INFO **ppMQI);
 NV_STATUS GspMsgQueueSendCommand(MESSAGE_QUEUE_INFO *pMQI, OBJGPU *pGpu);
 NV_STATUS GspMsgQueueReceiveStatus(MESSAGE_QUEUE_INFO *pMQI, OBJGPU *pGpu);
+void      GspMsgQueueTxBatchBegin(MESSAGE_QUEUE_INFO *pMQI);
+void      GspMsgQueueTxBatchEnd(MESSAGE_QUEUE_INFO *pMQI, OBJGPU *pGpu);
+NvU32     GspMsgQueueRxPending(MESSAGE_QUEUE_INFO *pMQI);
 
 #endif // _MESSAGE_QUEUE_H_
@@ -70,6 +70,8 @@ typedef struct _message_queue_info
     NvU32                  rxSeqNum;            // Next sequence number for rx.
     NvU32                  txBufferFull;
     NvU32                  queueIdx;            // QueueIndex used to identify which task the message is supposed to be sent to.
+    NvU32                  txBatchDepth;        // Nesting depth of open tx doorbell coalescing batches.
+    NvBool                 bTxDoorbellPending;  // A send was submitted while a batch was open.
 } MESSAGE_QUEUE_INFO;
 
 typedef struct MESSAGE_QUEUE_COLLECTION
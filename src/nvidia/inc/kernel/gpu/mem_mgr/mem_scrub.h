@@ -54,6 +54,7 @@ struct OBJCHANNEL;
 #define SIZE_OF_ONE_MEMSET_BLOCK                  0x60
 #define SCRUB_MAX_BYTES_PER_LINE                  0xffffffffULL
 #define MAX_SCRUB_ITEMS                           4096 // 4K scrub items
+#define SCRUBBER_MAX_CE_CHANNELS                  4    // Max CEs striped by the scrubber
 
 // structure to store the details of a scrubbing work
 typedef struct SCRUB_NODE {
@@ -65,6 +66,19 @@ typedef struct SCRUB_NODE {
     NvU64      size;
 } SCRUB_NODE, *PSCRUB_NODE;
 
+//
+// Per-work-item channel tag. Work IDs stay globally ordered, but with
+// multi-CE striping each item completes on its own channel, so completion
+// is judged per item by (channel, channel payload) instead of a single
+// semaphore stream.
+//
+typedef struct SCRUB_CHANNEL_TAG {
+    // Index of the channel the work was submitted to
+    NvU32      channelIdx;
+    // The channel-local payload the work completes with
+    NvU64      payload;
+} SCRUB_CHANNEL_TAG;
+
 //
 // OBJMEMSCRUB OBJECT
 // Memory scrubber struct encapsulates the CE Channel object,
@@ -86,14 +100,22 @@ typedef struct OBJMEMSCRUB {
     NvLength                           scrubListSize;
     // Pre-allocated Free Scrub List
     PSCRUB_NODE                        pScrubList;
+    // Channel tags parallel to pScrubList, indexed by (id - 1) % MAX_SCRUB_ITEMS
+    SCRUB_CHANNEL_TAG                 *pWorkTags;
 #if !defined(SRT_BUILD)
-    // Scrubber uses ceUtils to manage CE channel
-    CeUtils                           *pCeUtils;
+    // Scrubber stripes work across ceUtils-managed CE channels
+    CeUtils                           *pCeUtils[SCRUBBER_MAX_CE_CHANNELS];
 
     // Scrubber uses sec2Utils to manage SEC2 channel
     Sec2Utils                         *pSec2Utils;
 #endif //  !defined(SRT_BUILD)
-    // Engine used for scrubbing 
+    // Number of usable scrub channels (1 for SEC2 and single-CE parts)
+    NvU32                              numChannels;
+    // Next channel for round-robin submission
+    NvU32                              nextChannel;
+    // Last payload submitted to each channel
+    NvU64                              lastSubmittedPayload[SCRUBBER_MAX_CE_CHANNELS];
+    // Engine used for scrubbing
     NvU32                              engineType;
 
     struct OBJGPU                     *pGpu;
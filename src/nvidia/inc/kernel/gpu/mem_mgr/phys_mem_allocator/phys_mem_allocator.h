@@ -99,6 +99,7 @@ typedef struct SCRUB_NODE SCRUB_NODE;
 #define PMA_ALLOCATE_TURN_BLACKLIST_OFF     NVBIT(11)
 #define PMA_ALLOCATE_ALLOW_PARTIAL          NVBIT(12)
 #define PMA_ALLOCATE_REVERSE_ALLOC          NVBIT(13)
+#define PMA_ALLOCATE_SPECIFY_NUMA_NODE_HINT NVBIT(14)
 
 // Output flags
 #define PMA_ALLOCATE_RESULT_IS_ZERO         NVBIT(0)
@@ -127,6 +128,7 @@ typedef struct
     NvU32 regionId;             // valid if flags & PMA_ALLOCATE_SPECIFY_REGION_ID
     NvU64 alignment;            // valid if flags & PMA_ALLOCATE_FORCE_ALIGNMENT
     NvLength numPagesAllocated; // valid if flags & PMA_ALLOCATE_ALLOW_PARTIAL
+    NvS32 numaNodeHint;         // valid if flags & PMA_ALLOCATE_SPECIFY_NUMA_NODE_HINT
 
     NvU32 resultFlags;          // valid if the allocation function returns NV_OK
 } PMA_ALLOCATION_OPTIONS;
@@ -163,6 +165,25 @@ typedef enum
     MEMORY_PROTECTION_PROTECTED   = 1
 } MEMORY_PROTECTION;
 
+// Number of 64KB frames cached per protection type for fast reallocation
+#define PMA_FRAME_MAGAZINE_SIZE 64
+
+/*!
+ * @brief A small cache ("magazine") of recently freed 64KB frames.
+ *
+ * Frames in the magazine remain marked STATE_PIN in the map so eviction and
+ * the scanners never see them; popping one therefore requires no map update
+ * for pinned requests and a single O(1) state change otherwise. The magazine
+ * lock is only ever acquired with the PMA-wide lock either not held or
+ * already held (push/drain), never the other way around.
+ */
+typedef struct
+{
+    PORT_SPINLOCK  *pLock;                           // Protects count and pages below
+    NvU64           pages[PMA_FRAME_MAGAZINE_SIZE];  // Physical addresses of cached frames
+    NvU32           count;                           // Number of valid entries in pages
+} PMA_FRAME_MAGAZINE;
+
 /*!
  * @brief Callback to update stats in RUSD
  */
@@ -240,6 +261,7 @@ struct _PMA
     NvU64                   frameAllocDemand;                   // Frame count of allocations in-process
     NvBool                  bForcePersistence;                  // Force all allocations to persist across suspend/resume
     PMA_STATS               pmaStats;                           // PMA statistics used for client heuristics
+    PMA_FRAME_MAGAZINE      frameMagazine[2];                   // Freed-frame caches, indexed by MEMORY_PROTECTION
 
     // Scrubber related states
     NvSPtr                  initScrubbing;                      // If the init scrubber has finished in this PMA
@@ -48,6 +48,8 @@ typedef struct pma_regmap
     NvU64 totalFrames;                /* Total number of frames */
     NvU64 mapLength;                  /* Length of the map */
     NvU64 *map[PMA_BITS_PER_PAGE];    /* The bit map */
+    NvU64 *fullWords[PMA_BITS_PER_PAGE]; /* Per-plane summary: bit g set iff map[i][g] is all ones */
+    NvU64 fullWordsLength;            /* Length of each fullWords array */
     NvU64 frameEvictionsInProcess;    /* Count of frame evictions in-process */
     PMA_STATS *pPmaStats;             /* Point back to the public struct in PMA structure */
     NvBool bProtected;                /* The memory segment tracked by this regmap is protected (VPR/CPR) */
@@ -39,6 +39,15 @@
 #include "gpu/mem_mgr/virt_mem_allocator_common.h"
 #include "kernel/gpu/gpu_engine_type.h"
 
+// per-pool allocation statistics
+struct CTX_BUF_POOL_STATS
+{
+    NvU64 allocCount;
+    NvU64 freeCount;
+    NvU64 refillCount;
+};
+typedef struct CTX_BUF_POOL_STATS CTX_BUF_POOL_STATS;
+
 // state of context buffer pools
 struct CTX_BUF_POOL_INFO
 {
@@ -48,6 +57,34 @@ struct CTX_BUF_POOL_INFO
     // Pool corresponding to RM_ATTR_PAGE_SIZE_DEFAULT will be left unused
     //
     RM_POOL_ALLOC_MEM_RESERVE_INFO *pMemPool[RM_ATTR_PAGE_SIZE_INVALID];
+
+    // GPU owning this pool. Needed for queueing refill work items.
+    OBJGPU *pGpu;
+
+    //
+    // High-water mark, in chunks, of reservations made against each pool.
+    // Used as the target for low-watermark refills.
+    //
+    NvU64 refillTargetChunks[RM_ATTR_PAGE_SIZE_INVALID];
+
+    //
+    // Refill the pools from a work item when an allocation drains them below
+    // a quarter of their reservation high-water mark. Only safe for pools
+    // that live until engine/GPU state destroy (engine-global pools); pools
+    // owned by a channel group must leave this disabled.
+    //
+    NvBool bAutoRefill;
+
+    // A refill work item is queued and has not run yet
+    NvBool bRefillQueued;
+
+    //
+    // Destroy was requested while a refill work item was pending; the work
+    // item completes the destroy. Both run under the API lock.
+    //
+    NvBool bDestroyPending;
+
+    CTX_BUF_POOL_STATS stats;
 };
 
 // List of all context buffers supported by memory pools
@@ -76,6 +113,8 @@ NV_STATUS ctxBufPoolAllocate(CTX_BUF_POOL_INFO *pCtxBufPool, PMEMORY_DESCRIPTOR
 NV_STATUS ctxBufPoolFree(CTX_BUF_POOL_INFO *pCtxBufPool, PMEMORY_DESCRIPTOR pMemDesc);
 void      ctxBufPoolRelease(CTX_BUF_POOL_INFO *pCtxBufPool);
 void      ctxBufPoolDestroy(CTX_BUF_POOL_INFO **ppCtxBufPool);
+void      ctxBufPoolSetAutoRefill(CTX_BUF_POOL_INFO *pCtxBufPool, NvBool bAutoRefill);
+NV_STATUS ctxBufPoolGetStats(CTX_BUF_POOL_INFO *pCtxBufPool, NvU64 *pFreeBytes, NvU64 *pReservedBytes, CTX_BUF_POOL_STATS *pStats, NvBool *pbRefillPending);
 NvBool    ctxBufPoolIsSupported(OBJGPU *pGpu);
 NV_STATUS ctxBufPoolGetSizeAndPageSize(CTX_BUF_POOL_INFO *pCtxBufPool, OBJGPU *pGpu, NvU64 alignment, RM_ATTR_PAGE_SIZE attr, NvBool bContig, NvU64 *pSize, NvU64 *pPageSize);
 NV_STATUS ctxBufPoolGetGlobalPool(OBJGPU *pGpu, CTX_BUF_ID bufId, RM_ENGINE_TYPE rmEngineType, CTX_BUF_POOL_INFO **ppCtxBufPool);
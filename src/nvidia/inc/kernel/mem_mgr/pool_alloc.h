@@ -198,6 +198,18 @@ NvBool    rmMemPoolIsScrubSkipped(RM_POOL_ALLOC_MEM_RESERVE_INFO *pMemReserveInf
  */
 NV_STATUS      rmMemPoolGetChunkAndPageSize(RM_POOL_ALLOC_MEM_RESERVE_INFO *pMemReserveInfo, NvU64*, NvU64*);
 
+/*!
+ * @brief Get the number of free chunks currently held in the topmost pool
+ *
+ * @param[in]  pMemReserveInfo Pointer to the RM_POOL_ALLOC_MEM_RESERVE_INFO data
+ * @param[out] pFreeListLength Length of the topmost pool's freelist, in chunks
+ *
+ * @return
+ *    NV_ERR_INVALID_ARGUMENT
+ *    NV_OK
+ */
+NV_STATUS      rmMemPoolGetFreeListLength(RM_POOL_ALLOC_MEM_RESERVE_INFO *pMemReserveInfo, NvU32 *pFreeListLength);
+
 /*!
  * @brief Indicate that pool should be allocated in protected video memory in
  *        case memory protection is enabled
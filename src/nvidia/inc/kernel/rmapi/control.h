@@ -324,6 +324,39 @@ NV_STATUS embeddedParamCopyOut(RMAPI_PARAM_COPY  *pParamCopy, RmCtrlParams *pRmC
 //
 #define RMCTRL_FLAGS_DUAL_CLIENT_LOCK                         0x000800000
 
+//
+//  If the CLIENT_LOCK_READONLY flag is specified, the call will acquire the
+//  per-client lock for read and may run concurrently with other read-only
+//  controls issued on the same client. Only controls that do not mutate any
+//  client or resource state, and that do not issue further RM API calls on the
+//  same client, may set this flag. The flag is ignored for dual-client
+//  controls and if read-only client locking is disabled in RM (see
+//  NV_REG_STR_RM_READONLY_CLIENT_LOCK).
+//
+//  Please be sure you know what you're doing before using this!
+//
+#define RMCTRL_FLAGS_CLIENT_LOCK_READONLY                     0x001000000
+
+//
+//  This flag marks a control whose GSP / physical RM leg may be issued
+//  asynchronously via kgspQueueAsyncRpc(): the control has no output
+//  parameters and its caller does not depend on the physical RM status
+//  inline, so the RPC exchange can be completed from a work item after the
+//  control call has returned. The flag is informational for the routing
+//  layer; the control implementation remains responsible for queueing the
+//  deferred exchange.
+//
+#define RMCTRL_FLAGS_GSP_ASYNC_CAPABLE                        0x002000000
+
+//
+//  This control is latency-sensitive: when routed to GSP, issue it on the
+//  high-priority (task ISR) message queue instead of the shared task RM
+//  queue, so it is not queued behind bulk traffic.  The routing only takes
+//  effect when the high-priority queue is enabled (see
+//  kgspGetHighPriorityRpc); otherwise the control uses the regular queue.
+//
+#define RMCTRL_FLAGS_GSP_HIGH_PRIORITY                        0x004000000
+
 //
 //  'ACCESS_RIGHTS' Attribute
 //  ------------------------
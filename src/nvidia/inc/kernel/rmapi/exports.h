@@ -110,8 +110,10 @@ void        Nv01AllocMemoryWithSecInfo            (NVOS02_PARAMETERS*, API_SECUR
 void        Nv01AllocObjectWithSecInfo            (NVOS05_PARAMETERS*, API_SECURITY_INFO);
 void        Nv04AllocWithSecInfo                  (NVOS21_PARAMETERS*, API_SECURITY_INFO);
 void        Nv04AllocWithAccessSecInfo            (NVOS64_PARAMETERS*, API_SECURITY_INFO);
+void        Nv04AllocBatchWithSecInfo             (NVOS_BATCH_ALLOC_PARAMETERS*, NVOS_BATCH_ALLOC_ENTRY*, API_SECURITY_INFO);
 void        Nv01FreeWithSecInfo                   (NVOS00_PARAMETERS*, API_SECURITY_INFO);
 void        Nv04ControlWithSecInfo                (NVOS54_PARAMETERS*, API_SECURITY_INFO);
+void        Nv04ControlBatchWithSecInfo           (NVOS_BATCH_CONTROL_PARAMETERS*, NVOS_BATCH_CONTROL_ENTRY*, API_SECURITY_INFO);
 void        Nv04VidHeapControlWithSecInfo         (NVOS32_PARAMETERS*, API_SECURITY_INFO);
 void        Nv04IdleChannelsWithSecInfo           (NVOS30_PARAMETERS*, API_SECURITY_INFO);
 void        Nv04MapMemoryWithSecInfo              (NVOS33_PARAMETERS*, API_SECURITY_INFO);
@@ -86,6 +86,10 @@ typedef struct API_STATE RMAPI_PARAM_COPY;
         (paramCopy).bSizeValid     = portSafeMulU32((numElems), (sizeOfElem), &(paramCopy).paramsSize); \
     } while(0)
 
+// Pool of pre-pinned parameter buffers reused by rmapiParamsAcquire/Release
+void rmapiParamsPoolInit(void);
+void rmapiParamsPoolDestroy(void);
+
 // Routines for alloc/copyin/copyout/free sequences
 NV_STATUS rmapiParamsAcquire(RMAPI_PARAM_COPY *, NvBool);
 NV_STATUS rmapiParamsRelease(RMAPI_PARAM_COPY *);
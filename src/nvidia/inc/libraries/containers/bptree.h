@@ -0,0 +1,73 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+#ifndef _BPTREE_H_
+#define _BPTREE_H_
+
+/*********************** High-fanout B+ tree *******************************\
+*                                                                           *
+* Module: BPTREE.H                                                          *
+*       Cache-optimized B+ tree over the same caller-embedded NODE as       *
+*       btree.h. Client nodes remain the leaves; the library allocates     *
+*       high-fanout index nodes (multiple keys per node, linear intra-node  *
+*       search) so a lookup touches a handful of cache lines instead of     *
+*       one line per tree level. Intended for lookup-heavy maps with large  *
+*       entry counts; the NODE's private red-black links are repurposed as  *
+*       an ordered leaf chain, making in-order enumeration O(1) per step.   *
+*                                                                           *
+\***************************************************************************/
+
+#include "nvtypes.h"
+#include "nvstatus.h"
+#include "containers/btree.h"
+
+// Entries per index node; sized so a node fills two 64-byte cache lines.
+#define BPTREE_WIDTH 7
+
+typedef struct BPTREE_NODE
+{
+    NvU32              level;                  // 0 for nodes referencing client NODEs
+    NvU32              count;                  // used slots in keys[]/children[]
+    NvU64              keys[BPTREE_WIDTH];     // minimum keyStart below each child
+    void              *children[BPTREE_WIDTH]; // BPTREE_NODE* (level > 0) or PNODE (level 0)
+} BPTREE_NODE;
+
+typedef struct BPTREE
+{
+    BPTREE_NODE       *pRoot;                  // NULL when the tree is empty
+} BPTREE;
+
+//---------------------------------------------------------------------------
+//
+//  Function prototypes.
+//
+//---------------------------------------------------------------------------
+
+void      bptreeInit(BPTREE *pTree);
+NV_STATUS bptreeInsert(PNODE pNode, BPTREE *pTree);
+NV_STATUS bptreeUnlink(PNODE pNode, BPTREE *pTree);
+NV_STATUS bptreeSearch(NvU64 keyOffset, PNODE *ppNode, BPTREE *pTree);
+NV_STATUS bptreeEnumStart(NvU64 keyOffset, PNODE *ppNode, BPTREE *pTree);
+NV_STATUS bptreeEnumNext(PNODE *ppNode, BPTREE *pTree);
+NV_STATUS bptreeDestroy(BPTREE *pTree);
+
+#endif // _BPTREE_H_
@@ -35,6 +35,12 @@
 
 typedef struct OBJEHEAP OBJEHEAP;
 
+//
+// Free blocks are segregated into size classes; class i holds blocks of
+// size [2^i, 2^(i+1)).  64 classes cover the full NvU64 extent space.
+//
+#define EHEAP_NUM_SIZE_CLASSES 64
+
 typedef struct EMEMBLOCK EMEMBLOCK;
 struct EMEMBLOCK
 {
@@ -47,11 +53,26 @@ struct EMEMBLOCK
     NODE       node;
     EMEMBLOCK *prevFree;
     EMEMBLOCK *nextFree;
+    EMEMBLOCK *prevFreeClass;
+    EMEMBLOCK *nextFreeClass;
     EMEMBLOCK *prev;
     EMEMBLOCK *next;
     void      *pData;
 };
 
+//
+// Per-size-class block counts and byte totals; filled in by
+// eheapGetOccupancyHistogram.  Index i covers blocks of size
+// [2^i, 2^(i+1)).
+//
+typedef struct EHEAP_OCCUPANCY_HISTOGRAM
+{
+    NvU32 numFreeBlocks[EHEAP_NUM_SIZE_CLASSES];
+    NvU64 freeBytes[EHEAP_NUM_SIZE_CLASSES];
+    NvU32 numAllocBlocks[EHEAP_NUM_SIZE_CLASSES];
+    NvU64 allocBytes[EHEAP_NUM_SIZE_CLASSES];
+} EHEAP_OCCUPANCY_HISTOGRAM;
+
 typedef NvBool EHeapOwnershipComparator(void*, void*);
 
 typedef NV_STATUS  (*EHeapDestruct)(OBJEHEAP *);
@@ -69,6 +90,7 @@ typedef NV_STATUS  (*EHeapTraverse)(OBJEHEAP *, void *pEnv, EHeapTraversalFn, Nv
 typedef NvU32      (*EHeapGetNumBlocks)(OBJEHEAP *);
 typedef NV_STATUS  (*EHeapGetBlockInfo)(OBJEHEAP *, NvU32, NVOS32_HEAP_DUMP_BLOCK *);
 typedef NV_STATUS  (*EHeapSetOwnerIsolation)(OBJEHEAP *, NvBool bEnable, NvU32 granularity);
+typedef NV_STATUS  (*EHeapGetOccupancyHistogram)(OBJEHEAP *, EHEAP_OCCUPANCY_HISTOGRAM *);
 
 struct OBJEHEAP
 {
@@ -87,6 +109,7 @@ struct OBJEHEAP
     EHeapGetNumBlocks      eheapGetNumBlocks;
     EHeapGetBlockInfo      eheapGetBlockInfo;
     EHeapSetOwnerIsolation eheapSetOwnerIsolation;
+    EHeapGetOccupancyHistogram eheapGetOccupancyHistogram;
 
     // private data
     NvU64      base;
@@ -98,6 +121,10 @@ struct OBJEHEAP
     NvU32      ownerGranularity;
     EMEMBLOCK *pBlockList;
     EMEMBLOCK *pFreeBlockList;
+    // free blocks also sit on per-size-class lists so that
+    // unconstrained allocations need not walk the address-ordered
+    // free list above.
+    EMEMBLOCK *pFreeBlockListByClass[EHEAP_NUM_SIZE_CLASSES];
     NvU32      memHandle;
     NvU32      numBlocks;
     NvU32      sizeofMemBlock;
@@ -0,0 +1,308 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+#ifndef _NV_CONTAINERS_HASHMAP_H_
+#define _NV_CONTAINERS_HASHMAP_H_
+
+// Contains mix of C/C++ declarations.
+#include "containers/type_safety.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "nvtypes.h"
+#include "nvmisc.h"
+#include "nvport/nvport.h"
+#include "utils/nvassert.h"
+
+/**
+ * @defgroup NV_CONTAINERS_HASHMAP HashMap
+ *
+ * @brief Map (unordered) from 64-bit integer keys to user-defined values.
+ *
+ * @details Open-addressing hash table with linear probing. The interface
+ * deliberately mirrors @ref NV_CONTAINERS_MAP (minus the ordered queries,
+ * which a hash table cannot answer efficiently), so maps that only need
+ * find/insert/remove/iterate can switch between the two by renaming calls.
+ * Both intrusive and non-intrusive variants are available; unlike the
+ * ordered map, the intrusive variant also requires an allocator, since the
+ * bucket array is always container-managed.
+ *
+ * - Time Complexity:
+ *  * Operations are \b O(1) amortized,
+ *  * Unless stated otherwise,
+ *  * Where N is the number of values in the map.
+ *
+ * - Memory Usage:
+ *  * \b O(N) memory is required for N values.
+ *  * The bucket array is kept at most 3/4 full and grows by doubling.
+ *  * Intrusive and non-intrusive variants are provided.
+ *    See @ref mem-ownership for further details.
+ *
+ * - Synchronization:
+ *  * \b None. The container is not thread-safe.
+ *  * Locking must be handled by the user if required.
+ *
+ * - Iteration:
+ *  * Iteration order is unspecified (bucket order, not key order).
+ *  * Removing the most recently returned value is safe during iteration;
+ *    removal leaves a tombstone and never relocates other entries.
+ *  * Insertion may rehash and thus invalidates outstanding iterators.
+ *
+ */
+
+#define MAKE_HASHMAP(mapTypeName, dataType)                                  \
+    typedef union mapTypeName##Iter                                          \
+    {                                                                        \
+        dataType *pValue;                                                    \
+        HashMapIterBase iter;                                                \
+    } mapTypeName##Iter;                                                     \
+    typedef union mapTypeName                                                \
+    {                                                                        \
+        NonIntrusiveHashMap real;                                            \
+        CONT_TAG_TYPE(HashMapBase, dataType, mapTypeName##Iter);             \
+        CONT_TAG_NON_INTRUSIVE(dataType);                                    \
+    } mapTypeName
+
+#define DECLARE_HASHMAP(mapTypeName)                                         \
+    typedef union mapTypeName##Iter mapTypeName##Iter;                       \
+    typedef union mapTypeName mapTypeName
+
+#define MAKE_INTRUSIVE_HASHMAP(mapTypeName, dataType, node)                  \
+    typedef union mapTypeName##Iter                                          \
+    {                                                                        \
+        dataType *pValue;                                                    \
+        HashMapIterBase iter;                                                \
+    } mapTypeName##Iter;                                                     \
+    typedef union mapTypeName                                                \
+    {                                                                        \
+        IntrusiveHashMap real;                                               \
+        CONT_TAG_TYPE(HashMapBase, dataType, mapTypeName##Iter);             \
+        CONT_TAG_INTRUSIVE(dataType, node);                                  \
+    } mapTypeName
+
+#define DECLARE_INTRUSIVE_HASHMAP(mapTypeName)                               \
+    typedef union mapTypeName##Iter mapTypeName##Iter;                       \
+    typedef union mapTypeName mapTypeName
+
+/**
+ * @brief Internal node structure to embed within intrusive hash map values.
+ */
+typedef struct HashMapNode HashMapNode;
+
+/**
+ * @brief Base type common to both intrusive and non-intrusive variants.
+ */
+typedef struct HashMapBase HashMapBase;
+
+/**
+ * @brief Non-intrusive hash map (container-managed memory).
+ */
+typedef struct NonIntrusiveHashMap NonIntrusiveHashMap;
+
+/**
+ * @brief Intrusive hash map (user-managed values, container-managed buckets).
+ */
+typedef struct IntrusiveHashMap IntrusiveHashMap;
+
+/**
+ * @brief Single bucket of the open-addressing table.
+ *
+ * Keys are duplicated into the bucket so probing never dereferences the
+ * value. pNode is NULL for never-used buckets and a tombstone sentinel for
+ * deleted ones.
+ */
+typedef struct HashMapBucket HashMapBucket;
+
+/**
+ * @brief Iterator over hash map values, in unspecified (bucket) order.
+ *
+ * See @ref iterators for usage details.
+ */
+typedef struct HashMapIterBase HashMapIterBase;
+
+struct HashMapNode
+{
+    /// @privatesection
+    NvU64           key;
+#if PORT_IS_CHECKED_BUILD
+    HashMapBase    *pMap;
+#endif
+};
+
+struct HashMapBucket
+{
+    /// @privatesection
+    NvU64           key;
+    HashMapNode    *pNode;
+};
+
+struct HashMapIterBase
+{
+    void           *pValue;
+    HashMapBase    *pMap;
+    NvU32           nextBucket;
+    NvU32           lastBucket;
+#if PORT_IS_CHECKED_BUILD
+    NvU32           versionNumber;
+    NvBool          bValid;
+#endif
+};
+
+HashMapIterBase hashmapIterRangeIndex_IMPL(HashMapBase *pMap,
+                                           NvU64 first, NvU64 last);
+CONT_VTABLE_DECL(HashMapBase, HashMapIterBase);
+
+struct HashMapBase
+{
+    CONT_VTABLE_FIELD(HashMapBase);
+    HashMapBucket      *pBuckets;
+    PORT_MEM_ALLOCATOR *pAllocator;
+    NvU32               capacity;   // Power of two; 0 until first insert
+    NvU32               count;
+    NvU32               tombstones;
+    NvS32               nodeOffset;
+#if PORT_IS_CHECKED_BUILD
+    NvU32               versionNumber;
+#endif
+};
+
+struct NonIntrusiveHashMap
+{
+    HashMapBase         base;
+    NvU32               valueSize;
+};
+
+struct IntrusiveHashMap
+{
+    HashMapBase         base;
+};
+
+#define hashmapInit(pMap, pAllocator)                                        \
+    hashmapInit_IMPL(&((pMap)->real), pAllocator, sizeof(*(pMap)->valueSize))
+
+#define hashmapInitIntrusive(pMap, pAllocator)                               \
+    hashmapInitIntrusive_IMPL(&((pMap)->real), pAllocator,                   \
+        sizeof(*(pMap)->nodeOffset))
+
+#define hashmapDestroy(pMap)                                                 \
+    CONT_DISPATCH_ON_KIND(pMap,                                              \
+        hashmapDestroy_IMPL((NonIntrusiveHashMap*)&((pMap)->real)),          \
+        hashmapDestroyIntrusive_IMPL(&((pMap)->real.base)),                  \
+        contDispatchVoid_STUB())
+
+#define hashmapCount(pMap)                                                   \
+    hashmapCount_IMPL(&((pMap)->real).base)
+
+#define hashmapKey(pMap, pValue)                                             \
+    hashmapKey_IMPL(&((pMap)->real).base, pValue)
+
+#define hashmapInsertNew(pMap, key)                                          \
+    CONT_CAST_ELEM(pMap,                                                     \
+        hashmapInsertNew_IMPL(&(pMap)->real, key), hashmapIsValid_IMPL)
+
+#define hashmapInsertValue(pMap, key, pValue)                                \
+    CONT_CAST_ELEM(pMap,                                                     \
+        hashmapInsertValue_IMPL(&(pMap)->real, key,                          \
+            CONT_CHECK_ARG(pMap, pValue)), hashmapIsValid_IMPL)
+
+#define hashmapInsertExisting(pMap, key, pValue)                             \
+    hashmapInsertExisting_IMPL(&(pMap)->real, key,                           \
+        CONT_CHECK_ARG(pMap, pValue))
+
+#define hashmapRemove(pMap, pValue)                                          \
+    CONT_DISPATCH_ON_KIND(pMap,                                              \
+        hashmapRemove_IMPL((NonIntrusiveHashMap*)&((pMap)->real),            \
+            CONT_CHECK_ARG(pMap, pValue)),                                   \
+        hashmapRemoveIntrusive_IMPL(&((pMap)->real).base,                    \
+            CONT_CHECK_ARG(pMap, pValue)),                                   \
+        contDispatchVoid_STUB())
+
+#define hashmapClear(pMap)                                                   \
+    hashmapDestroy(pMap)
+
+#define hashmapRemoveByKey(pMap, key)                                        \
+    CONT_DISPATCH_ON_KIND(pMap,                                              \
+        hashmapRemoveByKey_IMPL((NonIntrusiveHashMap*)&((pMap)->real), key), \
+        hashmapRemoveByKeyIntrusive_IMPL(&((pMap)->real).base, key),         \
+        contDispatchVoid_STUB())
+
+#define hashmapFind(pMap, key)                                               \
+    CONT_CAST_ELEM(pMap,                                                     \
+        hashmapFind_IMPL(&((pMap)->real).base, key), hashmapIsValid_IMPL)
+
+#define hashmapIterAll(pMap)                                                 \
+    CONT_ITER_RANGE_INDEX(pMap, &hashmapIterRangeIndex_IMPL,                 \
+        0, NV_U64_MAX, hashmapIsValid_IMPL)
+
+#define hashmapIterNext(pIt)                                                 \
+    hashmapIterNext_IMPL(&((pIt)->iter))
+
+void hashmapInit_IMPL(NonIntrusiveHashMap *pMap,
+                      PORT_MEM_ALLOCATOR *pAllocator, NvU32 valueSize);
+void hashmapInitIntrusive_IMPL(IntrusiveHashMap *pMap,
+                               PORT_MEM_ALLOCATOR *pAllocator,
+                               NvS32 nodeOffset);
+void hashmapDestroy_IMPL(NonIntrusiveHashMap *pMap);
+void hashmapDestroyIntrusive_IMPL(HashMapBase *pMap);
+
+NvU32 hashmapCount_IMPL(HashMapBase *pMap);
+NvU64 hashmapKey_IMPL(HashMapBase *pMap, void *pValue);
+
+void *hashmapInsertNew_IMPL(NonIntrusiveHashMap *pMap, NvU64 key);
+void *hashmapInsertValue_IMPL(NonIntrusiveHashMap *pMap, NvU64 key,
+                              const void *pValue);
+NvBool hashmapInsertExisting_IMPL(IntrusiveHashMap *pMap, NvU64 key,
+                                  void *pValue);
+void hashmapRemove_IMPL(NonIntrusiveHashMap *pMap, void *pValue);
+void hashmapRemoveIntrusive_IMPL(HashMapBase *pMap, void *pValue);
+void hashmapRemoveByKey_IMPL(NonIntrusiveHashMap *pMap, NvU64 key);
+void hashmapRemoveByKeyIntrusive_IMPL(HashMapBase *pMap, NvU64 key);
+
+void *hashmapFind_IMPL(HashMapBase *pMap, NvU64 key);
+
+NvBool hashmapIterNext_IMPL(HashMapIterBase *pIt);
+
+static NV_FORCEINLINE HashMapNode *
+hashmapValueToNode(HashMapBase *pMap, void *pValue)
+{
+    if (NULL == pMap) return NULL;
+    if (NULL == pValue) return NULL;
+    return (HashMapNode*)((NvU8*)pValue + pMap->nodeOffset);
+}
+
+static NV_FORCEINLINE void *
+hashmapNodeToValue(HashMapBase *pMap, HashMapNode *pNode)
+{
+    if (NULL == pMap) return NULL;
+    if (NULL == pNode) return NULL;
+    return (NvU8*)pNode - pMap->nodeOffset;
+}
+
+NvBool hashmapIsValid_IMPL(void *pMap);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _NV_CONTAINERS_HASHMAP_H_
@@ -0,0 +1,111 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+#ifndef NV_CONTAINERS_MPSC_RINGBUF_H
+#define NV_CONTAINERS_MPSC_RINGBUF_H
+
+#include "nvtypes.h"
+#include "nvstatus.h"
+#include "nvmisc.h"
+#include "nvctassert.h"
+#include "utils/nvassert.h"
+#include "nvport/nvport.h"
+#include "containers/type_safety.h"
+
+/**
+ * @defgroup NV_CONTAINERS_MPSC_RINGBUF MpscRingBuf
+ *
+ * @brief Lock-free multi-producer single-consumer ring buffer.
+ *
+ * @details Unlike @ref NV_CONTAINERS_RINGBUF, which requires external locking,
+ * this variant allows any number of concurrent producers and exactly one
+ * consumer (at a time) without a lock. Each slot carries a sequence number
+ * that encodes whether it is free or holds a published element:
+ *
+ *  - A producer claims a slot by compare-and-swapping head forward, copies
+ *    its element in, then publishes the slot by advancing the slot sequence.
+ *  - The consumer reads the sequence of the slot at tail; a published
+ *    sequence means the element copy is complete and safe to read.
+ *
+ * Because readiness travels with the slot, producers never read tail and the
+ * consumer never reads head, so the counters do not bounce between producer
+ * and consumer cores; head and tail additionally live on separate cache
+ * lines. Elements are copied in and out rather than returned by pointer,
+ * since a popped slot is immediately reusable by producers.
+ *
+ * Push fails (returns NV_FALSE) when the ring is full; there is no overwrite
+ * mode. Pop fails when the ring is empty or the oldest slot is still being
+ * written. Storage is allocated at construction and is a power-of-two number
+ * of slots.
+ */
+
+typedef struct MpscRingBufBase
+{
+    volatile NvU64 head;     // next slot index producers will claim
+    NvU8           pad0[56]; // keep producer traffic off the consumer's line
+    volatile NvU64 tail;     // next slot index the consumer will read
+    NvU8           pad1[56];
+    NvU64          logSz;
+    NvU64          eleSz;    // payload bytes per element
+    NvU64          stride;   // slot bytes: sequence word + aligned payload
+    NvU8          *arr;
+} MpscRingBufBase;
+
+#define MPSC_RINGBUF_ARRAY_SIZE(pBase) (1llu << ((pBase)->logSz))
+
+#define MPSC_RINGBUF_ARRAY_MASK(pBase) (MPSC_RINGBUF_ARRAY_SIZE(pBase) - 1llu)
+
+#define MAKE_MPSC_RINGBUF(containedType, outputType) \
+    typedef union outputType {                       \
+        struct {                                     \
+            MpscRingBufBase base;                    \
+            PORT_MEM_ALLOCATOR *pAllocator;          \
+        };                                           \
+        containedType *elem;                         \
+    } outputType
+
+#define mpscRingbufConstruct(pBuf, logSz, pAlloc)                         \
+    ((pBuf)->pAllocator = (pAlloc),                                       \
+     mpscRingbufConstruct_IMPL(&((pBuf)->base), logSz,                    \
+                               sizeof(*((pBuf)->elem)), pAlloc))
+
+#define mpscRingbufDestruct(pBuf) \
+    mpscRingbufDestruct_IMPL(&((pBuf)->base), (pBuf)->pAllocator)
+
+#define mpscRingbufPush(pBuf, pEle) \
+    mpscRingbufPush_IMPL(&((pBuf)->base), (NvU8*)(pEle))
+
+#define mpscRingbufPop(pBuf, pEleOut) \
+    mpscRingbufPop_IMPL(&((pBuf)->base), (NvU8*)(pEleOut))
+
+#define mpscRingbufCurrentSize(pBuf) \
+    mpscRingbufCurrentSize_IMPL(&((pBuf)->base))
+
+NvBool mpscRingbufConstruct_IMPL(MpscRingBufBase *pBase, NvU64 logSz,
+                                 NvU64 eleSz, PORT_MEM_ALLOCATOR *pAlloc);
+void mpscRingbufDestruct_IMPL(MpscRingBufBase *pBase,
+                              PORT_MEM_ALLOCATOR *pAlloc);
+NvBool mpscRingbufPush_IMPL(MpscRingBufBase *pBase, NvU8 *pEle);
+NvBool mpscRingbufPop_IMPL(MpscRingBufBase *pBase, NvU8 *pEleOut);
+NvU64 mpscRingbufCurrentSize_IMPL(MpscRingBufBase *pBase);
+
+#endif // NV_CONTAINERS_MPSC_RINGBUF_H
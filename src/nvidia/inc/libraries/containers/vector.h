@@ -48,8 +48,18 @@ extern "C" {
  *
  * - Memory Usage:
  *  * \b O(N) memory is required for N values.
+ *  * @ref MAKE_INLINE_VECTOR embeds storage for a fixed number of elements
+ *    in the vector object itself; no heap allocation occurs until the
+ *    vector outgrows it, and @ref vectTrim moves elements back inline when
+ *    they fit again.
  *  * See @ref mem-ownership for further details.
  *
+ * - Growth:
+ *  * Insertion beyond capacity grows geometrically, by a factor of 2 unless
+ *    overridden with @ref vectSetGrowthPercent.
+ *  * @ref vectReserve allocates exactly the requested capacity, with no
+ *    growth factor applied.
+ *
  * - Synchronization:
  *  * \b None. The container is not thread-safe.
  *  * Locking must be handled by the user if required.
@@ -73,6 +83,32 @@ extern "C" {
     typedef union vectTypeName##Iter vectTypeName##Iter; \
     typedef union vectTypeName       vectTypeName
 
+/**
+ * Vector with storage for inlineSz elements embedded in the object itself.
+ * Initialize with @ref vectInitInline; all other operations are shared with
+ * @ref MAKE_VECTOR vectors.
+ */
+#define MAKE_INLINE_VECTOR(vectTypeName, dataType, inlineSz) \
+    typedef union vectTypeName##Iter                         \
+    {                                                        \
+        dataType      *pValue;                               \
+        VectorIterBase iter;                                 \
+    } vectTypeName##Iter;                                    \
+    typedef struct vectTypeName                              \
+    {                                                        \
+        union                                                \
+        {                                                    \
+            VectorWrapper real;                              \
+            CONT_TAG_TYPE(Vector, dataType, vectTypeName##Iter); \
+            CONT_TAG_NON_INTRUSIVE(dataType);                \
+        };                                                   \
+        dataType inlineStorage[inlineSz];                    \
+    } vectTypeName
+
+#define DECLARE_INLINE_VECTOR(vectTypeName)              \
+    typedef union vectTypeName##Iter vectTypeName##Iter; \
+    typedef struct vectTypeName      vectTypeName
+
 typedef struct Vector Vector;
 typedef struct VectorIterBase VectorIterBase;
 typedef struct VectorWrapper VectorWrapper;
@@ -105,6 +141,9 @@ struct Vector
     CONT_VTABLE_FIELD(Vector);
     void               *pHead;
     PORT_MEM_ALLOCATOR *pAllocator;
+    void               *pInlineHead;    // instantiation-embedded storage, if any
+    NvU32               inlineCapacity; // elements in pInlineHead
+    NvU32               growthPercent;  // geometric growth factor, default 200
     NvU32               valueSize;
     NvU32               capacity;
     NvU32               size;
@@ -123,6 +162,13 @@ struct VectorWrapper
                   pAllocator,                   \
                   capacity,                     \
                   sizeof(*(pVector)->valueSize))
+#define vectInitInline(pVector, pAllocator)                      \
+    vectInitInline_IMPL(&((pVector)->real.base),                 \
+                        pAllocator,                              \
+                        ((pVector)->inlineStorage),              \
+                        (NvU32)(sizeof((pVector)->inlineStorage) \
+                            / sizeof((pVector)->inlineStorage[0])), \
+                        sizeof(*(pVector)->valueSize))
 #define vectDestroy(pVector)  vectDestroy_IMPL(&((pVector)->real.base))
 #define vectClear(pVector)    vectClear_IMPL(&((pVector)->real.base))
 #define vectCount(pVector)    vectCount_IMPL(&((pVector)->real.base))
@@ -153,6 +199,8 @@ struct VectorWrapper
 #define vectReserve(pVector, size) \
     vectReserve_IMPL(&((pVector)->real.base), size)
 #define vectTrim(pVector, size) vectTrim_IMPL(&((pVector)->real.base), size)
+#define vectSetGrowthPercent(pVector, percent) \
+    vectSetGrowthPercent_IMPL(&((pVector)->real.base), percent)
 
 #define vectIterAll(pVector) \
     vectIterRangeIndex(pVector, 0, vectCount(pVector) - 1)
@@ -175,6 +223,11 @@ NV_STATUS vectInit_IMPL(Vector             *pVector,
                         PORT_MEM_ALLOCATOR *pAllocator,
                         NvU32               capacity,
                         NvU32               valueSize);
+NV_STATUS vectInitInline_IMPL(Vector             *pVector,
+                              PORT_MEM_ALLOCATOR *pAllocator,
+                              void               *pInlineStorage,
+                              NvU32               inlineCapacity,
+                              NvU32               valueSize);
 void  vectDestroy_IMPL(Vector *pVector);
 void  vectClear_IMPL(Vector *pVector);
 NvU32 vectCount_IMPL(Vector *pVector);
@@ -189,6 +242,7 @@ void *vectPrepend_IMPL(Vector *pvector, const void *pData);
 
 NV_STATUS  vectReserve_IMPL(Vector *pVector, NvU32 n);
 NV_STATUS  vectTrim_IMPL(Vector *pvector, NvU32 n);
+void       vectSetGrowthPercent_IMPL(Vector *pVector, NvU32 percent);
 
 VectorIterBase vectIterRange_IMPL(Vector *pVector, void *pFirst, void *pLast);
 NvBool vectIterNext_IMPL(VectorIterBase *pIter, void **ppValue);
@@ -167,6 +167,7 @@ typedef struct GMMU_FMT             GMMU_FMT;
 typedef struct GMMU_FMT_PDE         GMMU_FMT_PDE;
 typedef struct GMMU_FMT_PDE_MULTI   GMMU_FMT_PDE_MULTI;
 typedef struct GMMU_FMT_PTE         GMMU_FMT_PTE;
+typedef struct GMMU_FMT_PTE_ENCODER GMMU_FMT_PTE_ENCODER;
 typedef struct GMMU_COMPR_INFO      GMMU_COMPR_INFO;
 
 /*!
@@ -621,6 +622,98 @@ const GMMU_FIELD_ADDRESS *gmmuFmtPtePhysAddrFld(
                         const GMMU_FMT_PTE *pPte,
                         const GMMU_APERTURE aperture);
 
+/*!
+ * Precomputed flat PTE encoder.
+ *
+ * Collapses the generic field descriptors into plain shift/mask constants
+ * over whole 64-bit entry words, derived once per map operation from the
+ * PTE template and the address field of the target aperture.
+ * Bulk map paths use this to write entire entries in a tight loop instead
+ * of running the per-field machinery for every PTE (see goal G3 above).
+ */
+struct GMMU_FMT_PTE_ENCODER
+{
+    /*!
+     * Entry size in 64-bit words.
+     */
+    NvU32 numWords;
+
+    /*!
+     * Index of the entry word holding the physical address field.
+     */
+    NvU32 addrWord;
+
+    /*!
+     * Positive bitmask of the address field within that word.
+     */
+    NvU64 addrMask;
+
+    /*!
+     * Bit shift of the address field within that word.
+     */
+    NvU32 fieldShift;
+
+    /*!
+     * Shift applied to physical addresses before encoding.
+     */
+    NvU32 physShift;
+
+    /*!
+     * Template entry with the address field bits cleared.
+     */
+    GMMU_ENTRY_VALUE tmpl;
+};
+
+/*!
+ * Precompute a flat PTE encoder from a PTE template and address field.
+ *
+ * @param[in]  pLevel     Page table level format.
+ * @param[in]  pAddrField Physical address field of the target aperture.
+ * @param[in]  pTemplate  8-byte aligned PTE template of size
+ *                        pLevel->entrySize holding the fields constant
+ *                        across the map operation.
+ * @param[out] pEncoder   Encoder to initialize.
+ *
+ * @returns NV_TRUE if the format supports flat encoding, NV_FALSE if the
+ *          caller must fall back to the generic field setters.
+ */
+NvBool gmmuFmtPrepPteEncoder(
+            const MMU_FMT_LEVEL      *pLevel,
+            const GMMU_FIELD_ADDRESS *pAddrField,
+            const NvU8               *pTemplate,
+            GMMU_FMT_PTE_ENCODER     *pEncoder);
+
+/*!
+ * Encode one PTE as whole words from a precomputed encoder.
+ *
+ * @param[in]  pEncoder Encoder initialized by @ref gmmuFmtPrepPteEncoder.
+ * @param[in]  address  Physical address, already encoded for the aperture.
+ * @param[out] pOut     8-byte aligned entry output of
+ *                      pEncoder->numWords 64-bit words.
+ */
+static NV_FORCEINLINE void
+gmmuFmtEncodePteAddr
+(
+    const GMMU_FMT_PTE_ENCODER *pEncoder,
+    const NvU64                 address,
+    NvU64                      *pOut
+)
+{
+    NvU32 w;
+
+    NV_ASSERT_CHECKED_PRECOMP(0 ==
+        ((address >> pEncoder->physShift) &
+         ~(pEncoder->addrMask >> pEncoder->fieldShift)));
+
+    for (w = 0; w < pEncoder->numWords; ++w)
+    {
+        pOut[w] = pEncoder->tmpl.v64[w];
+    }
+    pOut[pEncoder->addrWord] |=
+        ((address >> pEncoder->physShift) << pEncoder->fieldShift) &
+        pEncoder->addrMask;
+}
+
 /*!
  * GPU compression attributes for a physical surface.
  *
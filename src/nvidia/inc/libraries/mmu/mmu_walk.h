@@ -822,6 +822,42 @@ mmuWalkCommit
     MMU_WALK *pWalk
 );
 
+/*!
+ * Begin a batch (transaction) of walk operations.
+ *
+ * Between this call and @ref mmuWalkBatchEnd the walker accumulates the
+ * union of VA ranges touched by map/unmap/sparsify operations. This lets
+ * the user issue a single flush and a single TLB invalidate covering the
+ * whole batch instead of one per operation.
+ *
+ * Batches must not be nested.
+ */
+void
+mmuWalkBatchBegin
+(
+    MMU_WALK *pWalk
+);
+
+/*!
+ * End a batch of walk operations.
+ *
+ * @param[out] pVaLo  Lower end of the VA union touched by the batch.
+ * @param[out] pVaHi  Upper end of the VA union touched by the batch.
+ *
+ * @returns NV_TRUE if any operation in the batch modified page level
+ *          entries. The user must then flush and invalidate the returned
+ *          VA range once on behalf of the whole batch. Failed operations
+ *          are reported as dirty since partial updates are unwound by
+ *          writing entries.
+ */
+NvBool
+mmuWalkBatchEnd
+(
+    MMU_WALK *pWalk,
+    NvU64    *pVaLo,
+    NvU64    *pVaHi
+);
+
 /*!
  * Get the user context of a walker state.
  */
@@ -244,6 +244,40 @@ void *portMemSet(void *pData, NvU8 value, NvLength lengthBytes);
  */
 void *portMemSetPattern(void *pData, NvLength lengthBytes, const NvU8 *pPattern, NvLength patternBytes);
 
+/**
+ * @brief Copies data between two buffers using wide accesses.
+ *
+ * Semantics are identical to @ref portMemCopy, but the copy is performed with
+ * the widest naturally aligned integer loads/stores available (64-bit), with
+ * the inner loop unrolled. Intended for large, cacheline-multiple transfers
+ * such as FB save/restore staging buffers and console surface restores, where
+ * the generic byte/dword loop leaves bandwidth on the table. The sequential
+ * full-width stores also combine well when pDestination is a write-combined
+ * mapping.
+ *
+ * If pDestination and pSource are mutually misaligned (different offsets
+ * within a 64-bit word), this falls back to @ref portMemCopy.
+ *
+ * @par Undefined:
+ * Behavior is undefined if memory regions referred to by pSource and
+ * pDestination overlap.
+ *
+ * @return pDestination on success, NULL if the operation failed.
+ */
+void *portMemCopyWide(void *pDestination, NvLength destSize, const void *pSource, NvLength srcSize);
+
+/**
+ * @brief Sets given memory to specified value using wide accesses.
+ *
+ * Semantics are identical to @ref portMemSet, but the fill is performed with
+ * unrolled 64-bit stores of the replicated byte value. Intended for large
+ * fills (surface clears, scrubbing staging buffers) where a byte loop is
+ * noticeably slower.
+ *
+ * @return pData
+ */
+void *portMemSetWide(void *pData, NvU8 value, NvLength lengthBytes);
+
 /**
  * @brief Compares two memory regions.
  *
@@ -933,6 +967,23 @@ void portMemExUnmapIOSpace(void *addr, NvU64 byteSize);
 #endif
 #endif // !defined(PORT_MEM_TRACK_USE_LIMIT)
 
+#if !defined(PORT_MEM_USE_SLAB_CACHE)
+/**
+ * @brief Cache hot fixed-size allocations in sharded magazines
+ *
+ * Small @ref portMemAllocNonPaged requests are served from per-shard free
+ * lists with batch refill, so allocation-heavy paths do not contend on the
+ * underlying OS allocator. Shards are selected by hashing the current thread
+ * id, which approximates per-CPU behavior for kernel threads. Requires the
+ * THREAD module and thread safe allocations.
+ *
+ * Default is on wherever those requirements are met, except LibOS, where
+ * allocations are single-threaded and memory is at a premium.
+ */
+#define PORT_MEM_USE_SLAB_CACHE \
+    (PORT_IS_MODULE_SUPPORTED(thread) && !NVOS_IS_LIBOS)
+#endif
+
 // Memory tracking header can redefine some functions declared here.
 #include "nvport/inline/memory_tracking.h"
 
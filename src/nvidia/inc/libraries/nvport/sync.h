@@ -761,6 +761,111 @@ NV_STATUS portSyncExFastMutexInitialize(PORT_MUTEX *pMutex);
 #define portSyncExFastMutexCreate_SUPPORTED      (PORT_IS_KERNEL_BUILD && NVOS_IS_WINDOWS)
 #define portSyncExFastMutexInitialize_SUPPORTED  (PORT_IS_KERNEL_BUILD && NVOS_IS_WINDOWS)
 
+/**
+ * @brief Acquires a mutex, spinning briefly before sleeping.
+ *
+ * Behaves like @ref portSyncMutexAcquire, but retries a bounded number of
+ * conditional acquires with CPU-relax pauses in between before falling back
+ * to the blocking acquire. Critical sections that last tens of nanoseconds
+ * are usually over before the spin budget is exhausted, so the acquiring
+ * thread avoids the sleep/wake round trip entirely.
+ *
+ * Any @ref PORT_MUTEX can be acquired adaptively; no special initialization
+ * is needed, and the mutex is released with @ref portSyncMutexRelease as
+ * usual.
+ *
+ * @pre Windows: IRQL <= APC_LEVEL
+ * @pre Unix:    Non-interrupt context
+ * @note May put the thread to sleep.
+ */
+void portSyncExAdaptiveMutexAcquire(PORT_MUTEX *pMutex);
+// Implemented in sync_common.h on top of the core primitives.
+#define portSyncExAdaptiveMutexAcquire_SUPPORTED PORT_IS_KERNEL_BUILD
+
+/**
+ * @brief A reader-writer lock optimized for read-mostly usage.
+ *
+ * Unlike @ref PORT_RWLOCK, readers synchronize through per-shard counters
+ * (shards are selected by hashing the current thread id, approximating a
+ * per-CPU split), so concurrent read acquires do not contend on a shared
+ * cache line. The price is a much more expensive write acquire, which must
+ * visit every shard and wait for all readers to drain; use this lock only
+ * when writes are rare.
+ *
+ * The same rules as for @ref PORT_RWLOCK apply: the lock is not recursive,
+ * acquire and release must happen on the same thread, and lock upgrades are
+ * not supported. Both read and write acquires may put the thread to sleep,
+ * and writers are not starved: once a write acquire begins, new readers
+ * queue behind it.
+ */
+typedef struct PORT_READ_MOSTLY_RWLOCK PORT_READ_MOSTLY_RWLOCK;
+
+/**
+ * @brief Creates and initializes a new read-mostly RWLock using the provided
+ * allocator. Destroy with @ref portSyncExReadMostlyRwLockDestroy.
+ *
+ * @return NULL on failed allocation / initialization.
+ *
+ * @pre Unix: Non-interrupt context
+ */
+PORT_READ_MOSTLY_RWLOCK *portSyncExReadMostlyRwLockCreate(PORT_MEM_ALLOCATOR *pAllocator);
+/**
+ * @brief Destroys a lock created with @ref portSyncExReadMostlyRwLockCreate,
+ * freeing its memory.
+ *
+ * @pre Unix: Non-interrupt context
+ */
+void portSyncExReadMostlyRwLockDestroy(PORT_READ_MOSTLY_RWLOCK *pLock);
+/**
+ * @brief Acquires the read (shared) lock; sleeps while a writer is active.
+ *
+ * @pre Unix: Non-interrupt context
+ * @note May put the thread to sleep.
+ */
+void portSyncExReadMostlyRwLockAcquireRead(PORT_READ_MOSTLY_RWLOCK *pLock);
+/**
+ * @brief Conditionally acquires the read (shared) lock.
+ *
+ * @return NV_TRUE if the lock was acquired.
+ *
+ * @pre Unix: Non-interrupt context
+ * @note Will not put the thread to sleep.
+ */
+NvBool NV_FORCERESULTCHECK portSyncExReadMostlyRwLockAcquireReadConditional(PORT_READ_MOSTLY_RWLOCK *pLock);
+/**
+ * @brief Acquires the write (exclusive) lock; sleeps until all readers drain.
+ *
+ * @pre Unix: Non-interrupt context
+ * @note May put the thread to sleep.
+ */
+void portSyncExReadMostlyRwLockAcquireWrite(PORT_READ_MOSTLY_RWLOCK *pLock);
+/**
+ * @brief Conditionally acquires the write (exclusive) lock.
+ *
+ * @return NV_TRUE if the lock was acquired.
+ *
+ * @pre Unix: Non-interrupt context
+ * @note Will not put the thread to sleep.
+ */
+NvBool NV_FORCERESULTCHECK portSyncExReadMostlyRwLockAcquireWriteConditional(PORT_READ_MOSTLY_RWLOCK *pLock);
+/**
+ * @brief Releases the read (shared) lock.
+ *
+ * @pre Unix: Non-interrupt context
+ * @note Will not put the thread to sleep.
+ */
+void portSyncExReadMostlyRwLockReleaseRead(PORT_READ_MOSTLY_RWLOCK *pLock);
+/**
+ * @brief Releases the write (exclusive) lock.
+ *
+ * @pre Unix: Non-interrupt context
+ * @note Will not put the thread to sleep.
+ */
+void portSyncExReadMostlyRwLockReleaseWrite(PORT_READ_MOSTLY_RWLOCK *pLock);
+
+// Implemented in sync_common.h on top of the core primitives.
+#define portSyncExReadMostlyRwLockCreate_SUPPORTED PORT_IS_KERNEL_BUILD
+
 /**
  * @brief Returns true if it is safe to put the current thread to sleep.
  *
@@ -80,6 +80,25 @@ typedef struct poolallocHandle
 // non-intrusive list of page handles
 MAKE_LIST(PoolPageHandleList, POOLALLOC_HANDLE);
 
+/*!
+ * Magazine cache geometry. Slots are grouped into shards selected by a hash
+ * of the current thread id so that concurrent threads rarely contend on the
+ * same cache lines.
+ */
+#define POOL_MAG_SHARDS 8
+#define POOL_MAG_DEPTH  8
+
+/*!
+ * One slot of the lock-free magazine cache. Ownership of a slot is claimed
+ * by atomically moving its state from EMPTY/FULL to BUSY; the handle is only
+ * valid while the state is FULL.
+ */
+typedef struct
+{
+    volatile NvU32   state;
+    POOLALLOC_HANDLE handle;
+} POOLALLOC_MAG_SLOT;
+
 /*!
  * @brief Callback function to upstream allocators for allocating new pages
  *
@@ -133,6 +152,17 @@ typedef struct poolalloc
     NvU64              allocPageSize;    // Page size to give out
     NvU32              ratio;            // Ratio == upstreamPageSize / allocPageSize
     NvU32              flags;            // POOLALLOC_FLAGS_*
+
+    POOLALLOC_MAG_SLOT *pMagSlots;       // Lock-free magazine cache; NULL when
+                                         // _MAGAZINE_CACHE is disabled
+
+    struct
+    {
+        volatile NvU64 allocHits;        // Allocations served from the magazines
+        volatile NvU64 allocMisses;      // Allocations that fell back to the lists
+        volatile NvU64 freeHits;         // Frees cached in the magazines
+        volatile NvU64 freeMisses;       // Frees that fell back to the lists
+    } magStats;
 } POOLALLOC;
 
 
@@ -152,6 +182,19 @@ void poolAllocPrint(POOLALLOC *pPool);
 #define NV_RMPOOL_FLAGS_AUTO_POPULATE_DISABLE 0x0
 #define NV_RMPOOL_FLAGS_AUTO_POPULATE_ENABLE  0x1
 
+/*!
+ * If _MAGAZINE_CACHE is set to ENABLE, the pool keeps a small lock-free cache
+ * of recently freed pages. @ref poolAllocateFromMagazine and
+ * @ref poolFreeToMagazine can then recycle pages without any external
+ * serialization, so callers can skip their pool lock on cache hits. Cached
+ * pages stay claimed in the backing pool nodes until they are recycled or
+ * flushed with @ref poolMagazineFlushAll.
+ */
+#define NV_RMPOOL_FLAGS_MAGAZINE_CACHE         2:2
+#define NV_RMPOOL_FLAGS_MAGAZINE_CACHE_DEFAULT 0x0
+#define NV_RMPOOL_FLAGS_MAGAZINE_CACHE_DISABLE 0x0
+#define NV_RMPOOL_FLAGS_MAGAZINE_CACHE_ENABLE  0x1
+
 /*!
  * @brief This function initializes a pool allocator object
  *
@@ -271,6 +314,49 @@ NV_STATUS poolAllocateContig(POOLALLOC *pPool, NvU32 numPages, PoolPageHandleLis
  */
 void poolFree(POOLALLOC *pPool, POOLALLOC_HANDLE *pPageHandle);
 
+/*!
+ * @brief Tries to satisfy a single-page allocation from the magazine cache.
+ *
+ * Lock-free: safe to call without holding the caller's pool lock, including
+ * concurrently with the locked list paths.
+ *
+ * @param[in]   pPool       The pool allocator
+ * @param[out]  pPageHandle Receives the recycled page on a hit
+ *
+ * @return NV_TRUE on a magazine hit, NV_FALSE if the caller must fall back
+ *         to @ref poolAllocate under its lock
+ */
+NvBool poolAllocateFromMagazine(POOLALLOC *pPool, POOLALLOC_HANDLE *pPageHandle);
+
+/*!
+ * @brief Tries to cache a freed page in the magazine cache.
+ *
+ * Lock-free: safe to call without holding the caller's pool lock. The page
+ * stays claimed in its backing pool node until recycled or flushed.
+ *
+ * @param[in]   pPool       The pool allocator
+ * @param[in]   pPageHandle The page being freed
+ *
+ * @return NV_TRUE if the page was cached, NV_FALSE if the caller must fall
+ *         back to @ref poolFree under its lock
+ */
+NvBool poolFreeToMagazine(POOLALLOC *pPool, POOLALLOC_HANDLE *pPageHandle);
+
+/*!
+ * @brief Returns all magazine-cached pages to the pool's lists.
+ *
+ * Must be called with the same serialization as @ref poolFree. Needed before
+ * any operation that expects the lists to account for every free page (e.g.
+ * draining a pool hierarchy).
+ */
+void poolMagazineFlushAll(POOLALLOC *pPool);
+
+/*!
+ * @brief Returns the magazine hit/miss counters, any pointer may be NULL.
+ */
+void poolMagazineGetStats(POOLALLOC *pPool, NvU64 *pAllocHits,
+                          NvU64 *pAllocMisses, NvU64 *pFreeHits,
+                          NvU64 *pFreeMisses);
 
 /*!
  * @brief Destroys the pool allocator and frees memory
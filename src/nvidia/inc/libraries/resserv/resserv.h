@@ -30,6 +30,7 @@
 
 #include "containers/list.h"
 #include "containers/map.h"
+#include "containers/hashmap.h"
 #include "containers/multimap.h"
 
 #include "nvtypes.h"
@@ -155,6 +156,14 @@ typedef void *PUID_TOKEN;
 #define RS_CLIENT_HANDLE_BUCKET_COUNT   0x400  // 1024
 #define RS_CLIENT_HANDLE_BUCKET_MASK    0x3FF
 
+//
+// Client bucket lists are striped over this many rwlocks so client
+// creation/teardown in one shard does not stall handle lookups in others.
+// Must be a power of two no larger than RS_CLIENT_HANDLE_BUCKET_COUNT.
+//
+#define RS_CLIENT_LOCK_SHARD_COUNT      0x40   // 64
+#define RS_CLIENT_LOCK_SHARD_MASK       0x3F
+
 
 /// The default maximum number of domains a resource server can allocate
 #define RS_MAX_DOMAINS_DEFAULT          4096
@@ -180,6 +189,7 @@ typedef void *PUID_TOKEN;
 #define RS_LOCK_STATE_ALLOW_RECURSIVE_RES_LOCK NVBIT(6)
 #define RS_LOCK_STATE_CLIENT_LOCK_ACQUIRED     NVBIT(7)
 #define RS_LOCK_STATE_SESSION_LOCK_ACQUIRED    NVBIT(8)
+#define RS_LOCK_STATE_CLIENT_LOCK_READ         NVBIT(9)
 
 /// RS_LOCK_RELEASE
 #define RS_LOCK_RELEASE_TOP_LOCK               NVBIT(0)
@@ -84,6 +84,29 @@ void rsAccessGetAvailableRights(RsResourceRef *pResourceRef, RsClient *pClient,
 NV_STATUS rsAccessCheckRights(RsResourceRef *pResourceRef, RsClient *pInvokingClient,
                               const RS_ACCESS_MASK *pRightsRequired);
 
+/*!
+ * @brief Returns the current global share policy generation
+ *
+ * The generation is bumped whenever any share policy list changes, so cached
+ * access decisions (RsClient::accessCache) can compare against it to detect
+ * that a previously computed verdict may no longer hold.
+ *
+ * @return The current generation value
+ */
+NvU32 rsAccessGetShareGeneration(void);
+
+/*!
+ * @brief Advances the global share policy generation
+ *
+ * Must be called on any event that can change the outcome of shared-rights
+ * evaluation outside of rsShareListInsert/rsShareListRemove (which bump the
+ * generation themselves), e.g. client teardown, where a client handle that
+ * cached decisions name as the resource owner can be reused.
+ *
+ * @return none
+ */
+void rsAccessBumpShareGeneration(void);
+
 /*!
  * @brief Update what access rights are currently owned on a target resource
  *        based on the target resource's current privilege.
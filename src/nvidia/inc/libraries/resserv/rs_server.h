@@ -135,7 +135,8 @@ struct RsServer
     NvBool                    bConstructed; ///< Determines whether the server is ready to be used
     PORT_MEM_ALLOCATOR       *pAllocator; ///< Allocator to use for all objects allocated by the server
 
-    PORT_RWLOCK              *pClientListLock; ///< Lock that needs to be taken when accessing the client list
+    PORT_RWLOCK             **pClientShardLocks; ///< Striped locks (RS_CLIENT_LOCK_SHARD_COUNT) protecting the client bucket lists
+    NvU64                    *pClientHandleIndexBitmap; ///< One bit per client handle index (RS_CLIENT_HANDLE_MAX); set while any client entry uses the index
 
     PORT_SPINLOCK            *pShareMapLock; ///< Lock that needs to be taken when accessing the shared resource map
     RsSharedMap               shareMap; ///< Map of shared resources
@@ -172,6 +173,12 @@ struct RsServer
      */
     NvU32                     roTopLockApiMask;
 
+    /**
+     * Mask of interfaces (RS_API_*) that may use a read-only client lock for
+     * calls explicitly marked as read-only
+     */
+    NvU32                     roClientLockApiMask;
+
     /// Share policies which clients default to when no other policies are used
     RsShareList               defaultInheritedSharePolicyList;
     /// Share policies to apply to all shares, regardless of other policies
@@ -214,6 +214,21 @@ struct NV_BITVECTOR
     bitVectorCountSetBits_IMPL(&((pBitVector)->real),                       \
                                sizeof(((pBitVector)->last->_)))
 
+#define bitVectorCountSetBitsRange(pBitVector, range)                       \
+    bitVectorCountSetBitsRange_IMPL(&((pBitVector)->real),                  \
+                                    sizeof(((pBitVector)->last->_)),        \
+                                    (range))
+
+#define bitVectorFindNextSet(pBitVector, startIdx)                          \
+    bitVectorFindNextSet_IMPL(&((pBitVector)->real),                        \
+                              sizeof(((pBitVector)->last->_)),              \
+                              (startIdx))
+
+#define bitVectorFindNextClear(pBitVector, startIdx)                        \
+    bitVectorFindNextClear_IMPL(&((pBitVector)->real),                      \
+                                sizeof(((pBitVector)->last->_)),            \
+                                (startIdx))
+
 #define bitVectorToRaw(pBitVector, pRawMask, rawMaskSize)                   \
     bitVectorToRaw_IMPL(&((pBitVector)->real),                              \
                         sizeof(((pBitVector)->last->_)),                    \
@@ -230,10 +245,9 @@ struct NV_BITVECTOR
     {                                                                       \
         MAKE_ANON_BITVECTOR(sizeof(((pBitVector)->last->_))) localMask;     \
         bitVectorCopy(&localMask, (pBitVector));                            \
-        for ((index) = bitVectorCountTrailingZeros(&localMask);             \
-             !bitVectorTestAllCleared(&localMask);                          \
-             bitVectorClr(&localMask, (index)),                             \
-             (index) = bitVectorCountTrailingZeros(&localMask))             \
+        for ((index) = bitVectorFindNextSet(&localMask, 0);                 \
+             (index) < sizeof(((pBitVector)->last->_));                     \
+             (index) = bitVectorFindNextSet(&localMask, (index) + 1))       \
         {
 
 #define FOR_EACH_IN_BITVECTOR_END()                                         \
@@ -246,20 +260,35 @@ struct NV_BITVECTOR
         bitVectorCopy(&localMaskA, (pBitVectorA));                           \
         MAKE_ANON_BITVECTOR(sizeof(((pBitVectorB)->last->_))) localMaskB;    \
         bitVectorCopy(&localMaskB, (pBitVectorB));                           \
-        for ((indexA) = bitVectorCountTrailingZeros(&localMaskA),            \
-             (indexB) = bitVectorCountTrailingZeros(&localMaskB);            \
-             !bitVectorTestAllCleared(&localMaskA) &&                        \
-             !bitVectorTestAllCleared(&localMaskB);                          \
-             bitVectorClr(&localMaskA, (indexA)),                            \
-             bitVectorClr(&localMaskB, (indexB)),                            \
-             (indexA) = bitVectorCountTrailingZeros(&localMaskA),            \
-             (indexB) = bitVectorCountTrailingZeros(&localMaskB))            \
+        for ((indexA) = bitVectorFindNextSet(&localMaskA, 0),                \
+             (indexB) = bitVectorFindNextSet(&localMaskB, 0);                \
+             ((indexA) < sizeof(((pBitVectorA)->last->_))) &&                \
+             ((indexB) < sizeof(((pBitVectorB)->last->_)));                  \
+             (indexA) = bitVectorFindNextSet(&localMaskA, (indexA) + 1),     \
+             (indexB) = bitVectorFindNextSet(&localMaskB, (indexB) + 1))     \
         {
 
 #define FOR_EACH_IN_BITVECTOR_PAIR_END()                                    \
         }                                                                   \
     }
 
+//
+// Iterates over the set flags of the intersection of two bitvectors of the
+// same type, without materializing the intersection at each step.
+//
+#define FOR_EACH_IN_BITVECTOR_AND(pBitVectorA, pBitVectorB, index)          \
+    {                                                                       \
+        MAKE_ANON_BITVECTOR(sizeof(((pBitVectorA)->last->_))) localMask;    \
+        bitVectorAnd(&localMask, (pBitVectorA), (pBitVectorB));             \
+        for ((index) = bitVectorFindNextSet(&localMask, 0);                 \
+             (index) < sizeof(((pBitVectorA)->last->_));                    \
+             (index) = bitVectorFindNextSet(&localMask, (index) + 1))       \
+        {
+
+#define FOR_EACH_IN_BITVECTOR_AND_END()                                     \
+        }                                                                   \
+    }
+
 NvU32
 bitVectorSizeOf_IMPL
 (
@@ -450,6 +479,30 @@ bitVectorCountSetBits_IMPL
     NvU16 bitVectorLast
 );
 
+NvU32
+bitVectorCountSetBitsRange_IMPL
+(
+    const NV_BITVECTOR *pBitVector,
+    NvU16 bitVectorLast,
+    NV_RANGE range
+);
+
+NvU32
+bitVectorFindNextSet_IMPL
+(
+    const NV_BITVECTOR *pBitVector,
+    NvU16 bitVectorLast,
+    NvU32 startIdx
+);
+
+NvU32
+bitVectorFindNextClear_IMPL
+(
+    const NV_BITVECTOR *pBitVector,
+    NvU16 bitVectorLast,
+    NvU32 startIdx
+);
+
 NV_STATUS
 bitVectorToRaw_IMPL
 (
@@ -0,0 +1,62 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef _NV_UTILS_NV_HASH_H_
+#define _NV_UTILS_NV_HASH_H_
+
+#include "nvtypes.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @file
+ * @brief General purpose non-cryptographic 64-bit buffer hash.
+ *
+ * Word-at-a-time alternative to the byte-at-a-time FNV-1a routines in
+ * fnv_hash.c for callers that hash in-memory keys on hot paths (lookup
+ * tables, caches) rather than matching an externally stored FNV digest.
+ */
+
+/**
+ * @brief Compute a 64-bit hash of a buffer (xxHash64).
+ *
+ * Processes the input eight bytes at a time, so it is considerably faster
+ * than fnv1Hash64() on keys more than a few bytes long. The buffer may have
+ * any alignment. Not suitable where a specific digest format is required
+ * (e.g. the NBSI table signatures, which store an FNV-1 value).
+ *
+ * @param[in] pData   Buffer to hash.
+ * @param[in] length  Length of the buffer in bytes.
+ * @param[in] seed    Seed value; use 0 unless chaining or salting.
+ *
+ * @return 64-bit hash of the buffer contents.
+ */
+NvU64 nvHash64Buf(const void *pData, NvU64 length, NvU64 seed);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _NV_UTILS_NV_HASH_H_
@@ -515,6 +515,15 @@
 #define NV_REG_STR_RM_DUMP_NVLOG_DISABLE            (0x00000000)
 #define NV_REG_STR_RM_DUMP_NVLOG_ENABLE             (0x00000001)
 
+// Type DWORD
+// Bitmask of well-known RM phases (see RM_PROF_PHASE) to instrument with
+// begin/end cycle markers aggregated into per-phase latency histograms.
+// 0 (default) leaves the phase profiler fully disabled.
+#define NV_REG_STR_RM_PHASE_PROFILER                "RMPhaseProfiler"
+#define NV_REG_STR_RM_PHASE_PROFILER_DEFAULT        (0x00000000)
+#define NV_REG_STR_RM_PHASE_PROFILER_DISABLE        (0x00000000)
+#define NV_REG_STR_RM_PHASE_PROFILER_ALL            (0xFFFFFFFF)
+
 
 //
 // Type DWORD
@@ -668,6 +677,23 @@
 #define NV_REG_STR_RM_READONLY_API_LOCK_CTRL_ENABLE               (0x00000001)
 
 
+//
+// Type DWORD: Enable read-only client locking for select RMAPI interfaces.
+// Interfaces with read-only client locking enabled will take the per-client
+// lock for read when an API call is explicitly marked as read-only (e.g.
+// controls exported with RMCTRL_FLAGS_CLIENT_LOCK_READONLY). Other calls on
+// the same interface continue to take the client lock for write.
+//
+// Setting an interface to 0 will disable read-only client locking for it
+// Setting an interface to 1 will enable read-only client locking for it
+//
+#define NV_REG_STR_RM_READONLY_CLIENT_LOCK                         "RmRoClientLock"
+#define NV_REG_STR_RM_READONLY_CLIENT_LOCK_CTRL                    0:0
+#define NV_REG_STR_RM_READONLY_CLIENT_LOCK_CTRL_DEFAULT           (0x00000001)
+#define NV_REG_STR_RM_READONLY_CLIENT_LOCK_CTRL_DISABLE           (0x00000000)
+#define NV_REG_STR_RM_READONLY_CLIENT_LOCK_CTRL_ENABLE            (0x00000001)
+
+
 //
 // Type DWORD: Enable read-only RMAPI locks for select modules
 //
@@ -708,6 +734,16 @@
 // RMCTRL cache mode defined in ctrl0000system.h
 #define NV_REG_STR_RM_CACHEABLE_CONTROLS             "RmEnableCacheableControls"
 
+// Type DWORD
+// Mirror cacheable GET_INFO-style control results into the per-GPU user
+// shared data mapping (RUSD_CTRL_CACHE in cl00de.h) so userspace can satisfy
+// repeated queries without a control call. Requires the control cache to be
+// enabled. Default is disable.
+#define NV_REG_STR_RM_CACHEABLE_CONTROLS_MIRROR              "RmCacheableControlsMirror"
+#define NV_REG_STR_RM_CACHEABLE_CONTROLS_MIRROR_DISABLE      (0x00000000)
+#define NV_REG_STR_RM_CACHEABLE_CONTROLS_MIRROR_ENABLE       (0x00000001)
+#define NV_REG_STR_RM_CACHEABLE_CONTROLS_MIRROR_DEFAULT      (0x00000000)
+
 // Type DWORD
 // This regkey forces for Maxwell+ that on FB Unload we wait for FB pull before issuing the
 // L2 clean. WAR for bug 1032432
@@ -2403,6 +2439,19 @@
 #define NV_REG_STR_RM_RELAXED_GSP_INIT_LOCKING_ENABLE       0x00000001
 #define NV_REG_STR_RM_RELAXED_GSP_INIT_LOCKING_DEFAULT      0x00000002
 
+//
+// Type: Dword
+// This regkey enables the second (task ISR) GSP message queue pair and routes
+// latency-sensitive RPCs to it, so that they are not queued behind bulk
+// traffic on the task RM queue.
+// 0 - (default) all RPCs share the task RM queue
+// 1 - latency-sensitive RPCs use the task ISR queue
+//
+#define NV_REG_STR_RM_GSP_HIGH_PRIO_RPC_QUEUE               "RmGspHighPrioRpcQueue"
+#define NV_REG_STR_RM_GSP_HIGH_PRIO_RPC_QUEUE_DISABLE       0x00000000
+#define NV_REG_STR_RM_GSP_HIGH_PRIO_RPC_QUEUE_ENABLE        0x00000001
+#define NV_REG_STR_RM_GSP_HIGH_PRIO_RPC_QUEUE_DEFAULT       NV_REG_STR_RM_GSP_HIGH_PRIO_RPC_QUEUE_DISABLE
+
 //
 // Type: Dword
 // This regkey overrides the state of the GR scrubber channel and determines
@@ -2411,4 +2460,19 @@
 #define NV_REG_STR_RM_FORCE_GR_SCRUBBER_CHANNEL             "RmForceGrScrubberChannel"
 #define NV_REG_STR_RM_FORCE_GR_SCRUBBER_CHANNEL_DISABLE     0x00000000
 #define NV_REG_STR_RM_FORCE_GR_SCRUBBER_CHANNEL_ENABLE      0x00000001
+
+//
+// Type: Dword
+// This regkey enables recycling of freed main GR context buffers. Freed
+// buffers are kept in a small per-GPU cache and handed out to new contexts
+// of the same size, skipping the multi-MB FB allocation and scrub on
+// context-heavy workloads. Context contents are always reinitialized from
+// the golden context image when the new context is promoted.
+// 0 - (default) main context buffers are freed immediately
+// 1 - main context buffers are recycled through the cache
+//
+#define NV_REG_STR_RM_GR_MAIN_CTX_BUFFER_CACHE              "RmGrMainCtxBufferCache"
+#define NV_REG_STR_RM_GR_MAIN_CTX_BUFFER_CACHE_DISABLE      0x00000000
+#define NV_REG_STR_RM_GR_MAIN_CTX_BUFFER_CACHE_ENABLE       0x00000001
+#define NV_REG_STR_RM_GR_MAIN_CTX_BUFFER_CACHE_DEFAULT      NV_REG_STR_RM_GR_MAIN_CTX_BUFFER_CACHE_DISABLE
 #endif // NVRM_REGISTRY_H
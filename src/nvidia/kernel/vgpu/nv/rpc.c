@@ -1734,6 +1734,7 @@ static NV_STATUS _issueRpcLarge
     NvU32      entryLength;
     NvU32      remainingSize = bufSize;
     NvU32      recordCount   = 0;
+    MESSAGE_QUEUE_INFO *pMQI = pRpc->pMessageQueueInfo;
 
     // should not be called in broadcast mode
     NV_ASSERT_OR_RETURN(!gpumgrGetBcEnabledStatus(pGpu), NV_ERR_INVALID_STATE);
@@ -1747,12 +1748,21 @@ static NV_STATUS _issueRpcLarge
     // Set the correct length for this queue entry.
     vgpu_rpc_message_header_v->length = entryLength;
 
+    //
+    // On GSP clients, coalesce the doorbells for the continuation records
+    // below into a single ring once the whole transfer is in the queue.
+    //
+    if (pMQI != NULL)
+        GspMsgQueueTxBatchBegin(pMQI);
+
     nvStatus = rpcSendMessage(pGpu, pRpc);
     if (nvStatus != NV_OK)
     {
         NV_PRINTF(LEVEL_ERROR, "rpcSendMessage failed with status 0x%08x for fn %d!\n",
                   nvStatus, expectedFunc);
         NV_ASSERT(0);
+        if (pMQI != NULL)
+            GspMsgQueueTxBatchEnd(pMQI, pGpu);
         //
         // It has been observed that returning NV_ERR_BUSY_RETRY in a bad state (RPC
         // buffers full and not being serviced) can make things worse, i.e. turn RPC
@@ -1790,6 +1800,8 @@ static NV_STATUS _issueRpcLarge
                       "rpcSendMessage failed with status 0x%08x for fn %d continuation record (remainingSize=0x%x)!\n",
                       nvStatus, expectedFunc, remainingSize);
             NV_ASSERT(0);
+            if (pMQI != NULL)
+                GspMsgQueueTxBatchEnd(pMQI, pGpu);
             //
             // It has been observed that returning NV_ERR_BUSY_RETRY in a bad state (RPC
             // buffers full and not being serviced) can make things worse, i.e. turn RPC
@@ -1804,6 +1816,10 @@ static NV_STATUS _issueRpcLarge
         recordCount++;
     }
 
+    // Ring the doorbell once for the whole transfer.
+    if (pMQI != NULL)
+        GspMsgQueueTxBatchEnd(pMQI, pGpu);
+
     if (!bWait)
     {
         // In case of Async RPC, we are done here.
@@ -9169,6 +9185,22 @@ NV_STATUS rpcRmApiControl_GSP
     (void) rmapiutilGetControlInfo(cmd, &ctrlFlags, &ctrlAccessRight, NULL);
     bCacheable = rmapiControlIsCacheable(ctrlFlags, ctrlAccessRight, NV_TRUE);
 
+    //
+    // Latency-sensitive controls bypass bulk traffic on the task RM queue by
+    // issuing on the high-priority (task ISR) queue, when it is enabled.
+    //
+    if (ctrlFlags & RMCTRL_FLAGS_GSP_HIGH_PRIORITY)
+    {
+        OBJRPC *pHighPrioRpc = kgspGetHighPriorityRpc(pGpu, GPU_GET_KERNEL_GSP(pGpu));
+
+        if (pHighPrioRpc != NULL)
+        {
+            pRpc = pHighPrioRpc;
+            rpc_params = &rpc_message->gsp_rm_control_v03_00;
+            message_buffer_remaining = pRpc->maxRpcSize - fixed_param_size;
+        }
+    }
+
     pCallContext = resservGetTlsCallContext();
     if (pCallContext == NULL || pCallContext->bReserialize)
     {
@@ -35,6 +35,7 @@
 #include "os/os.h"
 #include "nvrm_registry.h"
 #include "core/thread_state.h"
+#include "diagnostics/profiler.h"
 #include "diagnostics/tracer.h"
 #include "rmosxfac.h"
 #include "tls/tls.h"
@@ -408,6 +409,22 @@ _sysRegistryOverrideResourceServer
         pSys->apiLockMask = NVBIT(RS_API_CTRL);
     }
 
+    // Set read-only client lock override
+    if (osReadRegistryDword(pGpu, NV_REG_STR_RM_READONLY_CLIENT_LOCK,
+                            &data32) == NV_OK)
+    {
+        NvU32 clientMask = 0;
+
+        if (FLD_TEST_DRF(_REG_STR_RM, _READONLY_CLIENT_LOCK, _CTRL, _ENABLE, data32))
+            clientMask |= NVBIT(RS_API_CTRL);
+
+        pSys->clientLockMask = clientMask;
+    }
+    else
+    {
+        pSys->clientLockMask = NVBIT(RS_API_CTRL);
+    }
+
     if (osReadRegistryDword(pGpu, NV_REG_STR_RM_READONLY_API_LOCK_MODULE,
                             &data32) == NV_OK)
     {
@@ -563,6 +580,9 @@ coreInitializeRm(void)
         return status;
     }
 
+    // No-op unless enabled via the RMPhaseProfiler registry key
+    rmProfPhaseInit();
+
     //
     // Initialize OBJSYS which spawns all the RM internal modules
     //
@@ -588,6 +608,8 @@ coreShutdownRm(void)
     //
     nvAssertDestroy();
 
+    rmProfPhaseDestroy();
+
     DBG_DESTROY();
 
     NVLOG_DESTROY();
@@ -799,6 +821,7 @@ sysApplyLockingPolicy_IMPL(OBJSYS *pSys)
 {
     g_resServ.bRouteToPhysicalLockBypass = pSys->getProperty(pSys, PDB_PROP_SYS_ROUTE_TO_PHYSICAL_LOCK_BYPASS);
     g_resServ.roTopLockApiMask = pSys->apiLockMask;
+    g_resServ.roClientLockApiMask = pSys->clientLockMask;
 }
 
 NV_STATUS
@@ -547,8 +547,11 @@ gpuacctProcessGpuUtil
 )
 {
     GPUACCT_PROC_ENTRY *pEntry;
+    GPUACCT_PROC_ENTRY *pLastEntry = NULL;
     NV_STATUS status = NV_OK;
     NvU64 maxTimeStamp = 0;
+    NvU32 lastProcId = NV2080_GPUMON_PID_INVALID;
+    NvU32 lastSubPid = NV2080_GPUMON_PID_INVALID;
     NvU32 index;
 
     for (index = 0; index < NV2080_CTRL_PERF_GPUMON_SAMPLE_COUNT_PERFMON_UTIL; ++index)
@@ -574,11 +577,31 @@ gpuacctProcessGpuUtil
             pUtilSampleBuffer[index].gr.subProcessID != NV2080_GPUMON_PID_INVALID
         )
         {
-            // Find data store in which we should look up the PMU gr sample's pid/subpid.
-            status = gpuacctFindProcEntryFromPidSubpid(pGpuInstanceInfo,
-                                                       pUtilSampleBuffer[index].gr.procId,
-                                                       pUtilSampleBuffer[index].gr.subProcessID,
-                                                       &pEntry);
+            //
+            // Consecutive samples usually belong to the same process, so reuse
+            // the previous lookup when the pid/subpid pair repeats instead of
+            // searching the data stores for every sample.
+            //
+            if (pUtilSampleBuffer[index].gr.procId       == lastProcId &&
+                pUtilSampleBuffer[index].gr.subProcessID == lastSubPid)
+            {
+                pEntry = pLastEntry;
+                status = NV_OK;
+            }
+            else
+            {
+                // Find data store in which we should look up the PMU gr sample's pid/subpid.
+                status = gpuacctFindProcEntryFromPidSubpid(pGpuInstanceInfo,
+                                                           pUtilSampleBuffer[index].gr.procId,
+                                                           pUtilSampleBuffer[index].gr.subProcessID,
+                                                           &pEntry);
+                if (status == NV_OK)
+                {
+                    lastProcId = pUtilSampleBuffer[index].gr.procId;
+                    lastSubPid = pUtilSampleBuffer[index].gr.subProcessID;
+                    pLastEntry = pEntry;
+                }
+            }
             if (status == NV_OK && pEntry != NULL)
             {
                 pEntry->sumUtil += pUtilSampleBuffer[index].gr.util;
@@ -604,12 +627,27 @@ gpuacctProcessGpuUtil
             if (pUtilSampleBuffer[index].gr.procId       != pUtilSampleBuffer[index].fb.procId ||
                 pUtilSampleBuffer[index].gr.subProcessID != pUtilSampleBuffer[index].fb.subProcessID)
             {
-                // Find data store in which we should look up the PMU fb sample's pid/subpid.
-                pEntry = NULL;
-                status = gpuacctFindProcEntryFromPidSubpid(pGpuInstanceInfo,
-                                                           pUtilSampleBuffer[index].fb.procId,
-                                                           pUtilSampleBuffer[index].fb.subProcessID,
-                                                           &pEntry);
+                if (pUtilSampleBuffer[index].fb.procId       == lastProcId &&
+                    pUtilSampleBuffer[index].fb.subProcessID == lastSubPid)
+                {
+                    pEntry = pLastEntry;
+                    status = NV_OK;
+                }
+                else
+                {
+                    // Find data store in which we should look up the PMU fb sample's pid/subpid.
+                    pEntry = NULL;
+                    status = gpuacctFindProcEntryFromPidSubpid(pGpuInstanceInfo,
+                                                               pUtilSampleBuffer[index].fb.procId,
+                                                               pUtilSampleBuffer[index].fb.subProcessID,
+                                                               &pEntry);
+                    if (status == NV_OK)
+                    {
+                        lastProcId = pUtilSampleBuffer[index].fb.procId;
+                        lastSubPid = pUtilSampleBuffer[index].fb.subProcessID;
+                        pLastEntry = pEntry;
+                    }
+                }
             }
             if (status == NV_OK && pEntry != NULL)
             {
@@ -129,6 +129,12 @@ nvlogDestroy(void)
     NV_STATUS status = NV_OK;
     NvU32 i;
 
+    if (NvLogLogger.pushContentionCount != 0)
+    {
+        portDbgPrintf("nvrm-nvlog: ring reservation retries: %u\n",
+                      NvLogLogger.pushContentionCount);
+    }
+
     for (i = 0; i < NVLOG_MAX_BUFFERS; i++)
     {
         nvlogDeallocBuffer(i, NV_TRUE);
@@ -547,16 +553,43 @@ nvlogRingBufferPush
     NvU32 oldPos;
     NvU32 lock = DRF_VAL(LOG, _BUFFER_FLAGS, _LOCKING, pBuffer->flags);
 
-    if (lock != NVLOG_BUFFER_FLAGS_LOCKING_NONE)
-        portSyncSpinlockAcquire(NvLogLogger.mainLock);
+    if (lock == NVLOG_BUFFER_FLAGS_LOCKING_STATE)
+    {
+        //
+        // State locking only guards the position update and copies record
+        // data unlocked, so the destination range can just as well be
+        // reserved with an atomic. This keeps producers from serializing on
+        // the one global spinlock shared by every buffer in the system.
+        //
+        NvU32 newPos;
+
+        while (NV_TRUE)
+        {
+            oldPos = pBuffer->pos;
+            newPos = (oldPos + dataSize) % pBuffer->size;
+            if (portAtomicCompareAndSwapU32((volatile NvU32 *)&pBuffer->pos,
+                                            newPos, oldPos))
+            {
+                break;
+            }
+            portAtomicIncrementU32(&NvLogLogger.pushContentionCount);
+        }
 
-    oldPos = pBuffer->pos;
-    pBuffer->extra.ring.overflow += (pBuffer->pos + dataSize) / pBuffer->size;
-    pBuffer->pos                  = (pBuffer->pos + dataSize) % pBuffer->size;
+        if ((oldPos + dataSize) / pBuffer->size != 0)
+        {
+            portAtomicAddU32((volatile NvU32 *)&pBuffer->extra.ring.overflow,
+                             (oldPos + dataSize) / pBuffer->size);
+        }
+    }
+    else
+    {
+        if (lock != NVLOG_BUFFER_FLAGS_LOCKING_NONE)
+            portSyncSpinlockAcquire(NvLogLogger.mainLock);
 
-    // State locking does portMemCopy unlocked.
-    if (lock == NVLOG_BUFFER_FLAGS_LOCKING_STATE)
-        portSyncSpinlockRelease(NvLogLogger.mainLock);
+        oldPos = pBuffer->pos;
+        pBuffer->extra.ring.overflow += (pBuffer->pos + dataSize) / pBuffer->size;
+        pBuffer->pos                  = (pBuffer->pos + dataSize) % pBuffer->size;
+    }
 
     while (dataSize > 0)
     {
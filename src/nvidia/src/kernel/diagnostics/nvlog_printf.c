@@ -71,16 +71,41 @@ NvBool nvDbgBreakpointEnabled(void)
 }
 
 #if NV_PRINTF_STRINGS_ALLOWED
-static PORT_SPINLOCK *_nv_dbg_lock = NULL;
-static char   _nv_dbg_string[MAX_ERROR_STRING];
 
 //
-// nvDbgInit - Allocate the printf spinlock
+// Per-CPU-indexed staging slots used to format prints. A producer claims the
+// slot for its CPU with an atomic flag instead of serializing every print in
+// the system on one global spinlock, so concurrent prints only contend when
+// they hash to the same slot (e.g. an ISR interrupting a print on the same
+// CPU). NV_DBG_STAGING_SLOTS must be a power of two.
+//
+#define NV_DBG_STAGING_SLOTS 8
+
+typedef struct
+{
+    volatile NvU32 busy;
+    char           string[MAX_ERROR_STRING];
+} NV_DBG_STAGING_SLOT;
+
+static NV_DBG_STAGING_SLOT _nv_dbg_staging[NV_DBG_STAGING_SLOTS];
+
+//
+// Number of times a producer found its preferred slot busy. A steadily
+// climbing value means prints are contending on the staging slots.
+//
+static volatile NvU32 _nv_dbg_staging_busy;
+
+static NvBool _nv_dbg_initialized = NV_FALSE;
+
+NvU32 osGetCurrentProcessorNumber(void);
+
+//
+// nvDbgInit - Initialize the printf staging slots
 //
 NvBool
 nvDbgInit(void)
 {
-    if (NULL != _nv_dbg_lock)
+    if (_nv_dbg_initialized)
     {
         // already initialized
         return NV_TRUE;
@@ -88,23 +113,26 @@ nvDbgInit(void)
     if (portInitialize() != NV_OK)
         return NV_FALSE;
 
-    _nv_dbg_lock = portSyncSpinlockCreate(portMemAllocatorGetGlobalNonPaged());
-    if (_nv_dbg_lock == NULL)
-        return NV_FALSE;
-    else
-        return NV_TRUE;
+    portMemSet(_nv_dbg_staging, 0, sizeof(_nv_dbg_staging));
+    _nv_dbg_staging_busy = 0;
+    _nv_dbg_initialized = NV_TRUE;
+    return NV_TRUE;
 }
 
 //
-// nvDbgDestroy - Free the printf spinlock
+// nvDbgDestroy - Tear down the printf staging slots
 //
 void
 nvDbgDestroy(void)
 {
-    if (NULL != _nv_dbg_lock)
+    if (_nv_dbg_initialized)
     {
-        portSyncSpinlockDestroy(_nv_dbg_lock);
-        _nv_dbg_lock = NULL;
+        if (_nv_dbg_staging_busy != 0)
+        {
+            portDbgPrintf("NVRM: nvlog: print staging contention events: %u\n",
+                          _nv_dbg_staging_busy);
+        }
+        _nv_dbg_initialized = NV_FALSE;
         portShutdown();
     }
 }
@@ -190,12 +218,13 @@ void nvDbg_Printf
 }
 
 //
-// Internal function to prepare _nv_dbg_string for printing.
-// Should only be called while _nv_dbg_lock is held.
+// Internal function to prepare a staging slot string for printing.
+// Should only be called while the slot is claimed by this thread.
 //
 static void
 _nvDbgPrepareString
 (
+    char       *dest,
     const char *file,
     int        line,
     const char *func,
@@ -212,11 +241,11 @@ _nvDbgPrepareString
     //
     if (portStringCompare(fmt, NV_PRINTF_PREFIX, sizeof(NV_PRINTF_PREFIX) - 1) == 0)
     {
-        len = RmMsgPrefix(prefix, file, line, func, _nv_dbg_string, MAX_ERROR_STRING);
+        len = RmMsgPrefix(prefix, file, line, func, dest, MAX_ERROR_STRING);
         fmt += sizeof(NV_PRINTF_PREFIX) - 1;
     }
 
-    nvDbgVsnprintf(_nv_dbg_string + len, MAX_ERROR_STRING - len, fmt, arglist);
+    nvDbgVsnprintf(dest + len, MAX_ERROR_STRING - len, fmt, arglist);
 }
 
 //
@@ -248,15 +277,27 @@ void nvDbg_vPrintf
 
     if (nvDbg_PrintMsg(filename, linenumber, function, debuglevel, printf_format, &force, &prefix))
     {
-        portSyncSpinlockAcquire(_nv_dbg_lock);
-          _nvDbgPrepareString(filename, linenumber, function, printf_format, prefix, arglist);
+        NV_DBG_STAGING_SLOT *pSlot;
+        NvU32 slot = osGetCurrentProcessorNumber() & (NV_DBG_STAGING_SLOTS - 1);
+
+        if (!portAtomicCompareAndSwapU32(&_nv_dbg_staging[slot].busy, 1, 0))
+        {
+            portAtomicIncrementU32(&_nv_dbg_staging_busy);
+            do
+            {
+                slot = (slot + 1) & (NV_DBG_STAGING_SLOTS - 1);
+            } while (!portAtomicCompareAndSwapU32(&_nv_dbg_staging[slot].busy, 1, 0));
+        }
+        pSlot = &_nv_dbg_staging[slot];
+
+        _nvDbgPrepareString(pSlot->string, filename, linenumber, function, printf_format, prefix, arglist);
 #if PORT_IS_FUNC_SUPPORTED(portDbgExPrintfLevel)
-          portDbgExPrintfLevel(_nvDbgLevelToPlatformLevel(force, debuglevel),
-                               "%.*s", MAX_ERROR_STRING, _nv_dbg_string);
+        portDbgExPrintfLevel(_nvDbgLevelToPlatformLevel(force, debuglevel),
+                             "%.*s", MAX_ERROR_STRING, pSlot->string);
 #else
-          portDbgPrintString(_nv_dbg_string, MAX_ERROR_STRING);
+        portDbgPrintString(pSlot->string, MAX_ERROR_STRING);
 #endif
-        portSyncSpinlockRelease(_nv_dbg_lock);
+        portAtomicSetU32(&pSlot->busy, 0);
     }
 }
 
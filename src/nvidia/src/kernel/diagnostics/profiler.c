@@ -29,9 +29,19 @@
 
 #include "diagnostics/profiler.h"
 #include "os/os.h"
+#include "nvrm_registry.h"
 
 static void _rmProfStopTime(RM_PROF_STATS *pStats, NvU64 stop_ns);
 
+//
+// Shared page holding the per-phase histograms. NULL unless the phase
+// profiler was enabled via the RMPhaseProfiler registry key, so disabled
+// builds pay only a NULL check per marker.
+//
+static RM_PROF_PHASE_PAGE *s_pProfPhasePage;
+
+ct_assert(sizeof(RM_PROF_PHASE_PAGE) <= RM_PROF_PHASE_PAGE_SIZE);
+
 /*!
  * @brief Start measuring elapsed time for a specific profiling module.
  *
@@ -225,3 +235,186 @@ rmProfGroupStop
     pGroup->pTotal = NULL;
     pGroup->pLast  = NULL;
 }
+
+/***************************************************************************\
+*                             Phase profiler                                *
+\***************************************************************************/
+
+/*!
+ * @brief Initialize the phase profiler if enabled via registry.
+ *
+ * Reads NV_REG_STR_RM_PHASE_PROFILER and, when the mask is nonzero,
+ * allocates and stamps the shared histogram page. Called once from
+ * coreInitializeRm(); a zero or absent key leaves the profiler fully
+ * disabled with no allocation.
+ */
+void
+rmProfPhaseInit(void)
+{
+    NvU32 enabledMask = NV_REG_STR_RM_PHASE_PROFILER_DISABLE;
+
+    if (s_pProfPhasePage != NULL)
+        return;
+
+    if ((osReadRegistryDword(NULL, NV_REG_STR_RM_PHASE_PROFILER,
+                             &enabledMask) != NV_OK) ||
+        (enabledMask == NV_REG_STR_RM_PHASE_PROFILER_DISABLE))
+    {
+        return;
+    }
+
+    s_pProfPhasePage = portMemAllocNonPaged(RM_PROF_PHASE_PAGE_SIZE);
+    if (s_pProfPhasePage == NULL)
+    {
+        NV_PRINTF(LEVEL_ERROR, "Failed to allocate phase profiler page\n");
+        return;
+    }
+
+    portMemSet(s_pProfPhasePage, 0, RM_PROF_PHASE_PAGE_SIZE);
+    s_pProfPhasePage->magic       = RM_PROF_PHASE_PAGE_MAGIC;
+    s_pProfPhasePage->version     = RM_PROF_PHASE_PAGE_VERSION;
+    s_pProfPhasePage->enabledMask = enabledMask;
+    s_pProfPhasePage->phaseCount  = RM_PROF_PHASE_COUNT;
+}
+
+/*!
+ * @brief Tear down the phase profiler, logging a final per-phase summary.
+ */
+void
+rmProfPhaseDestroy(void)
+{
+    static const char *const phaseNames[RM_PROF_PHASE_COUNT] =
+    {
+        "gpuStateLoad", "serverAlloc", "serverFree", "gspRpcWait",
+        "runlistCommit"
+    };
+    NvU32 phase;
+
+    if (s_pProfPhasePage == NULL)
+        return;
+
+    for (phase = 0; phase < RM_PROF_PHASE_COUNT; phase++)
+    {
+        RM_PROF_PHASE_HIST *pHist = &s_pProfPhasePage->phases[phase];
+
+        if (pHist->count == 0)
+            continue;
+
+        NV_PRINTF(LEVEL_INFO,
+                  "phase %s: count=%llu avg=%lluns min=%lluns max=%lluns\n",
+                  phaseNames[phase], pHist->count,
+                  pHist->total_ns / pHist->count, pHist->min_ns,
+                  pHist->max_ns);
+    }
+
+    portMemFree(s_pProfPhasePage);
+    s_pProfPhasePage = NULL;
+}
+
+/*!
+ * @brief Check whether a specific phase is currently being profiled.
+ *
+ * The mask is re-read from the shared page on every call so phases can be
+ * toggled at runtime by rewriting the mask in place.
+ */
+NvBool
+rmProfPhaseEnabled
+(
+    RM_PROF_PHASE phase
+)
+{
+    return (s_pProfPhasePage != NULL) &&
+           (phase < RM_PROF_PHASE_COUNT) &&
+           ((s_pProfPhasePage->enabledMask & NVBIT(phase)) != 0);
+}
+
+/*!
+ * @brief Begin marker for a well-known phase.
+ *
+ * @returns An opaque start token to pass to rmProfPhaseEnd(), or 0 when the
+ *          phase is disabled (rmProfPhaseEnd() ignores zero tokens).
+ */
+NvU64
+rmProfPhaseBegin
+(
+    RM_PROF_PHASE phase
+)
+{
+    NvU64 start_ns;
+
+    if (!rmProfPhaseEnabled(phase))
+        return 0;
+
+    osGetPerformanceCounter(&start_ns);
+
+    // A zero counter value would read back as "disabled" at the end marker.
+    return (start_ns == 0) ? 1 : start_ns;
+}
+
+/*!
+ * @brief End marker for a well-known phase; aggregates the elapsed time into
+ *        the phase's histogram.
+ *
+ * All histogram updates use lock-free atomics, so markers may run
+ * concurrently from any number of threads (including under spinlocks).
+ *
+ * @param[in] phase    Phase being ended.
+ * @param[in] start_ns Token returned by the matching rmProfPhaseBegin().
+ */
+void
+rmProfPhaseEnd
+(
+    RM_PROF_PHASE phase,
+    NvU64         start_ns
+)
+{
+    RM_PROF_PHASE_HIST *pHist;
+    NvU64 stop_ns;
+    NvU64 elapsed_ns;
+    NvU64 old;
+    NvU64 v;
+    NvU32 bucket = 0;
+
+    if ((start_ns == 0) || !rmProfPhaseEnabled(phase))
+        return;
+
+    osGetPerformanceCounter(&stop_ns);
+    elapsed_ns = stop_ns - start_ns;
+    pHist = &s_pProfPhasePage->phases[phase];
+
+    portAtomicExIncrementU64(&pHist->count);
+    portAtomicExAddU64(&pHist->total_ns, elapsed_ns);
+
+    for (v = elapsed_ns >> 10;
+         (v != 0) && (bucket < RM_PROF_PHASE_HIST_BUCKETS - 1);
+         v >>= 1)
+    {
+        bucket++;
+    }
+    portAtomicExIncrementU64(&pHist->buckets[bucket]);
+
+    do
+    {
+        old = pHist->min_ns;
+        if ((old != 0) && (elapsed_ns >= old))
+            break;
+    } while (!portAtomicExCompareAndSwapU64(&pHist->min_ns, elapsed_ns, old));
+
+    do
+    {
+        old = pHist->max_ns;
+        if (elapsed_ns <= old)
+            break;
+    } while (!portAtomicExCompareAndSwapU64(&pHist->max_ns, elapsed_ns, old));
+}
+
+/*!
+ * @brief Expose the shared histogram page (e.g. for debug dump collection).
+ *
+ * @returns The page, or NULL when the profiler is disabled.
+ */
+const RM_PROF_PHASE_PAGE *
+rmProfPhaseGetPage(void)
+{
+    return s_pProfPhasePage;
+}
@@ -784,6 +784,12 @@ kbusStateUnload_GM107
     if (IS_VIRTUAL(pGpu) && !(flags & GPU_STATE_FLAGS_PRESERVING))
         return NV_OK;
 
+    //
+    // Cached PCIe P2P mappings have no clients left; evict them so no
+    // mailbox or HSHUB state survives the unload.
+    //
+    kbusFlushCachedPciePeerMappings(pGpu, pKernelBus);
+
     // Call kbusUnlinkP2P_HAL only in case of Linked SLI and Unliked SLI. Bug 4182245
     if ((pKernelBif != NULL)
         &&
@@ -3244,6 +3250,11 @@ _kbusDestroyP2P_GM107
     KernelBus *pRemoteKernelBus;
     NvU32 i;
 
+    //
+    // Evict cached PCIe P2P mappings first; they hold peer number masks with
+    // a zero refCount and must not go through the refCount teardown below.
+    //
+    kbusFlushCachedPciePeerMappings(pGpu, pKernelBus);
 
     // Clear all peer numbers.
     for (i = 0; i < NV_MAX_DEVICES; i++)
@@ -4231,7 +4242,8 @@ kbusGetUnusedPeerId_GM107
     for (peerId = 0; peerId < pKernelBus->numPeers; peerId++)
     {
         if ((pKernelBus->p2pPcie.busPeer[peerId].refCount == 0) &&
-            (!pKernelBus->p2pPcie.busPeer[peerId].bReserved))
+            (!pKernelBus->p2pPcie.busPeer[peerId].bReserved) &&
+            (!pKernelBus->p2pPcie.busPeer[peerId].bCached))
         {
             return peerId;
         }
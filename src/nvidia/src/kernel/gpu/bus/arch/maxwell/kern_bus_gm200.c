@@ -328,6 +328,38 @@ kbusCreateP2PMapping_GM200
     return NV_ERR_NOT_SUPPORTED;
 }
 
+/*!
+ * @brief  Evict a cached mapping to reclaim a peer ID for a new GPU pair
+ *
+ * Used when every peer ID is either live, reserved or cached; tearing down
+ * one cached mapping frees its peer ID for the requested pair.
+ *
+ * @param[in]   pGpu
+ * @param[in]   pKernelBus
+ *
+ * @return  The reclaimed peer ID, or BUS_INVALID_PEER if nothing is cached
+ */
+static NvU32
+_kbusReclaimCachedPciePeerId
+(
+    OBJGPU    *pGpu,
+    KernelBus *pKernelBus
+)
+{
+    NvU32 peerId;
+
+    for (peerId = 0; peerId < pKernelBus->numPeers; peerId++)
+    {
+        if (pKernelBus->p2pPcie.busPeer[peerId].bCached)
+        {
+            kbusEvictCachedPciePeerMapping(pGpu, pKernelBus, peerId);
+            return peerId;
+        }
+    }
+
+    return BUS_INVALID_PEER;
+}
+
 /*!
  * @brief  Create PCIE (not NVLINK) P2P mapping between 2 GPUs
  *
@@ -385,7 +417,27 @@ kbusCreateP2PMappingForMailbox_GM200
             if ((pKernelBus0->p2pPcie.busPeer[*peer0].refCount == 0) &&
                 (pKernelBus1->p2pPcie.busPeer[*peer1].refCount == 0))
             {
-                goto busCreateP2PMapping_setupMapping;
+                //
+                // Evict cached mappings holding the requested peer IDs for a
+                // different GPU pair; a mapping cached for this very pair is
+                // instead reused below as if it were live.
+                //
+                if (pKernelBus0->p2pPcie.busPeer[*peer0].bCached &&
+                    ((pKernelBus0->p2pPcie.peerNumberMask[gpuInst1] & NVBIT(*peer0)) == 0))
+                {
+                    kbusEvictCachedPciePeerMapping(pGpu0, pKernelBus0, *peer0);
+                }
+                if (pKernelBus1->p2pPcie.busPeer[*peer1].bCached &&
+                    ((pKernelBus1->p2pPcie.peerNumberMask[gpuInst0] & NVBIT(*peer1)) == 0))
+                {
+                    kbusEvictCachedPciePeerMapping(pGpu1, pKernelBus1, *peer1);
+                }
+
+                if (!pKernelBus0->p2pPcie.busPeer[*peer0].bCached &&
+                    !pKernelBus1->p2pPcie.busPeer[*peer1].bCached)
+                {
+                    goto busCreateP2PMapping_setupMapping;
+                }
             }
 
             if (((pKernelBus0->p2pPcie.peerNumberMask[gpuInst1] & NVBIT(*peer0)) != 0) &&
@@ -394,6 +446,9 @@ kbusCreateP2PMappingForMailbox_GM200
                 pKernelBus0->p2pPcie.busPeer[*peer0].refCount++;
                 pKernelBus1->p2pPcie.busPeer[*peer1].refCount++;
 
+                pKernelBus0->p2pPcie.busPeer[*peer0].bCached = NV_FALSE;
+                pKernelBus1->p2pPcie.busPeer[*peer1].bCached = NV_FALSE;
+
                 NV_ASSERT(pKernelBus0->p2pPcie.busPeer[*peer0].remotePeerId == *peer1);
                 NV_ASSERT(pKernelBus1->p2pPcie.busPeer[*peer1].remotePeerId == *peer0);
 
@@ -449,6 +504,16 @@ kbusCreateP2PMappingForMailbox_GM200
         NV_ASSERT(!pKernelBus0->p2pPcie.busPeer[*peer0].bReserved);
         NV_ASSERT(!pKernelBus1->p2pPcie.busPeer[*peer1].bReserved);
 
+        if (pKernelBus0->p2pPcie.busPeer[*peer0].bCached)
+        {
+            NV_PRINTF(LEVEL_INFO,
+                      "reusing cached PCIe P2P mapping between GPU%u (peer %u) and "
+                      "GPU%u (peer %u)\n", gpuInst0, *peer0, gpuInst1, *peer1);
+
+            pKernelBus0->p2pPcie.busPeer[*peer0].bCached = NV_FALSE;
+            pKernelBus1->p2pPcie.busPeer[*peer1].bCached = NV_FALSE;
+        }
+
         pRmApi = GPU_GET_PHYSICAL_RMAPI(pGpu0);
         portMemSet(&params, 0, sizeof(params));
         params.programPciePeerMask = NVBIT32(*peer0);
@@ -482,6 +547,11 @@ kbusCreateP2PMappingForMailbox_GM200
     // If we're in loopback mode, check for specified peer ID
     if ((pGpu0 == pGpu1) && pKernelBus0->p2pMapSpecifyId)
     {
+        if (pKernelBus0->p2pPcie.busPeer[pKernelBus0->p2pMapPeerId].bCached)
+        {
+            kbusEvictCachedPciePeerMapping(pGpu0, pKernelBus0, pKernelBus0->p2pMapPeerId);
+        }
+
         if ((pKernelBus0->p2pPcie.busPeer[pKernelBus0->p2pMapPeerId].refCount == 0) &&
             (!pKernelBus0->p2pPcie.busPeer[pKernelBus0->p2pMapPeerId].bReserved) &&
             (pKernelBus1->p2pPcie.busPeer[pKernelBus1->p2pMapPeerId].refCount == 0))
@@ -503,11 +573,19 @@ kbusCreateP2PMappingForMailbox_GM200
     if (*peer0 == BUS_INVALID_PEER)
     {
         *peer0 = kbusGetUnusedPciePeerId_HAL(pGpu0, pKernelBus0);
+        if (*peer0 == BUS_INVALID_PEER)
+        {
+            *peer0 = _kbusReclaimCachedPciePeerId(pGpu0, pKernelBus0);
+        }
     }
 
     if (*peer1 == BUS_INVALID_PEER)
     {
         *peer1 = kbusGetUnusedPciePeerId_HAL(pGpu1, pKernelBus1);
+        if (*peer1 == BUS_INVALID_PEER)
+        {
+            *peer1 = _kbusReclaimCachedPciePeerId(pGpu1, pKernelBus1);
+        }
     }
 
     // couldn't find an available peer on both gpus
@@ -528,8 +606,10 @@ busCreateP2PMapping_setupMapping:
 
     NV_ASSERT(pKernelBus0->p2pPcie.busPeer[*peer0].refCount == 0);
     NV_ASSERT(!pKernelBus0->p2pPcie.busPeer[*peer0].bReserved);
+    NV_ASSERT(!pKernelBus0->p2pPcie.busPeer[*peer0].bCached);
     NV_ASSERT(pKernelBus1->p2pPcie.busPeer[*peer1].refCount == 0);
     NV_ASSERT(!pKernelBus1->p2pPcie.busPeer[*peer1].bReserved);
+    NV_ASSERT(!pKernelBus1->p2pPcie.busPeer[*peer1].bCached);
 
     //
     // Note if this is loopback we will have a refCount of 2.  This will be
@@ -714,15 +794,19 @@ kbusRemoveP2PMappingForMailbox_GM200
     --pKernelBus1->p2pPcie.busPeer[peer1].refCount;
     if (--pKernelBus0->p2pPcie.busPeer[peer0].refCount == 0)
     {
+        //
+        // Keep the mailbox and HSHUB configuration warm instead of tearing
+        // it down, so that a subsequent P2P allocation between the same GPU
+        // pair is just a refCount bump. The cached mapping is evicted when
+        // the peer IDs are needed for a different GPU pair, or flushed at
+        // state unload.
+        //
         NV_PRINTF(LEVEL_INFO,
-                  "Removing mapping GPU %d Peer %d <-> GPU %d Peer %d\n",
+                  "Caching mapping GPU %d Peer %d <-> GPU %d Peer %d\n",
                   gpuInst0, peer0, gpuInst1, peer1);
 
-        pKernelBus0->p2pPcie.peerNumberMask[gpuInst1] &= ~NVBIT(peer0);
-        pKernelBus1->p2pPcie.peerNumberMask[gpuInst0] &= ~NVBIT(peer1);
-
-        kbusDestroyMailbox(pGpu0, pKernelBus0, pGpu1, peer0);
-        kbusDestroyMailbox(pGpu1, pKernelBus1, pGpu0, peer1);
+        pKernelBus0->p2pPcie.busPeer[peer0].bCached = NV_TRUE;
+        pKernelBus1->p2pPcie.busPeer[peer1].bCached = NV_TRUE;
     }
     else
     {
@@ -735,6 +819,100 @@ kbusRemoveP2PMappingForMailbox_GM200
     return NV_OK;
 }
 
+/*!
+ * @brief Tear down a cached (refCount == 0) PCIE P2P mapping
+ *
+ * Destroys the mailbox and HSHUB configuration kept warm when the last
+ * reference to the mapping was dropped, freeing the peer ID on both GPUs
+ * for reuse.
+ *
+ * @param[in]   pGpu
+ * @param[in]   pKernelBus
+ * @param[in]   peerId      Local peer ID of the cached mapping
+ */
+void
+kbusEvictCachedPciePeerMapping_IMPL
+(
+    OBJGPU    *pGpu,
+    KernelBus *pKernelBus,
+    NvU32      peerId
+)
+{
+    OBJGPU    *pRemoteGpu = NULL;
+    KernelBus *pRemoteKernelBus;
+    NvU32      remotePeerId;
+    NvU32      gpuInst;
+
+    NV_ASSERT_OR_RETURN_VOID(peerId < P2P_MAX_NUM_PEERS);
+    NV_ASSERT_OR_RETURN_VOID(pKernelBus->p2pPcie.busPeer[peerId].bCached);
+    NV_ASSERT(pKernelBus->p2pPcie.busPeer[peerId].refCount == 0);
+
+    for (gpuInst = 0; gpuInst < NV_MAX_DEVICES; gpuInst++)
+    {
+        if (pKernelBus->p2pPcie.peerNumberMask[gpuInst] & NVBIT(peerId))
+        {
+            pRemoteGpu = gpumgrGetGpu(gpuInst);
+            break;
+        }
+    }
+
+    if (pRemoteGpu == NULL)
+    {
+        // The remote GPU is gone; just drop the local bookkeeping.
+        NV_PRINTF(LEVEL_ERROR,
+                  "cached mapping on GPU%u peer %u references an unloaded GPU\n",
+                  gpuGetInstance(pGpu), peerId);
+        pKernelBus->p2pPcie.busPeer[peerId].bCached = NV_FALSE;
+        return;
+    }
+
+    pRemoteKernelBus = GPU_GET_KERNEL_BUS(pRemoteGpu);
+    remotePeerId = pKernelBus->p2pPcie.busPeer[peerId].remotePeerId;
+
+    NV_ASSERT_OR_RETURN_VOID(remotePeerId < P2P_MAX_NUM_PEERS);
+    NV_ASSERT(pRemoteKernelBus->p2pPcie.busPeer[remotePeerId].remotePeerId == peerId);
+
+    NV_PRINTF(LEVEL_INFO,
+              "Evicting cached mapping GPU %d Peer %d <-> GPU %d Peer %d\n",
+              gpuGetInstance(pGpu), peerId, gpuInst, remotePeerId);
+
+    pKernelBus->p2pPcie.peerNumberMask[gpuInst] &= ~NVBIT(peerId);
+    pRemoteKernelBus->p2pPcie.peerNumberMask[gpuGetInstance(pGpu)] &= ~NVBIT(remotePeerId);
+
+    pKernelBus->p2pPcie.busPeer[peerId].bCached = NV_FALSE;
+    pRemoteKernelBus->p2pPcie.busPeer[remotePeerId].bCached = NV_FALSE;
+
+    kbusDestroyMailbox(pGpu, pKernelBus, pRemoteGpu, peerId);
+    kbusDestroyMailbox(pRemoteGpu, pRemoteKernelBus, pGpu, remotePeerId);
+}
+
+/*!
+ * @brief Evict all cached PCIE P2P mappings on the given GPU
+ *
+ * Called at teardown so that no warm mailbox or HSHUB state outlives the
+ * GPU that owns it.
+ *
+ * @param[in]   pGpu
+ * @param[in]   pKernelBus
+ */
+void
+kbusFlushCachedPciePeerMappings_IMPL
+(
+    OBJGPU    *pGpu,
+    KernelBus *pKernelBus
+)
+{
+    NvU32 peerId;
+
+    for (peerId = 0; peerId < P2P_MAX_NUM_PEERS; peerId++)
+    {
+        if (pKernelBus->p2pPcie.busPeer[peerId].bCached)
+        {
+            kbusEvictCachedPciePeerMapping(pGpu, pKernelBus, peerId);
+        }
+    }
+}
+
 /*!
  * @brief Reserve peer IDs for nvlink usage
  *
@@ -759,6 +937,11 @@ kbusReserveP2PPeerIds_GM200
         NV_PRINTF(LEVEL_INFO,
                   "reserving peer ID %u on GPU%u for NVLINK/C2C use\n", peerId,
                   gpuGetInstance(pGpu));
+        if (pKernelBus->p2pPcie.busPeer[peerId].bCached)
+        {
+            kbusEvictCachedPciePeerMapping(pGpu, pKernelBus, peerId);
+        }
+
         if (pKernelBus->p2pPcie.busPeer[peerId].refCount != 0)
         {
             return NV_ERR_IN_USE;
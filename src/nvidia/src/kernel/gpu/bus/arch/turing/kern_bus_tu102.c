@@ -68,6 +68,7 @@ kbusGetUnusedPciePeerId_TU102
     {
         if ((pKernelBus->p2pPcie.busPeer[peerId].refCount == 0) &&
             (!pKernelBus->p2pPcie.busPeer[peerId].bReserved) &&
+            (!pKernelBus->p2pPcie.busPeer[peerId].bCached) &&
             ((BIT(peerId) & nvlinkIdMask) == 0))
         {
             return peerId;
@@ -1438,6 +1438,13 @@ kbusUpdateRusdStatistics_IMPL
     pSharedData = gpushareddataWriteStart(pGpu);
     pSharedData->bar1Size = bar1Size;
     pSharedData->bar1AvailSize = bar1AvailSize;
+
+    // Zeroed statistics do not reflect real headroom; leave the watermark alone.
+    if (!bZeroRusd &&
+        (bar1AvailSize < pSharedData->memWatermarks.info.minBar1AvailSize))
+    {
+        pSharedData->memWatermarks.info.minBar1AvailSize = bar1AvailSize;
+    }
     gpushareddataWriteFinish(pGpu);
 
     return NV_OK;
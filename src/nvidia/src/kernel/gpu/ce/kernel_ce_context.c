@@ -21,6 +21,7 @@
  * DEALINGS IN THE SOFTWARE.
  */
 
+#include "gpu/ce/kernel_ce.h"
 #include "gpu/ce/kernel_ce_context.h"
 #include "gpu/ce/kernel_ce_private.h"
 #include "kernel/gpu/mig_mgr/kernel_mig_manager.h"
@@ -183,6 +184,26 @@ kceGetEngineDescFromAllocParams(OBJGPU *pGpu, NvU32 externalClassId, void *pAllo
     return ENG_INVALID;
 }
 
+/*
+ * Returns the KernelCE instance backing the given CE context, or NULL if
+ * the context is not bound to a CE engine (e.g. AMODEL uses GR).
+ */
+static KernelCE *
+_kcectxGetKCe
+(
+    KernelCeContext *pKCeContext
+)
+{
+    ChannelDescendant *pChannelDescendant = staticCast(pKCeContext, ChannelDescendant);
+    OBJGPU            *pGpu = GPU_RES_GET_GPU(pChannelDescendant);
+    ENGDESCRIPTOR      engDesc = pChannelDescendant->resourceDesc.engDesc;
+
+    if (!IS_CE(engDesc))
+        return NULL;
+
+    return GPU_GET_KCE(pGpu, GET_CE_IDX(engDesc));
+}
+
 NV_STATUS
 kcectxConstruct_IMPL
 (
@@ -191,7 +212,16 @@ kcectxConstruct_IMPL
     RS_RES_ALLOC_PARAMS_INTERNAL *pParams
 )
 {
-    // stub, initialization done in chandesConstruct
+    KernelCE *pKCe = _kcectxGetKCe(pKCeContext);
+
+    // Track per-LCE context occupancy for the CE utilization control
+    if (pKCe != NULL)
+    {
+        pKCe->activeContextCount++;
+        pKCe->totalContextCount++;
+    }
+
+    // remaining initialization done in chandesConstruct
     return NV_OK;
 }
 
@@ -203,6 +233,14 @@ kcectxDestruct_IMPL
 {
     ChannelDescendant *pChannelDescendant = staticCast(pKCeContext, ChannelDescendant);
     OBJGPU            *pGpu = GPU_RES_GET_GPU(pChannelDescendant);
+    KernelCE          *pKCe = _kcectxGetKCe(pKCeContext);
+
+    if (pKCe != NULL)
+    {
+        NV_ASSERT(pKCe->activeContextCount != 0);
+        if (pKCe->activeContextCount != 0)
+            pKCe->activeContextCount--;
+    }
 
     if (IsAMODEL(pGpu) || IS_VIRTUAL(pGpu) || IS_GSP_CLIENT(pGpu))
         return;
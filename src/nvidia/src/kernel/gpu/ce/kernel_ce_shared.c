@@ -227,3 +227,51 @@ subdeviceCtrlCmdCeGetAllCaps_IMPL
 
     return NV_OK;
 }
+
+//
+// Lock Requirements:
+//      Assert that API lock held on entry
+//
+NV_STATUS
+subdeviceCtrlCmdCeGetUtilization_IMPL
+(
+    Subdevice *pSubdevice,
+    NV2080_CTRL_CE_GET_UTILIZATION_PARAMS *pParams
+)
+{
+    OBJGPU   *pGpu = GPU_RES_GET_GPU(pSubdevice);
+    Device   *pDevice = GPU_RES_GET_DEVICE(pSubdevice);
+    KernelCE *pKCe;
+    NvU32     minActive = NV_U32_MAX;
+
+    ct_assert(NV2080_CTRL_MAX_CES <= sizeof(pParams->activeContextCount) / sizeof(pParams->activeContextCount[0]));
+
+    LOCK_ASSERT_AND_RETURN(rmapiLockIsOwner());
+
+    portMemSet(pParams, 0, sizeof(*pParams));
+    pParams->preferredCe = NV2080_CTRL_CE_UTILIZATION_INVALID_LCE;
+
+    KCE_ITER_DEVICE_BEGIN(pGpu, pKCe, pDevice)
+        if (pKCe->bStubbed)
+            continue;
+
+        pParams->present |= BIT64(kceInst);
+        pParams->activeContextCount[kceInst] = pKCe->activeContextCount;
+        pParams->totalContextCount[kceInst] = pKCe->totalContextCount;
+
+        //
+        // Steer new channels away from GRCEs; they run synchronously with
+        // GR and are a poor target for balancing copy bandwidth.
+        //
+        if (ceIsCeGrce(pGpu, RM_ENGINE_TYPE_COPY(pKCe->publicID)))
+            continue;
+
+        if (pKCe->activeContextCount < minActive)
+        {
+            minActive = pKCe->activeContextCount;
+            pParams->preferredCe = kceInst;
+        }
+    KCE_ITER_END
+
+    return NV_OK;
+}
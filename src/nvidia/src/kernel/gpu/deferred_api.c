@@ -28,7 +28,10 @@
 #include "kernel/gpu/subdevice/subdevice.h"
 #include "kernel/mem_mgr/vaspace.h"
 #include "kernel/rmapi/control.h"
+#include "kernel/rmapi/event.h"
 #include "kernel/rmapi/rs_utils.h"
+#include "gpu_mgr/gpu_mgr.h"
+#include "os/os.h"
 #include "kernel/virtualization/hypervisor/hypervisor.h"
 #include "kernel/gpu/fifo/kernel_channel.h"
 
@@ -69,6 +72,14 @@ _Class5080AddDeferredApiV2(DeferredApiObject *pDeferredApiObject,
                            NV5080_CTRL_DEFERRED_API_V2_PARAMS *pDeferredApi,
                            NvU32                               size);
 
+typedef struct
+{
+    NvHandle hClient;
+    NvHandle hDeferredApiObject;
+} DEFERRED_API_ASYNC_WORKITEM_ARGS;
+
+static void _class5080AsyncApiWorkItem(NvU32 gpuInstance, void *pArgs);
+
 
 static NV_STATUS
 _Class5080AddDeferredApi
@@ -420,6 +431,156 @@ defapiCtrlCmdDeferredApiV2_IMPL
                                       sizeof(NV5080_CTRL_DEFERRED_API_V2_PARAMS));
 }
 
+static void
+_class5080AsyncApiWorkItem
+(
+    NvU32 gpuInstance,
+    void *pArgs
+)
+{
+    DEFERRED_API_ASYNC_WORKITEM_ARGS *pWorkItemArgs = pArgs;
+    OBJGPU            *pGpu = gpumgrGetGpu(gpuInstance);
+    DeferredApiObject *pDeferredApiObject;
+    ChannelDescendant *pChannelDescendant;
+    RsClient          *pClient;
+    RsResourceRef     *pResourceRef;
+    DEFERRED_API_INFO *pCliDeferredApi;
+    NODE              *pNode;
+    NV_STATUS          rmStatus;
+    NV_STATUS          batchStatus = NV_OK;
+
+    if (pGpu == NULL)
+        return;
+
+    //
+    // The client may have freed the object (or itself) between submission
+    // and execution of the work item; any completion events died with it,
+    // so there is nothing left to do in that case.
+    //
+    if (serverGetClientUnderLock(&g_resServ, pWorkItemArgs->hClient,
+                                 &pClient) != NV_OK)
+        return;
+
+    if (clientGetResourceRef(pClient, pWorkItemArgs->hDeferredApiObject,
+                             &pResourceRef) != NV_OK)
+        return;
+
+    pDeferredApiObject = dynamicCast(pResourceRef->pResource,
+                                     DeferredApiObject);
+    if (pDeferredApiObject == NULL)
+        return;
+
+    pChannelDescendant = staticCast(pDeferredApiObject, ChannelDescendant);
+
+    //
+    // Clear the queued flag before draining so a submission racing with the
+    // drain queues a fresh work item rather than being dropped.
+    //
+    pDeferredApiObject->bAsyncWorkQueued = NV_FALSE;
+
+    //
+    // Execute every queued call under this single lock hold. The next node
+    // is fetched before execution because implicit-delete entries remove
+    // themselves from the btree.
+    //
+    btreeEnumStart(0, &pNode, pDeferredApiObject->DeferredApiList);
+    while (pNode != NULL)
+    {
+        pCliDeferredApi = pNode->Data;
+        btreeEnumNext(&pNode, pDeferredApiObject->DeferredApiList);
+
+        if ((pCliDeferredApi->Flags & DEFERRED_API_INFO_FLAGS_ASYNC_PENDING) == 0)
+            continue;
+
+        pCliDeferredApi->Flags &= ~DEFERRED_API_INFO_FLAGS_ASYNC_PENDING;
+
+        rmStatus = _class5080DeferredApiV2(pGpu, pChannelDescendant,
+                                           NV5080_DEFERRED_API,
+                                           pCliDeferredApi->Handle);
+        if ((rmStatus != NV_OK) && (batchStatus == NV_OK))
+            batchStatus = rmStatus;
+    }
+
+    if (pChannelDescendant->notifyAction)
+    {
+        PEVENTNOTIFICATION pEventNotifications =
+            inotifyGetNotificationList(staticCast(pDeferredApiObject, INotifier));
+        notifyEvents(pGpu, pEventNotifications, 0, 0, 0, batchStatus,
+                     pChannelDescendant->notifyAction);
+    }
+}
+
+NV_STATUS
+defapiCtrlCmdDeferredApiAsync_IMPL
+(
+    DeferredApiObject                     *pDeferredApiObj,
+    NV5080_CTRL_DEFERRED_API_ASYNC_PARAMS *pDeferredApi
+)
+{
+    OBJGPU            *pGpu = GPU_RES_GET_GPU(pDeferredApiObj);
+    DEFERRED_API_INFO *pCliDeferredApi;
+    NV_STATUS          status;
+
+    //
+    // vGPU:
+    //
+    // The host executes deferred calls on the guest's behalf, and the guest
+    // has no work queue to complete them on, so asynchronous submission is
+    // not supported there.
+    //
+    if (IS_VIRTUAL(pGpu))
+        return NV_ERR_NOT_SUPPORTED;
+
+    status = _Class5080AddDeferredApiV2(pDeferredApiObj,
+                                        pDeferredApi->api.hApiHandle,
+                                        &pDeferredApi->api,
+                                        sizeof(NV5080_CTRL_DEFERRED_API_V2_PARAMS));
+    if (status != NV_OK)
+        return status;
+
+    NV_ASSERT_OK_OR_RETURN(_Class5080GetDeferredApiInfo(pDeferredApiObj,
+                                                        pDeferredApi->api.hApiHandle,
+                                                        &pCliDeferredApi));
+    pCliDeferredApi->Flags |= DEFERRED_API_INFO_FLAGS_ASYNC_PENDING;
+
+    //
+    // A single work item drains every call queued on this object since it
+    // was scheduled, so the whole batch runs under one lock acquisition.
+    //
+    if (!pDeferredApiObj->bAsyncWorkQueued)
+    {
+        DEFERRED_API_ASYNC_WORKITEM_ARGS *pWorkItemArgs =
+            portMemAllocNonPaged(sizeof(*pWorkItemArgs));
+
+        if (pWorkItemArgs == NULL)
+        {
+            status = NV_ERR_NO_MEMORY;
+            goto fail;
+        }
+
+        pWorkItemArgs->hClient = RES_GET_CLIENT_HANDLE(pDeferredApiObj);
+        pWorkItemArgs->hDeferredApiObject = RES_GET_HANDLE(pDeferredApiObj);
+
+        status = osQueueWorkItemWithFlags(pGpu, _class5080AsyncApiWorkItem,
+                                          pWorkItemArgs,
+                                          OS_QUEUE_WORKITEM_FLAGS_LOCK_API_RW |
+                                          OS_QUEUE_WORKITEM_FLAGS_LOCK_GPUS_RW);
+        if (status != NV_OK)
+        {
+            portMemFree(pWorkItemArgs);
+            goto fail;
+        }
+
+        pDeferredApiObj->bAsyncWorkQueued = NV_TRUE;
+    }
+
+    return NV_OK;
+
+fail:
+    _Class5080DelDeferredApi(pDeferredApiObj, pDeferredApi->api.hApiHandle);
+    return status;
+}
+
 NV_STATUS
 defapiCtrlCmdRemoveApi_IMPL
 (
@@ -231,33 +231,49 @@ NV_STATUS kchannelAllocMem_GM107
         SLI_LOOP_BREAK;
     }
 
-    status = memdescCreate(&pInstanceBlock->pInstanceBlockDesc, pGpu,
-                           instMemSize, instMemAlign, NV_TRUE,
-                           ADDR_UNKNOWN, CpuCacheAttrib, allocFlags);
-    if (status != NV_OK)
-    {
-        NV_PRINTF(LEVEL_ERROR, "Unable to allocate instance memory descriptor!\n");
-        SLI_LOOP_BREAK;
-    }
-
-    if ((memdescGetAddressSpace(pInstanceBlock->pInstanceBlockDesc) == ADDR_SYSMEM) &&
-        (gpuIsInstanceMemoryAlwaysCached(pGpu)))
+    //
+    // Try to recycle an instance block from a recently torn down channel
+    // before paying for a fresh allocation. Only plain allocations are
+    // cached, so protected memory and ctx buf pool backed instance blocks
+    // always take the allocation path below.
+    //
+    if ((pChannelBufPool == NULL) && !bInstProtectedMem)
     {
-        memdescSetGpuCacheAttrib(pInstanceBlock->pInstanceBlockDesc, NV_MEMORY_CACHED);
+        pInstanceBlock->pInstanceBlockDesc =
+            kfifoInstMemCacheGet(pGpu, GPU_GET_KERNEL_FIFO(pGpu),
+                                 instMemSize, CpuCacheAttrib);
     }
 
-    if (pChannelBufPool != NULL)
+    if (pInstanceBlock->pInstanceBlockDesc == NULL)
     {
-        status = memdescSetCtxBufPool(pInstanceBlock->pInstanceBlockDesc, pChannelBufPool);
+        status = memdescCreate(&pInstanceBlock->pInstanceBlockDesc, pGpu,
+                               instMemSize, instMemAlign, NV_TRUE,
+                               ADDR_UNKNOWN, CpuCacheAttrib, allocFlags);
         if (status != NV_OK)
         {
-            NV_ASSERT(status == NV_OK);
+            NV_PRINTF(LEVEL_ERROR, "Unable to allocate instance memory descriptor!\n");
             SLI_LOOP_BREAK;
         }
-    }
 
-    memdescTagAllocList(status, NV_FB_ALLOC_RM_INTERNAL_OWNER_UNNAMED_TAG_116, 
-                        pInstanceBlock->pInstanceBlockDesc, pInstAllocList);
+        if ((memdescGetAddressSpace(pInstanceBlock->pInstanceBlockDesc) == ADDR_SYSMEM) &&
+            (gpuIsInstanceMemoryAlwaysCached(pGpu)))
+        {
+            memdescSetGpuCacheAttrib(pInstanceBlock->pInstanceBlockDesc, NV_MEMORY_CACHED);
+        }
+
+        if (pChannelBufPool != NULL)
+        {
+            status = memdescSetCtxBufPool(pInstanceBlock->pInstanceBlockDesc, pChannelBufPool);
+            if (status != NV_OK)
+            {
+                NV_ASSERT(status == NV_OK);
+                SLI_LOOP_BREAK;
+            }
+        }
+
+        memdescTagAllocList(status, NV_FB_ALLOC_RM_INTERNAL_OWNER_UNNAMED_TAG_116,
+                            pInstanceBlock->pInstanceBlockDesc, pInstAllocList);
+    }
     if (status == NV_OK)
     {
         MemoryManager *pMemoryManager = GPU_GET_MEMORY_MANAGER(pGpu);
@@ -381,11 +397,15 @@ kchannelDestroyMem_GM107
             pInstanceBlock->pRamfcDesc = NULL;
         }
 
-        // Release Inst block Desc
+        // Release Inst block Desc, recycling it for the next channel if possible
         if (pInstanceBlock->pInstanceBlockDesc != NULL)
         {
-            memdescFree(pInstanceBlock->pInstanceBlockDesc);
-            memdescDestroy(pInstanceBlock->pInstanceBlockDesc);
+            if (!kfifoInstMemCachePut(pGpu, GPU_GET_KERNEL_FIFO(pGpu),
+                                      pInstanceBlock->pInstanceBlockDesc))
+            {
+                memdescFree(pInstanceBlock->pInstanceBlockDesc);
+                memdescDestroy(pInstanceBlock->pInstanceBlockDesc);
+            }
             pInstanceBlock->pInstanceBlockDesc = NULL;
         }
     }
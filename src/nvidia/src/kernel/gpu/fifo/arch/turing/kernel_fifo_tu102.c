@@ -53,7 +53,7 @@ kfifoUpdateUsermodeDoorbell_TU102
 {
     NV_PRINTF(LEVEL_INFO, "Poking workSubmitToken 0x%x\n", workSubmitToken);
 
-    GPU_VREG_WR32(pGpu, NV_VIRTUAL_FUNCTION_DOORBELL, workSubmitToken);
+    GPU_VREG_WR32_FAST(pGpu, NV_VIRTUAL_FUNCTION_DOORBELL, workSubmitToken, NULL);
 
     return NV_OK;
 }
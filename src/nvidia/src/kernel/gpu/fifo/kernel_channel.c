@@ -28,6 +28,7 @@
 #include "kernel/core/locks.h"
 #include "gpu/subdevice/subdevice.h"
 #include "kernel/diagnostics/gpu_acct.h"
+#include "kernel/diagnostics/profiler.h"
 #include "kernel/gpu/conf_compute/conf_compute.h"
 #include "kernel/gpu/device/device.h"
 #include "kernel/gpu/fifo/kernel_ctxshare.h"
@@ -3128,6 +3129,7 @@ kchannelCtrlCmdGpFifoSchedule_IMPL
     NV_STATUS     rmStatus      = NV_OK;
     CALL_CONTEXT *pCallContext  = resservGetTlsCallContext();
     RmCtrlParams *pRmCtrlParams = pCallContext->pControlParams;
+    NvU64         profStart;
 
     //
     // Bug 1737765: Prevent Externally Owned Channels from running unless bound
@@ -3147,6 +3149,7 @@ kchannelCtrlCmdGpFifoSchedule_IMPL
     kchannelSetRunlistSet(pGpu, pKernelChannel, NV_TRUE);
     SLI_LOOP_END
 
+    profStart = RM_PROF_PHASE_BEGIN(RM_PROF_PHASE_RUNLIST_COMMIT);
 
     //
     // All real hardware management is done in the host.
@@ -3162,6 +3165,7 @@ kchannelCtrlCmdGpFifoSchedule_IMPL
                           pRmCtrlParams->paramsSize,
                           rmStatus);
 
+        RM_PROF_PHASE_END(RM_PROF_PHASE_RUNLIST_COMMIT, profStart);
         return rmStatus;
     }
 
@@ -3169,10 +3173,13 @@ kchannelCtrlCmdGpFifoSchedule_IMPL
     // Do an internal control call to do channel reset
     // on Host (Physical) RM
     //
-    return kchannelFwdToInternalCtrl_HAL(pGpu,
-                                         pKernelChannel,
-                                         NVA06F_CTRL_CMD_INTERNAL_GPFIFO_SCHEDULE,
-                                         pRmCtrlParams);
+    rmStatus = kchannelFwdToInternalCtrl_HAL(pGpu,
+                                             pKernelChannel,
+                                             NVA06F_CTRL_CMD_INTERNAL_GPFIFO_SCHEDULE,
+                                             pRmCtrlParams);
+
+    RM_PROF_PHASE_END(RM_PROF_PHASE_RUNLIST_COMMIT, profStart);
+    return rmStatus;
 }
 
 NV_STATUS
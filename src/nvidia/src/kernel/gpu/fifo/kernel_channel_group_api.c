@@ -24,6 +24,7 @@
 #include "kernel/gpu/fifo/kernel_channel_group_api.h"
 
 #include "kernel/core/locks.h"
+#include "kernel/diagnostics/profiler.h"
 #include "kernel/gpu/fifo/kernel_channel_group.h"
 #include "kernel/gpu/mem_mgr/mem_mgr.h"
 #include "kernel/gpu/gr/kernel_graphics.h"
@@ -1073,6 +1074,7 @@ kchangrpapiCtrlCmdGpFifoSchedule_IMPL
     CHANNEL_LIST        *pChanList    = NULL;
     NvU32                runlistId    = INVALID_RUNLIST_ID;
     RM_API              *pRmApi       = GPU_GET_PHYSICAL_RMAPI(pGpu);
+    NvU64                profStart;
 
     if (pKernelChannelGroupApi->pKernelChannelGroup == NULL)
         return NV_ERR_INVALID_OBJECT;
@@ -1168,6 +1170,8 @@ kchangrpapiCtrlCmdGpFifoSchedule_IMPL
     }
     SLI_LOOP_END
 
+    profStart = RM_PROF_PHASE_BEGIN(RM_PROF_PHASE_RUNLIST_COMMIT);
+
     if (IS_VIRTUAL(pGpu) || IS_GSP_CLIENT(pGpu))
     {
         CALL_CONTEXT *pCallContext = resservGetTlsCallContext();
@@ -1182,6 +1186,7 @@ kchangrpapiCtrlCmdGpFifoSchedule_IMPL
                           pRmCtrlParams->pParams,
                           pRmCtrlParams->paramsSize,
                           status);
+        RM_PROF_PHASE_END(RM_PROF_PHASE_RUNLIST_COMMIT, profStart);
         return status;
     }
 
@@ -1197,6 +1202,7 @@ kchangrpapiCtrlCmdGpFifoSchedule_IMPL
                              pSchedParams,
                              sizeof(NVA06C_CTRL_GPFIFO_SCHEDULE_PARAMS));
 
+    RM_PROF_PHASE_END(RM_PROF_PHASE_RUNLIST_COMMIT, profStart);
     return status;
 }
 
@@ -1269,6 +1275,50 @@ kchangrpapiCtrlCmdBind_IMPL
     return rmStatus;
 }
 
+NV_STATUS
+kchangrpapiCtrlCmdBindAndSchedule_IMPL
+(
+    KernelChannelGroupApi                *pKernelChannelGroupApi,
+    NVA06C_CTRL_BIND_AND_SCHEDULE_PARAMS *pParams
+)
+{
+    NV_STATUS                          rmStatus = NV_OK;
+    RM_API                            *pRmApi   = rmapiGetInterface(RMAPI_GPU_LOCK_INTERNAL);
+    NVA06C_CTRL_BIND_PARAMS            bindParams;
+    NVA06C_CTRL_GPFIFO_SCHEDULE_PARAMS schedParams;
+
+    NV_ASSERT_OR_RETURN(pParams != NULL, NV_ERR_INVALID_ARGUMENT);
+
+    //
+    // Bind all channels in the group first, then issue a single scheduling
+    // update for the whole group, instead of requiring clients to pay for one
+    // control call round trip per channel before the group can be scheduled.
+    //
+    portMemSet(&bindParams, 0, sizeof(bindParams));
+    bindParams.engineType = pParams->engineType;
+
+    NV_CHECK_OK_OR_RETURN(LEVEL_ERROR,
+        kchangrpapiCtrlCmdBind(pKernelChannelGroupApi, &bindParams));
+
+    portMemSet(&schedParams, 0, sizeof(schedParams));
+    schedParams.bEnable     = pParams->bEnable;
+    schedParams.bSkipSubmit = pParams->bSkipSubmit;
+
+    //
+    // Route the scheduling update through the RM API so it takes the same
+    // path as NVA06C_CTRL_CMD_GPFIFO_SCHEDULE, including the RPC to the host
+    // on vGPU / GSP client configurations.
+    //
+    rmStatus = pRmApi->Control(pRmApi,
+                               RES_GET_CLIENT_HANDLE(pKernelChannelGroupApi),
+                               RES_GET_HANDLE(pKernelChannelGroupApi),
+                               NVA06C_CTRL_CMD_GPFIFO_SCHEDULE,
+                               &schedParams,
+                               sizeof(schedParams));
+
+    return rmStatus;
+}
+
 NV_STATUS
 kchangrpapiCtrlCmdGetTimeslice_IMPL
 (
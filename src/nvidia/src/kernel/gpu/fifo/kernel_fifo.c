@@ -161,11 +161,10 @@ kfifoChidMgrConstruct_IMPL
     }
 
     // Allocate memory for each CHID_MGR and its members (only the valid ones)
-    for (i = 0; i < pKernelFifo->numChidMgrs; i++)
+    for (i = bitVectorFindNextSet(&pKernelFifo->chidMgrValid, 0);
+         i < pKernelFifo->numChidMgrs;
+         i = bitVectorFindNextSet(&pKernelFifo->chidMgrValid, i + 1))
     {
-        if (!bitVectorTest(&pKernelFifo->chidMgrValid, i))
-            continue;
-
         pKernelFifo->ppChidMgr[i] = portMemAllocNonPaged(sizeof(CHID_MGR));
         if (pKernelFifo->ppChidMgr[i] == NULL)
         {
@@ -422,6 +421,9 @@ _kfifoChidMgrInitChannelGroupMgr
 
     portMemSet(pFifoHwID->pHwIdInUse, 0, allocSize);
 
+    pFifoHwID->hwIdInUseCount     = 0;
+    pFifoHwID->hwIdLowestFreeElem = 0;
+
     //
     // If numChannelGroups isn't a multiple of 32 we need to set the bits > numChannelGroups to
     // 1.  Otherwise when we allocate IDs starting at the top we'll allocate
@@ -446,6 +448,8 @@ _kfifoChidMgrDestroyChannelGroupMgr
         portMemFree(pChidMgr->channelGrpMgr.pHwIdInUse);
         pChidMgr->channelGrpMgr.pHwIdInUse = NULL;
         pChidMgr->channelGrpMgr.hwIdInUseSz = 0;
+        pChidMgr->channelGrpMgr.hwIdInUseCount = 0;
+        pChidMgr->channelGrpMgr.hwIdLowestFreeElem = 0;
     }
 }
 
@@ -1320,7 +1324,9 @@ kfifoChidMgrAllocChannelGroupHwID_IMPL
     NvU32      *pChGrpID
 )
 {
+    FIFO_HW_ID *pFifoHwID = &pChidMgr->channelGrpMgr;
     NvU32 maxChannelGroups;
+    NvU32 scanElem;
 
     if (pChGrpID == NULL)
         return NV_ERR_INVALID_ARGUMENT;
@@ -1332,14 +1338,23 @@ kfifoChidMgrAllocChannelGroupHwID_IMPL
         return NV_ERR_INVALID_ARGUMENT;
     }
 
-    // Find the least unused grpID
-    *pChGrpID = nvBitFieldLSZero(pChidMgr->channelGrpMgr.pHwIdInUse,
-                                 pChidMgr->channelGrpMgr.hwIdInUseSz);
+    //
+    // Find the least unused grpID. Elements below the lowest-free hint are
+    // known to be fully reserved, so the scan skips them; with thousands of
+    // channel groups this keeps allocation cost amortized O(1) instead of
+    // rescanning the whole bitfield on every channel group create.
+    //
+    scanElem  = NV_MIN(pFifoHwID->hwIdLowestFreeElem, pFifoHwID->hwIdInUseSz);
+    *pChGrpID = nvBitFieldLSZero(pFifoHwID->pHwIdInUse + scanElem,
+                                 pFifoHwID->hwIdInUseSz - scanElem) +
+                (scanElem * 32);
 
     if (*pChGrpID < maxChannelGroups)
     {
-        nvBitFieldSet(pChidMgr->channelGrpMgr.pHwIdInUse,
-                      pChidMgr->channelGrpMgr.hwIdInUseSz, *pChGrpID, NV_TRUE);
+        nvBitFieldSet(pFifoHwID->pHwIdInUse,
+                      pFifoHwID->hwIdInUseSz, *pChGrpID, NV_TRUE);
+        pFifoHwID->hwIdInUseCount++;
+        pFifoHwID->hwIdLowestFreeElem = *pChGrpID / 32;
     }
     else
     {
@@ -1392,6 +1407,11 @@ kfifoChidMgrFreeChannelGroupHwID_IMPL
     nvBitFieldSet(pChidMgr->channelGrpMgr.pHwIdInUse,
                   pChidMgr->channelGrpMgr.hwIdInUseSz, chGrpID, NV_FALSE);
 
+    NV_ASSERT(pChidMgr->channelGrpMgr.hwIdInUseCount > 0);
+    pChidMgr->channelGrpMgr.hwIdInUseCount--;
+    pChidMgr->channelGrpMgr.hwIdLowestFreeElem =
+        NV_MIN(pChidMgr->channelGrpMgr.hwIdLowestFreeElem, chGrpID / 32);
+
     return NV_OK;
 }
 
@@ -1562,26 +1582,15 @@ kfifoGetChannelGroupsInUse_IMPL
     KernelFifo *pKernelFifo
 )
 {
-    NvU32    numChannelGroups      = 0;
     NvU32    numChannelGroupsInUse = 0;
-    NvU32    chGrpID, i;
+    NvU32    i;
 
     for (i = 0; i < pKernelFifo->numChidMgrs; i++)
     {
         if (pKernelFifo->ppChidMgr[i] != NULL)
         {
-            numChannelGroups = kfifoChidMgrGetNumChannels(pGpu, pKernelFifo,
-                                                      pKernelFifo->ppChidMgr[i]);
-
-            for (chGrpID = 0; chGrpID < numChannelGroups; chGrpID++)
-            {
-                if (nvBitFieldTest(pKernelFifo->ppChidMgr[i]->channelGrpMgr.pHwIdInUse,
-                                   pKernelFifo->ppChidMgr[i]->channelGrpMgr.hwIdInUseSz,
-                                   chGrpID))
-                {
-                    numChannelGroupsInUse++;
-                }
-            }
+            numChannelGroupsInUse +=
+                pKernelFifo->ppChidMgr[i]->channelGrpMgr.hwIdInUseCount;
         }
     }
     return numChannelGroupsInUse;
@@ -1596,22 +1605,9 @@ kfifoGetRunlistChannelGroupsInUse_IMPL
     NvU32       runlistId
 )
 {
-    NvU32      numChannelGroups      = 0;
-    NvU32      numChannelGroupsInUse = 0;
-    NvU32      chGrpID;
     CHID_MGR  *pChidMgr = kfifoGetChidMgr(pGpu, pKernelFifo, runlistId);
 
-    numChannelGroups = kfifoChidMgrGetNumChannels(pGpu, pKernelFifo, pChidMgr);
-    for (chGrpID = 0; chGrpID < numChannelGroups; chGrpID++)
-    {
-        if (nvBitFieldTest(pChidMgr->channelGrpMgr.pHwIdInUse,
-                           pChidMgr->channelGrpMgr.hwIdInUseSz,
-                           chGrpID))
-        {
-            numChannelGroupsInUse++;
-        }
-    }
-    return numChannelGroupsInUse;
+    return pChidMgr->channelGrpMgr.hwIdInUseCount;
 }
 
 /**
@@ -2471,6 +2467,131 @@ kfifoGetRunlistBufPool_IMPL
     return pKernelFifo->pRunlistBufPool[rmEngineType];
 }
 
+/**
+ * @brief Pop a recycled instance block from the cache
+ *
+ * Returns an allocated memdesc previously recycled by
+ * @ref kfifoInstMemCachePut, or NULL if the cache is empty or the cached
+ * entry does not match the requested parameters. The caller owns the
+ * returned memdesc and is responsible for re-initializing its contents.
+ *
+ * @param[in]  pGpu
+ * @param[in]  pKernelFifo
+ * @param[in]  size            Required instance memory size
+ * @param[in]  cpuCacheAttrib  Required CPU cache attribute
+ */
+MEMORY_DESCRIPTOR *
+kfifoInstMemCacheGet_IMPL
+(
+    OBJGPU     *pGpu,
+    KernelFifo *pKernelFifo,
+    NvU64       size,
+    NvU32       cpuCacheAttrib
+)
+{
+    FIFO_INST_MEM_CACHE *pCache = &pKernelFifo->instMemCache;
+    MEMORY_DESCRIPTOR   *pMemDesc;
+
+    if (pCache->count == 0)
+    {
+        return NULL;
+    }
+
+    pMemDesc = pCache->ppMemDesc[pCache->count - 1];
+    pCache->ppMemDesc[pCache->count - 1] = NULL;
+    pCache->count--;
+
+    //
+    // Instance memory parameters are constant for the life of the GPU, so a
+    // mismatch should not happen; drop the stale entry if it does.
+    //
+    if ((memdescGetSize(pMemDesc) != size) ||
+        (memdescGetCpuCacheAttrib(pMemDesc) != cpuCacheAttrib))
+    {
+        memdescFree(pMemDesc);
+        memdescDestroy(pMemDesc);
+        return NULL;
+    }
+
+    return pMemDesc;
+}
+
+/**
+ * @brief Recycle a torn-down channel's instance block for reuse
+ *
+ * Takes ownership of the memdesc and keeps it for the next channel
+ * construction. Only plain device-owned allocations are cached; protected
+ * or ctx buf pool backed instance blocks, shared memdescs and anything
+ * above the watermark are rejected so the caller frees them as usual.
+ *
+ * @param[in]  pGpu
+ * @param[in]  pKernelFifo
+ * @param[in]  pMemDesc     Instance block memdesc to recycle
+ *
+ * @returns NV_TRUE if the cache took ownership of the memdesc
+ */
+NvBool
+kfifoInstMemCachePut_IMPL
+(
+    OBJGPU            *pGpu,
+    KernelFifo        *pKernelFifo,
+    MEMORY_DESCRIPTOR *pMemDesc
+)
+{
+    FIFO_INST_MEM_CACHE *pCache = &pKernelFifo->instMemCache;
+
+    if ((pMemDesc == NULL) ||
+        (pCache->count >= KFIFO_INST_MEM_CACHE_WATERMARK))
+    {
+        return NV_FALSE;
+    }
+
+    if (!pMemDesc->Allocated ||
+        (pMemDesc->RefCount != 1) ||
+        (pMemDesc->DupCount != 1) ||
+        memdescGetFlag(pMemDesc, MEMDESC_FLAGS_OWNED_BY_CTX_BUF_POOL) ||
+        memdescGetFlag(pMemDesc, MEMDESC_ALLOC_FLAGS_PROTECTED))
+    {
+        return NV_FALSE;
+    }
+
+    pCache->ppMemDesc[pCache->count] = pMemDesc;
+    pCache->count++;
+
+    return NV_TRUE;
+}
+
+/**
+ * @brief Free cached instance blocks above the given watermark
+ *
+ * Pass zero to drain the cache completely (e.g. at state destroy).
+ *
+ * @param[in]  pGpu
+ * @param[in]  pKernelFifo
+ * @param[in]  watermark    Number of entries to keep
+ */
+void
+kfifoInstMemCacheTrim_IMPL
+(
+    OBJGPU     *pGpu,
+    KernelFifo *pKernelFifo,
+    NvU32       watermark
+)
+{
+    FIFO_INST_MEM_CACHE *pCache = &pKernelFifo->instMemCache;
+
+    while (pCache->count > watermark)
+    {
+        MEMORY_DESCRIPTOR *pMemDesc = pCache->ppMemDesc[pCache->count - 1];
+
+        pCache->ppMemDesc[pCache->count - 1] = NULL;
+        pCache->count--;
+
+        memdescFree(pMemDesc);
+        memdescDestroy(pMemDesc);
+    }
+}
+
 /**
  * @brief Get size and alignment requirements for runlist buffers
  *
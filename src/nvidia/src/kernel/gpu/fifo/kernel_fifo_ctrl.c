@@ -24,6 +24,7 @@
 #include "kernel/gpu/fifo/kernel_fifo.h"
 #include "kernel/gpu/fifo/kernel_channel.h"
 #include "kernel/gpu/fifo/kernel_channel_group.h"
+#include "kernel/gpu/fifo/kernel_sched_mgr.h"
 #include "kernel/gpu/device/device.h"
 #include "kernel/gpu/subdevice/subdevice.h"
 #include "kernel/gpu/subdevice/subdevice_diag.h"
@@ -169,7 +170,6 @@ subdeviceCtrlCmdGetPhysicalChannelCount_IMPL
     NvU32     numChannelsInUse = 0;
     NvU32     numChannels;
     NvU32     i;
-    NvU32     chGrpID;
 
     pParams->physChannelCount      = NV_U32_MAX;
     pParams->physChannelCountInUse = 0;
@@ -183,15 +183,7 @@ subdeviceCtrlCmdGetPhysicalChannelCount_IMPL
             numChannels = kfifoChidMgrGetNumChannels(pGpu, pKernelFifo, pKernelFifo->ppChidMgr[i]);
 
             // Get the number of channels already in use
-            for (chGrpID = 0; chGrpID < numChannels; chGrpID++)
-            {
-                if (nvBitFieldTest(pKernelFifo->ppChidMgr[i]->channelGrpMgr.pHwIdInUse,
-                                   pKernelFifo->ppChidMgr[i]->channelGrpMgr.hwIdInUseSz,
-                                   chGrpID))
-                {
-                    numChannelsInUse++;
-                }
-            }
+            numChannelsInUse += pKernelFifo->ppChidMgr[i]->channelGrpMgr.hwIdInUseCount;
 
             pParams->physChannelCount      = NV_MIN(pParams->physChannelCount, numChannels);
             pParams->physChannelCountInUse = NV_MAX(pParams->physChannelCountInUse, numChannelsInUse);
@@ -967,3 +959,105 @@ _kfifoDisableChannelsForKeyRotation
     return status;
 }
 
+/*!
+ * @brief Forward a SW runlist scheduler control to the RM that runs the
+ *        scheduler (GSP-RM or the vGPU host).
+ *
+ * The SW runlist scheduler executes in physical RM, so the kernel driver
+ * only forwards these controls.  Do this manually instead of
+ * ROUTE_TO_PHYSICAL so that the same handler covers both the Guest and
+ * CPU-RM paths.
+ */
+static NV_STATUS
+_kfifoObjschedForwardToPhysical
+(
+    OBJGPU *pGpu
+)
+{
+    CALL_CONTEXT *pCallContext  = resservGetTlsCallContext();
+    RmCtrlParams *pRmCtrlParams = pCallContext->pControlParams->pLegacyParams;
+    NV_STATUS     status        = NV_OK;
+
+    if (!IS_VIRTUAL(pGpu) && !IS_GSP_CLIENT(pGpu))
+        return NV_ERR_NOT_SUPPORTED;
+
+    NV_RM_RPC_CONTROL(pGpu,
+                      pRmCtrlParams->hClient,
+                      pRmCtrlParams->hObject,
+                      pRmCtrlParams->cmd,
+                      pRmCtrlParams->pParams,
+                      pRmCtrlParams->paramsSize,
+                      status);
+
+    return status;
+}
+
+/*!
+ * @brief subdeviceCtrlCmdFifoObjschedSwGetLog
+ *
+ * Returns the SW runlist preemption log so that clients can observe
+ * per-runlist runtimes and preemption behavior.
+ */
+NV_STATUS
+subdeviceCtrlCmdFifoObjschedSwGetLog_IMPL
+(
+    Subdevice *pSubdevice,
+    NV2080_CTRL_FIFO_OBJSCHED_SW_GET_LOG_PARAMS *pParams
+)
+{
+    OBJGPU         *pGpu            = GPU_RES_GET_GPU(pSubdevice);
+    KernelSchedMgr *pKernelSchedMgr = GPU_GET_KERNEL_SCHEDMGR(pGpu);
+
+    if ((pKernelSchedMgr == NULL) || !kschedmgrIsSchedSwEnabled(pKernelSchedMgr))
+        return NV_ERR_NOT_SUPPORTED;
+
+    return _kfifoObjschedForwardToPhysical(pGpu);
+}
+
+/*!
+ * @brief subdeviceCtrlCmdFifoObjschedGetState
+ *
+ * Returns the current scheduling policy and timeslice configuration of a
+ * SW runlist.
+ */
+NV_STATUS
+subdeviceCtrlCmdFifoObjschedGetState_IMPL
+(
+    Subdevice *pSubdevice,
+    NV2080_CTRL_FIFO_OBJSCHED_GET_STATE_PARAMS *pParams
+)
+{
+    OBJGPU *pGpu = GPU_RES_GET_GPU(pSubdevice);
+
+    return _kfifoObjschedForwardToPhysical(pGpu);
+}
+
+/*!
+ * @brief subdeviceCtrlCmdFifoObjschedSetState
+ *
+ * Reconfigures the scheduling policy and timeslice of a SW runlist at
+ * runtime, without recreating its channels.  On success the cached
+ * scheduler policy in KernelSchedMgr is updated to match, so later
+ * policy queries reflect the new configuration.
+ */
+NV_STATUS
+subdeviceCtrlCmdFifoObjschedSetState_IMPL
+(
+    Subdevice *pSubdevice,
+    NV2080_CTRL_FIFO_OBJSCHED_SET_STATE_PARAMS *pParams
+)
+{
+    OBJGPU         *pGpu            = GPU_RES_GET_GPU(pSubdevice);
+    KernelSchedMgr *pKernelSchedMgr = GPU_GET_KERNEL_SCHEDMGR(pGpu);
+    NV_STATUS       status;
+
+    status = _kfifoObjschedForwardToPhysical(pGpu);
+
+    if ((status == NV_OK) && (pKernelSchedMgr != NULL))
+    {
+        kschedmgrSetConfigPolicyFromUser(pKernelSchedMgr, pGpu, pParams->schedPolicy);
+    }
+
+    return status;
+}
+
@@ -59,6 +59,8 @@ kfifoConstructEngine_IMPL
     pKernelFifo->pDummyPageMemDesc = NULL;
     pKernelFifo->pppRunlistBufMemDesc = NULL;
 
+    portMemSet((void *)&pKernelFifo->instMemCache, 0, sizeof(FIFO_INST_MEM_CACHE));
+
     NV_ASSERT_OK_OR_RETURN(kfifoConstructHal_HAL(pGpu, pKernelFifo));
 
     listInit(&pKernelFifo->postSchedulingEnableHandlerList,
@@ -268,6 +270,9 @@ kfifoStateDestroy_IMPL
     // Notify the handlers that the channel will soon be disabled
     NV_ASSERT_OK(kfifoTriggerPreSchedulingDisableCallback(pGpu, pKernelFifo));
 
+    // Drain the recycled instance block cache.
+    kfifoInstMemCacheTrim(pGpu, pKernelFifo, 0);
+
     //
     // Free up allocated memory.
     //
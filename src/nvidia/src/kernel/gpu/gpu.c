@@ -39,6 +39,7 @@
 #include "gpu_mgr/gpu_mgr.h"
 #include "core/thread_state.h"
 #include "core/locks.h"
+#include "diagnostics/profiler.h"
 #include "diagnostics/tracer.h"
 #include "rmapi/client_resource.h"
 #include "diagnostics/journal.h"
@@ -1909,6 +1910,140 @@ gpuIsEngDescSupported_IMPL
 
     return engDescriptorFound;
 }
+
+/*
+ * @brief Look up the active context counter array for a video engine class
+ *
+ * @param[in]  pGpu             OBJGPU pointer
+ * @param[in]  engClass         Engine class id (classId(OBJBSP) etc.)
+ * @param[out] pNumInstances    Number of entries in the returned array
+ *
+ * @returns pointer to the per-instance counter array, or NULL if the class
+ * is not a tracked video engine class.
+ */
+static NvU32 *
+_gpuVideoEngineCtxCounters
+(
+    OBJGPU *pGpu,
+    NvU32   engClass,
+    NvU32  *pNumInstances
+)
+{
+    switch (engClass)
+    {
+        case classId(OBJBSP):
+            *pNumInstances = GPU_MAX_NVDECS;
+            return pGpu->nvdecActiveContextCount;
+        case classId(OBJMSENC):
+            *pNumInstances = GPU_MAX_MSENCS;
+            return pGpu->msencActiveContextCount;
+        case classId(OBJNVJPG):
+            *pNumInstances = GPU_MAX_NVJPGS;
+            return pGpu->nvjpgActiveContextCount;
+        default:
+            *pNumInstances = 0;
+            return NULL;
+    }
+}
+
+/*
+ * @brief Pick the supported video engine instance with the fewest active
+ * contexts for a given engine class.
+ *
+ * Used to resolve the NV_ALLOC_ENGINE_INSTANCE_ANY placement hint at
+ * allocation time. The counters are updated under the GPU lock on the
+ * engine context construct/destruct paths, so no extra synchronization is
+ * needed here.
+ *
+ * @param[in] pGpu              OBJGPU pointer
+ * @param[in] engClass          Engine class id (classId(OBJBSP) etc.)
+ *
+ * @returns the least-loaded supported instance, or instance 0 if the class
+ * is not tracked or no instance is supported (the caller's own instance
+ * validation will then reject the allocation as before).
+ */
+NvU32
+gpuGetLeastLoadedVideoEngineInstance_IMPL
+(
+    OBJGPU *pGpu,
+    NvU32   engClass
+)
+{
+    NvU32  numInstances;
+    NvU32 *pCtxCounts    = _gpuVideoEngineCtxCounters(pGpu, engClass, &numInstances);
+    NvU32  bestInstance  = 0;
+    NvBool bFound        = NV_FALSE;
+    NvU32  i;
+
+    if (pCtxCounts == NULL)
+        return 0;
+
+    for (i = 0; i < numInstances; i++)
+    {
+        if (!gpuIsEngDescSupported(pGpu, MKENGDESC(engClass, i)))
+            continue;
+
+        if (!bFound || (pCtxCounts[i] < pCtxCounts[bestInstance]))
+        {
+            bestInstance = i;
+            bFound = NV_TRUE;
+        }
+    }
+
+    return bestInstance;
+}
+
+/*
+ * @brief Record that an engine context was created on a video engine
+ *
+ * No-op for engine descriptors that are not tracked video engines.
+ *
+ * @param[in] pGpu              OBJGPU pointer
+ * @param[in] engDesc           Engine descriptor of the allocated context
+ */
+void
+gpuVideoEngineCtxAcquired_IMPL
+(
+    OBJGPU       *pGpu,
+    ENGDESCRIPTOR engDesc
+)
+{
+    NvU32  numInstances;
+    NvU32 *pCtxCounts = _gpuVideoEngineCtxCounters(pGpu, ENGDESC_FIELD(engDesc, _CLASS), &numInstances);
+    NvU32  instance   = ENGDESC_FIELD(engDesc, _INST);
+
+    if ((pCtxCounts == NULL) || (instance >= numInstances))
+        return;
+
+    pCtxCounts[instance]++;
+}
+
+/*
+ * @brief Record that an engine context on a video engine was destroyed
+ *
+ * No-op for engine descriptors that are not tracked video engines.
+ *
+ * @param[in] pGpu              OBJGPU pointer
+ * @param[in] engDesc           Engine descriptor of the freed context
+ */
+void
+gpuVideoEngineCtxReleased_IMPL
+(
+    OBJGPU       *pGpu,
+    ENGDESCRIPTOR engDesc
+)
+{
+    NvU32  numInstances;
+    NvU32 *pCtxCounts = _gpuVideoEngineCtxCounters(pGpu, ENGDESC_FIELD(engDesc, _CLASS), &numInstances);
+    NvU32  instance   = ENGDESC_FIELD(engDesc, _INST);
+
+    if ((pCtxCounts == NULL) || (instance >= numInstances))
+        return;
+
+    NV_ASSERT_OR_RETURN_VOID(pCtxCounts[instance] > 0);
+    pCtxCounts[instance]--;
+}
+
 /*!
  * @brief Mark given Engine Descriptor with ENG_INVALID engine descriptor.
  *
@@ -2393,9 +2528,11 @@ gpuStateLoad_IMPL
     NvU32          curEngDescIdx;
     NV_STATUS      rmStatus = NV_OK;
     NvU32          status   = NV_OK;
+    NvU64          profStart;
 
     pGpu->registerAccess.regReadCount = pGpu->registerAccess.regWriteCount = 0;
     RMTRACE_ENGINE_PROFILE_EVENT("gpuStateLoadStart", pGpu->gpuId, pGpu->registerAccess.regReadCount, pGpu->registerAccess.regWriteCount);
+    profStart = RM_PROF_PHASE_BEGIN(RM_PROF_PHASE_GPU_STATE_LOAD);
 
     _gpuDetectNvswitchSupport(pGpu);
 
@@ -2585,6 +2722,7 @@ gpuStateLoad_IMPL
     RMTRACE_ENGINE_PROFILE_EVENT("gpuStateLoadEnd", pGpu->gpuId, pGpu->registerAccess.regReadCount, pGpu->registerAccess.regWriteCount);
 
 gpuStateLoad_exit:
+    RM_PROF_PHASE_END(RM_PROF_PHASE_GPU_STATE_LOAD, profStart);
     return rmStatus;
 }
 
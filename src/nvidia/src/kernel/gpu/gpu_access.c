@@ -91,6 +91,9 @@ regAccessConstruct
         }
     }
 
+    // Cache the common BAR0 mapping for the fast-path accessors
+    pRegisterAccess->pGpuMapping = gpuGetDeviceMapping(pGpu, DEVICE_INDEX_GPU, 0);
+
     return rmStatus;
 }
 
@@ -738,6 +741,190 @@ regRead032
     return _regRead(pRegisterAccess, deviceIndex, instance, addr, 32, pThreadState);
 }
 
+/*!
+ * Checks whether 32 bit accesses may bypass the generic register path and go
+ * straight to the cached DEVICE_INDEX_GPU instance 0 mapping.
+ */
+static NV_INLINE NvBool
+_regFastPathAvailable
+(
+    RegisterAccess *pRegisterAccess
+)
+{
+    DEVICE_MAPPING *pMapping = pRegisterAccess->pGpuMapping;
+
+    return (pMapping != NULL) &&
+           (pMapping->devRegFilterInfo.pRegFilterList == NULL);
+}
+
+/*!
+ * Specialized 32 bit read of the common GPU (BAR0) aperture. Equivalent to
+ * regRead032 on DEVICE_INDEX_GPU instance 0, minus the device-mapping lookup
+ * and the register-filter walk, which are skipped while no filter is
+ * installed. Falls back to the generic path otherwise.
+ */
+NvU32
+regRead032Fast
+(
+    RegisterAccess    *pRegisterAccess,
+    NvU32              addr,
+    THREAD_STATE_NODE *pThreadState
+)
+{
+    OBJGPU   *pGpu;
+    NvU32     returnValue = 0;
+    NV_STATUS status;
+
+    if (pRegisterAccess == NULL)
+    {
+        return NV_ERR_INVALID_POINTER;
+    }
+
+    if (!_regFastPathAvailable(pRegisterAccess))
+    {
+        return regRead032(pRegisterAccess, DEVICE_INDEX_GPU, 0, addr, pThreadState);
+    }
+
+    pGpu = pRegisterAccess->pGpu;
+    pRegisterAccess->regReadCount++;
+
+    status = gpuSanityCheckRegisterAccess(pGpu, addr, &returnValue);
+    if (status != NV_OK)
+    {
+        return returnValue;
+    }
+
+    returnValue = osDevReadReg032(pGpu, pRegisterAccess->pGpuMapping, addr);
+
+    // Make sure the value read is sane before we party on it.
+    gpuSanityCheckRegRead(pGpu, addr, 32, &returnValue);
+
+    return returnValue;
+}
+
+/*!
+ * Specialized 32 bit write of the common GPU (BAR0) aperture. See
+ * regRead032Fast; broadcast (SLI) writes additionally fall back to the
+ * generic path.
+ */
+void
+regWrite032Fast
+(
+    RegisterAccess    *pRegisterAccess,
+    NvU32              addr,
+    NvV32              val,
+    THREAD_STATE_NODE *pThreadState
+)
+{
+    OBJGPU *pGpu = pRegisterAccess->pGpu;
+
+    if (!_regFastPathAvailable(pRegisterAccess) ||
+        gpumgrGetBcEnabledStatus(pGpu))
+    {
+        regWrite032(pRegisterAccess, DEVICE_INDEX_GPU, 0, addr, val, pThreadState);
+        return;
+    }
+
+    pRegisterAccess->regWriteCount++;
+
+    if (gpuSanityCheckRegisterAccess(pGpu, addr, NULL) != NV_OK)
+    {
+        return;
+    }
+
+    osDevWriteReg032(pGpu, pRegisterAccess->pGpuMapping, addr, val);
+}
+
+/*!
+ * Begin a batched sequence of 32 bit accesses to the common GPU (BAR0)
+ * aperture, resolving the fast-path eligibility once for the whole sequence.
+ */
+void
+regAccessBatchBegin
+(
+    RegisterAccess    *pRegisterAccess,
+    THREAD_STATE_NODE *pThreadState,
+    REG_ACCESS_BATCH  *pBatch
+)
+{
+    pBatch->pRegisterAccess = pRegisterAccess;
+    pBatch->pThreadState    = pThreadState;
+    pBatch->pMapping        = NULL;
+
+    if ((pRegisterAccess != NULL) &&
+        _regFastPathAvailable(pRegisterAccess) &&
+        !gpumgrGetBcEnabledStatus(pRegisterAccess->pGpu))
+    {
+        pBatch->pMapping = pRegisterAccess->pGpuMapping;
+    }
+}
+
+/*!
+ * Batched 32 bit read; see regAccessBatchBegin.
+ */
+NvU32
+regAccessBatchRead032
+(
+    REG_ACCESS_BATCH *pBatch,
+    NvU32             addr
+)
+{
+    RegisterAccess *pRegisterAccess = pBatch->pRegisterAccess;
+    OBJGPU         *pGpu;
+    NvU32           returnValue = 0;
+
+    if (pBatch->pMapping == NULL)
+    {
+        return regRead032(pRegisterAccess, DEVICE_INDEX_GPU, 0, addr, pBatch->pThreadState);
+    }
+
+    pGpu = pRegisterAccess->pGpu;
+    pRegisterAccess->regReadCount++;
+
+    if (gpuSanityCheckRegisterAccess(pGpu, addr, &returnValue) != NV_OK)
+    {
+        return returnValue;
+    }
+
+    returnValue = osDevReadReg032(pGpu, pBatch->pMapping, addr);
+
+    // Make sure the value read is sane before we party on it.
+    gpuSanityCheckRegRead(pGpu, addr, 32, &returnValue);
+
+    return returnValue;
+}
+
+/*!
+ * Batched 32 bit write; see regAccessBatchBegin.
+ */
+void
+regAccessBatchWrite032
+(
+    REG_ACCESS_BATCH *pBatch,
+    NvU32             addr,
+    NvV32             val
+)
+{
+    RegisterAccess *pRegisterAccess = pBatch->pRegisterAccess;
+    OBJGPU         *pGpu;
+
+    if (pBatch->pMapping == NULL)
+    {
+        regWrite032(pRegisterAccess, DEVICE_INDEX_GPU, 0, addr, val, pBatch->pThreadState);
+        return;
+    }
+
+    pGpu = pRegisterAccess->pGpu;
+    pRegisterAccess->regWriteCount++;
+
+    if (gpuSanityCheckRegisterAccess(pGpu, addr, NULL) != NV_OK)
+    {
+        return;
+    }
+
+    osDevWriteReg032(pGpu, pBatch->pMapping, addr, val);
+}
+
 /*!
  * @brief Allocates and initializes GPU_IO_DEVICE and IO Aperture.
  *
@@ -462,6 +462,29 @@ _gpuFabricProbeSetupFlaRange
     }
 }
 
+static void
+_gpuFabricProbeSendCompletionEvent
+(
+    OBJGPU *pGpu,
+    NvU32 probeStatus
+)
+{
+    NV_STATUS status;
+    Fabric *pFabric = SYS_GET_FABRIC(SYS_GET_INSTANCE());
+    NV00F1_CTRL_FABRIC_EVENT event;
+    event.id = fabricGenerateEventId_IMPL(pFabric);
+    event.type = NV00F1_CTRL_FABRIC_EVENT_TYPE_PROBE_COMPLETE;
+    event.imexChannel = 0;
+    event.data.probeComplete.gpuId = pGpu->gpuId;
+    event.data.probeComplete.status = probeStatus;
+    status = fabricPostEventsV2(pFabric, &event, 1);
+    if (status != NV_OK)
+    {
+        NV_PRINTF(LEVEL_ERROR, "GPU%u Notifying probe completion failed\n",
+              gpuGetInstance(pGpu));
+    }
+}
+
 static void
 _gpuFabricProbeSendCliqueIdChangeEvent
 (
@@ -538,6 +561,16 @@ gpuFabricProbeReceiveKernelCallback
     //
     portAtomicSetU32(&pGpuFabricProbeInfoKernel->probeRespRcvd, 1);
 
+    //
+    // The probe completes asynchronously and consumers defer fabric state
+    // queries to first actual use, so wake any waiting clients with a
+    // completion event instead of leaving them to poll the probe info
+    // control. Post the event for failures too, so waiters don't hang on
+    // a probe that will never turn successful.
+    //
+    _gpuFabricProbeSendCompletionEvent(pGpu,
+        pGpuFabricProbeInfoKernel->probeResponseMsg.msgHdr.status);
+
     status = _gpuFabricProbeFullSanityCheck(pGpuFabricProbeInfoKernel);
     NV_CHECK_OR_RETURN(LEVEL_ERROR, status == NV_OK, status);
 
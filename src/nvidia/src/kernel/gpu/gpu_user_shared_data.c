@@ -190,6 +190,7 @@ gpuCreateRusdMemory_IMPL
 {
     NV_STATUS            status   = NV_OK;
     MEMORY_DESCRIPTOR  **ppMemDesc = &(pGpu->userSharedData.pMemDesc);
+    NV00DE_SHARED_DATA  *pSharedData;
 
     // RUSD is not yet supported when CPU CC is enabled. See bug 4148522.
     if ((sysGetStaticConfig(SYS_GET_INSTANCE()))->bOsCCEnabled)
@@ -211,6 +212,12 @@ gpuCreateRusdMemory_IMPL
 
     portMemSet(pGpu->userSharedData.pMapBuffer, 0, sizeof(NV00DE_SHARED_DATA));
 
+    // Arm the allocation watermarks so the first published sample takes effect
+    pSharedData = gpushareddataWriteStart(pGpu);
+    pSharedData->memWatermarks.info.minFreePmaMemory = RUSD_MEM_WATERMARK_UNARMED;
+    pSharedData->memWatermarks.info.minBar1AvailSize = RUSD_MEM_WATERMARK_UNARMED;
+    gpushareddataWriteFinish(pGpu);
+
     if (IS_GSP_CLIENT(pGpu))
     {
        // Init system memdesc on GSP
@@ -308,3 +315,37 @@ gpushareddataCtrlCmdRequestDataPoll_IMPL
 {
     return _gpushareddataRequestDataPoll(pData, pParams->polledDataMask);
 }
+
+NV_STATUS
+gpushareddataCtrlCmdResetMemoryWatermarks_IMPL
+(
+    GpuUserSharedData *pData,
+    NV00DE_CTRL_RESET_MEMORY_WATERMARKS_PARAMS *pParams
+)
+{
+    OBJGPU *pGpu = staticCast(pData, Memory)->pGpu;
+    NV00DE_SHARED_DATA *pSharedData;
+
+    if (pParams->watermarkMask == 0U)
+        return NV_ERR_INVALID_ARGUMENT;
+
+    //
+    // Restart tracking from the currently published values rather than the
+    // unarmed sentinel, so readers see a valid minimum immediately; the next
+    // allocation or free can only lower it.
+    //
+    pSharedData = gpushareddataWriteStart(pGpu);
+
+    if ((pParams->watermarkMask & NV00DE_RUSD_WATERMARK_PMA_FREE) != 0U)
+    {
+        pSharedData->memWatermarks.info.minFreePmaMemory = pSharedData->freePmaMemory;
+    }
+    if ((pParams->watermarkMask & NV00DE_RUSD_WATERMARK_BAR1_AVAIL) != 0U)
+    {
+        pSharedData->memWatermarks.info.minBar1AvailSize = pSharedData->bar1AvailSize;
+    }
+
+    gpushareddataWriteFinish(pGpu);
+
+    return NV_OK;
+}
@@ -1546,7 +1546,12 @@ kgraphicsInitCtxBufPool_IMPL
     Heap *pHeap
 )
 {
-    return ctxBufPoolInit(pGpu, pHeap, &pKernelGraphics->pCtxBufPool);
+    NV_ASSERT_OK_OR_RETURN(ctxBufPoolInit(pGpu, pHeap, &pKernelGraphics->pCtxBufPool));
+
+    // This pool lives until engine state destroy, so it can refill itself.
+    ctxBufPoolSetAutoRefill(pKernelGraphics->pCtxBufPool, NV_TRUE);
+
+    return NV_OK;
 }
 
 /*! Retrieve ctxbufpool for this engine */
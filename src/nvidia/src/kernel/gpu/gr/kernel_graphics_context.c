@@ -1155,24 +1155,37 @@ kgrctxAllocMainCtxBuffer_IMPL
         pCtxBufPool = pKernelChannel->pKernelChannelGroupApi->pKernelChannelGroup->pCtxBufPool;
     }
 
-    NV_CHECK_OK_OR_RETURN(LEVEL_ERROR,
-        memdescCreate(&pGrCtxBufferMemDesc, pGpu, ctxSize,
-                      RM_PAGE_SIZE, bIsContiguous, ADDR_UNKNOWN,
-                      pAttr->cpuAttr,
-                      allocFlags | MEMDESC_FLAGS_OWNED_BY_CURRENT_DEVICE));
-
     //
-    // Force page size to 4KB, we can change this later when RM access method
-    // support 64k pages
+    // Try to recycle a previously freed context buffer of the same size; the
+    // contents are reinitialized from the golden context image at promotion.
     //
-    NV_ASSERT_OK_OR_RETURN(
-        memmgrSetMemDescPageSize_HAL(pGpu, pMemoryManager, pGrCtxBufferMemDesc, AT_GPU, RM_ATTR_PAGE_SIZE_4KB));
+    if (pCtxBufPool == NULL)
+    {
+        pGrCtxBufferMemDesc = kgrmgrGetCachedMainCtxBuffer(pGpu,
+            GPU_GET_KERNEL_GRAPHICS_MANAGER(pGpu), ctxSize);
+    }
 
-    NV_ASSERT_OK_OR_RETURN(memdescSetCtxBufPool(pGrCtxBufferMemDesc, pCtxBufPool));
+    if (pGrCtxBufferMemDesc == NULL)
+    {
+        NV_CHECK_OK_OR_RETURN(LEVEL_ERROR,
+            memdescCreate(&pGrCtxBufferMemDesc, pGpu, ctxSize,
+                          RM_PAGE_SIZE, bIsContiguous, ADDR_UNKNOWN,
+                          pAttr->cpuAttr,
+                          allocFlags | MEMDESC_FLAGS_OWNED_BY_CURRENT_DEVICE));
 
-    NV_STATUS status;
-    memdescTagAllocList(status, NV_FB_ALLOC_RM_INTERNAL_OWNER_CONTEXT_BUFFER, pGrCtxBufferMemDesc, pAttr->pAllocList);
-    NV_ASSERT_OK_OR_RETURN(status);
+        //
+        // Force page size to 4KB, we can change this later when RM access method
+        // support 64k pages
+        //
+        NV_ASSERT_OK_OR_RETURN(
+            memmgrSetMemDescPageSize_HAL(pGpu, pMemoryManager, pGrCtxBufferMemDesc, AT_GPU, RM_ATTR_PAGE_SIZE_4KB));
+
+        NV_ASSERT_OK_OR_RETURN(memdescSetCtxBufPool(pGrCtxBufferMemDesc, pCtxBufPool));
+
+        NV_STATUS status;
+        memdescTagAllocList(status, NV_FB_ALLOC_RM_INTERNAL_OWNER_CONTEXT_BUFFER, pGrCtxBufferMemDesc, pAttr->pAllocList);
+        NV_ASSERT_OK_OR_RETURN(status);
+    }
 
     NV_ASSERT_OK_OR_RETURN(
         kchannelSetEngineContextMemDesc(pGpu, pKernelChannel,
@@ -2766,8 +2779,14 @@ kgrctxFreeMainCtxBuffer_IMPL
     NV_ASSERT(!gpumgrGetBcEnabledStatus(pGpu));
     if (pKernelGraphicsContextUnicast->pMainCtxBuffer != NULL)
     {
-        memdescFree(pKernelGraphicsContextUnicast->pMainCtxBuffer);
-        memdescDestroy(pKernelGraphicsContextUnicast->pMainCtxBuffer);
+        // Recycle the buffer for the next context if the cache will take it
+        if (!kgrmgrCacheMainCtxBuffer(pGpu,
+                GPU_GET_KERNEL_GRAPHICS_MANAGER(pGpu),
+                pKernelGraphicsContextUnicast->pMainCtxBuffer))
+        {
+            memdescFree(pKernelGraphicsContextUnicast->pMainCtxBuffer);
+            memdescDestroy(pKernelGraphicsContextUnicast->pMainCtxBuffer);
+        }
         pKernelGraphicsContextUnicast->pMainCtxBuffer = NULL;
         pKernelGraphicsContextUnicast->bKGrMainCtxBufferInitialized = NV_FALSE;
     }
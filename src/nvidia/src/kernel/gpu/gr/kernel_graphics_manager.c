@@ -302,6 +302,17 @@ _kgrmgrInitRegistryOverrides
     KernelGraphicsManager *pKernelGraphicsManager
 )
 {
+    NvU32 data32;
+
+    pKernelGraphicsManager->bMainCtxBufferCacheEnabled =
+        (NV_REG_STR_RM_GR_MAIN_CTX_BUFFER_CACHE_DEFAULT ==
+         NV_REG_STR_RM_GR_MAIN_CTX_BUFFER_CACHE_ENABLE);
+    if (osReadRegistryDword(pGpu,
+                            NV_REG_STR_RM_GR_MAIN_CTX_BUFFER_CACHE, &data32) == NV_OK)
+    {
+        pKernelGraphicsManager->bMainCtxBufferCacheEnabled =
+            (data32 == NV_REG_STR_RM_GR_MAIN_CTX_BUFFER_CACHE_ENABLE);
+    }
 }
 
 NV_STATUS
@@ -329,6 +340,8 @@ kgrmgrDestruct_IMPL
 
     fecsGlobalLoggingTeardown(pGpu, pKernelGraphicsManager);
 
+    kgrmgrFreeMainCtxBufferCache(pGpu, pKernelGraphicsManager);
+
     portMemSet(&pKernelGraphicsManager->legacyKgraphicsStaticInfo.floorsweepingMasks, 0,
            sizeof(pKernelGraphicsManager->legacyKgraphicsStaticInfo.floorsweepingMasks));
     portMemFree(pKernelGraphicsManager->legacyKgraphicsStaticInfo.pPpcMasks);
@@ -338,6 +351,120 @@ kgrmgrDestruct_IMPL
     pKernelGraphicsManager->legacyKgraphicsStaticInfo.bInitialized = NV_FALSE;
 }
 
+/*!
+ * @brief Fetch a recycled main GR context buffer of the given size, if any
+ *
+ * Returns a previously cached buffer and transfers ownership to the caller,
+ * or NULL if the cache is disabled or holds no buffer of a matching size.
+ *
+ * @param[in] pGpu
+ * @param[in] pKernelGraphicsManager
+ * @param[in] size                    required buffer size in bytes
+ */
+MEMORY_DESCRIPTOR *
+kgrmgrGetCachedMainCtxBuffer_IMPL
+(
+    OBJGPU *pGpu,
+    KernelGraphicsManager *pKernelGraphicsManager,
+    NvU64 size
+)
+{
+    NvU32 i;
+
+    if (!pKernelGraphicsManager->bMainCtxBufferCacheEnabled || IS_MIG_IN_USE(pGpu))
+        return NULL;
+
+    for (i = 0; i < NV_ARRAY_ELEMENTS(pKernelGraphicsManager->mainCtxBufferCache); ++i)
+    {
+        MEMORY_DESCRIPTOR *pMemDesc = pKernelGraphicsManager->mainCtxBufferCache[i];
+
+        if ((pMemDesc != NULL) && (memdescGetSize(pMemDesc) == size))
+        {
+            pKernelGraphicsManager->mainCtxBufferCache[i] = NULL;
+            return pMemDesc;
+        }
+    }
+
+    return NULL;
+}
+
+/*!
+ * @brief Offer a freed main GR context buffer to the recycling cache
+ *
+ * The contents of a recycled buffer are not scrubbed; they are fully
+ * reinitialized from the golden context image when the next context using
+ * the buffer is promoted. Buffers owned by a ctx buf pool must be returned
+ * to their pool and are never cached here.
+ *
+ * @param[in] pGpu
+ * @param[in] pKernelGraphicsManager
+ * @param[in] pMemDesc                buffer being freed
+ *
+ * @return NV_TRUE if the cache took ownership of the buffer
+ */
+NvBool
+kgrmgrCacheMainCtxBuffer_IMPL
+(
+    OBJGPU *pGpu,
+    KernelGraphicsManager *pKernelGraphicsManager,
+    MEMORY_DESCRIPTOR *pMemDesc
+)
+{
+    NvU32 i;
+
+    if (!pKernelGraphicsManager->bMainCtxBufferCacheEnabled || IS_MIG_IN_USE(pGpu))
+        return NV_FALSE;
+
+    if (memdescGetFlag(pMemDesc, MEMDESC_FLAGS_OWNED_BY_CTX_BUF_POOL))
+        return NV_FALSE;
+
+    // Only take ownership if this is the last reference to the buffer
+    if (pMemDesc->RefCount != 1)
+        return NV_FALSE;
+
+    for (i = 0; i < NV_ARRAY_ELEMENTS(pKernelGraphicsManager->mainCtxBufferCache); ++i)
+    {
+        if (pKernelGraphicsManager->mainCtxBufferCache[i] == NULL)
+        {
+            pKernelGraphicsManager->mainCtxBufferCache[i] = pMemDesc;
+            return NV_TRUE;
+        }
+    }
+
+    return NV_FALSE;
+}
+
+/*!
+ * @brief Free all main GR context buffers held by the recycling cache
+ *
+ * Must be called before the backing memory is repartitioned (e.g. when
+ * enabling MIG) and on teardown.
+ *
+ * @param[in] pGpu
+ * @param[in] pKernelGraphicsManager
+ */
+void
+kgrmgrFreeMainCtxBufferCache_IMPL
+(
+    OBJGPU *pGpu,
+    KernelGraphicsManager *pKernelGraphicsManager
+)
+{
+    NvU32 i;
+
+    for (i = 0; i < NV_ARRAY_ELEMENTS(pKernelGraphicsManager->mainCtxBufferCache); ++i)
+    {
+        MEMORY_DESCRIPTOR *pMemDesc = pKernelGraphicsManager->mainCtxBufferCache[i];
+
+        if (pMemDesc != NULL)
+        {
+            memdescFree(pMemDesc);
+            memdescDestroy(pMemDesc);
+            pKernelGraphicsManager->mainCtxBufferCache[i] = NULL;
+        }
+    }
+}
+
 /*!
  * @brief Set legacy Kgraphics Static Info (i.e. state of GR0)
  */
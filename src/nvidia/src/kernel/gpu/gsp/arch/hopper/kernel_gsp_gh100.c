@@ -841,6 +841,11 @@ kgspBootstrap_GH100
     // Link the status queue.
     NV_ASSERT_OK_OR_RETURN(GspStatusQueueInit(pGpu, &pKernelGsp->pRpc->pMessageQueueInfo));
 
+    if (pKernelGsp->pLocklessRpc != NULL)
+    {
+        NV_ASSERT_OK_OR_RETURN(GspStatusQueueInit(pGpu, &pKernelGsp->pLocklessRpc->pMessageQueueInfo));
+    }
+
     NV_ASSERT_OK_OR_RETURN(kgspWaitForRmInitDone(pGpu, pKernelGsp));
 
     NV_PRINTF(LEVEL_INFO, "GSP FW RM ready.\n");
@@ -486,6 +486,11 @@ kgspBootstrap_TU102
     // Link the status queue.
     NV_ASSERT_OK_OR_RETURN(GspStatusQueueInit(pGpu, &pKernelGsp->pRpc->pMessageQueueInfo));
 
+    if (pKernelGsp->pLocklessRpc != NULL)
+    {
+        NV_ASSERT_OK_OR_RETURN(GspStatusQueueInit(pGpu, &pKernelGsp->pLocklessRpc->pMessageQueueInfo));
+    }
+
     NV_ASSERT_OK_OR_RETURN(kgspWaitForRmInitDone(pGpu, pKernelGsp));
 
     NV_PRINTF(LEVEL_INFO, "GSP FW RM ready.\n");
@@ -923,6 +928,35 @@ exit_health_check:
     return bHealthy;
 }
 
+/*!
+ * Work item servicing a CrashCat _HALT outside of the interrupt path.
+ *
+ * Consuming a crash report walks the CrashCat queue and decodes and formats
+ * every packet in it, which is far too much work for the ISR -- on boards in
+ * an error storm this stalled interrupt servicing for healthy GPUs sharing
+ * the IRQ line.  The ISR only latches the halt and queues this work item;
+ * the reports sit in their preallocated queue buffer until decoded here.
+ */
+static void
+_kgspHaltHealthCheckWorkItem
+(
+    NvU32 gpuInstance,
+    void *pArgs
+)
+{
+    OBJGPU    *pGpu       = gpumgrGetGpu(gpuInstance);
+    KernelGsp *pKernelGsp = GPU_GET_KERNEL_GSP(pGpu);
+
+    //
+    // Clear the latch before consuming reports so a _HALT signaled during the
+    // health check queues a fresh work item rather than being lost.
+    //
+    portAtomicSetU32(&pKernelGsp->haltHealthCheckPending, 0);
+
+    kgspDumpGspLogs(pKernelGsp, NV_FALSE);
+    (void)kgspHealthCheck_HAL(pGpu, pKernelGsp);
+}
+
 /*!
  * GSP Interrupt Service Routine
  *
@@ -966,8 +1000,26 @@ kgspService_TU102
         kflcnRegWrite_HAL(pGpu, pKernelFalcon, NV_PFALCON_FALCON_IRQSCLR,
             DRF_DEF(_PFALCON, _FALCON_IRQSCLR, _HALT, _SET));
 
-        kgspDumpGspLogs(pKernelGsp, NV_FALSE);
-        (void)kgspHealthCheck_HAL(pGpu, pKernelGsp);
+        //
+        // Defer log collection and crash report decoding to a work item; see
+        // _kgspHaltHealthCheckWorkItem().  The latch collapses a _HALT storm
+        // into a single pending work item.  If the work item cannot be
+        // queued, fall back to inline handling -- a fatal report must not be
+        // dropped.
+        //
+        if (portAtomicCompareAndSwapU32(&pKernelGsp->haltHealthCheckPending, 1, 0))
+        {
+            if (osQueueWorkItemWithFlags(pGpu,
+                                         _kgspHaltHealthCheckWorkItem,
+                                         NULL,
+                                         OS_QUEUE_WORKITEM_FLAGS_LOCK_API_RW |
+                                         OS_QUEUE_WORKITEM_FLAGS_LOCK_GPUS_RW) != NV_OK)
+            {
+                portAtomicSetU32(&pKernelGsp->haltHealthCheckPending, 0);
+                kgspDumpGspLogs(pKernelGsp, NV_FALSE);
+                (void)kgspHealthCheck_HAL(pGpu, pKernelGsp);
+            }
+        }
     }
     if (intrStatus & DRF_DEF(_PFALCON, _FALCON_IRQSTAT, _SWGEN0, _TRUE))
     {
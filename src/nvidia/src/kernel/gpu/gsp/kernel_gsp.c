@@ -29,6 +29,7 @@
 #include "kernel/core/locks.h"
 #include "kernel/diagnostics/gpu_acct.h"
 #include "kernel/diagnostics/journal.h"
+#include "kernel/diagnostics/profiler.h"
 #include "kernel/gpu/fifo/kernel_channel.h"
 #include "kernel/gpu/gsp/gsp_trace_rats_macro.h"
 #include "kernel/gpu/intr/engine_idx.h"
@@ -327,6 +328,67 @@ _kgspCompleteRpcHistoryEntry
     }
 }
 
+/*!
+ * Fold a completed RPC into the always-on latency profile: trace ring,
+ * latency histogram, and per-function accumulators.
+ *
+ * RPCs complete under the GPU lock, so there is a single writer per GPU and
+ * plain stores suffice; the atomic ring index only keeps concurrent profile
+ * readers from tearing the "newest entry" position.
+ */
+static void
+_kgspRpcProfileRecord
+(
+    KernelGsp *pKernelGsp,
+    const RpcHistoryEntry *pEntry
+)
+{
+    KernelGspRpcProfile *pProf = &pKernelGsp->rpcProfile;
+    const NvU64 tsFreqUs = osGetTimestampFreq() / 1000000;
+    NvU64 durationUs;
+    NvU64 scale;
+    NvU32 bucket;
+    NvU32 slot;
+    NvU32 i;
+
+    if ((tsFreqUs == 0) || (pEntry->ts_end <= pEntry->ts_start))
+        return;
+
+    durationUs = (pEntry->ts_end - pEntry->ts_start) / tsFreqUs;
+
+    slot = (portAtomicIncrementU32(&pProf->ringNext) - 1) % KGSP_RPC_PROF_RING_DEPTH;
+    pProf->ring[slot].function   = pEntry->function;
+    pProf->ring[slot].durationUs = (durationUs > NV_U32_MAX) ? NV_U32_MAX : (NvU32)durationUs;
+    pProf->ring[slot].ts_start   = pEntry->ts_start;
+
+    // Bucket i counts durations in [2^i, 2^(i+1)) us; the last bucket is open-ended.
+    bucket = 0;
+    scale  = durationUs;
+    while (((scale >>= 1) != 0) && (bucket < KGSP_RPC_PROF_HIST_BUCKETS - 1))
+        bucket++;
+    pProf->histogram[bucket]++;
+
+    for (i = 0; i < pProf->numFuncs; i++)
+    {
+        if (pProf->funcs[i].function == pEntry->function)
+            break;
+    }
+    if (i == pProf->numFuncs)
+    {
+        // Out of per-function slots; the histogram still counts the RPC.
+        if (i >= KGSP_RPC_PROF_FUNC_SLOTS)
+            return;
+
+        pProf->funcs[i].function = pEntry->function;
+        pProf->numFuncs = i + 1;
+    }
+
+    pProf->funcs[i].count++;
+    pProf->funcs[i].totalUs += durationUs;
+    if (durationUs > pProf->funcs[i].maxUs)
+        pProf->funcs[i].maxUs = (durationUs > NV_U32_MAX) ? NV_U32_MAX : (NvU32)durationUs;
+}
+
 /*!
  * GSP client RM RPC send routine
  */
@@ -359,7 +421,18 @@ _kgspRpcSendMessage
         return nvStatus;
     }
 
-    kgspSetCmdQueueHead_HAL(pGpu, pKernelGsp, pRpc->pMessageQueueInfo->queueIdx, 0);
+    //
+    // Defer the doorbell if a coalescing batch is open (see
+    // GspMsgQueueTxBatchBegin); the batch rings it once for all sends.
+    //
+    if (pRpc->pMessageQueueInfo->txBatchDepth > 0)
+    {
+        pRpc->pMessageQueueInfo->bTxDoorbellPending = NV_TRUE;
+    }
+    else
+    {
+        kgspSetCmdQueueHead_HAL(pGpu, pKernelGsp, pRpc->pMessageQueueInfo->queueIdx, 0);
+    }
 
     _kgspAddRpcHistoryEntry(pRpc, pRpc->rpcHistory, &pRpc->rpcHistoryCurrent);
 
@@ -624,9 +697,23 @@ kgspRcAndNotifyAllUserChannels
     KernelFifo       *pKernelFifo = GPU_GET_KERNEL_FIFO(pGpu);
     CHANNEL_ITERATOR  chanIt;
     RMTIMEOUT         timeout;
+    NvU32             maxRunlists = kfifoGetMaxNumRunlists_HAL(pGpu, pKernelFifo);
+    NvBool           *pRunlistWaited;
 
     NV_PRINTF(LEVEL_ERROR, "RC all user channels for critical error %d.\n", exceptType);
 
+    //
+    // Channel halts are preempted at runlist scope, so one completion wait
+    // per runlist covers every channel halted on it. Track which runlists
+    // have already been waited on; if the tracking allocation fails, fall
+    // back to waiting per channel.
+    //
+    pRunlistWaited = portMemAllocNonPaged(sizeof(NvBool) * maxRunlists);
+    if (pRunlistWaited != NULL)
+    {
+        portMemSet(pRunlistWaited, 0, sizeof(NvBool) * maxRunlists);
+    }
+
     // Pass 1: halt all user channels.
     kfifoGetChannelIterator(pGpu, pKernelFifo, &chanIt, INVALID_RUNLIST_ID);
     while (kfifoGetNextKernelChannel(pGpu, pKernelFifo, &chanIt, &pKernelChannel) == NV_OK)
@@ -660,7 +747,18 @@ kgspRcAndNotifyAllUserChannels
             continue;
         }
 
-        kfifoCompleteChannelHalt(pGpu, pKernelFifo, pKernelChannel, &timeout);
+        NvU32 runlistId = kchannelGetRunlistId(pKernelChannel);
+
+        if ((pRunlistWaited == NULL) || (runlistId >= maxRunlists) ||
+            !pRunlistWaited[runlistId])
+        {
+            kfifoCompleteChannelHalt(pGpu, pKernelFifo, pKernelChannel, &timeout);
+
+            if ((pRunlistWaited != NULL) && (runlistId < maxRunlists))
+            {
+                pRunlistWaited[runlistId] = NV_TRUE;
+            }
+        }
 
         NV_ASSERT_OK(krcErrorSetNotifier(pGpu, pKernelRc,
                                          pKernelChannel,
@@ -675,6 +773,8 @@ kgspRcAndNotifyAllUserChannels
             RC_NOTIFIER_SCOPE_CHANNEL,
             0));
     }
+
+    portMemFree(pRunlistWaited);
 }
 
 /*!
@@ -1627,7 +1727,17 @@ _kgspRpcDrainEvents
 
     while (nvStatus == NV_OK)
     {
-        nvStatus = _kgspRpcDrainOneEvent(pGpu, pRpc, expectedFunc, rpcHandlerContext);
+        //
+        // Drain all messages GSP has already posted before flushing the logs:
+        // during allocation storms many responses and events are pending at
+        // once, and one log flush per burst is enough.
+        //
+        do
+        {
+            nvStatus = _kgspRpcDrainOneEvent(pGpu, pRpc, expectedFunc, rpcHandlerContext);
+        } while ((nvStatus == NV_OK) &&
+                 (GspMsgQueueRxPending(pRpc->pMessageQueueInfo) > 0));
+
         kgspDumpGspLogs(pKernelGsp, NV_FALSE);
     }
 
@@ -1899,6 +2009,7 @@ _kgspRpcRecvPoll
     NvU32      timeoutFlags;
     NvBool     bSlowGspRpc = IS_EMULATION(pGpu) || IS_SIMULATION(pGpu);
     NvU32      gpuMaskUnused;
+    NvU64      profStart;
 
     KernelGspRpcEventHandlerContext rpcHandlerContext = KGSP_RPC_EVENT_HANDLER_CONTEXT_POLL;
     if (expectedFunc == NV_VGPU_MSG_EVENT_GSP_INIT_DONE)
@@ -1920,6 +2031,8 @@ _kgspRpcRecvPoll
     NV_ASSERT_OR_RETURN(!pKernelGsp->bPollingForRpcResponse, NV_ERR_INVALID_STATE);
     pKernelGsp->bPollingForRpcResponse = NV_TRUE;
 
+    profStart = RM_PROF_PHASE_BEGIN(RM_PROF_PHASE_GSP_RPC_WAIT);
+
     //
     // GSP-RM init in emulation/simulation environment is extremely slow,
     // so need to increment timeout.
@@ -1977,6 +2090,7 @@ _kgspRpcRecvPoll
             case NV_WARN_MORE_PROCESSING_REQUIRED:
                 // The synchronous RPC response we were waiting for is here
                 _kgspCompleteRpcHistoryEntry(pRpc->rpcHistory, pRpc->rpcHistoryCurrent);
+                _kgspRpcProfileRecord(pKernelGsp, &pRpc->rpcHistory[pRpc->rpcHistoryCurrent]);
                 rpcStatus = NV_OK;
                 goto done;
             case NV_OK:
@@ -2015,6 +2129,8 @@ _kgspRpcRecvPoll
     pRpc->timeoutCount = 0;
 
 done:
+    RM_PROF_PHASE_END(RM_PROF_PHASE_GSP_RPC_WAIT, profStart);
+
     pKernelGsp->bPollingForRpcResponse = NV_FALSE;
 
     if (bSlowGspRpc)
@@ -2026,6 +2142,85 @@ done:
     return rpcStatus;
 }
 
+/*!
+ * Context for an RPC exchange deferred via kgspQueueAsyncRpc().
+ */
+typedef struct KGSP_ASYNC_RPC_CONTEXT
+{
+    KernelGspAsyncRpcIssueFunc *pfnIssue;
+    KernelGspAsyncRpcCallback  *pfnCallback;
+    void                       *pRpcData;
+} KGSP_ASYNC_RPC_CONTEXT;
+
+static void
+_kgspAsyncRpcWorkItem
+(
+    NvU32 gpuInstance,
+    void *pArgs
+)
+{
+    OBJGPU *pGpu = gpumgrGetGpu(gpuInstance);
+    KGSP_ASYNC_RPC_CONTEXT *pCtx = (KGSP_ASYNC_RPC_CONTEXT *)pArgs;
+    NV_STATUS status;
+
+    status = pCtx->pfnIssue(pGpu, pCtx->pRpcData);
+
+    if (pCtx->pfnCallback != NULL)
+    {
+        pCtx->pfnCallback(pGpu, pCtx->pRpcData, status);
+    }
+}
+
+/*!
+ * Queue an RPC exchange to run asynchronously from a work item.
+ *
+ * _kgspRpcRecvPoll() blocks the issuing thread for the full GSP round trip
+ * with the GPU lock held.  Callers that do not need the RPC result inline can
+ * use this helper to move the exchange off their critical path: the issue
+ * function runs from a work item with the API and GPU locks held and performs
+ * the RPC exchange as usual, and the optional completion callback is invoked
+ * with its status.  RPC responses are only processed under the GPU lock, so
+ * completion cannot be driven directly from the interrupt top half; the work
+ * item is the earliest context in which the exchange can legally run.
+ */
+NV_STATUS
+kgspQueueAsyncRpc_IMPL
+(
+    OBJGPU    *pGpu,
+    KernelGsp *pKernelGsp,
+    KernelGspAsyncRpcIssueFunc *pfnIssue,
+    KernelGspAsyncRpcCallback  *pfnCallback,
+    void      *pRpcData
+)
+{
+    NV_STATUS status;
+    KGSP_ASYNC_RPC_CONTEXT *pCtx;
+
+    NV_ASSERT_OR_RETURN(pfnIssue != NULL, NV_ERR_INVALID_ARGUMENT);
+
+    pCtx = portMemAllocNonPaged(sizeof(*pCtx));
+    if (pCtx == NULL)
+    {
+        return NV_ERR_NO_MEMORY;
+    }
+
+    pCtx->pfnIssue    = pfnIssue;
+    pCtx->pfnCallback = pfnCallback;
+    pCtx->pRpcData    = pRpcData;
+
+    status = osQueueWorkItemWithFlags(pGpu,
+                                      _kgspAsyncRpcWorkItem,
+                                      (void *)pCtx,
+                                      OS_QUEUE_WORKITEM_FLAGS_LOCK_API_RW |
+                                      OS_QUEUE_WORKITEM_FLAGS_LOCK_GPUS_RW);
+    if (status != NV_OK)
+    {
+        portMemFree(pCtx);
+    }
+
+    return status;
+}
+
 /*!
  * Initialize RPC objects required for interfacing with GSP.
  */
@@ -2144,6 +2339,26 @@ _kgspFreeRpcInfrastructure
     GspMsgQueuesCleanup(&pKernelGsp->pMQCollection);
 }
 
+/*!
+ * Get the RPC object backed by the task ISR message queue, used as a
+ * high-priority lane for latency-sensitive RPCs.  Unlike the task RM queue,
+ * this queue is not shared with bulk traffic (e.g. FB region programming or
+ * large control payloads), so RPCs issued on it are not subject to
+ * head-of-line blocking behind a slow operation already queued to task RM.
+ *
+ * Returns NULL when the task ISR queue is not enabled; callers are expected
+ * to fall back to the regular RPC object.
+ */
+OBJRPC *
+kgspGetHighPriorityRpc_IMPL
+(
+    OBJGPU    *pGpu,
+    KernelGsp *pKernelGsp
+)
+{
+    return pKernelGsp->pLocklessRpc;
+}
+
 /*!
  * Convert init arg name to 64bit id value.
  *
@@ -2709,6 +2924,21 @@ kgspConstructEngine_IMPL
 
     kgspConfigureFalcon_HAL(pGpu, pKernelGsp);
 
+    //
+    // The task ISR queue doubles as a high-priority RPC lane (see
+    // kgspGetHighPriorityRpc).  Opt in via regkey on chips that do not
+    // already require the queue.
+    //
+    {
+        NvU32 data = NV_REG_STR_RM_GSP_HIGH_PRIO_RPC_QUEUE_DEFAULT;
+
+        if ((osReadRegistryDword(pGpu, NV_REG_STR_RM_GSP_HIGH_PRIO_RPC_QUEUE, &data) == NV_OK) &&
+            (data == NV_REG_STR_RM_GSP_HIGH_PRIO_RPC_QUEUE_ENABLE))
+        {
+            pKernelGsp->bIsTaskIsrQueueRequired = NV_TRUE;
+        }
+    }
+
     // Init RPC objects used to communicate with GSP.
     nvStatus = _kgspInitRpcInfrastructure(pGpu, pKernelGsp);
     if (nvStatus != NV_OK)
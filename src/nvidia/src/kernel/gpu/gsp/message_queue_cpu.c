@@ -476,6 +476,49 @@ void GspMsgQueuesCleanup(MESSAGE_QUEUE_COLLECTION **ppMQCollection)
     *ppMQCollection = NULL;
 }
 
+/*!
+ * GspMsgQueueTxBatchBegin
+ *
+ * Open a doorbell coalescing batch.  While a batch is open, sends on this
+ * queue update the shared write pointer as usual but do not ring the GSP
+ * doorbell; GspMsgQueueTxBatchEnd rings it once for all sends in the batch.
+ * Batches nest.
+ */
+void GspMsgQueueTxBatchBegin(MESSAGE_QUEUE_INFO *pMQI)
+{
+    pMQI->txBatchDepth++;
+}
+
+/*!
+ * GspMsgQueueTxBatchEnd
+ *
+ * Close a doorbell coalescing batch, ringing the GSP doorbell if any send
+ * was submitted while the batch was open.
+ */
+void GspMsgQueueTxBatchEnd(MESSAGE_QUEUE_INFO *pMQI, OBJGPU *pGpu)
+{
+    NV_ASSERT_OR_RETURN_VOID(pMQI->txBatchDepth > 0);
+
+    if ((--pMQI->txBatchDepth == 0) && pMQI->bTxDoorbellPending)
+    {
+        pMQI->bTxDoorbellPending = NV_FALSE;
+        kgspSetCmdQueueHead_HAL(pGpu, GPU_GET_KERNEL_GSP(pGpu), pMQI->queueIdx, 0);
+    }
+}
+
+/*!
+ * GspMsgQueueRxPending
+ *
+ * Returns the number of unread queue elements currently posted by the peer.
+ */
+NvU32 GspMsgQueueRxPending(MESSAGE_QUEUE_INFO *pMQI)
+{
+    if ((pMQI == NULL) || (pMQI->hQueue == NULL))
+        return 0;
+
+    return msgqRxGetReadAvailable(pMQI->hQueue);
+}
+
 /*!
  * GspMsgQueueSendCommand
  *
@@ -575,6 +618,17 @@ NV_STATUS GspMsgQueueSendCommand(MESSAGE_QUEUE_INFO *pMQI, OBJGPU *pGpu)
             if (gpuCheckTimeout(pGpu, &timeout) != NV_OK)
                 break;
 
+            //
+            // If a doorbell was deferred by an open coalescing batch, flush
+            // it now: GSP must be notified before it will drain the queue
+            // and make space for the remaining elements.
+            //
+            if (pMQI->bTxDoorbellPending)
+            {
+                pMQI->bTxDoorbellPending = NV_FALSE;
+                kgspSetCmdQueueHead_HAL(pGpu, GPU_GET_KERNEL_GSP(pGpu), pMQI->queueIdx, 0);
+            }
+
             portAtomicMemoryFenceFull();
 
             osSpinLoop();
@@ -48,7 +48,7 @@ intrReadRegTopEnSet_CPU_GA102
     {
         return 0x0;
     }
-    return GPU_VREG_RD32_EX(pGpu,
+    return GPU_VREG_RD32_FAST(pGpu,
                             NV_VIRTUAL_FUNCTION_PRIV_CPU_INTR_TOP_EN_SET(regIndex),
                             pThreadState);
 }
@@ -69,7 +69,7 @@ intrWriteRegTopEnSet_CPU_GA102
     {
         return;
     }
-    GPU_VREG_WR32_EX(pGpu,
+    GPU_VREG_WR32_FAST(pGpu,
                      NV_VIRTUAL_FUNCTION_PRIV_CPU_INTR_TOP_EN_SET(regIndex),
                      value,
                      pThreadState);
@@ -91,7 +91,7 @@ intrWriteRegTopEnClear_CPU_GA102
     {
         return;
     }
-    GPU_VREG_WR32_EX(pGpu,
+    GPU_VREG_WR32_FAST(pGpu,
                      NV_VIRTUAL_FUNCTION_PRIV_CPU_INTR_TOP_EN_CLEAR(regIndex),
                      value,
                      pThreadState);
@@ -42,7 +42,7 @@ intrReadRegLeafEnSet_CPU_TU102
     THREAD_STATE_NODE  *pThreadState
 )
 {
-    return GPU_VREG_RD32_EX(pGpu,
+    return GPU_VREG_RD32_FAST(pGpu,
                             NV_VIRTUAL_FUNCTION_PRIV_CPU_INTR_LEAF_EN_SET(regIndex),
                             pThreadState);
 }
@@ -56,7 +56,7 @@ intrReadRegLeaf_CPU_TU102
     THREAD_STATE_NODE  *pThreadState
 )
 {
-    return GPU_VREG_RD32_EX(pGpu,
+    return GPU_VREG_RD32_FAST(pGpu,
                             NV_VIRTUAL_FUNCTION_PRIV_CPU_INTR_LEAF(regIndex),
                             pThreadState);
 }
@@ -76,7 +76,7 @@ intrReadRegTopEnSet_CPU_TU102
     {
         return 0x0;
     }
-    return GPU_VREG_RD32_EX(pGpu,
+    return GPU_VREG_RD32_FAST(pGpu,
                             NV_VIRTUAL_FUNCTION_PRIV_CPU_INTR_TOP_EN_SET(regIndex),
                             pThreadState);
 }
@@ -96,7 +96,7 @@ intrReadRegTop_CPU_TU102
     {
         return 0x0;
     }
-    return GPU_VREG_RD32_EX(pGpu,
+    return GPU_VREG_RD32_FAST(pGpu,
                             NV_VIRTUAL_FUNCTION_PRIV_CPU_INTR_TOP(regIndex),
                             pThreadState);
 }
@@ -111,7 +111,7 @@ intrWriteRegLeafEnSet_CPU_TU102
     THREAD_STATE_NODE  *pThreadState
 )
 {
-    GPU_VREG_WR32_EX(pGpu,
+    GPU_VREG_WR32_FAST(pGpu,
                      NV_VIRTUAL_FUNCTION_PRIV_CPU_INTR_LEAF_EN_SET(regIndex),
                      value,
                      pThreadState);
@@ -127,7 +127,7 @@ intrWriteRegLeafEnClear_CPU_TU102
     THREAD_STATE_NODE  *pThreadState
 )
 {
-    GPU_VREG_WR32_EX(pGpu,
+    GPU_VREG_WR32_FAST(pGpu,
                      NV_VIRTUAL_FUNCTION_PRIV_CPU_INTR_LEAF_EN_CLEAR(regIndex),
                      value,
                      pThreadState);
@@ -143,7 +143,7 @@ intrWriteRegLeaf_CPU_TU102
     THREAD_STATE_NODE  *pThreadState
 )
 {
-    GPU_VREG_WR32_EX(pGpu,
+    GPU_VREG_WR32_FAST(pGpu,
                      NV_VIRTUAL_FUNCTION_PRIV_CPU_INTR_LEAF(regIndex),
                      value,
                      pThreadState);
@@ -165,7 +165,7 @@ intrWriteRegTopEnSet_CPU_TU102
     {
         return;
     }
-    GPU_VREG_WR32_EX(pGpu,
+    GPU_VREG_WR32_FAST(pGpu,
                      NV_VIRTUAL_FUNCTION_PRIV_CPU_INTR_TOP_EN_SET(regIndex),
                      value,
                      pThreadState);
@@ -187,7 +187,7 @@ intrWriteRegTopEnClear_CPU_TU102
     {
         return;
     }
-    GPU_VREG_WR32_EX(pGpu,
+    GPU_VREG_WR32_FAST(pGpu,
                      NV_VIRTUAL_FUNCTION_PRIV_CPU_INTR_TOP_EN_CLEAR(regIndex),
                      value,
                      pThreadState);
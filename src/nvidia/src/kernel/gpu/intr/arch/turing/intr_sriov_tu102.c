@@ -47,15 +47,18 @@ intrServiceVirtual_TU102
     Intr    *pIntr
 )
 {
+    REG_ACCESS_BATCH batch;
     NvU32 i;
 
+    regAccessBatchBegin(GPU_GET_REGISTER_ACCESS(pGpu), NULL, &batch);
+
     // For now, servicing only involves clearing interrupts from all GFIDs
     for (i = 0; i < NV_CTRL_VIRTUAL_INTR_LEAF__SIZE_1; i++)
     {
-        NvU32 val = GPU_REG_RD32(pGpu, NV_CTRL_VIRTUAL_INTR_LEAF(i));
+        NvU32 val = regAccessBatchRead032(&batch, NV_CTRL_VIRTUAL_INTR_LEAF(i));
         if (val != 0)
         {
-            GPU_REG_WR32(pGpu, NV_CTRL_VIRTUAL_INTR_LEAF(i), val);
+            regAccessBatchWrite032(&batch, NV_CTRL_VIRTUAL_INTR_LEAF(i), val);
         }
     }
 }
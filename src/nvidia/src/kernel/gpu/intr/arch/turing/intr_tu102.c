@@ -827,59 +827,103 @@ intrGetPendingStallEngines_TU102
     }
 
     NV_ASSERT_OK_OR_RETURN(intrGetLeafStatus_HAL(pGpu, pIntr, intrLeafValues, pThreadState));
-    NV_ASSERT_OK_OR_RETURN(intrGetInterruptTable_HAL(pGpu, pIntr, &pIntrTable));
 
-    for (iter = vectIterAll(pIntrTable); vectIterNext(&iter);)
+    if (pIntr->vectorToMcIdx[INTR_TREE_CPU] != NULL)
     {
-        INTR_TABLE_ENTRY *pEntry     = iter.pValue;
-        NvU32             intrVector = pEntry->intrVector;
-        NvU32             leaf;
-        NvU32             leafIndex;
-        NvU32             leafBit;
-
-        // Check if this engine has a valid stalling interrupt vector in the new tree
-        if (intrVector == NV_INTR_VECTOR_INVALID)
-        {
-            continue;
-        }
-
-        leafIndex = NV_CTRL_INTR_GPU_VECTOR_TO_LEAF_REG(intrVector);
-        leafBit = NV_CTRL_INTR_GPU_VECTOR_TO_LEAF_BIT(intrVector);
-
         //
-        // The leafIndex must be within the stall tree. Try to catch this on
-        // pre-release drivers. Don't need this on release drivers since this
-        // is only to catch issues during code development. Should never happen
-        // in practice
+        // Fast path: translate each pending leaf bit directly to its engine
+        // via the flattened per-vector dispatch table, so cost scales with
+        // the number of pending vectors rather than the size of the
+        // interrupt table. Entries were sanity-checked against the stall
+        // subtrees when the table was built.
         //
+        const InterruptEntry *pVectorMap = pIntr->vectorToMcIdx[INTR_TREE_CPU];
+        NvU64 *pVectorCounts             = pIntr->vectorIntrCount[INTR_TREE_CPU];
+        NvU32  leafIndex;
 
-        if ((sanityCheckSubtreeMask &
-             NVBIT64(NV_CTRL_INTR_LEAF_IDX_TO_SUBTREE(leafIndex))) == 0)
+        for (leafIndex = 0; leafIndex < numIntrLeaves; leafIndex++)
         {
-            NV_PRINTF(LEVEL_ERROR,
-                      "MC_ENGINE_IDX %u has invalid stall intr vector %u\n",
-                      pEntry->mcEngine,
-                      intrVector);
-            DBG_BREAKPOINT();
-            continue;
+            NvU32 pending = intrLeafValues[leafIndex];
+
+            while (pending != 0)
+            {
+                NvU32 leafBit    = portUtilCountTrailingZeros32(pending);
+                NvU32 intrVector =
+                    NV_CTRL_INTR_LEAF_IDX_TO_GPU_VECTOR_START(leafIndex) +
+                    leafBit;
+
+                pending &= ~NVBIT(leafBit);
+
+                if (intrVector >= pIntr->vectorToMcIdxCounts[INTR_TREE_CPU])
+                {
+                    continue;
+                }
+
+                pVectorCounts[intrVector]++;
+
+                if (!interruptEntryIsEmpty(&pVectorMap[intrVector]))
+                {
+                    bitVectorSet(pEngines, pVectorMap[intrVector].mcEngine);
+                }
+            }
         }
-        //
-        // Check if interrupt is pending. We skip checking if it is enabled in
-        // the leaf register since we mess around with the leaf enables in
-        // the interrupt disable path and will need special casing to handle it
-        // In the transition period from NV_PMC to NV_CTRL, the interrupt vector
-        // for engines that haven't yet switched would be INVALID, so we'd never
-        // get here anyway.
-        //
-        leaf = intrLeafValues[leafIndex] & NVBIT(leafBit);
+    }
+    else
+    {
+        NV_ASSERT_OK_OR_RETURN(intrGetInterruptTable_HAL(pGpu, pIntr, &pIntrTable));
 
-        if (leaf == 0)
+        for (iter = vectIterAll(pIntrTable); vectIterNext(&iter);)
         {
-            continue;
-        }
+            INTR_TABLE_ENTRY *pEntry     = iter.pValue;
+            NvU32             intrVector = pEntry->intrVector;
+            NvU32             leaf;
+            NvU32             leafIndex;
+            NvU32             leafBit;
+
+            // Check if this engine has a valid stalling interrupt vector in the new tree
+            if (intrVector == NV_INTR_VECTOR_INVALID)
+            {
+                continue;
+            }
+
+            leafIndex = NV_CTRL_INTR_GPU_VECTOR_TO_LEAF_REG(intrVector);
+            leafBit = NV_CTRL_INTR_GPU_VECTOR_TO_LEAF_BIT(intrVector);
 
-        // Add engine to bitvector
-        bitVectorSet(pEngines, pEntry->mcEngine);
+            //
+            // The leafIndex must be within the stall tree. Try to catch this on
+            // pre-release drivers. Don't need this on release drivers since this
+            // is only to catch issues during code development. Should never happen
+            // in practice
+            //
+
+            if ((sanityCheckSubtreeMask &
+                 NVBIT64(NV_CTRL_INTR_LEAF_IDX_TO_SUBTREE(leafIndex))) == 0)
+            {
+                NV_PRINTF(LEVEL_ERROR,
+                          "MC_ENGINE_IDX %u has invalid stall intr vector %u\n",
+                          pEntry->mcEngine,
+                          intrVector);
+                DBG_BREAKPOINT();
+                continue;
+            }
+            //
+            // Check if interrupt is pending. We skip checking if it is enabled in
+            // the leaf register since we mess around with the leaf enables in
+            // the interrupt disable path and will need special casing to handle it
+            // In the transition period from NV_PMC to NV_CTRL, the interrupt vector
+            // for engines that haven't yet switched would be INVALID, so we'd never
+            // get here anyway.
+            //
+            leaf = intrLeafValues[leafIndex] & NVBIT(leafBit);
+
+            if (leaf == 0)
+            {
+                continue;
+            }
+
+            // Add engine to bitvector
+            bitVectorSet(pEngines, pEntry->mcEngine);
+        }
     }
 
     if (pKernelGmmu != NULL)
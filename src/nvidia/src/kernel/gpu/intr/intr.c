@@ -1060,6 +1060,17 @@ intrInitInterruptTable_KERNEL
     portMemCopy(pIntr->subtreeMap,   sizeof pIntr->subtreeMap,
                 pParams->subtreeMap, sizeof pParams->subtreeMap);
 
+    //
+    // Flatten the new table into the per-vector dispatch map. This is best
+    // effort: on failure, stall servicing falls back to walking the
+    // interrupt table.
+    //
+    if (intrBuildVectorToMcIdxTable(pGpu, pIntr) != NV_OK)
+    {
+        NV_PRINTF(LEVEL_WARNING,
+                  "Failed to build per-vector interrupt dispatch table\n");
+    }
+
 exit:
     portMemFree(pParams);
     return status;
@@ -1283,6 +1294,8 @@ intrDestroyInterruptTable_IMPL
     {
         portMemFree(pIntr->vectorToMcIdx[tree]);
         pIntr->vectorToMcIdx[tree]       = NULL;
+        portMemFree(pIntr->vectorIntrCount[tree]);
+        pIntr->vectorIntrCount[tree]     = NULL;
         pIntr->vectorToMcIdxCounts[tree] = 0;
     }
 
@@ -1777,3 +1790,140 @@ NV_STATUS intrSetInterruptEntry_IMPL
     pIntr->vectorToMcIdx[tree][vector] = *pEntry;
     return NV_OK;
 }
+
+
+/*!
+ * @brief Build the per-vector interrupt dispatch table.
+ *
+ * Flattens the interrupt table into Intr.vectorToMcIdx so that stall
+ * interrupt servicing can translate a pending leaf bit directly to its
+ * mcEngine instead of walking the full interrupt table on every interrupt,
+ * and allocates the matching per-vector interrupt counters. This must be
+ * re-run whenever the interrupt table is re-fetched.
+ *
+ * If the flattened table cannot be built (e.g. two engines unexpectedly
+ * share a stall vector), any partial state is freed and stall servicing
+ * falls back to walking the interrupt table.
+ */
+NV_STATUS
+intrBuildVectorToMcIdxTable_IMPL
+(
+    OBJGPU *pGpu,
+    Intr   *pIntr
+)
+{
+    NvU64              stallSubtreeMask;
+    NvU32              numLeaves = intrGetNumLeaves_HAL(pGpu, pIntr);
+    NvU32              numVectors;
+    InterruptTableIter iter;
+    NV_STATUS          status;
+
+    // dev_ctrl tree is not used for legacy-vGPU
+    if (IS_VIRTUAL_WITHOUT_SRIOV(pGpu))
+    {
+        return NV_OK;
+    }
+
+    NV_ASSERT_OR_RETURN(numLeaves > 0 && numLeaves <= NV_MAX_INTR_LEAVES,
+                        NV_ERR_INVALID_STATE);
+    numVectors = NV_CTRL_INTR_LEAF_IDX_TO_GPU_VECTOR_END(numLeaves - 1) + 1;
+    stallSubtreeMask = intrGetIntrTopLegacyStallMask(pIntr);
+
+    for (INTR_TREE tree = 0; tree < NV_ARRAY_ELEMENTS(pIntr->vectorToMcIdx);
+         ++tree)
+    {
+        portMemFree(pIntr->vectorToMcIdx[tree]);
+        pIntr->vectorToMcIdx[tree]       = NULL;
+        portMemFree(pIntr->vectorIntrCount[tree]);
+        pIntr->vectorIntrCount[tree]     = NULL;
+        pIntr->vectorToMcIdxCounts[tree] = 0;
+    }
+
+    pIntr->vectorToMcIdx[INTR_TREE_CPU] =
+        portMemAllocNonPaged(numVectors * sizeof(InterruptEntry));
+    pIntr->vectorIntrCount[INTR_TREE_CPU] =
+        portMemAllocNonPaged(numVectors * sizeof(NvU64));
+    if ((pIntr->vectorToMcIdx[INTR_TREE_CPU] == NULL) ||
+        (pIntr->vectorIntrCount[INTR_TREE_CPU] == NULL))
+    {
+        status = NV_ERR_NO_MEMORY;
+        goto error;
+    }
+
+    // MC_ENGINE_IDX_NULL is 0, so zero-fill marks every vector as empty
+    portMemSet(pIntr->vectorToMcIdx[INTR_TREE_CPU], 0,
+               numVectors * sizeof(InterruptEntry));
+    portMemSet(pIntr->vectorIntrCount[INTR_TREE_CPU], 0,
+               numVectors * sizeof(NvU64));
+    pIntr->vectorToMcIdxCounts[INTR_TREE_CPU] = numVectors;
+
+    for (iter = vectIterAll(&pIntr->intrTable); vectIterNext(&iter);)
+    {
+        INTR_TABLE_ENTRY *pTableEntry = iter.pValue;
+        NvU32             intrVector  = pTableEntry->intrVector;
+        InterruptEntry    entry;
+
+        if (intrVector == NV_INTR_VECTOR_INVALID)
+        {
+            continue;
+        }
+
+        //
+        // Report entries whose stall vector lies outside the stall subtrees
+        // here, at build time, rather than on every interrupt.
+        //
+        if ((intrVector >= numVectors) ||
+            ((stallSubtreeMask &
+              NVBIT64(NV_CTRL_INTR_GPU_VECTOR_TO_SUBTREE(intrVector))) == 0))
+        {
+            NV_PRINTF(LEVEL_ERROR,
+                      "MC_ENGINE_IDX %u has invalid stall intr vector %u\n",
+                      pTableEntry->mcEngine,
+                      intrVector);
+            DBG_BREAKPOINT();
+            continue;
+        }
+
+        //
+        // Stall vectors are expected to be unique per engine. If two table
+        // entries ever share one, the flattened table cannot represent them;
+        // drop it and let servicing walk the interrupt table as before.
+        //
+        if (!interruptEntryIsEmpty(
+                &pIntr->vectorToMcIdx[INTR_TREE_CPU][intrVector]))
+        {
+            NV_PRINTF(LEVEL_WARNING,
+                      "stall intr vector %u is shared by MC_ENGINE_IDX %u and %u; "
+                      "disabling per-vector dispatch\n",
+                      intrVector,
+                      pIntr->vectorToMcIdx[INTR_TREE_CPU][intrVector].mcEngine,
+                      pTableEntry->mcEngine);
+            status = NV_OK;
+            goto error;
+        }
+
+        entry.mcEngine = pTableEntry->mcEngine;
+        entry.intrKind = INTR_KIND_INTERRUPT;
+        entry.bService = NV_TRUE;
+        status = intrSetInterruptEntry(pIntr, INTR_TREE_CPU, intrVector,
+                                       &entry);
+        if (status != NV_OK)
+        {
+            goto error;
+        }
+    }
+
+    return NV_OK;
+
+error:
+    for (INTR_TREE tree = 0; tree < NV_ARRAY_ELEMENTS(pIntr->vectorToMcIdx);
+         ++tree)
+    {
+        portMemFree(pIntr->vectorToMcIdx[tree]);
+        pIntr->vectorToMcIdx[tree]       = NULL;
+        portMemFree(pIntr->vectorIntrCount[tree]);
+        pIntr->vectorIntrCount[tree]     = NULL;
+        pIntr->vectorToMcIdxCounts[tree] = 0;
+    }
+    return status;
+}
@@ -28,6 +28,7 @@
 #include "diagnostics/nv_debug_dump.h"
 #include "gpu/bus/kern_bus.h"
 #include "gpu/mmu/kern_gmmu.h"
+#include "kernel/gpu/intr/intr.h"
 #include "kernel/gpu/bif/kernel_bif.h"
 #include "nvRmReg.h"
 #include "nv_ref.h"
@@ -128,6 +129,40 @@ subdeviceCtrlCmdMcChangeReplayableFaultOwnership_IMPL
     return NV_OK;
 }
 
+NV_STATUS
+subdeviceCtrlCmdMcGetIntrVectorCounters_IMPL
+(
+    Subdevice *pSubdevice,
+    NV2080_CTRL_MC_GET_INTR_VECTOR_COUNTERS_PARAMS *pParams
+)
+{
+    OBJGPU *pGpu  = GPU_RES_GET_GPU(pSubdevice);
+    Intr   *pIntr = GPU_GET_INTR(pGpu);
+    NvU32   numVectors;
+    NvU32   i;
+
+    // One counter per bit of every stall interrupt leaf register
+    ct_assert(NV2080_CTRL_MC_INTR_VECTOR_COUNTERS_MAX >=
+              NV_MAX_INTR_LEAVES * 32);
+
+    portMemSet(pParams, 0, sizeof(*pParams));
+
+    if ((pIntr == NULL) || (pIntr->vectorIntrCount[INTR_TREE_CPU] == NULL))
+    {
+        return NV_ERR_NOT_SUPPORTED;
+    }
+
+    numVectors = (NvU32)NV_MIN(pIntr->vectorToMcIdxCounts[INTR_TREE_CPU],
+                               NV2080_CTRL_MC_INTR_VECTOR_COUNTERS_MAX);
+    for (i = 0; i < numVectors; i++)
+    {
+        pParams->counters[i] = pIntr->vectorIntrCount[INTR_TREE_CPU][i];
+    }
+    pParams->numVectors = numVectors;
+
+    return NV_OK;
+}
+
 //
 // Routine to dump Engine State on Error Conditions
 //
@@ -28,6 +28,8 @@
 #include "gpu/mem_mgr/fbsr.h"
 #include "gpu/bus/kern_bus.h"
 #include "gpu/mem_mgr/mem_desc.h"
+#include "gpu/mem_mgr/ce_utils.h"
+#include "kernel/gpu/mem_mgr/channel_utils.h"
 #include "published/maxwell/gm107/dev_ram.h"
 #include "core/thread_state.h"
 #include "nvrm_registry.h"
@@ -94,6 +96,13 @@
 #define CPU_PINNED_BUFFER_SIZE                              RM_PAGE_SIZE
 #define CPU_MAX_PINNED_BUFFER_SIZE                          0x10000
 
+//
+// Number of DMA scratch buffer slots for the file based scheme. With two
+// slots the CE copy of one chunk overlaps the file I/O of the previous
+// chunk instead of strictly alternating DMA and file accesses.
+//
+#define FILE_PIPELINE_SLOTS                                 2
+
 //
 // Maximum data copy size in bytes for file operations (read/write)
 // which can be transferred with default thread timeout.
@@ -237,6 +246,10 @@ fbsrInit_GM107(OBJGPU *pGpu, OBJFBSR *pFbsr)
         {
             memSize = CPU_PINNED_BUFFER_SIZE;
         }
+        else if (pFbsr->type == FBSR_TYPE_FILE)
+        {
+            memSize = FILE_PIPELINE_SLOTS * CPU_MAX_PINNED_BUFFER_SIZE;
+        }
         else
         {
             memSize = CPU_MAX_PINNED_BUFFER_SIZE;
@@ -818,6 +831,166 @@ fbsrEnd_GM107(OBJGPU *pGpu, OBJFBSR *pFbsr)
     return pFbsr->bOperationFailed ? NV_ERR_GENERIC : NV_OK;
 }
 
+/*!
+ * Pipelined file based save/restore of a single vidmem region.
+ *
+ * The DMA scratch buffer is split into two slots; while the CE copies one
+ * chunk the CPU performs the file I/O of the other, so DMA and file time
+ * overlap instead of adding up. Chunking is derived purely from the region
+ * layout and the file offsets are byte-identical to the serial scheme, so
+ * a save and restore never need to agree on which scheme was used.
+ *
+ * @param[in]     pGpu         OBJGPU pointer
+ * @param[in]     pFbsr        OBJFBSR pointer
+ * @param[in]     pVidMemDesc  Memory descriptor for vidmem region
+ *
+ * @returns NV_OK on success
+ */
+static NV_STATUS
+_fbsrFileSaveRestorePipelined
+(
+    OBJGPU            *pGpu,
+    OBJFBSR           *pFbsr,
+    MEMORY_DESCRIPTOR *pVidMemDesc
+)
+{
+    MemoryManager *pMemoryManager        = GPU_GET_MEMORY_MANAGER(pGpu);
+    CeUtils       *pCeUtils              = pMemoryManager->pCeUtils;
+    NvU64          totalCopySize         = pVidMemDesc->Size;
+    NvU64          vidOffset             = 0;
+    NvU64          threadTimeoutCopySize = 0;
+    NvU32          slot                  = 0;
+    NV_STATUS      status                = NV_OK;
+
+    NV_ASSERT_OK(threadStateResetTimeout(pGpu));
+
+    if (pFbsr->op == FBSR_OP_SAVE)
+    {
+        NvU64 pendingSize    = 0;
+        NvU64 pendingFileOff = 0;
+        NvU32 pendingSlot    = 0;
+
+        while ((totalCopySize != 0) || (pendingSize != 0))
+        {
+            NvU64 copySize = NV_MIN((NvU64)CPU_MAX_PINNED_BUFFER_SIZE, totalCopySize);
+            NvU64 payload  = 0;
+
+            if (totalCopySize != 0)
+            {
+                CEUTILS_MEMCOPY_PARAMS params = {0};
+
+                params.pDstMemDesc = pFbsr->pSysMemDesc;
+                params.dstOffset   = (NvU64)slot * CPU_MAX_PINNED_BUFFER_SIZE;
+                params.pSrcMemDesc = pVidMemDesc;
+                params.srcOffset   = vidOffset;
+                params.length      = copySize;
+                params.flags       = NV0050_CTRL_MEMCOPY_FLAGS_ASYNC;
+
+                NV_ASSERT_OK_OR_RETURN(ceutilsMemcopy(pCeUtils, &params));
+                payload = params.submittedWorkId;
+            }
+
+            // Write the previous chunk out while the CE copy is in flight
+            if (pendingSize != 0)
+            {
+                if (threadTimeoutCopySize >= MAX_FILE_COPY_SIZE_WITHIN_DEFAULT_THREAD_TIMEOUT)
+                {
+                    NV_ASSERT_OK(threadStateResetTimeout(pGpu));
+                    threadTimeoutCopySize = 0;
+                }
+                threadTimeoutCopySize += pendingSize;
+
+                status = osWriteToFile(pFbsr->pagedBufferInfo.sectionHandle,
+                                       pFbsr->pDmaBuffer +
+                                           ((NvU64)pendingSlot * CPU_MAX_PINNED_BUFFER_SIZE),
+                                       pendingSize,
+                                       pFbsr->sysOffset + pendingFileOff);
+                if (status != NV_OK)
+                    return status;
+
+                pendingSize = 0;
+            }
+
+            if (totalCopySize != 0)
+            {
+                NV_ASSERT_OK_OR_RETURN(
+                    channelWaitForFinishPayload(pCeUtils->pChannel, payload));
+
+                pendingSize    = copySize;
+                pendingSlot    = slot;
+                pendingFileOff = vidOffset;
+                slot          ^= 1;
+                vidOffset     += copySize;
+                totalCopySize -= copySize;
+            }
+        }
+    }
+    else
+    {
+        NvU64 chunkSize = NV_MIN((NvU64)CPU_MAX_PINNED_BUFFER_SIZE, totalCopySize);
+
+        // Prime the pipeline with the first chunk
+        if (chunkSize != 0)
+        {
+            status = osReadFromFile(pFbsr->pagedBufferInfo.sectionHandle,
+                                    pFbsr->pDmaBuffer,
+                                    chunkSize,
+                                    pFbsr->sysOffset);
+            if (status != NV_OK)
+                return status;
+
+            threadTimeoutCopySize = chunkSize;
+        }
+
+        while (totalCopySize != 0)
+        {
+            NvU64 nextSize = NV_MIN((NvU64)CPU_MAX_PINNED_BUFFER_SIZE,
+                                    totalCopySize - chunkSize);
+            CEUTILS_MEMCOPY_PARAMS params = {0};
+
+            params.pDstMemDesc = pVidMemDesc;
+            params.dstOffset   = vidOffset;
+            params.pSrcMemDesc = pFbsr->pSysMemDesc;
+            params.srcOffset   = (NvU64)slot * CPU_MAX_PINNED_BUFFER_SIZE;
+            params.length      = chunkSize;
+            params.flags       = NV0050_CTRL_MEMCOPY_FLAGS_ASYNC;
+
+            NV_ASSERT_OK_OR_RETURN(ceutilsMemcopy(pCeUtils, &params));
+
+            // Read the next chunk into the other slot while the CE copy runs
+            if (nextSize != 0)
+            {
+                if (threadTimeoutCopySize >= MAX_FILE_COPY_SIZE_WITHIN_DEFAULT_THREAD_TIMEOUT)
+                {
+                    NV_ASSERT_OK(threadStateResetTimeout(pGpu));
+                    threadTimeoutCopySize = 0;
+                }
+                threadTimeoutCopySize += nextSize;
+
+                status = osReadFromFile(pFbsr->pagedBufferInfo.sectionHandle,
+                                        pFbsr->pDmaBuffer +
+                                            ((NvU64)(slot ^ 1) * CPU_MAX_PINNED_BUFFER_SIZE),
+                                        nextSize,
+                                        pFbsr->sysOffset + vidOffset + chunkSize);
+                if (status != NV_OK)
+                    return status;
+            }
+
+            NV_ASSERT_OK_OR_RETURN(
+                channelWaitForFinishPayload(pCeUtils->pChannel, params.submittedWorkId));
+
+            totalCopySize -= chunkSize;
+            vidOffset     += chunkSize;
+            slot          ^= 1;
+            chunkSize      = nextSize;
+        }
+    }
+
+    NV_ASSERT_OK(threadStateResetTimeout(pGpu));
+
+    return NV_OK;
+}
+
 /*!
  * Saves or restores a region of video memory.
  *
@@ -989,7 +1162,7 @@ fbsrCopyMemoryMemDesc_GM107(OBJGPU *pGpu, OBJFBSR *pFbsr, MEMORY_DESCRIPTOR *pVi
                 {
                     NvU64      totalCopySize = pVidMemDesc->Size;
                     NvU64      vidOffset = 0;
-                    NvU64      copySize, i;
+                    NvU64      copySize;
                     NvU32      *cpuCopyOffset = 0;
                     NvBool     bIommuEnabled = pGpu->getProperty(pGpu, PDB_PROP_GPU_ENABLE_IOMMU_SUPPORT);
 
@@ -1029,11 +1202,8 @@ fbsrCopyMemoryMemDesc_GM107(OBJGPU *pGpu, OBJFBSR *pFbsr, MEMORY_DESCRIPTOR *pVi
                             // pPinnedBuffer is the 64K scratch buffer
                             // cpuCopyOffset is the mapped paged CPU VA
                             // Restore from the backing store to the pinned 64k scratch buffer
-                            // We copy the region in 4byte granularity
-                            for (i = 0; i < (copySize / 4); i++)
-                            {
-                                pFbsr->pPinnedBuffer[i] = cpuCopyOffset[i];
-                            }
+                            portMemCopyWide(pFbsr->pPinnedBuffer, copySize,
+                                            cpuCopyOffset, copySize);
                         }
 
                         TRANSFER_SURFACE vidSurface = {0};
@@ -1055,10 +1225,8 @@ fbsrCopyMemoryMemDesc_GM107(OBJGPU *pGpu, OBJFBSR *pFbsr, MEMORY_DESCRIPTOR *pVi
                         if (pFbsr->op == FBSR_OP_SAVE)
                         {
                             // Copy from the scratch buffer to the sysmem backing store
-                            for (i = 0; i < (copySize / 4); i++)
-                            {
-                                cpuCopyOffset[i] = pFbsr->pPinnedBuffer[i];
-                            }
+                            portMemCopyWide(cpuCopyOffset, copySize,
+                                            pFbsr->pPinnedBuffer, copySize);
                         }
 
                         vidOffset += copySize;
@@ -1086,6 +1254,21 @@ fbsrCopyMemoryMemDesc_GM107(OBJGPU *pGpu, OBJFBSR *pFbsr, MEMORY_DESCRIPTOR *pVi
                     NvU64      copySize;
                     NvU64      threadTimeoutCopySize = 0;
 
+                    //
+                    // Take the pipelined path whenever CE transfers are
+                    // available; the serial scheme below remains as the
+                    // fallback (no CE channel, or BAR0 on simulation).
+                    //
+                    if (!IS_SIMULATION(pGpu) && (pMemoryManager->pCeUtils != NULL))
+                    {
+                        if (_fbsrFileSaveRestorePipelined(pGpu, pFbsr, pVidMemDesc) != NV_OK)
+                        {
+                            pFbsr->bOperationFailed = NV_TRUE;
+                            NV_ASSERT(0);
+                        }
+                        break;
+                    }
+
                     //
                     // File based operation can take longer time in completion, if the
                     // FB usage is high. Also, the File read/write time is
@@ -1184,7 +1367,6 @@ fbsrCopyMemoryMemDesc_GM107(OBJGPU *pGpu, OBJFBSR *pFbsr, MEMORY_DESCRIPTOR *pVi
                     NvU64      vidOffset = 0;
                     NvU64      copySize;
                     NvU64      size = pVidMemDesc->Size;
-                    NvU64      i;
 
                     NV_ASSERT(pNode);
                     NV_ASSERT((pFbsr->sysOffset & 3) == 0);
@@ -1195,10 +1377,8 @@ fbsrCopyMemoryMemDesc_GM107(OBJGPU *pGpu, OBJFBSR *pFbsr, MEMORY_DESCRIPTOR *pVi
 
                         if (pFbsr->op == FBSR_OP_RESTORE)
                         {
-                            for (i = 0; i < (copySize / 4); i++)
-                            {
-                                pFbsr->pPinnedBuffer[i] = pNode->data[i];
-                            }
+                            portMemCopyWide(pFbsr->pPinnedBuffer, copySize,
+                                            pNode->data, copySize);
                         }
 
                         TRANSFER_SURFACE vidSurface = {0};
@@ -1219,10 +1399,8 @@ fbsrCopyMemoryMemDesc_GM107(OBJGPU *pGpu, OBJFBSR *pFbsr, MEMORY_DESCRIPTOR *pVi
 
                         if (pFbsr->op == FBSR_OP_SAVE)
                         {
-                            for (i = 0; i < (copySize / 4); i++)
-                            {
-                                pNode->data[i] = pFbsr->pPinnedBuffer[i];
-                            }
+                            portMemCopyWide(pNode->data, copySize,
+                                            pFbsr->pPinnedBuffer, copySize);
                         }
 
                         vidOffset += copySize;
@@ -1373,6 +1373,18 @@ struct MMU_MAP_ITERATOR
      */
     const GMMU_FIELD_ADDRESS *pAddrField;
 
+    /*!
+     * Flat encoder precomputed from pteTemplate and pAddrField.
+     * Only valid when bUseFlatEncode is set.
+     */
+    GMMU_FMT_PTE_ENCODER pteEncoder;
+
+    /*!
+     * Indicates each PTE is the template plus a physical address only,
+     * so the flat encoder fast path can be used.
+     */
+    NvBool bUseFlatEncode;
+
     /*!
      * Indicates after how many indexes in pPageArray, should the
      * map wrap around to the first mapped page.
@@ -1434,6 +1446,56 @@ _gmmuWalkCBMapNextEntries_Direct
     // location in memory at the appropriate offset is on the caller.
     //
 
+    //
+    // Fast path: each PTE is the template plus a physical address, so
+    // write whole entry words with the precomputed constant shifts/masks
+    // instead of running the generic field machinery per PTE.
+    //
+    if (pIter->bUseFlatEncode && (0 == ((NvUPtr)pMap & 7)))
+    {
+        KernelGmmu *pKernelGmmu = GPU_GET_KERNEL_GMMU(pUserCtx->pGpu);
+
+        for (i = entryIndexLo; i <= entryIndexHi; ++i)
+        {
+            NvU32 currIdxMod = pIter->currIdx;
+
+            // Wrap the curr idx to the start offset for BAR1 overmapping.
+            if (0 != pIter->overMapModulus)
+            {
+                currIdxMod %= pIter->overMapModulus;
+            }
+
+            // Extract the physical address of the page to map.
+            if (currIdxMod < pIter->pPageArray->count)
+            {
+                pIter->physAddr = dmaPageArrayGetPhysAddr(pIter->pPageArray, currIdxMod);
+                // Hack to WAR submemesc mappings
+                pIter->physAddr = NV_ALIGN_DOWN64(pIter->physAddr, pageSize);
+            }
+            else
+            {
+                //
+                // Physically contiguous just increments physAddr
+                // Should not be the first page (currIdxMod == 0) being mapped.
+                //
+                NV_ASSERT_OR_RETURN_VOID((pIter->pPageArray->count == 1) &&
+                                       (currIdxMod > 0));
+                pIter->physAddr += pageSize;
+            }
+
+            gmmuFmtEncodePteAddr(&pIter->pteEncoder,
+                kgmmuEncodePhysAddr(pKernelGmmu, pIter->aperture,
+                                    pIter->physAddr, pIter->fabricAddr),
+                (NvU64*)&pMap[(i - entryIndexLo) * pLevelFmt->entrySize]);
+
+            // pPageArray deals in pageArrayGranularity-sized pages.
+            pIter->currIdx += (NvU32)(pageSize / pTarget->pageArrayGranularity);
+        }
+
+        *pProgress = entryIndexHi - entryIndexLo + 1;
+        return;
+    }
+
     for (i = entryIndexLo; i <= entryIndexHi; ++i)
     {
         NvU32 entryOffset = (i - entryIndexLo) * pLevelFmt->entrySize;
@@ -1947,6 +2009,15 @@ dmaUpdateVASpace_GF100
     // Enforce unicast.
     NV_ASSERT_OR_RETURN(!gpumgrGetBcEnabledStatus(pGpu), NV_ERR_INVALID_STATE);
 
+    //
+    // Batch the walker updates below so the trailing invalidate is issued
+    // once and skipped entirely if no page level entry changed.
+    //
+    if ((NULL == pTgtPteMem) && (DMA_TLB_INVALIDATE == deferInvalidate))
+    {
+        gvaspaceWalkBatchBegin(pGVAS, pGpu);
+    }
+
     if (bUnmap)
     {
          gvaspaceUnmap(pGVAS, pGpu, vaLo, vaHi);
@@ -1974,6 +2045,11 @@ dmaUpdateVASpace_GF100
             ((vAddr & (alignSize-1)) != 0) &&
             !(flags & DMA_UPDATE_VASPACE_FLAGS_UNALIGNED_COMP))
         {
+            // Nothing was updated yet, so this just closes the batch.
+            if ((NULL == pTgtPteMem) && (DMA_TLB_INVALIDATE == deferInvalidate))
+            {
+                gvaspaceWalkBatchEnd(pGVAS, pGpu, update_type);
+            }
             return NV_ERR_INVALID_ARGUMENT;
         }
 
@@ -2126,6 +2202,19 @@ dmaUpdateVASpace_GF100
                 gmmuFmtPtePhysAddrFld(pFmt->pPte, mapIter.aperture);
         }
 
+        //
+        // Precompute the flat encoder for the common case where each PTE
+        // is the template plus a physical address. Read-modify-write and
+        // compression updates need the generic per-field path.
+        //
+        if (mapIter.bUpdatePhysAddr && !mapIter.bReadPtes &&
+            !mapIter.bUpdateCompr && (NULL != mapIter.pAddrField))
+        {
+            mapIter.bUseFlatEncode =
+                gmmuFmtPrepPteEncoder(mapTarget.pLevelFmt, mapIter.pAddrField,
+                                      mapIter.pteTemplate, &mapIter.pteEncoder);
+        }
+
         //
         // FillPteMem case must be handled specially as it violates
         // internal VAS alignment and constistency checks.
@@ -2183,9 +2272,7 @@ dmaUpdateVASpace_GF100
     // Invalidate VAS TLB entries.
     if ((NULL == pTgtPteMem) && DMA_TLB_INVALIDATE == deferInvalidate)
     {
-        kbusFlush_HAL(pGpu, pKernelBus, BUS_FLUSH_VIDEO_MEMORY |
-                                        BUS_FLUSH_SYSTEM_MEMORY);
-        gvaspaceInvalidateTlb(pGVAS, pGpu, update_type);
+        gvaspaceWalkBatchEnd(pGVAS, pGpu, update_type);
     }
 
 #if NV_PRINTF_LEVEL_ENABLED(LEVEL_INFO)
@@ -74,6 +74,8 @@ static NV_STATUS _heapProcessFreeBlock(OBJGPU *, MEM_BLOCK *, MEM_BLOCK **,
                                        FB_ALLOC_INFO *, NvU64, NvU64 *);
 static void _heapAddBlockToNoncontigList(Heap *, MEM_BLOCK *);
 static void _heapRemoveBlockFromNoncontigList(Heap *, MEM_BLOCK *);
+static void _heapAddBlockToSizeIndex(Heap *, MEM_BLOCK *);
+static void _heapRemoveBlockFromSizeIndex(Heap *, MEM_BLOCK *);
 static NV_STATUS _heapFindBlockByOffset(OBJGPU *, Heap *, NvU32,
                                         MEMORY_DESCRIPTOR *, NvU64,
                                         MEM_BLOCK **);
@@ -482,6 +484,7 @@ NV_STATUS heapInitInternal_IMPL
     pHeap->memHandle      = 0xcafe0000;
     pHeap->numBlocks      = 1;
     pHeap->pBlockTree     = NULL;
+    pHeap->pFreeSizeTree  = NULL;
 
     //
     // Set the client id as invalid since there isn't one that exists
@@ -1171,6 +1174,81 @@ _isAllocValidForFBRegion
     return NV_TRUE;
 }
 
+//
+// Check whether an allocation can be carved out of a free block, computing
+// the candidate placement into pAllocData->allocLo/allocAl/allocHi. Grow-down
+// requests are placed at the top of the block and grow-up requests at the
+// bottom, mirroring the bank placement semantics of the freelist scan.
+//
+static NvBool
+_heapBlockFitsRequest
+(
+    OBJGPU             *pGpu,
+    Heap               *pHeap,
+    FB_ALLOC_INFO      *pFbAllocInfo,
+    OBJHEAP_ALLOC_DATA *pAllocData,
+    MEM_BLOCK          *pBlockFree,
+    NvU64               rangeLo,
+    NvU64               rangeHi,
+    NvBool              bGrowDown
+)
+{
+    NvU64 blockLo;
+    NvU64 blockHi;
+
+    //
+    // Is this block at least partly in the requested range?
+    //
+    // We *should* check that pBlockFree is wholely resident in the range, but the
+    // old check didn't and checking it causes some tests to fail.
+    // So check that at least *some* of the block resides within the requested range.
+    //
+    if ((pBlockFree->end < rangeLo) || (pBlockFree->begin > rangeHi))
+        return NV_FALSE;
+
+    //
+    // Find the intersection of the free block and the specified range.
+    //
+    blockLo = (rangeLo > pBlockFree->begin) ? rangeLo : pBlockFree->begin;
+    blockHi = (rangeHi < pBlockFree->end) ? rangeHi : pBlockFree->end;
+
+    if (bGrowDown)
+    {
+        //
+        // Allocate from the top of the memory block.
+        //
+        pAllocData->allocLo = (blockHi - pAllocData->allocSize + 1) / pAllocData->alignment * pAllocData->alignment;
+        pAllocData->allocAl = pAllocData->allocLo;
+        pAllocData->allocHi = pAllocData->allocAl + pAllocData->allocSize - 1;
+    }
+    else
+    {
+        //
+        // Allocate from the bottom of the memory block.
+        //
+        pAllocData->allocAl = (blockLo + (pAllocData->alignment - 1)) / pAllocData->alignment * pAllocData->alignment;
+        pAllocData->allocLo = pAllocData->allocAl;
+        pAllocData->allocHi = pAllocData->allocAl + pAllocData->allocSize - 1;
+    }
+
+    //
+    // Does the desired range fall completely within this block?
+    // Also make sure it does not wrap-around.
+    // Also make sure it is within the desired range.
+    //
+    if ((pAllocData->allocLo < pBlockFree->begin) || (pAllocData->allocHi > pBlockFree->end))
+        return NV_FALSE;
+
+    if (pAllocData->allocLo > pAllocData->allocHi)
+        return NV_FALSE;
+
+    if ((pAllocData->allocLo < rangeLo) || (pAllocData->allocHi > rangeHi))
+        return NV_FALSE;
+
+    // Check that the candidate block can support the allocation type
+    return _isAllocValidForFBRegion(pGpu, pHeap, pFbAllocInfo, pAllocData);
+}
+
 /**
  * Blacklists a single page
  * This function will allocate the memory descriptor with a fixed memory offset
@@ -1690,71 +1768,76 @@ NV_STATUS heapAlloc_IMPL
             pBlockFirstFree = pBlockFirstFree->u0.prevFree;
         pBlockFree = pBlockFirstFree;
 
-        do
+        //
+        // Segregated fit via the free-size index: start at the smallest size
+        // class that can hold the request and take the first block that
+        // passes the same placement checks as the scan below, honoring the
+        // grow direction within each address-sorted class. The freelist scan
+        // is kept as a fallback so a block missing from the index can never
+        // cause a spurious allocation failure.
+        //
         {
-            NvU64 blockLo;
-            NvU64 blockHi;
+            NODE *pSizeNode;
 
-            if (currentBankInfo & MEM_GROW_DOWN)
-                pBlockFree = pBlockFree->u0.prevFree;
-            else
-                pBlockFree = pBlockFree->u1.nextFree;
-
-            //
-            // Is this block completely in requested range?
-            //
-            // We *should* check that pBlockFree is wholely resident in the range, but the
-            // old check didn't and checking it causes some tests to fail.
-            // So check that at least *some* of the block resides within the requested range.
-            //
-            if ((pBlockFree->end >= pVidHeapAlloc->rangeLo) && (pBlockFree->begin <= pVidHeapAlloc->rangeHi))
+            btreeEnumStart(pAllocData->allocSize, &pSizeNode, pHeap->pFreeSizeTree);
+            while (pSizeNode != NULL)
             {
-                //
-                // Find the intersection of the free block and the specified range.
-                //
-                blockLo = (pVidHeapAlloc->rangeLo > pBlockFree->begin) ? pVidHeapAlloc->rangeLo : pBlockFree->begin;
-                blockHi = (pVidHeapAlloc->rangeHi < pBlockFree->end) ? pVidHeapAlloc->rangeHi : pBlockFree->end;
+                MEM_BLOCK *pScan = (MEM_BLOCK *)pSizeNode->Data;
 
                 if (currentBankInfo & MEM_GROW_DOWN)
                 {
-                    //
-                    // Allocate from the top of the memory block.
-                    //
-                    pAllocData->allocLo = (blockHi - pAllocData->allocSize + 1) / pAllocData->alignment * pAllocData->alignment;
-                    pAllocData->allocAl = pAllocData->allocLo;
-                    pAllocData->allocHi = pAllocData->allocAl + pAllocData->allocSize - 1;
+                    while (pScan->pNextFreeSize != NULL)
+                        pScan = pScan->pNextFreeSize;
+
+                    for (; pScan != NULL; pScan = pScan->pPrevFreeSize)
+                    {
+                        if (_heapBlockFitsRequest(pGpu, pHeap, pFbAllocInfo, pAllocData,
+                                                  pScan, pVidHeapAlloc->rangeLo,
+                                                  pVidHeapAlloc->rangeHi, NV_TRUE))
+                        {
+                            pBlockFree = pScan;
+                            pVidHeapAlloc->rangeLo = saveRangeLo;
+                            pVidHeapAlloc->rangeHi = saveRangeHi;
+                            goto got_one;
+                        }
+                    }
                 }
                 else
                 {
-                    //
-                    // Allocate from the bottom of the memory block.
-                    //
-                    pAllocData->allocAl = (blockLo + (pAllocData->alignment - 1)) / pAllocData->alignment * pAllocData->alignment;
-                    pAllocData->allocLo = pAllocData->allocAl;
-                    pAllocData->allocHi = pAllocData->allocAl + pAllocData->allocSize - 1;
-                }
-
-                //
-                // Does the desired range fall completely within this block?
-                // Also make sure it does not wrap-around.
-                // Also make sure it is within the desired range.
-                //
-                if ((pAllocData->allocLo >= pBlockFree->begin) && (pAllocData->allocHi <= pBlockFree->end))
-                {
-                    if (pAllocData->allocLo <= pAllocData->allocHi)
+                    for (; pScan != NULL; pScan = pScan->pNextFreeSize)
                     {
-                        if ((pAllocData->allocLo >= pVidHeapAlloc->rangeLo) && (pAllocData->allocHi <= pVidHeapAlloc->rangeHi))
+                        if (_heapBlockFitsRequest(pGpu, pHeap, pFbAllocInfo, pAllocData,
+                                                  pScan, pVidHeapAlloc->rangeLo,
+                                                  pVidHeapAlloc->rangeHi, NV_FALSE))
                         {
-                            // Check that the candidate block can support the allocation type
-                            if (_isAllocValidForFBRegion(pGpu, pHeap, pFbAllocInfo, pAllocData))
-                            {
-                                pVidHeapAlloc->rangeLo = saveRangeLo;
-                                pVidHeapAlloc->rangeHi = saveRangeHi;
-                                goto got_one;
-                            }
+                            pBlockFree = pScan;
+                            pVidHeapAlloc->rangeLo = saveRangeLo;
+                            pVidHeapAlloc->rangeHi = saveRangeHi;
+                            goto got_one;
                         }
                     }
                 }
+
+                if (btreeEnumNext(&pSizeNode, pHeap->pFreeSizeTree) != NV_OK)
+                    break;
+            }
+        }
+
+        do
+        {
+            if (currentBankInfo & MEM_GROW_DOWN)
+                pBlockFree = pBlockFree->u0.prevFree;
+            else
+                pBlockFree = pBlockFree->u1.nextFree;
+
+            if (_heapBlockFitsRequest(pGpu, pHeap, pFbAllocInfo, pAllocData,
+                                      pBlockFree, pVidHeapAlloc->rangeLo,
+                                      pVidHeapAlloc->rangeHi,
+                                      (currentBankInfo & MEM_GROW_DOWN) != 0))
+            {
+                pVidHeapAlloc->rangeLo = saveRangeLo;
+                pVidHeapAlloc->rangeHi = saveRangeHi;
+                goto got_one;
             }
 
         } while (pBlockFree != pBlockFirstFree);
@@ -4102,6 +4185,135 @@ unwind_and_exit:
     return status;
 }
 
+//
+// Size-indexed view of the contiguous freelist.
+//
+// Free blocks are additionally kept in a red-black tree keyed by block size;
+// blocks of equal size hang off the tree node in a list sorted by address,
+// and the tree node is always embedded in the block heading its size class.
+// objHeapAlloc uses the index to start its scan at the smallest size class
+// that can hold a request instead of walking every free block in address
+// order.
+//
+static void
+_heapRemoveBlockFromSizeIndex
+(
+    Heap       *pHeap,
+    MEM_BLOCK  *pBlock
+)
+{
+    if (!pBlock->bFreeSizeIndexed)
+        return;
+
+    if (pBlock->pPrevFreeSize == NULL)
+    {
+        // Head of its size class: the tree node lives in this block
+        if (btreeUnlink(&pBlock->sizeNode, &pHeap->pFreeSizeTree) != NV_OK)
+            NV_ASSERT_FAILED("btreeUnlink failed to remove size class head");
+
+        if (pBlock->pNextFreeSize != NULL)
+        {
+            // Promote the next block of this size to class head
+            MEM_BLOCK *pNext = pBlock->pNextFreeSize;
+
+            pNext->pPrevFreeSize = NULL;
+            portMemSet((void *)&pNext->sizeNode, 0, sizeof(NODE));
+            pNext->sizeNode.Data     = (void *)pNext;
+            pNext->sizeNode.keyStart = pNext->end - pNext->begin + 1;
+            pNext->sizeNode.keyEnd   = pNext->sizeNode.keyStart;
+            if (btreeInsert(&pNext->sizeNode, &pHeap->pFreeSizeTree) != NV_OK)
+            {
+                // The class drops out of the index; the freelist scan in
+                // objHeapAlloc still finds its blocks.
+                NV_ASSERT_FAILED("btreeInsert failed to promote size class head");
+                for (; pNext != NULL; pNext = pNext->pNextFreeSize)
+                    pNext->bFreeSizeIndexed = NV_FALSE;
+            }
+        }
+    }
+    else
+    {
+        pBlock->pPrevFreeSize->pNextFreeSize = pBlock->pNextFreeSize;
+        if (pBlock->pNextFreeSize != NULL)
+            pBlock->pNextFreeSize->pPrevFreeSize = pBlock->pPrevFreeSize;
+    }
+
+    pBlock->pPrevFreeSize = NULL;
+    pBlock->pNextFreeSize = NULL;
+    pBlock->bFreeSizeIndexed = NV_FALSE;
+}
+
+static void
+_heapAddBlockToSizeIndex
+(
+    Heap       *pHeap,
+    MEM_BLOCK  *pBlock
+)
+{
+    NvU64 size;
+    NODE *pNode;
+
+    // A size change arrives without a preceding remove; reindex from scratch
+    _heapRemoveBlockFromSizeIndex(pHeap, pBlock);
+
+    size = pBlock->end - pBlock->begin + 1;
+
+    if ((btreeSearch(size, &pNode, pHeap->pFreeSizeTree) == NV_OK) &&
+        (((MEM_BLOCK *)pNode->Data)->begin < pBlock->begin))
+    {
+        // Insert into the class list, keeping it sorted by address
+        MEM_BLOCK *pPrev = (MEM_BLOCK *)pNode->Data;
+
+        while ((pPrev->pNextFreeSize != NULL) &&
+               (pPrev->pNextFreeSize->begin < pBlock->begin))
+        {
+            pPrev = pPrev->pNextFreeSize;
+        }
+
+        pBlock->pNextFreeSize = pPrev->pNextFreeSize;
+        pBlock->pPrevFreeSize = pPrev;
+        if (pPrev->pNextFreeSize != NULL)
+            pPrev->pNextFreeSize->pPrevFreeSize = pBlock;
+        pPrev->pNextFreeSize = pBlock;
+        pBlock->bFreeSizeIndexed = NV_TRUE;
+        return;
+    }
+
+    if (pNode != NULL)
+    {
+        // pBlock becomes the new class head; move the size key onto it
+        MEM_BLOCK *pOldHead = (MEM_BLOCK *)pNode->Data;
+
+        if (btreeUnlink(pNode, &pHeap->pFreeSizeTree) != NV_OK)
+        {
+            NV_ASSERT_FAILED("btreeUnlink failed to replace size class head");
+            return;
+        }
+        pBlock->pNextFreeSize = pOldHead;
+        pOldHead->pPrevFreeSize = pBlock;
+    }
+    else
+    {
+        pBlock->pNextFreeSize = NULL;
+    }
+
+    pBlock->pPrevFreeSize = NULL;
+    portMemSet((void *)&pBlock->sizeNode, 0, sizeof(NODE));
+    pBlock->sizeNode.Data     = (void *)pBlock;
+    pBlock->sizeNode.keyStart = size;
+    pBlock->sizeNode.keyEnd   = size;
+    if (btreeInsert(&pBlock->sizeNode, &pHeap->pFreeSizeTree) != NV_OK)
+    {
+        // The block stays off the index; the freelist scan still finds it
+        NV_ASSERT_FAILED("btreeInsert failed to add size class");
+        if (pBlock->pNextFreeSize != NULL)
+            pBlock->pNextFreeSize->pPrevFreeSize = NULL;
+        pBlock->pNextFreeSize = NULL;
+        return;
+    }
+    pBlock->bFreeSizeIndexed = NV_TRUE;
+}
+
 //
 // Explanation of BlockAction values:
 // - BLOCK_ADD,
@@ -4164,6 +4376,13 @@ _heapUpdate
          pBlock->owner == NVOS32_BLOCK_TYPE_FREE))
     {
         _heapAddBlockToNoncontigList(pHeap, pBlock);
+
+        //
+        // Only free blocks belong in the size index; allocated blocks pass
+        // through here on BLOCK_ADD and are skipped.
+        //
+        if (pBlock->owner == NVOS32_BLOCK_TYPE_FREE)
+            _heapAddBlockToSizeIndex(pHeap, pBlock);
     }
 
     // Remove the block from the heap
@@ -4182,6 +4401,7 @@ _heapUpdate
           pBlock->owner != NVOS32_BLOCK_TYPE_FREE)))
     {
         _heapRemoveBlockFromNoncontigList(pHeap, pBlock);
+        _heapRemoveBlockFromSizeIndex(pHeap, pBlock);
     }
 
     return NV_OK;
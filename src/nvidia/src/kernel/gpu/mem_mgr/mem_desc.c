@@ -73,6 +73,162 @@ typedef struct
     NvP64 pPriv;
 } FB_MAPPING_INFO;
 
+//
+// Pool of fixed-size memory descriptors.
+//
+// Workloads that stream tens of thousands of allocations spend a noticeable
+// share of memdescCreate/memdescDestroy inside
+// portMemAllocNonPaged/portMemFree. Descriptors for physically contiguous
+// allocations and for discontiguous ones of up to MEMDESC_POOL_INLINE_PTES
+// pages are carved out of preallocated arenas instead; larger descriptors and
+// pool exhaustion fall back to the heap. Pool entries keep the PTE array in
+// the same block as the descriptor header, so short PTE walks stay within the
+// lines already touched by the header fields.
+//
+#define MEMDESC_POOL_INLINE_PTES   7
+#define MEMDESC_POOL_ENTRY_SIZE    (sizeof(MEMORY_DESCRIPTOR) + \
+                                    MEMDESC_POOL_INLINE_PTES * sizeof(RmPhysAddr))
+#define MEMDESC_POOL_NUM_ARENAS    8
+#define MEMDESC_POOL_ARENA_ENTRIES 128
+
+// Free pool entries are threaded through their own first word
+typedef struct MEMDESC_POOL_FREE_ENTRY
+{
+    struct MEMDESC_POOL_FREE_ENTRY *pNext;
+} MEMDESC_POOL_FREE_ENTRY;
+
+static struct
+{
+    PORT_SPINLOCK           *pLock;
+    NvU8                    *arenas[MEMDESC_POOL_NUM_ARENAS];
+    MEMDESC_POOL_FREE_ENTRY *pFreeList;
+    NvU32                    freeCount;
+    NvU32                    totalCount;
+} MemdescPool;
+
+void memdescPoolInit(void)
+{
+    NvU32 arena, i;
+
+    MemdescPool.pFreeList = NULL;
+    MemdescPool.freeCount = 0;
+    MemdescPool.totalCount = 0;
+
+    // Best effort: the pool is an optimization, memdescCreate falls back to
+    // portMemAllocNonPaged whenever it is unavailable.
+    MemdescPool.pLock = portSyncSpinlockCreate(portMemAllocatorGetGlobalNonPaged());
+    if (MemdescPool.pLock == NULL)
+        return;
+
+    for (arena = 0; arena < MEMDESC_POOL_NUM_ARENAS; arena++)
+    {
+        NvU8 *pArena = portMemAllocNonPaged(MEMDESC_POOL_ENTRY_SIZE *
+                                            MEMDESC_POOL_ARENA_ENTRIES);
+
+        MemdescPool.arenas[arena] = pArena;
+        if (pArena == NULL)
+            continue;
+
+        for (i = 0; i < MEMDESC_POOL_ARENA_ENTRIES; i++)
+        {
+            MEMDESC_POOL_FREE_ENTRY *pEntry =
+                (MEMDESC_POOL_FREE_ENTRY *)(pArena + i * MEMDESC_POOL_ENTRY_SIZE);
+
+            pEntry->pNext = MemdescPool.pFreeList;
+            MemdescPool.pFreeList = pEntry;
+        }
+
+        MemdescPool.freeCount += MEMDESC_POOL_ARENA_ENTRIES;
+        MemdescPool.totalCount += MEMDESC_POOL_ARENA_ENTRIES;
+    }
+}
+
+void memdescPoolDestroy(void)
+{
+    NvU32 arena;
+
+    if (MemdescPool.pLock == NULL)
+        return;
+
+    // All pooled descriptors must have been destroyed by now
+    NV_ASSERT(MemdescPool.freeCount == MemdescPool.totalCount);
+
+    for (arena = 0; arena < MEMDESC_POOL_NUM_ARENAS; arena++)
+    {
+        portMemFree(MemdescPool.arenas[arena]);
+        MemdescPool.arenas[arena] = NULL;
+    }
+
+    MemdescPool.pFreeList = NULL;
+    MemdescPool.freeCount = 0;
+    MemdescPool.totalCount = 0;
+    portSyncSpinlockDestroy(MemdescPool.pLock);
+    MemdescPool.pLock = NULL;
+}
+
+static MEMORY_DESCRIPTOR *_memdescPoolGet(NvU64 mdSize)
+{
+    MEMDESC_POOL_FREE_ENTRY *pEntry = NULL;
+
+    if ((MemdescPool.pLock == NULL) || (mdSize > MEMDESC_POOL_ENTRY_SIZE))
+        return NULL;
+
+    portSyncSpinlockAcquire(MemdescPool.pLock);
+    if (MemdescPool.pFreeList != NULL)
+    {
+        pEntry = MemdescPool.pFreeList;
+        MemdescPool.pFreeList = pEntry->pNext;
+        MemdescPool.freeCount--;
+    }
+    portSyncSpinlockRelease(MemdescPool.pLock);
+
+    return (MEMORY_DESCRIPTOR *)pEntry;
+}
+
+//
+// The arenas[] array is immutable between init and destroy, so the
+// membership scan needs no lock.
+//
+static NvBool _memdescPoolContains(MEMORY_DESCRIPTOR *pMemDesc)
+{
+    NvU32 arena;
+
+    for (arena = 0; arena < MEMDESC_POOL_NUM_ARENAS; arena++)
+    {
+        NvU8 *pArena = MemdescPool.arenas[arena];
+
+        if ((pArena != NULL) &&
+            ((NvU8 *)pMemDesc >= pArena) &&
+            ((NvU8 *)pMemDesc < pArena + MEMDESC_POOL_ENTRY_SIZE *
+                                         MEMDESC_POOL_ARENA_ENTRIES))
+        {
+            return NV_TRUE;
+        }
+    }
+
+    return NV_FALSE;
+}
+
+// Free a memory descriptor, returning it to the pool if it came from there
+static void _memdescFree(MEMORY_DESCRIPTOR *pMemDesc)
+{
+    MEMDESC_POOL_FREE_ENTRY *pEntry;
+
+    if ((pMemDesc == NULL) || (MemdescPool.pLock == NULL) ||
+        !_memdescPoolContains(pMemDesc))
+    {
+        portMemFree(pMemDesc);
+        return;
+    }
+
+    pEntry = (MEMDESC_POOL_FREE_ENTRY *)pMemDesc;
+    portSyncSpinlockAcquire(MemdescPool.pLock);
+    pEntry->pNext = MemdescPool.pFreeList;
+    MemdescPool.pFreeList = pEntry;
+    MemdescPool.freeCount++;
+    portSyncSpinlockRelease(MemdescPool.pLock);
+}
+
 //
 // Common address space lists
 //
@@ -349,7 +505,11 @@ memdescCreate
     }
     else
     {
-        pMemDesc = portMemAllocNonPaged((NvU32)MdSize);
+        pMemDesc = _memdescPoolGet(MdSize);
+        if (pMemDesc == NULL)
+        {
+            pMemDesc = portMemAllocNonPaged((NvU32)MdSize);
+        }
         if (pMemDesc == NULL)
         {
             return NV_ERR_NO_MEMORY;
@@ -413,7 +573,7 @@ failed:
     {
         if (!(Flags & MEMDESC_FLAGS_PRE_ALLOCATED))
         {
-            portMemFree(pMemDesc);
+            _memdescFree(pMemDesc);
         }
     }
     else
@@ -649,7 +809,7 @@ memdescDestroy
 
         if ((pMemDesc->_flags & MEMDESC_FLAGS_PRE_ALLOCATED) == 0)
         {
-            portMemFree(pMemDesc);
+            _memdescFree(pMemDesc);
         }
     }
 }
@@ -2924,12 +2924,17 @@ _memmgrPmaStatsUpdateCb
 {
     OBJGPU *pGpu = (OBJGPU *) pCtx;
     NV00DE_SHARED_DATA *pSharedData;
+    NvU64 freePmaMemory = freeFrames << PMA_PAGE_SHIFT;
 
     NV_ASSERT_OR_RETURN_VOID(pGpu != NULL);
 
     pSharedData = gpushareddataWriteStart(pGpu);
 
-    pSharedData->freePmaMemory = freeFrames << PMA_PAGE_SHIFT;
+    pSharedData->freePmaMemory = freePmaMemory;
+    if (freePmaMemory < pSharedData->memWatermarks.info.minFreePmaMemory)
+    {
+        pSharedData->memWatermarks.info.minFreePmaMemory = freePmaMemory;
+    }
 
     gpushareddataWriteFinish(pGpu);
 }
@@ -3750,8 +3755,10 @@ memmgrInitCeUtils_IMPL
 
     if (!bFifoLite && pMemoryManager->pCeUtilsSuspended != NULL)
     {
+        // Pool entries beyond the primary stayed warm across the suspend
         pMemoryManager->pCeUtils = pMemoryManager->pCeUtilsSuspended;
         pMemoryManager->pCeUtilsSuspended = NULL;
+        pMemoryManager->pCeUtilsPool[0] = pMemoryManager->pCeUtils;
         return NV_OK;
     }
 
@@ -3768,6 +3775,33 @@ memmgrInitCeUtils_IMPL
     if (status != NV_OK)
     {
         memmgrDestroyCeUtils(pMemoryManager, NV_FALSE);
+        return status;
+    }
+
+    //
+    // Warm up the shared channel pool so internal copy users don't pay
+    // channel setup latency on their first copy. Extra channels are
+    // best-effort; the pool just stays smaller if creation fails.
+    // FIFO-lite instances are for suspend-time FBSR and are not pooled.
+    //
+    if (!bFifoLite)
+    {
+        NvU32 i;
+
+        pMemoryManager->pCeUtilsPool[0]  = pMemoryManager->pCeUtils;
+        pMemoryManager->ceUtilsPoolCount = 1;
+        pMemoryManager->ceUtilsPoolNext  = 0;
+
+        for (i = 1; i < MEMMGR_CEUTILS_POOL_SIZE; i++)
+        {
+            if (objCreate(&pMemoryManager->pCeUtilsPool[i], pMemoryManager, CeUtils,
+                          ENG_GET_GPU(pMemoryManager), NULL, &ceUtilsParams) != NV_OK)
+            {
+                pMemoryManager->pCeUtilsPool[i] = NULL;
+                break;
+            }
+            pMemoryManager->ceUtilsPoolCount++;
+        }
     }
 
     return status;
@@ -3783,11 +3817,55 @@ memmgrDestroyCeUtils_IMPL
     if (bSuspendCeUtils)
     {
         NV_ASSERT_OR_RETURN_VOID(pMemoryManager->pCeUtilsSuspended == NULL);
+
+        //
+        // Only the primary is parked; pool entries beyond it are left
+        // allocated so the warm channels can be reused on resume.
+        //
         pMemoryManager->pCeUtilsSuspended = pMemoryManager->pCeUtils;
     }
     else
     {
+        if ((pMemoryManager->pCeUtils != NULL) &&
+            (pMemoryManager->pCeUtils == pMemoryManager->pCeUtilsPool[0]))
+        {
+            NvU32 i;
+
+            for (i = 1; i < pMemoryManager->ceUtilsPoolCount; i++)
+            {
+                objDelete(pMemoryManager->pCeUtilsPool[i]);
+                pMemoryManager->pCeUtilsPool[i] = NULL;
+            }
+            pMemoryManager->pCeUtilsPool[0]  = NULL;
+            pMemoryManager->ceUtilsPoolCount = 0;
+            pMemoryManager->ceUtilsPoolNext  = 0;
+        }
         objDelete(pMemoryManager->pCeUtils);
     }
     pMemoryManager->pCeUtils = NULL;
 }
+
+/*!
+ * @brief Round-robin accessor for the shared CeUtils channel pool
+ *
+ * Internal copy users share the warm pool instead of instantiating their
+ * own channels. Falls back to the primary instance when the pool is not
+ * active (FIFO-lite instances, or before the pool is warmed).
+ */
+CeUtils *
+memmgrGetCeUtils_IMPL
+(
+    MemoryManager *pMemoryManager
+)
+{
+    if ((pMemoryManager->ceUtilsPoolCount > 1) &&
+        (pMemoryManager->pCeUtils == pMemoryManager->pCeUtilsPool[0]))
+    {
+        NvU32 idx = pMemoryManager->ceUtilsPoolNext;
+
+        pMemoryManager->ceUtilsPoolNext = (idx + 1) % pMemoryManager->ceUtilsPoolCount;
+        return pMemoryManager->pCeUtilsPool[idx];
+    }
+
+    return pMemoryManager->pCeUtils;
+}
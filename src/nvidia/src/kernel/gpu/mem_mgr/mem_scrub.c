@@ -62,11 +62,14 @@
 #include "class/clc86f.h"   // HOPPER_CHANNEL_GPFIFO_A
 
 static NvU64  _scrubCheckProgress(OBJMEMSCRUB *pScrubber);
-static NvU64  _searchScrubList(OBJMEMSCRUB *pScrubber, RmPhysAddr base, NvU64 size);
+static NvU64  _scrubChannelUpdateProgress(OBJMEMSCRUB *pScrubber, NvU32 channelIdx);
+static void   _scrubServiceInterrupts(OBJMEMSCRUB *pScrubber);
+static NvU64  _searchScrubList(OBJMEMSCRUB *pScrubber, RmPhysAddr base, NvU64 size,
+                               NvU64 *pWaitPayloads);
 static void   _waitForPayload(OBJMEMSCRUB  *pScrubber, RmPhysAddr  base, RmPhysAddr end);
 static void   _scrubAddWorkToList(OBJMEMSCRUB  *pScrubber, RmPhysAddr  base, NvU64  size, NvU64  newId);
-static NvU32  _scrubMemory(OBJMEMSCRUB  *pScrubber, RmPhysAddr base, NvU64 size,
-                           NvU32 dstCpuCacheAttrib, NvU32 freeToken);
+static NV_STATUS _scrubMemory(OBJMEMSCRUB  *pScrubber, NvU32 channelIdx, RmPhysAddr base,
+                              NvU64 size, NvU32 dstCpuCacheAttrib, NvU64 *pPayload);
 static void   _scrubWaitAndSave(OBJMEMSCRUB *pScrubber, PSCRUB_NODE pList, NvLength  itemsToSave);
 static NvU64  _scrubGetFreeEntries(OBJMEMSCRUB *pScrubber);
 static NvU64  _scrubCheckAndSubmit(OBJMEMSCRUB *pScrubber, NvU64 pageCount, PSCRUB_NODE  pList,
@@ -138,8 +141,19 @@ scrubberConstruct
     }
     portMemSet(pScrubber->pScrubList, 0, sizeof(SCRUB_NODE) * MAX_SCRUB_ITEMS);
 
+    pScrubber->pWorkTags = (SCRUB_CHANNEL_TAG *)
+                       portMemAllocNonPaged(sizeof(SCRUB_CHANNEL_TAG) * MAX_SCRUB_ITEMS);
+    if (pScrubber->pWorkTags == NULL)
+    {
+        status = NV_ERR_INSUFFICIENT_RESOURCES;
+        goto destroyscrublist;
+    }
+    portMemSet(pScrubber->pWorkTags, 0, sizeof(SCRUB_CHANNEL_TAG) * MAX_SCRUB_ITEMS);
+
     pScrubber->pGpu = pGpu;
 
+    pScrubber->numChannels = 1;
+
     {
         NV_PRINTF(LEVEL_INFO, "Starting to init CeUtils for scrubber.\n");
         NV0050_ALLOCATION_PARAMETERS ceUtilsAllocParams = {0};
@@ -173,9 +187,41 @@ scrubberConstruct
         }
         else
         {
-            NV_ASSERT_OK_OR_GOTO(status, objCreate(&pScrubber->pCeUtils, pHeap, CeUtils, pGpu, pKernelMIGGPUInstance, &ceUtilsAllocParams),
+            NV_ASSERT_OK_OR_GOTO(status, objCreate(&pScrubber->pCeUtils[0], pHeap, CeUtils, pGpu, pKernelMIGGPUInstance, &ceUtilsAllocParams),
                destroyscrublist);
             pScrubber->engineType = NV2080_ENGINE_TYPE_COPY2;
+
+            //
+            // Stripe scrub work across additional copy engines where the
+            // config allows it. Each extra channel is forced onto a distinct
+            // LCE; failures here are not fatal, we just scrub with fewer
+            // channels. MIG instances are limited to their scrubber CE.
+            //
+            if (!bMIGInUse && !IS_VIRTUAL(pGpu))
+            {
+                KernelBus *pKernelBus = GPU_GET_KERNEL_BUS(pGpu);
+                KernelCE  *pKCe       = NULL;
+
+                KCE_ITER_ALL_BEGIN(pGpu, pKCe, 0)
+                    if ((pScrubber->numChannels < SCRUBBER_MAX_CE_CHANNELS) &&
+                        (pKCe->publicID != pScrubber->pCeUtils[0]->pChannel->ceId) &&
+                        kbusCheckEngine_HAL(pGpu, pKernelBus, ENG_CE(pKCe->publicID)) &&
+                        !ceIsCeGrce(pGpu, RM_ENGINE_TYPE_COPY(pKCe->publicID)) &&
+                        gpuCheckEngineTable(pGpu, RM_ENGINE_TYPE_COPY(pKCe->publicID)))
+                    {
+                        NV0050_ALLOCATION_PARAMETERS extraChannelParams = ceUtilsAllocParams;
+
+                        extraChannelParams.flags |= DRF_DEF(0050, _CEUTILS_FLAGS, _FORCE_CE_ID, _TRUE);
+                        extraChannelParams.forceCeId = pKCe->publicID;
+
+                        if (objCreate(&pScrubber->pCeUtils[pScrubber->numChannels], pHeap, CeUtils,
+                                      pGpu, pKernelMIGGPUInstance, &extraChannelParams) == NV_OK)
+                        {
+                            pScrubber->numChannels++;
+                        }
+                    }
+                KCE_ITER_END
+            }
         }
         NV_ASSERT_OK_OR_GOTO(status, pmaRegMemScrub(pPma, pScrubber), destroyscrublist);
     }
@@ -183,6 +229,15 @@ scrubberConstruct
     return status;
 
 destroyscrublist:
+    {
+        NvU32 ch;
+        for (ch = 0; ch < SCRUBBER_MAX_CE_CHANNELS; ch++)
+        {
+            objDelete(pScrubber->pCeUtils[ch]);
+            pScrubber->pCeUtils[ch] = NULL;
+        }
+    }
+    portMemFree(pScrubber->pWorkTags);
     portMemFree(pScrubber->pScrubList);
 
 deinitmutex:
@@ -211,18 +266,17 @@ _isScrubWorkPending(
     }
     else
     {
-        NvU64 lastCompleted;
-        if (pScrubber->engineType ==  NV2080_ENGINE_TYPE_SEC2)
-        {
-            lastCompleted = sec2utilsUpdateProgress(pScrubber->pSec2Utils);
-        }
-        else
+        NvU32 ch;
+
+        for (ch = 0; ch < pScrubber->numChannels; ch++)
         {
-            lastCompleted = ceutilsUpdateProgress(pScrubber->pCeUtils);
+            if (_scrubChannelUpdateProgress(pScrubber, ch) !=
+                pScrubber->lastSubmittedPayload[ch])
+            {
+                workPending = NV_TRUE;
+                break;
+            }
         }
-
-        if (pScrubber->lastSubmittedWorkId != lastCompleted)
-            workPending = NV_TRUE;
     }
     return workPending;
 }
@@ -294,6 +348,7 @@ scrubberDestruct
     portMemFree(pPmaScrubList);
 
     portMemFree(pScrubber->pScrubList);
+    portMemFree(pScrubber->pWorkTags);
     {
         if (pScrubber->engineType == NV2080_ENGINE_TYPE_SEC2)
         {
@@ -301,7 +356,12 @@ scrubberDestruct
         }
         else
         {
-            objDelete(pScrubber->pCeUtils);
+            NvU32 ch;
+            for (ch = 0; ch < pScrubber->numChannels; ch++)
+            {
+                objDelete(pScrubber->pCeUtils[ch]);
+                pScrubber->pCeUtils[ch] = NULL;
+            }
         }
     }
 
@@ -704,6 +764,8 @@ _scrubCheckAndSubmit
 {
     NvU64     iter = 0;
     NvU64     newId;
+    NvU32     channelIdx;
+    NvU64     payload;
     NV_STATUS status;
 
     if (pScrubListCopy == NULL && pagesToScrubCheck != 0)
@@ -719,13 +781,17 @@ _scrubCheckAndSubmit
     {
         newId    = pScrubber->lastSubmittedWorkId + 1;
 
+        // Stripe the work round-robin across the scrub channels
+        channelIdx = pScrubber->nextChannel;
+        pScrubber->nextChannel = (pScrubber->nextChannel + 1) % pScrubber->numChannels;
+
         NV_PRINTF(LEVEL_INFO,
-                  "Submitting work, Id: %llx, base: %llx, size: %llx\n",
-                  newId, pList[iter].base, pList[iter].size);
+                  "Submitting work, Id: %llx, channel: %u, base: %llx, size: %llx\n",
+                  newId, channelIdx, pList[iter].base, pList[iter].size);
 
         {
-            status =_scrubMemory(pScrubber, pList[iter].base, pList[iter].size, NV_MEMORY_DEFAULT,
-                                 (NvU32)newId);
+            status =_scrubMemory(pScrubber, channelIdx, pList[iter].base, pList[iter].size,
+                                 NV_MEMORY_DEFAULT, &payload);
         }
 
         if(status != NV_OK)
@@ -733,6 +799,9 @@ _scrubCheckAndSubmit
             NV_PRINTF(LEVEL_ERROR, "Failing because the work didn't submit.\n");
             goto exit;
         }
+        pScrubber->pWorkTags[(newId - 1) % MAX_SCRUB_ITEMS].channelIdx = channelIdx;
+        pScrubber->pWorkTags[(newId - 1) % MAX_SCRUB_ITEMS].payload    = payload;
+        pScrubber->lastSubmittedPayload[channelIdx] = payload;
         _scrubAddWorkToList(pScrubber, pList[iter].base, pList[iter].size, newId);
         _scrubCheckProgress(pScrubber);
     }
@@ -756,8 +825,11 @@ _scrubGetFreeEntries
 }
 
 /**
- * helper function to return the max semaphore id that we need to wait for
- * array of scrub works
+ * helper function to return the max work id that we need to wait for
+ * array of scrub works. When pWaitPayloads is non-NULL, it is filled
+ * with the highest channel payload among the overlapping works for each
+ * channel (0 meaning nothing to wait for on that channel), so the caller
+ * can wait on exactly the channels carrying the overlapping scrubs.
  *
  * @returns 0, if no entry in list matched the base& end
  */
@@ -766,7 +838,8 @@ _searchScrubList
 (
     OBJMEMSCRUB  *pScrubber,
     RmPhysAddr    base,
-    RmPhysAddr    end
+    RmPhysAddr    end,
+    NvU64        *pWaitPayloads
 )
 {
     NvU64      tempLastSeenIdByClient    = pScrubber->lastSeenIdByClient;
@@ -791,6 +864,16 @@ _searchScrubList
         {
            id    = pScrubber->pScrubList[tempLastSeenIdByClient%MAX_SCRUB_ITEMS].id;
            maxId = (id > maxId) ? id : maxId;
+
+           if ((pWaitPayloads != NULL) && (id != 0))
+           {
+               SCRUB_CHANNEL_TAG *pTag = &pScrubber->pWorkTags[(id - 1) % MAX_SCRUB_ITEMS];
+
+               if (pTag->payload > pWaitPayloads[pTag->channelIdx])
+               {
+                   pWaitPayloads[pTag->channelIdx] = pTag->payload;
+               }
+           }
         }
         tempLastSeenIdByClient++;
     }
@@ -821,12 +904,7 @@ _scrubWaitAndSave
 
     while (currentCompletedId < (pScrubber->lastSeenIdByClient + itemsToSave))
     {
-        {
-            if (pScrubber->engineType == NV2080_ENGINE_TYPE_SEC2)
-                sec2utilsServiceInterrupts(pScrubber->pSec2Utils);
-            else
-                ceutilsServiceInterrupts(pScrubber->pCeUtils);
-        }
+        _scrubServiceInterrupts(pScrubber);
         currentCompletedId = _scrubCheckProgress(pScrubber);
     }
 
@@ -846,19 +924,34 @@ _waitForPayload
 )
 {
     NvU64     idToWait;
+    NvU64     waitPayloads[SCRUBBER_MAX_CE_CHANNELS] = {0};
+    NvU32     ch;
 
     //We need to look up in the range between [lastSeenIdByClient, lastSubmittedWorkId]
-    idToWait = _searchScrubList(pScrubber, base, end);
+    idToWait = _searchScrubList(pScrubber, base, end, waitPayloads);
 
     if (idToWait == 0)
     {
         return;
     }
 
-    // Loop will break out, when the semaphore is equal to payload
-    while (_scrubCheckProgress(pScrubber) < idToWait)
+    //
+    // Allocation-blocking waits only need the channels carrying the
+    // overlapping scrubs to catch up, not the whole global queue, so
+    // unrelated background scrubbing on other channels is not waited on.
+    //
+    for (ch = 0; ch < pScrubber->numChannels; ch++)
     {
-        portUtilSpin();
+        if (waitPayloads[ch] == 0)
+        {
+            continue;
+        }
+
+        // Loop will break out, when the semaphore is equal to payload
+        while (_scrubChannelUpdateProgress(pScrubber, ch) < waitPayloads[ch])
+        {
+            portUtilSpin();
+        }
     }
 }
 
@@ -893,10 +986,52 @@ _scrubAddWorkToList
 
 
 
+/**
+ * helper function to read the completed payload of a single scrub channel
+ *
+ * @returns the last completed channel-local payload
+ */
+static NvU64
+_scrubChannelUpdateProgress
+(
+    OBJMEMSCRUB *pScrubber,
+    NvU32        channelIdx
+)
+{
+    if (pScrubber->engineType == NV2080_ENGINE_TYPE_SEC2)
+        return sec2utilsUpdateProgress(pScrubber->pSec2Utils);
+
+    return ceutilsUpdateProgress(pScrubber->pCeUtils[channelIdx]);
+}
+
+/**
+ * helper function to service the interrupts of every scrub channel
+ */
+static void
+_scrubServiceInterrupts
+(
+    OBJMEMSCRUB *pScrubber
+)
+{
+    if (pScrubber->engineType == NV2080_ENGINE_TYPE_SEC2)
+    {
+        sec2utilsServiceInterrupts(pScrubber->pSec2Utils);
+    }
+    else
+    {
+        NvU32 ch;
+
+        for (ch = 0; ch < pScrubber->numChannels; ch++)
+            ceutilsServiceInterrupts(pScrubber->pCeUtils[ch]);
+    }
+}
+
 /**
  * Scrubber uses 64 bit index to track the work submitted. But HW supports
  * only 32 bit semaphore. The current completed Id is calculated here, based
- * on the lastSeenIdByClient and current HW semaphore value.
+ * on the lastSeenIdByClient and current HW semaphore value. With multi-CE
+ * striping the channels complete independently, so the global frontier is
+ * advanced while the next work item's channel payload has completed.
  *
  * @returns Current Completed 64 bit ID
  */
@@ -932,10 +1067,29 @@ _scrubCheckProgress
     }
     else
     {
-        if (pScrubber->engineType ==  NV2080_ENGINE_TYPE_SEC2)
-            lastSWSemaphoreDone = sec2utilsUpdateProgress(pScrubber->pSec2Utils);
-        else
-            lastSWSemaphoreDone = ceutilsUpdateProgress(pScrubber->pCeUtils);
+        NvU64 completed[SCRUBBER_MAX_CE_CHANNELS];
+        NvU32 ch;
+
+        // Sample each channel's completed payload once per call
+        for (ch = 0; ch < pScrubber->numChannels; ch++)
+            completed[ch] = _scrubChannelUpdateProgress(pScrubber, ch);
+
+        //
+        // Work id (done + 1) lives at slot done % MAX_SCRUB_ITEMS; all ids
+        // in (lastSWSemaphoreDone, lastSubmittedWorkId] are live, so their
+        // tags are valid.
+        //
+        lastSWSemaphoreDone = pScrubber->lastSWSemaphoreDone;
+        while (lastSWSemaphoreDone < pScrubber->lastSubmittedWorkId)
+        {
+            SCRUB_CHANNEL_TAG *pTag =
+                &pScrubber->pWorkTags[lastSWSemaphoreDone % MAX_SCRUB_ITEMS];
+
+            if (pTag->payload > completed[pTag->channelIdx])
+                break;
+
+            lastSWSemaphoreDone++;
+        }
     }
 
     pScrubber->lastSWSemaphoreDone = lastSWSemaphoreDone;
@@ -946,16 +1100,18 @@ _scrubCheckProgress
 
 /**  Single function to memset a surface mapped by GPU. This interface supports
      both sysmem and vidmem surface, since it uses CE to memset a surface.
-     The user is notified by releasing semaphore with value "payload"
+     The completed work is tracked by the channel-local payload returned in
+     pPayload.
   */
 static NV_STATUS
 _scrubMemory
 (
     OBJMEMSCRUB *pScrubber,
+    NvU32        channelIdx,
     RmPhysAddr   base,
     NvU64        size,
     NvU32        dstCpuCacheAttrib,
-    NvU32        payload
+    NvU64       *pPayload
 )
 {
     NV_STATUS status = NV_OK;
@@ -972,7 +1128,7 @@ _scrubMemory
         memsetParams.length = size;
 
         NV_ASSERT_OK_OR_GOTO(status, sec2utilsMemset(pScrubber->pSec2Utils, &memsetParams), cleanup);
-        pScrubber->lastSubmittedWorkId = memsetParams.submittedWorkId;
+        *pPayload = memsetParams.submittedWorkId;
     }
     else
     {
@@ -981,8 +1137,8 @@ _scrubMemory
         memsetParams.length = size;
         memsetParams.flags = NV0050_CTRL_MEMSET_FLAGS_ASYNC | NV0050_CTRL_MEMSET_FLAGS_PIPELINED;
 
-        NV_ASSERT_OK_OR_GOTO(status, ceutilsMemset(pScrubber->pCeUtils, &memsetParams), cleanup);
-        pScrubber->lastSubmittedWorkId = memsetParams.submittedWorkId;
+        NV_ASSERT_OK_OR_GOTO(status, ceutilsMemset(pScrubber->pCeUtils[channelIdx], &memsetParams), cleanup);
+        *pPayload = memsetParams.submittedWorkId;
     }
 
 cleanup:
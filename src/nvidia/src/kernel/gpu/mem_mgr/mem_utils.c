@@ -602,7 +602,7 @@ memmgrMemCopyWithTransferType
                 params.srcOffset   = pSrcInfo->offset;
                 params.length      = size;
 
-                return ceutilsMemcopy(pMemoryManager->pCeUtils, &params);
+                return ceutilsMemcopy(memmgrGetCeUtils(pMemoryManager), &params);
             }
             break;
         case TRANSFER_TYPE_CE_PRI:
@@ -718,7 +718,7 @@ memmgrMemSetWithTransferType
                 params.length   = size;
                 params.pattern  = value;
 
-                return ceutilsMemset(pMemoryManager->pCeUtils, &params);
+                return ceutilsMemset(memmgrGetCeUtils(pMemoryManager), &params);
             }
             break;
         case TRANSFER_TYPE_CE_PRI:
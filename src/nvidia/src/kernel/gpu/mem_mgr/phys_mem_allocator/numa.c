@@ -547,6 +547,18 @@ NV_STATUS pmaNumaAllocate
         return NV_ERR_INVALID_STATE;
     }
 
+    //
+    // A PMA manages exactly one onlined node, so a locality hint can only be
+    // satisfied here when it names this PMA's node; routing between sockets
+    // is the caller's job. A mismatched hint is advisory, not fatal.
+    //
+    if ((flags & PMA_ALLOCATE_SPECIFY_NUMA_NODE_HINT) &&
+        (allocationOptions->numaNodeHint != (NvS32)numaNodeId))
+    {
+        NV_PRINTF(LEVEL_INFO, "NUMA node hint %d does not match node %d, ignored.\n",
+                               allocationOptions->numaNodeHint, numaNodeId);
+    }
+
     if (contigFlag)
     {
         NvU64 contigTotal;
@@ -568,7 +580,7 @@ NV_STATUS pmaNumaAllocate
     //
     if (pPma->bScrubOnFree && !bSkipScrubFlag)
     {
-        portSyncMutexAcquire(pPma->pAllocLock);
+        portSyncExAdaptiveMutexAcquire(pPma->pAllocLock);
         portSyncRwLockAcquireRead(pPma->pScrubberValidLock);
 
         if (pmaPortAtomicGet(&pPma->scrubberValid) != PMA_SCRUBBER_VALID)
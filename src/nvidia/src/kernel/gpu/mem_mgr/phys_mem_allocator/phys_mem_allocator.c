@@ -127,6 +127,95 @@ _pmaDefaultStatsCallback
     return;
 }
 
+/*!
+ * @brief Pop one cached 64KB frame of the given protection type.
+ *
+ * The returned frame is already STATE_PIN with no attributes set.
+ * Takes only the magazine lock; safe to call without the PMA lock.
+ *
+ * @return NV_TRUE if a frame was returned in *pAddr
+ */
+static NvBool
+_pmaFrameMagazinePop(PMA *pPma, MEMORY_PROTECTION prot, NvU64 *pAddr)
+{
+    PMA_FRAME_MAGAZINE *pMag = &pPma->frameMagazine[prot];
+    NvBool bPopped = NV_FALSE;
+
+    portSyncSpinlockAcquire(pMag->pLock);
+    if (pMag->count > 0)
+    {
+        *pAddr = pMag->pages[--pMag->count];
+        bPopped = NV_TRUE;
+    }
+    portSyncSpinlockRelease(pMag->pLock);
+
+    return bPopped;
+}
+
+/*!
+ * @brief Cache one 64KB frame of the given protection type.
+ *
+ * The caller must hold the PMA lock and, on success, mark the frame
+ * STATE_PIN with no attributes before releasing it.
+ *
+ * @return NV_TRUE if the frame was accepted (magazine not full)
+ */
+static NvBool
+_pmaFrameMagazinePush(PMA *pPma, MEMORY_PROTECTION prot, NvU64 addr)
+{
+    PMA_FRAME_MAGAZINE *pMag = &pPma->frameMagazine[prot];
+    NvBool bPushed = NV_FALSE;
+
+    portSyncSpinlockAcquire(pMag->pLock);
+    if (pMag->count < PMA_FRAME_MAGAZINE_SIZE)
+    {
+        pMag->pages[pMag->count++] = addr;
+        bPushed = NV_TRUE;
+    }
+    portSyncSpinlockRelease(pMag->pLock);
+
+    return bPushed;
+}
+
+/*!
+ * @brief Return all cached frames to the scanner as STATE_FREE.
+ *
+ * Called with the PMA lock held when an allocation is about to fail with
+ * NV_ERR_NO_MEMORY, so frames parked in the magazines cannot cause a
+ * spurious OOM, and at destroy time.
+ *
+ * @return Number of frames released
+ */
+static NvU64
+_pmaFrameMagazineDrain(PMA *pPma)
+{
+    NvU64 numDrained = 0;
+    NvU32 mag;
+
+    for (mag = 0; mag < NV_ARRAY_ELEMENTS(pPma->frameMagazine); mag++)
+    {
+        NvU64 addr;
+
+        // Partially initialized PMA object being torn down
+        if (pPma->frameMagazine[mag].pLock == NULL)
+        {
+            continue;
+        }
+
+        while (_pmaFrameMagazinePop(pPma, (MEMORY_PROTECTION)mag, &addr))
+        {
+            NvU32 regId = findRegionID(pPma, addr);
+            NvU64 addrBase = pPma->pRegDescriptors[regId]->base;
+
+            pPma->pMapInfo->pmaMapChangeStateAttrib(pPma->pRegions[regId],
+                PMA_ADDR2FRAME(addr, addrBase), STATE_FREE, MAP_MASK);
+            numDrained++;
+        }
+    }
+
+    return numDrained;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 //
 // Public interfaces
@@ -137,6 +226,7 @@ pmaInitialize(PMA *pPma, NvU32 initFlags)
 {
     NV_STATUS status = NV_OK;
     PMA_MAP_INFO *pMapInfo;
+    NvU32 i;
 
     if (pPma == NULL)
     {
@@ -145,6 +235,7 @@ pmaInitialize(PMA *pPma, NvU32 initFlags)
 
     pPma->pPmaLock = NULL;
     pPma->pEvictionCallbacksLock = NULL;
+    portMemSet(pPma->frameMagazine, 0, sizeof(pPma->frameMagazine));
 
     // Assume portMemInitialize() has been called
     pPma->pPmaLock = (PORT_SPINLOCK *)portMemAllocNonPaged(portSyncSpinlockSize);
@@ -192,6 +283,24 @@ pmaInitialize(PMA *pPma, NvU32 initFlags)
         goto error;
     }
 
+    for (i = 0; i < NV_ARRAY_ELEMENTS(pPma->frameMagazine); i++)
+    {
+        pPma->frameMagazine[i].pLock = (PORT_SPINLOCK *)portMemAllocNonPaged(portSyncSpinlockSize);
+        if (pPma->frameMagazine[i].pLock == NULL)
+        {
+            status = NV_ERR_NO_MEMORY;
+            goto error;
+        }
+
+        status = portSyncSpinlockInitialize(pPma->frameMagazine[i].pLock);
+        if (status != NV_OK)
+        {
+            portMemFree(pPma->frameMagazine[i].pLock);
+            pPma->frameMagazine[i].pLock = NULL;
+            goto error;
+        }
+    }
+
     pPma->pScrubberValidLock = (PORT_RWLOCK *)portMemAllocNonPaged(portSyncRwLockSize);
     if (pPma->pScrubberValidLock == NULL)
     {
@@ -395,6 +504,9 @@ pmaDestroy(PMA *pPma)
         }
     }
 
+    // Release cached frames so the maps are destroyed in a consistent state
+    _pmaFrameMagazineDrain(pPma);
+
     for (i = 0; i < pPma->regSize; i++)
     {
         pPma->pMapInfo->pmaMapDestroy((void *)pPma->pRegions[i]);
@@ -409,6 +521,16 @@ pmaDestroy(PMA *pPma)
 
     portMemFree(pPma->pMapInfo);
 
+    for (i = 0; i < NV_ARRAY_ELEMENTS(pPma->frameMagazine); i++)
+    {
+        if (pPma->frameMagazine[i].pLock != NULL)
+        {
+            portSyncSpinlockDestroy(pPma->frameMagazine[i].pLock);
+            portMemFree(pPma->frameMagazine[i].pLock);
+            pPma->frameMagazine[i].pLock = NULL;
+        }
+    }
+
     if (pPma->pAllocLock != NULL)
     {
         portSyncMutexDestroy(pPma->pAllocLock);
@@ -583,6 +705,9 @@ pmaAllocatePages
     NvBool tryEvict = NV_TRUE;
     NvBool tryAlloc = NV_TRUE;
 
+    // Whether the freed-frame magazines have been drained back to the scanner
+    NvBool bMagazineDrained = NV_FALSE;
+
     const NvU64 numFramesToAllocateTotal = framesPerPage * allocationCount;
 
     if (pPma == NULL || pPages == NULL || allocationCount == 0
@@ -694,6 +819,40 @@ pmaAllocatePages
     useFunc = contigFlag ? (pPma->pMapInfo->pmaMapScanContiguous) :
                            (pPma->pMapInfo->pmaMapScanDiscontiguous);
 
+    //
+    // Fast path: serve single-page 64KB requests from the freed-frame
+    // magazine without scanning. Cached frames are STATE_PIN with no
+    // attributes, so pinned non-persistent requests bypass the PMA lock
+    // entirely; anything else needs one O(1) state change. Requests with
+    // placement constraints or scrub-on-free fall through to the scanner.
+    //
+    if ((allocationCount == 1) && (pageSize == _PMA_64KB) && !bScrubOnFree &&
+        ((flags & ~(PMA_ALLOCATE_DONT_EVICT | PMA_ALLOCATE_PINNED |
+                    PMA_ALLOCATE_CONTIGUOUS | PMA_ALLOCATE_PERSISTENT |
+                    PMA_ALLOCATE_PROTECTED_REGION | PMA_ALLOCATE_NO_ZERO |
+                    PMA_ALLOCATE_ALLOW_PARTIAL |
+                    PMA_ALLOCATE_SPECIFY_NUMA_NODE_HINT)) == 0))
+    {
+        MEMORY_PROTECTION magProt = (flags & PMA_ALLOCATE_PROTECTED_REGION) ?
+            MEMORY_PROTECTION_PROTECTED : MEMORY_PROTECTION_UNPROTECTED;
+
+        if (_pmaFrameMagazinePop(pPma, magProt, pPages))
+        {
+            if (pinOption != STATE_PIN)
+            {
+                regId    = findRegionID(pPma, pPages[0]);
+                addrBase = pPma->pRegDescriptors[regId]->base;
+
+                portSyncSpinlockAcquire(pPma->pPmaLock);
+                pPma->pMapInfo->pmaMapChangeStateAttrib(pPma->pRegions[regId],
+                    PMA_ADDR2FRAME(pPages[0], addrBase), pinOption, MAP_MASK);
+                portSyncSpinlockRelease(pPma->pPmaLock);
+            }
+            allocationOptions->numPagesAllocated = 1;
+            return NV_OK;
+        }
+    }
+
     // No locking required because the states don't change
     status = pmaSelector(pPma, allocationOptions, regionList);
     if (status != NV_OK)
@@ -704,7 +863,7 @@ pmaAllocatePages
 
     if (bScrubOnFree)
     {
-        portSyncMutexAcquire(pPma->pAllocLock);
+        portSyncExAdaptiveMutexAcquire(pPma->pAllocLock);
         portSyncRwLockAcquireRead(pPma->pScrubberValidLock);
         if (pmaPortAtomicGet(&pPma->scrubberValid) != PMA_SCRUBBER_VALID)
         {
@@ -945,6 +1104,21 @@ pmaAllocatePages_retry:
         }
     }
 
+    //
+    // Before failing with OOM, return any frames parked in the freed-frame
+    // magazines to the scanner and retry once.
+    //
+    if ((status == NV_ERR_NO_MEMORY) && !bMagazineDrained)
+    {
+        bMagazineDrained = NV_TRUE;
+        if (_pmaFrameMagazineDrain(pPma) > 0)
+        {
+            portSyncSpinlockRelease(pPma->pPmaLock);
+            NV_PRINTF(LEVEL_INFO, "Retrying after draining freed-frame magazines\n");
+            goto pmaAllocatePages_retry;
+        }
+    }
+
     //
     // if scrubbing is active in the background, release lock and spin until it
     // completes, then re-try.
@@ -1348,6 +1522,30 @@ pmaFreePages
 
         _pmaReallocBlacklistPages(pPma, regId, pPages[i], pageCount * size);
 
+        //
+        // Park single 64KB frames in the freed-frame magazine instead of
+        // freeing them, so the next small allocation skips the scanner.
+        // Frames picked for eviction or blacklisted are never cached, and
+        // scrub-on-free frees must go through the scrubber.
+        //
+        if ((framesPerPage == 1) && (size == _PMA_64KB) && !(bScrubValid && bNeedScrub))
+        {
+            MEMORY_PROTECTION magProt =
+                pPma->pRegDescriptors[regId]->bProtected ? MEMORY_PROTECTION_PROTECTED :
+                                                           MEMORY_PROTECTION_UNPROTECTED;
+            PMA_PAGESTATUS curStatus =
+                pPma->pMapInfo->pmaMapRead(pPma->pRegions[regId], frameNum, NV_TRUE);
+
+            if (((curStatus & (ATTRIB_EVICTING | ATTRIB_BLACKLIST)) == 0) &&
+                _pmaFrameMagazinePush(pPma, magProt, pPages[i]))
+            {
+                // Keep the frame allocated-pinned while it sits in the magazine
+                pPma->pMapInfo->pmaMapChangeStateAttrib(pPma->pRegions[regId], frameNum,
+                                                        STATE_PIN, MAP_MASK);
+                continue;
+            }
+        }
+
         for (j = 0; j < framesPerPage; j++)
         {
             PMA_PAGESTATUS newStatus = (bScrubValid && bNeedScrub) ? ATTRIB_SCRUBBING : STATE_FREE;
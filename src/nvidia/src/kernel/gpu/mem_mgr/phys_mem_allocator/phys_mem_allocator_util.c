@@ -470,7 +470,7 @@ _pmaEvictContiguous
 
         status = pPma->evictRangeCb(pPma->evictCtxPtr, evictStart, evictEnd, prot);
 
-        portSyncMutexAcquire(pPma->pAllocLock);
+        portSyncExAdaptiveMutexAcquire(pPma->pAllocLock);
 
         NV_PRINTF(LEVEL_INFO, "evictRangeCb returned with status %llx\n", (NvU64)status);
 
@@ -591,7 +591,7 @@ _pmaEvictPages
         portSyncMutexRelease(pPma->pAllocLock);
         status = pPma->evictPagesCb(pPma->evictCtxPtr, pageSize, evictPages,
                             (NvU32)evictPageCount, physBegin, physEnd, prot);
-        portSyncMutexAcquire(pPma->pAllocLock);
+        portSyncExAdaptiveMutexAcquire(pPma->pAllocLock);
 
         NV_PRINTF(LEVEL_INFO, "evictPagesCb returned with status %llx\n", (NvU64)status);
 
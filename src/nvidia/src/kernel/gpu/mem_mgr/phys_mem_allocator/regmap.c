@@ -83,6 +83,34 @@ maxZerosGet(NvU64 bits)
     return y;
 }
 
+//
+// Recompute the fully-allocated-word summary bits for one bit plane over a
+// range of map words. Bit g of fullWords[plane] is set iff map[plane][g] has
+// all 64 bits set, which lets the contiguous scans skip occupied regions one
+// summary word (4096 frames) at a time instead of touching every map word.
+// Cost is O(words touched), called from the same paths that write the map.
+//
+static void
+_pmaRegmapUpdateFullWords(PMA_REGMAP *pRegmap, NvU64 plane, NvU64 firstIdx, NvU64 lastIdx)
+{
+    NvU64 g;
+
+    for (g = firstIdx; g <= lastIdx; g++)
+    {
+        NvU64 sumIdx = g >> FRAME_TO_U64_SHIFT;
+        NvU64 sumMask = MAKE_BITMASK(g & FRAME_TO_U64_MASK);
+
+        if (pRegmap->map[plane][g] == NV_U64_MAX)
+        {
+            pRegmap->fullWords[plane][sumIdx] |= sumMask;
+        }
+        else
+        {
+            pRegmap->fullWords[plane][sumIdx] &= ~sumMask;
+        }
+    }
+}
+
 static NvS64
 _checkOne(NvU64 *bits, NvU64 start, NvU64 end)
 {
@@ -408,6 +436,23 @@ pmaRegmapInit
         }
         portMemSet(newMap->map[i], 0, (NvLength) (newMap->mapLength * sizeof(NvU64)));
     }
+
+    //
+    // One summary bit per map word. All frames start FREE, so the zeroed
+    // summary is already correct; init-time pinned bits below never fill
+    // a whole word but are folded in anyway for robustness.
+    //
+    newMap->fullWordsLength = PAGE_MAPIDX(newMap->mapLength - 1) + 1;
+    for (i = 0; i < PMA_BITS_PER_PAGE; i++)
+    {
+        newMap->fullWords[i] = (NvU64*) portMemAllocNonPaged((NvLength)(newMap->fullWordsLength * sizeof(NvU64)));
+        if (newMap->fullWords[i] == NULL)
+        {
+            pmaRegmapDestroy(newMap);
+            return NULL;
+        }
+        portMemSet(newMap->fullWords[i], 0, (NvLength) (newMap->fullWordsLength * sizeof(NvU64)));
+    }
     {
         //
         // Simplify logic for 2M tracking. Set the last few nonaligned bits as pinned
@@ -417,6 +462,7 @@ pmaRegmapInit
         NvU64 endBit = (numFrames - 1llu) & FRAME_TO_U64_MASK;
         NvU64 endMask = endBit == FRAME_TO_U64_MASK ? 0llu : ~(NV_U64_MAX >> (FRAME_TO_U64_MASK - endBit));
         newMap->map[MAP_IDX_ALLOC_PIN][endOffs] |= endMask;
+        _pmaRegmapUpdateFullWords(newMap, MAP_IDX_ALLOC_PIN, endOffs, endOffs);
     }
 
     return (void *)newMap;
@@ -432,6 +478,7 @@ pmaRegmapDestroy(void *pMap)
     for (i = 0; i < PMA_BITS_PER_PAGE; i++)
     {
         portMemFree(pRegmap->map[i]);
+        portMemFree(pRegmap->fullWords[i]);
     }
 
     pRegmap->pPmaStats->numFreeFrames -= pRegmap->totalFrames;
@@ -566,20 +613,21 @@ pmaRegmapChangeBlockStateAttrib
         {
             pRegmap->map[i][initialIdx] &= ~(initialMask & finalMask);
             pRegmap->map[i][initialIdx] |= toWrite & (initialMask & finalMask);
+            _pmaRegmapUpdateFullWords(pRegmap, i, initialIdx, finalIdx);
             continue;
         }
-       
+
         pRegmap->map[i][initialIdx] &= ~initialMask;
         pRegmap->map[i][initialIdx] |= toWrite & initialMask;
-        
+
         for (j = initialIdx + 1; j < finalIdx; j++)
         {
             pRegmap->map[i][j] = toWrite;
-            
+
         }
         pRegmap->map[i][finalIdx] &= ~finalMask;
         pRegmap->map[i][finalIdx] |= toWrite & finalMask;
-        
+        _pmaRegmapUpdateFullWords(pRegmap, i, initialIdx, finalIdx);
     }
 
     if (!(writeMask & STATE_MASK))
@@ -587,6 +635,11 @@ pmaRegmapChangeBlockStateAttrib
         return;
     }
 
+    // The partial-word handling below trims initialIdx/finalIdx; keep the
+    // full touched range for the summary update at the end.
+    NvU64 summaryFirstIdx = initialIdx;
+    NvU64 summaryLastIdx = finalIdx;
+
     // Entire state is in one NvU64, so exit immediately after
     if (initialIdx == finalIdx)
     {
@@ -615,6 +668,14 @@ pmaRegmapChangeBlockStateAttrib
     }
 
 set_regs:
+    if (writeMask & (1llu << MAP_IDX_ALLOC_PIN))
+    {
+        _pmaRegmapUpdateFullWords(pRegmap, MAP_IDX_ALLOC_PIN, summaryFirstIdx, summaryLastIdx);
+    }
+    if (writeMask & (1llu << MAP_IDX_ALLOC_UNPIN))
+    {
+        _pmaRegmapUpdateFullWords(pRegmap, MAP_IDX_ALLOC_UNPIN, summaryFirstIdx, summaryLastIdx);
+    }
     if ((newState & writeMask & STATE_MASK) != 0)
     {
         pRegmap->pPmaStats->numFreeFrames -= delta64k;
@@ -744,6 +805,30 @@ loop_begin:
                 frameBaseIdx += FRAME_TO_U64_SIZE;
                 while (frameBaseIdx <= localEnd)
                 {
+                    //
+                    // Skip over fully-allocated map words using the summary,
+                    // 4096 frames per summary word instead of 64 per map word
+                    //
+                    NvU64 sumIdx = curMapIdx >> FRAME_TO_U64_SHIFT;
+                    NvU64 notFull = ~pRegmap->fullWords[i][sumIdx] &
+                                    (NV_U64_MAX << (curMapIdx & FRAME_TO_U64_MASK));
+                    while (notFull == 0)
+                    {
+                        if (++sumIdx >= pRegmap->fullWordsLength)
+                        {
+                            // No more free pages, exit
+                            return -1;
+                        }
+                        notFull = ~pRegmap->fullWords[i][sumIdx];
+                    }
+                    NvU64 skipToIdx = (sumIdx << FRAME_TO_U64_SHIFT) +
+                                      portUtilCountTrailingZeros64(notFull);
+                    frameBaseIdx += (skipToIdx - curMapIdx) << FRAME_TO_U64_SHIFT;
+                    curMapIdx = skipToIdx;
+                    if (frameBaseIdx > localEnd)
+                    {
+                        break;
+                    }
                     curMap = pRegmap->map[i][curMapIdx];
                     if(curMap != NV_U64_MAX)
                     {
@@ -844,6 +929,31 @@ loop_begin:
                 frameBaseIdx -= FRAME_TO_U64_SIZE;
                 while (frameBaseIdx > localStart)
                 {
+                    //
+                    // Skip over fully-allocated map words using the summary,
+                    // 4096 frames per summary word instead of 64 per map word
+                    //
+                    NvU64 sumIdx = curMapIdx >> FRAME_TO_U64_SHIFT;
+                    NvU64 notFull = ~pRegmap->fullWords[i][sumIdx] &
+                                    (NV_U64_MAX >> (FRAME_TO_U64_MASK - (curMapIdx & FRAME_TO_U64_MASK)));
+                    while (notFull == 0)
+                    {
+                        if (sumIdx == 0)
+                        {
+                            // No more free pages, exit
+                            return -1;
+                        }
+                        sumIdx--;
+                        notFull = ~pRegmap->fullWords[i][sumIdx];
+                    }
+                    NvU64 skipToIdx = (sumIdx << FRAME_TO_U64_SHIFT) + FRAME_TO_U64_MASK -
+                                      portUtilCountLeadingZeros64(notFull);
+                    frameBaseIdx -= (curMapIdx - skipToIdx) << FRAME_TO_U64_SHIFT;
+                    curMapIdx = skipToIdx;
+                    if (frameBaseIdx <= localStart)
+                    {
+                        break;
+                    }
                     curMap = pRegmap->map[i][curMapIdx];
                     if(curMap != NV_U64_MAX)
                     {
@@ -318,7 +318,7 @@ _semsurfEventCallback
 {
     SEM_SHARED_DATA *pShared = pArg;
     SEM_INDEX_LISTENERSIter ilIter;
-    SEM_VALUE_LISTENERSIter vlIter;
+    SEM_VALUE_LISTENERS_NODE *pValueListeners;
     SEM_PENDING_NOTIFICATIONS notifications;
     NvU64 index;
     NvU64 semValue;
@@ -354,29 +354,28 @@ _semsurfEventCallback
             index = mapKey(&pShared->listenerMap, ilIter.pValue);
             semValue = _semsurfGetValue(pShared, index);
 
-            for (vlIter = listIterAll(&ilIter.pValue->listeners);
-                 listIterNext(&vlIter);
-                 vlIter = listIterAll(&ilIter.pValue->listeners))
+            while ((pValueListeners =
+                        mapFindGEQ(&ilIter.pValue->listeners, 0)) != NULL)
             {
                 NV_PRINTF(LEVEL_SILENT,
                           "  Checking index %" NvU64_fmtu " value waiter %"
                           NvU64_fmtu " against semaphore value %" NvU64_fmtu "\n",
-                          index, vlIter.pValue->value, semValue);
+                          index, pValueListeners->value, semValue);
 
-                if (semValue >= vlIter.pValue->value)
+                if (semValue >= pValueListeners->value)
                 {
-                    listInsertExisting(&notifications, NULL, vlIter.pValue);
-                    listRemove(&ilIter.pValue->listeners, vlIter.pValue);
+                    listInsertExisting(&notifications, NULL, pValueListeners);
+                    mapRemove(&ilIter.pValue->listeners, pValueListeners);
                 }
                 else
                 {
                     /* No other values at this index should be signaled yet. */
-                    minWaitValue = vlIter.pValue->value;
+                    minWaitValue = pValueListeners->value;
                     break;
                 }
             }
 
-            if (listCount(&ilIter.pValue->listeners) == 0)
+            if (mapCount(&ilIter.pValue->listeners) == 0)
             {
                 NV_ASSERT(minWaitValue == NV_U64_MAX);
                 mapRemove(&pShared->listenerMap, ilIter.pValue);
@@ -954,7 +953,7 @@ semsurfDestruct_IMPL
         minWaitValue = NV_U64_MAX;
         curIdx = mapKey(&pShared->listenerMap, pIndexListeners);
 
-        for (pValueListeners = listHead(&pIndexListeners->listeners);
+        for (pValueListeners = mapFindGEQ(&pIndexListeners->listeners, 0);
              pValueListeners;
              pValueListeners = pNextValueListeners)
         {
@@ -985,13 +984,13 @@ semsurfDestruct_IMPL
                 }
             }
 
-            pNextValueListeners = listNext(&pIndexListeners->listeners,
-                                           pValueListeners);
+            pNextValueListeners = mapNext(&pIndexListeners->listeners,
+                                          pValueListeners);
 
             if (!pValueListeners->pListeners &&
                 (pValueListeners->newValue == 0))
             {
-                listRemove(&pIndexListeners->listeners, pValueListeners);
+                mapRemove(&pIndexListeners->listeners, pValueListeners);
                 portMemFree(pValueListeners);
             }
             else if (pValueListeners->value < minWaitValue)
@@ -1004,7 +1003,7 @@ semsurfDestruct_IMPL
                                   curIdx,
                                   minWaitValue);
 
-        if (listCount(&pIndexListeners->listeners) == 0)
+        if (mapCount(&pIndexListeners->listeners) == 0)
         {
             NV_ASSERT(minWaitValue == NV_U64_MAX);
             mapRemove(&pShared->listenerMap, pIndexListeners);
@@ -1130,7 +1129,7 @@ _semsurfSetValueAndNotify
 )
 {
     SEM_INDEX_LISTENERS_NODE *valueNode;
-    SEM_VALUE_LISTENERSIter vlIter;
+    SEM_VALUE_LISTENERS_NODE *pValueListeners;
     SEM_PENDING_NOTIFICATIONS notifications;
     NvU64 curValue;
     NvU64 minWaitValue;
@@ -1153,35 +1152,34 @@ _semsurfSetValueAndNotify
         {
             minWaitValue = NV_U64_MAX;
 
-            for (vlIter = listIterAll(&valueNode->listeners);
-                 listIterNext(&vlIter);
-                 vlIter = listIterAll(&valueNode->listeners))
+            while ((pValueListeners =
+                        mapFindGEQ(&valueNode->listeners, 0)) != NULL)
             {
                 NV_PRINTF(LEVEL_SILENT,
                           "  Checking index %" NvU64_fmtu " value waiter %"
                           NvU64_fmtu " against semaphore value %" NvU64_fmtu
                           " from CPU write\n",
-                          index, vlIter.pValue->value, curValue);
+                          index, pValueListeners->value, curValue);
 
-                if (curValue >= vlIter.pValue->value)
+                if (curValue >= pValueListeners->value)
                 {
-                    listInsertExisting(&notifications, NULL, vlIter.pValue);
-                    listRemove(&valueNode->listeners, vlIter.pValue);
-                    if (vlIter.pValue->newValue != 0)
+                    listInsertExisting(&notifications, NULL, pValueListeners);
+                    mapRemove(&valueNode->listeners, pValueListeners);
+                    if (pValueListeners->newValue != 0)
                     {
-                        NV_ASSERT(vlIter.pValue->newValue >= newValue);
-                        newValue = vlIter.pValue->newValue;
+                        NV_ASSERT(pValueListeners->newValue >= newValue);
+                        newValue = pValueListeners->newValue;
                     }
                 }
                 else
                 {
                     /* No other values at this index should be signaled yet. */
-                    minWaitValue = vlIter.pValue->value;
+                    minWaitValue = pValueListeners->value;
                     break;
                 }
             }
 
-            if (listCount(&valueNode->listeners) == 0)
+            if (mapCount(&valueNode->listeners) == 0)
             {
                 NV_ASSERT(minWaitValue == NV_U64_MAX);
                 mapRemove(&pSemSurf->pShared->listenerMap, valueNode);
@@ -1222,11 +1220,9 @@ _semsurfAddWaiter
 )
 {
     SEM_INDEX_LISTENERS_NODE *pIndexListeners;
-    SEM_VALUE_LISTENERSIter vlIter;
     SEM_VALUE_LISTENERS_NODE *pValueListeners;
     EVENTNOTIFICATION *pListener;
     NvHandle hClient = pRsClient->hClient;
-    NvBool valid;
     NV_STATUS rmStatus = NV_OK;
     NvU64 semValue;
     NvU64 prevMinWaitValue = NV_U64_MAX;
@@ -1251,9 +1247,9 @@ _semsurfAddWaiter
 
     pIndexListeners = mapFind(&pSemSurf->pShared->listenerMap, index);
 
-    if (pIndexListeners && listCount(&pIndexListeners->listeners) > 0)
+    if (pIndexListeners &&
+        ((pValueListeners = mapFindGEQ(&pIndexListeners->listeners, 0)) != NULL))
     {
-        pValueListeners = listHead(&pIndexListeners->listeners);
         prevMinWaitValue = pValueListeners->value;
     }
 
@@ -1345,7 +1341,7 @@ _semsurfAddWaiter
             goto failureUnlock;
         }
 
-        listInitIntrusive(&pIndexListeners->listeners);
+        mapInitIntrusive(&pIndexListeners->listeners);
 
         if (!mapInsertExisting(&pSemSurf->pShared->listenerMap,
                                index,
@@ -1361,15 +1357,9 @@ _semsurfAddWaiter
         }
     }
 
-    /* XXX Would be easier/faster if the value listener list was a priority queue */
-    vlIter = listIterAll(&pIndexListeners->listeners);
-    while ((valid = listIterNext(&vlIter)) && vlIter.pValue->value < waitValue);
+    pValueListeners = mapFind(&pIndexListeners->listeners, waitValue);
 
-    if (valid && vlIter.pValue->value == waitValue)
-    {
-        pValueListeners = vlIter.pValue;
-    }
-    else
+    if (!pValueListeners)
     {
         pValueListeners = portMemAllocNonPaged(sizeof(*pValueListeners));
 
@@ -1387,8 +1377,17 @@ _semsurfAddWaiter
         pValueListeners->value = waitValue;
         pValueListeners->index = index;
 
-        listInsertExisting(&pIndexListeners->listeners,
-                           valid ? vlIter.pValue : NULL, pValueListeners);
+        if (!mapInsertExisting(&pIndexListeners->listeners,
+                               waitValue, pValueListeners))
+        {
+            NV_PRINTF(LEVEL_ERROR,
+                      "SemSurf(0x%08x, 0x%08x): "
+                      "Duplicate entry found for new value listener node\n",
+                      hClient, hSemaphoreSurf);
+            portMemFree(pValueListeners);
+            rmStatus = NV_ERR_INVALID_STATE;
+            goto cleanupIndexListener;
+        }
     }
 
     if (newValue)
@@ -1483,12 +1482,12 @@ _semsurfAddWaiter
 cleanupValueListener:
     if (!pValueListeners->pListeners)
     {
-        listRemove(&pIndexListeners->listeners, pValueListeners);
+        mapRemove(&pIndexListeners->listeners, pValueListeners);
         portMemFree(pValueListeners);
     }
 
 cleanupIndexListener:
-    if (listCount(&pIndexListeners->listeners) == 0)
+    if (mapCount(&pIndexListeners->listeners) == 0)
     {
        mapRemove(&pSemSurf->pShared->listenerMap, pIndexListeners);
        portMemFree(pIndexListeners);
@@ -1609,11 +1608,9 @@ _semsurfDelWaiter
 )
 {
     SEM_INDEX_LISTENERS_NODE *pIndexListeners;
-    SEM_VALUE_LISTENERSIter vlIter;
     SEM_VALUE_LISTENERS_NODE *pValueListeners;
     NvHandle hClient = RES_GET_CLIENT_HANDLE(pSemSurf);
     NvHandle hSemaphoreSurf = RES_GET_HANDLE(pSemSurf);
-    NvBool valid;
     NV_STATUS rmStatus = NV_ERR_GENERIC;
 
     NV_PRINTF(LEVEL_INFO, "SemMem(0x%08x, 0x%08x): Entering spinlock\n",
@@ -1626,14 +1623,11 @@ _semsurfDelWaiter
     if (!pIndexListeners)
         goto unlockReturn;
 
-    vlIter = listIterAll(&pIndexListeners->listeners);
-    while ((valid = listIterNext(&vlIter)) && vlIter.pValue->value < waitValue);
+    pValueListeners = mapFind(&pIndexListeners->listeners, waitValue);
 
-    if (!valid || (vlIter.pValue->value != waitValue))
+    if (!pValueListeners)
         goto unlockReturn;
 
-    pValueListeners = vlIter.pValue;
-
     rmStatus = unregisterEventNotificationWithData(&pValueListeners->pListeners,
                                                    hClient,
                                                    /* hNotifier/subdevice */
@@ -1655,10 +1649,10 @@ _semsurfDelWaiter
     if (!pValueListeners->pListeners &&
         (pValueListeners->newValue == 0))
     {
-        listRemove(&pIndexListeners->listeners, pValueListeners);
+        mapRemove(&pIndexListeners->listeners, pValueListeners);
         portMemFree(pValueListeners);
 
-        if (listCount(&pIndexListeners->listeners) == 0)
+        if (mapCount(&pIndexListeners->listeners) == 0)
         {
             mapRemove(&pSemSurf->pShared->listenerMap, pIndexListeners);
             portMemFree(pIndexListeners);
@@ -1666,7 +1660,7 @@ _semsurfDelWaiter
         }
         else
         {
-            pValueListeners = listHead(&pIndexListeners->listeners);
+            pValueListeners = mapFindGEQ(&pIndexListeners->listeners, 0);
             _semsurfSetMonitoredValue(pSemSurf->pShared, index,
                                       pValueListeners->value);
         }
@@ -39,6 +39,9 @@
 #include "vgpu/rpc.h"
 #include "rmapi/client.h"
 #include "platform/sli/sli.h"
+#include "mem_mgr/ctx_buf_pool.h"
+#include "kernel/gpu/fifo/kernel_fifo.h"
+#include "kernel/gpu/gr/kernel_graphics.h"
 
 NV_STATUS
 kmemsysGetFbInfos_VF(OBJGPU *pGpu, KernelMemorySystem *pKernelMemorySystem, RsClient *pClient, Device *pDevice, NvHandle hObject,
@@ -946,6 +949,100 @@ subdeviceCtrlCmdFbGetInfoV2_IMPL
     return _kmemsysGetFbInfos(pGpu, pClient, pDevice, hObject, pFbInfoParams);
 }
 
+static NV_STATUS
+_kmemsysFillCtxBufPoolStatsEntry
+(
+    CTX_BUF_POOL_INFO *pCtxBufPool,
+    RM_ENGINE_TYPE rmEngineType,
+    NV2080_CTRL_FB_CTX_BUF_POOL_STATS_ENTRY *pEntry
+)
+{
+    CTX_BUF_POOL_STATS stats;
+    NvU64 freeBytes;
+    NvU64 reservedBytes;
+    NvBool bRefillPending;
+
+    NV_ASSERT_OK_OR_RETURN(
+        ctxBufPoolGetStats(pCtxBufPool, &freeBytes, &reservedBytes, &stats, &bRefillPending));
+
+    pEntry->engineType = gpuGetNv2080EngineType(rmEngineType);
+    pEntry->bRefillPending = bRefillPending;
+    pEntry->freeBytes = freeBytes;
+    pEntry->reservedBytes = reservedBytes;
+    pEntry->allocCount = stats.allocCount;
+    pEntry->freeCount = stats.freeCount;
+    pEntry->refillCount = stats.refillCount;
+    return NV_OK;
+}
+
+//
+// subdeviceCtrlCmdFbGetCtxBufPoolStats
+//
+// Reports usage of the engine-global context buffer pools (GR global
+// buffer pools and runlist buffer pools).
+//
+// Lock Requirements:
+//      Assert that API and Gpus lock held on entry
+//
+NV_STATUS
+subdeviceCtrlCmdFbGetCtxBufPoolStats_IMPL
+(
+    Subdevice *pSubdevice,
+    NV2080_CTRL_FB_GET_CTX_BUF_POOL_STATS_PARAMS *pParams
+)
+{
+    OBJGPU *pGpu = GPU_RES_GET_GPU(pSubdevice);
+    KernelFifo *pKernelFifo = GPU_GET_KERNEL_FIFO(pGpu);
+    NvU32 numEntries = 0;
+    NvU32 i;
+
+    LOCK_ASSERT_AND_RETURN(rmapiLockIsOwner() && rmDeviceGpuLockIsOwner(pGpu->gpuInstance));
+
+    portMemSet(pParams->entries, 0, sizeof(pParams->entries));
+
+    for (i = 0; i < GPU_MAX_GRS; i++)
+    {
+        KernelGraphics *pKernelGraphics = GPU_GET_KERNEL_GRAPHICS(pGpu, i);
+        CTX_BUF_POOL_INFO *pCtxBufPool;
+
+        if (pKernelGraphics == NULL)
+            continue;
+
+        pCtxBufPool = kgraphicsGetCtxBufPool(pGpu, pKernelGraphics);
+        if (pCtxBufPool == NULL)
+            continue;
+
+        NV_ASSERT_OR_RETURN(numEntries < NV2080_CTRL_FB_CTX_BUF_POOL_STATS_MAX_ENTRIES,
+                            NV_ERR_INVALID_STATE);
+        NV_ASSERT_OK_OR_RETURN(
+            _kmemsysFillCtxBufPoolStatsEntry(pCtxBufPool, RM_ENGINE_TYPE_GR(i),
+                                             &pParams->entries[numEntries]));
+        numEntries++;
+    }
+
+    if (pKernelFifo != NULL)
+    {
+        for (i = RM_ENGINE_TYPE_NULL + 1; i < RM_ENGINE_TYPE_LAST; i++)
+        {
+            CTX_BUF_POOL_INFO *pCtxBufPool =
+                kfifoGetRunlistBufPool(pGpu, pKernelFifo, (RM_ENGINE_TYPE)i);
+
+            if (pCtxBufPool == NULL)
+                continue;
+
+            NV_ASSERT_OR_RETURN(numEntries < NV2080_CTRL_FB_CTX_BUF_POOL_STATS_MAX_ENTRIES,
+                                NV_ERR_INVALID_STATE);
+            NV_ASSERT_OK_OR_RETURN(
+                _kmemsysFillCtxBufPoolStatsEntry(pCtxBufPool, (RM_ENGINE_TYPE)i,
+                                                 &pParams->entries[numEntries]));
+            numEntries++;
+        }
+    }
+
+    pParams->numEntries = numEntries;
+    return NV_OK;
+}
+
 //
 // subdeviceCtrlCmdFbGetCarveoutAddressInfo
 //
@@ -991,6 +991,12 @@ kmigmgrStateUnload_IMPL
 {
     kmigmgrClearStaticInfo_HAL(pGpu, pKernelMIGManager);
 
+    //
+    // Engine configuration may change across an unload (e.g. GPU reset), so
+    // cached partition plans cannot be trusted afterwards.
+    //
+    kmigmgrInvalidatePartitionPlans(pGpu, pKernelMIGManager);
+
     // Nothing to do if MIG is not supported
     NV_CHECK_OR_RETURN(LEVEL_SILENT, kmigmgrIsMIGSupported(pGpu, pKernelMIGManager), NV_OK);
 
@@ -3894,21 +3900,33 @@ kmigmgrSwizzIdToResourceAllocation_IMPL
 
     if (params.type == KMIGMGR_CREATE_GPU_INSTANCE_PARAMS_TYPE_REQUEST)
     {
-        NV2080_CTRL_INTERNAL_KMIGMGR_IMPORT_EXPORT_GPU_INSTANCE_PARAMS export;
-        RM_API *pRmApi = GPU_GET_PHYSICAL_RMAPI(pGpu);
+        //
+        // Recurring layouts resolve to the same placements, so reuse the
+        // exported info recorded in the partition plan cache when possible
+        // instead of issuing another RPC.
+        //
+        if (!kmigmgrLookupPlannedGPUInstanceInfo(pGpu, pKernelMIGManager, swizzId,
+                                                 pKernelMIGGpuInstance->partitionFlag, &info))
+        {
+            NV2080_CTRL_INTERNAL_KMIGMGR_IMPORT_EXPORT_GPU_INSTANCE_PARAMS export;
+            RM_API *pRmApi = GPU_GET_PHYSICAL_RMAPI(pGpu);
 
-        portMemSet(&export, 0, sizeof(export));
-        export.swizzId = swizzId;
+            portMemSet(&export, 0, sizeof(export));
+            export.swizzId = swizzId;
 
-        // Retrieve the info of the gpu instance GSP just created
-        NV_CHECK_OK_OR_RETURN(LEVEL_ERROR,
-            pRmApi->Control(pRmApi,
-                            pGpu->hInternalClient,
-                            pGpu->hInternalSubdevice,
-                            NV2080_CTRL_CMD_INTERNAL_MIGMGR_EXPORT_GPU_INSTANCE,
-                            &export,
-                            sizeof(export)));
-        info = export.info;
+            // Retrieve the info of the gpu instance GSP just created
+            NV_CHECK_OK_OR_RETURN(LEVEL_ERROR,
+                pRmApi->Control(pRmApi,
+                                pGpu->hInternalClient,
+                                pGpu->hInternalSubdevice,
+                                NV2080_CTRL_CMD_INTERNAL_MIGMGR_EXPORT_GPU_INSTANCE,
+                                &export,
+                                sizeof(export)));
+            info = export.info;
+
+            kmigmgrRecordPlannedGPUInstanceInfo(pGpu, pKernelMIGManager, swizzId,
+                                                pKernelMIGGpuInstance->partitionFlag, &info);
+        }
     }
     else
     {
@@ -3939,6 +3957,259 @@ kmigmgrSwizzIdToResourceAllocation_IMPL
     return NV_OK;
 }
 
+/*!
+ * @brief   Build the canonical partition flag vector for a SET_PARTITIONS
+ *          request, covering only the entries which create an instance.
+ *
+ * @param[IN]   pParams     SET_PARTITIONS request to canonicalize
+ * @param[OUT]  pFlags      Canonicalized flags, sorted ascending
+ * @param[OUT]  pCount      Number of valid entries in pFlags
+ */
+static void
+_kmigmgrCanonicalizePartitionPlanFlags
+(
+    NV2080_CTRL_GPU_SET_PARTITIONS_PARAMS *pParams,
+    NvU32 *pFlags,
+    NvU32 *pCount
+)
+{
+    NvU32 count = 0;
+    NvU32 i;
+    NvU32 j;
+
+    for (i = 0; i < pParams->partitionCount; i++)
+    {
+        NvU32 partitionFlag;
+
+        if (!pParams->partitionInfo[i].bValid)
+            continue;
+
+        partitionFlag = FLD_SET_DRF(2080_CTRL_GPU, _PARTITION_FLAG, _PLACE_AT_SPAN, _DISABLE,
+                                    pParams->partitionInfo[i].partitionFlag);
+
+        // Insertion sort so that entry order does not affect the plan key
+        for (j = count; (j > 0) && (pFlags[j - 1] > partitionFlag); j--)
+        {
+            pFlags[j] = pFlags[j - 1];
+        }
+        pFlags[j] = partitionFlag;
+        count++;
+    }
+
+    *pCount = count;
+}
+
+/*!
+ * @brief   Look up or stage a partition plan for a SET_PARTITIONS request.
+ *
+ * On a hit, the matching plan becomes the active plan and the caller may skip
+ * the per-entry partition flag validation, as the exact same layout has been
+ * validated and applied before. On a miss, a plan slot is staged for the
+ * request and becomes valid once the caller reports successful application
+ * via kmigmgrEndPartitionPlan.
+ *
+ * @param[IN]   pGpu
+ * @param[IN]   pKernelMIGManager
+ * @param[IN]   pParams             SET_PARTITIONS request
+ *
+ * @return  NV_TRUE if the request matches a previously applied plan
+ */
+NvBool
+kmigmgrBeginPartitionPlan_IMPL
+(
+    OBJGPU *pGpu,
+    KernelMIGManager *pKernelMIGManager,
+    NV2080_CTRL_GPU_SET_PARTITIONS_PARAMS *pParams
+)
+{
+    NvU32 flags[KMIGMGR_MAX_GPU_INSTANCES];
+    NvU32 count;
+    KMIGMGR_PARTITION_PLAN *pPlan;
+    NvU32 i;
+
+    pKernelMIGManager->pActivePartitionPlan = NULL;
+
+    _kmigmgrCanonicalizePartitionPlanFlags(pParams, flags, &count);
+
+    // Nothing to plan for requests which only invalidate instances
+    if (count == 0)
+        return NV_FALSE;
+
+    for (i = 0; i < KMIGMGR_MAX_CACHED_PARTITION_PLANS; i++)
+    {
+        pPlan = &pKernelMIGManager->partitionPlans[i];
+
+        if (pPlan->bValid &&
+            (pPlan->partitionCount == count) &&
+            (portMemCmp(pPlan->partitionFlags, flags, count * sizeof(flags[0])) == 0))
+        {
+            pKernelMIGManager->pActivePartitionPlan = pPlan;
+            return NV_TRUE;
+        }
+    }
+
+    // Stage a new plan, evicting the oldest entry round-robin
+    pPlan = &pKernelMIGManager->partitionPlans[pKernelMIGManager->partitionPlanEvictIdx];
+    pKernelMIGManager->partitionPlanEvictIdx =
+        (pKernelMIGManager->partitionPlanEvictIdx + 1) % KMIGMGR_MAX_CACHED_PARTITION_PLANS;
+
+    portMemSet(pPlan, 0, sizeof(*pPlan));
+    pPlan->partitionCount = count;
+    portMemCopy(pPlan->partitionFlags, sizeof(pPlan->partitionFlags),
+                flags, count * sizeof(flags[0]));
+
+    pKernelMIGManager->pActivePartitionPlan = pPlan;
+    return NV_FALSE;
+}
+
+/*!
+ * @brief   Finish the active partition plan started by kmigmgrBeginPartitionPlan.
+ *
+ * @param[IN]   pGpu
+ * @param[IN]   pKernelMIGManager
+ * @param[IN]   bApplied            NV_TRUE if the request was applied successfully
+ */
+void
+kmigmgrEndPartitionPlan_IMPL
+(
+    OBJGPU *pGpu,
+    KernelMIGManager *pKernelMIGManager,
+    NvBool bApplied
+)
+{
+    KMIGMGR_PARTITION_PLAN *pPlan = pKernelMIGManager->pActivePartitionPlan;
+
+    if (pPlan == NULL)
+        return;
+
+    if (bApplied)
+    {
+        pPlan->bValid = NV_TRUE;
+    }
+    else if (!pPlan->bValid)
+    {
+        // Drop a staged plan whose request never completed
+        portMemSet(pPlan, 0, sizeof(*pPlan));
+    }
+
+    pKernelMIGManager->pActivePartitionPlan = NULL;
+}
+
+/*!
+ * @brief   Look up the exported GPU instance info recorded for a placement.
+ *
+ * The info exported by GSP for a given (swizzId, partitionFlag) pair only
+ * depends on static chip configuration, so a recurring layout can reuse the
+ * copy recorded when the placement was first created instead of issuing
+ * another NV2080_CTRL_CMD_INTERNAL_MIGMGR_EXPORT_GPU_INSTANCE call.
+ *
+ * @param[IN]   pGpu
+ * @param[IN]   pKernelMIGManager
+ * @param[IN]   swizzId             SwizzId the instance resolved to
+ * @param[IN]   partitionFlag       Requested partition flags of the instance
+ * @param[OUT]  pInfo               Recorded exported instance info
+ *
+ * @return  NV_TRUE if a recorded placement matched
+ */
+NvBool
+kmigmgrLookupPlannedGPUInstanceInfo_IMPL
+(
+    OBJGPU *pGpu,
+    KernelMIGManager *pKernelMIGManager,
+    NvU32 swizzId,
+    NvU32 partitionFlag,
+    NV2080_CTRL_INTERNAL_KMIGMGR_EXPORTED_GPU_INSTANCE_INFO *pInfo
+)
+{
+    NvU32 i;
+    NvU32 j;
+
+    for (i = 0; i < KMIGMGR_MAX_CACHED_PARTITION_PLANS; i++)
+    {
+        KMIGMGR_PARTITION_PLAN *pPlan = &pKernelMIGManager->partitionPlans[i];
+
+        if (!pPlan->bValid && (pPlan != pKernelMIGManager->pActivePartitionPlan))
+            continue;
+
+        for (j = 0; j < KMIGMGR_MAX_GPU_INSTANCES; j++)
+        {
+            if (pPlan->placements[j].bValid &&
+                (pPlan->placements[j].swizzId == swizzId) &&
+                (pPlan->placements[j].partitionFlag == partitionFlag))
+            {
+                *pInfo = pPlan->placements[j].giInfo;
+                return NV_TRUE;
+            }
+        }
+    }
+
+    return NV_FALSE;
+}
+
+/*!
+ * @brief   Record the exported GPU instance info a placement resolved to.
+ *
+ * @param[IN]   pGpu
+ * @param[IN]   pKernelMIGManager
+ * @param[IN]   swizzId             SwizzId the instance resolved to
+ * @param[IN]   partitionFlag       Requested partition flags of the instance
+ * @param[IN]   pInfo               Exported instance info returned by GSP
+ */
+void
+kmigmgrRecordPlannedGPUInstanceInfo_IMPL
+(
+    OBJGPU *pGpu,
+    KernelMIGManager *pKernelMIGManager,
+    NvU32 swizzId,
+    NvU32 partitionFlag,
+    const NV2080_CTRL_INTERNAL_KMIGMGR_EXPORTED_GPU_INSTANCE_INFO *pInfo
+)
+{
+    KMIGMGR_PARTITION_PLAN *pPlan = pKernelMIGManager->pActivePartitionPlan;
+    NvU32 i;
+
+    if (pPlan == NULL)
+        return;
+
+    for (i = 0; i < KMIGMGR_MAX_GPU_INSTANCES; i++)
+    {
+        if (pPlan->placements[i].bValid &&
+            (pPlan->placements[i].swizzId == swizzId) &&
+            (pPlan->placements[i].partitionFlag == partitionFlag))
+        {
+            break;
+        }
+
+        if (!pPlan->placements[i].bValid)
+            break;
+    }
+
+    // A plan never resolves to more placements than it has entries
+    if (i == KMIGMGR_MAX_GPU_INSTANCES)
+        return;
+
+    pPlan->placements[i].bValid = NV_TRUE;
+    pPlan->placements[i].swizzId = swizzId;
+    pPlan->placements[i].partitionFlag = partitionFlag;
+    pPlan->placements[i].giInfo = *pInfo;
+}
+
+/*!
+ * @brief   Drop all cached partition plans.
+ */
+void
+kmigmgrInvalidatePartitionPlans_IMPL
+(
+    OBJGPU *pGpu,
+    KernelMIGManager *pKernelMIGManager
+)
+{
+    portMemSet(pKernelMIGManager->partitionPlans, 0,
+               sizeof(pKernelMIGManager->partitionPlans));
+    pKernelMIGManager->partitionPlanEvictIdx = 0;
+    pKernelMIGManager->pActivePartitionPlan = NULL;
+}
+
 // Create client and subdevice handles to make calls into this compute instance
 NV_STATUS
 kmigmgrAllocComputeInstanceHandles_IMPL
@@ -6055,6 +6326,9 @@ kmigmgrSetMIGState_FWCLIENT
 
         kgraphicsFreeGlobalCtxBuffers(pGpu, pKGr, GPU_GFID_PF);
 
+        // Recycled context buffers must not hold partitionable memory either
+        kgrmgrFreeMainCtxBufferCache(pGpu, pKernelGraphicsManager);
+
         //
         // Save the pre-MIG top-level scrubber status for later
         // Destroy the top level scrubber if it exists
@@ -6608,6 +6882,9 @@ kmigmgrInitGPUInstanceRunlistBufPools_IMPL
         NV_ASSERT_OK_OR_RETURN(ctxBufPoolInit(pGpu, pHeap, &pKernelFifo->pRunlistBufPool[rmEngineType]));
         NV_ASSERT_OR_RETURN(pKernelFifo->pRunlistBufPool[rmEngineType] != NULL, NV_ERR_INVALID_STATE);
 
+        // Runlist buffer pools live until the GPU instance is torn down.
+        ctxBufPoolSetAutoRefill(pKernelFifo->pRunlistBufPool[rmEngineType], NV_TRUE);
+
         //
         // Skip scrubber for runlist buffer alloctions since gpu instance scrubber is not setup yet
         // and it will be destroyed before deleting the runlist buffer pool.
@@ -7277,21 +7554,31 @@ subdeviceCtrlCmdGpuSetPartitions_IMPL
         return NV_WARN_NOTHING_TO_DO;
     }
 
-    for (i = 0; i < pParams->partitionCount; i++)
+    //
+    // A request matching a cached partition plan repeats a layout which has
+    // already been validated and applied, so the per-entry flag validation
+    // below can be skipped.
+    //
+    if (!kmigmgrBeginPartitionPlan(pGpu, pKernelMIGManager, pParams))
     {
-        if (pParams->partitionInfo[i].bValid)
+        for (i = 0; i < pParams->partitionCount; i++)
         {
-            NvU32 partitionFlag = FLD_SET_DRF(2080_CTRL_GPU, _PARTITION_FLAG, _PLACE_AT_SPAN, _DISABLE,
-                                              pParams->partitionInfo[i].partitionFlag);
-            NV_CHECK_OR_RETURN(LEVEL_ERROR,
-                kmigmgrIsGPUInstanceCombinationValid_HAL(pGpu, pKernelMIGManager, partitionFlag),
-                NV_ERR_NOT_SUPPORTED);
+            if (pParams->partitionInfo[i].bValid)
+            {
+                NvU32 partitionFlag = FLD_SET_DRF(2080_CTRL_GPU, _PARTITION_FLAG, _PLACE_AT_SPAN, _DISABLE,
+                                                  pParams->partitionInfo[i].partitionFlag);
+                NV_CHECK_OR_ELSE(LEVEL_ERROR,
+                    kmigmgrIsGPUInstanceCombinationValid_HAL(pGpu, pKernelMIGManager, partitionFlag),
+                    kmigmgrEndPartitionPlan(pGpu, pKernelMIGManager, NV_FALSE);
+                    return NV_ERR_NOT_SUPPORTED; );
+            }
         }
     }
 
     // This is not supported in vGPU
     if (IS_VIRTUAL(pGpu))
     {
+        kmigmgrEndPartitionPlan(pGpu, pKernelMIGManager, NV_FALSE);
         return NV_ERR_NOT_SUPPORTED;
     }
 
@@ -7302,6 +7589,8 @@ subdeviceCtrlCmdGpuSetPartitions_IMPL
             cleanup);
     }
 
+    kmigmgrEndPartitionPlan(pGpu, pKernelMIGManager, NV_TRUE);
+
     //
     // Generate a subdevice event stating something has changed in GPU instance
     // config. Clients currently do not care about changes and their scope
@@ -7311,6 +7600,8 @@ subdeviceCtrlCmdGpuSetPartitions_IMPL
     return rmStatus;
 
 cleanup:
+    kmigmgrEndPartitionPlan(pGpu, pKernelMIGManager, NV_FALSE);
+
     // Invalidate gpu instances which has been created
     for (j = 0; j < i; j++)
     {
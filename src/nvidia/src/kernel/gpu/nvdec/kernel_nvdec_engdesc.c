@@ -93,6 +93,18 @@ nvdecGetEngineDescFromAllocParams
             return ENG_INVALID;
     }
 
+    if (engineInstance == NV_ALLOC_ENGINE_INSTANCE_ANY)
+    {
+        //
+        // Least-loaded placement tracks global engine instances, which does
+        // not apply under MIG where clients address instance-local engines.
+        //
+        if (IS_MIG_IN_USE(pGpu))
+            engineInstance = 0;
+        else
+            engineInstance = gpuGetLeastLoadedVideoEngineInstance(pGpu, classId(OBJBSP));
+    }
+
     if (IS_MIG_IN_USE(pGpu))
     {
         KernelMIGManager *pKernelMIGManager = GPU_GET_KERNEL_MIG_MANAGER(pGpu);
@@ -42,13 +42,18 @@ msencctxConstructHal_KERNEL
     OBJGPU            *pGpu = GPU_RES_GET_GPU(pChannelDescendant);
     KernelFalcon      *pKernelFalcon = kflcnGetKernelFalconForEngine(pGpu, pChannelDescendant->resourceDesc.engDesc);
     KernelChannel     *pKernelChannel = pChannelDescendant->pKernelChannel;
+    NV_STATUS          status;
 
     if (pKernelFalcon == NULL)
         return NV_ERR_INVALID_STATE;
 
     NV_PRINTF(LEVEL_INFO, "msencctxConstruct for 0x%x\n", pChannelDescendant->resourceDesc.engDesc);
 
-    return kflcnAllocContext(pGpu, pKernelFalcon, pKernelChannel, RES_GET_EXT_CLASS_ID(pChannelDescendant));
+    status = kflcnAllocContext(pGpu, pKernelFalcon, pKernelChannel, RES_GET_EXT_CLASS_ID(pChannelDescendant));
+    if (status == NV_OK)
+        gpuVideoEngineCtxAcquired(pGpu, pChannelDescendant->resourceDesc.engDesc);
+
+    return status;
 }
 
 void msencctxDestructHal_KERNEL
@@ -64,6 +69,8 @@ void msencctxDestructHal_KERNEL
     NV_PRINTF(LEVEL_INFO, "msencctxDestruct for 0x%x\n", pChannelDescendant->resourceDesc.engDesc);
 
     NV_ASSERT_OK(kflcnFreeContext(pGpu, pKernelFalcon, pKernelChannel, RES_GET_EXT_CLASS_ID(pChannelDescendant)));
+
+    gpuVideoEngineCtxReleased(pGpu, pChannelDescendant->resourceDesc.engDesc);
 }
 
 NV_STATUS deviceCtrlCmdMsencGetCapsV2_VF
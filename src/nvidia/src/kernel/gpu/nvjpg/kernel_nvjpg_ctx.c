@@ -43,13 +43,18 @@ nvjpgctxConstructHal_KERNEL
     OBJGPU            *pGpu = GPU_RES_GET_GPU(pChannelDescendant);
     KernelFalcon      *pKernelFalcon = kflcnGetKernelFalconForEngine(pGpu, pChannelDescendant->resourceDesc.engDesc);
     KernelChannel     *pKernelChannel = pChannelDescendant->pKernelChannel;
+    NV_STATUS          status;
 
     if (pKernelFalcon == NULL)
         return NV_ERR_INVALID_STATE;
 
     NV_PRINTF(LEVEL_INFO, "nvjpgctxConstruct for 0x%x\n", pChannelDescendant->resourceDesc.engDesc);
 
-    return kflcnAllocContext(pGpu, pKernelFalcon, pKernelChannel, RES_GET_EXT_CLASS_ID(pChannelDescendant));
+    status = kflcnAllocContext(pGpu, pKernelFalcon, pKernelChannel, RES_GET_EXT_CLASS_ID(pChannelDescendant));
+    if (status == NV_OK)
+        gpuVideoEngineCtxAcquired(pGpu, pChannelDescendant->resourceDesc.engDesc);
+
+    return status;
 }
 
 void nvjpgctxDestructHal_KERNEL
@@ -65,6 +70,8 @@ void nvjpgctxDestructHal_KERNEL
     NV_PRINTF(LEVEL_INFO, "nvjpgctxDestruct for 0x%x\n", pChannelDescendant->resourceDesc.engDesc);
 
     NV_ASSERT_OK(kflcnFreeContext(pGpu, pKernelFalcon, pKernelChannel, RES_GET_EXT_CLASS_ID(pChannelDescendant)));
+
+    gpuVideoEngineCtxReleased(pGpu, pChannelDescendant->resourceDesc.engDesc);
 }
 
 NV_STATUS deviceCtrlCmdNvjpgGetCapsV2_VF
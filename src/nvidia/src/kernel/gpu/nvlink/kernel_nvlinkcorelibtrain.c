@@ -287,8 +287,14 @@ knvlinkTrainSysmemLinksToActive_IMPL
 {
 #if defined(INCLUDE_NVLINK_LIB)
 
-    OBJSYS *pSys = SYS_GET_INSTANCE();
-    NvU32   i;
+    OBJSYS   *pSys     = SYS_GET_INSTANCE();
+    NV_STATUS status   = NV_OK;
+    NvU32     version  = pKernelNvlink->ipVerNvlink;
+    NvU32     linkMask = 0;
+    NvU32     count    = 0;
+    NvU32     i;
+
+    nvlink_link *pLinks[NVLINK_MAX_LINKS_SW] = { 0 };
 
     // On Fmodel, sysmem link training is not supported
     if (IS_FMODEL(pGpu))
@@ -329,23 +335,84 @@ knvlinkTrainSysmemLinksToActive_IMPL
              (pKernelNvlink->nvlinkLinks[i].remoteEndInfo.deviceType == NVLINK_DEVICE_TYPE_TEGRASHIM) ||
              (pKernelNvlink->nvlinkLinks[i].remoteEndInfo.deviceType == NVLINK_DEVICE_TYPE_EBRIDGE)))
         {
-            if (nvlink_lib_train_links_from_swcfg_to_active(
-                    &pKernelNvlink->nvlinkLinks[i].core_link, 1, NVLINK_STATE_CHANGE_SYNC)
-                    != NVL_SUCCESS)
+            if (version >= NVLINK_VERSION_22)
             {
-                nvErrorLog_va((void *)pGpu, NVLINK_ERROR,
-                    "NVLink: failed to train link %d to remote PCI:%04x:%02x:%02x",
-                    i,
-                    pKernelNvlink->nvlinkLinks[i].remoteEndInfo.domain,
-                    pKernelNvlink->nvlinkLinks[i].remoteEndInfo.bus,
-                    pKernelNvlink->nvlinkLinks[i].remoteEndInfo.device);
-
-                return NV_ERR_NOT_SUPPORTED;
+                // Capture links for parallel link training
+                pLinks[count] = pKernelNvlink->nvlinkLinks[i].core_link;
+                linkMask     |= BIT(i);
+                count++;
+            }
+            else
+            {
+                // Invoke link training serially for NVLINK <= 2.0
+                if (nvlink_lib_train_links_from_swcfg_to_active(
+                        &pKernelNvlink->nvlinkLinks[i].core_link, 1, NVLINK_STATE_CHANGE_SYNC)
+                        != NVL_SUCCESS)
+                {
+                    nvErrorLog_va((void *)pGpu, NVLINK_ERROR,
+                        "NVLink: failed to train link %d to remote PCI:%04x:%02x:%02x",
+                        i,
+                        pKernelNvlink->nvlinkLinks[i].remoteEndInfo.domain,
+                        pKernelNvlink->nvlinkLinks[i].remoteEndInfo.bus,
+                        pKernelNvlink->nvlinkLinks[i].remoteEndInfo.device);
+
+                    return NV_ERR_NOT_SUPPORTED;
+                }
             }
         }
     }
     FOR_EACH_INDEX_IN_MASK_END;
 
+    // Invoke link training for NVLINK >= 2.2
+    if (count > 0)
+    {
+        //
+        // Train all the sysmem links in a single call, so that the core
+        // library issues the training requests on every link up front and
+        // polls for completion collectively, instead of serializing the
+        // full training sequence on each link.
+        //
+        (void)nvlink_lib_train_links_from_swcfg_to_active(
+            pLinks, count, NVLINK_STATE_CHANGE_ASYNC);
+
+        // Get the link train status for the trained link masks
+        NV2080_CTRL_NVLINK_ARE_LINKS_TRAINED_PARAMS linkTrainedParams;
+
+        portMemSet(&linkTrainedParams, 0, sizeof(linkTrainedParams));
+        linkTrainedParams.linkMask    = linkMask;
+        linkTrainedParams.bActiveOnly = NV_TRUE;
+
+        status = knvlinkExecGspRmRpc(pGpu, pKernelNvlink,
+                                     NV2080_CTRL_CMD_NVLINK_ARE_LINKS_TRAINED,
+                                     (void *)&linkTrainedParams,
+                                     sizeof(linkTrainedParams));
+        if (status != NV_OK)
+        {
+            NV_PRINTF(LEVEL_ERROR,
+                      "Failed to get the link train status for links\n");
+            return status;
+        }
+
+        // Check if the links are trained to "active" state.
+        FOR_EACH_INDEX_IN_MASK(32, i, linkMask)
+        {
+            if (linkTrainedParams.bIsLinkActive[i])
+            {
+                continue;
+            }
+
+            nvErrorLog_va((void *)pGpu, NVLINK_ERROR,
+                "NVLink: failed to train link %d to remote PCI:%04x:%02x:%02x",
+                i,
+                pKernelNvlink->nvlinkLinks[i].remoteEndInfo.domain,
+                pKernelNvlink->nvlinkLinks[i].remoteEndInfo.bus,
+                pKernelNvlink->nvlinkLinks[i].remoteEndInfo.device);
+
+            return NV_ERR_NOT_SUPPORTED;
+        }
+        FOR_EACH_INDEX_IN_MASK_END;
+    }
+
     //
     // After training links, we may have used up most of the available 4s
     // timeout during GPU state load. As a WAR in lieu of improving the
@@ -832,8 +899,14 @@ knvlinkTrainFabricLinksToActive_IMPL
 {
 #if defined(INCLUDE_NVLINK_LIB)
 
-    OBJSYS *pSys = SYS_GET_INSTANCE();
-    NvU32   i;
+    OBJSYS   *pSys     = SYS_GET_INSTANCE();
+    NV_STATUS status   = NV_OK;
+    NvU32     version  = pKernelNvlink->ipVerNvlink;
+    NvU32     linkMask = 0;
+    NvU32     count    = 0;
+    NvU32     i;
+
+    nvlink_link *pLinks[NVLINK_MAX_LINKS_SW] = { 0 };
 
     // Minion and SW training is by default disabled on RTL
     if (IS_RTLSIM(pGpu) && !pKernelNvlink->bForceEnableCoreLibRtlsims)
@@ -874,23 +947,90 @@ knvlinkTrainFabricLinksToActive_IMPL
             (pKernelNvlink->nvlinkLinks[i].remoteEndInfo.deviceType ==
                 NVLINK_DEVICE_TYPE_NVSWITCH))
         {
-            if (nvlink_lib_train_links_from_swcfg_to_active(
-                &pKernelNvlink->nvlinkLinks[i].core_link, 1, NVLINK_STATE_CHANGE_SYNC)
-                != NVL_SUCCESS)
+            if (version >= NVLINK_VERSION_22)
             {
-                nvErrorLog_va((void *)pGpu, NVLINK_ERROR,
-                    "NVLink: failed to train link %d to remote PCI:%04x:%02x:%02x",
-                    i,
-                    pKernelNvlink->nvlinkLinks[i].remoteEndInfo.domain,
-                    pKernelNvlink->nvlinkLinks[i].remoteEndInfo.bus,
-                    pKernelNvlink->nvlinkLinks[i].remoteEndInfo.device);
-
-                return NV_ERR_INVALID_STATE;
+                // Capture links for parallel link training
+                pLinks[count] = pKernelNvlink->nvlinkLinks[i].core_link;
+                linkMask     |= BIT(i);
+                count++;
+            }
+            else
+            {
+                // Invoke link training serially for NVLINK <= 2.0
+                if (nvlink_lib_train_links_from_swcfg_to_active(
+                    &pKernelNvlink->nvlinkLinks[i].core_link, 1, NVLINK_STATE_CHANGE_SYNC)
+                    != NVL_SUCCESS)
+                {
+                    nvErrorLog_va((void *)pGpu, NVLINK_ERROR,
+                        "NVLink: failed to train link %d to remote PCI:%04x:%02x:%02x",
+                        i,
+                        pKernelNvlink->nvlinkLinks[i].remoteEndInfo.domain,
+                        pKernelNvlink->nvlinkLinks[i].remoteEndInfo.bus,
+                        pKernelNvlink->nvlinkLinks[i].remoteEndInfo.device);
+
+                    return NV_ERR_INVALID_STATE;
+                }
             }
         }
     }
     FOR_EACH_INDEX_IN_MASK_END;
 
+    // Invoke link training for NVLINK >= 2.2
+    if (count > 0)
+    {
+        //
+        // Train all the switch links in a single call, so that the core
+        // library issues the training requests on every link up front and
+        // polls for completion collectively, instead of serializing the
+        // full training sequence on each link.
+        //
+        (void)nvlink_lib_train_links_from_swcfg_to_active(
+            pLinks, count, NVLINK_STATE_CHANGE_ASYNC);
+
+        // Get the link train status for the trained link masks
+        NV2080_CTRL_NVLINK_ARE_LINKS_TRAINED_PARAMS linkTrainedParams;
+
+        portMemSet(&linkTrainedParams, 0, sizeof(linkTrainedParams));
+        linkTrainedParams.linkMask    = linkMask;
+        linkTrainedParams.bActiveOnly = NV_TRUE;
+
+        // Reset timeout to clear any accumulated timeouts from link training
+        if (IS_GSP_CLIENT(pGpu))
+        {
+            threadStateResetTimeout(pGpu);
+        }
+
+        status = knvlinkExecGspRmRpc(pGpu, pKernelNvlink,
+                                     NV2080_CTRL_CMD_NVLINK_ARE_LINKS_TRAINED,
+                                     (void *)&linkTrainedParams,
+                                     sizeof(linkTrainedParams));
+        if (status != NV_OK)
+        {
+            NV_PRINTF(LEVEL_ERROR,
+                      "Failed to get the link train status for links\n");
+            return status;
+        }
+
+        // Check if the links are trained to "active" state.
+        FOR_EACH_INDEX_IN_MASK(32, i, linkMask)
+        {
+            if (linkTrainedParams.bIsLinkActive[i])
+            {
+                continue;
+            }
+
+            nvErrorLog_va((void *)pGpu, NVLINK_ERROR,
+                "NVLink: failed to train link %d to remote PCI:%04x:%02x:%02x",
+                i,
+                pKernelNvlink->nvlinkLinks[i].remoteEndInfo.domain,
+                pKernelNvlink->nvlinkLinks[i].remoteEndInfo.bus,
+                pKernelNvlink->nvlinkLinks[i].remoteEndInfo.device);
+
+            return NV_ERR_INVALID_STATE;
+        }
+        FOR_EACH_INDEX_IN_MASK_END;
+    }
+
 #endif
 
     return NV_OK;
@@ -45,6 +45,7 @@
 #include "kernel/gpu/mc/kernel_mc.h"
 #include "kernel/gpu/nvlink/kernel_nvlink.h"
 #include "gpu/gpu_fabric_probe.h"
+#include "gpu/gsp/kernel_gsp.h"
 #include "objtmr.h"
 #include "platform/chipset/chipset.h"
 #include "kernel/gpu/gr/kernel_graphics.h"
@@ -3160,6 +3161,72 @@ subdeviceCtrlCmdGspGetFeatures_KERNEL
     return NV_OK;
 }
 
+/*!
+ * @brief   Report the RPC latency profile accumulated by CPU-RM: latency
+ *          histogram, per-RPC-type accumulators, and the most recent trace
+ *          ring entries (newest first).
+ *
+ * @param[in]     pSubdevice
+ * @param[in,out] pParams
+ *
+ * @return  Returns NV_STATUS
+ *          NV_OK                     Success
+ *          NV_ERR_NOT_SUPPORTED      GPU is not GSP offloaded
+ */
+NV_STATUS
+subdeviceCtrlCmdGspGetRpcProfile_IMPL
+(
+    Subdevice *pSubdevice,
+    NV2080_CTRL_GSP_GET_RPC_PROFILE_PARAMS *pParams
+)
+{
+    OBJGPU *pGpu = GPU_RES_GET_GPU(pSubdevice);
+    KernelGsp *pKernelGsp = GPU_GET_KERNEL_GSP(pGpu);
+    const KernelGspRpcProfile *pProf;
+    NvU32 numFuncs;
+    NvU32 numRing;
+    NvU32 next;
+    NvU32 i;
+
+    if (!IS_GSP_CLIENT(pGpu) || (pKernelGsp == NULL))
+        return NV_ERR_NOT_SUPPORTED;
+
+    pProf = &pKernelGsp->rpcProfile;
+
+    portMemSet(pParams, 0, sizeof(*pParams));
+
+    ct_assert(NV2080_CTRL_GSP_RPC_PROFILE_HIST_BUCKETS == KGSP_RPC_PROF_HIST_BUCKETS);
+    for (i = 0; i < NV2080_CTRL_GSP_RPC_PROFILE_HIST_BUCKETS; i++)
+    {
+        pParams->histogram[i] = pProf->histogram[i];
+    }
+
+    numFuncs = NV_MIN(pProf->numFuncs, NV2080_CTRL_GSP_RPC_PROFILE_MAX_FUNCTIONS);
+    for (i = 0; i < numFuncs; i++)
+    {
+        pParams->functions[i].function = pProf->funcs[i].function;
+        pParams->functions[i].maxUs    = pProf->funcs[i].maxUs;
+        pParams->functions[i].count    = pProf->funcs[i].count;
+        pParams->functions[i].totalUs  = pProf->funcs[i].totalUs;
+    }
+    pParams->numFunctions = numFuncs;
+
+    next = pProf->ringNext;
+    numRing = NV_MIN(next, NV2080_CTRL_GSP_RPC_PROFILE_RING_ENTRIES);
+    for (i = 0; i < numRing; i++)
+    {
+        const KernelGspRpcProfEntry *pEntry =
+            &pProf->ring[(next - 1 - i) % KGSP_RPC_PROF_RING_DEPTH];
+
+        pParams->ring[i].function   = pEntry->function;
+        pParams->ring[i].durationUs = pEntry->durationUs;
+        pParams->ring[i].tsStart    = pEntry->ts_start;
+    }
+    pParams->numRingEntries = numRing;
+
+    return NV_OK;
+}
+
 //
 // Lock Requirements:
 //      Assert that API lock and GPUs lock held on entry
@@ -65,9 +65,9 @@
 
 static NV_STATUS _class9074TimerCallback
 (
-    OBJGPU  *pGpu,
-    OBJTMR  *pTmr,
-    void    *pContext
+    OBJGPU    *pGpu,
+    OBJTMR    *pTmr,
+    TMR_EVENT *pTmrEvent
 );
 
 //---------------------------------------------------------------------------
@@ -209,12 +209,11 @@ _9074TimedSemRequest
     pTimedSemEntry->ReleaseValue   = releaseValue;
     pTimedSemEntry->NotifyAction   = notifyAction;
 
-    // Schedule the callback when entry was added to an empty list.
+    // Arm the per-object timer event when entry was added to an empty list.
     if (listCount(&pTimedSemSw->entryList) == 1)
     {
-        tmrScheduleCallbackAbs(pTmr, _class9074TimerCallback, pObject,
-            pTimedSemEntry->WaitTimestamp, TMR_FLAG_RELEASE_SEMAPHORE,
-            staticCast(pTimedSemSw, ChannelDescendant)->pKernelChannel->ChID);
+        tmrEventScheduleAbs(pTmr, pTimedSemSw->pTmrEvent,
+                            pTimedSemEntry->WaitTimestamp);
     }
 
     return status;
@@ -234,8 +233,22 @@ tsemaConstruct_IMPL
     RS_RES_ALLOC_PARAMS_INTERNAL *pParams
 )
 {
+    ChannelDescendant *pChannelDescendant = staticCast(pTimedSemSw, ChannelDescendant);
+    OBJGPU            *pGpu = GPU_RES_GET_GPU(pChannelDescendant);
+    OBJTMR            *pTmr = GPU_GET_TIMER(pGpu);
+
     listInit(&pTimedSemSw->entryList, portMemAllocatorGetGlobalNonPaged());
 
+    //
+    // One timer event per object, armed to the deadline at the head of the
+    // queue. The nano-timer event infrastructure gives better release
+    // resolution than the legacy fixed-pool callback API.
+    //
+    NV_ASSERT_OK_OR_RETURN(
+        tmrEventCreate(pTmr, &pTimedSemSw->pTmrEvent, _class9074TimerCallback,
+                       pTimedSemSw, TMR_FLAG_RELEASE_SEMAPHORE));
+    pTimedSemSw->pTmrEvent->chId = pChannelDescendant->pKernelChannel->ChID;
+
     return NV_OK;
 }
 
@@ -248,7 +261,9 @@ tsemaDestruct_IMPL
     ChannelDescendant      *pChannelDescendant = staticCast(pTimedSemSw, ChannelDescendant);
     OBJTMR                 *pTmr = GPU_GET_TIMER(GPU_RES_GET_GPU(pChannelDescendant));
 
-    tmrCancelCallback(pTmr, pChannelDescendant);
+    // Destroying the timer event also cancels any pending callback.
+    tmrEventDestroy(pTmr, pTimedSemSw->pTmrEvent);
+    pTimedSemSw->pTmrEvent = NULL;
 
     chandesIsolateOnDestruct(pChannelDescendant);
 
@@ -270,7 +285,6 @@ tsemaCtrlCmdFlush_IMPL
 )
 {
     OBJGPU *pGpu = GPU_RES_GET_GPU(pTimedSemaSwObject);
-    ChannelDescendant *pObject = staticCast(pTimedSemaSwObject, ChannelDescendant);
 
     if (pFlushParams->isFlushing) {
         pTimedSemaSwObject->Flags |= F_FLUSHING;
@@ -286,8 +300,8 @@ tsemaCtrlCmdFlush_IMPL
         tmrGetCurrentTime(pTmr, &pTimedSemaSwObject->FlushLimitTimestamp);
         pTimedSemaSwObject->FlushLimitTimestamp += pFlushParams->maxFlushTime;
 
-        tmrCancelCallback(pTmr, pObject);
-        _class9074TimerCallback(pGpu, pTmr, pObject);
+        tmrEventCancel(pTmr, pTimedSemaSwObject->pTmrEvent);
+        _class9074TimerCallback(pGpu, pTmr, pTimedSemaSwObject->pTmrEvent);
     }
 
     return NV_OK;
@@ -536,13 +550,13 @@ static NV_STATUS _class9074ScheduleSemaphoreRelease
 
 static NV_STATUS _class9074TimerCallback
 (
-    OBJGPU  *pGpu,
-    OBJTMR  *pTmr,
-    void    *pContext
+    OBJGPU    *pGpu,
+    OBJTMR    *pTmr,
+    TMR_EVENT *pTmrEvent
 )
 {
-    ChannelDescendant *pObject = pContext;
-    PGF100_TIMED_SEM_SW_OBJECT pTimedSemSw = dynamicCast(pObject, TimedSemaSwObject);
+    PGF100_TIMED_SEM_SW_OBJECT pTimedSemSw = pTmrEvent->pUserData;
+    ChannelDescendant *pObject = staticCast(pTimedSemSw, ChannelDescendant);
     PGF100_TIMED_SEM_ENTRY     pTimedSemEntry = NULL;
     PGF100_TIMED_SEM_ENTRY     pTimedSemEntryNext = NULL;
     NvU64                      currentTime;
@@ -579,12 +593,11 @@ static NV_STATUS _class9074TimerCallback
         listRemove(&pTimedSemSw->entryList, pTimedSemEntry);
     }
 
-    // Schedule the callback for entry at the head of the queue.
+    // Re-arm the timer event for the entry at the head of the queue.
     if (pTimedSemEntry != NULL)
     {
-        tmrScheduleCallbackAbs(pTmr, _class9074TimerCallback, pObject,
-            pTimedSemEntry->WaitTimestamp, TMR_FLAG_RELEASE_SEMAPHORE,
-            staticCast(pTimedSemSw, ChannelDescendant)->pKernelChannel->ChID);
+        tmrEventScheduleAbs(pTmr, pTimedSemSw->pTmrEvent,
+                            pTimedSemEntry->WaitTimestamp);
     }
 
     return status;
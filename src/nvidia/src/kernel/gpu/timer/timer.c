@@ -41,6 +41,7 @@ static void             _tmrScanCallbackOSTimer(OBJTMR *, PTMR_EVENT_PVT);
 static PTMR_EVENT_PVT   _tmrGetNextFreeCallback(OBJTMR *);
 static NV_STATUS        _tmrInsertCallback(OBJTMR *, PTMR_EVENT_PVT, NvU64);
 static void             _tmrInsertCallbackInList(OBJGPU *pGpu, OBJTMR *pTmr, PTMR_EVENT_PVT pEvent);
+static NV_STATUS        _tmrScheduleCallbackRelOSTimer(OBJTMR *, TIMEPROC_OBSOLETE, void *, NvU64, NvU32, NvU32);
 static void             _tmrStateLoadCallbacks(OBJGPU *, OBJTMR *);
 static NV_STATUS        _tmrGetNextAlarmTime(OBJTMR *, NvU64 *);
 static void             _tmrScheduleCallbackInterrupt(OBJGPU *, OBJTMR *, NvU64);
@@ -185,6 +186,8 @@ _tmrGrTimeStampFreqStateChange
 void
 tmrDestruct_IMPL(OBJTMR  *pTmr)
 {
+    NvU32 i;
+
     // Delete the Granular lock for SWRL Timer callback
     if (pTmr->pTmrSwrlLock != NULL)
     {
@@ -192,6 +195,18 @@ tmrDestruct_IMPL(OBJTMR  *pTmr)
         pTmr->pTmrSwrlLock = NULL;
     }
 
+    // Destroy the OS timer objects lazily created for legacy callbacks.
+    for (i = 0; i < TMR_NUM_CALLBACKS_RM; i++)
+    {
+        PTMR_EVENT_PVT pEvent = &pTmr->rmCallbackTable_OBSOLETE[i];
+
+        if (pEvent->super.pOSTmrCBdata != NULL)
+        {
+            tmrEventDestroyOSTimer_HAL(pTmr, (PTMR_EVENT)pEvent);
+            pEvent->super.pOSTmrCBdata = NULL;
+        }
+    }
+
     objDelete(pTmr->pGrTickFreqRefcnt);
     pTmr->pGrTickFreqRefcnt = NULL;
 
@@ -639,6 +654,17 @@ NV_STATUS tmrScheduleCallbackRel_IMPL
     NvU64   AbsTime, currentTime;
     NV_STATUS rmStatus;
 
+    //
+    // Route relative callbacks through the OS timer where it is in use, so
+    // that legacy clients get the same high resolution scheduling as the
+    // TMR_EVENT API instead of being rejected by the absolute-time path.
+    //
+    if (pTmr->getProperty(pTmr, PDB_PROP_TMR_USE_OS_TIMER_FOR_CALLBACKS) ||
+        (Flags & TMR_FLAG_USE_OS_TIMER))
+    {
+        return _tmrScheduleCallbackRelOSTimer(pTmr, Proc, Object, RelTime, Flags, ChId);
+    }
+
     rmStatus = tmrGetCurrentTime(pTmr, &currentTime);
     if (rmStatus != NV_OK)
         return rmStatus;
@@ -648,6 +674,64 @@ NV_STATUS tmrScheduleCallbackRel_IMPL
     return tmrScheduleCallbackAbs(pTmr, Proc, Object, AbsTime, Flags, ChId);
 }
 
+/*!
+ * Schedules a legacy callback on the OS timer, with the same nanosecond
+ * resolution as the TMR_EVENT API.
+ *
+ * Legacy events come from a static table, so the OS timer object backing an
+ * entry is created on first use and kept across free list recycling; it is
+ * destroyed with the timer in tmrDestruct.
+ */
+static NV_STATUS
+_tmrScheduleCallbackRelOSTimer
+(
+    OBJTMR             *pTmr,
+    TIMEPROC_OBSOLETE   Proc,
+    void               *Object,
+    NvU64               RelTime,
+    NvU32               Flags,
+    NvU32               ChId
+)
+{
+    PTMR_EVENT_PVT tmrInsert;
+    NV_STATUS      rmStatus;
+
+    if (tmrCallbackOnList(pTmr, Proc, Object))
+    {
+        NV_PRINTF(LEVEL_ERROR, "Proc %p Object %p already on tmrList\n", Proc,
+                  Object);
+        return NV_OK;
+    }
+
+    tmrInsert = _tmrGetNextFreeCallback(pTmr);
+    if (tmrInsert == NULL)
+    {
+        return NV_ERR_INSUFFICIENT_RESOURCES;
+    }
+
+    tmrInsert->pTimeProc_OBSOLETE = Proc;
+    tmrInsert->super.pTimeProc = NULL;
+    tmrInsert->super.pUserData = Object;
+    tmrInsert->super.flags = Flags;
+    tmrInsert->super.chId = ChId;
+
+    if (tmrInsert->super.pOSTmrCBdata == NULL)
+    {
+        rmStatus = tmrEventCreateOSTimer_HAL(pTmr, (PTMR_EVENT)tmrInsert);
+        if (rmStatus != NV_OK)
+        {
+            NV_PRINTF(LEVEL_ERROR, "Failed to create OS timer \n");
+
+            // Return the entry to the free list.
+            tmrInsert->pNext = pTmr->pRmCallbackFreeList_OBSOLETE;
+            pTmr->pRmCallbackFreeList_OBSOLETE = tmrInsert;
+            return rmStatus;
+        }
+    }
+
+    return tmrEventScheduleRel(pTmr, (PTMR_EVENT)tmrInsert, RelTime);
+}
+
 /*!
  * Warning! This code is dangerous, it can cause the whole system to crash. It will be
  * removed as soon as possible! Use the new API!
@@ -712,17 +796,23 @@ NvBool tmrCallbackOnList_IMPL
 {
     NvBool onList = NV_FALSE;
     PTMR_EVENT_PVT tmrScan;
-    PTMR_EVENT_PVT tmrList;
+    PTMR_EVENT_PVT tmrLists[2];
+    NvU32 i;
 
-    tmrList = pTmr->pRmActiveEventList;
+    // Legacy events may be queued on either the PTIMER or the OS timer list.
+    tmrLists[0] = pTmr->pRmActiveEventList;
+    tmrLists[1] = pTmr->pRmActiveOSTimerEventList;
 
-    for (tmrScan = tmrList; tmrScan; tmrScan = tmrScan->pNext)
+    for (i = 0; i < NV_ARRAY_ELEMENTS(tmrLists) && !onList; i++)
     {
-        if ((Proc == tmrScan->pTimeProc_OBSOLETE) &&
-            (Object == tmrScan->super.pUserData))
+        for (tmrScan = tmrLists[i]; tmrScan; tmrScan = tmrScan->pNext)
         {
-            onList = NV_TRUE;
-            break;
+            if ((Proc == tmrScan->pTimeProc_OBSOLETE) &&
+                (Object == tmrScan->super.pUserData))
+            {
+                onList = NV_TRUE;
+                break;
+            }
         }
     }
 
@@ -1090,6 +1180,30 @@ static void _tmrScanCallback
         // Now point to the 'next' object in the callback list.
         tmrScan = tmrNext;
     }
+
+    //
+    // Scan the OS timer list as well; matching events must have their queued
+    // OS timer cancelled before being removed and recycled.
+    //
+    tmrScan = pTmr->pRmActiveOSTimerEventList;
+    while (tmrScan)
+    {
+        tmrNext = tmrScan->pNext;
+
+        if (tmrScan->super.pUserData == pObject)
+        {
+            tmrEventCancelOSTimer_HAL(pTmr, (PTMR_EVENT)tmrScan);
+            _tmrScanCallbackOSTimer(pTmr, tmrScan);
+
+            if (tmrScan->bLegacy)
+            {
+                tmrScan->pNext = pTmr->pRmCallbackFreeList_OBSOLETE;
+                pTmr->pRmCallbackFreeList_OBSOLETE = tmrScan;
+            }
+        }
+
+        tmrScan = tmrNext;
+    }
 }
 
 /*!
@@ -1487,7 +1601,8 @@ tmrCancelCallback_IMPL
     OBJGPU *pGpu = ENG_GET_GPU(pTmr);
     NvU64   nextAlarmTime;
 
-    if (tmrEventsExist(pTmr) && pObject != NULL)
+    if ((tmrEventsExist(pTmr) || (pTmr->pRmActiveOSTimerEventList != NULL)) &&
+        (pObject != NULL))
     {
         // Pull all objects with the same address from the callback list.
         _tmrScanCallback(pTmr, pObject);
@@ -1896,6 +2011,17 @@ NV_STATUS tmrEventServiceTimer_IMPL
     {
         _tmrScanCallbackOSTimer(pTmr, pEvent);
         status = tmrEventServiceOSTimerCallback_HAL(pGpu, pTmr, pPublicEvent);
+
+        //
+        // Recycle legacy events once the callback has run; the callback may
+        // have rescheduled itself, in which case the event is back on the
+        // OS timer list and must stay allocated.
+        //
+        if (pEvent->bLegacy && !tmrEventOnList(pTmr, (PTMR_EVENT)pEvent))
+        {
+            pEvent->pNext = pTmr->pRmCallbackFreeList_OBSOLETE;
+            pTmr->pRmCallbackFreeList_OBSOLETE = pEvent;
+        }
     }
 
     return status;
@@ -144,7 +144,12 @@ NV_STATUS tmrEventServiceOSTimerCallback_OSTIMER
     PTMR_EVENT_PVT  pEvent = (PTMR_EVENT_PVT)pPublicEvent;
     NV_STATUS status = NV_OK;
 
-    if (pEvent && (pEvent->super.pTimeProc != NULL))
+    if (pEvent && pEvent->bLegacy && (pEvent->pTimeProc_OBSOLETE != NULL))
+    {
+        pEvent->pTimeProc_OBSOLETE(pGpu, pTmr, pEvent->super.pUserData);
+        pEvent->super.flags &= ~TMR_FLAG_OS_TIMER_QUEUED;
+    }
+    else if (pEvent && (pEvent->super.pTimeProc != NULL))
     {
         pEvent->super.pTimeProc(pGpu, pTmr, (PTMR_EVENT)pEvent);
         pEvent->super.flags &= ~TMR_FLAG_OS_TIMER_QUEUED;
@@ -32,6 +32,7 @@
 #include "core/system.h"
 
 #include "gpu/gpu.h" // for NBADDR
+#include "utils/nvhash.h"
 
 NV_STATUS
 gpudbConstruct_IMPL
@@ -75,12 +76,15 @@ _gpudbFindGpuInfoByUuid
     OBJSYS *pSys = SYS_GET_INSTANCE();
     GpuDb *pGpuDb = SYS_GET_GPUDB(pSys);
     GPU_INFO_LIST_NODE *pNode = NULL;
+    NvU64 uuidHash = nvHash64Buf(pUuid, RM_SHA1_GID_SIZE, 0);
 
     for (pNode = listHead(&pGpuDb->gpuList);
          pNode != NULL;
          pNode = listNext(&pGpuDb->gpuList, pNode))
     {
-        if (portMemCmp(pNode->uuid, pUuid, RM_SHA1_GID_SIZE) == 0)
+        // Compare the precomputed hashes first to skip most memcmp calls
+        if ((pNode->uuidHash == uuidHash) &&
+            (portMemCmp(pNode->uuid, pUuid, RM_SHA1_GID_SIZE) == 0))
         {
             break;
         }
@@ -116,6 +120,7 @@ gpudbRegisterGpu(const NvU8 *pUuid, const NBADDR *pUpstreamPortPciInfo, NvU64 pc
     }
 
     portMemCopy(pNode->uuid, RM_SHA1_GID_SIZE, pUuid, RM_SHA1_GID_SIZE);
+    pNode->uuidHash = nvHash64Buf(pNode->uuid, RM_SHA1_GID_SIZE, 0);
 
     pNode->pciPortInfo.domain = gpuDecodeDomain(pciInfo);
     pNode->pciPortInfo.bus = gpuDecodeBus(pciInfo);
@@ -41,6 +41,16 @@
 #include "kernel/gpu/fifo/kernel_fifo.h"
 #include "kernel/gpu/gr/kernel_graphics.h"
 #include "gpu/mem_mgr/heap.h"
+#include "os/os.h"
+
+// Parameters handed to the pool refill work item
+typedef struct
+{
+    CTX_BUF_POOL_INFO *pCtxBufPool;
+} CTX_BUF_POOL_REFILL_PARAMS;
+
+static void _ctxBufPoolDestroy(CTX_BUF_POOL_INFO *pCtxBufPool);
+static void _ctxBufPoolRefillWorkItem(NvU32 gpuInstance, void *pArgs);
 
 /*
  * @brief Are memory pools supported for context buffers
@@ -133,6 +143,7 @@ ctxBufPoolInit
     pCtxBufPool = portMemAllocNonPaged(sizeof(CTX_BUF_POOL_INFO));
     NV_ASSERT_OR_RETURN((pCtxBufPool != NULL), NV_ERR_NO_MEMORY);
     portMemSet(pCtxBufPool, 0, sizeof(CTX_BUF_POOL_INFO));
+    pCtxBufPool->pGpu = pGpu;
 
     //
     // create a mem pool for each page size supported by RM
@@ -197,7 +208,6 @@ ctxBufPoolDestroy
     CTX_BUF_POOL_INFO **ppCtxBufPool
 )
 {
-    NvU32 i;
     CTX_BUF_POOL_INFO *pCtxBufPool;
     NV_ASSERT((ppCtxBufPool != NULL) && (*ppCtxBufPool != NULL));
     if ((ppCtxBufPool == NULL) || (*ppCtxBufPool == NULL))
@@ -208,6 +218,38 @@ ctxBufPoolDestroy
 
     pCtxBufPool = *ppCtxBufPool;
 
+    //
+    // If a refill work item is still pending, hand the destroy over to it.
+    // Both this path and the work item run under the API lock, so the
+    // handshake is race free.
+    //
+    if (pCtxBufPool->bRefillQueued)
+    {
+        pCtxBufPool->bDestroyPending = NV_TRUE;
+        *ppCtxBufPool = NULL;
+        return;
+    }
+
+    _ctxBufPoolDestroy(pCtxBufPool);
+    *ppCtxBufPool = NULL;
+    NV_PRINTF(LEVEL_INFO, "Ctx buf pool destroyed\n");
+}
+
+/*
+ * @brief Frees the pool hierarchy and the tracking structure
+ *
+ * @param[in] pCtxBufPool Pointer to context buffer pool
+ *
+ * @return
+ */
+static void
+_ctxBufPoolDestroy
+(
+    CTX_BUF_POOL_INFO *pCtxBufPool
+)
+{
+    NvU32 i;
+
     for (i = 0; i < RM_ATTR_PAGE_SIZE_INVALID; i++)
     {
         if (pCtxBufPool->pMemPool[i] != NULL)
@@ -217,8 +259,149 @@ ctxBufPoolDestroy
         }
     }
     portMemFree(pCtxBufPool);
-    *ppCtxBufPool = NULL;
-    NV_PRINTF(LEVEL_INFO, "Ctx buf pool destroyed\n");
+}
+
+/*
+ * @brief Enables low-watermark refill of a pool from a work item
+ *
+ *        When enabled, an allocation that drains a pool below a quarter of
+ *        its reservation high-water mark queues a work item that tops the
+ *        pool back up outside the GPU lock, so later channel-creation bursts
+ *        don't fall back to a synchronous PMA reservation.
+ *
+ *        Only pools that live until engine/GPU state destroy may enable
+ *        this; pools owned by a channel group must not.
+ *
+ * @param[in] pCtxBufPool Pointer to context buffer pool
+ * @param[in] bAutoRefill Enable or disable automatic refill
+ *
+ * @return
+ */
+void
+ctxBufPoolSetAutoRefill
+(
+    CTX_BUF_POOL_INFO *pCtxBufPool,
+    NvBool             bAutoRefill
+)
+{
+    if (pCtxBufPool == NULL)
+    {
+        return;
+    }
+    pCtxBufPool->bAutoRefill = bAutoRefill;
+}
+
+/*
+ * @brief Returns a usage snapshot of a context buffer pool
+ *
+ * @param[in]  pCtxBufPool     Pointer to context buffer pool
+ * @param[out] pFreeBytes      Pre-reserved memory currently free across all pools
+ * @param[out] pReservedBytes  High-water mark of memory reserved across all pools
+ * @param[out] pStats          Allocation statistics
+ * @param[out] pbRefillPending NV_TRUE if a refill work item is queued
+ *
+ * @return NV_STATUS
+ */
+NV_STATUS
+ctxBufPoolGetStats
+(
+    CTX_BUF_POOL_INFO  *pCtxBufPool,
+    NvU64              *pFreeBytes,
+    NvU64              *pReservedBytes,
+    CTX_BUF_POOL_STATS *pStats,
+    NvBool             *pbRefillPending
+)
+{
+    NvU32 i;
+
+    NV_ASSERT_OR_RETURN(pCtxBufPool != NULL, NV_ERR_INVALID_ARGUMENT);
+    NV_ASSERT_OR_RETURN((pFreeBytes != NULL) && (pReservedBytes != NULL) &&
+                        (pStats != NULL) && (pbRefillPending != NULL),
+                        NV_ERR_INVALID_ARGUMENT);
+
+    *pFreeBytes = 0;
+    *pReservedBytes = 0;
+
+    for (i = 0; i < RM_ATTR_PAGE_SIZE_INVALID; i++)
+    {
+        NvU64 chunkSize;
+        NvU64 pageSize;
+        NvU32 freeListLength;
+
+        if (pCtxBufPool->pMemPool[i] == NULL)
+        {
+            continue;
+        }
+
+        NV_ASSERT_OK_OR_RETURN(
+            rmMemPoolGetChunkAndPageSize(pCtxBufPool->pMemPool[i], &chunkSize, &pageSize));
+        NV_ASSERT_OK_OR_RETURN(
+            rmMemPoolGetFreeListLength(pCtxBufPool->pMemPool[i], &freeListLength));
+
+        *pFreeBytes += (NvU64)freeListLength * chunkSize;
+        *pReservedBytes += pCtxBufPool->refillTargetChunks[i] * chunkSize;
+    }
+
+    *pStats = pCtxBufPool->stats;
+    *pbRefillPending = pCtxBufPool->bRefillQueued;
+    return NV_OK;
+}
+
+/*
+ * @brief Work item that tops pools back up to their reservation high-water mark
+ *
+ *        Runs with the API lock held but without the GPU lock, matching the
+ *        lock ordering rmMemPoolReserve() requires for calling into PMA.
+ *
+ * @param[in] gpuInstance GPU instance id (unused; the pool knows its GPU)
+ * @param[in] pArgs       CTX_BUF_POOL_REFILL_PARAMS pointer
+ *
+ * @return
+ */
+static void
+_ctxBufPoolRefillWorkItem
+(
+    NvU32 gpuInstance,
+    void *pArgs
+)
+{
+    CTX_BUF_POOL_REFILL_PARAMS *pParams = (CTX_BUF_POOL_REFILL_PARAMS *)pArgs;
+    CTX_BUF_POOL_INFO *pCtxBufPool = pParams->pCtxBufPool;
+    NvU32 i;
+
+    if (pCtxBufPool->bDestroyPending)
+    {
+        _ctxBufPoolDestroy(pCtxBufPool);
+        return;
+    }
+
+    pCtxBufPool->bRefillQueued = NV_FALSE;
+
+    for (i = 0; i < RM_ATTR_PAGE_SIZE_INVALID; i++)
+    {
+        NvU64 chunkSize;
+        NvU64 pageSize;
+
+        if ((pCtxBufPool->pMemPool[i] == NULL) ||
+            (pCtxBufPool->refillTargetChunks[i] == 0))
+        {
+            continue;
+        }
+
+        if (rmMemPoolGetChunkAndPageSize(pCtxBufPool->pMemPool[i],
+                                         &chunkSize, &pageSize) != NV_OK)
+        {
+            continue;
+        }
+
+        // rmMemPoolReserve() only allocates the shortfall, if any.
+        if (rmMemPoolReserve(pCtxBufPool->pMemPool[i],
+                             pCtxBufPool->refillTargetChunks[i] * chunkSize,
+                             0) == NV_OK)
+        {
+            pCtxBufPool->stats.refillCount++;
+        }
+    }
 }
 
 /*
@@ -305,8 +488,22 @@ ctxBufPoolReserve
     {
         if (totalSize[i] > 0)
         {
+            NvU64 chunkSize;
+            NvU64 poolPageSize;
+            NvU64 numChunks;
+
             NV_ASSERT_OK_OR_GOTO(status, rmMemPoolReserve(pCtxBufPool->pMemPool[i], totalSize[i], 0), done);
             NV_PRINTF(LEVEL_INFO, "Reserved 0x%llx bytes in pool with RM_ATTR_PAGE_SIZE_* = 0x%x\n", totalSize[i], i);
+
+            // Track the largest reservation as the refill target for this pool.
+            NV_ASSERT_OK_OR_GOTO(status,
+                rmMemPoolGetChunkAndPageSize(pCtxBufPool->pMemPool[i], &chunkSize, &poolPageSize),
+                done);
+            numChunks = NV_DIV_AND_CEIL(totalSize[i], chunkSize);
+            if (numChunks > pCtxBufPool->refillTargetChunks[i])
+            {
+                pCtxBufPool->refillTargetChunks[i] = numChunks;
+            }
         }
     }
 
@@ -421,27 +618,62 @@ ctxBufPoolAllocate
     }
 
     // Determine the pool(4K/64K/2M) from where this buffer is to be allocated
+    NvU32 attr;
     switch(pageSize)
     {
         case RM_PAGE_SIZE:
-            pPool = pCtxBufPool->pMemPool[RM_ATTR_PAGE_SIZE_4KB];
+            attr = RM_ATTR_PAGE_SIZE_4KB;
             break;
         case RM_PAGE_SIZE_64K:
         case RM_PAGE_SIZE_128K:
-            pPool = pCtxBufPool->pMemPool[RM_ATTR_PAGE_SIZE_BIG];
+            attr = RM_ATTR_PAGE_SIZE_BIG;
             break;
         case RM_PAGE_SIZE_HUGE:
-            pPool = pCtxBufPool->pMemPool[RM_ATTR_PAGE_SIZE_HUGE];
+            attr = RM_ATTR_PAGE_SIZE_HUGE;
             break;
         case RM_PAGE_SIZE_512M:
-            pPool = pCtxBufPool->pMemPool[RM_ATTR_PAGE_SIZE_512MB];
+            attr = RM_ATTR_PAGE_SIZE_512MB;
             break;
         default:
             NV_PRINTF(LEVEL_ERROR, "Unsupported page size = 0x%llx set for context buffer\n", pageSize);
             NV_ASSERT_OR_RETURN(0, NV_ERR_INVALID_ARGUMENT);
     }
+    pPool = pCtxBufPool->pMemPool[attr];
     NV_ASSERT_OK_OR_RETURN(rmMemPoolAllocate(pPool, (RM_POOL_ALLOC_MEMDESC*)pMemDesc));
+    pCtxBufPool->stats.allocCount++;
     NV_PRINTF(LEVEL_INFO, "Buffer allocated from ctx buf pool with page size = 0x%llx\n", pageSize);
+
+    //
+    // If this allocation drained the pool below a quarter of its reservation
+    // high-water mark, top it back up from a work item. The refill cannot be
+    // done here since PMA must not be called with the GPU lock held.
+    //
+    if (pCtxBufPool->bAutoRefill && !pCtxBufPool->bRefillQueued &&
+        (pCtxBufPool->refillTargetChunks[attr] > 0))
+    {
+        NvU32 freeListLength;
+
+        if ((rmMemPoolGetFreeListLength(pPool, &freeListLength) == NV_OK) &&
+            (freeListLength < NV_MAX(1, pCtxBufPool->refillTargetChunks[attr] / 4)))
+        {
+            CTX_BUF_POOL_REFILL_PARAMS *pRefillParams =
+                portMemAllocNonPaged(sizeof(*pRefillParams));
+
+            if (pRefillParams != NULL)
+            {
+                pRefillParams->pCtxBufPool = pCtxBufPool;
+                pCtxBufPool->bRefillQueued = NV_TRUE;
+                if (osQueueWorkItemWithFlags(pCtxBufPool->pGpu,
+                                             _ctxBufPoolRefillWorkItem,
+                                             pRefillParams,
+                                             OS_QUEUE_WORKITEM_FLAGS_LOCK_API_RW) != NV_OK)
+                {
+                    pCtxBufPool->bRefillQueued = NV_FALSE;
+                    portMemFree(pRefillParams);
+                }
+            }
+        }
+    }
     return NV_OK;
 }
 
@@ -515,6 +747,7 @@ ctxBufPoolFree
                          TRANSFER_FLAGS_NONE));
     }
     rmMemPoolFree(pPool, (RM_POOL_ALLOC_MEMDESC*)pMemDesc, 0);
+    pCtxBufPool->stats.freeCount++;
 
     NV_PRINTF(LEVEL_INFO, "Buffer freed from ctx buf pool with page size = 0x%llx\n", pageSize);
     return NV_OK;
@@ -974,6 +974,7 @@ fabricvaspaceUnmapPhysMemdesc_IMPL
 )
 {
     OBJGPU *pGpu = pPhysMemDesc->pGpu;
+    OBJGVASPACE *pGVAS;
     NvU32 fabricPageCount;
     NvU64 fabricAddr;
     NvU64 fabricPageSize;
@@ -994,6 +995,13 @@ fabricvaspaceUnmapPhysMemdesc_IMPL
 
     pFabricPteArray = memdescGetPteArray(pFabricMemDesc, AT_GPU);
 
+    //
+    // Batch the per-page unmaps so one flush and one invalidate cover the
+    // whole range instead of invalidating per operation.
+    //
+    pGVAS = dynamicCast(pFabricVAS->pGVAS, OBJGVASPACE);
+    gvaspaceWalkBatchBegin(pGVAS, pGpu);
+
     for (i = 0; i < numRegions; i++)
     {
         fabricPageCount =
@@ -1024,7 +1032,7 @@ fabricvaspaceUnmapPhysMemdesc_IMPL
         }
     }
 
-    fabricvaspaceInvalidateTlb(pFabricVAS, pPhysMemDesc->pGpu, PTE_DOWNGRADE);
+    gvaspaceWalkBatchEnd(pGVAS, pGpu, PTE_DOWNGRADE);
 }
 
 NV_STATUS
@@ -1042,6 +1050,7 @@ fabricvaspaceMapPhysMemdesc_IMPL
     OBJGPU *pGpu = pPhysMemDesc->pGpu;
     VirtMemAllocator *pDma = GPU_GET_DMA(pGpu);
     MemoryManager *pMemoryManager = GPU_GET_MEMORY_MANAGER(pGpu);
+    OBJGVASPACE *pGVAS;
     NV_STATUS status;
     DMA_PAGE_ARRAY pageArray;
     NvU32 kind;
@@ -1129,6 +1138,13 @@ fabricvaspaceMapPhysMemdesc_IMPL
     pFabricPteArray = memdescGetPteArray(pFabricMemDesc, AT_GPU);
     pPhysPteArray = memdescGetPteArray(pPhysMemDesc, AT_GPU);
 
+    //
+    // Batch the per-page map updates so one flush and one invalidate cover
+    // the whole range instead of invalidating per operation.
+    //
+    pGVAS = dynamicCast(pFabricVAS->pGVAS, OBJGVASPACE);
+    gvaspaceWalkBatchBegin(pGVAS, pGpu);
+
     for (i = 0; i < numRegions; i++)
     {
         fabricPageCount = ((memdescGetPteArraySize(pFabricMemDesc, AT_GPU) == 1) ||
@@ -1205,11 +1221,14 @@ fabricvaspaceMapPhysMemdesc_IMPL
         }
     }
 
-    fabricvaspaceInvalidateTlb(pFabricVAS, pPhysMemDesc->pGpu, PTE_UPGRADE);
+    gvaspaceWalkBatchEnd(pGVAS, pGpu, PTE_UPGRADE);
 
     return NV_OK;
 
 fail:
+    // Close the batch before unwinding; the unmaps below batch on their own.
+    gvaspaceWalkBatchEnd(pGVAS, pGpu, PTE_UPGRADE);
+
     for (j = 0; j < i; j++)
         fabricvaspaceUnmapPhysMemdesc(pFabricVAS, pFabricMemDesc,
                                       regions.r[j].offset, pPhysMemDesc,
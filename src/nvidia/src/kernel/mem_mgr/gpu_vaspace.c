@@ -41,6 +41,8 @@
 #include "lib/base_utils.h"
 #include "class/cl90f1.h"  // FERMI_VASPACE_A
 #include "ctrl/ctrl90f1.h"  // FERMI_VASPACE_A
+#include "ctrl/ctrl0080/ctrl0080dma.h"
+#include "mem_mgr/virtual_mem.h"
 #include "class/cl0040.h" // NV01_MEMORY_LOCAL_USER
 #include "vgpu/rpc.h"
 #include "gpu/mem_mgr/mem_mgr.h"
@@ -3809,6 +3811,52 @@ gvaspaceWalkUserCtxRelease_IMPL
     NV_ASSERT_OK(mmuWalkSetUserCtx(pUserCtx->pGpuState->pWalk, NULL));
 }
 
+void
+gvaspaceWalkBatchBegin_IMPL
+(
+    OBJGVASPACE *pGVAS,
+    OBJGPU      *pGpu
+)
+{
+    GVAS_GPU_STATE *pGpuState = gvaspaceGetGpuState(pGVAS, pGpu);
+
+    NV_ASSERT_OR_RETURN_VOID(NULL != pGpuState);
+    NV_ASSERT_OR_RETURN_VOID(NULL != pGpuState->pWalk);
+
+    mmuWalkBatchBegin(pGpuState->pWalk);
+}
+
+void
+gvaspaceWalkBatchEnd_IMPL
+(
+    OBJGVASPACE         *pGVAS,
+    OBJGPU              *pGpu,
+    VAS_PTE_UPDATE_TYPE  update_type
+)
+{
+    GVAS_GPU_STATE *pGpuState = gvaspaceGetGpuState(pGVAS, pGpu);
+    NvU64           vaLo;
+    NvU64           vaHi;
+
+    NV_ASSERT_OR_RETURN_VOID(NULL != pGpuState);
+    NV_ASSERT_OR_RETURN_VOID(NULL != pGpuState->pWalk);
+
+    //
+    // One flush and one invalidate on behalf of all operations in the
+    // batch. Skipped entirely if no operation modified page level entries.
+    // The accumulated VA range is not consumed yet since TLB invalidation
+    // is per-VAS, but the walker reports it for future ranged invalidates.
+    //
+    if (mmuWalkBatchEnd(pGpuState->pWalk, &vaLo, &vaHi))
+    {
+        KernelBus *pKernelBus = GPU_GET_KERNEL_BUS(pGpu);
+
+        kbusFlush_HAL(pGpu, pKernelBus, BUS_FLUSH_VIDEO_MEMORY |
+                                        BUS_FLUSH_SYSTEM_MEMORY);
+        gvaspaceInvalidateTlb(pGVAS, pGpu, update_type);
+    }
+}
+
 NV_STATUS
 gvaspaceIncChanGrpRefCnt_IMPL
 (
@@ -4562,6 +4610,110 @@ vaspaceapiCtrlCmdVaspaceGetHostRmManagedSize_IMPL
     return NV_OK;
 }
 
+NV_STATUS
+vaspaceapiCtrlCmdVaspaceMapBatch_IMPL
+(
+    VaSpaceApi                           *pVaspaceApi,
+    NV90F1_CTRL_VASPACE_MAP_BATCH_PARAMS *pMapBatchParams
+)
+{
+    RM_API    *pRmApi    = rmapiGetInterface(RMAPI_API_LOCK_INTERNAL);
+    RsClient  *pClient   = RES_GET_CLIENT(pVaspaceApi);
+    NvHandle   hClient   = RES_GET_CLIENT_HANDLE(pVaspaceApi);
+    NvHandle   hDevice   = RES_GET_PARENT_HANDLE(pVaspaceApi);
+    NV_STATUS  status    = NV_OK;
+    NvU32      numMapped = 0;
+    NvU32      i;
+
+    NV_CHECK_OR_RETURN(LEVEL_ERROR,
+                       (pMapBatchParams->numEntries > 0) &&
+                       (pMapBatchParams->numEntries <= NV90F1_CTRL_VASPACE_MAP_BATCH_MAX_ENTRIES),
+                       NV_ERR_INVALID_ARGUMENT);
+
+    //
+    // Validate the whole batch before mapping anything. Each mapper must be
+    // a virtual allocation on this VAS since the single TLB invalidate at
+    // the end only covers this VAS.
+    //
+    for (i = 0; i < pMapBatchParams->numEntries; i++)
+    {
+        NV90F1_CTRL_VASPACE_MAP_BATCH_ENTRY *pEntry = &pMapBatchParams->entries[i];
+        VirtualMemory *pVirtualMemory = NULL;
+        OBJVASPACE    *pVAS           = NULL;
+
+        pMapBatchParams->failedEntry = i;
+
+        NV_CHECK_OR_RETURN(LEVEL_ERROR, pEntry->length != 0, NV_ERR_INVALID_ARGUMENT);
+        NV_CHECK_OK_OR_RETURN(LEVEL_ERROR,
+            virtmemGetByHandleAndDevice(pClient, pEntry->hVirtualMemory,
+                                        hDevice, &pVirtualMemory));
+        NV_CHECK_OK_OR_RETURN(LEVEL_ERROR,
+            vaspaceGetByHandleOrDeviceDefault(pClient, hDevice,
+                                              pVirtualMemory->hVASpace, &pVAS));
+        NV_CHECK_OR_RETURN(LEVEL_ERROR, pVAS == pVaspaceApi->pVASpace,
+                           NV_ERR_INVALID_OBJECT_PARENT);
+    }
+
+    for (i = 0; i < pMapBatchParams->numEntries; i++)
+    {
+        NV90F1_CTRL_VASPACE_MAP_BATCH_ENTRY *pEntry = &pMapBatchParams->entries[i];
+
+        status = pRmApi->Map(pRmApi, hClient, hDevice,
+                             pEntry->hVirtualMemory,
+                             pEntry->hMemory,
+                             pEntry->offset,
+                             pEntry->length,
+                             pEntry->flags |
+                                 DRF_DEF(OS46, _FLAGS, _DEFER_TLB_INVALIDATION, _TRUE),
+                             &pEntry->dmaOffset);
+        if (status != NV_OK)
+        {
+            pMapBatchParams->failedEntry = i;
+            break;
+        }
+        numMapped++;
+    }
+
+    NvBool bNeedInvalidate = (numMapped > 0);
+
+    //
+    // On failure unwind the mappings made so far so the batch is
+    // all-or-nothing. The unmaps are deferred as well; the invalidate
+    // below flushes both directions.
+    //
+    if (status != NV_OK)
+    {
+        while (numMapped-- > 0)
+        {
+            NV90F1_CTRL_VASPACE_MAP_BATCH_ENTRY *pEntry = &pMapBatchParams->entries[numMapped];
+
+            (void)pRmApi->Unmap(pRmApi, hClient, hDevice,
+                                pEntry->hVirtualMemory,
+                                DRF_DEF(OS47, _FLAGS, _DEFER_TLB_INVALIDATION, _TRUE),
+                                pEntry->dmaOffset, pEntry->length);
+        }
+    }
+
+    // One TLB invalidate for the whole batch.
+    if (bNeedInvalidate)
+    {
+        NV0080_CTRL_DMA_INVALIDATE_TLB_PARAMS invalidateParams = {0};
+        NV_STATUS invalidateStatus;
+
+        invalidateParams.hVASpace = RES_GET_HANDLE(pVaspaceApi);
+
+        invalidateStatus = pRmApi->Control(pRmApi, hClient, hDevice,
+                                           NV0080_CTRL_CMD_DMA_INVALIDATE_TLB,
+                                           &invalidateParams, sizeof(invalidateParams));
+        if (status == NV_OK)
+        {
+            status = invalidateStatus;
+        }
+    }
+
+    return status;
+}
+
 /********************Local routines used in this file alone*******************/
 
 /*!
@@ -554,9 +554,24 @@ _memMulticastFabricGpuInfoRemove
     MEM_MULTICAST_FABRIC_GPU_INFO *pNode = NULL;
     THREAD_STATE_NODE *pThreadNode = NULL;
     THREAD_STATE_FREE_CALLBACK freeCallback;
+    Fabric *pFabric = SYS_GET_FABRIC(SYS_GET_INSTANCE());
+    NV00F1_CTRL_FABRIC_EVENT *pUnimportEvents = NULL;
+    NvU32 numUnimportEvents = 0;
 
     NV_ASSERT_OK(threadStateGetCurrent(&pThreadNode, NULL));
 
+    //
+    // Batch the unimport events so the IMEX daemon is woken up once for the
+    // whole team instead of once per attached GPU. If the allocation fails,
+    // fall back to posting the events one at a time.
+    //
+    if (!_memMulticastFabricIsPrime(pMulticastFabricDesc->allocFlags) &&
+        (listCount(&pMulticastFabricDesc->gpuInfoList) != 0))
+    {
+        pUnimportEvents = portMemAllocNonPaged(sizeof(*pUnimportEvents) *
+                            listCount(&pMulticastFabricDesc->gpuInfoList));
+    }
+
     while ((pNode = listHead(&pMulticastFabricDesc->gpuInfoList)) != NULL)
     {
         //
@@ -565,18 +580,27 @@ _memMulticastFabricGpuInfoRemove
         //
         if (!_memMulticastFabricIsPrime(pMulticastFabricDesc->allocFlags))
         {
-            Fabric *pFabric = SYS_GET_FABRIC(SYS_GET_INSTANCE());
-            NV00F1_CTRL_FABRIC_EVENT unimportEvent;
-
             NV_ASSERT(pMulticastFabricDesc->imexChannel != -1);
 
-            _memMulticastFabricInitUnimportEvent(pNode->attachEventId,
+            if (pUnimportEvents != NULL)
+            {
+                _memMulticastFabricInitUnimportEvent(pNode->attachEventId,
                                     pMulticastFabricDesc->exportNodeId,
                                     pMulticastFabricDesc->imexChannel,
-                                    &unimportEvent);
-
-            NV_CHECK(LEVEL_WARNING,
-                fabricPostEventsV2(pFabric, &unimportEvent, 1) == NV_OK);
+                                    &pUnimportEvents[numUnimportEvents++]);
+            }
+            else
+            {
+                NV00F1_CTRL_FABRIC_EVENT unimportEvent;
+
+                _memMulticastFabricInitUnimportEvent(pNode->attachEventId,
+                                        pMulticastFabricDesc->exportNodeId,
+                                        pMulticastFabricDesc->imexChannel,
+                                        &unimportEvent);
+
+                NV_CHECK(LEVEL_WARNING,
+                    fabricPostEventsV2(pFabric, &unimportEvent, 1) == NV_OK);
+            }
         }
 
         freeCallback.pCb = osReleaseGpuOsInfo;
@@ -587,6 +611,19 @@ _memMulticastFabricGpuInfoRemove
         listRemove(&pMulticastFabricDesc->gpuInfoList, pNode);
     }
 
+    //
+    // The GPU OS info release callbacks only run once the thread state is
+    // freed, so posting the batch here still precedes the GPU release.
+    //
+    if (numUnimportEvents != 0)
+    {
+        NV_CHECK(LEVEL_WARNING,
+            fabricPostEventsV2(pFabric, pUnimportEvents,
+                               numUnimportEvents) == NV_OK);
+    }
+
+    portMemFree(pUnimportEvents);
+
     pMulticastFabricDesc->localAttachedGpusMask = 0;
     pMulticastFabricDesc->numAttachedGpus = 0;
 }
@@ -103,6 +103,20 @@ static const NvU64 poolAllocSizes[] = {
 #define POOL_CONFIG_POOL_IDX       0
 #define POOL_CONFIG_CHUNKSIZE_IDX  1
 
+//
+// Upper bound on the amount of free memory retained in the topmost pool
+// across frees when bTrimOnFree is set. Retained chunks stay pinned in PMA,
+// so this caps how much framebuffer can be held back by an idle pool.
+//
+#define RM_POOL_MAX_RETAINED_MEMORY 0x200000
+
+//
+// Largest pool page size for which the lock-free magazine cache is enabled.
+// Bigger pages would let the magazines pin too much memory away from
+// poolTrim() for the little contention relief they'd buy.
+//
+#define RM_POOL_MAGAZINE_MAX_PAGE_SIZE 0x10000
+
 static const NvU64 poolConfig[POOL_CONFIG_MAX_SUPPORTED][POOL_CONFIG_CHUNKSIZE_IDX + 1] = {
      // page size        // chunk size
      { RM_POOL_IDX_256K, PMA_CHUNK_SIZE_512K},  // pool with pageSize = 256K for GMMU_FMT_VERSION_1
@@ -166,9 +180,10 @@ struct RM_POOL_ALLOC_MEM_RESERVE_INFO
     POOLALLOC *pPool[NUM_POOLS];
 
     /*!
-     * Num of allocations made from the pool.
+     * Num of allocations made from the pool. Updated atomically so that the
+     * magazine fast paths can refcount without taking pPoolLock.
      */
-    NvU64 validAllocCount;
+    volatile NvU64 validAllocCount;
 
     /*!
      * Skip scrubbing for all allocations made from the pool.
@@ -184,6 +199,16 @@ struct RM_POOL_ALLOC_MEM_RESERVE_INFO
      * Allocate pool in protected memory
      */
     NvBool bProtected;
+
+    /*!
+     * High-water mark (in chunks) of reservations made against the topmost
+     * pool. When bTrimOnFree is set, up to this many free chunks are retained
+     * in the topmost pool instead of being returned to PMA so that subsequent
+     * reservations are satisfied without a round trip to PMA in the mapping
+     * path. Capped by RM_POOL_MAX_RETAINED_MEMORY and reset when the last
+     * allocation is released.
+     */
+    NvU64 retainedChunkCount;
 };
 
 /* ------------------------------------ Static functions --------------------------- */
@@ -395,7 +420,7 @@ rmMemPoolAddRef
 {
     NV_ASSERT_OR_RETURN_VOID(NULL != pMemReserveInfo);
 
-    pMemReserveInfo->validAllocCount++;
+    portAtomicExIncrementU64(&pMemReserveInfo->validAllocCount);
 }
 
 /*!
@@ -415,7 +440,7 @@ rmMemPoolRemoveRef
     NV_ASSERT_OR_RETURN_VOID(NULL != pMemReserveInfo);
     NV_ASSERT_OR_RETURN_VOID(pMemReserveInfo->validAllocCount > 0);
 
-    pMemReserveInfo->validAllocCount--;
+    portAtomicExDecrementU64(&pMemReserveInfo->validAllocCount);
 }
 
 /*!
@@ -496,6 +521,10 @@ rmMemPoolSetup
     {
         flags = FLD_SET_DRF(_RMPOOL, _FLAGS, _AUTO_POPULATE, _DISABLE, flags);
     }
+    if (poolAllocSizes[pMemReserveInfo->topmostPoolIndex] <= RM_POOL_MAGAZINE_MAX_PAGE_SIZE)
+    {
+        flags = FLD_SET_DRF(_RMPOOL, _FLAGS, _MAGAZINE_CACHE, _ENABLE, flags);
+    }
     pMemReserveInfo->pPool[pMemReserveInfo->topmostPoolIndex] = poolInitialize(
                                                  pMemReserveInfo->pmaChunkSize,
                                                  poolAllocSizes[pMemReserveInfo->topmostPoolIndex],
@@ -517,6 +546,14 @@ rmMemPoolSetup
     flags = FLD_SET_DRF(_RMPOOL, _FLAGS, _AUTO_POPULATE, _ENABLE, flags);
     for (poolIndex = pMemReserveInfo->topmostPoolIndex + 1; poolIndex < NUM_POOLS; poolIndex++)
     {
+        if (poolAllocSizes[poolIndex] <= RM_POOL_MAGAZINE_MAX_PAGE_SIZE)
+        {
+            flags = FLD_SET_DRF(_RMPOOL, _FLAGS, _MAGAZINE_CACHE, _ENABLE, flags);
+        }
+        else
+        {
+            flags = FLD_SET_DRF(_RMPOOL, _FLAGS, _MAGAZINE_CACHE, _DISABLE, flags);
+        }
         pMemReserveInfo->pPool[poolIndex] = poolInitialize(
                                                 poolAllocSizes[poolIndex - 1],
                                                 poolAllocSizes[poolIndex],
@@ -591,6 +628,18 @@ rmMemPoolReserve
 
     numChunks = NV_DIV_AND_CEIL(size, pMemReserveInfo->pmaChunkSize);
 
+    //
+    // Track the largest reservation made so far. On free, this many chunks
+    // (capped) are kept in the topmost pool instead of being trimmed back to
+    // PMA, so that page level allocations for subsequent mappings don't pay
+    // for a PMA round trip inside the mapping call.
+    //
+    if (numChunks > pMemReserveInfo->retainedChunkCount)
+    {
+        pMemReserveInfo->retainedChunkCount =
+            NV_MIN(numChunks, RM_POOL_MAX_RETAINED_MEMORY / pMemReserveInfo->pmaChunkSize);
+    }
+
     // Reserve pages only in the topmost pool.
     if (NULL != pMemReserveInfo->pPool[pMemReserveInfo->topmostPoolIndex])
     {
@@ -635,14 +684,6 @@ rmMemPoolAllocate
     portMemSet(pPageHandleList, 0, sizeof(*pPageHandleList));
     listInit(pPageHandleList, portMemAllocatorGetGlobalNonPaged());
 
-    portSyncMutexAcquire(pMemReserveInfo->pPoolLock);
-
-    poolGetListLength(pMemReserveInfo->pPool[topPool],
-                      &freeListLength, NULL, NULL);
-    NV_PRINTF(LEVEL_INFO,
-        "Total size of memory reserved for allocation = 0x%llx Bytes\n",
-        freeListLength * pMemReserveInfo->pmaChunkSize);
-
     //
     // The onus is on the caller to pass the correct size info after factoring
     // in any alignment requirements. The size after factoring in all alignment
@@ -672,11 +713,44 @@ rmMemPoolAllocate
 
         if (poolIndex < 0)
         {
-            status = NV_ERR_NO_MEMORY;
-            goto done;
+            listClear(pPageHandleList);
+            portMemFree(pPageHandleList);
+            return NV_ERR_NO_MEMORY;
         }
     }
 
+    //
+    // Single-page requests are the common case during channel churn; try the
+    // pool's lock-free magazine cache before taking pPoolLock.
+    //
+    if (numPages == 0)
+    {
+        pPageHandle = listAppendNew(pPageHandleList);
+        if (pPageHandle != NULL)
+        {
+            if (poolAllocateFromMagazine(pMemReserveInfo->pPool[poolIndex],
+                                         pPageHandle))
+            {
+                memdescDescribe(pMemDesc, ADDR_FBMEM, pPageHandle->address,
+                                pMemDesc->Size);
+                pMemDesc->ActualSize = allocSize;
+                pMemDesc->pPageHandleList = pPageHandleList;
+                rmMemPoolAddRef(pMemReserveInfo);
+                return NV_OK;
+            }
+            listRemove(pPageHandleList, pPageHandle);
+        }
+        pPageHandle = NULL;
+    }
+
+    portSyncMutexAcquire(pMemReserveInfo->pPoolLock);
+
+    poolGetListLength(pMemReserveInfo->pPool[topPool],
+                      &freeListLength, NULL, NULL);
+    NV_PRINTF(LEVEL_INFO,
+        "Total size of memory reserved for allocation = 0x%llx Bytes\n",
+        freeListLength * pMemReserveInfo->pmaChunkSize);
+
     //
     // If allocation request is greater than page size of top level pool then
     // allocate multiple pages from top-level pool
@@ -837,6 +911,39 @@ rmMemPoolFree
     NV_ASSERT_OR_RETURN_VOID((pMemDesc->pPageHandleList != NULL) &&
                              (listCount(pMemDesc->pPageHandleList) != 0));
 
+    topPool = pMemReserveInfo->topmostPoolIndex;
+    allocSize = pMemDesc->ActualSize;
+
+    //
+    // Fast path: recycle a single cached page through the lock-free magazine.
+    // Shared memdescs (RefCount > 1) must keep their backing, and multi-page
+    // allocations always take the locked path.
+    //
+    if ((pMemDesc->RefCount <= 1) &&
+        (listCount(pMemDesc->pPageHandleList) == 1) &&
+        (allocSize <= poolAllocSizes[topPool]))
+    {
+        for (poolIndex = NUM_POOLS - 1; poolIndex >= 0; poolIndex--)
+        {
+            if ((NULL != pMemReserveInfo->pPool[poolIndex]) &&
+                (allocSize <= poolAllocSizes[poolIndex]))
+            {
+                break;
+            }
+        }
+
+        if ((poolIndex >= 0) &&
+            poolFreeToMagazine(pMemReserveInfo->pPool[poolIndex],
+                               listHead(pMemDesc->pPageHandleList)))
+        {
+            listClear(pMemDesc->pPageHandleList);
+            portMemFree(pMemDesc->pPageHandleList);
+            pMemDesc->pPageHandleList = NULL;
+            rmMemPoolRemoveRef(pMemReserveInfo);
+            return;
+        }
+    }
+
     portSyncMutexAcquire(pMemReserveInfo->pPoolLock);
 
     //
@@ -886,10 +993,15 @@ rmMemPoolFree
 
     rmMemPoolRemoveRef(pMemReserveInfo);
 
-    // Trim the topmost pool so that any unused pages are returned to PMA.
+    //
+    // Trim the topmost pool so that any unused pages beyond the retained
+    // watermark are returned to PMA.
+    //
     if (pMemReserveInfo->bTrimOnFree)
     {
-        rmMemPoolTrim(pMemReserveInfo, 1, flags);
+        rmMemPoolTrim(pMemReserveInfo,
+                      NV_MAX(1, NvU64_LO32(pMemReserveInfo->retainedChunkCount)),
+                      flags);
     }
 done:
     portSyncMutexRelease(pMemReserveInfo->pPoolLock);
@@ -937,6 +1049,9 @@ rmMemPoolRelease
     {
         if (NULL != pMemReserveInfo->pPool[poolIndex])
         {
+            // Return magazine-cached pages to the lists before checking them.
+            poolMagazineFlushAll(pMemReserveInfo->pPool[poolIndex]);
+
             //
             // Since this function gets called only when validAlloCount is zero,
             // the fullList and the partialList are expected to be empty. All
@@ -952,6 +1067,9 @@ rmMemPoolRelease
         }
     }
 
+    // The last user is gone, so stop retaining free chunks on future frees.
+    pMemReserveInfo->retainedChunkCount = 0;
+
     if (flags & VASPACE_FLAGS_SKIP_SCRUB_MEMPOOL)
     {
         pMemReserveInfo->bSkipScrub = bPrevSkipScrubState;
@@ -1028,6 +1146,23 @@ rmMemPoolSkipScrub
 }
 
 
+NV_STATUS
+rmMemPoolGetFreeListLength
+(
+    RM_POOL_ALLOC_MEM_RESERVE_INFO *pMemReserveInfo,
+    NvU32 *pFreeListLength
+)
+{
+    NV_ASSERT_OR_RETURN(pMemReserveInfo != NULL, NV_ERR_INVALID_ARGUMENT);
+    NV_ASSERT_OR_RETURN(pFreeListLength != NULL, NV_ERR_INVALID_ARGUMENT);
+
+    portSyncMutexAcquire(pMemReserveInfo->pPoolLock);
+    poolGetListLength(pMemReserveInfo->pPool[pMemReserveInfo->topmostPoolIndex],
+                      pFreeListLength, NULL, NULL);
+    portSyncMutexRelease(pMemReserveInfo->pPoolLock);
+    return NV_OK;
+}
+
 NV_STATUS
 rmMemPoolGetChunkAndPageSize
 (
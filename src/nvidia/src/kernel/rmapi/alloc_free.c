@@ -27,6 +27,7 @@
 #include "entry_points.h"
 #include "core/locks.h"
 #include "core/thread_state.h"
+#include "diagnostics/profiler.h"
 #include "vgpu/rpc.h"
 #include "resource_desc.h"
 #include "gpu/disp/disp_objs.h"
@@ -1234,17 +1235,23 @@ rmapiAllocWithSecInfo
     NV_PRINTF(LEVEL_INFO, "client:0x%x parent:0x%x object:0x%x class:0x%x\n",
               hClient, hParent, *phObject, hClass);
 
-    status = _rmAlloc(hClient,
-                      hParent,
-                      phObject,
-                      hClass,
-                      pAllocParams,
-                      paramsSize,
-                      flags,
-                      allocInitStates,
-                      pLockInfo,
-                      pRightsRequested,
-                      *pSecInfo);
+    {
+        NvU64 profStart = RM_PROF_PHASE_BEGIN(RM_PROF_PHASE_SERVER_ALLOC);
+
+        status = _rmAlloc(hClient,
+                          hParent,
+                          phObject,
+                          hClass,
+                          pAllocParams,
+                          paramsSize,
+                          flags,
+                          allocInitStates,
+                          pLockInfo,
+                          pRightsRequested,
+                          *pSecInfo);
+
+        RM_PROF_PHASE_END(RM_PROF_PHASE_SERVER_ALLOC, profStart);
+    }
 
 
     //
@@ -1473,7 +1480,13 @@ rmapiFreeWithSecInfo
 
     rmapiControlCacheFreeObjectEntry(hClient, hObject);
 
-    status = serverFreeResourceTree(&g_resServ, &freeParams);
+    {
+        NvU64 profStart = RM_PROF_PHASE_BEGIN(RM_PROF_PHASE_SERVER_FREE);
+
+        status = serverFreeResourceTree(&g_resServ, &freeParams);
+
+        RM_PROF_PHASE_END(RM_PROF_PHASE_SERVER_FREE, profStart);
+    }
 
     rmapiEpilogue(pRmApi, &rmApiContext);
 
@@ -891,6 +891,24 @@ serverControlLookupLockFlags
 
     *pAccess = LOCK_ACCESS_WRITE;
 
+    if (lock == RS_LOCK_CLIENT)
+    {
+        //
+        // Controls that declare themselves read-only can share the per-client
+        // lock, so read-only query traffic does not serialize against other
+        // controls issued on the same client. Dual-client controls always take
+        // both client locks exclusively.
+        //
+        if (serverSupportsReadOnlyLock(pServer, RS_LOCK_CLIENT, RS_API_CTRL) &&
+            (controlFlags & RMCTRL_FLAGS_CLIENT_LOCK_READONLY) &&
+            !(controlFlags & RMCTRL_FLAGS_DUAL_CLIENT_LOCK))
+        {
+            *pAccess = LOCK_ACCESS_READ;
+        }
+
+        return NV_OK;
+    }
+
     if (lock == RS_LOCK_TOP)
     {
         if (!serverSupportsReadOnlyLock(&g_resServ, RS_LOCK_TOP, RS_API_CTRL))
@@ -58,8 +58,10 @@ static void _nv04IdleChannels(NVOS30_PARAMETERS *pArgs, NvBool bUserModeArgs)
 static void _nv04VidHeapControl(NVOS32_PARAMETERS *pArgs, NvBool bUserModeArgs)             { RMAPI_DEPRECATED(RmDeprecatedVidHeapControl, pArgs, bUserModeArgs); }
 
 static void _nv04AllocWithSecInfo(NVOS21_PARAMETERS*, API_SECURITY_INFO);
+static void _nv04AllocBatchWithSecInfo(NVOS_BATCH_ALLOC_PARAMETERS*, NVOS_BATCH_ALLOC_ENTRY*, API_SECURITY_INFO);
 static void _nv04AllocWithAccessSecInfo(NVOS64_PARAMETERS*, API_SECURITY_INFO);
 static void _nv04ControlWithSecInfo(NVOS54_PARAMETERS*, API_SECURITY_INFO, NvBool bInternalCall);
+static void _nv04ControlBatchWithSecInfo(NVOS_BATCH_CONTROL_PARAMETERS*, NVOS_BATCH_CONTROL_ENTRY*, API_SECURITY_INFO);
 static void _nv01FreeWithSecInfo(NVOS00_PARAMETERS*, API_SECURITY_INFO);
 static void _nv04AllocWithAccess(NVOS64_PARAMETERS*, NvBool);
 static void _nv04MapMemoryWithSecInfo(NVOS33_PARAMETERS*, API_SECURITY_INFO);
@@ -157,8 +159,10 @@ void Nv01AllocMemoryWithSecInfo(NVOS02_PARAMETERS *pArgs, API_SECURITY_INFO secI
 void Nv01AllocObjectWithSecInfo(NVOS05_PARAMETERS *pArgs, API_SECURITY_INFO secInfo)         { RMAPI_DEPRECATED_WITH_SECINFO(RmDeprecatedAllocObject, pArgs, secInfo); }
 void Nv04AllocWithSecInfo(NVOS21_PARAMETERS *pArgs, API_SECURITY_INFO secInfo)               { _nv04AllocWithSecInfo(pArgs, secInfo); }
 void Nv04AllocWithAccessSecInfo(NVOS64_PARAMETERS *pArgs, API_SECURITY_INFO secInfo)         { _nv04AllocWithAccessSecInfo(pArgs, secInfo); }
+void Nv04AllocBatchWithSecInfo(NVOS_BATCH_ALLOC_PARAMETERS *pArgs, NVOS_BATCH_ALLOC_ENTRY *pEntries, API_SECURITY_INFO secInfo) { _nv04AllocBatchWithSecInfo(pArgs, pEntries, secInfo); }
 void Nv01FreeWithSecInfo(NVOS00_PARAMETERS *pArgs, API_SECURITY_INFO secInfo)                { _nv01FreeWithSecInfo(pArgs, secInfo); }
 void Nv04ControlWithSecInfo(NVOS54_PARAMETERS  *pArgs, API_SECURITY_INFO secInfo)            { _nv04ControlWithSecInfo(pArgs, secInfo, NV_FALSE); }
+void Nv04ControlBatchWithSecInfo(NVOS_BATCH_CONTROL_PARAMETERS *pArgs, NVOS_BATCH_CONTROL_ENTRY *pEntries, API_SECURITY_INFO secInfo) { _nv04ControlBatchWithSecInfo(pArgs, pEntries, secInfo); }
 void Nv04VidHeapControlWithSecInfo(NVOS32_PARAMETERS *pArgs, API_SECURITY_INFO secInfo)      { RMAPI_DEPRECATED_WITH_SECINFO(RmDeprecatedVidHeapControl, pArgs, secInfo); }
 void Nv04IdleChannelsWithSecInfo(NVOS30_PARAMETERS *pArgs, API_SECURITY_INFO secInfo)        { RMAPI_DEPRECATED_WITH_SECINFO(RmDeprecatedIdleChannels, pArgs, secInfo); }
 void Nv04MapMemoryWithSecInfo(NVOS33_PARAMETERS *pArgs, API_SECURITY_INFO secInfo)           { _nv04MapMemoryWithSecInfo(pArgs, secInfo); }
@@ -245,6 +249,70 @@ static void _nv04AllocWithSecInfo
                                              NvP64_NULL, &secInfo);
 } // end of _nv04AllocWithSecInfo()
 
+/*
+NV_ESC_RM_BATCH_ALLOC
+    NVOS_BATCH_ALLOC_PARAMETERS;
+        NvU32    numEntries;
+        NvP64    pEntries;
+        NvV32    status;
+
+pEntries has already been copied in by the caller; per-entry statuses and
+generated handles are written back into the caller's copy.
+*/
+
+static void _nv04AllocBatchWithSecInfo
+(
+    NVOS_BATCH_ALLOC_PARAMETERS *pArgs,
+    NVOS_BATCH_ALLOC_ENTRY *pEntries,
+    API_SECURITY_INFO secInfo
+)
+{
+    RM_API *pRmApi = rmapiGetInterface(RMAPI_API_LOCK_INTERNAL);
+    NvU32 i;
+
+    if ((pArgs->numEntries == 0) || (pArgs->numEntries > NV_BATCH_ALLOC_MAX_ENTRIES))
+    {
+        pArgs->status = NV_ERR_INVALID_ARGUMENT;
+        return;
+    }
+
+    for (i = 0; i < pArgs->numEntries; i++)
+        pEntries[i].status = NV_ERR_INVALID_STATE;
+
+    //
+    // Acquire the API lock once for the whole list and run the individual
+    // allocations through the lock-internal API, so a dependency-ordered
+    // allocation tree pays a single lock acquisition instead of one per
+    // object.
+    //
+    pArgs->status = rmapiLockAcquire(RMAPI_LOCK_FLAGS_NONE, RM_LOCK_MODULES_CLIENT);
+    if (pArgs->status != NV_OK)
+        return;
+
+    for (i = 0; i < pArgs->numEntries; i++)
+    {
+        NVOS_BATCH_ALLOC_ENTRY *pEntry = &pEntries[i];
+
+        pEntry->status = pRmApi->AllocWithSecInfo(pRmApi, pEntry->hRoot, pEntry->hObjectParent,
+                                                  &pEntry->hObjectNew, pEntry->hClass,
+                                                  pEntry->pAllocParms, pEntry->paramsSize,
+                                                  RMAPI_ALLOC_FLAGS_NONE, NvP64_NULL, &secInfo);
+
+        //
+        // Later entries typically depend on handles created by earlier ones,
+        // so stop at the first failure; unattempted entries keep
+        // NV_ERR_INVALID_STATE.
+        //
+        if (pEntry->status != NV_OK)
+        {
+            pArgs->status = pEntry->status;
+            break;
+        }
+    }
+
+    rmapiLockRelease();
+} // end of _nv04AllocBatchWithSecInfo()
+
 /*
 NV04_ALLOC_WITH_ACCESS
     NVOS64_PARAMETERS;
@@ -541,6 +609,81 @@ static void _nv04Control
     _nv04ControlWithSecInfo(pArgs, secInfo, bInternalCall);
 } // end of Nv04Control()
 
+/*
+NV_ESC_RM_BATCH_CONTROL
+    NVOS_BATCH_CONTROL_PARAMETERS;
+        NvU32    numEntries;
+        NvP64    pEntries;
+        NvV32    status;
+
+pEntries has already been copied in by the caller; per-entry statuses are
+written back into the caller's copy. Entry params stay as client pointers
+and are copied in and out by the regular control path, including embedded
+pointer handling.
+*/
+
+static void _nv04ControlBatchWithSecInfo
+(
+    NVOS_BATCH_CONTROL_PARAMETERS *pArgs,
+    NVOS_BATCH_CONTROL_ENTRY *pEntries,
+    API_SECURITY_INFO secInfo
+)
+{
+    RM_API *pRmApi = rmapiGetInterface(RMAPI_API_LOCK_INTERNAL);
+    NvU32 i;
+
+    if ((pArgs->numEntries == 0) || (pArgs->numEntries > NV_BATCH_CONTROL_MAX_ENTRIES))
+    {
+        pArgs->status = NV_ERR_INVALID_ARGUMENT;
+        return;
+    }
+
+    //
+    // Acquire the API lock once for the whole list and run the individual
+    // controls through the lock-internal API, so a fixed sequence of small
+    // controls pays a single lock acquisition and one user/kernel crossing.
+    // Entries are independent; each one is attempted and reports its own
+    // status.
+    //
+    pArgs->status = rmapiLockAcquire(RMAPI_LOCK_FLAGS_NONE, RM_LOCK_MODULES_CLIENT);
+    if (pArgs->status != NV_OK)
+    {
+        for (i = 0; i < pArgs->numEntries; i++)
+            pEntries[i].status = NV_ERR_INVALID_STATE;
+        return;
+    }
+
+    for (i = 0; i < pArgs->numEntries; i++)
+    {
+        NVOS_BATCH_CONTROL_ENTRY *pEntry = &pEntries[i];
+        NVOS54_PARAMETERS args;
+
+        portMemSet(&args, 0, sizeof(args));
+        args.hClient    = pEntry->hClient;
+        args.hObject    = pEntry->hObject;
+        args.cmd        = pEntry->cmd;
+        args.flags      = pEntry->flags;
+        args.params     = pEntry->params;
+        args.paramsSize = pEntry->paramsSize;
+
+        //
+        // Deprecated controls manage their own locking through the
+        // deprecated context and cannot run under the batch-held lock.
+        //
+        if (RmDeprecatedGetControlHandler(&args) != NULL)
+        {
+            pEntry->status = NV_ERR_NOT_SUPPORTED;
+            continue;
+        }
+
+        pEntry->status = pRmApi->ControlWithSecInfo(pRmApi, pEntry->hClient, pEntry->hObject,
+                                                    pEntry->cmd, pEntry->params, pEntry->paramsSize,
+                                                    pEntry->flags, &secInfo);
+    }
+
+    rmapiLockRelease();
+} // end of _nv04ControlBatchWithSecInfo()
+
 /*
 NV04_DUP_OBJECT
     NVOS55_PARAMETERS:
@@ -67,17 +67,36 @@ struct GpuEngineEventNotificationList
 {
     PORT_SPINLOCK *pSpinlock;
 
-    // List insertion and removal happens under pSpinlock
+    //
+    // List insertion and removal happens under pSpinlock while no walker is
+    // active (writerCount counted in, notifyActive clear). The notify path
+    // walks the list without taking pSpinlock.
+    //
     EngineEventNotificationList eventNotificationList;
 
-    // Filled while pSpinlock is held, drained outside of the lock in ISR
+    // Filled by the walker, drained outside of any lock in ISR
     PendingEventNotifyList pendingEventNotifyList;
 
     //
-    // Set to non-zero under pSpinlock, set to zero outside of the lock in ISR
+    // Set to non-zero by the walker, set to zero outside of the lock in ISR
     // Insertions/removals on eventNotificationList are blocked while non-zero
     //
     volatile NvU32 pendingEventNotifyCount;
+
+    //
+    // Claimed with a compare-and-swap by the single concurrent walker allowed
+    // on eventNotificationList. Delivery runs from the ISR, so the walker
+    // never takes pSpinlock; it instead waits for writerCount to drop to zero
+    // after claiming this flag.
+    //
+    volatile NvU32 notifyActive;
+
+    //
+    // Count of threads mutating eventNotificationList. Incremented under
+    // pSpinlock; a writer that then observes notifyActive set backs out and
+    // retries, so the walker and a writer can never be active together.
+    //
+    volatile NvU32 writerCount;
 };
 
 static NV_STATUS _insertEventNotification
@@ -133,6 +152,8 @@ NV_STATUS gpuEngineEventNotificationListCreate
     listInitIntrusive(&pEventNotificationList->pendingEventNotifyList);
 
     portAtomicSetU32(&pEventNotificationList->pendingEventNotifyCount, 0);
+    portAtomicSetU32(&pEventNotificationList->notifyActive, 0);
+    portAtomicSetU32(&pEventNotificationList->writerCount, 0);
 
     *ppEventNotificationList = pEventNotificationList;
 
@@ -152,6 +173,8 @@ void gpuEngineEventNotificationListDestroy
         return;
 
     NV_ASSERT(pEventNotificationList->pendingEventNotifyCount == 0);
+    NV_ASSERT(pEventNotificationList->notifyActive == 0);
+    NV_ASSERT(pEventNotificationList->writerCount == 0);
 
     NV_ASSERT(listCount(&pEventNotificationList->pendingEventNotifyList) == 0);
     listDestroy(&pEventNotificationList->pendingEventNotifyList);
@@ -175,23 +198,35 @@ static void _gpuEngineEventNotificationListLockPreemptible
         portSyncSpinlockAcquire(pEventNotificationList->pSpinlock);
 
         //
-        // Only return with the lock held once there are no pending
-        // notifications to process. No more pending notifications can be queued
-        // while the spinlock is held, and we drop the lock to re-enable
-        // preemption, to guarantee that _gpuEngineEventNotificationListNotify()
-        // can make forward progress to drain the pending notifications list.
+        // Only return with the lock held once there is no walker active and
+        // no pending notifications to process. The atomic increment is a full
+        // barrier, so either the walker observes our writerCount and waits,
+        // or we observe its notifyActive/pendingEventNotifyCount and back
+        // out; the two can never run concurrently. We drop the lock to
+        // re-enable preemption, to guarantee that
+        // _gpuEngineEventNotificationListNotify() can make forward progress
+        // to drain the pending notifications list.
         //
         if (pEventNotificationList->pendingEventNotifyCount == 0)
-            return;
+        {
+            portAtomicIncrementU32(&pEventNotificationList->writerCount);
+
+            if ((pEventNotificationList->notifyActive == 0) &&
+                (pEventNotificationList->pendingEventNotifyCount == 0))
+                return;
+
+            portAtomicDecrementU32(&pEventNotificationList->writerCount);
+        }
 
         portSyncSpinlockRelease(pEventNotificationList->pSpinlock);
 
         //
-        // Spin waiting for the pending notifications to drain.
-        // This can only be done in a preemptible context (i.e., add
+        // Spin waiting for the walker to finish and the pending notifications
+        // to drain. This can only be done in a preemptible context (i.e., add
         // or remove notification in a thread context).
         //
-        while (pEventNotificationList->pendingEventNotifyCount > 0)
+        while ((pEventNotificationList->notifyActive != 0) ||
+               (pEventNotificationList->pendingEventNotifyCount > 0))
             osSpinLoop();
     } while (NV_TRUE);
 }
@@ -201,6 +236,7 @@ static inline void _gpuEngineEventNotificationListUnlockPreemptible
     GpuEngineEventNotificationList *pEventNotificationList
 )
 {
+    portAtomicDecrementU32(&pEventNotificationList->writerCount);
     portSyncSpinlockRelease(pEventNotificationList->pSpinlock);
 }
 
@@ -278,19 +314,35 @@ static NV_STATUS _gpuEngineEventNotificationListNotify
         &pEventNotificationList->pendingEventNotifyList;
 
     //
-    // Acquire engine list spinlock before traversing the list. Note that this
-    // is called without holding locks from ISR for Linux. This spinlock is used
-    // to protect the per GPU per engine event node list.
+    // Claim the walker flag before traversing the list. Note that this is
+    // called without holding locks from ISR for Linux, so the spinlock is
+    // deliberately not taken here: claiming notifyActive and then waiting for
+    // writerCount to drop to zero excludes registration and teardown without
+    // serializing the high-rate delivery path against them. We don't expect
+    // this to be called multiple times in parallel, so a failed claim is an
+    // error, as is a non-empty pending list.
     //
-    portSyncSpinlockAcquire(pEventNotificationList->pSpinlock);
+    if (!portAtomicCompareAndSwapU32(&pEventNotificationList->notifyActive,
+                                     1, 0))
     {
-        // We don't expect this to be called multiple times in parallel
-        NV_ASSERT_OR_ELSE(pEventNotificationList->pendingEventNotifyCount == 0,
-        {
-            portSyncSpinlockRelease(pEventNotificationList->pSpinlock);
-            return NV_ERR_INVALID_STATE;
-        });
+        NV_ASSERT_FAILED("Parallel event notification walks are not expected");
+        return NV_ERR_INVALID_STATE;
+    }
 
+    //
+    // Wait out any writer that counted itself in before it could observe
+    // notifyActive; its critical section is just a list insert or remove.
+    //
+    while (pEventNotificationList->writerCount > 0)
+        osSpinLoop();
+
+    NV_ASSERT_OR_ELSE(pEventNotificationList->pendingEventNotifyCount == 0,
+    {
+        portAtomicSetU32(&pEventNotificationList->notifyActive, 0);
+        return NV_ERR_INVALID_STATE;
+    });
+
+    {
         EngineEventNotificationListIter it =
             listIterAll(&pEventNotificationList->eventNotificationList);
         while (listIterNext(&it))
@@ -355,10 +407,15 @@ static NV_STATUS _gpuEngineEventNotificationListNotify
             listAppendExisting(pPending, pEngineEventNotification);
         }
 
+        //
+        // Publish the pending count before giving up the walker flag so a
+        // writer never sees the list quiescent while nodes still sit on the
+        // pending list.
+        //
         portAtomicSetU32(&pEventNotificationList->pendingEventNotifyCount,
                          listCount(pPending));
     }
-    portSyncSpinlockRelease(pEventNotificationList->pSpinlock);
+    portAtomicSetU32(&pEventNotificationList->notifyActive, 0);
 
     //
     // Iterate through the pending notifications and call the OS to send them.
@@ -28,6 +28,118 @@
 #include "rmapi/control.h"
 #include "os/os.h"
 
+//
+// Pool of pre-pinned parameter buffers.
+//
+// Nearly every control call lands in rmapiParamsAcquire (directly or via the
+// embedded pointer copies), and the portMemAllocNonPaged/portMemFree pair is a
+// measurable fraction of small-control cost. Keep a small pool of page-sized
+// non-paged buffers that parameter copies of up to
+// RMAPI_PARAM_POOL_BUFFER_SIZE bytes reuse; larger copies and pool exhaustion
+// fall back to the regular allocation path.
+//
+#define RMAPI_PARAM_POOL_BUFFER_SIZE (4 * 1024)
+#define RMAPI_PARAM_POOL_NUM_BUFFERS 16
+
+static struct
+{
+    PORT_SPINLOCK *pLock;
+    void          *buffers[RMAPI_PARAM_POOL_NUM_BUFFERS];
+    NvU32          freeMask;
+} RmapiParamPool;
+
+void rmapiParamsPoolInit(void)
+{
+    NvU32 i;
+
+    RmapiParamPool.freeMask = 0;
+
+    // Best effort: the pool is an optimization, acquire falls back to
+    // portMemAllocNonPaged whenever it is unavailable.
+    RmapiParamPool.pLock = portSyncSpinlockCreate(portMemAllocatorGetGlobalNonPaged());
+    if (RmapiParamPool.pLock == NULL)
+        return;
+
+    for (i = 0; i < RMAPI_PARAM_POOL_NUM_BUFFERS; i++)
+    {
+        RmapiParamPool.buffers[i] = portMemAllocNonPaged(RMAPI_PARAM_POOL_BUFFER_SIZE);
+        if (RmapiParamPool.buffers[i] != NULL)
+            RmapiParamPool.freeMask |= NVBIT(i);
+    }
+}
+
+void rmapiParamsPoolDestroy(void)
+{
+    NvU32 i;
+
+    if (RmapiParamPool.pLock == NULL)
+        return;
+
+    for (i = 0; i < RMAPI_PARAM_POOL_NUM_BUFFERS; i++)
+    {
+        // All buffers must have been returned by now
+        NV_ASSERT((RmapiParamPool.buffers[i] == NULL) ||
+                  (RmapiParamPool.freeMask & NVBIT(i)));
+
+        portMemFree(RmapiParamPool.buffers[i]);
+        RmapiParamPool.buffers[i] = NULL;
+    }
+
+    RmapiParamPool.freeMask = 0;
+    portSyncSpinlockDestroy(RmapiParamPool.pLock);
+    RmapiParamPool.pLock = NULL;
+}
+
+static void *_rmapiParamPoolGet(NvU32 paramsSize)
+{
+    void *pBuffer = NULL;
+    NvU32 i;
+
+    if ((RmapiParamPool.pLock == NULL) ||
+        (paramsSize > RMAPI_PARAM_POOL_BUFFER_SIZE))
+    {
+        return NULL;
+    }
+
+    portSyncSpinlockAcquire(RmapiParamPool.pLock);
+    if (RmapiParamPool.freeMask != 0)
+    {
+        i = BIT_IDX_32(LOWESTBIT(RmapiParamPool.freeMask));
+        RmapiParamPool.freeMask &= ~NVBIT(i);
+        pBuffer = RmapiParamPool.buffers[i];
+    }
+    portSyncSpinlockRelease(RmapiParamPool.pLock);
+
+    return pBuffer;
+}
+
+//
+// Free a parameter buffer, returning it to the pool if it came from there.
+// The buffers[] array is immutable between init and destroy, so the
+// membership scan needs no lock.
+//
+static void _rmapiParamsFree(void *pKernelParams)
+{
+    NvU32 i;
+
+    if ((RmapiParamPool.pLock != NULL) && (pKernelParams != NULL))
+    {
+        for (i = 0; i < RMAPI_PARAM_POOL_NUM_BUFFERS; i++)
+        {
+            if (pKernelParams == RmapiParamPool.buffers[i])
+            {
+                portSyncSpinlockAcquire(RmapiParamPool.pLock);
+                NV_ASSERT((RmapiParamPool.freeMask & NVBIT(i)) == 0);
+                RmapiParamPool.freeMask |= NVBIT(i);
+                portSyncSpinlockRelease(RmapiParamPool.pLock);
+                return;
+            }
+        }
+    }
+
+    portMemFree(pKernelParams);
+}
+
 NV_STATUS rmapiParamsAcquire
 (
     RMAPI_PARAM_COPY  *pParamCopy,
@@ -93,7 +205,9 @@ NV_STATUS rmapiParamsAcquire
         }
     }
 
-    pKernelParams = portMemAllocNonPaged(pParamCopy->paramsSize);
+    pKernelParams = _rmapiParamPoolGet(pParamCopy->paramsSize);
+    if (pKernelParams == NULL)
+        pKernelParams = portMemAllocNonPaged(pParamCopy->paramsSize);
     if (pKernelParams == NULL)
     {
         rmStatus = NV_ERR_INSUFFICIENT_RESOURCES;
@@ -128,7 +242,7 @@ done:
     {
         if (pKernelParams != NULL)
         {
-            portMemFree(pKernelParams);
+            _rmapiParamsFree(pKernelParams);
             pKernelParams = NULL;
         }
     }
@@ -178,7 +292,7 @@ NV_STATUS rmapiParamsRelease
         }
     }
 
-    portMemFree(*pParamCopy->ppKernelParams);
+    _rmapiParamsFree(*pParamCopy->ppKernelParams);
 
 done:
     // no longer ok to use the ptr, even if it was a direct usage
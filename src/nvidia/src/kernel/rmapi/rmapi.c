@@ -24,6 +24,7 @@
 
 #include "nvrm_registry.h"
 #include "rmapi/rmapi.h"
+#include "rmapi/param_copy.h"
 #include "entry_points.h"
 #include "resserv/rs_server.h"
 #include "rmapi/rs_utils.h"
@@ -35,12 +36,13 @@
 #include "tls/tls.h"
 #include "core/thread_state.h"
 #include "gpu_mgr/gpu_mgr.h"
+#include "gpu/mem_mgr/mem_desc.h"
 #include "resource_desc.h"
 #include "ctrl/ctrl0000/ctrl0000system.h"
 
 typedef struct
 {
-    PORT_RWLOCK *       pLock;
+    PORT_READ_MOSTLY_RWLOCK *pLock;
     NvU64               threadId;
     NvU64               timestamp;
     LOCK_TRACE_INFO     traceInfo;
@@ -91,6 +93,9 @@ rmapiInitialize
         goto failed_free_lock;
     }
 
+    rmapiParamsPoolInit();
+    memdescPoolInit();
+
     RsResInfoInitialize();
     status = serverConstruct(&g_resServ, RS_PRIV_LEVEL_HOST, 0);
 
@@ -122,6 +127,8 @@ rmapiInitialize
     return NV_OK;
 
 failed_free_cache:
+        memdescPoolDestroy();
+        rmapiParamsPoolDestroy();
         rmapiControlCacheFree();
 failed_free_lock:
         _rmapiLockFree();
@@ -143,6 +150,8 @@ rmapiShutdown
     _rmapiLockFree();
 
     rmapiControlCacheFree();
+    rmapiParamsPoolDestroy();
+    memdescPoolDestroy();
 
     g_bResServInit = NV_FALSE;
 }
@@ -595,7 +604,7 @@ _rmapiLockAlloc(void)
 
     portMemSet(&g_RmApiLock, 0, sizeof(g_RmApiLock));
     g_RmApiLock.threadId = ~((NvU64)(0));
-    g_RmApiLock.pLock = portSyncRwLockCreate(portMemAllocatorGetGlobalNonPaged());
+    g_RmApiLock.pLock = portSyncExReadMostlyRwLockCreate(portMemAllocatorGetGlobalNonPaged());
     if (g_RmApiLock.pLock == NULL)
         return NV_ERR_INSUFFICIENT_RESOURCES;
 
@@ -607,7 +616,7 @@ _rmapiLockAlloc(void)
 static void
 _rmapiLockFree(void)
 {
-    portSyncRwLockDestroy(g_RmApiLock.pLock);
+    portSyncExReadMostlyRwLockDestroy(g_RmApiLock.pLock);
 }
 
 NV_STATUS
@@ -654,13 +663,13 @@ rmapiLockAcquire(NvU32 flags, NvU32 module)
     {
         if ((flags & RMAPI_LOCK_FLAGS_READ))
         {
-            if (!portSyncRwLockAcquireReadConditional(g_RmApiLock.pLock))
+            if (!portSyncExReadMostlyRwLockAcquireReadConditional(g_RmApiLock.pLock))
                 rmStatus = NV_ERR_TIMEOUT_RETRY;
         }
         else
         {
             // Conditional acquires don't care about contention or priority
-            if (portSyncRwLockAcquireWriteConditional(g_RmApiLock.pLock))
+            if (portSyncExReadMostlyRwLockAcquireWriteConditional(g_RmApiLock.pLock))
             {
                 g_RmApiLock.threadId = threadId;
             }
@@ -674,7 +683,7 @@ rmapiLockAcquire(NvU32 flags, NvU32 module)
     {
         if ((flags & RMAPI_LOCK_FLAGS_READ))
         {
-            portSyncRwLockAcquireRead(g_RmApiLock.pLock);
+            portSyncExReadMostlyRwLockAcquireRead(g_RmApiLock.pLock);
         }
         else
         {
@@ -683,18 +692,18 @@ rmapiLockAcquire(NvU32 flags, NvU32 module)
             {
                 NvS32 age = g_RmApiLock.lowPriorityAging;
 
-                portSyncRwLockAcquireWrite(g_RmApiLock.pLock);
+                portSyncExReadMostlyRwLockAcquireWrite(g_RmApiLock.pLock);
                 while ((g_RmApiLock.contentionCount > 0) && (age--))
                 {
-                    portSyncRwLockReleaseWrite(g_RmApiLock.pLock);
+                    portSyncExReadMostlyRwLockReleaseWrite(g_RmApiLock.pLock);
                     osDelay(10);
-                    portSyncRwLockAcquireWrite(g_RmApiLock.pLock);
+                    portSyncExReadMostlyRwLockAcquireWrite(g_RmApiLock.pLock);
                 }
             }
             else
             {
                 portAtomicIncrementU32(&g_RmApiLock.contentionCount);
-                portSyncRwLockAcquireWrite(g_RmApiLock.pLock);
+                portSyncExReadMostlyRwLockAcquireWrite(g_RmApiLock.pLock);
                 portAtomicDecrementU32(&g_RmApiLock.contentionCount);
             }
             g_RmApiLock.threadId = threadId;
@@ -793,7 +802,7 @@ rmapiLockRelease(void)
         if (pSys->getProperty(pSys, PDB_PROP_SYS_RM_LOCK_TIME_COLLECT))
             portAtomicExAddU64(&g_RmApiLock.totalRwHoldTime, timestamp - startTime);
 
-        portSyncRwLockReleaseWrite(g_RmApiLock.pLock);
+        portSyncExReadMostlyRwLockReleaseWrite(g_RmApiLock.pLock);
 
     }
     else
@@ -802,7 +811,7 @@ rmapiLockRelease(void)
         if (pSys->getProperty(pSys, PDB_PROP_SYS_RM_LOCK_TIME_COLLECT))
             portAtomicExAddU64(&g_RmApiLock.totalRoHoldTime, timestamp - startTime);
 
-        portSyncRwLockReleaseRead(g_RmApiLock.pLock);
+        portSyncExReadMostlyRwLockReleaseRead(g_RmApiLock.pLock);
     }
 
     tlsEntryRelease(g_RmApiLock.tlsEntryId);
@@ -34,6 +34,16 @@
 #include "ctrl/ctrl2080/ctrl2080gpu.h"
 #include "ctrl/ctrl2080/ctrl2080fifo.h"
 #include "ctrl/ctrl2080/ctrl2080bus.h"
+#include "class/cl00de.h"
+#include "gpu/gpu.h"
+#include "gpu/gpu_shared_data_map.h"
+#include "gpu_mgr/gpu_mgr.h"
+
+// The shared data mirror tables must be able to hold every mirrored control's info list
+ct_assert(NV2080_CTRL_GPU_INFO_MAX_LIST_SIZE <= RUSD_CTRL_CACHE_GET_INFO_MAX_LIST);
+ct_assert(NV2080_CTRL_FIFO_GET_INFO_MAX_ENTRIES <= RUSD_CTRL_CACHE_GET_INFO_MAX_LIST);
+ct_assert(NV2080_CTRL_BUS_INFO_MAX_LIST_SIZE <= RUSD_CTRL_CACHE_GET_INFO_MAX_LIST);
+ct_assert(NV2080_GPU_MAX_NAME_STRING_LENGTH == RUSD_CTRL_CACHE_GPU_NAME_LENGTH);
 
 typedef struct
 {
@@ -81,6 +91,7 @@ static struct {
     GpusControlCache gpusControlCache;
     ObjectToGpuInstMap objectToGpuInstMap;
     NvU32 mode;
+    NvBool bMirrorToSharedData;
     PORT_RWLOCK *pLock;
 } RmapiControlCache;
 
@@ -169,6 +180,14 @@ NV_STATUS rmapiControlCacheInit(void)
     }
     NV_PRINTF(LEVEL_INFO, "using cache mode %d\n", RmapiControlCache.mode);
 
+    RmapiControlCache.bMirrorToSharedData = NV_REG_STR_RM_CACHEABLE_CONTROLS_MIRROR_DEFAULT;
+
+    if (osReadRegistryDword(NULL, NV_REG_STR_RM_CACHEABLE_CONTROLS_MIRROR, &mode) == NV_OK)
+    {
+        RmapiControlCache.bMirrorToSharedData =
+            (mode == NV_REG_STR_RM_CACHEABLE_CONTROLS_MIRROR_ENABLE);
+    }
+
     multimapInit(&RmapiControlCache.gpusControlCache, portMemAllocatorGetGlobalNonPaged());
     mapInit(&RmapiControlCache.objectToGpuInstMap, portMemAllocatorGetGlobalNonPaged());
     RmapiControlCache.pLock = portSyncRwLockCreate(portMemAllocatorGetGlobalNonPaged());
@@ -578,6 +597,81 @@ typedef struct GetInfoCacheEntry {
     NvU32 data;
 } GetInfoCacheEntry;
 
+//
+// Mirror freshly cached results into the per-GPU user shared data mapping
+// (RUSD_CTRL_CACHE in cl00de.h) so userspace can satisfy repeated queries from
+// the mapping without a control call. Callers hold the cache lock exclusively,
+// which serializes writers of the mirror section; userspace readers are
+// protected by the RUSD seq brackets. Mirroring is best effort: if the GPU or
+// its shared data buffer is unavailable, the in-kernel cache alone serves hits.
+//
+static NV00DE_SHARED_DATA *
+_rmapiControlCacheMirrorWriteStart
+(
+    NvU32 gpuInst,
+    OBJGPU **ppGpu
+)
+{
+    OBJGPU *pGpu;
+
+    if (!RmapiControlCache.bMirrorToSharedData || gpuInst >= NV_MAX_DEVICES)
+        return NULL;
+
+    pGpu = gpumgrGetGpu(gpuInst);
+    if (pGpu == NULL || pGpu->userSharedData.pMemDesc == NULL)
+        return NULL;
+
+    *ppGpu = pGpu;
+    return gpushareddataWriteStart(pGpu);
+}
+
+static void
+_rmapiControlCacheMirrorInfoTable
+(
+    NvU32 gpuInst,
+    NvU32 cmd,
+    const GetInfoCacheEntry *pTable,
+    NvU32 listSizeLimit
+)
+{
+    OBJGPU *pGpu = NULL;
+    NV00DE_SHARED_DATA *pSharedData;
+    RUSD_CTRL_CACHE_INFO_TABLE *pMirror;
+    NvU32 tableIdx;
+    NvU32 i;
+
+    switch (cmd)
+    {
+        case NV2080_CTRL_CMD_GPU_GET_INFO_V2:
+            tableIdx = RUSD_CTRL_CACHE_TABLE_GPU_INFO;
+            break;
+        case NV2080_CTRL_CMD_FIFO_GET_INFO:
+            tableIdx = RUSD_CTRL_CACHE_TABLE_FIFO_INFO;
+            break;
+        case NV2080_CTRL_CMD_BUS_GET_INFO_V2:
+            tableIdx = RUSD_CTRL_CACHE_TABLE_BUS_INFO;
+            break;
+        default:
+            return;
+    }
+
+    pSharedData = _rmapiControlCacheMirrorWriteStart(gpuInst, &pGpu);
+    if (pSharedData == NULL)
+        return;
+
+    pMirror = &pSharedData->ctrlCache.infoTables[tableIdx];
+    pMirror->cmd = cmd;
+    pMirror->listSizeLimit = listSizeLimit;
+
+    for (i = 0; i < listSizeLimit; ++i)
+    {
+        pMirror->data[i] = pTable[i].data;
+        pMirror->valid[i] = pTable[i].valid ? 1 : 0;
+    }
+
+    gpushareddataWriteFinish(pGpu);
+}
+
 static NV_STATUS _getInfoCacheHandler
 (
     NvHandle hClient,
@@ -661,7 +755,11 @@ static NV_STATUS _getInfoCacheHandler
         }
     }
 
-    if (!bSet)
+    if (bSet)
+    {
+        _rmapiControlCacheMirrorInfoTable(gpuInst, cmd, cachedTable, listSizeLimit);
+    }
+    else
     {
         for (i = 0; i < listSize; ++i)
             pInfo[i].data = cachedTable[pInfo[i].index].data;
@@ -691,6 +789,32 @@ typedef struct GpuNameStringCacheEntry
     NvU16 unicode[NV2080_GPU_MAX_NAME_STRING_LENGTH];
 } GpuNameStringCacheEntry;
 
+static void
+_rmapiControlCacheMirrorGpuName
+(
+    NvU32 gpuInst,
+    const GpuNameStringCacheEntry *pEntry
+)
+{
+    OBJGPU *pGpu = NULL;
+    NV00DE_SHARED_DATA *pSharedData;
+    RUSD_CTRL_CACHE_GPU_NAME *pMirror;
+
+    pSharedData = _rmapiControlCacheMirrorWriteStart(gpuInst, &pGpu);
+    if (pSharedData == NULL)
+        return;
+
+    pMirror = &pSharedData->ctrlCache.gpuName;
+    portMemCopy(pMirror->ascii, sizeof(pMirror->ascii),
+                pEntry->ascii, sizeof(pEntry->ascii));
+    portMemCopy(pMirror->unicode, sizeof(pMirror->unicode),
+                pEntry->unicode, sizeof(pEntry->unicode));
+    pMirror->bAsciiValid = pEntry->bAsciiValid ? 1 : 0;
+    pMirror->bUnicodeValid = pEntry->bUnicodeValid ? 1 : 0;
+
+    gpushareddataWriteFinish(pGpu);
+}
+
 NV_STATUS _gpuNameStringGet
 (
     NvHandle hClient,
@@ -841,6 +965,8 @@ NV_STATUS _gpuNameStringSet
             goto done;
     }
 
+    _rmapiControlCacheMirrorGpuName(gpuInst, cachedParams);
+
 done:
     if (status != NV_OK)
     {
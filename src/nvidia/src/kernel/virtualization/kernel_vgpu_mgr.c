@@ -637,6 +637,11 @@ kvgpumgrDetachGpu(NvU32 gpuPciId)
     pPhysGpuInfo->isAttached = NV_FALSE;
     pPhysGpuInfo->numCreatedVgpu = 0;
 
+    // Drop cached GSP query results; a later attach must re-query.
+    pPhysGpuInfo->bMigrationSupportCached = NV_FALSE;
+    pPhysGpuInfo->bMigrationSupported = NV_FALSE;
+    pPhysGpuInfo->fsEncodingSize = 0;
+
     for (i = 0; i < MAX_VGPU_TYPES_PER_PGPU; i++)
         pPhysGpuInfo->supportedTypeIds[i] = NVA081_CTRL_VGPU_CONFIG_INVALID_TYPE;
 
@@ -1337,9 +1342,24 @@ NvBool
 kvgpumgrCheckPgpuMigrationSupport(OBJGPU *pGpu)
 {
     RM_API *pRmApi = GPU_GET_PHYSICAL_RMAPI(pGpu);
+    OBJSYS *pSys = SYS_GET_INSTANCE();
+    KernelVgpuMgr *pKernelVgpuMgr = SYS_GET_KERNEL_VGPUMGR(pSys);
     NV2080_CTRL_VGPU_MGR_INTERNAL_GET_PGPU_MIGRATION_SUPPORT_PARAMS params = {0};
+    KERNEL_PHYS_GPU_INFO *pPgpuInfo = NULL;
+    NvU32 index;
     NV_STATUS status;
 
+    //
+    // Migration support is constant while the GPU is attached; answer
+    // repeated queries from the cache instead of a GSP RPC per call.
+    //
+    if (kvgpumgrGetPgpuIndex(pKernelVgpuMgr, pGpu->gpuId, &index) == NV_OK)
+    {
+        pPgpuInfo = &(pKernelVgpuMgr->pgpuInfo[index]);
+        if (pPgpuInfo->bMigrationSupportCached)
+            return pPgpuInfo->bMigrationSupported;
+    }
+
     NV_CHECK_OK_OR_ELSE(status,
                         LEVEL_ERROR,
                         pRmApi->Control(pRmApi, pGpu->hInternalClient, pGpu->hInternalSubdevice,
@@ -1347,6 +1367,12 @@ kvgpumgrCheckPgpuMigrationSupport(OBJGPU *pGpu)
                                         &params, sizeof(params)),
                         return NV_FALSE);
 
+    if (pPgpuInfo != NULL)
+    {
+        pPgpuInfo->bMigrationSupported = params.bIsMigrationSupported;
+        pPgpuInfo->bMigrationSupportCached = NV_TRUE;
+    }
+
     return params.bIsMigrationSupported;
 }
 
@@ -1428,9 +1454,30 @@ NvU32 kvgpumgrGetPgpuFSEncoding(OBJGPU *pGpu, NvU8 *pgpuString,
                                 NvU32 strSize)
 {
     RM_API *pRmApi = GPU_GET_PHYSICAL_RMAPI(pGpu);
+    OBJSYS *pSys = SYS_GET_INSTANCE();
+    KernelVgpuMgr *pKernelVgpuMgr = SYS_GET_KERNEL_VGPUMGR(pSys);
     NV2080_CTRL_VGPU_MGR_INTERNAL_GET_PGPU_FS_ENCODING_PARAMS params = {0};
+    KERNEL_PHYS_GPU_INFO *pPgpuInfo = NULL;
+    NvU32 index;
     NV_STATUS status;
 
+    //
+    // The floorsweeping configuration is fixed for the life of the attach;
+    // serve repeated encoding requests from the cache instead of a GSP RPC
+    // per call.
+    //
+    if (kvgpumgrGetPgpuIndex(pKernelVgpuMgr, pGpu->gpuId, &index) == NV_OK)
+    {
+        pPgpuInfo = &(pKernelVgpuMgr->pgpuInfo[index]);
+        if ((pPgpuInfo->fsEncodingSize != 0) &&
+            (pPgpuInfo->fsEncodingSize <= strSize))
+        {
+            portMemCopy(pgpuString, strSize, pPgpuInfo->fsEncoding,
+                        pPgpuInfo->fsEncodingSize);
+            return pPgpuInfo->fsEncodingSize;
+        }
+    }
+
     params.pgpuStringSize = strSize;
 
     NV_CHECK_OK_OR_ELSE(status,
@@ -1442,6 +1489,14 @@ NvU32 kvgpumgrGetPgpuFSEncoding(OBJGPU *pGpu, NvU8 *pgpuString,
 
     portMemCopy(pgpuString, strSize, params.pgpuString, params.pgpuStringSize);
 
+    if ((pPgpuInfo != NULL) &&
+        (params.pgpuStringSize <= sizeof(pPgpuInfo->fsEncoding)))
+    {
+        portMemCopy(pPgpuInfo->fsEncoding, sizeof(pPgpuInfo->fsEncoding),
+                    params.pgpuString, params.pgpuStringSize);
+        pPgpuInfo->fsEncodingSize = params.pgpuStringSize;
+    }
+
     return params.pgpuStringSize;
 }
 
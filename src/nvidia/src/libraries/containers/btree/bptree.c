@@ -0,0 +1,623 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+
+/*************************** High-fanout B+ tree ***************************\
+*                                                                           *
+*   A B+ tree over the caller-embedded NODE from btree.h. Client nodes     *
+*   hold the key ranges and data as before; the library allocates index     *
+*   nodes with BPTREE_WIDTH entries each, searched linearly, so a lookup    *
+*   costs log_WIDTH(n) node visits instead of log_2(n) pointer chases.      *
+*                                                                           *
+*   Invariants:                                                             *
+*    - keys[i] is the minimum keyStart stored below children[i], and        *
+*      children are in ascending key order.                                 *
+*    - Client key ranges never overlap (insert rejects duplicates).         *
+*    - The client NODEs' private left/right links form the ordered leaf     *
+*      chain; enumeration walks it without touching index nodes.            *
+*                                                                           *
+*   Deletion is lazy: emptied index nodes are freed and single-child        *
+*   roots collapsed, but underfull nodes are not merged. Tree height is     *
+*   only ever established by insert-time splits, which produce nodes with   *
+*   at least BPTREE_WIDTH/2 entries, so lookups stay shallow.               *
+*                                                                           *
+\***************************************************************************/
+
+#include "utils/nvassert.h"
+#include "nvport/nvport.h"
+#include "containers/bptree.h"
+
+//
+// Splits create nodes with at least 3 entries, so the height of any tree
+// built through this interface is comfortably below this bound.
+//
+#define BPTREE_MAX_DEPTH 64
+
+static BPTREE_NODE *
+_bptreeNodeAlloc
+(
+    NvU32 level
+)
+{
+    BPTREE_NODE *pIdx = portMemAllocNonPaged(sizeof(*pIdx));
+
+    if (pIdx != NULL)
+    {
+        portMemSet(pIdx, 0, sizeof(*pIdx));
+        pIdx->level = level;
+    }
+    return pIdx;
+}
+
+//
+// Index of the child whose key range contains key: the last child whose
+// minimum key does not exceed it, or child 0 when key sorts below all of
+// them. Linear scan; the node fits in two cache lines.
+//
+static NvU32
+_bptreeChildIndex
+(
+    const BPTREE_NODE *pIdx,
+    NvU64              key
+)
+{
+    NvU32 i = 0;
+
+    while (((i + 1) < pIdx->count) && (pIdx->keys[i + 1] <= key))
+    {
+        i++;
+    }
+    return i;
+}
+
+static BPTREE_NODE *
+_bptreeDescendToLeaf
+(
+    BPTREE_NODE *pIdx,
+    NvU64        key
+)
+{
+    while (pIdx->level > 0)
+    {
+        pIdx = pIdx->children[_bptreeChildIndex(pIdx, key)];
+    }
+    return pIdx;
+}
+
+//
+// Client node with the largest keyStart not exceeding key, or NULL when
+// key sorts below every entry.
+//
+static PNODE
+_bptreeFindFloor
+(
+    BPTREE *pTree,
+    NvU64   key
+)
+{
+    BPTREE_NODE *pLeaf;
+    NvU32        pos;
+
+    if (pTree->pRoot == NULL)
+    {
+        return NULL;
+    }
+
+    pLeaf = _bptreeDescendToLeaf(pTree->pRoot, key);
+    if (key < pLeaf->keys[0])
+    {
+        return NULL;
+    }
+
+    pos = 0;
+    while (((pos + 1) < pLeaf->count) && (pLeaf->keys[pos + 1] <= key))
+    {
+        pos++;
+    }
+    return pLeaf->children[pos];
+}
+
+static PNODE
+_bptreeLeftmost
+(
+    BPTREE *pTree
+)
+{
+    BPTREE_NODE *pIdx = pTree->pRoot;
+
+    if (pIdx == NULL)
+    {
+        return NULL;
+    }
+    while (pIdx->level > 0)
+    {
+        pIdx = pIdx->children[0];
+    }
+    return pIdx->children[0];
+}
+
+//
+// Split the full child at childIdx into two; the new right sibling takes
+// the upper entries and is linked into the (non-full) parent.
+//
+static NV_STATUS
+_bptreeSplitChild
+(
+    BPTREE_NODE *pParent,
+    NvU32        childIdx
+)
+{
+    BPTREE_NODE *pChild = pParent->children[childIdx];
+    BPTREE_NODE *pNew;
+    NvU32        keep = BPTREE_WIDTH - (BPTREE_WIDTH / 2);
+    NvU32        move = BPTREE_WIDTH / 2;
+    NvU32        i;
+
+    NV_ASSERT(pParent->count < BPTREE_WIDTH);
+    NV_ASSERT(pChild->count == BPTREE_WIDTH);
+
+    pNew = _bptreeNodeAlloc(pChild->level);
+    if (pNew == NULL)
+    {
+        return NV_ERR_NO_MEMORY;
+    }
+
+    for (i = 0; i < move; i++)
+    {
+        pNew->keys[i] = pChild->keys[keep + i];
+        pNew->children[i] = pChild->children[keep + i];
+    }
+    pNew->count = move;
+    pChild->count = keep;
+
+    for (i = pParent->count; i > (childIdx + 1); i--)
+    {
+        pParent->keys[i] = pParent->keys[i - 1];
+        pParent->children[i] = pParent->children[i - 1];
+    }
+    pParent->keys[childIdx + 1] = pNew->keys[0];
+    pParent->children[childIdx + 1] = pNew;
+    pParent->count++;
+
+    return NV_OK;
+}
+
+void
+bptreeInit
+(
+    BPTREE *pTree
+)
+{
+    pTree->pRoot = NULL;
+}
+
+// insert a new node (no duplicates allowed)
+NV_STATUS
+bptreeInsert
+(
+    PNODE   pNode,
+    BPTREE *pTree
+)
+{
+    BPTREE_NODE *pIdx;
+    PNODE        pPred;
+    PNODE        pSucc;
+    NvU64        key;
+    NvU32        pos;
+    NvU32        i;
+
+    if (pNode == NULL || pTree == NULL)
+    {
+        return NV_ERR_INVALID_POINTER;
+    }
+    if (pNode->keyEnd < pNode->keyStart)
+    {
+        return NV_ERR_INVALID_ARGUMENT;
+    }
+
+    key = pNode->keyStart;
+
+    // reject overlapping ranges before modifying anything
+    pPred = _bptreeFindFloor(pTree, key);
+    if (pPred != NULL)
+    {
+        if (pPred->keyEnd >= key)
+        {
+            return NV_ERR_INSERT_DUPLICATE_NAME;
+        }
+        pSucc = pPred->right;
+    }
+    else
+    {
+        pSucc = _bptreeLeftmost(pTree);
+    }
+    if ((pSucc != NULL) && (pSucc->keyStart <= pNode->keyEnd))
+    {
+        return NV_ERR_INSERT_DUPLICATE_NAME;
+    }
+
+    pNode->parent = NULL;
+    pNode->isRed = NV_FALSE;
+
+    if (pTree->pRoot == NULL)
+    {
+        pIdx = _bptreeNodeAlloc(0);
+        if (pIdx == NULL)
+        {
+            return NV_ERR_NO_MEMORY;
+        }
+        pIdx->count = 1;
+        pIdx->keys[0] = key;
+        pIdx->children[0] = pNode;
+        pNode->left = NULL;
+        pNode->right = NULL;
+        pTree->pRoot = pIdx;
+        return NV_OK;
+    }
+
+    // grow the tree when the root is full
+    if (pTree->pRoot->count == BPTREE_WIDTH)
+    {
+        BPTREE_NODE *pNewRoot = _bptreeNodeAlloc(pTree->pRoot->level + 1);
+
+        if (pNewRoot == NULL)
+        {
+            return NV_ERR_NO_MEMORY;
+        }
+        pNewRoot->count = 1;
+        pNewRoot->keys[0] = pTree->pRoot->keys[0];
+        pNewRoot->children[0] = pTree->pRoot;
+
+        if (_bptreeSplitChild(pNewRoot, 0) != NV_OK)
+        {
+            portMemFree(pNewRoot);
+            return NV_ERR_NO_MEMORY;
+        }
+        pTree->pRoot = pNewRoot;
+    }
+
+    //
+    // Preemptive splitting: any full child is split before descending into
+    // it, so the parent always has room and an allocation failure leaves
+    // the tree consistent with the new entry simply not inserted.
+    //
+    pIdx = pTree->pRoot;
+    for (;;)
+    {
+        if (pIdx->level == 0)
+        {
+            break;
+        }
+
+        // a key below the current minimum always descends through child 0
+        if (key < pIdx->keys[0])
+        {
+            pIdx->keys[0] = key;
+        }
+
+        i = _bptreeChildIndex(pIdx, key);
+        if (((BPTREE_NODE *)pIdx->children[i])->count == BPTREE_WIDTH)
+        {
+            NV_STATUS status = _bptreeSplitChild(pIdx, i);
+
+            if (status != NV_OK)
+            {
+                return status;
+            }
+            if (key >= pIdx->keys[i + 1])
+            {
+                i++;
+            }
+        }
+        pIdx = pIdx->children[i];
+    }
+
+    pos = 0;
+    while ((pos < pIdx->count) && (pIdx->keys[pos] < key))
+    {
+        pos++;
+    }
+
+    // splice into the ordered leaf chain
+    if (pos > 0)
+    {
+        pPred = pIdx->children[pos - 1];
+        pSucc = pPred->right;
+    }
+    else
+    {
+        pSucc = pIdx->children[0];
+        pPred = pSucc->left;
+    }
+    pNode->left = pPred;
+    pNode->right = pSucc;
+    if (pPred != NULL)
+    {
+        pPred->right = pNode;
+    }
+    if (pSucc != NULL)
+    {
+        pSucc->left = pNode;
+    }
+
+    for (i = pIdx->count; i > pos; i--)
+    {
+        pIdx->keys[i] = pIdx->keys[i - 1];
+        pIdx->children[i] = pIdx->children[i - 1];
+    }
+    pIdx->keys[pos] = key;
+    pIdx->children[pos] = pNode;
+    pIdx->count++;
+
+    return NV_OK;
+}
+
+//
+// Unlink node from tree
+//
+NV_STATUS
+bptreeUnlink
+(
+    PNODE   pNode,
+    BPTREE *pTree
+)
+{
+    struct
+    {
+        BPTREE_NODE *pIdx;
+        NvU32        childIdx;
+    } path[BPTREE_MAX_DEPTH];
+    BPTREE_NODE *pIdx;
+    NvU32        depth = 0;
+    NvU32        pos;
+    NvU32        i;
+
+    if (pNode == NULL || pTree == NULL)
+    {
+        return NV_ERR_INVALID_POINTER;
+    }
+    if (pTree->pRoot == NULL)
+    {
+        return NV_ERR_OBJECT_NOT_FOUND;
+    }
+
+    pIdx = pTree->pRoot;
+    while (pIdx->level > 0)
+    {
+        NvU32 ci = _bptreeChildIndex(pIdx, pNode->keyStart);
+
+        NV_ASSERT_OR_RETURN(depth < BPTREE_MAX_DEPTH, NV_ERR_INVALID_STATE);
+        path[depth].pIdx = pIdx;
+        path[depth].childIdx = ci;
+        depth++;
+        pIdx = pIdx->children[ci];
+    }
+
+    for (pos = 0; pos < pIdx->count; pos++)
+    {
+        if (pIdx->children[pos] == pNode)
+        {
+            break;
+        }
+    }
+    if (pos == pIdx->count)
+    {
+        return NV_ERR_OBJECT_NOT_FOUND;
+    }
+
+    // unlink from the ordered leaf chain
+    if (pNode->left != NULL)
+    {
+        pNode->left->right = pNode->right;
+    }
+    if (pNode->right != NULL)
+    {
+        pNode->right->left = pNode->left;
+    }
+    pNode->left = NULL;
+    pNode->right = NULL;
+
+    for (i = pos; (i + 1) < pIdx->count; i++)
+    {
+        pIdx->keys[i] = pIdx->keys[i + 1];
+        pIdx->children[i] = pIdx->children[i + 1];
+    }
+    pIdx->count--;
+
+    //
+    // Walk back up: free nodes that became empty, and refresh the minimum
+    // key recorded for surviving ones.
+    //
+    while (depth > 0)
+    {
+        BPTREE_NODE *pParent = path[depth - 1].pIdx;
+        NvU32        ci = path[depth - 1].childIdx;
+
+        depth--;
+        if (pIdx->count == 0)
+        {
+            portMemFree(pIdx);
+            for (i = ci; (i + 1) < pParent->count; i++)
+            {
+                pParent->keys[i] = pParent->keys[i + 1];
+                pParent->children[i] = pParent->children[i + 1];
+            }
+            pParent->count--;
+        }
+        else
+        {
+            pParent->keys[ci] = pIdx->keys[0];
+        }
+        pIdx = pParent;
+    }
+
+    if (pIdx->count == 0)
+    {
+        portMemFree(pIdx);
+        pTree->pRoot = NULL;
+    }
+    else
+    {
+        // collapse single-child root levels left behind by deletions
+        while ((pIdx->level > 0) && (pIdx->count == 1))
+        {
+            pTree->pRoot = pIdx->children[0];
+            portMemFree(pIdx);
+            pIdx = pTree->pRoot;
+        }
+    }
+
+    return NV_OK;
+}
+
+//
+// Search for node in tree.
+//
+NV_STATUS
+bptreeSearch
+(
+    NvU64   keyOffset,
+    PNODE  *ppNode,
+    BPTREE *pTree
+)
+{
+    PNODE pFound;
+
+    if (ppNode == NULL || pTree == NULL)
+    {
+        return NV_ERR_INVALID_POINTER;
+    }
+
+    pFound = _bptreeFindFloor(pTree, keyOffset);
+    if ((pFound != NULL) && (keyOffset <= pFound->keyEnd))
+    {
+        *ppNode = pFound;
+        return NV_OK;
+    }
+    *ppNode = NULL;
+    return NV_ERR_OBJECT_NOT_FOUND;
+}
+
+//
+// Enumerate tree (starting at the node with specified value)
+//
+NV_STATUS
+bptreeEnumStart
+(
+    NvU64   keyOffset,
+    PNODE  *ppNode,
+    BPTREE *pTree
+)
+{
+    PNODE pFloor;
+
+    if (ppNode == NULL || pTree == NULL)
+    {
+        return NV_ERR_INVALID_POINTER;
+    }
+
+    *ppNode = NULL;
+    if (pTree->pRoot == NULL)
+    {
+        return NV_OK;
+    }
+
+    pFloor = _bptreeFindFloor(pTree, keyOffset);
+    if (pFloor == NULL)
+    {
+        *ppNode = _bptreeLeftmost(pTree);
+    }
+    else if (keyOffset <= pFloor->keyEnd)
+    {
+        *ppNode = pFloor;
+    }
+    else
+    {
+        *ppNode = pFloor->right;
+    }
+    return NV_OK;
+}
+
+NV_STATUS
+bptreeEnumNext
+(
+    PNODE  *ppNode,
+    BPTREE *pTree
+)
+{
+    if (ppNode == NULL || pTree == NULL)
+    {
+        return NV_ERR_INVALID_POINTER;
+    }
+
+    // the leaf chain makes the in-order successor a single link away
+    if ((pTree->pRoot != NULL) && (*ppNode != NULL))
+    {
+        *ppNode = (*ppNode)->right;
+    }
+    else
+    {
+        *ppNode = NULL;
+    }
+    return NV_OK;
+}
+
+static void
+_bptreeFreeBranch
+(
+    BPTREE_NODE *pIdx
+)
+{
+    NvU32 i;
+
+    if (pIdx->level > 0)
+    {
+        for (i = 0; i < pIdx->count; i++)
+        {
+            _bptreeFreeBranch(pIdx->children[i]);
+        }
+    }
+    portMemFree(pIdx);
+}
+
+//
+// Frees all index nodes. Client NODEs are caller-owned and are not touched;
+// their leaf chain links are stale afterwards.
+//
+NV_STATUS
+bptreeDestroy
+(
+    BPTREE *pTree
+)
+{
+    if (pTree == NULL)
+    {
+        return NV_ERR_INVALID_POINTER;
+    }
+    if (pTree->pRoot != NULL)
+    {
+        _bptreeFreeBranch(pTree->pRoot);
+        pTree->pRoot = NULL;
+    }
+    return NV_OK;
+}
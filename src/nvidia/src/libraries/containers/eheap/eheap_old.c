@@ -50,7 +50,12 @@ static NV_STATUS  _eheapBlockFree(OBJEHEAP *pHeap, EMEMBLOCK *block);
 static NvU32      eheapGetNumBlocks(OBJEHEAP *);
 static NV_STATUS  eheapGetBlockInfo(OBJEHEAP *, NvU32, NVOS32_HEAP_DUMP_BLOCK *);
 static NV_STATUS  eheapSetOwnerIsolation(OBJEHEAP *, NvBool, NvU32);
+static NV_STATUS  eheapGetOccupancyHistogram(OBJEHEAP *, EHEAP_OCCUPANCY_HISTOGRAM *);
 static NvBool     _eheapCheckOwnership(OBJEHEAP *, void*, NvU64, NvU64, EMEMBLOCK *, EHeapOwnershipComparator*);
+static NvU32      _eheapSizeClass(NvU64);
+static void       _eheapFreeBlockClassListInsert(OBJEHEAP *, EMEMBLOCK *);
+static void       _eheapFreeBlockClassListRemove(OBJEHEAP *, EMEMBLOCK *);
+static EMEMBLOCK *_eheapFindFreeBlockBySizeClass(OBJEHEAP *, NvU64, NvU64, NvU64 *, NvU64 *, NvU64 *);
 
 void
 constructObjEHeap(OBJEHEAP *pHeap, NvU64 Base, NvU64 LimitPlusOne, NvU32 sizeofMemBlock, NvU32 numPreAllocMemStruct)
@@ -77,6 +82,145 @@ initPublicObjectFunctionPointers_EHeap(OBJEHEAP *pHeap)
     pHeap->eheapGetNumBlocks          = eheapGetNumBlocks;
     pHeap->eheapGetBlockInfo          = eheapGetBlockInfo;
     pHeap->eheapSetOwnerIsolation     = eheapSetOwnerIsolation;
+    pHeap->eheapGetOccupancyHistogram = eheapGetOccupancyHistogram;
+}
+
+/*!
+ * @brief returns the size class of a block size.
+ *
+ * Class i holds blocks of size [2^i, 2^(i+1)), i.e. the index of the
+ * highest set bit.  A size of zero only occurs for a block spanning the
+ * entire 64-bit extent space and maps to the top class.
+ *
+ * @param[in] size: block size in bytes
+ *
+ * @returns the size class index, [0, EHEAP_NUM_SIZE_CLASSES)
+ */
+static NvU32
+_eheapSizeClass
+(
+    NvU64 size
+)
+{
+    NvU32 sizeClass = 0;
+
+    if (size == 0)
+        return EHEAP_NUM_SIZE_CLASSES - 1;
+
+    while (size >>= 1)
+        sizeClass++;
+
+    return sizeClass;
+}
+
+//
+// Link a free block onto the list for its size class.  Must be called
+// after the block's final begin/end are set, and the block must be taken
+// off its class list (below) before begin/end are changed.
+//
+static void
+_eheapFreeBlockClassListInsert
+(
+    OBJEHEAP  *pHeap,
+    EMEMBLOCK *block
+)
+{
+    NvU32 sizeClass = _eheapSizeClass(block->end - block->begin + 1);
+
+    block->prevFreeClass = NULL;
+    block->nextFreeClass = pHeap->pFreeBlockListByClass[sizeClass];
+    if (block->nextFreeClass != NULL)
+        block->nextFreeClass->prevFreeClass = block;
+    pHeap->pFreeBlockListByClass[sizeClass] = block;
+}
+
+static void
+_eheapFreeBlockClassListRemove
+(
+    OBJEHEAP  *pHeap,
+    EMEMBLOCK *block
+)
+{
+    NvU32 sizeClass = _eheapSizeClass(block->end - block->begin + 1);
+
+    if (block->prevFreeClass != NULL)
+        block->prevFreeClass->nextFreeClass = block->nextFreeClass;
+    else
+        pHeap->pFreeBlockListByClass[sizeClass] = block->nextFreeClass;
+    if (block->nextFreeClass != NULL)
+        block->nextFreeClass->prevFreeClass = block->prevFreeClass;
+
+    block->prevFreeClass = NULL;
+    block->nextFreeClass = NULL;
+}
+
+/*!
+ * @brief finds a free block for an unconstrained allocation.
+ *
+ * Starts at the smallest size class that can contain the request and
+ * takes the smallest fitting block from the first class with a fit, so
+ * the common case (a class with ready-made blocks) is satisfied without
+ * walking the address-ordered free list.
+ *
+ * @param[in]  pHeap: pointer to eHeap struct to allocate from
+ * @param[in]  allocSize: size of the request, already size-aligned
+ * @param[in]  offsetAlign: required alignment of the returned offset
+ * @param[out] pAllocLo, pAllocAl, pAllocHi: chosen extent, valid only on
+ *             a non-NULL return
+ *
+ * @returns the chosen free block, or NULL if no free block fits
+ */
+static EMEMBLOCK *
+_eheapFindFreeBlockBySizeClass
+(
+    OBJEHEAP *pHeap,
+    NvU64     allocSize,
+    NvU64     offsetAlign,
+    NvU64    *pAllocLo,
+    NvU64    *pAllocAl,
+    NvU64    *pAllocHi
+)
+{
+    NvU32 sizeClass;
+
+    for (sizeClass = _eheapSizeClass(allocSize);
+         sizeClass < EHEAP_NUM_SIZE_CLASSES;
+         sizeClass++)
+    {
+        EMEMBLOCK *block = pHeap->pFreeBlockListByClass[sizeClass];
+        EMEMBLOCK *blockBest = NULL;
+        NvU64      allocAlBest = 0;
+
+        for (; block != NULL; block = block->nextFreeClass)
+        {
+            //
+            // Allocate from the bottom of the block; alignment padding
+            // can make a block too small even within a fitting class.
+            //
+            NvU64 allocAl = ((block->begin + (offsetAlign - 1)) / offsetAlign) * offsetAlign;
+            NvU64 allocHi = allocAl + allocSize - 1;
+
+            if ((allocHi < allocAl) || (allocAl < block->begin) || (allocHi > block->end))
+                continue;
+
+            if ((blockBest == NULL) ||
+                ((block->end - block->begin) < (blockBest->end - blockBest->begin)))
+            {
+                blockBest = block;
+                allocAlBest = allocAl;
+            }
+        }
+
+        if (blockBest != NULL)
+        {
+            *pAllocAl = allocAlBest;
+            *pAllocLo = allocAlBest;
+            *pAllocHi = allocAlBest + allocSize - 1;
+            return blockBest;
+        }
+    }
+
+    return NULL;
 }
 
 static NV_STATUS
@@ -170,6 +314,7 @@ eheapInit
     pHeap->pPreAllocAddr        = NULL;
     pHeap->pBlockList           = NULL;
     pHeap->pFreeBlockList       = NULL;
+    portMemSet(pHeap->pFreeBlockListByClass, 0, sizeof(pHeap->pFreeBlockListByClass));
     pHeap->pFreeMemStructList   = NULL;
     pHeap->numBlocks            = 0;
     pHeap->pBlockTree           = NULL;
@@ -226,6 +371,7 @@ eheapInit
     pHeap->pBlockList     = block;
     pHeap->pFreeBlockList = block;
     pHeap->numBlocks      = 1;
+    _eheapFreeBlockClassListInsert(pHeap, block);
 
     portMemSet((void *)&block->node, 0, sizeof(NODE));
     block->node.keyStart = block->begin;
@@ -472,6 +618,23 @@ eheapAlloc
         goto failed;
     }
 
+    //
+    // Unconstrained requests are satisfied from the segregated free lists.
+    // Directional, range-limited and owner-isolated requests keep the
+    // address-ordered walk below, which their placement rules depend on.
+    //
+    if (!(*flags & NVOS32_ALLOC_FLAGS_FORCE_MEM_GROWS_DOWN) &&
+        !pHeap->bOwnerIsolation &&
+        (rangeLo == pHeap->base) &&
+        (rangeHi == pHeap->base + pHeap->total - 1))
+    {
+        blockFree = _eheapFindFreeBlockBySizeClass(pHeap, allocSize, offsetAlign,
+                                                   &allocLo, &allocAl, &allocHi);
+        if (blockFree == NULL)
+            goto failed;
+        goto got_one;
+    }
+
     blockFirstFree = pHeap->pFreeBlockList;
     if (!blockFirstFree)
         goto failed;
@@ -624,6 +787,7 @@ next_free:
         // Wow, exact match so replace free block.
         // Remove from free list.
         //
+        _eheapFreeBlockClassListRemove(pHeap, blockFree);
         blockFree->nextFree->prevFree = blockFree->prevFree;
         blockFree->prevFree->nextFree = blockFree->nextFree;
         if (pHeap->pFreeBlockList == blockFree)
@@ -689,7 +853,11 @@ next_free:
             blockSplit->align = blockSplit->begin;
             blockSplit->end   = blockFree->end;
             blockSplit->pData = (void*)(blockNew+1);
+            // both remaining free pieces change size class
+            _eheapFreeBlockClassListRemove(pHeap, blockFree);
             blockFree->end    = blockNew->begin - 1;
+            _eheapFreeBlockClassListInsert(pHeap, blockFree);
+            _eheapFreeBlockClassListInsert(pHeap, blockSplit);
             //
             // Insert free split block into free list.
             //
@@ -749,7 +917,9 @@ next_free:
             //
             // New block inserted after free block.
             //
+            _eheapFreeBlockClassListRemove(pHeap, blockFree);
             blockFree->end = blockNew->begin - 1;
+            _eheapFreeBlockClassListInsert(pHeap, blockFree);
             blockNew->next = blockFree->next;
             blockNew->prev = blockFree;
             blockFree->next->prev = blockNew;
@@ -786,8 +956,10 @@ next_free:
             //
             // New block inserted before free block.
             //
+            _eheapFreeBlockClassListRemove(pHeap, blockFree);
             blockFree->begin = blockNew->end + 1;
             blockFree->align = blockFree->begin;
+            _eheapFreeBlockClassListInsert(pHeap, blockFree);
             blockNew->next   = blockFree;
             blockNew->prev   = blockFree->prev;
             blockFree->prev->next = blockNew;
@@ -886,9 +1058,11 @@ _eheapBlockFree
         //
         block->prev->next = block->next;
         block->next->prev = block->prev;
+        _eheapFreeBlockClassListRemove(pHeap, block->prev);
         block->prev->end  = block->end;
         blockTmp = block;
         block    = block->prev;
+        _eheapFreeBlockClassListInsert(pHeap, block);
         pHeap->numBlocks--;
         _eheapFreeMemStruct(pHeap, &blockTmp);
 
@@ -919,6 +1093,7 @@ _eheapBlockFree
         //
         block->prev->next    = block->next;
         block->next->prev    = block->prev;
+        _eheapFreeBlockClassListRemove(pHeap, block->next);
         block->next->begin   = block->begin;
         if (pHeap->pBlockList == block)
             pHeap->pBlockList  = block->next;
@@ -928,9 +1103,11 @@ _eheapBlockFree
                 pHeap->pFreeBlockList  = block->nextFree;
             block->nextFree->prevFree = block->prevFree;
             block->prevFree->nextFree = block->nextFree;
+            _eheapFreeBlockClassListRemove(pHeap, block);
         }
         blockTmp = block;
         block    = block->next;
+        _eheapFreeBlockClassListInsert(pHeap, block);
         pHeap->numBlocks--;
         _eheapFreeMemStruct(pHeap, &blockTmp);
 
@@ -946,6 +1123,7 @@ _eheapBlockFree
         //
         // Nothing was merged.  Add to free list.
         //
+        _eheapFreeBlockClassListInsert(pHeap, block);
         blockTmp = pHeap->pFreeBlockList;
         if (!blockTmp)
         {
@@ -1360,6 +1538,58 @@ eheapSetOwnerIsolation
     return NV_OK;
 }
 
+/*!
+ * @brief Bins every block in the heap by size class.
+ *
+ * Class i covers blocks of size [2^i, 2^(i+1)).  Free and allocated
+ * blocks are counted separately, giving a fragmentation picture without
+ * the caller having to traverse the heap itself.
+ *
+ * @param[in]  pHeap: pointer to eHeap struct to get data from
+ * @param[out] pHistogram: receives per-class block counts and byte totals
+ *
+ * @return 'NV_OK' Operation completed successfully
+ *         'NV_ERR_INVALID_ARGUMENT' pHistogram is NULL
+ */
+static NV_STATUS
+eheapGetOccupancyHistogram
+(
+    OBJEHEAP *pHeap,
+    EHEAP_OCCUPANCY_HISTOGRAM *pHistogram
+)
+{
+    EMEMBLOCK *block;
+
+    NV_ASSERT_OR_RETURN(pHistogram != NULL, NV_ERR_INVALID_ARGUMENT);
+
+    portMemSet(pHistogram, 0, sizeof(*pHistogram));
+
+    block = pHeap->pBlockList;
+    if (block == NULL)
+        return NV_OK;
+
+    do
+    {
+        NvU64 size      = block->end - block->begin + 1;
+        NvU32 sizeClass = _eheapSizeClass(size);
+
+        if (block->owner == NVOS32_BLOCK_TYPE_FREE)
+        {
+            pHistogram->numFreeBlocks[sizeClass]++;
+            pHistogram->freeBytes[sizeClass] += size;
+        }
+        else
+        {
+            pHistogram->numAllocBlocks[sizeClass]++;
+            pHistogram->allocBytes[sizeClass] += size;
+        }
+
+        block = block->next;
+    } while (block != pHeap->pBlockList);
+
+    return NV_OK;
+}
+
 /**
  * @brief Check heap block ownership
  *
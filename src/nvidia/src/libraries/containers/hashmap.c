@@ -0,0 +1,518 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+#include "containers/hashmap.h"
+
+CONT_VTABLE_DEFN(HashMapBase, NULL, hashmapIterRangeIndex_IMPL);
+
+// Buckets start out this size on first insert and grow by doubling.
+#define HASHMAP_INITIAL_CAPACITY 32
+
+//
+// Deleted buckets point at this sentinel instead of being cleared, so probe
+// chains stay intact and iterators (which hold bucket indices) survive
+// removals. Tombstones are purged by the next rehash.
+//
+static HashMapNode g_hashmapTombstone;
+#define HASHMAP_TOMBSTONE (&g_hashmapTombstone)
+
+static NvBool _hashmapBucketIsLive(HashMapBucket *pBucket)
+{
+    return (pBucket->pNode != NULL) && (pBucket->pNode != HASHMAP_TOMBSTONE);
+}
+
+static NvU32 _hashmapHashKey(NvU64 key)
+{
+    // 64-bit finalizer from MurmurHash3; spreads sequential handles well.
+    key ^= key >> 33;
+    key *= 0xff51afd7ed558ccdULL;
+    key ^= key >> 33;
+    key *= 0xc4ceb9fe1a85ec53ULL;
+    key ^= key >> 33;
+    return (NvU32)key;
+}
+
+/**
+ * @brief Place a node into a table known to have a free slot for its key.
+ * @details Shared by insertion and rehashing; the caller guarantees the key
+ *          is not already present and the table is not full.
+ */
+static void _hashmapPlace(HashMapBucket *pBuckets, NvU32 capacity,
+                          NvU64 key, HashMapNode *pNode)
+{
+    NvU32 i = _hashmapHashKey(key) & (capacity - 1);
+
+    while (_hashmapBucketIsLive(&pBuckets[i]))
+        i = (i + 1) & (capacity - 1);
+
+    pBuckets[i].key = key;
+    pBuckets[i].pNode = pNode;
+}
+
+/**
+ * @brief Move all live entries into a freshly allocated bucket array.
+ * @details Also used at the current capacity to purge tombstones.
+ */
+static NvBool _hashmapRehash(HashMapBase *pMap, NvU32 newCapacity)
+{
+    HashMapBucket *pNewBuckets;
+    NvU32 i;
+
+    pNewBuckets = PORT_ALLOC(pMap->pAllocator,
+                             sizeof(*pNewBuckets) * newCapacity);
+    if (NULL == pNewBuckets)
+        return NV_FALSE;
+
+    portMemSet(pNewBuckets, 0, sizeof(*pNewBuckets) * newCapacity);
+
+    for (i = 0; i < pMap->capacity; i++)
+    {
+        if (_hashmapBucketIsLive(&pMap->pBuckets[i]))
+        {
+            _hashmapPlace(pNewBuckets, newCapacity,
+                          pMap->pBuckets[i].key, pMap->pBuckets[i].pNode);
+        }
+    }
+
+    if (NULL != pMap->pBuckets)
+        PORT_FREE(pMap->pAllocator, pMap->pBuckets);
+
+    pMap->pBuckets = pNewBuckets;
+    pMap->capacity = newCapacity;
+    pMap->tombstones = 0;
+    return NV_TRUE;
+}
+
+/**
+ * @brief Basic insertion procedure
+ * @details Shared by three versions of hash map insertion functions
+ */
+static NvBool _hashmapInsertBase(HashMapBase *pMap, NvU64 key, void *pValue)
+{
+    HashMapNode *pNode = hashmapValueToNode(pMap, pValue);
+    HashMapBucket *pTarget = NULL;
+    NvU32 occupied = pMap->count + pMap->tombstones;
+    NvU32 i;
+    NvU32 probes;
+
+    // Keep the table at most 3/4 occupied so probe chains stay short.
+    if ((pMap->capacity == 0) ||
+        ((occupied + 1) * 4 > pMap->capacity * 3))
+    {
+        NvU32 newCapacity;
+
+        if (pMap->capacity == 0)
+            newCapacity = HASHMAP_INITIAL_CAPACITY;
+        else if ((pMap->count + 1) * 4 > pMap->capacity * 3)
+            newCapacity = pMap->capacity * 2;
+        else
+            newCapacity = pMap->capacity; // only purging tombstones
+
+        //
+        // A failed rehash is not fatal as long as some bucket is still
+        // free; the table just runs at a higher load factor until the
+        // next successful rehash.
+        //
+        if (!_hashmapRehash(pMap, newCapacity) &&
+            (occupied >= pMap->capacity))
+            return NV_FALSE;
+    }
+
+    i = _hashmapHashKey(key) & (pMap->capacity - 1);
+
+    for (probes = 0; probes < pMap->capacity; probes++)
+    {
+        HashMapBucket *pBucket = &pMap->pBuckets[i];
+
+        if (pBucket->pNode == NULL)
+        {
+            if (pTarget == NULL)
+                pTarget = pBucket;
+            break;
+        }
+
+        if (pBucket->pNode == HASHMAP_TOMBSTONE)
+        {
+            // Remember the first reusable slot, but keep probing for a
+            // duplicate of the key further down the chain.
+            if (pTarget == NULL)
+                pTarget = pBucket;
+        }
+        else if (pBucket->key == key)
+        {
+            // duplication detected
+            return NV_FALSE;
+        }
+
+        i = (i + 1) & (pMap->capacity - 1);
+    }
+
+    if (pTarget == NULL)
+        return NV_FALSE;
+
+    if (pTarget->pNode == HASHMAP_TOMBSTONE)
+        pMap->tombstones--;
+
+    pTarget->key = key;
+    pTarget->pNode = pNode;
+    NV_CHECKED_ONLY(pNode->pMap = pMap);
+    pNode->key = key;
+    NV_CHECKED_ONLY(pMap->versionNumber++);
+    pMap->count++;
+    return NV_TRUE;
+}
+
+void hashmapInit_IMPL
+(
+    NonIntrusiveHashMap *pMap,
+    PORT_MEM_ALLOCATOR  *pAllocator,
+    NvU32                valueSize
+)
+{
+    NV_ASSERT_OR_RETURN_VOID(NULL != pMap);
+    NV_ASSERT_OR_RETURN_VOID(NULL != pAllocator);
+    portMemSet(&(pMap->base), 0, sizeof(pMap->base));
+    CONT_VTABLE_INIT(HashMapBase, &pMap->base);
+    pMap->base.pAllocator = pAllocator;
+    pMap->valueSize = valueSize;
+    pMap->base.nodeOffset = (NvS32)(0 - sizeof(HashMapNode));
+}
+
+void hashmapInitIntrusive_IMPL
+(
+    IntrusiveHashMap   *pMap,
+    PORT_MEM_ALLOCATOR *pAllocator,
+    NvS32               nodeOffset
+)
+{
+    NV_ASSERT_OR_RETURN_VOID(NULL != pMap);
+    NV_ASSERT_OR_RETURN_VOID(NULL != pAllocator);
+    portMemSet(&(pMap->base), 0, sizeof(pMap->base));
+    CONT_VTABLE_INIT(HashMapBase, &pMap->base);
+    pMap->base.pAllocator = pAllocator;
+    pMap->base.nodeOffset = nodeOffset;
+}
+
+static void _hashmapDestroy(HashMapBase *pMap, NvBool bFreeValues)
+{
+    NvU32 i;
+
+    NV_ASSERT_OR_RETURN_VOID(NULL != pMap);
+
+    for (i = 0; i < pMap->capacity; i++)
+    {
+        if (_hashmapBucketIsLive(&pMap->pBuckets[i]))
+        {
+            HashMapNode *pNode = pMap->pBuckets[i].pNode;
+
+            NV_CHECKED_ONLY(pNode->pMap = NULL);
+            if (bFreeValues)
+            {
+                PORT_FREE(pMap->pAllocator, pNode);
+            }
+        }
+    }
+
+    if (NULL != pMap->pBuckets)
+        PORT_FREE(pMap->pAllocator, pMap->pBuckets);
+
+    pMap->pBuckets = NULL;
+    pMap->capacity = 0;
+    pMap->count = 0;
+    pMap->tombstones = 0;
+    NV_CHECKED_ONLY(pMap->versionNumber++);
+}
+
+void hashmapDestroy_IMPL
+(
+    NonIntrusiveHashMap *pMap
+)
+{
+    _hashmapDestroy(&pMap->base, NV_TRUE);
+}
+
+void hashmapDestroyIntrusive_IMPL
+(
+    HashMapBase *pMap
+)
+{
+    _hashmapDestroy(pMap, NV_FALSE);
+}
+
+NvU32 hashmapCount_IMPL
+(
+    HashMapBase *pMap
+)
+{
+    NV_ASSERT_OR_RETURN(pMap, 0);
+    return pMap->count;
+}
+
+NvU64 hashmapKey_IMPL
+(
+    HashMapBase *pMap,
+    void        *pValue
+)
+{
+    HashMapNode *pNode = hashmapValueToNode(pMap, pValue);
+    NV_ASSERT_OR_RETURN(NULL != pNode, 0);
+    NV_ASSERT_CHECKED(pNode->pMap == pMap);
+    return pNode->key;
+}
+
+void *hashmapInsertNew_IMPL
+(
+    NonIntrusiveHashMap *pMap,
+    NvU64                key
+)
+{
+    void *pNode = NULL;
+    void *pValue;
+
+    NV_ASSERT_OR_RETURN(NULL != pMap, NULL);
+
+    pNode = PORT_ALLOC(pMap->base.pAllocator,
+                       sizeof(HashMapNode) + pMap->valueSize);
+    NV_ASSERT_OR_RETURN(NULL != pNode, NULL);
+
+    portMemSet(pNode, 0, sizeof(HashMapNode) + pMap->valueSize);
+    pValue = hashmapNodeToValue(&pMap->base, pNode);
+
+    // check key duplication
+    if (!_hashmapInsertBase(&(pMap->base), key, pValue))
+    {
+        PORT_FREE(pMap->base.pAllocator, pNode);
+        return NULL;
+    }
+
+    return pValue;
+}
+
+void *hashmapInsertValue_IMPL
+(
+    NonIntrusiveHashMap *pMap,
+    NvU64                key,
+    const void          *pValue
+)
+{
+    void *pCurrent;
+
+    NV_ASSERT_OR_RETURN(NULL != pValue, NULL);
+
+    pCurrent = hashmapInsertNew_IMPL(pMap, key);
+    if (NULL == pCurrent)
+        return NULL;
+
+    return portMemCopy(pCurrent, pMap->valueSize, pValue, pMap->valueSize);
+}
+
+NvBool hashmapInsertExisting_IMPL
+(
+    IntrusiveHashMap *pMap,
+    NvU64             key,
+    void             *pValue
+)
+{
+    NV_ASSERT_OR_RETURN(NULL != pMap, NV_FALSE);
+    NV_ASSERT_OR_RETURN(NULL != pValue, NV_FALSE);
+    return _hashmapInsertBase(&(pMap->base), key, pValue);
+}
+
+void hashmapRemove_IMPL
+(
+    NonIntrusiveHashMap *pMap,
+    void                *pValue
+)
+{
+    if (pValue == NULL)
+        return;
+    hashmapRemoveIntrusive_IMPL(&(pMap->base), pValue);
+    PORT_FREE(pMap->base.pAllocator, hashmapValueToNode(&pMap->base, pValue));
+}
+
+void hashmapRemoveIntrusive_IMPL
+(
+    HashMapBase *pMap,
+    void        *pValue
+)
+{
+    HashMapNode *pNode;
+    NvU32 i;
+    NvU32 probes;
+
+    // do nothing if pValue is NULL
+    if (pValue == NULL)
+        return;
+
+    pNode = hashmapValueToNode(pMap, pValue);
+    NV_ASSERT_OR_RETURN_VOID(NULL != pNode);
+    NV_ASSERT_CHECKED(pNode->pMap == pMap);
+    NV_ASSERT_OR_RETURN_VOID(pMap->capacity != 0);
+
+    i = _hashmapHashKey(pNode->key) & (pMap->capacity - 1);
+
+    for (probes = 0; probes < pMap->capacity; probes++)
+    {
+        HashMapBucket *pBucket = &pMap->pBuckets[i];
+
+        if (pBucket->pNode == NULL)
+            break;
+
+        if (pBucket->pNode == pNode)
+        {
+            pBucket->pNode = HASHMAP_TOMBSTONE;
+            pMap->tombstones++;
+            NV_CHECKED_ONLY(pMap->versionNumber++);
+            NV_CHECKED_ONLY(pNode->pMap = NULL);
+            pMap->count--;
+            return;
+        }
+
+        i = (i + 1) & (pMap->capacity - 1);
+    }
+
+    // pValue is not in this map.
+    NV_ASSERT_FAILED("value not found in hash map");
+}
+
+void hashmapRemoveByKey_IMPL
+(
+    NonIntrusiveHashMap *pMap,
+    NvU64                key
+)
+{
+    hashmapRemove_IMPL(pMap, hashmapFind_IMPL(&(pMap->base), key));
+}
+
+void hashmapRemoveByKeyIntrusive_IMPL
+(
+    HashMapBase *pMap,
+    NvU64        key
+)
+{
+    hashmapRemoveIntrusive_IMPL(pMap, hashmapFind_IMPL(pMap, key));
+}
+
+void *hashmapFind_IMPL
+(
+    HashMapBase *pMap,
+    NvU64        key
+)
+{
+    NvU32 i;
+    NvU32 probes;
+
+    NV_ASSERT_OR_RETURN(NULL != pMap, NULL);
+
+    if (pMap->capacity == 0)
+        return NULL;
+
+    i = _hashmapHashKey(key) & (pMap->capacity - 1);
+
+    for (probes = 0; probes < pMap->capacity; probes++)
+    {
+        HashMapBucket *pBucket = &pMap->pBuckets[i];
+
+        if (pBucket->pNode == NULL)
+            return NULL;
+
+        if ((pBucket->pNode != HASHMAP_TOMBSTONE) && (pBucket->key == key))
+            return hashmapNodeToValue(pMap, pBucket->pNode);
+
+        i = (i + 1) & (pMap->capacity - 1);
+    }
+
+    return NULL;
+}
+
+//
+// The index arguments are bucket indices, not keys; hash maps have no key
+// order to iterate by. Only hashmapIterAll (0 .. NV_U64_MAX) is exposed.
+//
+HashMapIterBase hashmapIterRangeIndex_IMPL
+(
+    HashMapBase *pMap,
+    NvU64        first,
+    NvU64        last
+)
+{
+    HashMapIterBase it;
+    NV_ASSERT(pMap);
+
+    portMemSet(&it, 0, sizeof(it));
+    it.pMap = pMap;
+    NV_CHECKED_ONLY(it.versionNumber = pMap->versionNumber);
+
+    if ((pMap->capacity == 0) || (first >= pMap->capacity) || (first > last))
+    {
+        // Already exhausted.
+        it.nextBucket = 1;
+        it.lastBucket = 0;
+        return it;
+    }
+
+    it.nextBucket = (NvU32)first;
+    it.lastBucket = (last >= pMap->capacity) ? (pMap->capacity - 1)
+                                             : (NvU32)last;
+    return it;
+}
+
+NvBool hashmapIterNext_IMPL(HashMapIterBase *pIt)
+{
+    NV_ASSERT_OR_RETURN(pIt, NV_FALSE);
+
+#if PORT_IS_CHECKED_BUILD
+    if (pIt->bValid && !CONT_ITER_IS_VALID(pIt->pMap, pIt))
+    {
+        NV_ASSERT(CONT_ITER_IS_VALID(pIt->pMap, pIt));
+        PORT_DUMP_STACK();
+        pIt->bValid = NV_FALSE;
+    }
+#endif
+
+    while (pIt->nextBucket <= pIt->lastBucket)
+    {
+        HashMapBucket *pBucket = &pIt->pMap->pBuckets[pIt->nextBucket++];
+
+        if (_hashmapBucketIsLive(pBucket))
+        {
+            pIt->pValue = hashmapNodeToValue(pIt->pMap, pBucket->pNode);
+            return NV_TRUE;
+        }
+    }
+
+    return NV_FALSE;
+}
+
+NvBool hashmapIsValid_IMPL(void *pMap)
+{
+#if NV_TYPEOF_SUPPORTED
+    return NV_TRUE;
+#else
+    if (CONT_VTABLE_VALID((HashMapBase*)pMap))
+        return NV_TRUE;
+
+    NV_ASSERT_FAILED("vtable not valid!");
+    CONT_VTABLE_INIT(HashMapBase, (HashMapBase*)pMap);
+    return NV_FALSE;
+#endif
+}
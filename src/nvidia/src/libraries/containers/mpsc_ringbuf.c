@@ -0,0 +1,223 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+#include "containers/mpsc_ringbuf.h"
+
+//
+// Each slot is a sequence word followed by the 8-byte-aligned payload. The
+// sequence of slot (i & mask) progresses i -> i+1 -> i+size -> i+size+1 ...
+// as the slot is published by a producer, released by the consumer, and
+// reused on the next lap. All cross-thread handshakes go through atomic
+// operations on these words; nvport atomics double as memory barriers on
+// every supported platform.
+//
+static volatile NvU64 *
+_mpscRingbufSlotSeq(MpscRingBufBase *pBase, NvU64 idx)
+{
+    return (volatile NvU64 *)
+        &pBase->arr[(idx & MPSC_RINGBUF_ARRAY_MASK(pBase)) * pBase->stride];
+}
+
+static NvU8 *
+_mpscRingbufSlotData(MpscRingBufBase *pBase, NvU64 idx)
+{
+    return &pBase->arr[(idx & MPSC_RINGBUF_ARRAY_MASK(pBase)) * pBase->stride +
+                       sizeof(NvU64)];
+}
+
+/*
+ * @brief Initialize an MPSC ring buffer given a PORT_MEM_ALLOCATOR
+ *
+ * @param pBase
+ *     Pointer to MpscRingBufBase structure
+ * @param logSz
+ *     Log base 2 of total size of storage, in # of elements
+ * @param eleSz
+ *     Size per element
+ * @param pAlloc
+ *     Pointer to PORT_MEM_ALLOCATOR
+ *
+ * @returns NvBool
+ *     NV_TRUE if unable to construct, NV_FALSE otherwise
+ */
+NvBool
+mpscRingbufConstruct_IMPL
+(
+    MpscRingBufBase *pBase,
+    NvU64 logSz,
+    NvU64 eleSz,
+    PORT_MEM_ALLOCATOR *pAlloc
+)
+{
+    NvU64 i;
+
+    NV_ASSERT_OR_RETURN(logSz < 56, NV_TRUE);
+
+    portMemSet(pBase, 0, sizeof(*pBase));
+    pBase->logSz = logSz;
+    pBase->eleSz = eleSz;
+    pBase->stride = sizeof(NvU64) + NV_ALIGN_UP64(eleSz, 8llu);
+    pBase->arr = PORT_ALLOC(pAlloc, pBase->stride << logSz);
+    if (pBase->arr == NULL)
+        return NV_TRUE;
+
+    for (i = 0; i < MPSC_RINGBUF_ARRAY_SIZE(pBase); i++)
+        *_mpscRingbufSlotSeq(pBase, i) = i;
+
+    return NV_FALSE;
+}
+
+/*
+ * @brief Destroy an MPSC ring buffer
+ *
+ * @param pBase
+ *     Pointer to MpscRingBufBase structure
+ * @param pAlloc
+ *     Pointer to PORT_MEM_ALLOCATOR used to construct the ring buffer
+ *
+ * @returns void
+ */
+void
+mpscRingbufDestruct_IMPL
+(
+    MpscRingBufBase *pBase,
+    PORT_MEM_ALLOCATOR *pAlloc
+)
+{
+    if ((pAlloc != NULL) && (pBase->arr != NULL))
+    {
+        PORT_FREE(pAlloc, pBase->arr);
+        pBase->arr = NULL;
+        pBase->logSz = 0;
+    }
+}
+
+/*
+ * @brief Append one element; safe to call from any number of threads
+ *
+ * @param pBase
+ *     Pointer to MpscRingBufBase structure
+ * @param pEle
+ *     Pointer to the element to copy in
+ *
+ * @returns NvBool
+ *     NV_TRUE if success, NV_FALSE if the ring is full
+ */
+NvBool
+mpscRingbufPush_IMPL
+(
+    MpscRingBufBase *pBase,
+    NvU8 *pEle
+)
+{
+    volatile NvU64 *pSeq;
+    NvU64 head;
+    NvU64 seq;
+
+    for (;;)
+    {
+        head = pBase->head;
+        pSeq = _mpscRingbufSlotSeq(pBase, head);
+        seq = *pSeq;
+
+        if (seq == head)
+        {
+            // The slot is free; try to claim it. Winning the CAS makes this
+            // thread the only writer of the slot until the next lap.
+            if (portAtomicExCompareAndSwapU64(&pBase->head, head + 1, head))
+                break;
+        }
+        else if ((NvS64)(seq - head) < 0)
+        {
+            //
+            // The slot still holds the element from one lap ago. Confirm
+            // with an ordered read before failing, since the plain load
+            // above may be stale.
+            //
+            if ((NvS64)(portAtomicExAddU64(pSeq, 0) - head) < 0)
+                return NV_FALSE;
+        }
+        // Another producer claimed this index between the reads; retry.
+    }
+
+    portMemCopy(_mpscRingbufSlotData(pBase, head), pBase->eleSz,
+                pEle, pBase->eleSz);
+
+    // Publish: the consumer treats seq == head + 1 as "copy complete".
+    portAtomicExSetU64(pSeq, head + 1);
+    return NV_TRUE;
+}
+
+/*
+ * @brief Remove the oldest element; only one thread may consume at a time
+ *
+ * @param pBase
+ *     Pointer to MpscRingBufBase structure
+ * @param pEleOut
+ *     Receives a copy of the removed element
+ *
+ * @returns NvBool
+ *     NV_TRUE if an element was returned, NV_FALSE if the ring is empty or
+ *     the oldest slot is still being written by a producer
+ */
+NvBool
+mpscRingbufPop_IMPL
+(
+    MpscRingBufBase *pBase,
+    NvU8 *pEleOut
+)
+{
+    NvU64 tail = pBase->tail;
+    volatile NvU64 *pSeq = _mpscRingbufSlotSeq(pBase, tail);
+
+    // Ordered read; also orders the payload read below after the
+    // producer's publishing store.
+    if (portAtomicExAddU64(pSeq, 0) != tail + 1)
+        return NV_FALSE;
+
+    portMemCopy(pEleOut, pBase->eleSz,
+                _mpscRingbufSlotData(pBase, tail), pBase->eleSz);
+
+    // Release the slot for the producers' next lap.
+    portAtomicExSetU64(pSeq, tail + MPSC_RINGBUF_ARRAY_SIZE(pBase));
+    portAtomicExSetU64(&pBase->tail, tail + 1);
+    return NV_TRUE;
+}
+
+/*
+ * @brief Get current size of the ring buffer
+ *
+ * @param pBase
+ *     Pointer to MpscRingBufBase structure
+ *
+ * @returns NvU64
+ *     Number of elements currently in the ring buffer. With concurrent
+ *     producers this is a snapshot and may be stale by the time it is used.
+ */
+NvU64
+mpscRingbufCurrentSize_IMPL
+(
+    MpscRingBufBase *pBase
+)
+{
+    return pBase->head - pBase->tail;
+}
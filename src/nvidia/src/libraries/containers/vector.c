@@ -34,10 +34,14 @@ static NvBool _vectIndexCheck(Vector *pVector, NvU32 index);
  * Reallocates container.
  *
  * Allocate a memory of 'newSize' bytes, then copy 'copySize' bytes from the old
- * vector memory to the new one.
+ * vector memory to the new one. Prefers the instantiation-embedded inline
+ * storage whenever the requested size fits in it.
  */
 static NvBool _vectReallocHelper(Vector *pVector, NvU32 newSize, NvU32 copySize);
 
+// Default growth on insertion beyond capacity: double the capacity.
+#define VECT_DEFAULT_GROWTH_PERCENT 200
+
 NV_STATUS vectInit_IMPL
 (
     Vector             *pVector,
@@ -52,10 +56,11 @@ NV_STATUS vectInit_IMPL
 
     portMemSet(pVector, 0, sizeof(*pVector));
     CONT_VTABLE_INIT(Vector, pVector);
-    pVector->pAllocator = pAllocator;
-    pVector->valueSize  = valueSize;
-    pVector->capacity   = capacity;
-    pVector->size       = 0;
+    pVector->pAllocator    = pAllocator;
+    pVector->valueSize     = valueSize;
+    pVector->capacity      = capacity;
+    pVector->size          = 0;
+    pVector->growthPercent = VECT_DEFAULT_GROWTH_PERCENT;
 
     if (capacity > 0)
     {
@@ -71,14 +76,48 @@ NV_STATUS vectInit_IMPL
     return NV_OK;
 }
 
+NV_STATUS vectInitInline_IMPL
+(
+    Vector             *pVector,
+    PORT_MEM_ALLOCATOR *pAllocator,
+    void               *pInlineStorage,
+    NvU32               inlineCapacity,
+    NvU32               valueSize
+)
+{
+    NV_ASSERT_OR_RETURN(pVector != NULL, NV_ERR_INVALID_ARGUMENT);
+    NV_ASSERT_OR_RETURN(pAllocator != NULL, NV_ERR_INVALID_ARGUMENT);
+    NV_ASSERT_OR_RETURN(pInlineStorage != NULL, NV_ERR_INVALID_ARGUMENT);
+    NV_ASSERT_OR_RETURN(inlineCapacity > 0, NV_ERR_INVALID_ARGUMENT);
+    NV_CHECKED_ONLY(pVector->versionNumber++);
+
+    portMemSet(pVector, 0, sizeof(*pVector));
+    CONT_VTABLE_INIT(Vector, pVector);
+    pVector->pAllocator     = pAllocator;
+    pVector->valueSize      = valueSize;
+    pVector->pInlineHead    = pInlineStorage;
+    pVector->inlineCapacity = inlineCapacity;
+    pVector->pHead          = pInlineStorage;
+    pVector->capacity       = inlineCapacity;
+    pVector->size           = 0;
+    pVector->growthPercent  = VECT_DEFAULT_GROWTH_PERCENT;
+
+    portMemSet(pInlineStorage, 0, inlineCapacity * valueSize);
+    return NV_OK;
+}
+
 void vectDestroy_IMPL(Vector *pVector)
 {
     NV_ASSERT_OR_RETURN_VOID(pVector != NULL);
     NV_CHECKED_ONLY(pVector->versionNumber++);
 
-    PORT_FREE(pVector->pAllocator, pVector->pHead);
-    pVector->pHead    = NULL;
-    pVector->capacity = 0;
+    if (pVector->pHead != pVector->pInlineHead)
+    {
+        PORT_FREE(pVector->pAllocator, pVector->pHead);
+    }
+    // An inline vector stays usable with its embedded storage.
+    pVector->pHead    = pVector->pInlineHead;
+    pVector->capacity = pVector->inlineCapacity;
     pVector->size     = 0;
 }
 
@@ -199,8 +238,22 @@ void *vectInsert_IMPL
     }
     if (pVector->size + 1 > pVector->capacity)
     {
-        // resize the container by the factor of 2, newcapacity = capacity * 2
-        NvU32 newCapacity = pVector->capacity == 0 ? 10 : pVector->capacity * 2;
+        // resize the container geometrically, by growthPercent (default 2x)
+        NvU32 newCapacity;
+
+        if (pVector->capacity == 0)
+        {
+            newCapacity = 10;
+        }
+        else
+        {
+            NvU64 grown = ((NvU64)pVector->capacity *
+                           pVector->growthPercent) / 100llu;
+
+            newCapacity = (grown > NV_U32_MAX) ? NV_U32_MAX : (NvU32)grown;
+            if (newCapacity <= pVector->capacity)
+                newCapacity = pVector->capacity + 1;
+        }
 
         if (!_vectReallocHelper(pVector,
                                 newCapacity   * pVector->valueSize,
@@ -244,6 +297,18 @@ void vectRemove_IMPL
     pVector->size--;
 }
 
+void vectSetGrowthPercent_IMPL
+(
+    Vector *pVector,
+    NvU32   percent
+)
+{
+    NV_ASSERT_OR_RETURN_VOID(pVector != NULL);
+    // Growth must be geometric; 100% or less would never make progress.
+    NV_ASSERT_OR_RETURN_VOID(percent > 100);
+    pVector->growthPercent = percent;
+}
+
 void *vectAppend_IMPL
 (
     Vector     *pVector,
@@ -402,30 +467,53 @@ static NvBool _vectReallocHelper
 )
 {
     void *pNewArray;
-    void *pCopiedArray;
+    NvBool bNewInline = NV_FALSE;
+    NvBool bOldInline = (pVector->pHead != NULL) &&
+                        (pVector->pHead == pVector->pInlineHead);
 
     NV_ASSERT_OR_RETURN(newSize >= copySize, NV_FALSE);
 
-    pNewArray = PORT_ALLOC(pVector->pAllocator, newSize);
-    if (pNewArray == NULL && newSize > 0)
+    if ((pVector->pInlineHead != NULL) &&
+        (newSize <= pVector->inlineCapacity * pVector->valueSize))
     {
-        return NV_FALSE;
+        if (bOldInline)
+        {
+            // Shrinking within the inline array is a no-op.
+            pVector->size = copySize / pVector->valueSize;
+            return NV_TRUE;
+        }
+        pNewArray = pVector->pInlineHead;
+        newSize = pVector->inlineCapacity * pVector->valueSize;
+        bNewInline = NV_TRUE;
     }
+    else
+    {
+        pNewArray = PORT_ALLOC(pVector->pAllocator, newSize);
+        if (pNewArray == NULL && newSize > 0)
+        {
+            return NV_FALSE;
+        }
+    }
+
     portMemSet(pNewArray, 0, newSize);
 
     if (copySize > 0)
     {
-        pCopiedArray = portMemCopy(pNewArray,      newSize,
-                                   pVector->pHead, copySize);
-        if (NULL == pCopiedArray)
+        if (portMemCopy(pNewArray,      newSize,
+                        pVector->pHead, copySize) == NULL)
         {
-            NV_ASSERT(pCopiedArray);
-            PORT_FREE(pVector->pAllocator, pNewArray);
+            NV_ASSERT_FAILED("vector realloc copy failed");
+            if (!bNewInline)
+            {
+                PORT_FREE(pVector->pAllocator, pNewArray);
+            }
             return NV_FALSE;
         }
+    }
 
+    if (!bOldInline && (pVector->pHead != NULL))
+    {
         PORT_FREE(pVector->pAllocator, pVector->pHead);
-        pNewArray = pCopiedArray;
     }
 
     pVector->pHead    = pNewArray;
@@ -193,7 +193,21 @@ eventBufferProducerAddEvent
 
             _eventBufferAddVardata(info, pData->pVardata, pData->vardataSize, &record->recordHeader);
 
+            //
+            // The record buffer and header are mapped into the consumer's
+            // address space; a consumer polling recordPut must never observe
+            // the new put offset before the record contents. Order the record
+            // and vardata stores before publishing the put offset.
+            //
+            portAtomicMemoryFenceStore();
             pHeader->recordPut = putNext;
+
+            //
+            // Keep the shared fill count current on the producer side so the
+            // notification threshold tracks puts as they happen, rather than
+            // only refreshing when the consumer issues an UPDATE_GET control.
+            //
+            _eventBufferUpdateRecordBufferCount(info);
         }
     }
 }
@@ -135,6 +135,54 @@ gmmuFmtPtePhysAddrFld
     }
 }
 
+NvBool gmmuFmtPrepPteEncoder
+(
+    const MMU_FMT_LEVEL      *pLevel,
+    const GMMU_FIELD_ADDRESS *pAddrField,
+    const NvU8               *pTemplate,
+    GMMU_FMT_PTE_ENCODER     *pEncoder
+)
+{
+    NvU32 w;
+
+    //
+    // All supported formats use 8- or 16-byte entries with the physical
+    // address in a single contiguous field of one aligned 64-bit word.
+    // Anything else must fall back to the generic field setters.
+    //
+    if ((0 == pLevel->entrySize) ||
+        (0 != (pLevel->entrySize % 8)) ||
+        (pLevel->entrySize > GMMU_FMT_MAX_ENTRY_SIZE))
+    {
+        return NV_FALSE;
+    }
+    if ((1 != pAddrField->desc.regionCount) ||
+        (0 != (pAddrField->desc.regions[0].offset % 8)) ||
+        (pAddrField->desc.regions[0].offset >= pLevel->entrySize))
+    {
+        return NV_FALSE;
+    }
+
+    pEncoder->numWords   = pLevel->entrySize / 8;
+    pEncoder->addrWord   = pAddrField->desc.regions[0].offset / 8;
+    pEncoder->addrMask   = pAddrField->desc.regions[0].maskPos;
+    pEncoder->fieldShift = pAddrField->desc.regions[0].shift;
+    pEncoder->physShift  = pAddrField->shift;
+
+    for (w = 0; w < pEncoder->numWords; ++w)
+    {
+        pEncoder->tmpl.v64[w] = ((const NvU64*)pTemplate)[w];
+    }
+
+    //
+    // The address is the only per-PTE varying piece, so clear its field
+    // bits in the template and let the encode step OR the address in.
+    //
+    pEncoder->tmpl.v64[pEncoder->addrWord] &= ~pEncoder->addrMask;
+
+    return NV_TRUE;
+}
+
 void gmmuFmtInitPteCompTags
 (
     const GMMU_FMT        *pFmt,
@@ -52,6 +52,9 @@ _mmuWalkLevelInstAcquire(const MMU_WALK *pWalk, MMU_WALK_LEVEL *pLevel,
 static void
 _mmuWalkLevelInstRelease(const MMU_WALK *pWalk, MMU_WALK_LEVEL *pLevel,
                          MMU_WALK_LEVEL_INST *pLevelInst);
+static NV_STATUS
+_mmuWalkLevelInstLookup(MMU_WALK_LEVEL *pLevel, const NvU64 virtAddr,
+                        MMU_WALK_LEVEL_INST **ppLevelInst);
 static NV_STATUS NV_NOINLINE
 _mmuWalkPdeAcquire(const MMU_WALK *pWalk, const MMU_WALK_OP_PARAMS *pOpParams,
                    MMU_WALK_LEVEL *pLevel, MMU_WALK_LEVEL_INST *pLevelInst,
@@ -161,6 +164,45 @@ mmuWalkCommit
     // TODO
 }
 
+void
+mmuWalkBatchBegin
+(
+    MMU_WALK *pWalk
+)
+{
+    NV_ASSERT_OR_RETURN_VOID(NULL != pWalk);
+    NV_ASSERT(!pWalk->bBatching);
+
+    pWalk->bBatching   = NV_TRUE;
+    pWalk->bBatchDirty = NV_FALSE;
+    pWalk->batchVaLo   = NV_U64_MAX;
+    pWalk->batchVaHi   = 0;
+}
+
+NvBool
+mmuWalkBatchEnd
+(
+    MMU_WALK *pWalk,
+    NvU64    *pVaLo,
+    NvU64    *pVaHi
+)
+{
+    NvBool bDirty;
+
+    NV_ASSERT_OR_RETURN(NULL != pWalk, NV_FALSE);
+    NV_ASSERT_OR_RETURN((NULL != pVaLo) && (NULL != pVaHi), NV_FALSE);
+    NV_ASSERT(pWalk->bBatching);
+
+    bDirty = pWalk->bBatchDirty;
+    *pVaLo = pWalk->batchVaLo;
+    *pVaHi = pWalk->batchVaHi;
+
+    pWalk->bBatching   = NV_FALSE;
+    pWalk->bBatchDirty = NV_FALSE;
+
+    return bDirty;
+}
+
 MMU_WALK_USER_CTX *
 mmuWalkGetUserCtx
 (
@@ -216,6 +258,29 @@ mmuWalkLevelInstancesForceFree
 
 /*----------------------------Private Functions--------------------------------*/
 
+/*!
+ * Accumulates the VA range touched by a walk operation into the current
+ * batch, if one is open. Called by the operation entry points regardless
+ * of operation status since partially applied (and unwound) operations
+ * still modify entries.
+ */
+void
+mmuWalkBatchTrackRange
+(
+    MMU_WALK   *pWalk,
+    const NvU64 vaLo,
+    const NvU64 vaHi
+)
+{
+    if (!pWalk->bBatching)
+    {
+        return;
+    }
+    pWalk->bBatchDirty = NV_TRUE;
+    pWalk->batchVaLo   = NV_MIN(pWalk->batchVaLo, vaLo);
+    pWalk->batchVaHi   = NV_MAX(pWalk->batchVaHi, vaHi);
+}
+
 const MMU_WALK_LEVEL *
 mmuWalkFindLevel
 (
@@ -1312,6 +1377,43 @@ _mmuWalkResolveSubLevelConflicts
     return status;
 }
 
+/*!
+ * Looks up the level instance whose VA range contains virtAddr.
+ *
+ * Sequential map/unmap operations on adjacent ranges - the dominant
+ * pattern - hit the same upper-level instances over and over, so a
+ * one-entry cursor of the last traversed instance is checked before
+ * falling back to the instance tree. The cursor persists across walk
+ * operations and is invalidated in @ref _mmuWalkLevelInstRelease.
+ */
+static NV_STATUS
+_mmuWalkLevelInstLookup
+(
+    MMU_WALK_LEVEL       *pLevel,
+    const NvU64           virtAddr,
+    MMU_WALK_LEVEL_INST **ppLevelInst
+)
+{
+    MMU_WALK_LEVEL_INST *pCursor = pLevel->pLastTraversed;
+    NV_STATUS            status;
+
+    // Fast path: cursor from a previous traversal still covers this VA.
+    if ((NULL != pCursor) &&
+        (virtAddr >= pCursor->node.keyStart) &&
+        (virtAddr <= pCursor->node.keyEnd))
+    {
+        *ppLevelInst = pCursor;
+        return NV_OK;
+    }
+
+    status = btreeSearch(virtAddr, (NODE**)ppLevelInst, (NODE*)pLevel->pInstances);
+    if (NV_OK == status)
+    {
+        pLevel->pLastTraversed = *ppLevelInst;
+    }
+    return status;
+}
+
 /*!
  * Lazily allocates and initializes a level instance.
  */
@@ -1337,7 +1439,7 @@ _mmuWalkLevelInstAcquire
     NvBool               bNew       = NV_FALSE;
 
     // Lookup level instance.
-    if (NV_OK != btreeSearch(vaLo, (NODE**)&pLevelInst, (NODE*)pLevel->pInstances))
+    if (NV_OK != _mmuWalkLevelInstLookup(pLevel, vaLo, &pLevelInst))
     {
         NvU32 numBytes;
 
@@ -1367,6 +1469,9 @@ _mmuWalkLevelInstAcquire
         status = btreeInsert(&pLevelInst->node, (NODE**)&pLevel->pInstances);
         NV_ASSERT_OR_GOTO(NV_OK == status, done);
 
+        // The new instance is about to be traversed, so seed the cursor.
+        pLevel->pLastTraversed = pLevelInst;
+
         // Allocate entry tracker.
         numBytes = mmuFmtLevelEntryCount(pLevel->pFmt) * sizeof(MMU_ENTRY_INFO);
         pLevelInst->pStateTracker = portMemAllocNonPaged(numBytes);
@@ -1484,6 +1589,11 @@ _mmuWalkLevelInstRelease
 {
     NV_ASSERT(0 == pLevelInst->numValid);
     NV_ASSERT(0 == pLevelInst->numReserved);
+    // Invalidate the traversal cursor if it points at this instance.
+    if (pLevel->pLastTraversed == pLevelInst)
+    {
+        pLevel->pLastTraversed = NULL;
+    }
     // Unlink.
     btreeUnlink(&pLevelInst->node, (NODE**)&pLevel->pInstances);
     // Free.
@@ -1535,8 +1645,8 @@ _mmuWalkPdeAcquire
         for (i = 0; i < numSubLevels; ++i)
         {
             // Lookup sub-level instance.
-            if (NV_OK == btreeSearch(vaLo, (NODE**)&pCurSubLevelInsts[i],
-                                     (NODE*)pLevel->subLevels[i].pInstances))
+            if (NV_OK == _mmuWalkLevelInstLookup(pLevel->subLevels + i, vaLo,
+                                                 &pCurSubLevelInsts[i]))
             {
                 const MMU_FMT_LEVEL *pSubLevelFmt = pLevel->pFmt->subLevels + i;
                 const NvU64          minVaLimit =
@@ -1661,8 +1771,8 @@ _mmuWalkPdeRelease
     for (i = pLevel->pFmt->numSubLevels; i > 0; --i)
     {
         subLevel = i - 1;
-        if (NV_OK == btreeSearch(entryVaLo, (NODE**)&pSubLevelInsts[subLevel],
-                                 (NODE*)pLevel->subLevels[subLevel].pInstances))
+        if (NV_OK == _mmuWalkLevelInstLookup(pLevel->subLevels + subLevel,
+                                             entryVaLo, &pSubLevelInsts[subLevel]))
         {
             MMU_WALK_LEVEL_INST *pSubLevelInst = pSubLevelInsts[subLevel];
 
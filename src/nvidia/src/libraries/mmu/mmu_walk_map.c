@@ -60,6 +60,9 @@ mmuWalkMap
     status = mmuWalkRootAcquire(pWalk, vaLo, vaHi, NV_FALSE);
     NV_ASSERT_OR_RETURN(NV_OK == status, status);
 
+    // Track the range for batched flush/invalidate.
+    mmuWalkBatchTrackRange(pWalk, vaLo, vaHi);
+
     // Construct the map op params
     opParams.pOpCtx         = pTarget;
     opParams.opFunc         = _mmuWalkMap;
@@ -149,6 +149,15 @@ struct MMU_WALK_LEVEL
      */
     MMU_WALK_ITER_INFO    iterInfo;
 
+    /*!
+     * Cursor pointing at the level instance most recently traversed by a
+     * walk operation. Consecutive operations on adjacent VA ranges keep
+     * hitting the same upper-level instances, so this avoids re-searching
+     * @ref pInstances for every operation. Invalidated when the instance
+     * is released.
+     */
+    MMU_WALK_LEVEL_INST  *pLastTraversed;
+
     /*!
      * Tree tracking ranges of VA that are reserved (locked down)
      * for this level. @see mmuWalkReserveEntries.
@@ -216,6 +225,15 @@ struct MMU_WALK
     MMU_WALK_MEMDESC         *pStagingBuffer;
     NvBool                    bUseStagingBuffer;
     NvBool                    bInvalidateOnReserve;
+
+    /*!
+     * VA range accumulation for batched operations.
+     * @see mmuWalkBatchBegin
+     */
+    NvBool                    bBatching;
+    NvBool                    bBatchDirty;
+    NvU64                     batchVaLo;
+    NvU64                     batchVaHi;
 };
 
 /*!
@@ -323,6 +341,9 @@ const MMU_WALK_LEVEL *
 mmuWalkFindLevel(const MMU_WALK      *pWalk,
                  const MMU_FMT_LEVEL *pLevelFmt);
 
+void
+mmuWalkBatchTrackRange(MMU_WALK *pWalk, const NvU64 vaLo, const NvU64 vaHi);
+
 NV_STATUS
 mmuWalkProcessPdes(const MMU_WALK           *pWalk,
                    const MMU_WALK_OP_PARAMS *pOpParams,
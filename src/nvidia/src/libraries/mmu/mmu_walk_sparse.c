@@ -58,6 +58,9 @@ mmuWalkSparsify
     // Set field to indicate whether to use staging buffer.
     pWalk->bUseStagingBuffer = bUseStagingBuffer;
 
+    // Track the range for batched flush/invalidate.
+    mmuWalkBatchTrackRange(pWalk, vaLo, vaHi);
+
     // Sparsify
     if (pWalk->flags.bUseIterative)
     {
@@ -53,6 +53,9 @@ mmuWalkUnmap
     // Unmap starting from root if it exists.
     if (NULL != pWalk->root.pInstances)
     {
+        // Track the range for batched flush/invalidate.
+        mmuWalkBatchTrackRange(pWalk, vaLo, vaHi);
+
         if (pWalk->flags.bUseIterative)
         {
             status = mmuWalkProcessPdes(pWalk, &g_opParamsUnmap,
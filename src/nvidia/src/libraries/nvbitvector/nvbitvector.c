@@ -88,6 +88,33 @@ bitVectorClr_IMPL
     return NV_OK;
 }
 
+/**
+ * @brief Computes the mask of flags within a qword that fall inside a range
+ *
+ * @param[in] qwordIdx  Index of the qword within the bitvector array
+ * @param[in] range     Bit index range, inclusive on both ends
+ */
+static NvU64
+_bitVectorRangeMask
+(
+    NvU32 qwordIdx,
+    NV_RANGE range
+)
+{
+    NvU64 mask = NV_U64_MAX;
+
+    if (qwordIdx == (NvU32)NV_BITVECTOR_IDX((NvU16)range.lo))
+    {
+        mask &= ~(NVBIT64(NV_BITVECTOR_OFFSET((NvU16)range.lo)) - 1);
+    }
+    if (qwordIdx == (NvU32)NV_BITVECTOR_IDX((NvU16)range.hi))
+    {
+        mask &= (NV_U64_MAX >> (63 - NV_BITVECTOR_OFFSET((NvU16)range.hi)));
+    }
+
+    return mask;
+}
+
 /**
  * @brief Clears all flags within a range in pBitVector
  */
@@ -100,32 +127,21 @@ bitVectorClrRange_IMPL
 )
 {
     NvU64 *qword;
-    NvU16 idx;
-    NV_STATUS status = NV_OK;
+    NvU32 idx;
 
     NV_ASSERT_OR_RETURN(NULL != pBitVector, NV_ERR_INVALID_ARGUMENT);
     NV_ASSERT_OR_RETURN(rangeContains(rangeMake(0, bitVectorLast - 1), range),
                         NV_ERR_INVALID_ARGUMENT);
 
     qword = (NvU64 *)&pBitVector->qword;
-    for (idx = (NvU16)range.lo; idx <= (NvU16)range.hi; ++idx)
+    for (idx = (NvU32)NV_BITVECTOR_IDX((NvU16)range.lo);
+         idx <= (NvU32)NV_BITVECTOR_IDX((NvU16)range.hi);
+         idx++)
     {
-        if ((0 == NV_BITVECTOR_OFFSET(idx)) &&
-            (rangeContains(range, rangeMake(idx + 63, idx + 63))))
-        {
-            qword[NV_BITVECTOR_IDX(idx)] = 0x0;
-            idx += 63;
-            continue;
-        }
-
-        status = bitVectorClr_IMPL(pBitVector, bitVectorLast, idx);
-        if (NV_OK != status)
-        {
-            return status;
-        }
+        qword[idx] &= ~_bitVectorRangeMask(idx, range);
     }
 
-    return status;
+    return NV_OK;
 }
 
 /**
@@ -187,32 +203,21 @@ bitVectorSetRange_IMPL
 )
 {
     NvU64 *qword;
-    NvU16 idx;
-    NV_STATUS status = NV_OK;
+    NvU32 idx;
 
     NV_ASSERT_OR_RETURN(NULL != pBitVector, NV_ERR_INVALID_ARGUMENT);
     NV_ASSERT_OR_RETURN(rangeContains(rangeMake(0, bitVectorLast - 1), range),
                         NV_ERR_INVALID_ARGUMENT);
 
     qword = (NvU64 *)&pBitVector->qword;
-    for (idx = (NvU16)range.lo; idx <= (NvU16)range.hi; ++idx)
+    for (idx = (NvU32)NV_BITVECTOR_IDX((NvU16)range.lo);
+         idx <= (NvU32)NV_BITVECTOR_IDX((NvU16)range.hi);
+         idx++)
     {
-        if ((0 == NV_BITVECTOR_OFFSET(idx)) &&
-            (rangeContains(range, rangeMake(idx + 63, idx + 63))))
-        {
-            qword[NV_BITVECTOR_IDX(idx)] = (NV_U64_MAX);
-            idx += 63;
-            continue;
-        }
-
-        status = bitVectorSet_IMPL(pBitVector, bitVectorLast, idx);
-        if (NV_OK != status)
-        {
-            return status;
-        }
+        qword[idx] |= _bitVectorRangeMask(idx, range);
     }
 
-    return status;
+    return NV_OK;
 }
 
 /**
@@ -250,32 +255,21 @@ bitVectorInvRange_IMPL
 )
 {
     NvU64 *qword;
-    NvU16 idx;
-    NV_STATUS status = NV_OK;
+    NvU32 idx;
 
     NV_ASSERT_OR_RETURN(NULL != pBitVector, NV_ERR_INVALID_ARGUMENT);
     NV_ASSERT_OR_RETURN(rangeContains(rangeMake(0, bitVectorLast - 1), range),
                         NV_ERR_INVALID_ARGUMENT);
 
     qword = (NvU64 *)&pBitVector->qword;
-    for (idx = (NvU16)range.lo; idx <= (NvU16)range.hi; ++idx)
+    for (idx = (NvU32)NV_BITVECTOR_IDX((NvU16)range.lo);
+         idx <= (NvU32)NV_BITVECTOR_IDX((NvU16)range.hi);
+         idx++)
     {
-        if ((0 == NV_BITVECTOR_OFFSET(idx)) &&
-            (rangeContains(range, rangeMake(idx + 63, idx + 63))))
-        {
-            qword[NV_BITVECTOR_IDX(idx)] = ~qword[NV_BITVECTOR_IDX(idx)];
-            idx += 63;
-            continue;
-        }
-
-        status = bitVectorInv_IMPL(pBitVector, bitVectorLast, idx);
-        if (NV_OK != status)
-        {
-            return status;
-        }
+        qword[idx] ^= _bitVectorRangeMask(idx, range);
     }
 
-    return status;
+    return NV_OK;
 }
 
 /**
@@ -818,6 +812,135 @@ bitVectorCountSetBits_IMPL
     return count;
 }
 
+/**
+ * @brief Returns the number of set bits within a range in pBitVector.
+ */
+NvU32
+bitVectorCountSetBitsRange_IMPL
+(
+    const NV_BITVECTOR *pBitVector,
+    NvU16 bitVectorLast,
+    NV_RANGE range
+)
+{
+    const NvU64 *qword;
+    NvU32 idx;
+    NvU32 count;
+
+    NV_ASSERT_OR_RETURN(NULL != pBitVector, 0);
+    NV_ASSERT_OR_RETURN(rangeContains(rangeMake(0, bitVectorLast - 1), range),
+                        0);
+
+    count = 0;
+    qword = (const NvU64 *)&pBitVector->qword;
+    for (idx = (NvU32)NV_BITVECTOR_IDX((NvU16)range.lo);
+         idx <= (NvU32)NV_BITVECTOR_IDX((NvU16)range.hi);
+         idx++)
+    {
+        count += nvPopCount64(qword[idx] & _bitVectorRangeMask(idx, range));
+    }
+
+    return count;
+}
+
+/**
+ * @brief Returns the bit index of the first set flag in pBitVector at or above
+ *        bit index startIdx.
+ *
+ * @note in the absence of set flags at or above startIdx, the index of the
+ *       first invalid flag is returned.
+ */
+NvU32
+bitVectorFindNextSet_IMPL
+(
+    const NV_BITVECTOR *pBitVector,
+    NvU16 bitVectorLast,
+    NvU32 startIdx
+)
+{
+    const NvU64 *qword;
+    NvU32 idx;
+    NvU32 arraySize = NV_BITVECTOR_ARRAY_SIZE(bitVectorLast);
+    NvU32 qwordOffset = NV_BITVECTOR_OFFSET(bitVectorLast - 1);
+    NvU64 mask;
+
+    NV_ASSERT_OR_RETURN(NULL != pBitVector, bitVectorLast);
+
+    if (startIdx >= bitVectorLast)
+    {
+        return bitVectorLast;
+    }
+
+    qword = (const NvU64 *)&pBitVector->qword;
+    for (idx = NV_BITVECTOR_IDX(startIdx); idx < arraySize; idx++)
+    {
+        mask = (idx < arraySize - 1) ? NV_U64_MAX :
+               (NV_U64_MAX >> (63 - qwordOffset));
+
+        if (idx == NV_BITVECTOR_IDX(startIdx))
+        {
+            mask &= ~(NVBIT64(NV_BITVECTOR_OFFSET(startIdx)) - 1);
+        }
+
+        if (0x0 != (qword[idx] & mask))
+        {
+            return ((idx * (sizeof(NvU64) * 8)) +
+                    portUtilCountTrailingZeros64(qword[idx] & mask));
+        }
+    }
+
+    return bitVectorLast;
+}
+
+/**
+ * @brief Returns the bit index of the first cleared flag in pBitVector at or
+ *        above bit index startIdx.
+ *
+ * @note in the absence of cleared flags at or above startIdx, the index of the
+ *       first invalid flag is returned.
+ */
+NvU32
+bitVectorFindNextClear_IMPL
+(
+    const NV_BITVECTOR *pBitVector,
+    NvU16 bitVectorLast,
+    NvU32 startIdx
+)
+{
+    const NvU64 *qword;
+    NvU32 idx;
+    NvU32 arraySize = NV_BITVECTOR_ARRAY_SIZE(bitVectorLast);
+    NvU32 qwordOffset = NV_BITVECTOR_OFFSET(bitVectorLast - 1);
+    NvU64 mask;
+
+    NV_ASSERT_OR_RETURN(NULL != pBitVector, bitVectorLast);
+
+    if (startIdx >= bitVectorLast)
+    {
+        return bitVectorLast;
+    }
+
+    qword = (const NvU64 *)&pBitVector->qword;
+    for (idx = NV_BITVECTOR_IDX(startIdx); idx < arraySize; idx++)
+    {
+        mask = (idx < arraySize - 1) ? NV_U64_MAX :
+               (NV_U64_MAX >> (63 - qwordOffset));
+
+        if (idx == NV_BITVECTOR_IDX(startIdx))
+        {
+            mask &= ~(NVBIT64(NV_BITVECTOR_OFFSET(startIdx)) - 1);
+        }
+
+        if (0x0 != ((~qword[idx]) & mask))
+        {
+            return ((idx * (sizeof(NvU64) * 8)) +
+                    portUtilCountTrailingZeros64((~qword[idx]) & mask));
+        }
+    }
+
+    return bitVectorLast;
+}
+
 /**
  * @brief Exports the bitVector data to an NvU64 raw bitmask array.
  */
@@ -346,18 +346,96 @@ const struct NVOC_EXPORTED_METHOD_DEF* nvocGetExportedMethodDefFromMethodInfo_IM
     return NULL;
 }
 
+//
+// Cache of resolved exported method defs, keyed by (classId, methodId).
+//
+// Control dispatch resolves the same handful of (class, cmd) pairs over and
+// over on control-heavy workloads, and each miss walks every relative of the
+// class with a binary search per export table. The method def tables are
+// static const data, so a given key always resolves to the same def and the
+// cache never needs invalidation.
+//
+// Slots are claimed for update by a CAS to a busy sentinel, so concurrent
+// fills cannot interleave a key from one fill with a pointer from another;
+// lookups are lockless and re-check the key around the pointer read. Class
+// ids are at most NVOC_CLASS_ID_MAX_WIDTH (24) bits wide, so a real key can
+// never equal the sentinel.
+//
+#define NVOC_EXPORT_CACHE_SIZE     64
+#define NVOC_EXPORT_CACHE_KEY_BUSY NV_U64_MAX
+
+static struct
+{
+    volatile NvU64 key; // (classId << 32) | methodId; 0 when empty
+    const struct NVOC_EXPORTED_METHOD_DEF *pDef;
+} g_nvocExportCache[NVOC_EXPORT_CACHE_SIZE];
+
+static NV_INLINE NvU32 _nvocExportCacheIndex(NvU64 key)
+{
+    return (NvU32)((key * 0x9E3779B97F4A7C15ULL) >> 58) %
+           NVOC_EXPORT_CACHE_SIZE;
+}
+
+static const struct NVOC_EXPORTED_METHOD_DEF *_nvocExportCacheGet(NvU64 key)
+{
+    const struct NVOC_EXPORTED_METHOD_DEF *pDef;
+    NvU32 idx = _nvocExportCacheIndex(key);
+
+    if (g_nvocExportCache[idx].key != key)
+        return NULL;
+
+    portAtomicMemoryFenceLoad();
+    pDef = g_nvocExportCache[idx].pDef;
+    portAtomicMemoryFenceLoad();
+
+    if (g_nvocExportCache[idx].key != key)
+        return NULL;
+
+    return pDef;
+}
+
+static void _nvocExportCachePut(NvU64 key, const struct NVOC_EXPORTED_METHOD_DEF *pDef)
+{
+    NvU32 idx = _nvocExportCacheIndex(key);
+    NvU64 oldKey = g_nvocExportCache[idx].key;
+
+    if (oldKey == NVOC_EXPORT_CACHE_KEY_BUSY)
+        return;
+
+    // If another fill owns the slot, just skip caching this result.
+    if (!portAtomicExCompareAndSwapU64(&g_nvocExportCache[idx].key,
+                                       NVOC_EXPORT_CACHE_KEY_BUSY, oldKey))
+        return;
+
+    g_nvocExportCache[idx].pDef = pDef;
+    portAtomicMemoryFenceStore();
+    portAtomicExSetU64(&g_nvocExportCache[idx].key, key);
+}
+
 const struct NVOC_EXPORTED_METHOD_DEF *objGetExportedMethodDef_IMPL(Dynamic *pObj, NvU32 methodId)
 {
     const struct NVOC_CASTINFO *const pCastInfo = pObj->__nvoc_rtti->pClassDef->pCastInfo;
     const NvU32 numRelatives = pCastInfo->numRelatives;
     const struct NVOC_RTTI *const *relatives = pCastInfo->relatives;
+    const struct NVOC_EXPORTED_METHOD_DEF *pDef;
+    NvU64 key;
     NvU32 i;
 
+    key = ((NvU64)pObj->__nvoc_rtti->pClassDef->classInfo.classId << 32) |
+          methodId;
+
+    pDef = _nvocExportCacheGet(key);
+    if (pDef != NULL)
+        return pDef;
+
     for (i = 0; i < numRelatives; i++)
     {
-        const void *pDef = nvocGetExportedMethodDefFromMethodInfo_IMPL(relatives[i]->pClassDef->pExportInfo, methodId);
+        pDef = nvocGetExportedMethodDefFromMethodInfo_IMPL(relatives[i]->pClassDef->pExportInfo, methodId);
         if (pDef != NULL)
+        {
+            _nvocExportCachePut(key, pDef);
             return pDef;
+        }
     }
 
     return NULL;
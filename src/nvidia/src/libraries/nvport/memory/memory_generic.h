@@ -220,3 +220,158 @@ portMemSet
     return pData;
 }
 #endif
+
+#if defined(PORT_MEM_USE_GENERIC_portMemCopyWide)
+void *
+portMemCopyWide
+(
+    void       *pDestination,
+    NvLength    destSize,
+    const void *pSource,
+    NvLength    srcSize
+)
+{
+    NvU8 *pDst8;
+    const NvU8 *pSrc8;
+    NvLength qwords;
+    NvLength bytes;
+
+    // API guarantees this is a NOP when destSize==0
+    if (destSize == 0)
+    {
+        return pDestination;
+    }
+
+    PORT_ASSERT_CHECKED(pDestination != NULL);
+    PORT_ASSERT_CHECKED(pSource      != NULL);
+    PORT_ASSERT_CHECKED(srcSize      <= destSize);
+    PORT_ASSERT_CHECKED(!portUtilCheckOverlap((const NvU8*)pDestination, destSize,
+                                              (const NvU8*)pSource,      srcSize));
+
+    if ((pSource == NULL) || (pDestination == NULL) || (srcSize > destSize))
+    {
+        return NULL;
+    }
+
+    //
+    // Wide accesses require both pointers to reach 64-bit alignment together.
+    // Mutually misaligned buffers take the regular path.
+    //
+    if ((((NvUPtr)pDestination ^ (NvUPtr)pSource) & (sizeof(NvU64) - 1)) != 0)
+    {
+        return portMemCopy(pDestination, destSize, pSource, srcSize);
+    }
+
+    pDst8 = (NvU8*)pDestination;
+    pSrc8 = (const NvU8*)pSource;
+    bytes = srcSize;
+
+    // Head: advance byte-wise until 64-bit aligned.
+    while ((bytes > 0) && (((NvUPtr)pDst8 & (sizeof(NvU64) - 1)) != 0))
+    {
+        PORT_MEM_WR08(pDst8++, PORT_MEM_RD08(pSrc8++));
+        bytes--;
+    }
+
+    qwords = bytes / sizeof(NvU64);
+    bytes  = bytes % sizeof(NvU64);
+
+    // Body: 4x unrolled 64-bit transfers (32 bytes per iteration).
+    while (qwords >= 4)
+    {
+        NvU64 q0 = PORT_MEM_RD64((const NvU64*)pSrc8 + 0);
+        NvU64 q1 = PORT_MEM_RD64((const NvU64*)pSrc8 + 1);
+        NvU64 q2 = PORT_MEM_RD64((const NvU64*)pSrc8 + 2);
+        NvU64 q3 = PORT_MEM_RD64((const NvU64*)pSrc8 + 3);
+        PORT_MEM_WR64((NvU64*)pDst8 + 0, q0);
+        PORT_MEM_WR64((NvU64*)pDst8 + 1, q1);
+        PORT_MEM_WR64((NvU64*)pDst8 + 2, q2);
+        PORT_MEM_WR64((NvU64*)pDst8 + 3, q3);
+        pDst8  += 4 * sizeof(NvU64);
+        pSrc8  += 4 * sizeof(NvU64);
+        qwords -= 4;
+    }
+    while (qwords != 0)
+    {
+        PORT_MEM_WR64((NvU64*)pDst8, PORT_MEM_RD64((const NvU64*)pSrc8));
+        pDst8 += sizeof(NvU64);
+        pSrc8 += sizeof(NvU64);
+        qwords--;
+    }
+
+    // Tail
+    while (bytes != 0)
+    {
+        PORT_MEM_WR08(pDst8++, PORT_MEM_RD08(pSrc8++));
+        bytes--;
+    }
+
+    return pDestination;
+}
+#endif
+
+#if defined(PORT_MEM_USE_GENERIC_portMemSetWide)
+void *
+portMemSetWide
+(
+    void    *pData,
+    NvU8     value,
+    NvLength lengthBytes
+)
+{
+    NvU8 *pDst8 = (NvU8*)pData;
+    NvU64 wideValue;
+    NvLength qwords;
+
+    if (lengthBytes == 0)
+    {
+        return pData;
+    }
+    if (pData == NULL)
+    {
+        return pData;
+    }
+
+    // Replicate the byte across all 8 lanes of the wide store.
+    wideValue = value;
+    wideValue |= wideValue << 8;
+    wideValue |= wideValue << 16;
+    wideValue |= wideValue << 32;
+
+    // Head: advance byte-wise until 64-bit aligned.
+    while ((lengthBytes > 0) && (((NvUPtr)pDst8 & (sizeof(NvU64) - 1)) != 0))
+    {
+        PORT_MEM_WR08(pDst8++, value);
+        lengthBytes--;
+    }
+
+    qwords      = lengthBytes / sizeof(NvU64);
+    lengthBytes = lengthBytes % sizeof(NvU64);
+
+    // Body: 4x unrolled 64-bit stores (32 bytes per iteration).
+    while (qwords >= 4)
+    {
+        PORT_MEM_WR64((NvU64*)pDst8 + 0, wideValue);
+        PORT_MEM_WR64((NvU64*)pDst8 + 1, wideValue);
+        PORT_MEM_WR64((NvU64*)pDst8 + 2, wideValue);
+        PORT_MEM_WR64((NvU64*)pDst8 + 3, wideValue);
+        pDst8  += 4 * sizeof(NvU64);
+        qwords -= 4;
+    }
+    while (qwords != 0)
+    {
+        PORT_MEM_WR64((NvU64*)pDst8, wideValue);
+        pDst8 += sizeof(NvU64);
+        qwords--;
+    }
+
+    // Tail
+    while (lengthBytes != 0)
+    {
+        PORT_MEM_WR08(pDst8++, value);
+        lengthBytes--;
+    }
+
+    return pData;
+}
+#endif
@@ -73,11 +73,74 @@
     ((*pVal == oldVal) ? ((*((volatile NvU32 *)pVal) = newVal), NV_TRUE) : NV_FALSE)
 #endif // !PORT_MEM_THREAD_SAFE_ALLOCATIONS
 
+//
+// The slab cache and the sharded aggregate counter both spread hot state
+// across shards selected by hashing the current thread id, so they need the
+// THREAD module in addition to thread safe allocations.
+//
+#if PORT_MEM_USE_SLAB_CACHE && PORT_MEM_THREAD_SAFE_ALLOCATIONS
+#define PORT_MEM_SLAB_ENABLED 1
+#else
+#define PORT_MEM_SLAB_ENABLED 0
+#endif
+
+#if PORT_MEM_TRACK_USE_COUNTER && PORT_MEM_THREAD_SAFE_ALLOCATIONS && \
+    PORT_IS_MODULE_SUPPORTED(thread)
+#define PORT_MEM_COUNTER_SHARDED 1
+#else
+#define PORT_MEM_COUNTER_SHARDED 0
+#endif
+
+#define PORT_MEM_SHARD_COUNT 16
+
 struct PORT_MEM_ALLOCATOR_IMPL
 {
     PORT_MEM_ALLOCATOR_TRACKING tracking;
 };
 
+#if PORT_MEM_SLAB_ENABLED
+//
+// Every block handed out by the global paged/nonpaged backends is prefixed
+// with this tag, so the shared free path can tell cached slab objects from
+// direct OS allocations. 16 bytes keeps the payload alignment the OS
+// allocator provided.
+//
+#define PORT_MEM_SLAB_MAGIC        0x736c6162 // 'slab'
+#define PORT_MEM_SLAB_DIRECT_MAGIC 0x64697263 // 'dirc'
+
+typedef struct PORT_MEM_SLAB_TAG
+{
+    NvU32 magic;
+    NvU8  sizeClass;
+    NvU8  pad[11];
+} PORT_MEM_SLAB_TAG;
+
+// Free objects are linked through their (unused) payload.
+typedef struct PORT_MEM_SLAB_FREE_OBJ
+{
+    struct PORT_MEM_SLAB_FREE_OBJ *pNext;
+} PORT_MEM_SLAB_FREE_OBJ;
+
+#define PORT_MEM_SLAB_SIZE_CLASSES 4
+#define PORT_MEM_SLAB_BATCH        16 // objects allocated per refill
+#define PORT_MEM_SLAB_MAX_PER_LIST 64 // flush half back to the OS above this
+
+//
+// Per-shard magazine: one free list per size class, under a per-shard lock.
+// The pad keeps neighboring shards off each other's cache lines.
+//
+typedef struct PORT_MEM_SLAB_SHARD
+{
+    void *lock;
+    PORT_MEM_SLAB_FREE_OBJ *pFree[PORT_MEM_SLAB_SIZE_CLASSES];
+    NvU32 freeCount[PORT_MEM_SLAB_SIZE_CLASSES];
+    NvU8 pad[64];
+} PORT_MEM_SLAB_SHARD;
+
+static const NvLength portMemSlabClassSizes[PORT_MEM_SLAB_SIZE_CLASSES] =
+    { 64, 128, 256, 512 };
+#endif // PORT_MEM_SLAB_ENABLED
+
 //
 // Debug print macros
 //
@@ -172,6 +235,22 @@ static struct PORT_MEM_GLOBALS
     } alloc;
     NvU32 initCount;
     NvU32 totalAllocators;
+#if PORT_MEM_SLAB_ENABLED
+    PORT_MEM_SLAB_SHARD slabShards[PORT_MEM_SHARD_COUNT];
+    volatile NvU32 slabActive;
+#endif
+#if PORT_MEM_COUNTER_SHARDED
+    //
+    // The aggregate counter is bumped by every tracked alloc and free in the
+    // system, so it is sharded like the slab cache; mainTracking.counter is
+    // unused and readers sum the shards instead.
+    //
+    struct
+    {
+        PORT_MEM_COUNTER counter;
+        NvU8 pad[64];
+    } mainCounterShards[PORT_MEM_SHARD_COUNT];
+#endif
 #if PORT_MEM_TRACK_USE_LIMIT
     NvBool bLimitEnabled;
     NvLength limitPid[PORT_MEM_LIMIT_MAX_PIDS];
@@ -179,6 +258,19 @@ static struct PORT_MEM_GLOBALS
 #endif
 } portMemGlobals;
 
+#if PORT_MEM_SLAB_ENABLED || PORT_MEM_COUNTER_SHARDED
+static NV_INLINE NvU32
+_portMemShardIndex(void)
+{
+    //
+    // Fibonacci hash of the thread id; kernel threads rarely migrate, so
+    // this approximates a per-CPU split without an nvport CPU-id API.
+    //
+    return (NvU32)((portThreadGetCurrentThreadId() *
+                    0x9E3779B97F4A7C15ull) >> 60);
+}
+#endif
+
 //
 // Memory counter implementation
 //
@@ -666,6 +758,265 @@ _portMemLimitExceeded(NvU32 pid, NvLength size)
 #define PORT_MEM_LIMIT_EXCEEDED(pid, size)  (NV_FALSE)
 #endif // PORT_MEM_TRACK_USE_LIMIT
 
+//
+// Sharded slab/magazine cache implementation
+//
+#if PORT_MEM_SLAB_ENABLED
+static NvBool
+_portMemSlabClassForSize(NvLength length, NvU32 *pSizeClass)
+{
+    NvU32 i;
+    for (i = 0; i < PORT_MEM_SLAB_SIZE_CLASSES; i++)
+    {
+        if (length <= portMemSlabClassSizes[i])
+        {
+            *pSizeClass = i;
+            return NV_TRUE;
+        }
+    }
+    return NV_FALSE;
+}
+
+static void *
+_portMemSlabAllocDirect(NvLength length, NvBool bPaged)
+{
+    PORT_MEM_SLAB_TAG *pTag;
+    NvLength taggedLength;
+
+    if (!portSafeAddLength(length, sizeof(PORT_MEM_SLAB_TAG), &taggedLength))
+        return NULL;
+
+    pTag = bPaged ? _portMemAllocPagedUntracked(taggedLength)
+                  : _portMemAllocNonPagedUntracked(taggedLength);
+    if (pTag == NULL)
+        return NULL;
+
+    pTag->magic     = PORT_MEM_SLAB_DIRECT_MAGIC;
+    pTag->sizeClass = 0;
+    return pTag + 1;
+}
+
+static void *
+_portMemSlabAllocObject(NvU32 sizeClass)
+{
+    PORT_MEM_SLAB_TAG *pTag;
+
+    pTag = _portMemAllocNonPagedUntracked(sizeof(PORT_MEM_SLAB_TAG) +
+                                          portMemSlabClassSizes[sizeClass]);
+    if (pTag == NULL)
+        return NULL;
+
+    pTag->magic     = PORT_MEM_SLAB_MAGIC;
+    pTag->sizeClass = (NvU8)sizeClass;
+    return pTag + 1;
+}
+
+static void *
+_portMemSlabAlloc(NvLength length, NvBool bPaged)
+{
+    NvU32 sizeClass;
+    PORT_MEM_SLAB_SHARD *pShard;
+    PORT_MEM_SLAB_FREE_OBJ *pObj;
+    PORT_MEM_SLAB_FREE_OBJ *pBatchHead = NULL;
+    PORT_MEM_SLAB_FREE_OBJ *pBatchTail = NULL;
+    NvU32 batchCount = 0;
+    void *pRet = NULL;
+    NvU32 i;
+
+    //
+    // Paged memory is never cached; magazines hand out nonpaged objects.
+    //
+    if (bPaged || (portMemGlobals.slabActive == 0) ||
+        !_portMemSlabClassForSize(length, &sizeClass))
+    {
+        return _portMemSlabAllocDirect(length, bPaged);
+    }
+
+    pShard = &portMemGlobals.slabShards[_portMemShardIndex()];
+
+    PORT_MEM_LOCK_ACQUIRE(pShard->lock);
+    pObj = pShard->pFree[sizeClass];
+    if (pObj != NULL)
+    {
+        pShard->pFree[sizeClass] = pObj->pNext;
+        pShard->freeCount[sizeClass]--;
+    }
+    PORT_MEM_LOCK_RELEASE(pShard->lock);
+
+    if (pObj != NULL)
+        return pObj;
+
+    //
+    // Miss: refill a batch outside the lock, keep one object for the caller
+    // and donate the rest to this shard's magazine.
+    //
+    for (i = 0; i < PORT_MEM_SLAB_BATCH; i++)
+    {
+        void *pNew = _portMemSlabAllocObject(sizeClass);
+        if (pNew == NULL)
+            break;
+        if (pRet == NULL)
+        {
+            pRet = pNew;
+        }
+        else
+        {
+            ((PORT_MEM_SLAB_FREE_OBJ *)pNew)->pNext = pBatchHead;
+            if (pBatchHead == NULL)
+                pBatchTail = pNew;
+            pBatchHead = pNew;
+            batchCount++;
+        }
+    }
+
+    if (batchCount > 0)
+    {
+        PORT_MEM_LOCK_ACQUIRE(pShard->lock);
+        pBatchTail->pNext = pShard->pFree[sizeClass];
+        pShard->pFree[sizeClass] = pBatchHead;
+        pShard->freeCount[sizeClass] += batchCount;
+        PORT_MEM_LOCK_RELEASE(pShard->lock);
+    }
+
+    if (pRet == NULL)
+    {
+        // The OS refused a class-sized block; the raw request may be smaller.
+        pRet = _portMemSlabAllocDirect(length, NV_FALSE);
+    }
+    return pRet;
+}
+
+static void
+_portMemSlabFree(void *pMem)
+{
+    PORT_MEM_SLAB_TAG *pTag = (PORT_MEM_SLAB_TAG *)pMem - 1;
+
+    if ((pTag->magic == PORT_MEM_SLAB_MAGIC) &&
+        (portMemGlobals.slabActive != 0))
+    {
+        NvU32 sizeClass = pTag->sizeClass;
+        PORT_MEM_SLAB_SHARD *pShard =
+            &portMemGlobals.slabShards[_portMemShardIndex()];
+        PORT_MEM_SLAB_FREE_OBJ *pObj = (PORT_MEM_SLAB_FREE_OBJ *)pMem;
+        PORT_MEM_SLAB_FREE_OBJ *pFlush = NULL;
+
+        //
+        // Objects go back to the freeing thread's shard; the tag, not the
+        // shard, says which list an object belongs on.
+        //
+        PORT_MEM_LOCK_ACQUIRE(pShard->lock);
+        pObj->pNext = pShard->pFree[sizeClass];
+        pShard->pFree[sizeClass] = pObj;
+        pShard->freeCount[sizeClass]++;
+        if (pShard->freeCount[sizeClass] > PORT_MEM_SLAB_MAX_PER_LIST)
+        {
+            // Unhook half of the list and release it outside the lock.
+            NvU32 flushCount = pShard->freeCount[sizeClass] / 2;
+            NvU32 i;
+            for (i = 0; i < flushCount; i++)
+            {
+                PORT_MEM_SLAB_FREE_OBJ *p = pShard->pFree[sizeClass];
+                pShard->pFree[sizeClass] = p->pNext;
+                p->pNext = pFlush;
+                pFlush = p;
+            }
+            pShard->freeCount[sizeClass] -= flushCount;
+        }
+        PORT_MEM_LOCK_RELEASE(pShard->lock);
+
+        while (pFlush != NULL)
+        {
+            PORT_MEM_SLAB_FREE_OBJ *p = pFlush;
+            pFlush = pFlush->pNext;
+            _portMemFreeUntracked((PORT_MEM_SLAB_TAG *)p - 1);
+        }
+        return;
+    }
+
+    // Direct allocation, or a cached object freed after shutdown.
+    _portMemFreeUntracked(pTag);
+}
+
+static void
+_portMemSlabInit(void)
+{
+    NvU32 i;
+
+    portMemSet(portMemGlobals.slabShards, 0,
+               sizeof(portMemGlobals.slabShards));
+    for (i = 0; i < PORT_MEM_SHARD_COUNT; i++)
+    {
+        PORT_MEM_LOCK_INIT(portMemGlobals.slabShards[i].lock);
+    }
+    PORT_MEM_ATOMIC_SET_U32(&portMemGlobals.slabActive, 1);
+}
+
+static void
+_portMemSlabShutdown(void)
+{
+    NvU32 i, sizeClass;
+
+    PORT_MEM_ATOMIC_SET_U32(&portMemGlobals.slabActive, 0);
+    for (i = 0; i < PORT_MEM_SHARD_COUNT; i++)
+    {
+        PORT_MEM_SLAB_SHARD *pShard = &portMemGlobals.slabShards[i];
+        for (sizeClass = 0; sizeClass < PORT_MEM_SLAB_SIZE_CLASSES; sizeClass++)
+        {
+            while (pShard->pFree[sizeClass] != NULL)
+            {
+                PORT_MEM_SLAB_FREE_OBJ *p = pShard->pFree[sizeClass];
+                pShard->pFree[sizeClass] = p->pNext;
+                _portMemFreeUntracked((PORT_MEM_SLAB_TAG *)p - 1);
+            }
+            pShard->freeCount[sizeClass] = 0;
+        }
+        PORT_MEM_LOCK_DESTROY(pShard->lock);
+    }
+}
+#endif // PORT_MEM_SLAB_ENABLED
+
+//
+// The aggregate counter shared by all allocators is sharded like the slab
+// cache; everything else keeps its per-allocator counter.
+//
+static NV_INLINE PORT_MEM_COUNTER *
+_portMemMainCounter(void)
+{
+#if PORT_MEM_COUNTER_SHARDED
+    return &portMemGlobals.mainCounterShards[_portMemShardIndex()].counter;
+#else
+    return &portMemGlobals.mainTracking.counter;
+#endif
+}
+
+#if PORT_MEM_COUNTER_SHARDED
+static void
+_portMemMainCounterSnapshot(PORT_MEM_COUNTER *pCounter)
+{
+    NvU32 i;
+
+    portMemSet(pCounter, 0, sizeof(*pCounter));
+    for (i = 0; i < PORT_MEM_SHARD_COUNT; i++)
+    {
+        const PORT_MEM_COUNTER *pShard =
+            &portMemGlobals.mainCounterShards[i].counter;
+
+        //
+        // Active and total counts are sums of deltas, so the modular sums are
+        // exact even when a block is freed on a different shard than it was
+        // allocated on. Peaks are per-shard maxima, so their sum is an upper
+        // bound on the true peak.
+        //
+        pCounter->activeAllocs += pShard->activeAllocs;
+        pCounter->totalAllocs  += pShard->totalAllocs;
+        pCounter->peakAllocs   += pShard->peakAllocs;
+        pCounter->activeSize   += pShard->activeSize;
+        pCounter->totalSize    += pShard->totalSize;
+        pCounter->peakSize     += pShard->peakSize;
+    }
+}
+#endif // PORT_MEM_COUNTER_SHARDED
+
 static NV_INLINE PORT_MEM_ALLOCATOR_TRACKING *
 _portMemGetTracking
 (
@@ -695,6 +1046,17 @@ portMemInitialize(void)
     PORT_MEM_LIST_INIT(&portMemGlobals.mainTracking);
     PORT_MEM_LOCK_INIT(portMemGlobals.trackingLock);
 
+#if PORT_MEM_COUNTER_SHARDED
+    {
+        NvU32 i;
+        for (i = 0; i < PORT_MEM_SHARD_COUNT; i++)
+            PORT_MEM_COUNTER_INIT(&portMemGlobals.mainCounterShards[i].counter);
+    }
+#endif
+#if PORT_MEM_SLAB_ENABLED
+    _portMemSlabInit();
+#endif
+
 #if PORT_MEM_TRACK_USE_LIMIT
     // Initialize process heap limit to max int (i.e. no limit)
     portMemGlobals.bLimitEnabled = NV_FALSE;
@@ -764,6 +1126,9 @@ portMemShutdown(NvBool bForceSilent)
         _portMemTrackingRelease(&portMemGlobals.alloc.pagedImpl.tracking, NV_FALSE);
     }
 
+#if PORT_MEM_SLAB_ENABLED
+    _portMemSlabShutdown();
+#endif
     PORT_MEM_LOCK_DESTROY(portMemGlobals.trackingLock);
     PORT_MEM_LIST_DESTROY(&portMemGlobals.mainTracking);
     portMemSet(&portMemGlobals, 0, sizeof(portMemGlobals));
@@ -1055,9 +1420,20 @@ portMemPrintTrackingInfo
     else
         portDbgPrintf("[NvPort] ======== Memory Allocator %p Tracking ======== \n", pTracking->pAllocator);
 
-    if (pTracking->counter.activeAllocs != 0)
-        portDbgPrintf("  !!! MEMORY LEAK DETECTED (%u blocks) !!!\n",
-                      pTracking->counter.activeAllocs);
+    {
+        NvU32 activeAllocs = pTracking->counter.activeAllocs;
+#if PORT_MEM_COUNTER_SHARDED
+        if (pTracking == &portMemGlobals.mainTracking)
+        {
+            PORT_MEM_COUNTER mainCounter;
+            _portMemMainCounterSnapshot(&mainCounter);
+            activeAllocs = mainCounter.activeAllocs;
+        }
+#endif
+        if (activeAllocs != 0)
+            portDbgPrintf("  !!! MEMORY LEAK DETECTED (%u blocks) !!!\n",
+                          activeAllocs);
+    }
 
 #if PORT_MEM_TRACK_USE_CALLERINFO
     {
@@ -1175,12 +1551,24 @@ portMemExTrackingGetActiveStats
 )
 {
     PORT_MEM_ALLOCATOR_TRACKING *pTracking = _portMemGetTracking(pAllocator);
+    const PORT_MEM_COUNTER *pCounter;
+#if PORT_MEM_COUNTER_SHARDED
+    PORT_MEM_COUNTER mainCounter;
+#endif
     if (pTracking == NULL)
     {
         return NV_ERR_OBJECT_NOT_FOUND;
     }
-    pStats->numAllocations = pTracking->counter.activeAllocs;
-    pStats->usefulSize     = pTracking->counter.activeSize;
+    pCounter = &pTracking->counter;
+#if PORT_MEM_COUNTER_SHARDED
+    if (pTracking == &portMemGlobals.mainTracking)
+    {
+        _portMemMainCounterSnapshot(&mainCounter);
+        pCounter = &mainCounter;
+    }
+#endif
+    pStats->numAllocations = pCounter->activeAllocs;
+    pStats->usefulSize     = pCounter->activeSize;
     pStats->metaSize       = pStats->numAllocations * PORT_MEM_STAGING_SIZE;
     pStats->allocatedSize  = pStats->usefulSize + pStats->metaSize;
     return NV_OK;
@@ -1196,12 +1584,24 @@ portMemExTrackingGetTotalStats
 )
 {
     PORT_MEM_ALLOCATOR_TRACKING *pTracking = _portMemGetTracking(pAllocator);
+    const PORT_MEM_COUNTER *pCounter;
+#if PORT_MEM_COUNTER_SHARDED
+    PORT_MEM_COUNTER mainCounter;
+#endif
     if (pTracking == NULL)
     {
         return NV_ERR_OBJECT_NOT_FOUND;
     }
-    pStats->numAllocations = pTracking->counter.totalAllocs;
-    pStats->usefulSize     = pTracking->counter.totalSize;
+    pCounter = &pTracking->counter;
+#if PORT_MEM_COUNTER_SHARDED
+    if (pTracking == &portMemGlobals.mainTracking)
+    {
+        _portMemMainCounterSnapshot(&mainCounter);
+        pCounter = &mainCounter;
+    }
+#endif
+    pStats->numAllocations = pCounter->totalAllocs;
+    pStats->usefulSize     = pCounter->totalSize;
     pStats->metaSize       = pStats->numAllocations * PORT_MEM_STAGING_SIZE;
     pStats->allocatedSize  = pStats->usefulSize + pStats->metaSize;
     return NV_OK;
@@ -1217,12 +1617,28 @@ portMemExTrackingGetPeakStats
 )
 {
     PORT_MEM_ALLOCATOR_TRACKING *pTracking = _portMemGetTracking(pAllocator);
+    const PORT_MEM_COUNTER *pCounter;
+#if PORT_MEM_COUNTER_SHARDED
+    PORT_MEM_COUNTER mainCounter;
+#endif
     if (pTracking == NULL)
     {
         return NV_ERR_OBJECT_NOT_FOUND;
     }
-    pStats->numAllocations = pTracking->counter.peakAllocs;
-    pStats->usefulSize     = pTracking->counter.peakSize;
+    pCounter = &pTracking->counter;
+#if PORT_MEM_COUNTER_SHARDED
+    //
+    // Per-shard peaks cannot be correlated in time, so the summed peak is an
+    // upper bound on the true aggregate peak.
+    //
+    if (pTracking == &portMemGlobals.mainTracking)
+    {
+        _portMemMainCounterSnapshot(&mainCounter);
+        pCounter = &mainCounter;
+    }
+#endif
+    pStats->numAllocations = pCounter->peakAllocs;
+    pStats->usefulSize     = pCounter->peakSize;
     pStats->metaSize       = pStats->numAllocations * PORT_MEM_STAGING_SIZE;
     pStats->allocatedSize  = pStats->usefulSize + pStats->metaSize;
     return NV_OK;
@@ -1324,7 +1740,7 @@ _portMemTrackAlloc
     PORT_MEM_PRINT_INFO(PORT_MEM_CALLERINFO_PRINT_ARGS(PORT_MEM_CALLERINFO_PARAM));
 
     PORT_MEM_COUNTER_INC(&pTracking->counter, size);
-    PORT_MEM_COUNTER_INC(&portMemGlobals.mainTracking.counter, size);
+    PORT_MEM_COUNTER_INC(_portMemMainCounter(), size);
     PORT_MEM_LIMIT_INC(pid, pMem, size);
 
     PORT_MEM_FENCE_INIT(pTracking->pAllocator, pMem, size);
@@ -1352,7 +1768,7 @@ _portMemTrackFree
 #endif
 
     PORT_MEM_COUNTER_DEC(&pTracking->counter, size);
-    PORT_MEM_COUNTER_DEC(&portMemGlobals.mainTracking.counter, size);
+    PORT_MEM_COUNTER_DEC(_portMemMainCounter(), size);
     PORT_MEM_LIMIT_DEC(pMem, size);
 
     PORT_MEM_FENCE_CHECK(pTracking->pAllocator, pMem, size);
@@ -1369,7 +1785,11 @@ _portMemAllocatorAllocPagedWrapper
 )
 {
     PORT_UNREFERENCED_VARIABLE(pAlloc);
+#if PORT_MEM_SLAB_ENABLED
+    return _portMemSlabAlloc(length, NV_TRUE);
+#else
     return _portMemAllocPagedUntracked(length);
+#endif
 }
 
 static void *
@@ -1380,7 +1800,11 @@ _portMemAllocatorAllocNonPagedWrapper
 )
 {
     PORT_UNREFERENCED_VARIABLE(pAlloc);
+#if PORT_MEM_SLAB_ENABLED
+    return _portMemSlabAlloc(length, NV_FALSE);
+#else
     return _portMemAllocNonPagedUntracked(length);
+#endif
 }
 
 static void
@@ -1391,7 +1815,11 @@ _portMemAllocatorFreeWrapper
 )
 {
     PORT_UNREFERENCED_VARIABLE(pAlloc);
+#if PORT_MEM_SLAB_ENABLED
+    _portMemSlabFree(pMem);
+#else
     _portMemFreeUntracked(pMem);
+#endif
 }
 
 static void
@@ -147,6 +147,8 @@ portMemCmp
 
 #define PORT_MEM_USE_GENERIC_portMemSetPattern
 #define PORT_MEM_USE_GENERIC_portMemMove
+#define PORT_MEM_USE_GENERIC_portMemCopyWide
+#define PORT_MEM_USE_GENERIC_portMemSetWide
 #include "memory_generic.h"
 
 NV_STATUS
@@ -126,6 +126,259 @@ portSyncRwLockCreate
 }
 #endif
 
+#ifdef PORT_SYNC_COMMON_DEFINE_ADAPTIVE_MUTEX
+
+//
+// Number of conditional acquire attempts before falling back to a blocking
+// acquire. At roughly a pause per iteration this covers critical sections of
+// up to a few hundred nanoseconds, which is most RM lock holds.
+//
+#define PORT_SYNC_ADAPTIVE_MUTEX_SPINS 128
+
+void
+portSyncExAdaptiveMutexAcquire
+(
+    PORT_MUTEX *pMutex
+)
+{
+    NvU32 i;
+    PORT_ASSERT_CHECKED(pMutex != NULL);
+    PORT_ASSERT_CHECKED(portSyncExSafeToSleep());
+
+    //
+    // The platform mutex underneath performs its own owner-running checks
+    // where the OS supports them once we fall back to sleeping; the spin here
+    // only exists to skip the sleep/wake round trip when the owner is about
+    // to release.
+    //
+    for (i = 0; i < PORT_SYNC_ADAPTIVE_MUTEX_SPINS; i++)
+    {
+        if (portSyncMutexAcquireConditional(pMutex))
+            return;
+        portUtilSpin();
+    }
+    portSyncMutexAcquire(pMutex);
+}
+
+#endif // PORT_SYNC_COMMON_DEFINE_ADAPTIVE_MUTEX
+
+#ifdef PORT_SYNC_COMMON_DEFINE_READ_MOSTLY_RWLOCK
+
+#define PORT_SYNC_READER_SHARDS 16
+
+struct PORT_READ_MOSTLY_RWLOCK
+{
+    //
+    // One reader count per shard, each on its own cache line so concurrent
+    // read acquires do not bounce a shared line.
+    //
+    struct
+    {
+        volatile NvU32 count;
+        NvU8 pad[64 - sizeof(NvU32)];
+    } readers[PORT_SYNC_READER_SHARDS];
+    volatile NvU32 bWriterActive;
+    // Serializes writers; readers queue here while a writer is active.
+    PORT_MUTEX *pWriterMutex;
+    // Posted by exiting readers while a writer is waiting for the drain.
+    PORT_SEMAPHORE *pDrainSem;
+    PORT_MEM_ALLOCATOR *pAllocator;
+};
+
+static NV_INLINE NvU32
+_portSyncReadMostlyShard(void)
+{
+#if PORT_IS_MODULE_SUPPORTED(thread)
+    //
+    // Fibonacci hash of the thread id; kernel threads rarely migrate, so
+    // this approximates a per-CPU split without an NvPort CPU-id API.
+    //
+    return (NvU32)((portThreadGetCurrentThreadId() *
+                    0x9E3779B97F4A7C15ull) >> 60);
+#else
+    return 0;
+#endif
+}
+
+static void
+_portSyncReadMostlyReaderExit
+(
+    PORT_READ_MOSTLY_RWLOCK *pLock,
+    NvU32 shard
+)
+{
+    portAtomicDecrementU32(&pLock->readers[shard].count);
+    portAtomicMemoryFenceFull();
+    // A draining writer sleeps on the semaphore until woken to recheck.
+    if (pLock->bWriterActive != 0)
+        portSyncSemaphoreRelease(pLock->pDrainSem);
+}
+
+static NvBool
+_portSyncReadMostlyAnyReaders
+(
+    PORT_READ_MOSTLY_RWLOCK *pLock
+)
+{
+    NvU32 i;
+    for (i = 0; i < PORT_SYNC_READER_SHARDS; i++)
+    {
+        if (pLock->readers[i].count != 0)
+            return NV_TRUE;
+    }
+    return NV_FALSE;
+}
+
+PORT_READ_MOSTLY_RWLOCK *
+portSyncExReadMostlyRwLockCreate
+(
+    PORT_MEM_ALLOCATOR *pAllocator
+)
+{
+    PORT_READ_MOSTLY_RWLOCK *pLock;
+    PORT_ASSERT_CHECKED(pAllocator != NULL);
+
+    pLock = PORT_ALLOC(pAllocator, sizeof(*pLock));
+    if (pLock == NULL)
+        return NULL;
+
+    portMemSet(pLock, 0, sizeof(*pLock));
+    pLock->pWriterMutex = portSyncMutexCreate(pAllocator);
+    pLock->pDrainSem    = portSyncSemaphoreCreate(pAllocator, 0);
+    if ((pLock->pWriterMutex == NULL) || (pLock->pDrainSem == NULL))
+    {
+        if (pLock->pWriterMutex != NULL)
+            portSyncMutexDestroy(pLock->pWriterMutex);
+        if (pLock->pDrainSem != NULL)
+            portSyncSemaphoreDestroy(pLock->pDrainSem);
+        PORT_FREE(pAllocator, pLock);
+        return NULL;
+    }
+    pLock->pAllocator = pAllocator;
+    return pLock;
+}
+
+void
+portSyncExReadMostlyRwLockDestroy
+(
+    PORT_READ_MOSTLY_RWLOCK *pLock
+)
+{
+    PORT_ASSERT_CHECKED(pLock != NULL);
+    PORT_ASSERT_CHECKED(!_portSyncReadMostlyAnyReaders(pLock));
+    PORT_ASSERT_CHECKED(pLock->bWriterActive == 0);
+    portSyncMutexDestroy(pLock->pWriterMutex);
+    portSyncSemaphoreDestroy(pLock->pDrainSem);
+    PORT_FREE(pLock->pAllocator, pLock);
+}
+
+void
+portSyncExReadMostlyRwLockAcquireRead
+(
+    PORT_READ_MOSTLY_RWLOCK *pLock
+)
+{
+    NvU32 shard = _portSyncReadMostlyShard();
+    PORT_ASSERT_CHECKED(pLock != NULL);
+
+    for (;;)
+    {
+        portAtomicIncrementU32(&pLock->readers[shard].count);
+        portAtomicMemoryFenceFull();
+        if (pLock->bWriterActive == 0)
+            return;
+        //
+        // A writer is active or draining; undo the count (waking the writer
+        // if it is waiting on us), then queue behind it on the writer mutex
+        // so we sleep instead of spinning.
+        //
+        _portSyncReadMostlyReaderExit(pLock, shard);
+        portSyncMutexAcquire(pLock->pWriterMutex);
+        portSyncMutexRelease(pLock->pWriterMutex);
+    }
+}
+
+NvBool
+portSyncExReadMostlyRwLockAcquireReadConditional
+(
+    PORT_READ_MOSTLY_RWLOCK *pLock
+)
+{
+    NvU32 shard = _portSyncReadMostlyShard();
+    PORT_ASSERT_CHECKED(pLock != NULL);
+
+    portAtomicIncrementU32(&pLock->readers[shard].count);
+    portAtomicMemoryFenceFull();
+    if (pLock->bWriterActive == 0)
+        return NV_TRUE;
+    _portSyncReadMostlyReaderExit(pLock, shard);
+    return NV_FALSE;
+}
+
+void
+portSyncExReadMostlyRwLockReleaseRead
+(
+    PORT_READ_MOSTLY_RWLOCK *pLock
+)
+{
+    PORT_ASSERT_CHECKED(pLock != NULL);
+    _portSyncReadMostlyReaderExit(pLock, _portSyncReadMostlyShard());
+}
+
+void
+portSyncExReadMostlyRwLockAcquireWrite
+(
+    PORT_READ_MOSTLY_RWLOCK *pLock
+)
+{
+    PORT_ASSERT_CHECKED(pLock != NULL);
+
+    portSyncMutexAcquire(pLock->pWriterMutex);
+    portAtomicSetU32(&pLock->bWriterActive, 1);
+    portAtomicMemoryFenceFull();
+    //
+    // New readers now back off onto the writer mutex; wait for the ones that
+    // got in before us to drain. Exiting readers post the semaphore, and
+    // stale posts only cause a recheck, never an early exit.
+    //
+    while (_portSyncReadMostlyAnyReaders(pLock))
+        portSyncSemaphoreAcquire(pLock->pDrainSem);
+}
+
+NvBool
+portSyncExReadMostlyRwLockAcquireWriteConditional
+(
+    PORT_READ_MOSTLY_RWLOCK *pLock
+)
+{
+    PORT_ASSERT_CHECKED(pLock != NULL);
+
+    if (!portSyncMutexAcquireConditional(pLock->pWriterMutex))
+        return NV_FALSE;
+    portAtomicSetU32(&pLock->bWriterActive, 1);
+    portAtomicMemoryFenceFull();
+    if (_portSyncReadMostlyAnyReaders(pLock))
+    {
+        portAtomicSetU32(&pLock->bWriterActive, 0);
+        portSyncMutexRelease(pLock->pWriterMutex);
+        return NV_FALSE;
+    }
+    return NV_TRUE;
+}
+
+void
+portSyncExReadMostlyRwLockReleaseWrite
+(
+    PORT_READ_MOSTLY_RWLOCK *pLock
+)
+{
+    PORT_ASSERT_CHECKED(pLock != NULL);
+    portAtomicSetU32(&pLock->bWriterActive, 0);
+    portSyncMutexRelease(pLock->pWriterMutex);
+}
+
+#endif // PORT_SYNC_COMMON_DEFINE_READ_MOSTLY_RWLOCK
+
 #ifdef PORT_SYNC_COMMON_DEFINE_SYNC_INIT
 
 NvLength portSyncSpinlockSize;
@@ -333,7 +333,9 @@ NvU64 portSyncExGetInterruptLevel(void)
 // Include implementations common for all platforms
 #define PORT_SYNC_COMMON_DEFINE_SPINLOCK
 #define PORT_SYNC_COMMON_DEFINE_MUTEX
+#define PORT_SYNC_COMMON_DEFINE_ADAPTIVE_MUTEX
 #define PORT_SYNC_COMMON_DEFINE_SEMAPHORE
 #define PORT_SYNC_COMMON_DEFINE_RWLOCK
+#define PORT_SYNC_COMMON_DEFINE_READ_MOSTLY_RWLOCK
 #define PORT_SYNC_COMMON_DEFINE_SYNC_INIT
 #include "sync_common.h"
@@ -75,6 +75,27 @@ countZeros
     return nvPopCount64(bits);
 }
 
+// Magazine slot states; transitions are claimed with atomic CAS.
+#define POOL_MAG_SLOT_EMPTY 0
+#define POOL_MAG_SLOT_BUSY  1
+#define POOL_MAG_SLOT_FULL  2
+
+/*!
+ * Index of the first slot of the current thread's magazine shard.
+ */
+static NvU32
+_poolMagShardBase(void)
+{
+#if PORT_IS_MODULE_SUPPORTED(thread)
+    // Fibonacci hash of the thread id, folded to the shard count.
+    NvU64 threadId = portThreadGetCurrentThreadId();
+    return ((NvU32)((threadId * 0x9E3779B97F4A7C15ULL) >> 61) % POOL_MAG_SHARDS)
+           * POOL_MAG_DEPTH;
+#else
+    return 0;
+#endif
+}
+
 
 static void
 poolListDestroy
@@ -209,6 +230,13 @@ poolAllocPrint
     poolListPrint(&(pPool->partialList));
     NV_PRINTF_EX(POOLALLOC, LEVEL_NOTICE, "fullList => ");
     poolListPrint(&(pPool->fullList));
+    if (pPool->pMagSlots != NULL)
+    {
+        NV_PRINTF(LEVEL_NOTICE,
+                  "magazine: allocHits=%llu allocMisses=%llu freeHits=%llu freeMisses=%llu\n",
+                  pPool->magStats.allocHits, pPool->magStats.allocMisses,
+                  pPool->magStats.freeHits, pPool->magStats.freeMisses);
+    }
 #endif // defined(DEBUG_VERBOSE)
 }
 
@@ -248,6 +276,20 @@ poolInitialize
     listInitIntrusive(&pPool->fullList);
     listInitIntrusive(&pPool->partialList);
 
+    pPool->pMagSlots = NULL;
+    portMemSet(&pPool->magStats, 0, sizeof(pPool->magStats));
+    if (FLD_TEST_DRF(_RMPOOL, _FLAGS, _MAGAZINE_CACHE, _ENABLE, flags))
+    {
+        pPool->pMagSlots = PORT_ALLOC(pAllocator,
+            POOL_MAG_SHARDS * POOL_MAG_DEPTH * sizeof(*pPool->pMagSlots));
+        if (pPool->pMagSlots != NULL)
+        {
+            portMemSet(pPool->pMagSlots, 0,
+                POOL_MAG_SHARDS * POOL_MAG_DEPTH * sizeof(*pPool->pMagSlots));
+        }
+        // On allocation failure the pool simply runs without the cache.
+    }
+
     NV_PRINTF(LEVEL_INFO, "Initialized pool with upstreamPageSize = %lldB, allocPageSize = %lldB and autoPopulate %s\n",
               pPool->upstreamPageSize, pPool->allocPageSize,
               ((pPool->flags & NV_RMPOOL_FLAGS_AUTO_POPULATE_ENABLE) ? "enabled" : "disabled"));
@@ -540,17 +582,151 @@ poolFree
 }
 
 
+NvBool
+poolAllocateFromMagazine
+(
+    POOLALLOC        *pPool,
+    POOLALLOC_HANDLE *pPageHandle
+)
+{
+    NvU32 base, i;
+
+    if (pPool->pMagSlots == NULL)
+    {
+        return NV_FALSE;
+    }
+
+    base = _poolMagShardBase();
+    for (i = 0; i < POOL_MAG_DEPTH; i++)
+    {
+        POOLALLOC_MAG_SLOT *pSlot = &pPool->pMagSlots[base + i];
+
+        if ((pSlot->state == POOL_MAG_SLOT_FULL) &&
+            portAtomicCompareAndSwapU32(&pSlot->state, POOL_MAG_SLOT_BUSY,
+                                        POOL_MAG_SLOT_FULL))
+        {
+            *pPageHandle = pSlot->handle;
+            portAtomicMemoryFenceStore();
+            portAtomicSetU32(&pSlot->state, POOL_MAG_SLOT_EMPTY);
+            portAtomicExIncrementU64(&pPool->magStats.allocHits);
+            return NV_TRUE;
+        }
+    }
+    portAtomicExIncrementU64(&pPool->magStats.allocMisses);
+    return NV_FALSE;
+}
+
+NvBool
+poolFreeToMagazine
+(
+    POOLALLOC        *pPool,
+    POOLALLOC_HANDLE *pPageHandle
+)
+{
+    NvU32 base, i;
+
+    if (pPool->pMagSlots == NULL)
+    {
+        return NV_FALSE;
+    }
+
+    base = _poolMagShardBase();
+    for (i = 0; i < POOL_MAG_DEPTH; i++)
+    {
+        POOLALLOC_MAG_SLOT *pSlot = &pPool->pMagSlots[base + i];
+
+        if ((pSlot->state == POOL_MAG_SLOT_EMPTY) &&
+            portAtomicCompareAndSwapU32(&pSlot->state, POOL_MAG_SLOT_BUSY,
+                                        POOL_MAG_SLOT_EMPTY))
+        {
+            pSlot->handle = *pPageHandle;
+            portAtomicMemoryFenceStore();
+            portAtomicSetU32(&pSlot->state, POOL_MAG_SLOT_FULL);
+            portAtomicExIncrementU64(&pPool->magStats.freeHits);
+            return NV_TRUE;
+        }
+    }
+    portAtomicExIncrementU64(&pPool->magStats.freeMisses);
+    return NV_FALSE;
+}
+
+void
+poolMagazineFlushAll
+(
+    POOLALLOC *pPool
+)
+{
+    NvU32 i;
+
+    if (pPool->pMagSlots == NULL)
+    {
+        return;
+    }
+
+    for (i = 0; i < POOL_MAG_SHARDS * POOL_MAG_DEPTH; i++)
+    {
+        POOLALLOC_MAG_SLOT *pSlot = &pPool->pMagSlots[i];
+
+        if ((pSlot->state == POOL_MAG_SLOT_FULL) &&
+            portAtomicCompareAndSwapU32(&pSlot->state, POOL_MAG_SLOT_BUSY,
+                                        POOL_MAG_SLOT_FULL))
+        {
+            POOLALLOC_HANDLE handle = pSlot->handle;
+
+            portAtomicSetU32(&pSlot->state, POOL_MAG_SLOT_EMPTY);
+            poolFree(pPool, &handle);
+        }
+    }
+}
+
+void
+poolMagazineGetStats
+(
+    POOLALLOC *pPool,
+    NvU64     *pAllocHits,
+    NvU64     *pAllocMisses,
+    NvU64     *pFreeHits,
+    NvU64     *pFreeMisses
+)
+{
+    NV_ASSERT(pPool != NULL);
+
+    if (pAllocHits != NULL)
+    {
+        *pAllocHits = pPool->magStats.allocHits;
+    }
+    if (pAllocMisses != NULL)
+    {
+        *pAllocMisses = pPool->magStats.allocMisses;
+    }
+    if (pFreeHits != NULL)
+    {
+        *pFreeHits = pPool->magStats.freeHits;
+    }
+    if (pFreeMisses != NULL)
+    {
+        *pFreeMisses = pPool->magStats.freeMisses;
+    }
+}
+
 void
 poolDestroy
 (
     POOLALLOC *pPool
 )
 {
+    // Return cached pages so the list teardown below accounts for them.
+    poolMagazineFlushAll(pPool);
+
     // call back to free all the pages
     poolListDestroy(&pPool->fullList, pPool);
     poolListDestroy(&pPool->partialList, pPool);
     poolListDestroy(&pPool->freeList, pPool);
 
+    if (pPool->pMagSlots != NULL)
+    {
+        PORT_FREE(pPool->pAllocator, pPool->pMagSlots);
+    }
     PORT_FREE(pPool->pAllocator, pPool);
 }
 
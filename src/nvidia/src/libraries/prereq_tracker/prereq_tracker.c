@@ -48,6 +48,7 @@ prereqConstruct_IMPL
     NV_ASSERT_OR_RETURN(pParent != NULL, NV_ERR_INVALID_OBJECT_PARENT);
 
     bitVectorClrAll(&pTracker->satisfied);
+    portMemSet(pTracker->gateCount, 0, sizeof(pTracker->gateCount));
 
     listInit(&pTracker->prereqList, portMemAllocatorGetGlobalNonPaged());
     pTracker->bInitialized = NV_TRUE;
@@ -91,7 +92,7 @@ _prereqArm
     PREREQ_ENTRY  *pPrereq
 )
 {
-    PREREQ_ID_BIT_VECTOR requestedAndSatisfied;
+    PREREQ_ID_BIT_VECTOR notSatisfied;
 
     NV_ASSERT_OR_RETURN(pTracker->bInitialized, NV_ERR_INVALID_STATE);
     NV_ASSERT_OR_RETURN(_prereqValid(pTracker, pPrereq), NV_ERR_INVALID_OBJECT);
@@ -104,15 +105,15 @@ _prereqArm
     pPrereq->bArmed = NV_TRUE;
 
     //
-    // Put together a mask of PREREQ_IDs which are both satisfied and requested
-    // We do not keep track of satisfied prereqs until armed, so we have no existing
-    // state to worry about here.
+    // Seed the remaining mask with the PREREQ_IDs which are requested but not
+    // yet satisfied.  We do not keep track of satisfied prereqs until armed,
+    // so we have no existing state to worry about here.
     //
-    NV_ASSERT_OK_OR_RETURN(bitVectorAnd(&requestedAndSatisfied,
+    NV_ASSERT_OK_OR_RETURN(bitVectorComplement(&notSatisfied,
+                                               &pTracker->satisfied));
+    NV_ASSERT_OK_OR_RETURN(bitVectorAnd(&pPrereq->remaining,
                                         &pPrereq->requested,
-                                        &pTracker->satisfied));
-
-    pPrereq->countSatisfied = bitVectorCountSetBits(&requestedAndSatisfied);
+                                        &notSatisfied));
 
     if (PREREQ_IS_SATISFIED(pPrereq))
     {
@@ -156,9 +157,8 @@ prereqComposeEntry_IMPL
 
     NV_ASSERT_OK_OR_RETURN(bitVectorCopy(&pPrereq->requested, pDepends));
 
-    pPrereq->countRequested = bitVectorCountSetBits(&pPrereq->requested);
-    pPrereq->countSatisfied = 0;
-    pPrereq->callback       = callback;
+    bitVectorClrAll(&pPrereq->remaining);
+    pPrereq->callback = callback;
 
     NV_ASSERT_OK_OR_RETURN(_prereqArm(pTracker, pPrereq));
 
@@ -206,14 +206,18 @@ prereqSatisfy_IMPL
     {
         pPrereq = it.pValue;
         if (pPrereq->bArmed &&
-            bitVectorTest(&pPrereq->requested, prereqId))
+            bitVectorTest(&pPrereq->remaining, prereqId))
         {
-            pPrereq->countSatisfied++;
-            NV_ASSERT_OR_RETURN(pPrereq->countSatisfied <= pPrereq->countRequested,
-                                NV_ERR_INVALID_STATE);
+            NV_ASSERT_OK_OR_RETURN(bitVectorClr(&pPrereq->remaining, prereqId));
 
             if (PREREQ_IS_SATISFIED(pPrereq))
             {
+                //
+                // This ID was the entry's final gate; count it so boot-time
+                // attribution can identify which prerequisites hold entries
+                // back the longest.
+                //
+                pTracker->gateCount[prereqId]++;
                 NV_ASSERT_OK_OR_RETURN(pPrereq->callback(pTracker->pParent, NV_TRUE));
             }
         }
@@ -272,15 +276,8 @@ prereqRetract_IMPL
                 NV_ASSERT_OK_OR_CAPTURE_FIRST_ERROR(status, pNode->callback(pTracker->pParent, NV_FALSE));
             }
 
-            pNode->countSatisfied--;
-            if (pNode->countSatisfied < 0)
-            {
-                NV_ASSERT(0);
-                if (status == NV_OK)
-                {
-                    status = NV_ERR_INVALID_STATE;
-                }
-            }
+            NV_ASSERT_OK_OR_CAPTURE_FIRST_ERROR(status,
+                bitVectorSet(&pNode->remaining, prereqId));
         }
     }
 
@@ -318,6 +315,34 @@ prereqIdIsSatisfied_IMPL
     return bIsSatisfied;
 }
 
+/*!
+ * @brief   Returns how many times the given prerequisite ID was the final
+ *          gate of an armed entry, i.e. its satisfaction is what fired the
+ *          entry's callback.  Used for boot-time attribution of which
+ *          prerequisites hold dependent work back the longest.
+ *
+ * @param[in]   pTracker    PrereqTracker object pointer
+ * @param[in]   prereqId    Prerequisite ID to query
+ *
+ * @return  Final-gate count for the given prerequisite ID, 0 if the tracker
+ *          is not initialized or the ID is out of range.
+ */
+NvU32
+prereqIdGetGateCount_IMPL
+(
+    PrereqTracker  *pTracker,
+    PREREQ_ID       prereqId
+)
+{
+    if ((pTracker->bInitialized) &&
+        (prereqId < PREREQ_ID_VECTOR_SIZE))
+    {
+        return pTracker->gateCount[prereqId];
+    }
+
+    return 0;
+}
+
 /* ---------------------- Private Static Functions -------------------------- */
 /*!
  * Helper function which determines whether a given PREREQ_ENTRY tracking
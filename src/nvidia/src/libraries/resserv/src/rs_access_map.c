@@ -43,6 +43,25 @@ _rsAccessGrantCallback
     RsAccessRight accessRight
 );
 
+//
+// Global share policy generation; bumped on every share policy mutation and
+// on client teardown. Monotonic and never reset, so a cached access decision
+// can never revalidate once the state it was computed from has changed.
+//
+static volatile NvU32 g_shareGeneration;
+
+NvU32
+rsAccessGetShareGeneration(void)
+{
+    return g_shareGeneration;
+}
+
+void
+rsAccessBumpShareGeneration(void)
+{
+    portAtomicIncrementU32(&g_shareGeneration);
+}
+
 /*!
  * @brief Checks which rights, if any, are being shared with the invoking client by a resource
  * This is a static helper function for rsAccessGrantRights.
@@ -177,6 +196,154 @@ rsAccessLookup
     return NULL;
 }
 
+/*!
+ * @brief Consults the invoking client's access decision cache
+ *
+ * @param[in] pResourceRef Target resource, owned by another client
+ * @param[in] pInvokingClient The client requesting access rights
+ * @param[in] pRightsRequired The set of access rights being checked
+ * @param[in] pCallContext May be NULL, in which case nothing is cached
+ * @param[out] pbAllowed The cached verdict, only valid on a hit
+ *
+ * @return NV_TRUE if a valid cached decision was found
+ */
+static NvBool
+_rsAccessCacheLookup
+(
+    RsResourceRef *pResourceRef,
+    RsClient *pInvokingClient,
+    const RS_ACCESS_MASK *pRightsRequired,
+    CALL_CONTEXT *pCallContext,
+    NvBool *pbAllowed
+)
+{
+    RS_ACCESS_CACHE_SLOT *pSlot;
+    RS_ACCESS_MASK rightsRequired;
+    NvHandle hOwnerClient;
+    NvHandle hResource;
+    NvHandle hContext;
+    NvHandle hCurContext;
+    NvU32 shareGeneration;
+    NvU32 ownerGeneration;
+    NvU32 invokerGeneration;
+    NvU32 seq;
+    NvU32 limb;
+    NvBool bAllowed;
+
+    // Decisions are only cached for checks made in a full call context
+    if ((pCallContext == NULL) || (pCallContext->pServer == NULL))
+        return NV_FALSE;
+
+    hCurContext = (pCallContext->pContextRef != NULL) ?
+        pCallContext->pContextRef->hResource : 0;
+
+    pSlot = &pInvokingClient->accessCache[pResourceRef->hResource &
+                                          (RS_CLIENT_ACCESS_CACHE_SIZE - 1)];
+
+    seq = pSlot->seq;
+    portAtomicMemoryFenceLoad();
+    if (seq & 1)
+        return NV_FALSE;
+
+    hOwnerClient = pSlot->hOwnerClient;
+    hResource = pSlot->hResource;
+    hContext = pSlot->hContext;
+    rightsRequired = pSlot->rightsRequired;
+    shareGeneration = pSlot->shareGeneration;
+    ownerGeneration = pSlot->ownerGeneration;
+    invokerGeneration = pSlot->invokerGeneration;
+    bAllowed = pSlot->bAllowed;
+
+    // Discard the snapshot if a writer raced with us
+    portAtomicMemoryFenceLoad();
+    if (pSlot->seq != seq)
+        return NV_FALSE;
+
+    if ((hOwnerClient != pResourceRef->pClient->hClient) ||
+        (hResource != pResourceRef->hResource) ||
+        (hContext != hCurContext) ||
+        (shareGeneration != g_shareGeneration) ||
+        (ownerGeneration != pResourceRef->pClient->refCacheGeneration) ||
+        (invokerGeneration != pInvokingClient->refCacheGeneration))
+    {
+        return NV_FALSE;
+    }
+
+    for (limb = 0; limb < SDK_RS_ACCESS_MAX_LIMBS; limb++)
+    {
+        if (rightsRequired.limbs[limb] != pRightsRequired->limbs[limb])
+            return NV_FALSE;
+    }
+
+    *pbAllowed = bAllowed;
+    return NV_TRUE;
+}
+
+/*!
+ * @brief Records an access decision in the invoking client's cache
+ *
+ * The generation values must have been captured before the decision was
+ * evaluated so that a mutation racing with the evaluation leaves the cached
+ * entry already stale.
+ *
+ * @param[in] pResourceRef Target resource, owned by another client
+ * @param[in] pInvokingClient The client requesting access rights
+ * @param[in] pRightsRequired The set of access rights that was checked
+ * @param[in] pCallContext May be NULL, in which case nothing is cached
+ * @param[in] shareGeneration Share policy generation before evaluation
+ * @param[in] ownerGeneration Owner client's refCacheGeneration before evaluation
+ * @param[in] invokerGeneration Invoking client's refCacheGeneration before evaluation
+ * @param[in] bAllowed The verdict to record
+ *
+ * @return none
+ */
+static void
+_rsAccessCacheInsert
+(
+    RsResourceRef *pResourceRef,
+    RsClient *pInvokingClient,
+    const RS_ACCESS_MASK *pRightsRequired,
+    CALL_CONTEXT *pCallContext,
+    NvU32 shareGeneration,
+    NvU32 ownerGeneration,
+    NvU32 invokerGeneration,
+    NvBool bAllowed
+)
+{
+    RS_ACCESS_CACHE_SLOT *pSlot;
+    NvU32 seq;
+
+    if ((pCallContext == NULL) || (pCallContext->pServer == NULL))
+        return;
+
+    pSlot = &pInvokingClient->accessCache[pResourceRef->hResource &
+                                          (RS_CLIENT_ACCESS_CACHE_SIZE - 1)];
+
+    //
+    // Best effort: if the slot cannot be claimed because another thread is
+    // mid-update, skip the refresh rather than risk publishing fields from
+    // two different decisions.
+    //
+    seq = pSlot->seq;
+    if (seq & 1)
+        return;
+    if (!portAtomicCompareAndSwapU32(&pSlot->seq, seq + 1, seq))
+        return;
+
+    pSlot->hOwnerClient = pResourceRef->pClient->hClient;
+    pSlot->hResource = pResourceRef->hResource;
+    pSlot->hContext = (pCallContext->pContextRef != NULL) ?
+        pCallContext->pContextRef->hResource : 0;
+    pSlot->rightsRequired = *pRightsRequired;
+    pSlot->shareGeneration = shareGeneration;
+    pSlot->ownerGeneration = ownerGeneration;
+    pSlot->invokerGeneration = invokerGeneration;
+    pSlot->bAllowed = bAllowed;
+
+    portAtomicMemoryFenceStore();
+    pSlot->seq = seq + 2;
+}
+
 NV_STATUS
 rsAccessCheckRights
 (
@@ -186,6 +353,12 @@ rsAccessCheckRights
 )
 {
     RS_ACCESS_MASK ownedRights;
+    CALL_CONTEXT *pCallContext = resservGetTlsCallContext();
+    NvU32 shareGeneration = 0;
+    NvU32 ownerGeneration = 0;
+    NvU32 invokerGeneration = 0;
+    NvBool bCacheable;
+    NvBool bAllowed;
 
     NV_ASSERT_OR_RETURN(pRightsRequired != NULL, NV_ERR_INVALID_ARGUMENT);
 
@@ -193,6 +366,25 @@ rsAccessCheckRights
     if (rsAccessMaskIsEmpty(pRightsRequired))
         return NV_OK;
 
+    //
+    // Only decisions about another client's resource are memoized; the owner
+    // path is a direct mask read, and uncached rights must re-run their grant
+    // callbacks on every check.
+    //
+    bCacheable = (pResourceRef->pClient != pInvokingClient);
+    if (bCacheable)
+    {
+        if (_rsAccessCacheLookup(pResourceRef, pInvokingClient, pRightsRequired,
+                                 pCallContext, &bAllowed))
+        {
+            return bAllowed ? NV_OK : NV_ERR_INSUFFICIENT_PERMISSIONS;
+        }
+
+        shareGeneration = g_shareGeneration;
+        ownerGeneration = pResourceRef->pClient->refCacheGeneration;
+        invokerGeneration = pInvokingClient->refCacheGeneration;
+    }
+
     // Uncached access rights require executing the callback every time
     rsAccessUpdateRights(pResourceRef, pInvokingClient, pRightsRequired);
 
@@ -200,12 +392,16 @@ rsAccessCheckRights
     rsAccessGetAvailableRights(pResourceRef, pInvokingClient, &ownedRights);
 
     // Check that rights are sufficient
-    if (!rsAccessMaskIsSubset(&ownedRights, pRightsRequired))
+    bAllowed = rsAccessMaskIsSubset(&ownedRights, pRightsRequired);
+
+    if (bCacheable)
     {
-        return NV_ERR_INSUFFICIENT_PERMISSIONS;
+        _rsAccessCacheInsert(pResourceRef, pInvokingClient, pRightsRequired,
+                             pCallContext, shareGeneration, ownerGeneration,
+                             invokerGeneration, bAllowed);
     }
 
-    return NV_OK;
+    return bAllowed ? NV_OK : NV_ERR_INSUFFICIENT_PERMISSIONS;
 }
 
 void rsAccessUpdateRights
@@ -332,6 +528,9 @@ rsShareListInsert
     RS_SHARE_POLICY *pCurrentPolicy;
     RS_SHARE_POLICY *pNewPolicy;
 
+    // Invalidate cached access decisions derived from the old policies
+    rsAccessBumpShareGeneration();
+
     pCurrentPolicy = rsShareListLookup(pShareList, pSharePolicy);
     if (pCurrentPolicy == NULL)
     {
@@ -375,6 +574,9 @@ rsShareListRemove
     RS_SHARE_POLICY *pCurrentPolicy;
     RS_ACCESS_MASK *pCurrentAccessMask;
 
+    // Invalidate cached access decisions derived from the old policies
+    rsAccessBumpShareGeneration();
+
     pCurrentPolicy = rsShareListLookup(pShareList, pSharePolicy);
     if (pCurrentPolicy != NULL)
     {
@@ -96,6 +96,19 @@ clientConstruct_IMPL
     mapInit(&pClient->resourceMap, pAllocator);
     listInitIntrusive(&pClient->pendingFreeList);
 
+    //
+    // Generation starts at 1 so the zero-initialized cache slots can never
+    // match before they are first filled in
+    //
+    portMemSet(pClient->refCache, 0, sizeof(pClient->refCache));
+    pClient->refCacheGeneration = 1;
+
+    //
+    // Zero-initialized access decision slots can never hit: no valid client
+    // handle is 0, so the hOwnerClient comparison always fails
+    //
+    portMemSet(pClient->accessCache, 0, sizeof(pClient->accessCache));
+
     listInit(&pClient->accessBackRefList, pAllocator);
 
     pClient->handleGenIdx = 0;
@@ -324,6 +337,12 @@ void clientDestruct_IMPL
 
     NV_ASSERT(listCount(&pClient->accessBackRefList) == 0);
     listDestroy(&pClient->accessBackRefList);
+
+    //
+    // This client handle may be reused; other clients' cached access
+    // decisions naming it as the resource owner must not survive it
+    //
+    rsAccessBumpShareGeneration();
 }
 
 NV_STATUS
@@ -385,12 +404,54 @@ clientGetResourceRef_IMPL
     RsResourceRef **ppResourceRef
 )
 {
+    RS_REF_CACHE_SLOT *pSlot = &pClient->refCache[hResource & (RS_CLIENT_REF_CACHE_SIZE - 1)];
     RsResourceRef *pResourceRef;
+    NvU32 seq;
+
+    //
+    // Try the lookup cache before walking the map. The slot's sequence
+    // counter is re-checked after the fields are read so a concurrent writer
+    // (possible when the client lock is held for read) can never hand back a
+    // torn entry.
+    //
+    seq = pSlot->seq;
+    portAtomicMemoryFenceLoad();
+    if ((seq & 0x1) == 0)
+    {
+        NvU32 generation = pSlot->generation;
+        NvHandle hCached = pSlot->hResource;
+
+        pResourceRef = pSlot->pResourceRef;
+        portAtomicMemoryFenceLoad();
+        if ((pSlot->seq == seq) &&
+            (hCached == hResource) &&
+            (generation == pClient->refCacheGeneration))
+        {
+            if (ppResourceRef != NULL)
+                *ppResourceRef = pResourceRef;
+            return NV_OK;
+        }
+    }
 
     pResourceRef = mapFind(&pClient->resourceMap, hResource);
     if (pResourceRef == NULL)
         return NV_ERR_OBJECT_NOT_FOUND;
 
+    //
+    // Best-effort refresh: claim the slot by moving seq from even to odd. If
+    // another thread owns the slot, skip the update instead of waiting.
+    //
+    seq = pSlot->seq;
+    if (((seq & 0x1) == 0) &&
+        portAtomicCompareAndSwapU32(&pSlot->seq, seq + 1, seq))
+    {
+        pSlot->generation = pClient->refCacheGeneration;
+        pSlot->hResource = hResource;
+        pSlot->pResourceRef = pResourceRef;
+        portAtomicMemoryFenceStore();
+        pSlot->seq = seq + 2;
+    }
+
     if (ppResourceRef != NULL)
         *ppResourceRef = pResourceRef;
 
@@ -1083,6 +1144,14 @@ clientDestructResourceRef_IMPL
 
     mapRemove(&pClient->resourceMap, pResourceRef);
 
+    //
+    // The handle may be reused and the ref memory is about to be reclaimed,
+    // so invalidate every lookup cache slot with a single generation bump.
+    // Frees run under the exclusive client lock, so no lookup can be racing
+    // with the bump itself.
+    //
+    portAtomicIncrementU32(&pClient->refCacheGeneration);
+
     portAtomicExDecrementU64(&pServer->activeResourceCount);
 
     return NV_OK;
@@ -47,6 +47,18 @@ static NV_STATUS _serverFindClient(RsServer *pServer, NvHandle hClient, RsClient
  */
 static NV_STATUS _serverFindClientEntry(RsServer *pServer, NvHandle hClient, NvBool bFindPartial, CLIENT_ENTRY **ppClientEntry);
 
+/**
+ * Get the shard lock protecting the bucket list a client handle lives in.
+ *
+ * The shard locks only protect the bucket list structure; CLIENT_ENTRY
+ * lifetime continues to be guaranteed by the top-level lock, as clients are
+ * only freed with the top-level lock held exclusively.
+ */
+static PORT_RWLOCK *_serverGetClientShardLock(RsServer *pServer, NvHandle hClient)
+{
+    return pServer->pClientShardLocks[hClient & RS_CLIENT_LOCK_SHARD_MASK];
+}
+
 /**
  * Insert a CLIENT_ENTRY in the server database without taking locks
  * @param[in]   pServer
@@ -62,6 +74,18 @@ static NV_STATUS _serverInsertClientEntry(RsServer *pServer, CLIENT_ENTRY *pClie
  */
 static NV_STATUS _serverFindNextAvailableClientHandleInBucket(RsServer *pServer, NvHandle hClientIn, NvHandle *phClientOut, CLIENT_ENTRY  ***pppClientNext);
 
+/**
+ * Mark the handle index of a newly inserted client entry as used in the
+ * server's handle index bitmap
+ */
+static void _serverMarkClientHandleIndexUsed(RsServer *pServer, NvHandle hClient);
+
+/**
+ * Clear the handle index of a removed client entry from the server's handle
+ * index bitmap, unless another entry in the bucket still uses the index
+ */
+static void _serverClearClientHandleIndex(RsServer *pServer, NvHandle hClient);
+
 /**
  * Create a client entry and a client lock for a client that does not exist yet. Used during client
  * construction. No locks will be taken if this call fails.
@@ -241,6 +265,7 @@ serverConstruct
     pServer->activeClientCount  = 0;
     pServer->activeResourceCount= 0;
     pServer->roTopLockApiMask   = 0;
+    pServer->roClientLockApiMask= 0;
     /* pServer->bUnlockedParamCopy is set in _rmapiLockAlloc */
 
     pServer->pClientSortedList = PORT_ALLOC(pAllocator, sizeof(RsClientList)*RS_CLIENT_HANDLE_BUCKET_COUNT);
@@ -253,10 +278,26 @@ serverConstruct
     }
     pServer->clientCurrentHandleIndex = 0;
 
-    pServer->pClientListLock = portSyncRwLockCreate(pAllocator);
-    if (pServer->pClientListLock == NULL)
+    pServer->pClientShardLocks = PORT_ALLOC(pAllocator, sizeof(PORT_RWLOCK*)*RS_CLIENT_LOCK_SHARD_COUNT);
+    if (pServer->pClientShardLocks == NULL)
         goto fail;
 
+    portMemSet(pServer->pClientShardLocks, 0, sizeof(PORT_RWLOCK*)*RS_CLIENT_LOCK_SHARD_COUNT);
+
+    for (i = 0; i < RS_CLIENT_LOCK_SHARD_COUNT; i++)
+    {
+        pServer->pClientShardLocks[i] = portSyncRwLockCreate(pAllocator);
+        if (pServer->pClientShardLocks[i] == NULL)
+            goto fail;
+    }
+
+    pServer->pClientHandleIndexBitmap = PORT_ALLOC(pAllocator,
+        sizeof(NvU64) * (RS_CLIENT_HANDLE_MAX / 64));
+    if (pServer->pClientHandleIndexBitmap == NULL)
+        goto fail;
+    portMemSet(pServer->pClientHandleIndexBitmap, 0,
+        sizeof(NvU64) * (RS_CLIENT_HANDLE_MAX / 64));
+
 #if RS_STANDALONE
     RS_LOCK_VALIDATOR_INIT(&pServer->topLockVal, LOCK_VAL_LOCK_CLASS_API, 0xdead0000);
     pServer->pTopLock = portSyncRwLockCreate(pAllocator);
@@ -300,8 +341,18 @@ fail:
         portSyncRwLockDestroy(pServer->pTopLock);
 #endif
 
-    if (pServer->pClientListLock != NULL)
-        portSyncRwLockDestroy(pServer->pClientListLock);
+    if (pServer->pClientShardLocks != NULL)
+    {
+        for (i = 0; i < RS_CLIENT_LOCK_SHARD_COUNT; i++)
+        {
+            if (pServer->pClientShardLocks[i] != NULL)
+                portSyncRwLockDestroy(pServer->pClientShardLocks[i]);
+        }
+        PORT_FREE(pAllocator, pServer->pClientShardLocks);
+    }
+
+    if (pServer->pClientHandleIndexBitmap != NULL)
+        PORT_FREE(pAllocator, pServer->pClientHandleIndexBitmap);
 
     if (pServer->pShareMapLock != NULL)
         portSyncSpinlockDestroy(pServer->pShareMapLock);
@@ -366,7 +417,12 @@ serverDestruct
 #endif
 
     portSyncSpinlockDestroy(pServer->pShareMapLock);
-    portSyncRwLockDestroy(pServer->pClientListLock);
+
+    for (i = 0; i < RS_CLIENT_LOCK_SHARD_COUNT; i++)
+        portSyncRwLockDestroy(pServer->pClientShardLocks[i]);
+    PORT_FREE(pServer->pAllocator, pServer->pClientShardLocks);
+
+    PORT_FREE(pServer->pAllocator, pServer->pClientHandleIndexBitmap);
 
     portMemAllocatorRelease(pServer->pAllocator);
 
@@ -440,7 +496,10 @@ _serverFreeClient_underlock
 
     objDelete(pClient);
 
+    portSyncRwLockAcquireWrite(_serverGetClientShardLock(pServer, hClient));
     listRemoveFirstByValue(&pServer->pClientSortedList[hClient & RS_CLIENT_HANDLE_BUCKET_MASK], &pClientEntry);
+    portSyncRwLockReleaseWrite(_serverGetClientShardLock(pServer, hClient));
+    _serverClearClientHandleIndex(pServer, hClient);
     pLock = pClientEntry->pLock;
 
     RS_RWLOCK_RELEASE_WRITE_EXT(pLock, &pClientEntry->lockVal, NV_TRUE);
@@ -582,7 +641,10 @@ done:
     {
         if (_serverFindClientEntry(pServer, hClient, NV_TRUE, &pClientEntry) == NV_OK)
         {
+            portSyncRwLockAcquireWrite(_serverGetClientShardLock(pServer, hClient));
             listRemoveFirstByValue(&pServer->pClientSortedList[hClient & RS_CLIENT_HANDLE_BUCKET_MASK], &pClientEntry);
+            portSyncRwLockReleaseWrite(_serverGetClientShardLock(pServer, hClient));
+            _serverClearClientHandleIndex(pServer, hClient);
             portSyncRwLockDestroy(pClientEntry->pLock);
             PORT_FREE(pServer->pAllocator, pClientEntry);
         }
@@ -1277,6 +1339,7 @@ serverControl
     CALL_CONTEXT        callContext;
     CALL_CONTEXT       *pOldContext = NULL;
     LOCK_ACCESS_TYPE    access = LOCK_ACCESS_WRITE;
+    LOCK_ACCESS_TYPE    clientAccess = LOCK_ACCESS_WRITE;
     NvHandle            hSecondClient;
 
     pLockInfo = pParams->pLockInfo;
@@ -1286,6 +1349,10 @@ serverControl
     if (status != NV_OK)
         goto done;
 
+    status = serverControlLookupLockFlags(pServer, RS_LOCK_CLIENT, pParams, pParams->pCookie, &clientAccess);
+    if (status != NV_OK)
+        goto done;
+
     if (pServer->bUnlockedParamCopy)
     {
         status = serverControlApiCopyIn(pServer, pParams, pParams->pCookie);
@@ -1304,7 +1371,7 @@ serverControl
 
     if (hSecondClient == 0)
     {
-        status = _serverLockClientWithLockInfo(pServer, LOCK_ACCESS_WRITE,
+        status = _serverLockClientWithLockInfo(pServer, clientAccess,
             pParams->hClient, pLockInfo, &releaseFlags, &pClient);
         if (status != NV_OK)
             goto done;
@@ -1400,7 +1467,7 @@ done:
     }
     else
     {
-        _serverUnlockClientWithLockInfo(pServer, LOCK_ACCESS_WRITE,
+        _serverUnlockClientWithLockInfo(pServer, clientAccess,
             pParams->hClient, pLockInfo, &releaseFlags);
     }
 
@@ -2301,11 +2368,16 @@ _serverFindClientEntry
 )
 {
     RsClientList  *pClientList       = &(pServer->pClientSortedList[hClient & RS_CLIENT_HANDLE_BUCKET_MASK]);
-    CLIENT_ENTRY **ppClientEntryLoop = listHead(pClientList);
+    PORT_RWLOCK   *pShardLock        = _serverGetClientShardLock(pServer, hClient);
+    CLIENT_ENTRY **ppClientEntryLoop;
+    NV_STATUS      status            = NV_ERR_INVALID_OBJECT_HANDLE;
 
     if (ppClientEntry != NULL)
         *ppClientEntry = NULL;
 
+    portSyncRwLockAcquireRead(pShardLock);
+
+    ppClientEntryLoop = listHead(pClientList);
     while (ppClientEntryLoop != NULL)
     {
         CLIENT_ENTRY *pClientEntry = *ppClientEntryLoop;
@@ -2318,21 +2390,25 @@ _serverFindClientEntry
         {
             // Client may not have finished constructing yet
             if (pClientEntry->pClient == NULL && !bFindPartial)
-                return NV_ERR_INVALID_OBJECT_HANDLE;
+                break;
 
             if (ppClientEntry != NULL)
                 *ppClientEntry = pClientEntry;
 
-            return NV_OK;
+            status = NV_OK;
+            break;
         }
         else if (pClientEntry->hClient > hClient)
         {
             // Not found in sorted list
-            return NV_ERR_INVALID_OBJECT;
+            status = NV_ERR_INVALID_OBJECT;
+            break;
         }
     }
 
-    return NV_ERR_INVALID_OBJECT_HANDLE;
+    portSyncRwLockReleaseRead(pShardLock);
+
+    return status;
 }
 
 static
@@ -2366,6 +2442,7 @@ _serverInsertClientEntry
 )
 {
     RsClientList  *pClientList;
+    PORT_RWLOCK   *pShardLock;
     CLIENT_ENTRY **ppClientEntry;
     NvHandle       hClient = pClientEntry->hClient;
 
@@ -2375,6 +2452,9 @@ _serverInsertClientEntry
     }
 
     pClientList  = &(pServer->pClientSortedList[hClient & RS_CLIENT_HANDLE_BUCKET_MASK]);
+    pShardLock   = _serverGetClientShardLock(pServer, hClient);
+
+    portSyncRwLockAcquireWrite(pShardLock);
 
     if (ppClientNext == NULL)
     {
@@ -2385,16 +2465,102 @@ _serverInsertClientEntry
         ppClientEntry = (CLIENT_ENTRY **)listInsertNew(pClientList, ppClientNext);
     }
 
+    if (ppClientEntry != NULL)
+    {
+        *ppClientEntry = pClientEntry;
+    }
+
+    portSyncRwLockReleaseWrite(pShardLock);
+
     if (ppClientEntry == NULL)
     {
         return NV_ERR_NO_MEMORY;
     }
 
-    *ppClientEntry = pClientEntry;
+    _serverMarkClientHandleIndexUsed(pServer, hClient);
 
     return NV_OK;
 }
 
+//
+// One bit per client handle index; a set bit means some client entry (in any
+// handle base) uses the index. Handle assignment scans for a clear bit
+// instead of probing the bucket lists, so it does not degrade as the handle
+// space fragments. All mutations run with the top-level lock held
+// exclusively, like the bucket lists themselves.
+//
+static void
+_serverMarkClientHandleIndexUsed
+(
+    RsServer *pServer,
+    NvHandle  hClient
+)
+{
+    NvU32 index = CLIENT_DECODEHANDLE(hClient);
+
+    pServer->pClientHandleIndexBitmap[index / 64] |= NVBIT64(index % 64);
+}
+
+static void
+_serverClearClientHandleIndex
+(
+    RsServer *pServer,
+    NvHandle  hClient
+)
+{
+    RsClientList  *pClientList = &(pServer->pClientSortedList[hClient & RS_CLIENT_HANDLE_BUCKET_MASK]);
+    CLIENT_ENTRY **ppClientEntry;
+    NvU32          index = CLIENT_DECODEHANDLE(hClient);
+
+    //
+    // Entries from different handle bases can share an index, so only clear
+    // the bit once no entry uses it. Entries with the same index always land
+    // in the same bucket because the bucket is selected by the low bits of
+    // the index.
+    //
+    for (ppClientEntry = listHead(pClientList);
+         ppClientEntry != NULL;
+         ppClientEntry = listNext(pClientList, ppClientEntry))
+    {
+        if ((*ppClientEntry != NULL) &&
+            (CLIENT_DECODEHANDLE((*ppClientEntry)->hClient) == index))
+        {
+            return;
+        }
+    }
+
+    pServer->pClientHandleIndexBitmap[index / 64] &= ~NVBIT64(index % 64);
+}
+
+static
+NV_STATUS
+_serverFindFreeClientHandleIndex
+(
+    RsServer *pServer,
+    NvU32     startIndex,
+    NvU32    *pFreeIndex
+)
+{
+    NvU32 word = (startIndex & RS_CLIENT_HANDLE_DECODE_MASK) / 64;
+    NvU32 i;
+
+    for (i = 0; i < RS_CLIENT_HANDLE_MAX / 64; i++)
+    {
+        NvU64 used = pServer->pClientHandleIndexBitmap[word];
+
+        if (~used != 0)
+        {
+            *pFreeIndex = (word * 64) + portUtilCountTrailingZeros64(~used);
+            return NV_OK;
+        }
+
+        word = (word + 1) % (RS_CLIENT_HANDLE_MAX / 64);
+    }
+
+    // Every index is in use (very unlikely)
+    return NV_ERR_INSUFFICIENT_RESOURCES;
+}
+
 static
 NV_STATUS
 _serverFindNextAvailableClientHandleInBucket
@@ -2407,14 +2573,25 @@ _serverFindNextAvailableClientHandleInBucket
 {
     NvHandle        hPrefixIn, hPrefixOut;
     RsClientList   *pClientList  = &(pServer->pClientSortedList[hClientIn & RS_CLIENT_HANDLE_BUCKET_MASK]);
+    PORT_RWLOCK    *pShardLock   = _serverGetClientShardLock(pServer, hClientIn);
     NvHandle        hClientOut   = hClientIn;
-    CLIENT_ENTRY **ppClientEntry = listHead(pClientList);
+    CLIENT_ENTRY **ppClientEntry;
+    NV_STATUS       status       = NV_OK;
 
+    //
+    // The returned insertion position stays valid after the shard lock is
+    // dropped: bucket lists are only mutated by client alloc/free, which run
+    // with the top-level lock held exclusively.
+    //
     *pppClientNext = NULL;
+
+    portSyncRwLockAcquireRead(pShardLock);
+
+    ppClientEntry = listHead(pClientList);
     if (ppClientEntry == NULL)
     {
         *phClientOut = hClientOut;
-        return NV_OK;
+        goto unlock;
     }
 
     //
@@ -2445,14 +2622,20 @@ _serverFindNextAvailableClientHandleInBucket
     hPrefixIn = hClientIn & ~RS_CLIENT_HANDLE_DECODE_MASK;
     hPrefixOut = hClientOut & ~RS_CLIENT_HANDLE_DECODE_MASK;
     if (hPrefixIn != hPrefixOut)
-        return NV_ERR_INSUFFICIENT_RESOURCES;
+    {
+        status = NV_ERR_INSUFFICIENT_RESOURCES;
+        goto unlock;
+    }
 
     *phClientOut = hClientOut;
     if (ppClientEntry != NULL)
     {
         *pppClientNext = ppClientEntry;
     }
-    return  NV_OK;
+
+unlock:
+    portSyncRwLockReleaseRead(pShardLock);
+    return status;
 }
 
 static
@@ -2475,27 +2658,31 @@ _serverCreateEntryAndLockForNewClient
 
     if (hClient == 0)
     {
-        NvU32 clientHandleIndex = pServer->clientCurrentHandleIndex;
-        NvU16 clientHandleBucketInit = clientHandleIndex & RS_CLIENT_HANDLE_BUCKET_MASK;
-        do
-        {
-            hClient = CLIENT_ENCODEHANDLE(handleBase, clientHandleIndex);
-            clientHandleIndex++;
-            if (clientHandleIndex > RS_CLIENT_HANDLE_DECODE_MASK)
-            {
-                // We will override the client base, loop over
-                clientHandleIndex = 0;
-            }
-            if (clientHandleBucketInit == (clientHandleIndex & RS_CLIENT_HANDLE_BUCKET_MASK))
-            {
-                // We looked through all buckets and we did not find any available client (very unlikely)
-                status = NV_ERR_INSUFFICIENT_RESOURCES;
-                goto _serverCreateEntryAndLockForNewClient_exit;
-            }
-        }
-        while (_serverFindNextAvailableClientHandleInBucket(pServer, hClient, &hClient, &ppClientNext) != NV_OK);
+        NvU32 freeIndex;
+
+        //
+        // The bitmap hands back an unused index in constant time regardless
+        // of how fragmented the handle space has become; the bucket is then
+        // walked once only to find the sorted insertion position.
+        //
+        status = _serverFindFreeClientHandleIndex(pServer,
+                                                  pServer->clientCurrentHandleIndex,
+                                                  &freeIndex);
+        if (status != NV_OK)
+            goto _serverCreateEntryAndLockForNewClient_exit;
+
+        hClient = CLIENT_ENCODEHANDLE(handleBase, freeIndex);
+
+        status = _serverFindNextAvailableClientHandleInBucket(pServer, hClient,
+                                                              &hClient,
+                                                              &ppClientNext);
+        if (status != NV_OK)
+            goto _serverCreateEntryAndLockForNewClient_exit;
 
-        pServer->clientCurrentHandleIndex = clientHandleIndex;
+        // The index came from the bitmap, so the handle cannot be taken
+        NV_ASSERT(CLIENT_DECODEHANDLE(hClient) == freeIndex);
+
+        pServer->clientCurrentHandleIndex = (freeIndex + 1) & RS_CLIENT_HANDLE_DECODE_MASK;
     }
     else
     {
@@ -2653,7 +2840,14 @@ _serverLockClientWithLockInfo
         NV_ASSERT_OK_OR_RETURN(_serverFindClientEntry(pServer, hClient, NV_FALSE, &pClientEntry));
         NV_ASSERT_OR_RETURN(pLockInfo->pClient != NULL, NV_ERR_INVALID_STATE);
         NV_ASSERT_OR_RETURN(pLockInfo->pClient == pClientEntry->pClient, NV_ERR_INVALID_STATE);
-        NV_ASSERT_OR_RETURN(pClientEntry->lockOwnerTid == portThreadGetCurrentThreadId(), NV_ERR_INVALID_STATE);
+
+        //
+        // lockOwnerTid is only recorded for write acquisitions, so ownership
+        // cannot be validated when the lock was taken for read
+        //
+        NV_ASSERT_OR_RETURN((pLockInfo->state & RS_LOCK_STATE_CLIENT_LOCK_READ) ||
+                            (pClientEntry->lockOwnerTid == portThreadGetCurrentThreadId()),
+                            NV_ERR_INVALID_STATE);
 
         *ppClient = pLockInfo->pClient;
         return NV_OK;
@@ -2664,6 +2858,8 @@ _serverLockClientWithLockInfo
         return status;
 
     pLockInfo->state |= RS_LOCK_STATE_CLIENT_LOCK_ACQUIRED;
+    if (access == LOCK_ACCESS_READ)
+        pLockInfo->state |= RS_LOCK_STATE_CLIENT_LOCK_READ;
     pLockInfo->pClient = *ppClient;
     *pReleaseFlags |= RS_LOCK_RELEASE_CLIENT_LOCK;
 
@@ -2827,6 +3023,7 @@ _serverUnlockClientWithLockInfo
             return status;
 
         pLockInfo->state &= ~RS_LOCK_STATE_CLIENT_LOCK_ACQUIRED;
+        pLockInfo->state &= ~RS_LOCK_STATE_CLIENT_LOCK_READ;
         pLockInfo->pClient = NULL;
         *pReleaseFlags &= ~RS_LOCK_RELEASE_CLIENT_LOCK;
     }
@@ -4100,5 +4297,10 @@ serverSupportsReadOnlyLock
         return (!!(pServer->roTopLockApiMask & NVBIT(api)));
     }
 
+    if (lock == RS_LOCK_CLIENT)
+    {
+        return (!!(pServer->roClientLockApiMask & NVBIT(api)));
+    }
+
     return NV_FALSE;
 }
@@ -73,6 +73,22 @@ typedef struct TlsDatabase
     /// @brief Map of thread entries of non ISR threads.
     ThreadEntryMap threadEntries;
 
+#define TLS_FAST_ENTRIES 64
+    /**
+     * @brief Lockless cache of passive thread entries, keyed by thread id.
+     *
+     * tlsEntryGet() is called on RM entry/exit for every API call, so the
+     * spinlock + map lookup above is pure overhead on the hot path. Slots
+     * are published/invalidated under pLock; threadId doubles as a
+     * generation tag (cleared while pThreadEntry is updated), so lockless
+     * readers can validate a slot with two fenced reads and fall back to
+     * the map on any collision or tear.
+     */
+    struct {
+        volatile NvU64 threadId;
+        ThreadEntry   *pThreadEntry;
+    } fastEntries[TLS_FAST_ENTRIES];
+
 #if TLS_ISR_CAN_USE_LOCK
     /// @brief Lock which controls access to ISR-specific structures
     PORT_SPINLOCK *pIsrLock;
@@ -108,6 +124,10 @@ TlsDatabase tlsDatabase; // Zero initialized
 
 // Helper function prototypes
 static NvBool              _tlsIsIsr(void);
+static NvU32               _tlsFastEntryIndex(NvU64 threadId);
+static ThreadEntry        *_tlsFastEntryGet(NvU64 threadId);
+static void                _tlsFastEntryPublish(ThreadEntry *pThreadEntry);
+static void                _tlsFastEntryInvalidate(NvU64 threadId);
 static ThreadEntry        *_tlsThreadEntryGet(void);
 static ThreadEntry        *_tlsThreadEntryGetOrAlloc(void);
 static NvP64               *_tlsEntryAcquire(ThreadEntry *pThreadEntry, NvU64 entryId, PORT_MEM_ALLOCATOR *pCustomAllocator);
@@ -185,6 +205,7 @@ NV_STATUS tlsInitialize(void)
         goto done;
     }
     mapInitIntrusive(&tlsDatabase.threadEntries);
+    portMemSet((void*)tlsDatabase.fastEntries, 0, sizeof(tlsDatabase.fastEntries));
 
     status = _tlsIsrEntriesInit();
     if (status != NV_OK)
@@ -426,6 +447,58 @@ NvU32 tlsEntryUnreference(NvU64 entryId)
 }
 
 
+static NvU32
+_tlsFastEntryIndex(NvU64 threadId)
+{
+    // Fibonacci hash of the thread id, folded to the slot count.
+    return (NvU32)((threadId * 0x9E3779B97F4A7C15ULL) >> 58) % TLS_FAST_ENTRIES;
+}
+
+static ThreadEntry *
+_tlsFastEntryGet(NvU64 threadId)
+{
+    NvU32 idx = _tlsFastEntryIndex(threadId);
+    ThreadEntry *pThreadEntry;
+
+    if (tlsDatabase.fastEntries[idx].threadId != threadId)
+        return NULL;
+    portAtomicMemoryFenceLoad();
+    pThreadEntry = tlsDatabase.fastEntries[idx].pThreadEntry;
+    portAtomicMemoryFenceLoad();
+    //
+    // Only the owning thread ever stores our thread id to this slot, so if
+    // the tag still matches, the pointer read above is our publication.
+    //
+    if (tlsDatabase.fastEntries[idx].threadId != threadId)
+        return NULL;
+    return pThreadEntry;
+}
+
+// Must be called while holding tlsDatabase.pLock to serialize slot writers.
+static void
+_tlsFastEntryPublish(ThreadEntry *pThreadEntry)
+{
+    NvU64 threadId = pThreadEntry->key.threadId;
+    NvU32 idx = _tlsFastEntryIndex(threadId);
+
+    // Clear the tag so readers of a colliding slot see it torn, not stale.
+    portAtomicExSetU64(&tlsDatabase.fastEntries[idx].threadId, 0);
+    tlsDatabase.fastEntries[idx].pThreadEntry = pThreadEntry;
+    portAtomicMemoryFenceStore();
+    portAtomicExSetU64(&tlsDatabase.fastEntries[idx].threadId, threadId);
+}
+
+// Must be called while holding tlsDatabase.pLock to serialize slot writers.
+static void
+_tlsFastEntryInvalidate(NvU64 threadId)
+{
+    NvU32 idx = _tlsFastEntryIndex(threadId);
+
+    // Another thread may have reclaimed the slot; only clear our own tag.
+    portAtomicExCompareAndSwapU64(&tlsDatabase.fastEntries[idx].threadId,
+                                  0, threadId);
+}
+
 static ThreadEntry *
 _tlsThreadEntryGet(void)
 {
@@ -438,8 +511,15 @@ _tlsThreadEntryGet(void)
     else
     {
         NvU64 threadId = portThreadGetCurrentThreadId();
+
+        pThreadEntry = _tlsFastEntryGet(threadId);
+        if (pThreadEntry != NULL)
+            return pThreadEntry;
+
         TLS_SPINLOCK_ACQUIRE(tlsDatabase.pLock);
         pThreadEntry = mapFind(&tlsDatabase.threadEntries, threadId);
+        if (pThreadEntry != NULL)
+            _tlsFastEntryPublish(pThreadEntry);
         TLS_SPINLOCK_RELEASE(tlsDatabase.pLock);
     }
     return pThreadEntry;
@@ -464,6 +544,7 @@ _tlsThreadEntryGetOrAlloc(void)
             mapInsertExisting(&tlsDatabase.threadEntries,
                               pThreadEntry->key.threadId,
                               pThreadEntry);
+            _tlsFastEntryPublish(pThreadEntry);
             TLS_SPINLOCK_RELEASE(tlsDatabase.pLock);
         }
     }
@@ -523,6 +604,7 @@ _tlsEntryRelease
             NV_ASSERT(portMemExSafeForNonPagedAlloc());
             mapDestroy(&pThreadEntry->map);
             TLS_SPINLOCK_ACQUIRE(tlsDatabase.pLock);
+            _tlsFastEntryInvalidate(pThreadEntry->key.threadId);
             mapRemove(&tlsDatabase.threadEntries, pThreadEntry);
             TLS_SPINLOCK_RELEASE(tlsDatabase.pLock);
             PORT_FREE(tlsDatabase.pAllocator, pThreadEntry);
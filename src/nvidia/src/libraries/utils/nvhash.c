@@ -0,0 +1,140 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * @file
+ * @brief xxHash64 implementation of nvHash64Buf().
+ *
+ * Algorithm by Yann Collet (BSD 2-Clause, https://github.com/Cyan4973/xxHash),
+ * reimplemented here against NvPort types. Loads are assembled bytewise so
+ * unaligned input is safe on all supported CPUs; compilers fold the helper
+ * into a single load where the architecture allows it.
+ */
+
+#include "utils/nvhash.h"
+
+#define NV_XXH64_PRIME_1 0x9E3779B185EBCA87ULL
+#define NV_XXH64_PRIME_2 0xC2B2AE3D27D4EB4FULL
+#define NV_XXH64_PRIME_3 0x165667B19E3779F9ULL
+#define NV_XXH64_PRIME_4 0x85EBCA77C2B2AE63ULL
+#define NV_XXH64_PRIME_5 0x27D4EB2F165667C5ULL
+
+static NV_INLINE NvU64 _nvHashRotl64(NvU64 x, NvU32 r)
+{
+    return (x << r) | (x >> (64 - r));
+}
+
+static NV_INLINE NvU64 _nvHashRead64(const NvU8 *p)
+{
+    return (NvU64)p[0]        | ((NvU64)p[1] << 8)  |
+          ((NvU64)p[2] << 16) | ((NvU64)p[3] << 24) |
+          ((NvU64)p[4] << 32) | ((NvU64)p[5] << 40) |
+          ((NvU64)p[6] << 48) | ((NvU64)p[7] << 56);
+}
+
+static NV_INLINE NvU32 _nvHashRead32(const NvU8 *p)
+{
+    return (NvU32)p[0]        | ((NvU32)p[1] << 8)  |
+          ((NvU32)p[2] << 16) | ((NvU32)p[3] << 24);
+}
+
+static NV_INLINE NvU64 _nvHashRound(NvU64 acc, NvU64 input)
+{
+    acc += input * NV_XXH64_PRIME_2;
+    acc  = _nvHashRotl64(acc, 31);
+    acc *= NV_XXH64_PRIME_1;
+    return acc;
+}
+
+static NV_INLINE NvU64 _nvHashMergeRound(NvU64 acc, NvU64 val)
+{
+    acc ^= _nvHashRound(0, val);
+    acc  = acc * NV_XXH64_PRIME_1 + NV_XXH64_PRIME_4;
+    return acc;
+}
+
+NvU64 nvHash64Buf(const void *pData, NvU64 length, NvU64 seed)
+{
+    const NvU8 *p    = (const NvU8 *)pData;
+    const NvU8 *pEnd = p + length;
+    NvU64 h64;
+
+    if (length >= 32)
+    {
+        const NvU8 *pLimit = pEnd - 32;
+        NvU64 v1 = seed + NV_XXH64_PRIME_1 + NV_XXH64_PRIME_2;
+        NvU64 v2 = seed + NV_XXH64_PRIME_2;
+        NvU64 v3 = seed + 0;
+        NvU64 v4 = seed - NV_XXH64_PRIME_1;
+
+        do
+        {
+            v1 = _nvHashRound(v1, _nvHashRead64(p));      p += 8;
+            v2 = _nvHashRound(v2, _nvHashRead64(p));      p += 8;
+            v3 = _nvHashRound(v3, _nvHashRead64(p));      p += 8;
+            v4 = _nvHashRound(v4, _nvHashRead64(p));      p += 8;
+        } while (p <= pLimit);
+
+        h64 = _nvHashRotl64(v1, 1)  + _nvHashRotl64(v2, 7) +
+              _nvHashRotl64(v3, 12) + _nvHashRotl64(v4, 18);
+        h64 = _nvHashMergeRound(h64, v1);
+        h64 = _nvHashMergeRound(h64, v2);
+        h64 = _nvHashMergeRound(h64, v3);
+        h64 = _nvHashMergeRound(h64, v4);
+    }
+    else
+    {
+        h64 = seed + NV_XXH64_PRIME_5;
+    }
+
+    h64 += length;
+
+    while ((pEnd - p) >= 8)
+    {
+        h64 ^= _nvHashRound(0, _nvHashRead64(p));
+        h64  = _nvHashRotl64(h64, 27) * NV_XXH64_PRIME_1 + NV_XXH64_PRIME_4;
+        p   += 8;
+    }
+
+    if ((pEnd - p) >= 4)
+    {
+        h64 ^= (NvU64)_nvHashRead32(p) * NV_XXH64_PRIME_1;
+        h64  = _nvHashRotl64(h64, 23) * NV_XXH64_PRIME_2 + NV_XXH64_PRIME_3;
+        p   += 4;
+    }
+
+    while (p < pEnd)
+    {
+        h64 ^= (*p) * NV_XXH64_PRIME_5;
+        h64  = _nvHashRotl64(h64, 11) * NV_XXH64_PRIME_1;
+        p++;
+    }
+
+    h64 ^= h64 >> 33;
+    h64 *= NV_XXH64_PRIME_2;
+    h64 ^= h64 >> 29;
+    h64 *= NV_XXH64_PRIME_3;
+    h64 ^= h64 >> 32;
+
+    return h64;
+}
@@ -810,10 +810,13 @@ SRCS += src/lib/protobuf/prbenc.c
 SRCS += src/lib/protobuf/prbutil.c
 SRCS += src/lib/ref_count.c
 SRCS += src/lib/zlib/inflate.c
+SRCS += src/libraries/containers/btree/bptree.c
 SRCS += src/libraries/containers/btree/btree.c
 SRCS += src/libraries/containers/eheap/eheap_old.c
+SRCS += src/libraries/containers/hashmap.c
 SRCS += src/libraries/containers/list.c
 SRCS += src/libraries/containers/map.c
+SRCS += src/libraries/containers/mpsc_ringbuf.c
 SRCS += src/libraries/containers/multimap.c
 SRCS += src/libraries/containers/queue.c
 SRCS += src/libraries/containers/ringbuf.c
@@ -913,6 +916,7 @@ SRCS += src/libraries/resserv/src/rs_resource.c
 SRCS += src/libraries/resserv/src/rs_server.c
 SRCS += src/libraries/tls/tls.c
 SRCS += src/libraries/utils/nvassert.c
+SRCS += src/libraries/utils/nvhash.c
 SRCS += ../common/uproc/os/libos-v3.1.0/lib/libdwarf.c
 SRCS += ../common/uproc/os/libos-v3.1.0/lib/libelf.c
 SRCS += ../common/uproc/os/libos-v3.1.0/lib/liblogdecode.c